@@ -164,6 +164,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/api/border_router_api.cpp                              \
     src/core/api/channel_manager_api.cpp                            \
     src/core/api/channel_monitor_api.cpp                            \
+    src/core/api/coex_monitor_api.cpp                               \
     src/core/api/child_supervision_api.cpp                          \
     src/core/api/coap_api.cpp                                       \
     src/core/api/coap_secure_api.cpp                                \
@@ -343,6 +344,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/thread/uri_paths.cpp                                   \
     src/core/utils/channel_manager.cpp                              \
     src/core/utils/channel_monitor.cpp                              \
+    src/core/utils/coex_monitor.cpp                                 \
     src/core/utils/child_supervision.cpp                            \
     src/core/utils/flash.cpp                                        \
     src/core/utils/heap.cpp                                         \
@@ -62,6 +62,23 @@
 #define OPENTHREAD_SIMULATION_VIRTUAL_TIME_UART 0
 #endif
 
+/**
+ * @def OPENTHREAD_SIMULATION_SHM_RADIO
+ *
+ * This setting configures whether to exchange radio frames over a shared-memory fabric instead of UDP sockets.
+ *
+ * All nodes of a simulation map the same shared-memory segment and publish frames into per-node lock-free rings,
+ * avoiding per-frame socket system calls so that large (hundreds of nodes) simulations run faster than real time.
+ *
+ */
+#ifndef OPENTHREAD_SIMULATION_SHM_RADIO
+#define OPENTHREAD_SIMULATION_SHM_RADIO 0
+#endif
+
+#if OPENTHREAD_SIMULATION_SHM_RADIO && OPENTHREAD_SIMULATION_VIRTUAL_TIME
+#error "OPENTHREAD_SIMULATION_SHM_RADIO cannot be combined with OPENTHREAD_SIMULATION_VIRTUAL_TIME"
+#endif
+
 /**
  * @def OPENTHREAD_PLATFORM_USE_PSEUDO_RESET
  *
@@ -231,6 +231,47 @@ void otSimSendUartWriteEvent(const uint8_t *aData, uint16_t aLength);
  */
 bool platformRadioIsTransmitPending(void);
 
+#if OPENTHREAD_SIMULATION_SHM_RADIO
+
+/**
+ * This function initializes the shared-memory radio fabric.
+ *
+ */
+void platformShmRadioInit(void);
+
+/**
+ * This function shuts down the shared-memory radio fabric.
+ *
+ */
+void platformShmRadioDeinit(void);
+
+/**
+ * This function publishes a radio frame into this node's ring of the shared-memory fabric.
+ *
+ * @param[in]  aBuf     A pointer to the frame (channel byte followed by the PSDU).
+ * @param[in]  aLength  The frame length (in bytes).
+ *
+ */
+void platformShmRadioTransmit(const uint8_t *aBuf, uint16_t aLength);
+
+/**
+ * This function bounds the main-loop select timeout so the shared-memory fabric is polled regularly.
+ *
+ * @param[inout]  aTimeout  A pointer to the timeval struct.
+ *
+ */
+void platformShmRadioUpdateTimeout(struct timeval *aTimeout);
+
+/**
+ * This function drains frames published by other nodes and inputs them via `platformRadioReceive()`.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ *
+ */
+void platformShmRadioProcess(otInstance *aInstance);
+
+#endif // OPENTHREAD_SIMULATION_SHM_RADIO
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
 /**
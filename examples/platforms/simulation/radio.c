@@ -68,7 +68,7 @@ enum
 #if OPENTHREAD_SIMULATION_VIRTUAL_TIME
 extern int      sSockFd;
 extern uint16_t sPortOffset;
-#else
+#elif !OPENTHREAD_SIMULATION_SHM_RADIO
 static int      sTxFd       = -1;
 static int      sRxFd       = -1;
 static uint16_t sPortOffset = 0;
@@ -272,7 +272,7 @@ void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
     sPromiscuous = aEnable;
 }
 
-#if OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
+#if OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0 && !OPENTHREAD_SIMULATION_SHM_RADIO
 static void initFds(void)
 {
     int                fd;
@@ -336,11 +336,13 @@ exit:
         exit(EXIT_FAILURE);
     }
 }
-#endif // OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
+#endif // OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0 && !OPENTHREAD_SIMULATION_SHM_RADIO
 
 void platformRadioInit(void)
 {
-#if OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
+#if OPENTHREAD_SIMULATION_SHM_RADIO
+    platformShmRadioInit();
+#elif OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
     char *offset;
 
     offset = getenv("PORT_OFFSET");
@@ -724,7 +726,7 @@ bool platformRadioIsTransmitPending(void)
     return sState == OT_RADIO_STATE_TRANSMIT && !sTxWait;
 }
 
-#if OPENTHREAD_SIMULATION_VIRTUAL_TIME
+#if OPENTHREAD_SIMULATION_VIRTUAL_TIME || OPENTHREAD_SIMULATION_SHM_RADIO
 void platformRadioReceive(otInstance *aInstance, uint8_t *aBuf, uint16_t aBufLength)
 {
     assert(sizeof(sReceiveMessage) >= aBufLength);
@@ -735,7 +737,23 @@ void platformRadioReceive(otInstance *aInstance, uint8_t *aBuf, uint16_t aBufLen
 
     radioReceive(aInstance);
 }
-#else
+#endif
+
+#if OPENTHREAD_SIMULATION_SHM_RADIO
+void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMaxFd)
+{
+    // The shared-memory fabric has no file descriptors; the main loop polls
+    // it with a select timeout bounded by platformShmRadioUpdateTimeout().
+    OT_UNUSED_VARIABLE(aReadFdSet);
+    OT_UNUSED_VARIABLE(aWriteFdSet);
+    OT_UNUSED_VARIABLE(aMaxFd);
+}
+
+void platformRadioDeinit(void)
+{
+    platformShmRadioDeinit();
+}
+#elif OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
 void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMaxFd)
 {
     if (aReadFdSet != NULL && (sState != OT_RADIO_STATE_TRANSMIT || sTxWait))
@@ -779,7 +797,9 @@ void platformRadioProcess(otInstance *aInstance, const fd_set *aReadFdSet, const
     OT_UNUSED_VARIABLE(aReadFdSet);
     OT_UNUSED_VARIABLE(aWriteFdSet);
 
-#if OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
+#if OPENTHREAD_SIMULATION_SHM_RADIO
+    platformShmRadioProcess(aInstance);
+#elif OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
     if (FD_ISSET(sRxFd, aReadFdSet))
     {
         struct sockaddr_in sockaddr;
@@ -820,7 +840,9 @@ void platformRadioProcess(otInstance *aInstance, const fd_set *aReadFdSet, const
 
 void radioTransmit(struct RadioMessage *aMessage, const struct otRadioFrame *aFrame)
 {
-#if OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
+#if OPENTHREAD_SIMULATION_SHM_RADIO
+    platformShmRadioTransmit((const uint8_t *)aMessage, (uint16_t)(1 + aFrame->mLength));
+#elif OPENTHREAD_SIMULATION_VIRTUAL_TIME == 0
     ssize_t            rval;
     struct sockaddr_in sockaddr;
 
@@ -991,6 +1013,21 @@ otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint1
     return OT_ERROR_NOT_IMPLEMENTED;
 }
 
+otError otPlatRadioEnergyScanBatch(otInstance *aInstance,
+                                   uint32_t    aChannelMask,
+                                   uint32_t    aSampleInterval,
+                                   uint16_t    aSampleCount,
+                                   int8_t      aRssiThreshold)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aChannelMask);
+    OT_UNUSED_VARIABLE(aSampleInterval);
+    OT_UNUSED_VARIABLE(aSampleCount);
+    OT_UNUSED_VARIABLE(aRssiThreshold);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -0,0 +1,217 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the shared-memory radio fabric for the simulation platform.
+ *
+ * Every node of a simulation maps the same shared-memory segment. The segment holds one single-producer ring per
+ * node; a node publishes each transmitted frame (including acks) into its own ring and polls the rings of all other
+ * nodes, so no per-frame system calls are made. Producers publish a record by incrementing the ring write sequence
+ * with a full memory barrier; consumers detect (and skip past) records that were overwritten while being copied, so
+ * no locks are needed. A slow consumer loses the oldest frames, which matches the lossy nature of the radio medium.
+ */
+
+#include "platform-simulation.h"
+
+#if OPENTHREAD_SIMULATION_SHM_RADIO
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <openthread/platform/radio.h>
+
+#include "utils/code_utils.h"
+
+enum
+{
+    SHM_RADIO_RING_SIZE        = 64,   // Records per node ring (must be a power of two).
+    SHM_RADIO_POLL_INTERVAL_US = 1000, // Upper bound on the main-loop select timeout.
+};
+
+struct ShmRadioRecord
+{
+    uint16_t mLength;
+    uint8_t  mData[OT_RADIO_FRAME_MAX_SIZE + 1]; // Channel byte followed by the PSDU.
+};
+
+struct ShmRadioRing
+{
+    volatile uint32_t     mWriteSeq;
+    struct ShmRadioRecord mRecords[SHM_RADIO_RING_SIZE];
+};
+
+struct ShmRadioFabric
+{
+    struct ShmRadioRing mRings[MAX_NETWORK_SIZE];
+};
+
+static struct ShmRadioFabric *sFabric = NULL;
+static int                    sShmFd  = -1;
+static uint32_t               sReadSeq[MAX_NETWORK_SIZE];
+
+void platformShmRadioInit(void)
+{
+    char        name[64];
+    const char *offset     = getenv("PORT_OFFSET");
+    uint16_t    portOffset = 0;
+
+    if (offset != NULL)
+    {
+        char *endptr;
+
+        portOffset = (uint16_t)strtol(offset, &endptr, 0);
+
+        if (*endptr != '\0')
+        {
+            fprintf(stderr, "Invalid PORT_OFFSET: %s\n", offset);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    snprintf(name, sizeof(name), "/ot-sim-radio-%u", portOffset);
+
+    otEXPECT_ACTION((sShmFd = shm_open(name, O_CREAT | O_RDWR, 0600)) != -1, perror("shm_open"));
+    otEXPECT_ACTION(ftruncate(sShmFd, (off_t)sizeof(struct ShmRadioFabric)) != -1, perror("ftruncate"));
+
+    sFabric = (struct ShmRadioFabric *)mmap(NULL, sizeof(struct ShmRadioFabric), PROT_READ | PROT_WRITE, MAP_SHARED,
+                                            sShmFd, 0);
+    otEXPECT_ACTION(sFabric != MAP_FAILED, sFabric = NULL; perror("mmap"));
+
+    // Start reading at the current write position of every peer ring so
+    // that frames published before this node joined are not replayed.
+    for (uint32_t i = 0; i < MAX_NETWORK_SIZE; i++)
+    {
+        sReadSeq[i] = sFabric->mRings[i].mWriteSeq;
+    }
+
+exit:
+    if (sFabric == NULL)
+    {
+        exit(EXIT_FAILURE);
+    }
+}
+
+void platformShmRadioDeinit(void)
+{
+    if (sFabric != NULL)
+    {
+        // The segment is left in place for the remaining nodes; the kernel
+        // reclaims it when the last mapping goes away after an unlink by
+        // whoever tears down the simulation.
+        munmap(sFabric, sizeof(struct ShmRadioFabric));
+        sFabric = NULL;
+    }
+
+    if (sShmFd != -1)
+    {
+        close(sShmFd);
+        sShmFd = -1;
+    }
+}
+
+void platformShmRadioTransmit(const uint8_t *aBuf, uint16_t aLength)
+{
+    struct ShmRadioRing *  ring = &sFabric->mRings[gNodeId - 1];
+    struct ShmRadioRecord *record;
+
+    assert(aLength <= sizeof(record->mData));
+
+    record = &ring->mRecords[ring->mWriteSeq % SHM_RADIO_RING_SIZE];
+
+    memcpy(record->mData, aBuf, aLength);
+    record->mLength = aLength;
+
+    // Full barrier: the record contents must be visible before the
+    // incremented write sequence publishes the record to consumers.
+    (void)__sync_add_and_fetch(&ring->mWriteSeq, 1);
+}
+
+void platformShmRadioUpdateTimeout(struct timeval *aTimeout)
+{
+    // The fabric has no file descriptor to wake the main loop on, so the
+    // select timeout is bounded to keep the peer rings polled.
+    if (aTimeout->tv_sec > 0 || aTimeout->tv_usec > SHM_RADIO_POLL_INTERVAL_US || platformRadioIsTransmitPending())
+    {
+        aTimeout->tv_sec  = 0;
+        aTimeout->tv_usec = platformRadioIsTransmitPending() ? 0 : SHM_RADIO_POLL_INTERVAL_US;
+    }
+}
+
+void platformShmRadioProcess(otInstance *aInstance)
+{
+    for (uint32_t i = 0; i < MAX_NETWORK_SIZE; i++)
+    {
+        struct ShmRadioRing *ring = &sFabric->mRings[i];
+
+        if (i == gNodeId - 1)
+        {
+            continue;
+        }
+
+        while (sReadSeq[i] != ring->mWriteSeq)
+        {
+            struct ShmRadioRecord record;
+
+            // A slow consumer is lapped by the producer; resynchronize to
+            // the oldest record still present, dropping what was overrun.
+            if (ring->mWriteSeq - sReadSeq[i] > SHM_RADIO_RING_SIZE)
+            {
+                sReadSeq[i] = ring->mWriteSeq - SHM_RADIO_RING_SIZE;
+            }
+
+            record = ring->mRecords[sReadSeq[i] % SHM_RADIO_RING_SIZE];
+
+            __sync_synchronize();
+
+            // If the producer lapped this slot while it was being copied,
+            // the copy may be torn; discard it and resynchronize above.
+            if (ring->mWriteSeq - sReadSeq[i] > SHM_RADIO_RING_SIZE)
+            {
+                continue;
+            }
+
+            sReadSeq[i]++;
+
+            if (record.mLength >= 1 && record.mLength <= sizeof(record.mData))
+            {
+                platformRadioReceive(aInstance, record.mData, record.mLength);
+            }
+        }
+    }
+}
+
+#endif // OPENTHREAD_SIMULATION_SHM_RADIO
@@ -373,6 +373,25 @@ otError otBackboneRouterGetNdProxyInfo(otInstance *                 aInstance,
                                        const otIp6Address *         aDua,
                                        otBackboneRouterNdProxyInfo *aNdProxyInfo);
 
+/**
+ * Represents the Backbone Router ND Proxy table occupancy info.
+ *
+ */
+struct otBackboneRouterNdProxyTableInfo
+{
+    uint16_t mNumEntries; ///< Current number of valid ND Proxy entries.
+    uint16_t mMaxEntries; ///< Maximum number of ND Proxy entries supported.
+};
+
+/**
+ * This method gets the Backbone Router ND Proxy table occupancy info.
+ *
+ * @param[in]   aInstance   A pointer to an OpenThread instance.
+ * @param[out]  aTableInfo  A pointer to the table info to populate.
+ *
+ */
+void otBackboneRouterGetNdProxyTableInfo(otInstance *aInstance, otBackboneRouterNdProxyTableInfo *aTableInfo);
+
 /**
  * Represents the Domain Prefix events.
  *
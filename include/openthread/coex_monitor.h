@@ -0,0 +1,145 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file includes the OpenThread API for the coex monitor feature.
+ */
+
+#ifndef OPENTHREAD_COEX_MONITOR_H_
+#define OPENTHREAD_COEX_MONITOR_H_
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-coex-monitor
+ *
+ * @brief
+ *   This module includes functions for the coex monitor feature.
+ *
+ *   The functions in this module are available when coex monitor feature
+ *   (`OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE`) is enabled.
+ *
+ *   When running, the coex monitor periodically pulls the radio coexistence metrics counters (see
+ *   `otPlatRadioGetCoexMetrics()`), computes the deltas against the previous pull (one "aggregation window"),
+ *   and retains the recent windows to provide min/avg/max stats of grant denials (grant glitches plus tx/rx
+ *   grant wait timeouts) and grant requests. When the grant denials within one window reach a pre-specified
+ *   threshold, `OT_CHANGED_COEX_METRICS` is signaled through the state changed callback, so the host can alarm
+ *   on grant denial spikes without polling the raw counters.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This structure represents the aggregated coex monitor stats over the retained windows.
+ *
+ */
+typedef struct otCoexMonitorStats
+{
+    uint32_t mNumWindows;      ///< Number of aggregation windows retained.
+    uint32_t mMinGrantDenials; ///< Minimum per-window grant denials (grant glitches + grant wait timeouts).
+    uint32_t mAvgGrantDenials; ///< Average per-window grant denials.
+    uint32_t mMaxGrantDenials; ///< Maximum per-window grant denials.
+    uint32_t mMinRequests;     ///< Minimum per-window grant requests (tx + rx).
+    uint32_t mAvgRequests;     ///< Average per-window grant requests.
+    uint32_t mMaxRequests;     ///< Maximum per-window grant requests.
+} otCoexMonitorStats;
+
+/**
+ * This function enables or disables the coex monitor operation.
+ *
+ * Once started, any previously collected data is cleared.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aEnabled   TRUE to enable/start the coex monitor, FALSE to disable/stop it.
+ *
+ * @retval OT_ERROR_NONE             Coex monitor state changed successfully.
+ * @retval OT_ERROR_ALREADY          Coex monitor is already in the given state.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The radio does not provide coex metrics.
+ *
+ */
+otError otCoexMonitorSetEnabled(otInstance *aInstance, bool aEnabled);
+
+/**
+ * This function indicates whether the coex monitor operation is enabled and running.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns TRUE if the coex monitor operation is enabled, FALSE otherwise.
+ *
+ */
+bool otCoexMonitorIsEnabled(otInstance *aInstance);
+
+/**
+ * This function gets the coex monitor sample interval in milliseconds.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  The coex monitor sample interval in milliseconds.
+ *
+ */
+uint32_t otCoexMonitorGetSampleInterval(otInstance *aInstance);
+
+/**
+ * This function gets the coex monitor grant denial threshold (per aggregation window).
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  The grant denial threshold.
+ *
+ */
+uint32_t otCoexMonitorGetGrantDenialThreshold(otInstance *aInstance);
+
+/**
+ * This function gets the aggregated coex monitor stats over the retained windows.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aStats     A pointer to the stats structure to populate.
+ *
+ * @retval OT_ERROR_NONE           Successfully retrieved the stats.
+ * @retval OT_ERROR_INVALID_STATE  No aggregation window has completed yet.
+ *
+ */
+otError otCoexMonitorGetStats(otInstance *aInstance, otCoexMonitorStats *aStats);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_COEX_MONITOR_H_
@@ -158,6 +158,16 @@ typedef struct otHistoryTrackerNeighborInfo
     bool         mIsChild : 1;          ///< Indicates whether or not the neighbor is a child.
 } otHistoryTrackerNeighborInfo;
 
+/**
+ * This structure represents a mesh forwarder queue depth sample.
+ *
+ */
+typedef struct otHistoryTrackerForwarderQueueInfo
+{
+    uint16_t mSendQueueMessages;  ///< Number of messages in the send queue at the time of recording entry.
+    uint16_t mReassemblyMessages; ///< Number of messages in the 6LoWPAN reassembly list.
+} otHistoryTrackerForwarderQueueInfo;
+
 /**
  * This function initializes an `otHistoryTrackerIterator`.
  *
@@ -242,6 +252,56 @@ const otHistoryTrackerNeighborInfo *otHistoryTrackerIterateNeighborHistory(otIns
                                                                            otHistoryTrackerIterator *aIterator,
                                                                            uint32_t *                aEntryAge);
 
+/**
+ * This function iterates over the entries in the mesh forwarder queue depth history list.
+ *
+ * @param[in]    aInstance   A pointer to the OpenThread instance.
+ * @param[inout] aIterator   A pointer to an iterator. MUST be initialized or the behavior is undefined.
+ * @param[out]   aEntryAge   A pointer to a variable to output the entry's age. MUST NOT be NULL.
+ *                           Age is provided as the duration (in milliseconds) from when entry was recorded to
+ *                           @p aIterator initialization time. It is set to `OT_HISTORY_TRACKER_MAX_AGE` for entries
+ *                           older than max age.
+ *
+ * @returns The `otHistoryTrackerForwarderQueueInfo` entry or `NULL` if no more entries in the list.
+ *
+ */
+const otHistoryTrackerForwarderQueueInfo *otHistoryTrackerIterateForwarderQueueHistory(
+    otInstance *              aInstance,
+    otHistoryTrackerIterator *aIterator,
+    uint32_t *                aEntryAge);
+
+/**
+ * This function exports a packed binary snapshot of the RX history list in a single call.
+ *
+ * Entries are written to @p aBuffer from newest to oldest. Each exported record is a 32-bit entry age (duration in
+ * milliseconds from when the entry was recorded to the time of this call, in host byte order) followed by the
+ * `otHistoryTrackerMessageInfo` entry itself. As many whole records as fit in @p aSize bytes are written.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ * @param[out] aBuffer    A pointer to a buffer to output the snapshot (MUST NOT be NULL).
+ * @param[in]  aSize      The size of @p aBuffer (in bytes).
+ *
+ * @returns The number of bytes written to @p aBuffer.
+ *
+ */
+uint16_t otHistoryTrackerExportRxHistory(otInstance *aInstance, void *aBuffer, uint16_t aSize);
+
+/**
+ * This function exports a packed binary snapshot of the TX history list in a single call.
+ *
+ * Entries are written to @p aBuffer from newest to oldest. Each exported record is a 32-bit entry age (duration in
+ * milliseconds from when the entry was recorded to the time of this call, in host byte order) followed by the
+ * `otHistoryTrackerMessageInfo` entry itself. As many whole records as fit in @p aSize bytes are written.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ * @param[out] aBuffer    A pointer to a buffer to output the snapshot (MUST NOT be NULL).
+ * @param[in]  aSize      The size of @p aBuffer (in bytes).
+ *
+ * @returns The number of bytes written to @p aBuffer.
+ *
+ */
+uint16_t otHistoryTrackerExportTxHistory(otInstance *aInstance, void *aBuffer, uint16_t aSize);
+
 /**
  * This function converts a given entry age to a human-readable string.
  *
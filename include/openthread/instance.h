@@ -160,6 +160,33 @@ uint64_t otInstanceGetUptime(otInstance *aInstance);
  */
 void otInstanceGetUptimeAsString(otInstance *aInstance, char *aBuffer, uint16_t aSize);
 
+/**
+ * This structure represents one entry of the OpenThread instance memory map (see `otInstanceGetMemoryMap()`).
+ *
+ */
+typedef struct otInstanceMemoryMapEntry
+{
+    const char *mName;   ///< The member name (e.g., "mThreadNetif").
+    uint32_t    mOffset; ///< The member offset (in bytes) from the start of the OpenThread instance.
+    uint32_t    mSize;   ///< The member size (in bytes).
+} otInstanceMemoryMapEntry;
+
+/**
+ * This function gets the memory map of the OpenThread instance.
+ *
+ * This function requires `OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE` to be enabled.
+ *
+ * The memory map lists the size and offset of each major member of the OpenThread instance (in declaration order),
+ * allowing the instance RAM footprint to be attributed by subsystem. The map is determined by the build
+ * configuration and is the same for all instances.
+ *
+ * @param[out]  aNumEntries  A pointer to a variable to output the number of entries in the returned table.
+ *
+ * @returns A pointer to the first entry of the memory map table.
+ *
+ */
+const otInstanceMemoryMapEntry *otInstanceGetMemoryMap(uint16_t *aNumEntries);
+
 /**
  * This enumeration defines flags that are passed as part of `otStateChangedCallback`.
  *
@@ -196,6 +223,7 @@ enum
     OT_CHANGED_JOINER_STATE                 = 1 << 27, ///< Joiner state changed
     OT_CHANGED_ACTIVE_DATASET               = 1 << 28, ///< Active Operational Dataset changed
     OT_CHANGED_PENDING_DATASET              = 1 << 29, ///< Pending Operational Dataset changed
+    OT_CHANGED_COEX_METRICS                 = 1 << 30, ///< Radio coex metrics crossed threshold
 };
 
 /**
@@ -228,6 +256,27 @@ typedef void (*otStateChangedCallback)(otChangedFlags aFlags, void *aContext);
  */
 otError otSetStateChangedCallback(otInstance *aInstance, otStateChangedCallback aCallback, void *aContext);
 
+/**
+ * This function registers a callback for a filtered set of configuration or state changes within OpenThread.
+ *
+ * The callback is invoked only when at least one of the changed flags is included in @p aEventMask. This avoids
+ * waking the caller for events it does not care about (e.g., on frequent Network Data churn).
+ *
+ * @param[in]  aInstance   A pointer to an OpenThread instance.
+ * @param[in]  aCallback   A pointer to a function that is called with certain configuration or state changes.
+ * @param[in]  aContext    A pointer to application-specific context.
+ * @param[in]  aEventMask  A bit-field of `OT_CHANGED_*` definitions selecting the changes of interest.
+ *
+ * @retval OT_ERROR_NONE     Added the callback to the list of callbacks.
+ * @retval OT_ERROR_ALREADY  The callback was already registered.
+ * @retval OT_ERROR_NO_BUFS  Could not add the callback due to resource constraints.
+ *
+ */
+otError otSetFilteredStateChangedCallback(otInstance *           aInstance,
+                                          otStateChangedCallback aCallback,
+                                          void *                 aContext,
+                                          otChangedFlags         aEventMask);
+
 /**
  * This function removes a callback to indicate when certain configuration or state changes within OpenThread.
  *
@@ -103,6 +103,7 @@ typedef struct otMacFilterEntry
 {
     otExtAddress mExtAddress; ///< IEEE 802.15.4 Extended Address
     int8_t       mRssIn;      ///< Received signal strength
+    uint32_t     mNumHits;    ///< Number of received frames that matched this entry
 } otMacFilterEntry;
 
 /**
@@ -370,6 +371,22 @@ typedef struct otMacCounters
      *
      */
     uint32_t mRxErrOther;
+
+    /**
+     * The cumulative time (in microseconds) spent on AES-CCM security processing of transmitted frames.
+     *
+     * Tracked only when `OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE` is set; remains zero otherwise.
+     *
+     */
+    uint32_t mTxSecurityTime;
+
+    /**
+     * The cumulative time (in microseconds) spent on AES-CCM security processing of received frames.
+     *
+     * Tracked only when `OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE` is set; remains zero otherwise.
+     *
+     */
+    uint32_t mRxSecurityTime;
 } otMacCounters;
 
 /**
@@ -923,6 +940,33 @@ const uint32_t *otLinkGetTxIndirectRetrySuccessHistogram(otInstance *aInstance,
  */
 void otLinkResetTxRetrySuccessHistogram(otInstance *aInstance);
 
+/**
+ * This method gets histogram of queue-to-air latency for direct transmissions.
+ *
+ * This function is valid when OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE configuration is enabled.
+ *
+ * The latency is measured from when a direct frame transmission is requested until the transmit-done callback
+ * for the frame is processed. Bin `n` (for `n >= 1`) counts transmissions with latency in range `[2^n, 2^(n+1))`
+ * msec, with bin zero covering `[0,2)` and the last bin also covering all larger latencies.
+ *
+ * @param[in]   aInstance        A pointer to an OpenThread instance.
+ * @param[out]  aNumberOfBins    A pointer to where the size of returned histogram array is placed.
+ *
+ * @returns     A pointer to the histogram of transmit latencies (in a form of an array).
+ *
+ */
+const uint32_t *otLinkGetTxLatencyHistogram(otInstance *aInstance, uint8_t *aNumberOfBins);
+
+/**
+ * This method clears the histogram of queue-to-air latency for direct transmissions.
+ *
+ * This function is valid when OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE configuration is enabled.
+ *
+ * @param[in]   aInstance          A pointer to an OpenThread instance.
+ *
+ */
+void otLinkResetTxLatencyHistogram(otInstance *aInstance);
+
 /**
  * Get the MAC layer counters.
  *
@@ -966,6 +1010,68 @@ typedef void (*otLinkPcapCallback)(const otRadioFrame *aFrame, bool aIsTx, void
  */
 void otLinkSetPcapCallback(otInstance *aInstance, otLinkPcapCallback aPcapCallback, void *aCallbackContext);
 
+/**
+ * This function indicates whether the MAC frame capture tap is enabled.
+ *
+ * This function requires `OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE`.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @retval true   Frame capture is enabled.
+ * @retval false  Frame capture is not enabled.
+ *
+ */
+bool otLinkFrameCaptureIsEnabled(otInstance *aInstance);
+
+/**
+ * This function enables or disables the MAC frame capture tap.
+ *
+ * When enabled, transmitted and received MAC frames are copied into a fixed-size ring buffer with pcap record
+ * framing, to be drained with `otLinkFrameCaptureRead()`. The capture is lossy by design: when the ring buffer is
+ * full, new frames are dropped and counted (see `otLinkFrameCaptureGetDroppedCount()`) instead of slowing down MAC
+ * processing. Enabling clears the ring buffer and counters.
+ *
+ * This function requires `OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE`.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ * @param[in]  aEnable   true to enable frame capture, false otherwise.
+ *
+ */
+void otLinkFrameCaptureSetEnabled(otInstance *aInstance, bool aEnable);
+
+/**
+ * This function reads (and removes) the oldest captured frame record from the capture ring buffer.
+ *
+ * Each record is a 16-byte pcap record header (`ts_sec`, `ts_usec`, `incl_len`, `orig_len` - host byte order)
+ * followed by the frame PSDU (pcap link type `LINKTYPE_IEEE802_15_4_WITHFCS`).
+ *
+ * This function requires `OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE`.
+ *
+ * @param[in]     aInstance A pointer to an OpenThread instance.
+ * @param[out]    aBuffer   A pointer to a buffer to output the record.
+ * @param[inout]  aLength   On entry, the size of @p aBuffer (in bytes). On exit, the record length (in bytes).
+ *
+ * @retval OT_ERROR_NONE       Successfully read the oldest record into @p aBuffer.
+ * @retval OT_ERROR_NOT_FOUND  The capture ring buffer is empty.
+ * @retval OT_ERROR_NO_BUFS    @p aBuffer is too small. @p aLength is updated to the required length and the record
+ *                             is retained.
+ *
+ */
+otError otLinkFrameCaptureRead(otInstance *aInstance, uint8_t *aBuffer, uint16_t *aLength);
+
+/**
+ * This function returns the number of frames dropped due to a full capture ring buffer since the capture was
+ * enabled.
+ *
+ * This function requires `OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE`.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @returns The dropped frame count.
+ *
+ */
+uint32_t otLinkFrameCaptureGetDroppedCount(otInstance *aInstance);
+
 /**
  * This function indicates whether or not promiscuous mode is enabled at the link layer.
  *
@@ -110,6 +110,36 @@ bool otLinkRawGetPromiscuous(otInstance *aInstance);
  */
 otError otLinkRawSetPromiscuous(otInstance *aInstance, bool aEnable);
 
+/**
+ * This structure represents a raw link-layer receive frame filter.
+ *
+ */
+typedef struct otLinkRawRxFilter
+{
+    uint8_t  mFrameTypeMask;  ///< Bitmask of accepted frame types (bit n accepts frame type n). Zero accepts all.
+    bool     mFilterPanId;    ///< Whether to accept only frames matching `mPanId`.
+    uint16_t mPanId;          ///< The PAN ID to match (applicable when `mFilterPanId` is true).
+    bool     mFilterSrcShort; ///< Whether to accept only frames matching `mSrcShortAddress`.
+    uint16_t mSrcShortAddress; ///< The source short address to match (applicable when `mFilterSrcShort` is true).
+} otLinkRawRxFilter;
+
+/**
+ * This function sets the receive frame filter of the raw link-layer.
+ *
+ * The filter is applied to received frames before they are passed to the receive callback, so in a radio
+ * co-processor build non-matching frames are discarded on the co-processor and never occupy the host link.
+ *
+ * This function requires `OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE`.
+ *
+ * @param[in] aInstance  A pointer to an OpenThread instance.
+ * @param[in] aFilter    A pointer to the filter settings, or NULL to clear the filter (accept all frames).
+ *
+ * @retval OT_ERROR_NONE             Successfully set the filter.
+ * @retval OT_ERROR_INVALID_STATE    The raw link-layer isn't enabled.
+ *
+ */
+otError otLinkRawSetRxFilter(otInstance *aInstance, const otLinkRawRxFilter *aFilter);
+
 /**
  * Set the Short Address for address filtering.
  *
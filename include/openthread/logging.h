@@ -76,6 +76,17 @@ otLogLevel otLoggingGetLevel(void);
  */
 otError otLoggingSetLevel(otLogLevel aLogLevel);
 
+/**
+ * This function emits all log entries captured in the deferred log ring buffer to `otPlatLog()`.
+ *
+ * It is intended to be called from the application/platform main loop when idle. If any entries were dropped
+ * because the ring buffer was full, a warning indicating the number of dropped entries is also emitted.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE=1`.
+ *
+ */
+void otLoggingFlushDeferred(void);
+
 /**
  * @}
  *
@@ -64,8 +64,20 @@ typedef struct otMessage otMessage;
  */
 typedef struct otBufferInfo
 {
-    uint16_t mTotalBuffers;            ///< The number of buffers in the pool.
-    uint16_t mFreeBuffers;             ///< The number of free message buffers.
+    uint16_t mTotalBuffers; ///< The number of buffers in the pool.
+    uint16_t mFreeBuffers;  ///< The number of free message buffers.
+    uint16_t mMaxUsedBuffers; ///< The maximum number of buffers in use at the same time since stack initialization.
+
+    /**
+     * The maximum number of buffers in use at the same time as observed while allocating buffers at each message
+     * priority level (indexed by `otMessagePriority` values, with index 3 corresponding to the stack-internal
+     * network-control priority).
+     *
+     * This provides a per-priority breakdown of buffer pool pressure. The values are zero when the message pool is
+     * heap or platform managed.
+     *
+     */
+    uint16_t mMaxUsedBuffersByPriority[4];
     uint16_t m6loSendMessages;         ///< The number of messages in the 6lo send queue.
     uint16_t m6loSendBuffers;          ///< The number of buffers in the 6lo send queue.
     uint16_t m6loReassemblyMessages;   ///< The number of messages in the 6LoWPAN reassembly queue.
@@ -208,6 +220,19 @@ void otMessageSetOffset(otMessage *aMessage, uint16_t aOffset);
  */
 bool otMessageIsLinkSecurityEnabled(const otMessage *aMessage);
 
+/**
+ * This function sets whether the transport-layer checksum of the message is already verified.
+ *
+ * This can be used for a message injected from a host network interface where the host network stack has already
+ * computed or validated the transport-layer checksum, allowing checksum verification to be skipped when the message
+ * is received by the OpenThread stack.
+ *
+ * @param[in]  aMessage   A pointer to a message buffer.
+ * @param[in]  aVerified  TRUE if the checksum is already verified, FALSE otherwise.
+ *
+ */
+void otMessageSetChecksumVerified(otMessage *aMessage, bool aVerified);
+
 /**
  * This function sets/forces the message to be forwarded using direct transmission.
  * Default setting for a new message is `false`.
@@ -248,6 +273,45 @@ int8_t otMessageGetRss(const otMessage *aMessage);
  */
 otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength);
 
+/**
+ * This function pointer is called when a message no longer references external data appended with
+ * `otMessageAppendExternalData()` (i.e., when the message is freed) and the caller may reclaim the data buffer.
+ *
+ * @param[in]  aData     A pointer to the external data buffer being released.
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ */
+typedef void (*otMessageExternalDataCallback)(const uint8_t *aData, void *aContext);
+
+/**
+ * This function appends external (caller-owned) data to a message without copying it into message buffers.
+ *
+ * The data is referenced by pointer and must remain valid and unchanged until @p aCallback is invoked. The external
+ * data always forms the tail of the message: the message must not be lengthened, shortened, or written to after this
+ * function is called (prepending headers remains allowed). At most one external data buffer can be appended to a
+ * message.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE` to be enabled.
+ *
+ * @param[in]  aMessage   A pointer to a message buffer.
+ * @param[in]  aData      A pointer to the data to append.
+ * @param[in]  aLength    Number of bytes to append.
+ * @param[in]  aCallback  A pointer to a function that is called when the data is released (can be NULL).
+ * @param[in]  aContext   A pointer to application-specific context passed to @p aCallback.
+ *
+ * @retval OT_ERROR_NONE           Successfully appended the external data to the message.
+ * @retval OT_ERROR_INVALID_ARGS   @p aData is NULL or @p aLength is zero.
+ * @retval OT_ERROR_INVALID_STATE  The message already has external data appended.
+ *
+ * @sa otMessageAppend
+ *
+ */
+otError otMessageAppendExternalData(otMessage *                   aMessage,
+                                    const uint8_t *               aData,
+                                    uint16_t                      aLength,
+                                    otMessageExternalDataCallback aCallback,
+                                    void *                        aContext);
+
 /**
  * Read bytes from a message.
  *
@@ -368,6 +432,37 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * This function sets the deficit round robin byte quantum used by the transmit scheduler for a priority level.
+ *
+ * Priority levels with a non-zero quantum share the transmit opportunities in proportion to their quanta instead of
+ * being drained in strict priority order. A quantum of zero (the default) keeps strict priority order for the level.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE` to be enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aPriority  The priority level to configure.
+ * @param[in]  aQuantum   The byte quantum the level earns on each scheduler round.
+ *
+ * @retval OT_ERROR_NONE          Successfully set the quantum.
+ * @retval OT_ERROR_INVALID_ARGS  @p aPriority is not a valid priority level.
+ *
+ */
+otError otMessageSetPriorityQuantum(otInstance *aInstance, otMessagePriority aPriority, uint16_t aQuantum);
+
+/**
+ * This function gets the deficit round robin byte quantum used by the transmit scheduler for a priority level.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE` to be enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aPriority  The priority level to query.
+ *
+ * @returns The byte quantum for @p aPriority (zero if the level is not budgeted).
+ *
+ */
+uint16_t otMessageGetPriorityQuantum(otInstance *aInstance, otMessagePriority aPriority);
+
 /**
  * @}
  *
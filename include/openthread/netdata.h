@@ -124,6 +124,33 @@ typedef struct otServiceConfig
     otServerConfig mServerConfig;                          ///< The Server configuration.
 } otServiceConfig;
 
+/**
+ * This enumeration represents the type of a Network Data entry (see `otNetworkDataEntry`).
+ *
+ */
+typedef enum otNetworkDataEntryType
+{
+    OT_NETWORK_DATA_ENTRY_ON_MESH_PREFIX = 0, ///< An On Mesh Prefix entry (`mOnMeshPrefix`).
+    OT_NETWORK_DATA_ENTRY_EXTERNAL_ROUTE = 1, ///< An External Route entry (`mExternalRoute`).
+    OT_NETWORK_DATA_ENTRY_SERVICE        = 2, ///< A Service entry (`mService`).
+} otNetworkDataEntryType;
+
+/**
+ * This structure represents a single decoded Network Data entry (of any type).
+ *
+ */
+typedef struct otNetworkDataEntry
+{
+    otNetworkDataEntryType mType; ///< The entry type (determines which `mData` member to use).
+
+    union
+    {
+        otBorderRouterConfig  mOnMeshPrefix;  ///< On Mesh Prefix info (when `mType` is on-mesh prefix).
+        otExternalRouteConfig mExternalRoute; ///< External Route info (when `mType` is external route).
+        otServiceConfig       mService;       ///< Service info (when `mType` is service).
+    } mData; ///< The decoded entry data.
+} otNetworkDataEntry;
+
 /**
  * This method provides a full or stable copy of the Partition's Thread Network Data.
  *
@@ -136,6 +163,24 @@ typedef struct otServiceConfig
  */
 otError otNetDataGet(otInstance *aInstance, bool aStable, uint8_t *aData, uint8_t *aDataLength);
 
+/**
+ * This function gets the next entry (of any type) in the partition's Network Data.
+ *
+ * This function incrementally decodes the Network Data TLVs directly, yielding one entry per call in the order
+ * the entries appear in the Network Data, without requiring the caller to reserve a buffer for a full copy of
+ * the Network Data (unlike `otNetDataGet()`).
+ *
+ * @param[in]     aInstance  A pointer to an OpenThread instance.
+ * @param[inout]  aIterator  A pointer to the Network Data iterator context. To get the first entry
+                             it should be set to OT_NETWORK_DATA_ITERATOR_INIT.
+ * @param[out]    aEntry     A pointer to where the entry information will be placed.
+ *
+ * @retval OT_ERROR_NONE       Successfully found the next entry.
+ * @retval OT_ERROR_NOT_FOUND  No subsequent entry exists in the partition's Network Data.
+ *
+ */
+otError otNetDataGetNextEntry(otInstance *aInstance, otNetworkDataIterator *aIterator, otNetworkDataEntry *aEntry);
+
 /**
  * This function gets the next On Mesh Prefix in the partition's Network Data.
  *
@@ -82,6 +82,7 @@ enum
     OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES     = 17, ///< Channel Pages TLV
     OT_NETWORK_DIAGNOSTIC_TLV_TYPE_LIST         = 18, ///< Type List TLV
     OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT = 19, ///< Max Child Timeout TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_CHILD             = 29, ///< Child TLV
 };
 
 typedef uint16_t otNetworkDiagIterator; ///< Used to iterate through Network Diagnostic TLV.
@@ -213,6 +214,24 @@ typedef struct otNetworkDiagChildEntry
     otLinkModeConfig mMode;
 } otNetworkDiagChildEntry;
 
+/**
+ * This structure represents a Network Diagnostic Child TLV value.
+ *
+ * A router includes one Child TLV per attached child when answering a diagnostic get on behalf of its children
+ * (requested with `OT_NETWORK_DIAGNOSTIC_TLV_CHILD`), so a collector can learn about all children from a single
+ * query to the parent instead of querying every child individually.
+ *
+ */
+typedef struct otNetworkDiagChild
+{
+    otExtAddress     mExtAddress;  ///< IEEE 802.15.4 Extended Address of the child.
+    uint16_t         mRloc16;      ///< RLOC16 of the child.
+    otLinkModeConfig mMode;        ///< Link mode of the child.
+    uint8_t          mLinkQuality; ///< Incoming link quality (1-3) of the child as seen by the parent.
+    uint32_t         mTimeout;     ///< Child timeout in seconds.
+    uint32_t         mAge;         ///< Time in seconds since the parent last heard from the child.
+} otNetworkDiagChild;
+
 /**
  * This structure represents a Network Diagnostic TLV.
  *
@@ -237,6 +256,7 @@ typedef struct otNetworkDiagTlv
         uint8_t                   mBatteryLevel;
         uint16_t                  mSupplyVoltage;
         uint32_t                  mMaxChildTimeout;
+        otNetworkDiagChild        mChild;
         struct
         {
             uint8_t mCount;
@@ -335,6 +355,34 @@ otError otThreadSendDiagnosticReset(otInstance *        aInstance,
                                     const uint8_t       aTlvTypes[],
                                     uint8_t             aCount);
 
+#define OT_DIAGNOSTIC_COUNTERS_SNAPSHOT_VERSION 1 ///< Counters snapshot format version.
+
+/**
+ * This structure represents a snapshot of all node-level counter groups.
+ *
+ * All counter groups are captured together in a single `otDiagnosticGetCountersSnapshot()` call, so the structure can
+ * be read (or forwarded as one binary blob) without issuing a separate API call per counter group. The `mVersion`
+ * field identifies the structure layout, allowing an external consumer of the binary snapshot to check compatibility.
+ *
+ */
+typedef struct otDiagnosticCountersSnapshot
+{
+    uint16_t      mVersion;     ///< Snapshot format version (`OT_DIAGNOSTIC_COUNTERS_SNAPSHOT_VERSION`).
+    uint32_t      mTimestamp;   ///< Time the snapshot was taken (value of the millisecond alarm clock).
+    otMacCounters mMacCounters; ///< MAC layer counters (as `otLinkGetCounters()`).
+    otIpCounters  mIp6Counters; ///< IPv6 message counters (as `otThreadGetIp6Counters()`).
+    otMleCounters mMleCounters; ///< MLE counters (as `otThreadGetMleCounters()`).
+} otDiagnosticCountersSnapshot;
+
+/**
+ * Get a snapshot of all node-level counter groups in a single call.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aSnapshot  A pointer to a snapshot structure to populate.
+ *
+ */
+void otDiagnosticGetCountersSnapshot(otInstance *aInstance, otDiagnosticCountersSnapshot *aSnapshot);
+
 /**
  * @}
  *
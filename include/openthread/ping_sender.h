@@ -120,6 +120,9 @@ typedef struct otPingSenderConfig
                                   ///< Zero to use default.
     uint8_t mHopLimit;            ///< Hop limit (used if `mAllowZeroHopLimit` is false). Zero for default.
     bool    mAllowZeroHopLimit;   ///< Indicates whether hop limit is zero.
+    uint32_t mIntervalUs;         ///< Ping tx interval in microseconds. When non-zero, overrides `mInterval` and
+                                  ///< replies are accumulated into the RTT histogram instead of invoking the reply
+                                  ///< callback. Requires `OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE`.
 } otPingSenderConfig;
 
 /**
@@ -144,6 +147,21 @@ otError otPingSenderPing(otInstance *aInstance, const otPingSenderConfig *aConfi
  */
 void otPingSenderStop(otInstance *aInstance);
 
+/**
+ * This function gets the ping round-trip time histogram.
+ *
+ * Requires `OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE`. The histogram is cleared when a new ping is started.
+ * Bin `n` counts replies with round-trip time in `[2^n, 2^(n+1))` milliseconds (first bin starts at 0, last bin is
+ * open ended).
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[out] aNumberOfBins  A pointer to return the number of bins in the histogram (MUST NOT be NULL).
+ *
+ * @returns A pointer to the histogram bins (reply counts per round-trip time range).
+ *
+ */
+const uint32_t *otPingSenderGetRttHistogram(otInstance *aInstance, uint8_t *aNumberOfBins);
+
 /**
  * @}
  *
@@ -877,6 +877,46 @@ otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint1
  */
 extern void otPlatRadioEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi);
 
+/**
+ * Begin an autonomous batched energy scan sequence on the radio.
+ *
+ * This function is used when `OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE` is set. The radio samples every
+ * channel in @p aChannelMask once per @p aSampleInterval (zero-duration energy scan), repeating for
+ * @p aSampleCount intervals, and counts per channel the samples whose max RSSI is at or above @p aRssiThreshold.
+ * When the sequence completes, the driver reports the aggregated counts via `otPlatRadioEnergyScanBatchDone()`,
+ * waking the host once per batch instead of once per sample.
+ *
+ * @param[in] aInstance        The OpenThread instance structure.
+ * @param[in] aChannelMask     The channel mask to sample (bit 0 corresponds to channel 0).
+ * @param[in] aSampleInterval  The interval between samples, in milliseconds.
+ * @param[in] aSampleCount     The number of sample intervals to aggregate into one report.
+ * @param[in] aRssiThreshold   The RSSI threshold in dBm used for the per-channel occupancy counts.
+ *
+ * @retval OT_ERROR_NONE             Successfully started the batched scan sequence.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The radio doesn't support batched energy scanning.
+ *
+ */
+otError otPlatRadioEnergyScanBatch(otInstance *aInstance,
+                                   uint32_t    aChannelMask,
+                                   uint32_t    aSampleInterval,
+                                   uint16_t    aSampleCount,
+                                   int8_t      aRssiThreshold);
+
+/**
+ * The radio driver calls this method to notify OpenThread that a batched energy scan is complete.
+ *
+ * This function is used when `OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE` is set.
+ *
+ * @param[in] aInstance              The OpenThread instance structure.
+ * @param[in] aChannelMask           The channel mask the batch was run on.
+ * @param[in] aAboveThresholdCounts  Per-channel counts of samples at or above the RSSI threshold, with one entry
+ *                                   per set bit in @p aChannelMask, ordered from the lowest channel.
+ *
+ */
+extern void otPlatRadioEnergyScanBatchDone(otInstance *    aInstance,
+                                           uint32_t        aChannelMask,
+                                           const uint16_t *aAboveThresholdCounts);
+
 /**
  * Enable/Disable source address match feature.
  *
@@ -73,6 +73,9 @@ enum
     OT_SETTINGS_KEY_SRP_ECDSA_KEY        = 0x000b, ///< SRP client ECDSA public/private key pair.
     OT_SETTINGS_KEY_SRP_CLIENT_INFO      = 0x000c, ///< The SRP client info (selected SRP server address).
     OT_SETTINGS_KEY_SRP_SERVER_INFO      = 0x000d, ///< The SRP server info (UDP port).
+    OT_SETTINGS_KEY_SRP_SERVER_HOST      = 0x000e, ///< An SRP server registered host record (list).
+    OT_SETTINGS_KEY_DTLS_SESSION         = 0x000f, ///< Serialized DTLS session for session resumption.
+    OT_SETTINGS_KEY_DRBG_SEED            = 0x0010, ///< Sealed CTR-DRBG seed material for the next boot.
 };
 
 /**
@@ -134,6 +134,34 @@ void otSrpClientBuffersFreeService(otInstance *aInstance, otSrpClientBuffersServ
  */
 void otSrpClientBuffersFreeAllServices(otInstance *aInstance);
 
+/**
+ * This function gets the runtime cap on the number of heap-allocated service entries.
+ *
+ * This function is valid when `OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE` configuration is enabled. When
+ * the static service pool is exhausted, additional service entries are allocated from the heap (up to the cap) and
+ * cached for reuse when freed.
+ *
+ * @param[in] aInstance   A pointer to the OpenThread instance.
+ *
+ * @returns The maximum number of heap-allocated service entries (in use or cached for reuse).
+ *
+ */
+uint16_t otSrpClientBuffersGetMaxDynamicServices(otInstance *aInstance);
+
+/**
+ * This function sets the runtime cap on the number of heap-allocated service entries.
+ *
+ * This function is valid when `OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE` configuration is enabled.
+ *
+ * If the new cap is smaller than the number of currently heap-allocated entries, cached (free) entries are released
+ * back to the heap immediately and in-use entries are released as they are freed.
+ *
+ * @param[in] aInstance      A pointer to the OpenThread instance.
+ * @param[in] aMaxServices   The maximum number of heap-allocated service entries.
+ *
+ */
+void otSrpClientBuffersSetMaxDynamicServices(otInstance *aInstance, uint16_t aMaxServices);
+
 /**
  * This function gets the string buffer for service name from a service entry.
  *
@@ -211,6 +211,7 @@ struct otTcpEndpoint
 
     otTcpEstablished      mEstablishedCallback;      ///< "Established" callback function
     otTcpSendDone         mSendDoneCallback;         ///< "Send done" callback function
+    otTcpBytesAcked       mBytesAckedCallback;       ///< "Bytes acked" callback function
     otTcpSendReady        mSendReadyCallback;        ///< "Send ready" callback function
     otTcpReceiveAvailable mReceiveAvailableCallback; ///< "Receive available" callback function
     otTcpDisconnected     mDisconnectedCallback;     ///< "Disconnected" callback function
@@ -218,6 +219,37 @@ struct otTcpEndpoint
     uint32_t mTimers[4];
 
     /* Other implementation-defined fields go here. */
+
+    otSockAddr mSockName; ///< Local IP address and port (internal use only)
+    otSockAddr mPeerName; ///< Peer IP address and port (internal use only)
+
+    otLinkedBuffer *mSendQueueHead;  ///< Head of the send queue (internal use only)
+    otLinkedBuffer *mSendQueueTail;  ///< Tail of the send queue (internal use only)
+    size_t          mSendQueueBytes; ///< Number of unacknowledged bytes in the send queue (internal use only)
+    size_t          mSendHeadOffset; ///< Acknowledged bytes within the head linked buffer (internal use only)
+
+    void *         mReceiveBuffer;     ///< Circular receive buffer provided by the application (internal use only)
+    size_t         mReceiveBufferSize; ///< Size of the receive buffer (internal use only)
+    size_t         mReceiveStart;      ///< Offset of the oldest byte in the receive buffer (internal use only)
+    size_t         mReceiveAvailable;  ///< Number of bytes in the receive buffer (internal use only)
+    otLinkedBuffer mReceiveLinks[2];   ///< Linked buffers exposing the receive buffer (internal use only)
+
+    uint32_t mSndUna;        ///< Oldest unacknowledged sequence number (internal use only)
+    uint32_t mSndNxt;        ///< Next sequence number to send (internal use only)
+    uint32_t mRcvNxt;        ///< Next sequence number expected to receive (internal use only)
+    uint32_t mRttSrtt;       ///< Smoothed round-trip time, in milliseconds (internal use only)
+    uint32_t mRttVar;        ///< Round-trip time variance, in milliseconds (internal use only)
+    uint32_t mRto;           ///< Retransmission timeout, in milliseconds (internal use only)
+    uint32_t mRttTime;       ///< Transmit timestamp of the timed segment (internal use only)
+    uint32_t mRttSeq;        ///< Sequence number of the timed segment (internal use only)
+    uint16_t mSndWnd;        ///< Peer-advertised send window (internal use only)
+    uint16_t mCwnd;          ///< Congestion window, in bytes (internal use only)
+    uint16_t mSsthresh;      ///< Slow-start threshold, in bytes (internal use only)
+    uint8_t  mState;         ///< TCP connection state (internal use only)
+    uint8_t  mInternalFlags; ///< Internal state flags (internal use only)
+    uint8_t  mTimerFlags;    ///< Bitmask of running connection timers (internal use only)
+    uint8_t  mDupAcks;       ///< Number of consecutive duplicate acknowledgments (internal use only)
+    uint8_t  mRetries;       ///< Number of retransmissions of the oldest outstanding segment (internal use only)
 };
 
 /**
@@ -618,6 +650,8 @@ struct otTcpListener
     otTcpAcceptDone  mAcceptDoneCallback;  ///< "Accept done" callback function
 
     /* Other implementation-defined fields go here. */
+
+    otSockAddr mSockName; ///< Local IP address and port being listened on, port zero if not listening (internal use only)
 };
 
 /**
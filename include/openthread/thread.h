@@ -729,6 +729,29 @@ otError otThreadBecomeChild(otInstance *aInstance);
  */
 otError otThreadGetNextNeighborInfo(otInstance *aInstance, otNeighborInfoIterator *aIterator, otNeighborInfo *aInfo);
 
+/**
+ * This function gets a batch of neighbor information entries. It is used to dump the neighbor table
+ * with fewer API calls than `otThreadGetNextNeighborInfo()`.
+ *
+ * All entries returned by a single call reflect one consistent view of the neighbor table.
+ *
+ * @param[in]     aInstance    A pointer to an OpenThread instance.
+ * @param[inout]  aIterator    A pointer to the iterator context. To get the first batch of entries
+ *                             it should be set to OT_NEIGHBOR_INFO_ITERATOR_INIT.
+ * @param[out]    aInfoBuffer  A pointer to an array where the neighbor information entries are placed.
+ * @param[inout]  aCount       On input, the maximum number of entries that can be written to @p aInfoBuffer.
+ *                             On output, the number of entries written.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved one or more neighbor entries.
+ * @retval OT_ERROR_NOT_FOUND     No subsequent neighbor entry exists in the table (@p aCount is set to zero).
+ * @retval OT_ERROR_INVALID_ARGS  @p aIterator, @p aInfoBuffer, or @p aCount was NULL, or @p aCount was zero.
+ *
+ */
+otError otThreadGetNeighborInfoBatch(otInstance *            aInstance,
+                                     otNeighborInfoIterator *aIterator,
+                                     otNeighborInfo *        aInfoBuffer,
+                                     uint8_t *               aCount);
+
 /**
  * Get the device role.
  *
@@ -872,6 +895,38 @@ const otMleCounters *otThreadGetMleCounters(otInstance *aInstance);
  */
 void otThreadResetMleCounters(otInstance *aInstance);
 
+/**
+ * This structure represents metadata for one message in a mesh forwarder queue.
+ *
+ */
+typedef struct otForwarderQueueEntry
+{
+    uint16_t mLength;       ///< Message length (number of bytes).
+    uint16_t mDestRloc16;   ///< Destination RLOC16 (0xfffe when not known).
+    uint32_t mTimeInQueue;  ///< Time since the message was queued (in milliseconds).
+    uint8_t  mPriority;     ///< Message priority (`otMessagePriority` values, 3 for network-control priority).
+    bool     mInSendQueue;  ///< TRUE if the message is in the send queue, FALSE if in the reassembly list.
+    bool     mLinkSecurity; ///< TRUE if link security is enabled for the message.
+    bool     mDirectTx;     ///< TRUE if the message is pending direct transmission (send queue only).
+} otForwarderQueueEntry;
+
+/**
+ * Get a packed snapshot of the messages in the mesh forwarder send queue and 6LoWPAN reassembly list.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE` is enabled.
+ *
+ * Send queue entries are written first (in queue order), followed by reassembly list entries. At most
+ * @p aMaxEntries entries are written.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[out] aEntries     A pointer to an array of entries to populate (MUST NOT be NULL).
+ * @param[in]  aMaxEntries  The number of entries in @p aEntries array.
+ *
+ * @returns The number of entries written to @p aEntries.
+ *
+ */
+uint16_t otThreadGetForwarderQueueSnapshot(otInstance *aInstance, otForwarderQueueEntry *aEntries, uint16_t aMaxEntries);
+
 /**
  * This function pointer is called every time an MLE Parent Response message is received.
  *
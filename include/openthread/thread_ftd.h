@@ -80,6 +80,10 @@ typedef struct
 
 typedef uint16_t otChildIp6AddressIterator; ///< Used to iterate through IPv6 addresses of a Thread Child entry.
 
+#define OT_CHILD_INFO_ITERATOR_INIT 0 ///< Initializer for otChildInfoIterator
+
+typedef uint16_t otChildInfoIterator; ///< Used to iterate through the child table.
+
 /**
  * This enumeration defines the EID cache entry state.
  *
@@ -109,6 +113,19 @@ typedef struct otCacheEntryInfo
     uint16_t          mRetryDelay;         ///< Retry delay in seconds (applicable if in query-retry state).
 } otCacheEntryInfo;
 
+/**
+ * This structure represents the EID cache lookup counters.
+ *
+ */
+typedef struct otCacheEntryCounters
+{
+    uint32_t mCachedHits;     ///< Number of lookups that matched an entry in the cached (in-use) list.
+    uint32_t mSnoopedHits;    ///< Number of lookups that matched an entry in the snooped list.
+    uint32_t mQueryHits;      ///< Number of lookups that matched an entry in the query list.
+    uint32_t mQueryRetryHits; ///< Number of lookups that matched an entry in the query-retry list.
+    uint32_t mMisses;         ///< Number of lookups that found no matching entry.
+} otCacheEntryCounters;
+
 /**
  * This type represents an iterator used for iterating through the EID cache table entries.
  *
@@ -121,6 +138,16 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * This structure represents the route update counters.
+ *
+ */
+typedef struct otRouteUpdateCounters
+{
+    uint32_t mFullUpdates;    ///< Number of received advertisements that triggered a full route re-evaluation.
+    uint32_t mSkippedUpdates; ///< Number of received advertisements for which route re-evaluation was skipped.
+} otRouteUpdateCounters;
+
 /**
  * Get the maximum number of children currently allowed.
  *
@@ -176,6 +203,34 @@ bool otThreadIsRouterEligible(otInstance *aInstance);
  */
 otError otThreadSetRouterEligible(otInstance *aInstance, bool aEligible);
 
+/**
+ * This function indicates whether the device is designated as a leader hot standby.
+ *
+ * This function is valid when `OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE` configuration is enabled.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @retval TRUE   If device is designated as a leader hot standby.
+ * @retval FALSE  If device is not designated as a leader hot standby.
+ *
+ */
+bool otThreadIsLeaderHotStandbyEnabled(otInstance *aInstance);
+
+/**
+ * This function sets whether the device is designated as a leader hot standby.
+ *
+ * This function is valid when `OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE` configuration is enabled.
+ *
+ * A hot-standby router, when it starts a new partition after losing the leader, seeds its leader state from the
+ * leader Network Data and router ID assignments it already mirrors as a router, instead of starting from an empty
+ * partition. This allows existing registrations to survive a leader failover without a full re-registration cycle.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aEnabled   TRUE to designate the device as a leader hot standby, FALSE otherwise.
+ *
+ */
+void otThreadSetLeaderHotStandbyEnabled(otInstance *aInstance, bool aEnabled);
+
 /**
  * Set the preferred Router Id.
  *
@@ -481,6 +536,49 @@ otError otThreadGetChildInfoById(otInstance *aInstance, uint16_t aChildId, otChi
  */
 otError otThreadGetChildInfoByIndex(otInstance *aInstance, uint16_t aChildIndex, otChildInfo *aChildInfo);
 
+/**
+ * The function retrieves diagnostic information for the next attached child (using an iterator).
+ *
+ * Unlike `otThreadGetChildInfoByIndex()`, the iterator resumes the child table walk from where the previous
+ * call left off, making a full-table dump linear in the table size.
+ *
+ * @param[in]     aInstance   A pointer to an OpenThread instance.
+ * @param[inout]  aIterator   A pointer to the iterator context. To get the first child entry it should be set
+ *                            to OT_CHILD_INFO_ITERATOR_INIT.
+ * @param[out]    aChildInfo  A pointer to where the child information is placed.
+ *
+ * @retval OT_ERROR_NONE          Successfully found the next attached child entry in the table.
+ * @retval OT_ERROR_NOT_FOUND     No subsequent attached child entry exists in the table.
+ * @retval OT_ERROR_INVALID_ARGS  @p aIterator or @p aChildInfo was NULL.
+ *
+ * @sa otThreadGetChildInfoBatch
+ *
+ */
+otError otThreadGetNextChildInfo(otInstance *aInstance, otChildInfoIterator *aIterator, otChildInfo *aChildInfo);
+
+/**
+ * The function retrieves a batch of diagnostic information entries for attached children. It is used to dump
+ * the child table with fewer API calls than `otThreadGetNextChildInfo()`.
+ *
+ * All entries returned by a single call reflect one consistent view of the child table.
+ *
+ * @param[in]     aInstance    A pointer to an OpenThread instance.
+ * @param[inout]  aIterator    A pointer to the iterator context. To get the first batch of entries it should
+ *                             be set to OT_CHILD_INFO_ITERATOR_INIT.
+ * @param[out]    aInfoBuffer  A pointer to an array where the child information entries are placed.
+ * @param[inout]  aCount       On input, the maximum number of entries that can be written to @p aInfoBuffer.
+ *                             On output, the number of entries written.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved one or more child entries.
+ * @retval OT_ERROR_NOT_FOUND     No subsequent attached child entry exists in the table (@p aCount is set to zero).
+ * @retval OT_ERROR_INVALID_ARGS  @p aIterator, @p aInfoBuffer, or @p aCount was NULL, or @p aCount was zero.
+ *
+ */
+otError otThreadGetChildInfoBatch(otInstance *         aInstance,
+                                  otChildInfoIterator *aIterator,
+                                  otChildInfo *        aInfoBuffer,
+                                  uint8_t *            aCount);
+
 /**
  * This function gets the next IPv6 address (using an iterator) for a given child.
  *
@@ -537,6 +635,19 @@ uint8_t otThreadGetMaxRouterId(otInstance *aInstance);
  */
 otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRouterInfo *aRouterInfo);
 
+/**
+ * This function gets the route update counters.
+ *
+ * The counters track how many received MLE Advertisements triggered a full re-evaluation of the routes in the router
+ * table, and how many were skipped because the advertised Route TLV and the route state were unchanged since the
+ * previous advertisement from the same router.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aCounters  A pointer to where the counters are placed.
+ *
+ */
+void otThreadGetRouteUpdateCounters(otInstance *aInstance, otRouteUpdateCounters *aCounters);
+
 /**
  * This function gets the next EID cache entry (using an iterator).
  *
@@ -552,6 +663,37 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  */
 otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntryInfo, otCacheEntryIterator *aIterator);
 
+/**
+ * This function preloads the EID cache with a given EID-to-RLOC16 mapping.
+ *
+ * The entry is installed in snooped state and is always evictable, so preloaded mappings never displace entries
+ * learned from live traffic. A host with a known (static) set of destinations can call this function repeatedly at
+ * startup to avoid the initial Address Query round trip (and the associated TMF traffic spike) per destination.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aEid       A pointer to the EID.
+ * @param[in]  aRloc16    The RLOC16 corresponding to @p aEid.
+ *
+ * @retval OT_ERROR_NONE           Successfully added (or updated) the cache entry.
+ * @retval OT_ERROR_INVALID_STATE  The device is not a Full Thread Device (FTD).
+ * @retval OT_ERROR_NO_BUFS        No cache entry is available.
+ *
+ */
+otError otThreadPreloadCacheEntry(otInstance *aInstance, const otIp6Address *aEid, uint16_t aRloc16);
+
+/**
+ * This function gets the EID cache lookup counters.
+ *
+ * The counters track, per cache list, the number of EID lookups that matched an entry in that list, along with the
+ * number of lookups that found no match. They can be polled to size the address cache table
+ * (see `OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES`).
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aCounters  A pointer to where the counters are placed.
+ *
+ */
+void otThreadGetCacheEntryCounters(otInstance *aInstance, otCacheEntryCounters *aCounters);
+
 /**
  * Get the Thread PSKc
  *
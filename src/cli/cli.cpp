@@ -140,6 +140,9 @@ Interpreter::Interpreter(Instance *aInstance, otCliOutputCallback aCallback, voi
     , mOutputLength(0)
     , mIsLogging(false)
 #endif
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    , mOutputBufferLength(0)
+#endif
 {
 #if OPENTHREAD_FTD
     otThreadSetDiscoveryRequestCallback(mInstance, &Interpreter::HandleDiscoveryRequest, this);
@@ -755,6 +758,9 @@ otError Interpreter::ProcessBufferInfo(Arg aArgs[])
 
     OutputLine("total: %d", bufferInfo.mTotalBuffers);
     OutputLine("free: %d", bufferInfo.mFreeBuffers);
+    OutputLine("max used: %d (low:%d normal:%d high:%d net:%d)", bufferInfo.mMaxUsedBuffers,
+               bufferInfo.mMaxUsedBuffersByPriority[0], bufferInfo.mMaxUsedBuffersByPriority[1],
+               bufferInfo.mMaxUsedBuffersByPriority[2], bufferInfo.mMaxUsedBuffersByPriority[3]);
 
     for (const BufferInfoName &info : kBufferInfoNames)
     {
@@ -1216,6 +1222,7 @@ otError Interpreter::ProcessCounters(Arg aArgs[])
                 {&otMacCounters::mTxRetry, "TxRetry"},
                 {&otMacCounters::mTxErrCca, "TxErrCca"},
                 {&otMacCounters::mTxErrBusyChannel, "TxErrBusyChannel"},
+                {&otMacCounters::mTxSecurityTime, "TxSecurityTime"},
             };
 
             static const MacCounterName kRxCounterNames[] = {
@@ -1235,6 +1242,7 @@ otError Interpreter::ProcessCounters(Arg aArgs[])
                 {&otMacCounters::mRxErrSec, "RxErrSec"},
                 {&otMacCounters::mRxErrFcs, "RxErrFcs"},
                 {&otMacCounters::mRxErrOther, "RxErrOther"},
+                {&otMacCounters::mRxSecurityTime, "RxSecurityTime"},
             };
 
             const otMacCounters *macCounters = otLinkGetCounters(mInstance);
@@ -1759,21 +1767,37 @@ void Interpreter::OutputEidCacheEntry(const otCacheEntryInfo &aEntry)
 
 otError Interpreter::ProcessEidCache(Arg aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgs);
+    otError error = OT_ERROR_NONE;
 
-    otCacheEntryIterator iterator;
-    otCacheEntryInfo     entry;
+    if (aArgs[0].IsEmpty())
+    {
+        otCacheEntryIterator iterator;
+        otCacheEntryInfo     entry;
 
-    memset(&iterator, 0, sizeof(iterator));
+        memset(&iterator, 0, sizeof(iterator));
 
-    for (uint8_t i = 0;; i++)
+        while (otThreadGetNextCacheEntry(mInstance, &entry, &iterator) == OT_ERROR_NONE)
+        {
+            OutputEidCacheEntry(entry);
+        }
+    }
+    else if (aArgs[0] == "preload")
     {
-        SuccessOrExit(otThreadGetNextCacheEntry(mInstance, &entry, &iterator));
-        OutputEidCacheEntry(entry);
+        otIp6Address eid;
+        uint16_t     rloc16;
+
+        SuccessOrExit(error = aArgs[1].ParseAsIp6Address(eid));
+        SuccessOrExit(error = aArgs[2].ParseAsUint16(rloc16));
+
+        error = otThreadPreloadCacheEntry(mInstance, &eid, rloc16);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
     }
 
 exit:
-    return OT_ERROR_NONE;
+    return error;
 }
 #endif
 
@@ -4690,13 +4714,38 @@ otError Interpreter::ProcessDiag(Arg aArgs[])
 #endif
 
 void Interpreter::ProcessLine(char *aBuf)
+{
+    OT_ASSERT(aBuf != nullptr);
+
+#if OPENTHREAD_CONFIG_CLI_MULTI_COMMAND_ENABLE
+    char *next;
+
+    for (char *cmd = aBuf; cmd != nullptr; cmd = next)
+    {
+        next = strchr(cmd, ';');
+
+        if (next != nullptr)
+        {
+            *next++ = '\0';
+        }
+
+        ProcessCommand(cmd);
+    }
+#else
+    ProcessCommand(aBuf);
+#endif
+
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    FlushOutputBuffer();
+#endif
+}
+
+void Interpreter::ProcessCommand(char *aBuf)
 {
     Arg            args[kMaxArgs + 1];
     const Command *command;
     otError        error = OT_ERROR_NONE;
 
-    OT_ASSERT(aBuf != nullptr);
-
     // Ignore the command if another command is pending.
     VerifyOrExit(!mCommandIsPending, args[0].Clear());
     mCommandIsPending = true;
@@ -5085,7 +5134,11 @@ int Interpreter::OutputFormatV(const char *aFormat, va_list aArguments)
     va_copy(args, aArguments);
 #endif
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    rval = OutputBuffered(aFormat, aArguments);
+#else
     rval = mOutputCallback(mOutputContext, aFormat, aArguments);
+#endif
 
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
     VerifyOrExit(!IsLogging());
@@ -5170,6 +5223,78 @@ exit:
     return rval;
 }
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+
+int Interpreter::OutputBuffered(const char *aFormat, va_list aArguments)
+{
+    int     rval;
+    va_list args;
+
+    va_copy(args, aArguments);
+    rval = vsnprintf(&mOutputBuffer[mOutputBufferLength], sizeof(mOutputBuffer) - mOutputBufferLength, aFormat, args);
+    va_end(args);
+
+    VerifyOrExit(rval >= 0);
+
+    if (static_cast<uint32_t>(rval) >= sizeof(mOutputBuffer) - mOutputBufferLength)
+    {
+        // The fragment does not fit in the remaining buffer space.
+        // Flush the buffered output and retry with the full buffer. A
+        // fragment larger than the entire buffer is passed through to
+        // the output callback directly.
+
+        FlushOutputBuffer();
+
+        if (static_cast<uint32_t>(rval) >= sizeof(mOutputBuffer))
+        {
+            rval = mOutputCallback(mOutputContext, aFormat, aArguments);
+            ExitNow();
+        }
+
+        va_copy(args, aArguments);
+        rval = vsnprintf(mOutputBuffer, sizeof(mOutputBuffer), aFormat, args);
+        va_end(args);
+
+        VerifyOrExit(rval >= 0);
+    }
+
+    mOutputBufferLength += static_cast<uint16_t>(rval);
+
+    if ((mOutputBufferLength > 0) && (mOutputBuffer[mOutputBufferLength - 1] == '\n'))
+    {
+        FlushOutputBuffer();
+    }
+
+exit:
+    return rval;
+}
+
+int Interpreter::CallOutputCallback(const char *aFormat, ...)
+{
+    int     rval;
+    va_list args;
+
+    va_start(args, aFormat);
+    rval = mOutputCallback(mOutputContext, aFormat, args);
+    va_end(args);
+
+    return rval;
+}
+
+void Interpreter::FlushOutputBuffer(void)
+{
+    VerifyOrExit(mOutputBufferLength > 0);
+
+    mOutputBuffer[mOutputBufferLength] = '\0';
+    CallOutputCallback("%s", mOutputBuffer);
+    mOutputBufferLength = 0;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+
 void Interpreter::Initialize(otInstance *aInstance, otCliOutputCallback aCallback, void *aContext)
 {
     Instance *instance = static_cast<Instance *>(aInstance);
@@ -5182,6 +5307,12 @@ void Interpreter::OutputPrompt(void)
     static const char sPrompt[] = "> ";
 
     OutputFormat("%s", sPrompt);
+
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    // The prompt does not end with a newline, so flush explicitly to
+    // make sure it is delivered.
+    FlushOutputBuffer();
+#endif
 }
 
 void Interpreter::HandleTimer(Timer &aTimer)
@@ -435,6 +435,12 @@ private:
     }
 
     void OutputPrompt(void);
+    void ProcessCommand(char *aBuf);
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    int  OutputBuffered(const char *aFormat, va_list aArguments);
+    int  CallOutputCallback(const char *aFormat, ...);
+    void FlushOutputBuffer(void);
+#endif
 #if OPENTHREAD_CONFIG_PING_SENDER_ENABLE
     otError ParsePingInterval(const Arg &aArg, uint32_t &aInterval);
 #endif
@@ -1024,6 +1030,10 @@ private:
     uint16_t mOutputLength;
     bool     mIsLogging;
 #endif
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    char     mOutputBuffer[OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE + 1];
+    uint16_t mOutputBufferLength;
+#endif
 #if OPENTHREAD_CONFIG_PING_SENDER_ENABLE
     bool mPingIsAsync;
 #endif
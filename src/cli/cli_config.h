@@ -58,6 +58,30 @@
 #define OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH 384
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE
+ *
+ * The size (in bytes) of the CLI output buffer. When non-zero, formatted output fragments are accumulated in the
+ * buffer and handed to the output callback once per completed line (or when the buffer fills up), instead of once
+ * per `OutputFormat()` call. Set to zero for unbuffered (write-through) output.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CLI_MULTI_COMMAND_ENABLE
+ *
+ * Define to 1 to allow multiple semicolon-separated commands on a single CLI input line. The commands are executed
+ * in order, each producing its own result output. If a command starts a long-running (pending) operation, the
+ * remaining commands on the line are ignored.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_MULTI_COMMAND_ENABLE
+#define OPENTHREAD_CONFIG_CLI_MULTI_COMMAND_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_CLI_TCP_ENABLE
  *
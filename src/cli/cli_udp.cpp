@@ -47,8 +47,19 @@ constexpr UdpExample::Command UdpExample::sCommands[];
 UdpExample::UdpExample(Interpreter &aInterpreter)
     : mInterpreter(aInterpreter)
     , mLinkSecurityEnabled(true)
+    , mBenchTimer(*aInterpreter.mInstance, HandleBenchTimer, this)
+    , mBenchInterval(0)
+    , mBenchTxCount(0)
+    , mBenchRxCount(0)
+    , mBenchRttSum(0)
+    , mBenchPayloadLength(0)
+    , mBenchMaxBuffersInUse(0)
+    , mBenchRunning(false)
+    , mBenchDraining(false)
 {
     memset(&mSocket, 0, sizeof(mSocket));
+    memset(&mBenchPeer, 0, sizeof(mBenchPeer));
+    memset(mBenchHistogram, 0, sizeof(mBenchHistogram));
 }
 
 otError UdpExample::ProcessHelp(Arg aArgs[])
@@ -193,6 +204,251 @@ exit:
     return error;
 }
 
+otError UdpExample::ProcessBench(Arg aArgs[])
+{
+    otError  error    = OT_ERROR_NONE;
+    uint16_t pps      = kBenchDefaultPps;
+    uint16_t size     = kBenchDefaultSize;
+    uint16_t duration = kBenchDefaultDuration;
+
+    if (aArgs[0] == "stop")
+    {
+        VerifyOrExit(mBenchRunning, error = OT_ERROR_INVALID_STATE);
+        FinishBench();
+        ExitNow();
+    }
+
+    VerifyOrExit(!mBenchRunning, error = OT_ERROR_BUSY);
+    VerifyOrExit(otUdpIsOpen(mInterpreter.mInstance, &mSocket), error = OT_ERROR_INVALID_STATE);
+
+    SuccessOrExit(error = aArgs[0].ParseAsIp6Address(mBenchPeer.mAddress));
+    SuccessOrExit(error = aArgs[1].ParseAsUint16(mBenchPeer.mPort));
+
+    if (!aArgs[2].IsEmpty())
+    {
+        SuccessOrExit(error = aArgs[2].ParseAsUint16(pps));
+        VerifyOrExit((pps >= 1) && (pps <= kBenchMaxPps), error = OT_ERROR_INVALID_ARGS);
+    }
+
+    if (!aArgs[3].IsEmpty())
+    {
+        SuccessOrExit(error = aArgs[3].ParseAsUint16(size));
+    }
+
+    if (!aArgs[4].IsEmpty())
+    {
+        SuccessOrExit(error = aArgs[4].ParseAsUint16(duration));
+        VerifyOrExit(duration > 0, error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(aArgs[5].IsEmpty(), error = OT_ERROR_INVALID_ARGS);
+    }
+
+    if (size < kBenchHeaderSize)
+    {
+        size = kBenchHeaderSize;
+    }
+
+    mBenchPayloadLength   = size;
+    mBenchInterval        = 1000 / pps;
+    mBenchTxCount         = 0;
+    mBenchRxCount         = 0;
+    mBenchRttSum          = 0;
+    mBenchMaxBuffersInUse = 0;
+    mBenchRunning         = true;
+    mBenchDraining        = false;
+    memset(mBenchHistogram, 0, sizeof(mBenchHistogram));
+
+    mBenchStartTime   = TimerMilli::GetNow();
+    mBenchSendEndTime = mBenchStartTime + Time::SecToMsec(duration);
+    mBenchTimer.Start(0);
+
+exit:
+    return error;
+}
+
+otError UdpExample::SendBenchPacket(void)
+{
+    otError           error;
+    otMessage *       message         = nullptr;
+    otMessageInfo     messageInfo;
+    otMessageSettings messageSettings = {mLinkSecurityEnabled, OT_MESSAGE_PRIORITY_NORMAL};
+    uint8_t           header[kBenchHeaderSize];
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = mBenchPeer.mAddress;
+    messageInfo.mPeerPort = mBenchPeer.mPort;
+
+    message = otUdpNewMessage(mInterpreter.mInstance, &messageSettings);
+    VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
+
+    Encoding::BigEndian::WriteUint32(kBenchRequestMagic, &header[0]);
+    Encoding::BigEndian::WriteUint32(mBenchTxCount, &header[4]);
+    Encoding::BigEndian::WriteUint32(TimerMilli::GetNow().GetValue(), &header[8]);
+
+    SuccessOrExit(error = otMessageAppend(message, header, sizeof(header)));
+    SuccessOrExit(error = PrepareAutoGeneratedPayload(*message, mBenchPayloadLength - kBenchHeaderSize));
+
+    SuccessOrExit(error = otUdpSend(mInterpreter.mInstance, &mSocket, message, &messageInfo));
+
+    message = nullptr;
+    mBenchTxCount++;
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+bool UdpExample::HandleBenchReceive(const otMessage &aMessage, const otMessageInfo &aMessageInfo)
+{
+    bool     isBenchPacket = false;
+    uint16_t offset        = otMessageGetOffset(&aMessage);
+    uint16_t length        = otMessageGetLength(&aMessage) - offset;
+    uint8_t  header[kBenchHeaderSize];
+    uint32_t magic;
+
+    VerifyOrExit(length >= kBenchHeaderSize);
+    VerifyOrExit(otMessageRead(&aMessage, offset, header, sizeof(header)) == sizeof(header));
+
+    magic = Encoding::BigEndian::ReadUint32(&header[0]);
+
+    if (magic == kBenchRequestMagic)
+    {
+        // Echo the bench header back (with the reply magic) so the
+        // sender can measure round-trip latency.
+
+        otError           error;
+        otMessage *       message         = nullptr;
+        otMessageInfo     messageInfo;
+        otMessageSettings messageSettings = {mLinkSecurityEnabled, OT_MESSAGE_PRIORITY_NORMAL};
+
+        isBenchPacket = true;
+
+        memset(&messageInfo, 0, sizeof(messageInfo));
+        messageInfo.mPeerAddr = aMessageInfo.mPeerAddr;
+        messageInfo.mPeerPort = aMessageInfo.mPeerPort;
+
+        message = otUdpNewMessage(mInterpreter.mInstance, &messageSettings);
+        VerifyOrExit(message != nullptr);
+
+        Encoding::BigEndian::WriteUint32(kBenchReplyMagic, &header[0]);
+        error = otMessageAppend(message, header, sizeof(header));
+
+        if (error == OT_ERROR_NONE)
+        {
+            error = otUdpSend(mInterpreter.mInstance, &mSocket, message, &messageInfo);
+        }
+
+        if (error != OT_ERROR_NONE)
+        {
+            otMessageFree(message);
+        }
+    }
+    else if (magic == kBenchReplyMagic)
+    {
+        isBenchPacket = true;
+
+        if (mBenchRunning)
+        {
+            uint32_t rtt = TimerMilli::GetNow().GetValue() - Encoding::BigEndian::ReadUint32(&header[8]);
+
+            mBenchRxCount++;
+            mBenchRttSum += rtt;
+            mBenchHistogram[OT_MIN(rtt / kBenchBucketWidth, static_cast<uint32_t>(kBenchNumBuckets - 1))]++;
+        }
+    }
+
+exit:
+    return isBenchPacket;
+}
+
+void UdpExample::SampleBenchBufferUse(void)
+{
+    otBufferInfo bufferInfo;
+
+    otMessageGetBufferInfo(mInterpreter.mInstance, &bufferInfo);
+
+    if (bufferInfo.mTotalBuffers - bufferInfo.mFreeBuffers > mBenchMaxBuffersInUse)
+    {
+        mBenchMaxBuffersInUse = bufferInfo.mTotalBuffers - bufferInfo.mFreeBuffers;
+    }
+}
+
+uint32_t UdpExample::GetBenchPercentileRtt(uint8_t aPercent) const
+{
+    uint32_t threshold = (mBenchRxCount * aPercent + 99) / 100;
+    uint32_t count     = 0;
+    uint8_t  bucket;
+
+    for (bucket = 0; bucket < kBenchNumBuckets - 1; bucket++)
+    {
+        count += mBenchHistogram[bucket];
+
+        if (count >= threshold)
+        {
+            break;
+        }
+    }
+
+    // Report the upper edge of the bucket containing the percentile
+    // (the last bucket also catches all larger RTT values).
+
+    return static_cast<uint32_t>(bucket + 1) * kBenchBucketWidth;
+}
+
+void UdpExample::FinishBench(void)
+{
+    uint32_t elapsed = (mBenchDraining ? mBenchSendEndTime : TimerMilli::GetNow()) - mBenchStartTime;
+    uint32_t lossPermille = 0;
+
+    mBenchTimer.Stop();
+    mBenchRunning  = false;
+    mBenchDraining = false;
+
+    if ((mBenchTxCount != 0) && (mBenchRxCount < mBenchTxCount))
+    {
+        lossPermille = (mBenchTxCount - mBenchRxCount) * 1000 / mBenchTxCount;
+    }
+
+    mInterpreter.OutputLine("bench: sent %u, received %u, loss %u.%u%%", mBenchTxCount, mBenchRxCount,
+                            lossPermille / 10, lossPermille % 10);
+    mInterpreter.OutputLine("achieved pps: %u", (elapsed != 0) ? (mBenchTxCount * 1000 / elapsed) : 0);
+
+    if (mBenchRxCount != 0)
+    {
+        mInterpreter.OutputLine("rtt: avg %u ms, p50 <%u ms, p95 <%u ms, p99 <%u ms", mBenchRttSum / mBenchRxCount,
+                                GetBenchPercentileRtt(50), GetBenchPercentileRtt(95), GetBenchPercentileRtt(99));
+    }
+
+    mInterpreter.OutputLine("buffers high-water: %u", mBenchMaxBuffersInUse);
+}
+
+void UdpExample::HandleBenchTimer(Timer &aTimer)
+{
+    static_cast<UdpExample *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandleBenchTimer();
+}
+
+void UdpExample::HandleBenchTimer(void)
+{
+    if (mBenchDraining)
+    {
+        FinishBench();
+    }
+    else if (TimerMilli::GetNow() >= mBenchSendEndTime)
+    {
+        mBenchDraining = true;
+        mBenchTimer.Start(kBenchDrainTime);
+    }
+    else
+    {
+        SampleBenchBufferUse();
+        IgnoreError(SendBenchPacket());
+        mBenchTimer.Start(mBenchInterval);
+    }
+}
+
 otError UdpExample::ProcessLinkSecurity(Arg aArgs[])
 {
     otError error = OT_ERROR_NONE;
@@ -296,6 +552,8 @@ void UdpExample::HandleUdpReceive(otMessage *aMessage, const otMessageInfo *aMes
     char buf[1500];
     int  length;
 
+    VerifyOrExit(!HandleBenchReceive(*aMessage, *aMessageInfo));
+
     mInterpreter.OutputFormat("%d bytes from ", otMessageGetLength(aMessage) - otMessageGetOffset(aMessage));
     mInterpreter.OutputIp6Address(aMessageInfo->mPeerAddr);
     mInterpreter.OutputFormat(" %d ", aMessageInfo->mPeerPort);
@@ -304,6 +562,9 @@ void UdpExample::HandleUdpReceive(otMessage *aMessage, const otMessageInfo *aMes
     buf[length] = '\0';
 
     mInterpreter.OutputLine("%s", buf);
+
+exit:
+    return;
 }
 
 } // namespace Cli
@@ -38,6 +38,8 @@
 
 #include <openthread/udp.h>
 
+#include "common/time.hpp"
+#include "common/timer.hpp"
 #include "utils/lookup_table.hpp"
 #include "utils/parse_cmdline.hpp"
 
@@ -79,6 +81,7 @@ private:
     };
 
     otError ProcessHelp(Arg aArgs[]);
+    otError ProcessBench(Arg aArgs[]);
     otError ProcessBind(Arg aArgs[]);
     otError ProcessClose(Arg aArgs[]);
     otError ProcessConnect(Arg aArgs[]);
@@ -92,7 +95,17 @@ private:
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleUdpReceive(otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+    otError  SendBenchPacket(void);
+    bool     HandleBenchReceive(const otMessage &aMessage, const otMessageInfo &aMessageInfo);
+    void     SampleBenchBufferUse(void);
+    void     FinishBench(void);
+    uint32_t GetBenchPercentileRtt(uint8_t aPercent) const;
+
+    static void HandleBenchTimer(Timer &aTimer);
+    void        HandleBenchTimer(void);
+
     static constexpr Command sCommands[] = {
+        {"bench", &UdpExample::ProcessBench},
         {"bind", &UdpExample::ProcessBind},
         {"close", &UdpExample::ProcessClose},
         {"connect", &UdpExample::ProcessConnect},
@@ -104,10 +117,36 @@ private:
 
     static_assert(Utils::LookupTable::IsSorted(sCommands), "Command Table is not sorted");
 
+    // Bench packet layout: magic (4 bytes) + sequence number (4 bytes) + timestamp (4 bytes), then padding.
+    static constexpr uint16_t kBenchHeaderSize      = 12;
+    static constexpr uint32_t kBenchRequestMagic    = 0x6f746271; // "otbq"
+    static constexpr uint32_t kBenchReplyMagic      = 0x6f746270; // "otbp"
+    static constexpr uint16_t kBenchMaxPps          = 1000;
+    static constexpr uint16_t kBenchDefaultPps      = 10;
+    static constexpr uint16_t kBenchDefaultSize     = 32;   // bytes
+    static constexpr uint16_t kBenchDefaultDuration = 10;   // seconds
+    static constexpr uint32_t kBenchDrainTime       = 1000; // msec, wait for in-flight replies after last send
+    static constexpr uint8_t  kBenchNumBuckets      = 32;
+    static constexpr uint8_t  kBenchBucketWidth     = 8; // msec of RTT per histogram bucket
+
     Interpreter &mInterpreter;
 
     bool        mLinkSecurityEnabled;
     otUdpSocket mSocket;
+
+    TimerMilliContext mBenchTimer;
+    otSockAddr        mBenchPeer;
+    TimeMilli         mBenchStartTime;
+    TimeMilli         mBenchSendEndTime;
+    uint32_t          mBenchInterval;
+    uint32_t          mBenchTxCount;
+    uint32_t          mBenchRxCount;
+    uint32_t          mBenchRttSum;
+    uint16_t          mBenchPayloadLength;
+    uint16_t          mBenchMaxBuffersInUse;
+    bool              mBenchRunning;
+    bool              mBenchDraining;
+    uint16_t          mBenchHistogram[kBenchNumBuckets];
 };
 
 } // namespace Cli
@@ -133,6 +133,15 @@ otError otBackboneRouterGetNdProxyInfo(otInstance *                 aInstance,
     return instance.Get<BackboneRouter::NdProxyTable>().GetInfo(reinterpret_cast<const Ip6::Address &>(*aDua),
                                                                 *aNdProxyInfo);
 }
+
+void otBackboneRouterGetNdProxyTableInfo(otInstance *aInstance, otBackboneRouterNdProxyTableInfo *aTableInfo)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    OT_ASSERT(aTableInfo != nullptr);
+
+    instance.Get<BackboneRouter::NdProxyTable>().GetTableInfo(*aTableInfo);
+}
 #endif // OPENTHREAD_CONFIG_BACKBONE_ROUTER_DUA_NDPROXYING_ENABLE
 
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_MULTICAST_ROUTING_ENABLE
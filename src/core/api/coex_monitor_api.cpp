@@ -0,0 +1,80 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread coex monitor APIs.
+ */
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+
+#include <openthread/coex_monitor.h>
+
+#include "common/instance.hpp"
+#include "common/locator_getters.hpp"
+
+using namespace ot;
+
+otError otCoexMonitorSetEnabled(otInstance *aInstance, bool aEnabled)
+{
+    Utils::CoexMonitor &monitor = static_cast<Instance *>(aInstance)->Get<Utils::CoexMonitor>();
+
+    return aEnabled ? monitor.Start() : monitor.Stop();
+}
+
+bool otCoexMonitorIsEnabled(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::CoexMonitor>().IsRunning();
+}
+
+uint32_t otCoexMonitorGetSampleInterval(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return Utils::CoexMonitor::kSampleInterval;
+}
+
+uint32_t otCoexMonitorGetGrantDenialThreshold(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return Utils::CoexMonitor::kGrantDenialThreshold;
+}
+
+otError otCoexMonitorGetStats(otInstance *aInstance, otCoexMonitorStats *aStats)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::CoexMonitor>().GetStats(*aStats);
+}
+
+#endif // OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
@@ -88,6 +88,31 @@ const otHistoryTrackerNeighborInfo *otHistoryTrackerIterateNeighborHistory(otIns
         *static_cast<Utils::HistoryTracker::Iterator *>(aIterator), *aEntryAge);
 }
 
+uint16_t otHistoryTrackerExportRxHistory(otInstance *aInstance, void *aBuffer, uint16_t aSize)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::HistoryTracker>().ExportRxHistory(aBuffer, aSize);
+}
+
+const otHistoryTrackerForwarderQueueInfo *otHistoryTrackerIterateForwarderQueueHistory(
+    otInstance *              aInstance,
+    otHistoryTrackerIterator *aIterator,
+    uint32_t *                aEntryAge)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::HistoryTracker>().IterateForwarderQueueHistory(
+        *static_cast<Utils::HistoryTracker::Iterator *>(aIterator), *aEntryAge);
+}
+
+uint16_t otHistoryTrackerExportTxHistory(otInstance *aInstance, void *aBuffer, uint16_t aSize)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::HistoryTracker>().ExportTxHistory(aBuffer, aSize);
+}
+
 void otHistoryTrackerEntryAgeToString(uint32_t aEntryAge, char *aBuffer, uint16_t aSize)
 {
     Utils::HistoryTracker::EntryAgeToString(aEntryAge, aBuffer, aSize);
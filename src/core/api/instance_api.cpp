@@ -100,6 +100,15 @@ void otInstanceReset(otInstance *aInstance)
     instance.Reset();
 }
 
+#if OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE
+const otInstanceMemoryMapEntry *otInstanceGetMemoryMap(uint16_t *aNumEntries)
+{
+    OT_ASSERT(aNumEntries != nullptr);
+
+    return Instance::GetMemoryMap(*aNumEntries);
+}
+#endif
+
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
 uint64_t otInstanceGetUptime(otInstance *aInstance)
 {
@@ -124,6 +133,16 @@ otError otSetStateChangedCallback(otInstance *aInstance, otStateChangedCallback
     return instance.Get<Notifier>().RegisterCallback(aCallback, aContext);
 }
 
+otError otSetFilteredStateChangedCallback(otInstance *           aInstance,
+                                          otStateChangedCallback aCallback,
+                                          void *                 aContext,
+                                          otChangedFlags         aEventMask)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Notifier>().RegisterCallback(aCallback, aContext, aEventMask);
+}
+
 void otRemoveStateChangeCallback(otInstance *aInstance, otStateChangedCallback aCallback, void *aContext)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
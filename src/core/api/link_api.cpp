@@ -362,6 +362,22 @@ void otLinkResetTxRetrySuccessHistogram(otInstance *aInstance)
 }
 #endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+const uint32_t *otLinkGetTxLatencyHistogram(otInstance *aInstance, uint8_t *aNumberOfBins)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Mac::Mac>().GetTxLatencyHistogram(*aNumberOfBins);
+}
+
+void otLinkResetTxLatencyHistogram(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Mac::Mac>().ResetTxLatencyHistogram();
+}
+#endif // OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+
 void otLinkSetPcapCallback(otInstance *aInstance, otLinkPcapCallback aPcapCallback, void *aCallbackContext)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -369,6 +385,36 @@ void otLinkSetPcapCallback(otInstance *aInstance, otLinkPcapCallback aPcapCallba
     instance.Get<Mac::Mac>().SetPcapCallback(aPcapCallback, aCallbackContext);
 }
 
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+bool otLinkFrameCaptureIsEnabled(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::FrameCapture>().IsEnabled();
+}
+
+void otLinkFrameCaptureSetEnabled(otInstance *aInstance, bool aEnable)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Utils::FrameCapture>().SetEnabled(aEnable);
+}
+
+otError otLinkFrameCaptureRead(otInstance *aInstance, uint8_t *aBuffer, uint16_t *aLength)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::FrameCapture>().Read(aBuffer, *aLength);
+}
+
+uint32_t otLinkFrameCaptureGetDroppedCount(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::FrameCapture>().GetDroppedCount();
+}
+#endif // OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+
 bool otLinkIsPromiscuous(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
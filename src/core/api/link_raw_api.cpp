@@ -81,6 +81,13 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+otError otLinkRawSetRxFilter(otInstance *aInstance, const otLinkRawRxFilter *aFilter)
+{
+    return static_cast<Instance *>(aInstance)->Get<Mac::LinkRaw>().SetRxFilter(aFilter);
+}
+#endif
+
 otError otLinkRawSleep(otInstance *aInstance)
 {
     Error     error    = kErrorNone;
@@ -75,6 +75,12 @@ bool otMessageIsLinkSecurityEnabled(const otMessage *aMessage)
     return message.IsLinkSecurityEnabled();
 }
 
+void otMessageSetChecksumVerified(otMessage *aMessage, bool aVerified)
+{
+    Message &message = *static_cast<Message *>(aMessage);
+    message.SetChecksumVerified(aVerified);
+}
+
 void otMessageSetDirectTransmission(otMessage *aMessage, bool aEnabled)
 {
     Message &message = *static_cast<Message *>(aMessage);
@@ -101,6 +107,18 @@ otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength)
     return message.AppendBytes(aBuf, aLength);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+otError otMessageAppendExternalData(otMessage *                   aMessage,
+                                    const uint8_t *               aData,
+                                    uint16_t                      aLength,
+                                    otMessageExternalDataCallback aCallback,
+                                    void *                        aContext)
+{
+    Message &message = *static_cast<Message *>(aMessage);
+    return message.AppendExternalData(aData, aLength, aCallback, aContext);
+}
+#endif
+
 uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf, uint16_t aLength)
 {
     const Message &message = *static_cast<const Message *>(aMessage);
@@ -178,6 +196,14 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 
     aBufferInfo->mFreeBuffers = instance.Get<MessagePool>().GetFreeBufferCount();
 
+    aBufferInfo->mMaxUsedBuffers = instance.Get<MessagePool>().GetMaxUsedBufferCount();
+
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        aBufferInfo->mMaxUsedBuffersByPriority[priority] =
+            instance.Get<MessagePool>().GetMaxUsedBufferCount(static_cast<Message::Priority>(priority));
+    }
+
     instance.Get<MeshForwarder>().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages, aBufferInfo->m6loSendBuffers);
 
     instance.Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aBufferInfo->m6loReassemblyMessages,
@@ -228,4 +254,21 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+otError otMessageSetPriorityQuantum(otInstance *aInstance, otMessagePriority aPriority, uint16_t aQuantum)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<MeshForwarder>().SetTxQuantum(static_cast<Message::Priority>(aPriority), aQuantum);
+}
+
+uint16_t otMessageGetPriorityQuantum(otInstance *aInstance, otMessagePriority aPriority)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<MeshForwarder>().GetTxQuantum(static_cast<Message::Priority>(aPriority));
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -49,6 +49,19 @@ otError otNetDataGet(otInstance *aInstance, bool aStable, uint8_t *aData, uint8_
     return instance.Get<NetworkData::Leader>().GetNetworkData(aStable, aData, *aDataLength);
 }
 
+otError otNetDataGetNextEntry(otInstance *aInstance, otNetworkDataIterator *aIterator, otNetworkDataEntry *aEntry)
+{
+    Error     error    = kErrorNone;
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    VerifyOrExit(aIterator && aEntry, error = kErrorInvalidArgs);
+
+    error = instance.Get<NetworkData::Leader>().GetNextEntry(*aIterator, *aEntry);
+
+exit:
+    return error;
+}
+
 otError otNetDataGetNextOnMeshPrefix(otInstance *           aInstance,
                                      otNetworkDataIterator *aIterator,
                                      otBorderRouterConfig * aConfig)
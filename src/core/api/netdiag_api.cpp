@@ -73,4 +73,15 @@ otError otThreadSendDiagnosticReset(otInstance *        aInstance,
         *static_cast<const Ip6::Address *>(aDestination), aTlvTypes, aCount);
 }
 
+void otDiagnosticGetCountersSnapshot(otInstance *aInstance, otDiagnosticCountersSnapshot *aSnapshot)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    aSnapshot->mVersion     = OT_DIAGNOSTIC_COUNTERS_SNAPSHOT_VERSION;
+    aSnapshot->mTimestamp   = TimerMilli::GetNow().GetValue();
+    aSnapshot->mMacCounters = instance.Get<Mac::Mac>().GetCounters();
+    aSnapshot->mIp6Counters = instance.Get<MeshForwarder>().GetCounters();
+    aSnapshot->mMleCounters = instance.Get<Mle::MleRouter>().GetCounters();
+}
+
 #endif // OPENTHREAD_FTD || OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_MTD_ENABLE
@@ -56,4 +56,13 @@ void otPingSenderStop(otInstance *aInstance)
     instance.Get<Utils::PingSender>().Stop();
 }
 
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+const uint32_t *otPingSenderGetRttHistogram(otInstance *aInstance, uint8_t *aNumberOfBins)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::PingSender>().GetRttHistogram(*aNumberOfBins);
+}
+#endif
+
 #endif // OPENTHREAD_CONFIG_PING_SENDER_ENABLE
@@ -79,6 +79,22 @@ void otSrpClientBuffersFreeAllServices(otInstance *aInstance)
     instance.Get<Utils::SrpClientBuffers>().FreeAllServices();
 }
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+uint16_t otSrpClientBuffersGetMaxDynamicServices(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Utils::SrpClientBuffers>().GetMaxDynamicServices();
+}
+
+void otSrpClientBuffersSetMaxDynamicServices(otInstance *aInstance, uint16_t aMaxServices)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Utils::SrpClientBuffers>().SetMaxDynamicServices(aMaxServices);
+}
+#endif // OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+
 char *otSrpClientBuffersGetServiceEntryServiceNameString(otSrpClientBuffersServiceEntry *aEntry, uint16_t *aSize)
 {
     return static_cast<Utils::SrpClientBuffers::ServiceEntry *>(aEntry)->GetServiceNameString(*aSize);
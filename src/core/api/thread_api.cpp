@@ -358,6 +358,38 @@ otError otThreadGetNextNeighborInfo(otInstance *aInstance, otNeighborInfoIterato
     return instance.Get<NeighborTable>().GetNextNeighborInfo(*aIterator, *static_cast<Neighbor::Info *>(aInfo));
 }
 
+otError otThreadGetNeighborInfoBatch(otInstance *            aInstance,
+                                     otNeighborInfoIterator *aIterator,
+                                     otNeighborInfo *        aInfoBuffer,
+                                     uint8_t *               aCount)
+{
+    Error     error    = kErrorNone;
+    Instance &instance = *static_cast<Instance *>(aInstance);
+    uint8_t   count    = 0;
+
+    OT_ASSERT((aIterator != nullptr) && (aInfoBuffer != nullptr) && (aCount != nullptr) && (*aCount > 0));
+
+    while (count < *aCount)
+    {
+        error = instance.Get<NeighborTable>().GetNextNeighborInfo(*aIterator,
+                                                                  *static_cast<Neighbor::Info *>(&aInfoBuffer[count]));
+        VerifyOrExit(error == kErrorNone);
+        count++;
+    }
+
+exit:
+    // The batch is successful as long as at least one entry was retrieved.
+
+    if (count > 0)
+    {
+        error = kErrorNone;
+    }
+
+    *aCount = count;
+
+    return error;
+}
+
 otDeviceRole otThreadGetDeviceRole(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -535,6 +567,15 @@ bool otThreadIsDiscoverInProgress(otInstance *aInstance)
     return instance.Get<Mle::DiscoverScanner>().IsInProgress();
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+uint16_t otThreadGetForwarderQueueSnapshot(otInstance *aInstance, otForwarderQueueEntry *aEntries, uint16_t aMaxEntries)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<MeshForwarder>().GetQueueSnapshot(aEntries, aMaxEntries);
+}
+#endif
+
 const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -89,6 +89,22 @@ otError otThreadSetRouterEligible(otInstance *aInstance, bool aEligible)
     return instance.Get<Mle::MleRouter>().SetRouterEligible(aEligible);
 }
 
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+bool otThreadIsLeaderHotStandbyEnabled(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Mle::MleRouter>().IsLeaderHotStandbyEnabled();
+}
+
+void otThreadSetLeaderHotStandbyEnabled(otInstance *aInstance, bool aEnabled)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Mle::MleRouter>().SetLeaderHotStandbyEnabled(aEnabled);
+}
+#endif // OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+
 otError otThreadSetPreferredRouterId(otInstance *aInstance, uint8_t aRouterId)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -274,6 +290,47 @@ otError otThreadGetChildInfoByIndex(otInstance *aInstance, uint16_t aChildIndex,
     return instance.Get<ChildTable>().GetChildInfoByIndex(aChildIndex, *static_cast<Child::Info *>(aChildInfo));
 }
 
+otError otThreadGetNextChildInfo(otInstance *aInstance, otChildInfoIterator *aIterator, otChildInfo *aChildInfo)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    OT_ASSERT((aIterator != nullptr) && (aChildInfo != nullptr));
+
+    return instance.Get<ChildTable>().GetNextChildInfo(*aIterator, *static_cast<Child::Info *>(aChildInfo));
+}
+
+otError otThreadGetChildInfoBatch(otInstance *         aInstance,
+                                  otChildInfoIterator *aIterator,
+                                  otChildInfo *        aInfoBuffer,
+                                  uint8_t *            aCount)
+{
+    Error     error    = kErrorNone;
+    Instance &instance = *static_cast<Instance *>(aInstance);
+    uint8_t   count    = 0;
+
+    OT_ASSERT((aIterator != nullptr) && (aInfoBuffer != nullptr) && (aCount != nullptr) && (*aCount > 0));
+
+    while (count < *aCount)
+    {
+        error = instance.Get<ChildTable>().GetNextChildInfo(*aIterator,
+                                                            *static_cast<Child::Info *>(&aInfoBuffer[count]));
+        VerifyOrExit(error == kErrorNone);
+        count++;
+    }
+
+exit:
+    // The batch is successful as long as at least one entry was retrieved.
+
+    if (count > 0)
+    {
+        error = kErrorNone;
+    }
+
+    *aCount = count;
+
+    return error;
+}
+
 otError otThreadGetChildNextIp6Address(otInstance *               aInstance,
                                        uint16_t                   aChildIndex,
                                        otChildIp6AddressIterator *aIterator,
@@ -334,6 +391,33 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
     return instance.Get<AddressResolver>().GetNextCacheEntry(*aEntryInfo, *aIterator);
 }
 
+otError otThreadPreloadCacheEntry(otInstance *aInstance, const otIp6Address *aEid, uint16_t aRloc16)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    OT_ASSERT(aEid != nullptr);
+
+    return instance.Get<AddressResolver>().PreloadCacheEntry(*static_cast<const Ip6::Address *>(aEid), aRloc16);
+}
+
+void otThreadGetRouteUpdateCounters(otInstance *aInstance, otRouteUpdateCounters *aCounters)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    OT_ASSERT(aCounters != nullptr);
+
+    *aCounters = instance.Get<Mle::MleRouter>().GetRouteUpdateCounters();
+}
+
+void otThreadGetCacheEntryCounters(otInstance *aInstance, otCacheEntryCounters *aCounters)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    OT_ASSERT(aCounters != nullptr);
+
+    *aCounters = instance.Get<AddressResolver>().GetCacheEntryCounters();
+}
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
 void otThreadSetSteeringData(otInstance *aInstance, const otExtAddress *aExtAddress)
 {
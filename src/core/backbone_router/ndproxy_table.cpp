@@ -141,6 +141,10 @@ void NdProxyTable::Clear(void)
         proxy.Clear();
     }
 
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+    ClearIndex();
+#endif
+
     if (mCallback != nullptr)
     {
         mCallback(mCallbackContext, OT_BACKBONE_ROUTER_NDPROXY_CLEARED, nullptr);
@@ -181,9 +185,18 @@ Error NdProxyTable::Register(const Ip6::InterfaceIdentifier &aAddressIid,
         VerifyOrExit(proxy != nullptr, error = kErrorNoBufs);
     }
 
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+    // The slot may still be linked in the index under its previous DUA IID.
+    RemoveFromIndex(*proxy);
+#endif
+
     proxy->Init(aAddressIid, aMeshLocalIid, aRloc16, timeSinceLastTransaction);
     mIsAnyDadInProcess = true;
 
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+    AddToIndex(*proxy);
+#endif
+
 exit:
     otLogInfoBbr("NdProxyTable::Register %s MLIID %s RLOC16 %04x LTT %u => %s", aAddressIid.ToString().AsCString(),
                  aMeshLocalIid.ToString().AsCString(), aRloc16, timeSinceLastTransaction, ErrorToString(error));
@@ -194,6 +207,28 @@ NdProxyTable::NdProxy *NdProxyTable::FindByAddressIid(const Ip6::InterfaceIdenti
 {
     NdProxy *found = nullptr;
 
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+    uint16_t *link = &mBuckets[HashAddressIid(aAddressIid) % kNumBuckets];
+
+    while (*link != kInvalidIndex)
+    {
+        NdProxy &proxy = mProxies[*link];
+
+        if (!proxy.mValid)
+        {
+            // Age out erased entries incrementally while walking the chain.
+            *link = mNextIndex[*link];
+            continue;
+        }
+
+        if (proxy.mAddressIid == aAddressIid)
+        {
+            ExitNow(found = &proxy);
+        }
+
+        link = &mNextIndex[*link];
+    }
+#else
     for (NdProxy &proxy : Iterate(kFilterValid))
     {
         if (proxy.mAddressIid == aAddressIid)
@@ -201,6 +236,7 @@ NdProxyTable::NdProxy *NdProxyTable::FindByAddressIid(const Ip6::InterfaceIdenti
             ExitNow(found = &proxy);
         }
     }
+#endif
 
 exit:
     otLogDebgBbr("NdProxyTable::FindByAddressIid(%s) => %s", aAddressIid.ToString().AsCString(),
@@ -208,6 +244,62 @@ exit:
     return found;
 }
 
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+
+uint16_t NdProxyTable::HashAddressIid(const Ip6::InterfaceIdentifier &aAddressIid)
+{
+    uint16_t hash = 0;
+
+    for (uint8_t i = 0; i < Ip6::InterfaceIdentifier::kSize; i++)
+    {
+        hash = static_cast<uint16_t>((hash << 5) + hash + aAddressIid.GetBytes()[i]);
+    }
+
+    return hash;
+}
+
+void NdProxyTable::AddToIndex(NdProxy &aNdProxy)
+{
+    uint16_t index  = static_cast<uint16_t>(&aNdProxy - &mProxies[0]);
+    uint16_t bucket = HashAddressIid(aNdProxy.mAddressIid) % kNumBuckets;
+
+    mNextIndex[index] = mBuckets[bucket];
+    mBuckets[bucket]  = index;
+}
+
+void NdProxyTable::RemoveFromIndex(NdProxy &aNdProxy)
+{
+    uint16_t  index = static_cast<uint16_t>(&aNdProxy - &mProxies[0]);
+    uint16_t *link  = &mBuckets[HashAddressIid(aNdProxy.mAddressIid) % kNumBuckets];
+
+    while (*link != kInvalidIndex)
+    {
+        if (*link == index)
+        {
+            *link             = mNextIndex[index];
+            mNextIndex[index] = kInvalidIndex;
+            break;
+        }
+
+        link = &mNextIndex[*link];
+    }
+}
+
+void NdProxyTable::ClearIndex(void)
+{
+    for (uint16_t &bucket : mBuckets)
+    {
+        bucket = kInvalidIndex;
+    }
+
+    for (uint16_t &next : mNextIndex)
+    {
+        next = kInvalidIndex;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+
 NdProxyTable::NdProxy *NdProxyTable::FindByMeshLocalIid(const Ip6::InterfaceIdentifier &aMeshLocalIid)
 {
     NdProxy *found = nullptr;
@@ -337,26 +429,36 @@ void NdProxyTable::NotifyDuaRegistrationOnBackboneLink(NdProxyTable::NdProxy &aN
 
 Error NdProxyTable::GetInfo(const Ip6::Address &aDua, otBackboneRouterNdProxyInfo &aNdProxyInfo)
 {
-    Error error = kErrorNotFound;
+    Error    error = kErrorNotFound;
+    NdProxy *proxy;
 
     VerifyOrExit(Get<Leader>().IsDomainUnicast(aDua), error = kErrorInvalidArgs);
 
-    for (NdProxy &proxy : Iterate(kFilterValid))
-    {
-        if (proxy.mAddressIid == aDua.GetIid())
-        {
-            aNdProxyInfo.mMeshLocalIid             = &proxy.mMeshLocalIid;
-            aNdProxyInfo.mTimeSinceLastTransaction = proxy.GetTimeSinceLastTransaction();
-            aNdProxyInfo.mRloc16                   = proxy.mRloc16;
+    proxy = FindByAddressIid(aDua.GetIid());
+    VerifyOrExit(proxy != nullptr);
 
-            ExitNow(error = kErrorNone);
-        }
-    }
+    aNdProxyInfo.mMeshLocalIid             = &proxy->mMeshLocalIid;
+    aNdProxyInfo.mTimeSinceLastTransaction = proxy->GetTimeSinceLastTransaction();
+    aNdProxyInfo.mRloc16                   = proxy->mRloc16;
+
+    error = kErrorNone;
 
 exit:
     return error;
 }
 
+void NdProxyTable::GetTableInfo(otBackboneRouterNdProxyTableInfo &aTableInfo)
+{
+    aTableInfo.mNumEntries = 0;
+    aTableInfo.mMaxEntries = kMaxNdProxyNum;
+
+    for (NdProxy &proxy : Iterate(kFilterValid))
+    {
+        OT_UNUSED_VARIABLE(proxy);
+        aTableInfo.mNumEntries++;
+    }
+}
+
 } // namespace BackboneRouter
 
 } // namespace ot
@@ -137,6 +137,9 @@ public:
         , mCallbackContext(nullptr)
         , mIsAnyDadInProcess(false)
     {
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+        ClearIndex();
+#endif
     }
 
     /**
@@ -230,6 +233,14 @@ public:
      */
     Error GetInfo(const Ip6::Address &aDua, otBackboneRouterNdProxyInfo &aNdProxyInfo);
 
+    /**
+     * This method retrieves the occupancy info of the ND Proxy table.
+     *
+     * @param[out] aTableInfo  A reference to the table info to populate.
+     *
+     */
+    void GetTableInfo(otBackboneRouterNdProxyTableInfo &aTableInfo);
+
 private:
     static constexpr uint16_t kMaxNdProxyNum = OPENTHREAD_CONFIG_NDPROXY_TABLE_ENTRY_NUM;
 
@@ -291,10 +302,26 @@ private:
     void            NotifyDuaRegistrationOnBackboneLink(NdProxy &aNdProxy, bool aIsRenew);
     void TriggerCallback(otBackboneRouterNdProxyEvent aEvent, const Ip6::InterfaceIdentifier &aAddressIid) const;
 
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+    static constexpr uint16_t kNumBuckets   = kMaxNdProxyNum;
+    static constexpr uint16_t kInvalidIndex = 0xffff;
+
+    static uint16_t HashAddressIid(const Ip6::InterfaceIdentifier &aAddressIid);
+    void            AddToIndex(NdProxy &aNdProxy);
+    void            RemoveFromIndex(NdProxy &aNdProxy);
+    void            ClearIndex(void);
+#endif
+
     NdProxy                         mProxies[kMaxNdProxyNum];
     otBackboneRouterNdProxyCallback mCallback;
     void *                          mCallbackContext;
     bool                            mIsAnyDadInProcess : 1;
+#if OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+    // Hash index keyed by the DUA IID: `mBuckets` holds the index of the first proxy in each bucket chain and
+    // `mNextIndex` links the chains. Erased entries are unlinked incrementally as bucket chains are walked.
+    uint16_t mBuckets[kNumBuckets];
+    uint16_t mNextIndex[kMaxNdProxyNum];
+#endif
 };
 
 } // namespace BackboneRouter
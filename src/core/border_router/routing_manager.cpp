@@ -73,6 +73,7 @@ RoutingManager::RoutingManager(Instance &aInstance)
     , mRouterSolicitTimer(aInstance, HandleRouterSolicitTimer)
     , mRouterSolicitCount(0)
     , mRoutingPolicyTimer(aInstance, HandleRoutingPolicyTimer)
+    , mPendingPolicyTriggers(0)
 {
     mLocalOmrPrefix.Clear();
 
@@ -322,7 +323,7 @@ void RoutingManager::HandleNotifierEvents(Events aEvents)
 
     if (mIsRunning && aEvents.Contains(kEventThreadNetdataChanged))
     {
-        StartRoutingPolicyEvaluationDelay();
+        StartRoutingPolicyEvaluationDelay(kPolicyTriggerNetworkData);
     }
 
 exit:
@@ -578,12 +579,27 @@ void RoutingManager::EvaluateRoutingPolicy(void)
 
     const Ip6::Prefix *newOnLinkPrefix = nullptr;
     OmrPrefixArray     newOmrPrefixes;
+    bool               fullEvaluation  = (mPendingPolicyTriggers != kPolicyTriggerDiscoveredPrefix);
 
-    otLogInfoBr("Evaluating routing policy");
+    mPendingPolicyTriggers = 0;
+
+    otLogInfoBr("Evaluating routing policy (%s)", fullEvaluation ? "full" : "incremental");
 
     // 0. Evaluate on-link & OMR prefixes.
     newOnLinkPrefix = EvaluateOnLinkPrefix();
-    EvaluateOmrPrefix(newOmrPrefixes);
+
+    if (fullEvaluation)
+    {
+        EvaluateOmrPrefix(newOmrPrefixes);
+    }
+    else
+    {
+        // Only prefixes discovered on the infra link changed. Thread
+        // Network Data is unchanged since the last evaluation, so the
+        // previously advertised OMR prefix set is reused without
+        // re-walking Network Data.
+        newOmrPrefixes = mAdvertisedOmrPrefixes;
+    }
 
     // 1. Send Router Advertisement message if necessary.
     SendRouterAdvertisement(newOmrPrefixes, newOnLinkPrefix);
@@ -617,17 +633,27 @@ void RoutingManager::EvaluateRoutingPolicy(void)
     mAdvertisedOmrPrefixes          = newOmrPrefixes;
 }
 
-void RoutingManager::StartRoutingPolicyEvaluationDelay(void)
+void RoutingManager::StartRoutingPolicyEvaluationDelay(uint8_t aTriggers)
 {
     OT_ASSERT(mIsRunning);
 
     uint32_t randomDelay;
 
+    mPendingPolicyTriggers |= aTriggers;
+
+    // Debounce: if an evaluation is already scheduled, let the running
+    // timer fire instead of restarting (and re-randomizing) the delay,
+    // so that a burst of triggers results in a single evaluation.
+    VerifyOrExit(!mRoutingPolicyTimer.IsRunning());
+
     static_assert(kMaxRoutingPolicyDelay > 0, "invalid maximum routing policy evaluation delay");
     randomDelay = Random::NonCrypto::GetUint32InRange(0, Time::SecToMsec(kMaxRoutingPolicyDelay));
 
     otLogInfoBr("Start evaluating routing policy, scheduled in %u milliseconds", randomDelay);
     mRoutingPolicyTimer.Start(randomDelay);
+
+exit:
+    return;
 }
 
 // starts sending Router Solicitations in random delay
@@ -1039,7 +1065,7 @@ void RoutingManager::HandleRouterAdvertisement(const Ip6::Address &aSrcAddress,
 
     if (needReevaluate)
     {
-        StartRoutingPolicyEvaluationDelay();
+        StartRoutingPolicyEvaluationDelay(kPolicyTriggerDiscoveredPrefix);
     }
 
 exit:
@@ -1073,13 +1099,10 @@ bool RoutingManager::UpdateDiscoveredPrefixes(const RouterAdv::PrefixInfoOption
 
     staleTime = TimerMilli::GetNow();
 
-    for (ExternalPrefix &externalPrefix : mDiscoveredPrefixes)
-    {
-        if (externalPrefix == onLinkPrefix)
-        {
-            existingPrefix = &externalPrefix;
-        }
+    existingPrefix = FindDiscoveredPrefix(prefix, /* aIsOnLinkPrefix */ true);
 
+    for (const ExternalPrefix &externalPrefix : mDiscoveredPrefixes)
+    {
         staleTime = OT_MAX(staleTime, externalPrefix.GetStaleTime());
     }
 
@@ -1093,9 +1116,8 @@ bool RoutingManager::UpdateDiscoveredPrefixes(const RouterAdv::PrefixInfoOption
         if (!mDiscoveredPrefixes.IsFull())
         {
             SuccessOrExit(AddExternalRoute(prefix, NetworkData::kRoutePreferenceMedium));
-            existingPrefix  = mDiscoveredPrefixes.PushBack();
-            *existingPrefix = onLinkPrefix;
-            needReevaluate  = true;
+            existingPrefix = InsertDiscoveredPrefix(onLinkPrefix);
+            needReevaluate = true;
         }
         else
         {
@@ -1181,13 +1203,10 @@ bool RoutingManager::UpdateDiscoveredPrefixes(const RouterAdv::RouteInfoOption &
     omrPrefix.mRoutePreference = aRio.GetPreference();
     omrPrefix.mTimeLastUpdate  = TimerMilli::GetNow();
 
-    for (ExternalPrefix &externalPrefix : mDiscoveredPrefixes)
-    {
-        if (externalPrefix == omrPrefix)
-        {
-            existingPrefix = &externalPrefix;
-        }
+    existingPrefix = FindDiscoveredPrefix(prefix, /* aIsOnLinkPrefix */ false);
 
+    for (const ExternalPrefix &externalPrefix : mDiscoveredPrefixes)
+    {
         mDiscoveredPrefixStaleTimer.FireAtIfEarlier(externalPrefix.GetStaleTime());
     }
 
@@ -1201,7 +1220,7 @@ bool RoutingManager::UpdateDiscoveredPrefixes(const RouterAdv::RouteInfoOption &
         if (!mDiscoveredPrefixes.IsFull())
         {
             SuccessOrExit(AddExternalRoute(prefix, omrPrefix.mRoutePreference));
-            existingPrefix = mDiscoveredPrefixes.PushBack();
+            existingPrefix = InsertDiscoveredPrefix(omrPrefix);
             needReevaluate = true;
         }
         else
@@ -1220,6 +1239,65 @@ exit:
     return needReevaluate;
 }
 
+RoutingManager::ExternalPrefix *RoutingManager::FindDiscoveredPrefix(const Ip6::Prefix &aPrefix, bool aIsOnLinkPrefix)
+{
+    ExternalPrefix *prefix = nullptr;
+    ExternalPrefix  target;
+    uint8_t         left  = 0;
+    uint8_t         right = mDiscoveredPrefixes.GetLength();
+
+    target.Clear();
+    target.mPrefix         = aPrefix;
+    target.mIsOnLinkPrefix = aIsOnLinkPrefix;
+
+    // The array is kept sorted (per `ExternalPrefix::operator<`), so
+    // the entry can be located with a binary search.
+    while (left < right)
+    {
+        uint8_t middle = (left + right) / 2;
+
+        if (mDiscoveredPrefixes[middle] < target)
+        {
+            left = middle + 1;
+        }
+        else if (target < mDiscoveredPrefixes[middle])
+        {
+            right = middle;
+        }
+        else
+        {
+            ExitNow(prefix = &mDiscoveredPrefixes[middle]);
+        }
+    }
+
+exit:
+    return prefix;
+}
+
+RoutingManager::ExternalPrefix *RoutingManager::InsertDiscoveredPrefix(const ExternalPrefix &aPrefix)
+{
+    ExternalPrefix *prefix = mDiscoveredPrefixes.PushBack();
+    uint8_t         index;
+
+    VerifyOrExit(prefix != nullptr);
+
+    // Shift the existing entries to insert the new one at its sorted
+    // position.
+    index = static_cast<uint8_t>(mDiscoveredPrefixes.GetLength() - 1);
+
+    while ((index > 0) && (aPrefix < mDiscoveredPrefixes[index - 1]))
+    {
+        mDiscoveredPrefixes[index] = mDiscoveredPrefixes[index - 1];
+        index--;
+    }
+
+    prefix  = &mDiscoveredPrefixes[index];
+    *prefix = aPrefix;
+
+exit:
+    return prefix;
+}
+
 bool RoutingManager::InvalidateDiscoveredPrefixes(const Ip6::Prefix *aPrefix, bool aIsOnLinkPrefix)
 {
     bool                didRemove                = false;
@@ -245,6 +245,14 @@ private:
             return mPrefix == aPrefix.mPrefix && mIsOnLinkPrefix == aPrefix.mIsOnLinkPrefix;
         }
 
+        // Defines the sort order of the discovered prefix array (OMR
+        // prefixes before on-link prefixes, then by prefix) which
+        // allows binary search lookups.
+        bool operator<(const ExternalPrefix &aOther) const
+        {
+            return (mIsOnLinkPrefix != aOther.mIsOnLinkPrefix) ? !mIsOnLinkPrefix : (mPrefix < aOther.mPrefix);
+        }
+
         bool IsDeprecated(void) const
         {
             OT_ASSERT(mIsOnLinkPrefix);
@@ -266,6 +274,17 @@ private:
     typedef Array<Ip6::Prefix, kMaxOmrPrefixNum>           OmrPrefixArray;
     typedef Array<ExternalPrefix, kMaxDiscoveredPrefixNum> ExternalPrefixArray;
 
+    // Triggers for (debounced) routing policy evaluation. The triggers
+    // are tracked as bit flags so that a burst of them coalesces into a
+    // single evaluation, and the evaluation can skip work for inputs
+    // that did not change.
+    enum PolicyTrigger : uint8_t
+    {
+        kPolicyTriggerDiscoveredPrefix = 1 << 0, // A prefix discovered on the infra link changed.
+        kPolicyTriggerNetworkData      = 1 << 1, // Thread Network Data changed.
+        kPolicyTriggerFull             = 0xff,   // Force a full evaluation.
+    };
+
     void  EvaluateState(void);
     void  Start(void);
     void  Stop(void);
@@ -278,7 +297,7 @@ private:
     const Ip6::Prefix *EvaluateOnLinkPrefix(void);
 
     void  EvaluateRoutingPolicy(void);
-    void  StartRoutingPolicyEvaluationDelay(void);
+    void  StartRoutingPolicyEvaluationDelay(uint8_t aTriggers);
     void  EvaluateOmrPrefix(OmrPrefixArray &aNewOmrPrefixes);
     Error PublishLocalOmrPrefix(void);
     void  UnpublishLocalOmrPrefix(void);
@@ -307,6 +326,8 @@ private:
     void HandleRouterAdvertisement(const Ip6::Address &aSrcAddress, const uint8_t *aBuffer, uint16_t aBufferLength);
     bool UpdateDiscoveredPrefixes(const RouterAdv::PrefixInfoOption &aPio, bool aManagedAddrConfig);
     bool UpdateDiscoveredPrefixes(const RouterAdv::RouteInfoOption &aRio);
+    ExternalPrefix *FindDiscoveredPrefix(const Ip6::Prefix &aPrefix, bool aIsOnLinkPrefix);
+    ExternalPrefix *InsertDiscoveredPrefix(const ExternalPrefix &aPrefix);
     bool InvalidateDiscoveredPrefixes(const Ip6::Prefix *aPrefix = nullptr, bool aIsOnLinkPrefix = true);
     void InvalidateAllDiscoveredPrefixes(void);
     bool NetworkDataContainsOmrPrefix(const Ip6::Prefix &aPrefix) const;
@@ -358,7 +379,8 @@ private:
     // The array of prefixes discovered on the infra link. Those
     // prefixes consist of on-link prefix(es) and OMR prefixes
     // advertised by BRs in another Thread Network which is connected to
-    // the same infra link.
+    // the same infra link. The array is kept sorted (per
+    // `ExternalPrefix::operator<`) to allow binary search lookups.
     ExternalPrefixArray mDiscoveredPrefixes;
 
     // The RA header and parameters for the infra interface.
@@ -380,6 +402,10 @@ private:
     uint8_t    mRouterSolicitCount;
 
     TimerMilli mRoutingPolicyTimer;
+
+    // The pending `PolicyTrigger` bit flags for the scheduled (debounced)
+    // routing policy evaluation.
+    uint8_t mPendingPolicyTriggers;
 };
 
 } // namespace BorderRouter
@@ -48,8 +48,17 @@ namespace Coap {
 
 CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    , mPendingIndexOverflowed(false)
+#endif
     , mMessageId(Random::NonCrypto::GetUint16())
     , mRetransmissionTimer(aInstance, Coap::HandleRetransmissionTimer, this)
+#if OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+    , mDeferredAckTimer(aInstance, HandleDeferredAckTimer, this)
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+    , mObserveSequence(kObserveSequenceFirst)
+#endif
     , mContext(nullptr)
     , mInterceptor(nullptr)
     , mResponsesQueue(aInstance)
@@ -58,14 +67,132 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     , mSender(aSender)
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     , mLastResponse(nullptr)
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART > 1
+    , mBlock2PipelineActive(false)
+    , mBlock2NumRequested(0)
+    , mBlock2NumReceived(0)
+    , mBlock2LastBlockNum(0)
+#endif
+#endif
+{
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    for (uint16_t i = 0; i < kPendingRequestIndexSize; i++)
+    {
+        mPendingIndex[i].mMessage = nullptr;
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+    for (DeferredAck &ack : mDeferredAcks)
+    {
+        ack.mInUse = false;
+    }
+#endif
+}
+
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+uint32_t CoapBase::ComputeTokenHash(const Message &aMessage)
+{
+    uint32_t       hash  = aMessage.GetTokenLength();
+    const uint8_t *token = aMessage.GetToken();
+
+    for (uint8_t i = 0; i < aMessage.GetTokenLength(); i++)
+    {
+        hash = hash * 33 + token[i];
+    }
+
+    return hash;
+}
+
+CoapBase::PendingRequestIndexEntry *CoapBase::FindPendingIndexEntry(const Message &aMessage)
+{
+    PendingRequestIndexEntry *entry = nullptr;
+
+    for (uint16_t i = 0; i < kPendingRequestIndexSize; i++)
+    {
+        if (mPendingIndex[i].mMessage == &aMessage)
+        {
+            entry = &mPendingIndex[i];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+void CoapBase::AddPendingIndexEntry(Message &aMessage, const Metadata &aMetadata)
+{
+    PendingRequestIndexEntry *entry = nullptr;
+
+    for (uint16_t i = 0; i < kPendingRequestIndexSize; i++)
+    {
+        if (mPendingIndex[i].mMessage == nullptr)
+        {
+            entry = &mPendingIndex[i];
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        // Too many pending requests to index. The index is bypassed and
+        // the pending request queue is walked until it empties again.
+        mPendingIndexOverflowed = true;
+        ExitNow();
+    }
+
+    entry->mMessage       = &aMessage;
+    entry->mNextTimerShot = aMetadata.mNextTimerShot;
+    entry->mTokenHash     = ComputeTokenHash(aMessage);
+    entry->mMessageId     = aMessage.GetMessageId();
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    entry->mIsSubscription = aMessage.IsRequest() && aMetadata.mObserve && aMetadata.mAcknowledged;
+#else
+    entry->mIsSubscription = false;
+#endif
+
+exit:
+    return;
+}
+
+void CoapBase::UpdatePendingIndexEntry(const Message &aMessage, const Metadata &aMetadata)
+{
+    PendingRequestIndexEntry *entry = FindPendingIndexEntry(aMessage);
+
+    VerifyOrExit(entry != nullptr);
+
+    entry->mNextTimerShot = aMetadata.mNextTimerShot;
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+    entry->mIsSubscription = aMessage.IsRequest() && aMetadata.mObserve && aMetadata.mAcknowledged;
 #endif
+
+exit:
+    return;
+}
+
+void CoapBase::RemovePendingIndexEntry(const Message &aMessage)
 {
+    PendingRequestIndexEntry *entry = FindPendingIndexEntry(aMessage);
+
+    if (entry != nullptr)
+    {
+        entry->mMessage = nullptr;
+    }
+
+    if (mPendingRequests.GetHead() == nullptr)
+    {
+        mPendingIndexOverflowed = false;
+    }
 }
+#endif // OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
 
 void CoapBase::ClearRequestsAndResponses(void)
 {
     ClearRequests(nullptr); // Clear requests matching any address.
     mResponsesQueue.DequeueAllResponses();
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+    RemoveAllObservers();
+#endif
 }
 
 void CoapBase::ClearRequests(const Ip6::Address &aAddress)
@@ -113,8 +240,209 @@ void CoapBase::RemoveResource(Resource &aResource)
 {
     IgnoreError(mResources.Remove(aResource));
     aResource.SetNext(nullptr);
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+    RemoveObservers(aResource);
+#endif
+}
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+bool CoapBase::Observer::Matches(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+{
+    return (mTokenLength == aRequest.GetTokenLength()) && (memcmp(mToken, aRequest.GetToken(), mTokenLength) == 0) &&
+           (mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()) &&
+           (mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort());
 }
 
+CoapBase::Observer *CoapBase::FindObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+{
+    Observer *rval = nullptr;
+
+    for (Observer *observer = mObservers.GetHead(); observer != nullptr; observer = observer->GetNext())
+    {
+        if (observer->Matches(aRequest, aMessageInfo))
+        {
+            rval = observer;
+            break;
+        }
+    }
+
+    return rval;
+}
+
+Error CoapBase::AddObserver(const Resource &aResource, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error     error    = kErrorNone;
+    Observer *observer = FindObserver(aRequest, aMessageInfo);
+
+    if (observer != nullptr)
+    {
+        // A registration matching an existing observer (same endpoint
+        // and token) updates the relationship in place (RFC7641).
+        observer->mResource = &aResource;
+        ExitNow();
+    }
+
+    observer = mObserverPool.Allocate();
+    VerifyOrExit(observer != nullptr, error = kErrorNoBufs);
+
+    observer->mResource      = &aResource;
+    observer->mMessageInfo   = aMessageInfo;
+    observer->mLastMessageId = 0;
+    observer->mTokenLength   = aRequest.GetTokenLength();
+    memcpy(observer->mToken, aRequest.GetToken(), observer->mTokenLength);
+
+    mObservers.Push(*observer);
+
+    otLogInfoCoap("Added observer (num:%d)", GetObserverCount());
+
+exit:
+    return error;
+}
+
+Error CoapBase::RemoveObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error     error    = kErrorNotFound;
+    Observer *observer = FindObserver(aRequest, aMessageInfo);
+
+    VerifyOrExit(observer != nullptr);
+
+    IgnoreError(mObservers.Remove(*observer));
+    mObserverPool.Free(*observer);
+    error = kErrorNone;
+
+exit:
+    return error;
+}
+
+void CoapBase::RemoveObservers(const Resource &aResource)
+{
+    Observer *next;
+
+    for (Observer *observer = mObservers.GetHead(); observer != nullptr; observer = next)
+    {
+        next = observer->GetNext();
+
+        if (observer->mResource == &aResource)
+        {
+            IgnoreError(mObservers.Remove(*observer));
+            mObserverPool.Free(*observer);
+        }
+    }
+}
+
+void CoapBase::RemoveAllObservers(void)
+{
+    mObservers.Clear();
+    mObserverPool.FreeAll();
+}
+
+uint16_t CoapBase::GetObserverCount(void) const
+{
+    uint16_t count = 0;
+
+    for (const Observer *observer = mObservers.GetHead(); observer != nullptr; observer = observer->GetNext())
+    {
+        count++;
+    }
+
+    return count;
+}
+
+Error CoapBase::SendNotification(const Resource &aResource, const Message &aPayload, bool aConfirmable)
+{
+    Error error = kErrorNone;
+
+    // Advance the sequence number once per fan-out; all observers in
+    // this notification round share the same Observe option value.
+
+    mObserveSequence++;
+
+    if ((mObserveSequence & kObserveSequenceMask) < kObserveSequenceFirst)
+    {
+        mObserveSequence = kObserveSequenceFirst;
+    }
+
+    for (Observer *observer = mObservers.GetHead(); observer != nullptr; observer = observer->GetNext())
+    {
+        Error sendError;
+
+        if (observer->mResource != &aResource)
+        {
+            continue;
+        }
+
+        sendError = SendNotificationTo(*observer, aPayload, aConfirmable);
+
+        if (sendError != kErrorNone)
+        {
+            // Keep fanning out to the remaining observers and report
+            // the failure to the caller afterwards.
+            error = sendError;
+        }
+    }
+
+    return error;
+}
+
+Error CoapBase::SendNotificationTo(Observer &aObserver, const Message &aPayload, bool aConfirmable)
+{
+    Error            error         = kErrorNone;
+    Message *        notification  = nullptr;
+    uint16_t         payloadLength = aPayload.GetLength() - aPayload.GetOffset();
+    Ip6::MessageInfo messageInfo;
+
+    // Only the header (message ID, token, Observe option) is built per
+    // observer; the payload built once by the caller is shared across
+    // the whole fan-out.
+
+    notification = NewMessage();
+    VerifyOrExit(notification != nullptr, error = kErrorNoBufs);
+
+    notification->Init(aConfirmable ? kTypeConfirmable : kTypeNonConfirmable, kCodeContent);
+    notification->SetMessageId(mMessageId++);
+    SuccessOrExit(error = notification->SetToken(aObserver.mToken, aObserver.mTokenLength));
+    SuccessOrExit(error = notification->AppendObserveOption(mObserveSequence & kObserveSequenceMask));
+
+    if (payloadLength != 0)
+    {
+        SuccessOrExit(error = notification->SetPayloadMarker());
+        SuccessOrExit(error = notification->AppendBytesFromMessage(aPayload, aPayload.GetOffset(), payloadLength));
+    }
+
+    aObserver.mLastMessageId = notification->GetMessageId();
+
+    messageInfo = aObserver.mMessageInfo;
+    SuccessOrExit(error = SendMessage(*notification, messageInfo));
+    notification = nullptr;
+
+exit:
+    FreeMessage(notification);
+    return error;
+}
+
+void CoapBase::HandleObserverReset(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Observer *next;
+
+    for (Observer *observer = mObservers.GetHead(); observer != nullptr; observer = next)
+    {
+        next = observer->GetNext();
+
+        if ((observer->mLastMessageId == aMessage.GetMessageId()) &&
+            (observer->mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()) &&
+            (observer->mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()))
+        {
+            // The peer rejected a notification, ending the observe
+            // relationship (RFC7641).
+            IgnoreError(mObservers.Remove(*observer));
+            mObserverPool.Free(*observer);
+
+            otLogInfoCoap("Removed observer on reset (num:%d)", GetObserverCount());
+        }
+    }
+}
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+
 void CoapBase::SetDefaultHandler(RequestHandler aHandler, void *aContext)
 {
     mDefaultHandler        = aHandler;
@@ -185,6 +513,11 @@ Error CoapBase::SendMessage(Message &               aMessage,
     switch (aMessage.GetType())
     {
     case kTypeAck:
+#if OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+        // A piggybacked response acknowledges the request, superseding
+        // any still-deferred empty ACK for the same exchange.
+        CancelDeferredAck(aMessage, aMessageInfo);
+#endif
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
         // Check for block-wise transfer
         if ((aTransmitHook != nullptr) && (aMessage.ReadBlockOptionValues(kOptionBlock2) == kErrorNone) &&
@@ -341,7 +674,25 @@ Error CoapBase::SendReset(Message &aRequest, const Ip6::MessageInfo &aMessageInf
 
 Error CoapBase::SendAck(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
 {
-    return SendEmptyMessage(kTypeAck, aRequest, aMessageInfo);
+    Error error = kErrorInvalidArgs;
+
+    VerifyOrExit(aRequest.IsConfirmable());
+
+#if OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+    // Hold back the empty ACK for a confirmable request briefly, so
+    // that a quick piggybacked response from the handler can acknowledge
+    // the request instead. When the deferral table is full, fall back to
+    // sending the empty ACK immediately.
+    if (aRequest.IsRequest() && (DeferAck(aRequest, aMessageInfo) == kErrorNone))
+    {
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
+    error = SendEmptyMessage(kTypeAck, aRequest.GetMessageId(), aMessageInfo);
+
+exit:
+    return error;
 }
 
 Error CoapBase::SendEmptyAck(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo, Code aCode)
@@ -356,15 +707,25 @@ Error CoapBase::SendNotFound(const Message &aRequest, const Ip6::MessageInfo &aM
 
 Error CoapBase::SendEmptyMessage(Type aType, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
 {
-    Error    error   = kErrorNone;
-    Message *message = nullptr;
+    Error error = kErrorNone;
 
     VerifyOrExit(aRequest.IsConfirmable(), error = kErrorInvalidArgs);
 
+    error = SendEmptyMessage(aType, aRequest.GetMessageId(), aMessageInfo);
+
+exit:
+    return error;
+}
+
+Error CoapBase::SendEmptyMessage(Type aType, uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error    error   = kErrorNone;
+    Message *message = nullptr;
+
     VerifyOrExit((message = NewMessage()) != nullptr, error = kErrorNoBufs);
 
     message->Init(aType, kCodeEmpty);
-    message->SetMessageId(aRequest.GetMessageId());
+    message->SetMessageId(aMessageId);
 
     message->Finish();
     SuccessOrExit(error = Send(*message, aMessageInfo));
@@ -374,6 +735,92 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+Error CoapBase::DeferAck(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error        error = kErrorNoBufs;
+    DeferredAck *entry = nullptr;
+
+    for (DeferredAck &ack : mDeferredAcks)
+    {
+        if (ack.mInUse)
+        {
+            // A deferral is already pending for this exchange (e.g., a
+            // retransmitted request); keep the earlier entry.
+            VerifyOrExit((ack.mMessageId != aRequest.GetMessageId()) ||
+                             (ack.mMessageInfo.GetPeerAddr() != aMessageInfo.GetPeerAddr()) ||
+                             (ack.mMessageInfo.GetPeerPort() != aMessageInfo.GetPeerPort()),
+                         error = kErrorNone);
+        }
+        else if (entry == nullptr)
+        {
+            entry = &ack;
+        }
+    }
+
+    VerifyOrExit(entry != nullptr);
+
+    entry->mInUse       = true;
+    entry->mMessageId   = aRequest.GetMessageId();
+    entry->mMessageInfo = aMessageInfo;
+    entry->mSendTime    = TimerMilli::GetNow() + kDeferredAckTimeout;
+
+    mDeferredAckTimer.FireAtIfEarlier(entry->mSendTime);
+    error = kErrorNone;
+
+exit:
+    return error;
+}
+
+void CoapBase::CancelDeferredAck(const Message &aResponse, const Ip6::MessageInfo &aMessageInfo)
+{
+    for (DeferredAck &ack : mDeferredAcks)
+    {
+        if (ack.mInUse && (ack.mMessageId == aResponse.GetMessageId()) &&
+            (ack.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()) &&
+            (ack.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()))
+        {
+            ack.mInUse = false;
+            break;
+        }
+    }
+}
+
+void CoapBase::HandleDeferredAckTimer(Timer &aTimer)
+{
+    static_cast<CoapBase *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandleDeferredAckTimer();
+}
+
+void CoapBase::HandleDeferredAckTimer(void)
+{
+    TimeMilli now      = TimerMilli::GetNow();
+    TimeMilli nextTime = now.GetDistantFuture();
+
+    for (DeferredAck &ack : mDeferredAcks)
+    {
+        if (!ack.mInUse)
+        {
+            continue;
+        }
+
+        if (ack.mSendTime <= now)
+        {
+            ack.mInUse = false;
+            IgnoreError(SendEmptyMessage(kTypeAck, ack.mMessageId, ack.mMessageInfo));
+        }
+        else if (ack.mSendTime < nextTime)
+        {
+            nextTime = ack.mSendTime;
+        }
+    }
+
+    if (nextTime != now.GetDistantFuture())
+    {
+        mDeferredAckTimer.FireAt(nextTime);
+    }
+}
+#endif // OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+
 Error CoapBase::SendHeaderResponse(Message::Code aCode, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
 {
     Error    error   = kErrorNone;
@@ -414,60 +861,47 @@ void CoapBase::HandleRetransmissionTimer(Timer &aTimer)
 
 void CoapBase::HandleRetransmissionTimer(void)
 {
-    TimeMilli        now      = TimerMilli::GetNow();
-    TimeMilli        nextTime = now.GetDistantFuture();
-    Metadata         metadata;
-    Message *        nextMessage;
-    Ip6::MessageInfo messageInfo;
+    TimeMilli now      = TimerMilli::GetNow();
+    TimeMilli nextTime = now.GetDistantFuture();
 
-    for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = nextMessage)
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    if (!mPendingIndexOverflowed)
     {
-        nextMessage = message->GetNextCoapMessage();
-
-        metadata.ReadFrom(*message);
-
-        if (now >= metadata.mNextTimerShot)
+        // Iterate over the index (by position, since entries may get
+        // removed while being processed) so that only the requests that
+        // are actually due have their metadata read from the message
+        // buffers.
+        for (uint16_t i = 0; i < kPendingRequestIndexSize; i++)
         {
-#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
-            if (message->IsRequest() && metadata.mObserve && metadata.mAcknowledged)
+            PendingRequestIndexEntry &entry = mPendingIndex[i];
+
+            if (entry.mMessage == nullptr)
             {
-                // This is a RFC7641 subscription.  Do not time out.
                 continue;
             }
-#endif
 
-            if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
+            if (now >= entry.mNextTimerShot)
             {
-                // No expected response or acknowledgment.
-                FinalizeCoapTransaction(*message, metadata, nullptr, nullptr, kErrorResponseTimeout);
-                continue;
+                if (!entry.mIsSubscription)
+                {
+                    ProcessPendingRequest(*entry.mMessage, now, nextTime);
+                }
             }
-
-            // Increment retransmission counter and timer.
-            metadata.mRetransmissionsRemaining--;
-            metadata.mRetransmissionTimeout *= 2;
-            metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
-            metadata.UpdateIn(*message);
-
-            // Retransmit
-            if (!metadata.mAcknowledged)
+            else if (nextTime > entry.mNextTimerShot)
             {
-                messageInfo.SetPeerAddr(metadata.mDestinationAddress);
-                messageInfo.SetPeerPort(metadata.mDestinationPort);
-                messageInfo.SetSockAddr(metadata.mSourceAddress);
-#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-                messageInfo.SetHopLimit(metadata.mHopLimit);
-                messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
-#endif
-                messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
-
-                SendCopy(*message, messageInfo);
+                nextTime = entry.mNextTimerShot;
             }
         }
+    }
+    else
+#endif
+    {
+        Message *nextMessage;
 
-        if (nextTime > metadata.mNextTimerShot)
+        for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = nextMessage)
         {
-            nextTime = metadata.mNextTimerShot;
+            nextMessage = message->GetNextCoapMessage();
+            ProcessPendingRequest(*message, now, nextTime);
         }
     }
 
@@ -477,12 +911,79 @@ void CoapBase::HandleRetransmissionTimer(void)
     }
 }
 
+void CoapBase::ProcessPendingRequest(Message &aMessage, TimeMilli aNow, TimeMilli &aNextTime)
+{
+    Metadata         metadata;
+    Ip6::MessageInfo messageInfo;
+
+    metadata.ReadFrom(aMessage);
+
+    if (aNow >= metadata.mNextTimerShot)
+    {
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        if (aMessage.IsRequest() && metadata.mObserve && metadata.mAcknowledged)
+        {
+            // This is a RFC7641 subscription.  Do not time out.
+            ExitNow();
+        }
+#endif
+
+        if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
+        {
+            // No expected response or acknowledgment.
+            FinalizeCoapTransaction(aMessage, metadata, nullptr, nullptr, kErrorResponseTimeout);
+            ExitNow();
+        }
+
+        // Increment retransmission counter and timer.
+        metadata.mRetransmissionsRemaining--;
+        metadata.mRetransmissionTimeout *= 2;
+        metadata.mNextTimerShot = aNow + metadata.mRetransmissionTimeout;
+        metadata.UpdateIn(aMessage);
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+        UpdatePendingIndexEntry(aMessage, metadata);
+#endif
+
+        // Retransmit
+        if (!metadata.mAcknowledged)
+        {
+            messageInfo.SetPeerAddr(metadata.mDestinationAddress);
+            messageInfo.SetPeerPort(metadata.mDestinationPort);
+            messageInfo.SetSockAddr(metadata.mSourceAddress);
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+            messageInfo.SetHopLimit(metadata.mHopLimit);
+            messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
+#endif
+            messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
+
+            SendCopy(aMessage, messageInfo);
+        }
+    }
+
+    if (aNextTime > metadata.mNextTimerShot)
+    {
+        aNextTime = metadata.mNextTimerShot;
+    }
+
+exit:
+    return;
+}
+
 void CoapBase::FinalizeCoapTransaction(Message &               aRequest,
                                        const Metadata &        aMetadata,
                                        Message *               aResponse,
                                        const Ip6::MessageInfo *aMessageInfo,
                                        Error                   aResult)
 {
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && (OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART > 1)
+    // A failed transaction aborts any pipelined block-wise transfer in
+    // progress so its state cannot leak into a later transfer.
+    if (aResult != kErrorNone)
+    {
+        mBlock2PipelineActive = false;
+    }
+#endif
+
     DequeueMessage(aRequest);
 
     if (aMetadata.mResponseHandler != nullptr)
@@ -525,6 +1026,10 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopy
 
     mPendingRequests.Enqueue(*messageCopy);
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    AddPendingIndexEntry(*messageCopy, aMetadata);
+#endif
+
 exit:
     FreeAndNullMessageOnError(messageCopy, error);
     return messageCopy;
@@ -534,6 +1039,10 @@ void CoapBase::DequeueMessage(Message &aMessage)
 {
     mPendingRequests.Dequeue(aMessage);
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    RemovePendingIndexEntry(aMessage);
+#endif
+
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == nullptr))
     {
         mRetransmissionTimer.Stop();
@@ -720,6 +1229,17 @@ Error CoapBase::SendNextBlock2Request(Message &               aRequest,
     otLogInfoCoap("Received Block2 Nr. %d , Size: %d bytes, More Blocks Flag: %d", aMessage.GetBlockWiseBlockNumber(),
                   otCoapBlockSizeFromExponent(aMessage.GetBlockWiseBlockSize()), aMessage.IsMoreBlocksFlagSet());
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART > 1
+    // Pipelined transfer (NSTART > 1) needs the total size to bound the
+    // request window; it engages when the server provided a Size2
+    // option (later responses are matched through the active state).
+    if (!aBeginBlock1Transfer && (mBlock2PipelineActive || (aTotalLength != 0 && aMessage.IsMoreBlocksFlagSet())))
+    {
+        error = ContinuePipelinedBlock2Transfer(aRequest, aMessage, aMessageInfo, aCoapMetadata, aTotalLength);
+        ExitNow();
+    }
+#endif
+
     // Conclude block-wise transfer if last block has been received
     if (!aMessage.IsMoreBlocksFlagSet())
     {
@@ -750,6 +1270,89 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART > 1
+Error CoapBase::ContinuePipelinedBlock2Transfer(Message &               aRequest,
+                                                Message &               aMessage,
+                                                const Ip6::MessageInfo &aMessageInfo,
+                                                const Metadata &        aCoapMetadata,
+                                                uint32_t                aTotalLength)
+{
+    Error error = kErrorNone;
+
+    if (!mBlock2PipelineActive)
+    {
+        mBlock2PipelineActive = true;
+        mBlock2LastBlockNum   = (aTotalLength - 1) / otCoapBlockSizeFromExponent(aMessage.GetBlockWiseBlockSize());
+        mBlock2NumRequested   = aMessage.GetBlockWiseBlockNumber() + 1;
+        mBlock2NumReceived    = aMessage.GetBlockWiseBlockNumber();
+    }
+
+    mBlock2NumReceived++;
+
+    // Conclude the block-wise transfer once every block has been received
+    if (mBlock2NumReceived > mBlock2LastBlockNum)
+    {
+        mBlock2PipelineActive = false;
+        FinalizeCoapTransaction(aRequest, aCoapMetadata, &aMessage, &aMessageInfo, kErrorNone);
+        ExitNow();
+    }
+
+    // Top up the request window to `kBlockwiseNstart` outstanding block
+    // requests. `aRequest` serves as the option template and is dequeued
+    // (and freed) only once the new requests have been built from it.
+    while (((mBlock2NumRequested - mBlock2NumReceived) < kBlockwiseNstart) &&
+           (mBlock2NumRequested <= mBlock2LastBlockNum))
+    {
+        SuccessOrExit(error = SendBlock2RequestForBlock(aRequest, aMessage, aMessageInfo, aCoapMetadata,
+                                                        mBlock2NumRequested, mBlock2LastBlockNum));
+        mBlock2NumRequested++;
+    }
+
+    DequeueMessage(aRequest);
+
+exit:
+    if (error != kErrorNone)
+    {
+        // The caller finalizes the transaction (and dequeues `aRequest`) on failure.
+        mBlock2PipelineActive = false;
+    }
+
+    return error;
+}
+
+Error CoapBase::SendBlock2RequestForBlock(Message &               aRequestOld,
+                                          Message &               aResponse,
+                                          const Ip6::MessageInfo &aMessageInfo,
+                                          const Metadata &        aCoapMetadata,
+                                          uint32_t                aBlockNumber,
+                                          uint32_t                aLastBlockNumber)
+{
+    Error    error   = kErrorNone;
+    Message *request = nullptr;
+
+    // `PrepareNextBlockRequest()` builds the request for the block
+    // following the one in `aResponse`; point the response's block-wise
+    // metadata at the preceding block number accordingly.
+    aResponse.SetBlockWiseBlockNumber(aBlockNumber - 1);
+
+    VerifyOrExit((request = NewMessage()) != nullptr, error = kErrorNoBufs);
+    SuccessOrExit(error = PrepareNextBlockRequest(Message::kBlockType2, aBlockNumber < aLastBlockNumber, aRequestOld,
+                                                  *request, aResponse));
+
+    otLogInfoCoap("Request Block2 Nr. %d, Size: %d bytes (pipelined)", request->GetBlockWiseBlockNumber(),
+                  otCoapBlockSizeFromExponent(request->GetBlockWiseBlockSize()));
+
+    SuccessOrExit(error =
+                      SendMessage(*request, aMessageInfo, TxParameters::GetDefault(), aCoapMetadata.mResponseHandler,
+                                  aCoapMetadata.mResponseContext, nullptr, aCoapMetadata.mBlockwiseReceiveHook));
+
+exit:
+    FreeMessageOnError(request, error);
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART > 1
+
 Error CoapBase::ProcessBlock1Request(Message &                aMessage,
                                      const Ip6::MessageInfo & aMessageInfo,
                                      const ResourceBlockWise &aResource,
@@ -962,7 +1565,55 @@ Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       Metadata &              aMetadata)
 {
-    Message *message;
+    Message *message = nullptr;
+
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    if (!mPendingIndexOverflowed)
+    {
+        uint32_t tokenHash = ComputeTokenHash(aResponse);
+
+        for (uint16_t i = 0; i < kPendingRequestIndexSize; i++)
+        {
+            const PendingRequestIndexEntry &entry   = mPendingIndex[i];
+            bool                            matches = false;
+
+            if (entry.mMessage == nullptr)
+            {
+                continue;
+            }
+
+            switch (aResponse.GetType())
+            {
+            case kTypeReset:
+            case kTypeAck:
+                matches = (aResponse.GetMessageId() == entry.mMessageId);
+                break;
+
+            case kTypeConfirmable:
+            case kTypeNonConfirmable:
+                // The token hash may collide, so a hash match is verified
+                // against the token in the request message itself.
+                matches = (tokenHash == entry.mTokenHash) && aResponse.IsTokenEqual(*entry.mMessage);
+                break;
+            }
+
+            if (matches)
+            {
+                aMetadata.ReadFrom(*entry.mMessage);
+
+                if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
+                     aMetadata.mDestinationAddress.IsMulticast() ||
+                     aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()) &&
+                    (aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
+                {
+                    ExitNow(message = entry.mMessage);
+                }
+            }
+        }
+
+        ExitNow();
+    }
+#endif
 
     for (message = mPendingRequests.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
     {
@@ -1040,6 +1691,16 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
     uint32_t totalTransfereSize = 0;
 #endif
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+    if ((aMessage.GetType() == kTypeReset) && aMessage.IsEmpty())
+    {
+        // An empty reset may reject one of our notifications (matched
+        // by message ID and peer endpoint), ending the observe
+        // relationship.
+        HandleObserverReset(aMessage, aMessageInfo);
+    }
+#endif
+
     request = FindRelatedRequest(aMessage, aMessageInfo, metadata);
     VerifyOrExit(request != nullptr);
 
@@ -1086,6 +1747,9 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 {
                     metadata.mAcknowledged = true;
                     metadata.UpdateIn(*request);
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+                    UpdatePendingIndexEntry(*request, metadata);
+#endif
                 }
 
                 // Remove the message if response is not expected, otherwise await
@@ -1111,6 +1775,9 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 // Consider the message acknowledged at this point.
                 metadata.mAcknowledged = true;
                 metadata.UpdateIn(*request);
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+                UpdatePendingIndexEntry(*request, metadata);
+#endif
             }
             else
 #endif
@@ -1135,9 +1802,13 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                             break;
 
                         case kOptionSize2:
-                            // ToDo: wait for method to read uint option values
-                            totalTransfereSize = 0;
+                        {
+                            uint64_t size2 = 0;
+
+                            SuccessOrExit(error = iterator.ReadOptionValue(size2));
+                            totalTransfereSize = static_cast<uint32_t>(size2);
                             break;
+                        }
 
                         default:
                             break;
@@ -39,6 +39,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "common/timer.hpp"
 #include "net/ip6.hpp"
 #include "net/netif.hpp"
@@ -359,7 +360,8 @@ class CoapBase : public InstanceLocator, private NonCopyable
 
 public:
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
-    static constexpr uint16_t kMaxBlockLength = OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH;
+    static constexpr uint16_t kMaxBlockLength  = OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH;
+    static constexpr uint8_t  kBlockwiseNstart = OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART;
 #endif
 
     /**
@@ -425,6 +427,79 @@ public:
      */
     void RemoveResource(Resource &aResource);
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+    /**
+     * This method registers an observer (RFC7641) for a given resource.
+     *
+     * This method is expected to be called from the resource request handler when the received request carries an
+     * Observe option with value zero (registration). The peer endpoint and the request token are recorded
+     * internally; an existing observer matching the same endpoint and token is updated in place.
+     *
+     * @param[in]  aResource     The observed resource.
+     * @param[in]  aRequest      The received registration request (provides the token).
+     * @param[in]  aMessageInfo  The message info associated with @p aRequest (provides the peer endpoint).
+     *
+     * @retval kErrorNone    Successfully registered the observer.
+     * @retval kErrorNoBufs  All observer entries are already in use.
+     *
+     */
+    Error AddObserver(const Resource &aResource, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
+
+    /**
+     * This method removes the observer matching a given request's token and peer endpoint.
+     *
+     * This method is expected to be called when a request carries an Observe option with value one (deregistration).
+     *
+     * @param[in]  aRequest      The received deregistration request (provides the token).
+     * @param[in]  aMessageInfo  The message info associated with @p aRequest (provides the peer endpoint).
+     *
+     * @retval kErrorNone      Successfully removed the observer.
+     * @retval kErrorNotFound  No matching observer was found.
+     *
+     */
+    Error RemoveObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
+
+    /**
+     * This method removes all observers of a given resource.
+     *
+     * @param[in]  aResource   The observed resource.
+     *
+     */
+    void RemoveObservers(const Resource &aResource);
+
+    /**
+     * This method removes all registered observers.
+     *
+     */
+    void RemoveAllObservers(void);
+
+    /**
+     * This method sends a notification to every observer of a given resource.
+     *
+     * The payload in @p aPayload (from its offset up to its length) is built once by the caller and shared across
+     * all observers; only the per-observer header (message ID, token, and Observe option carrying the next
+     * sequence number) is built per observer. An observer whose peer rejects a notification with a reset message
+     * is removed automatically.
+     *
+     * @param[in]  aPayload      A message holding the notification payload.
+     * @param[in]  aResource     The observed resource.
+     * @param[in]  aConfirmable  Whether to send the notifications as confirmable messages.
+     *
+     * @retval kErrorNone    Successfully sent (or started sending) notifications to all observers.
+     * @retval kErrorNoBufs  Insufficient buffers available to send a notification.
+     *
+     */
+    Error SendNotification(const Resource &aResource, const Message &aPayload, bool aConfirmable = false);
+
+    /**
+     * This method returns the number of registered observers.
+     *
+     * @returns The number of registered observers.
+     *
+     */
+    uint16_t GetObserverCount(void) const;
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+
     /* This method sets the default handler for unhandled CoAP requests.
      *
      * @param[in]  aHandler   A function pointer that shall be called when an unhandled request arrives.
@@ -558,6 +633,9 @@ public:
     /**
      * This method sends a CoAP ACK empty message which is used in Separate Response for confirmable requests.
      *
+     * When `OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE` is enabled, the empty ACK for a confirmable request may be
+     * deferred briefly and is superseded by a piggybacked response sent within the deferral window.
+     *
      * @param[in]  aRequest        A reference to the CoAP Message that was used in CoAP request.
      * @param[in]  aMessageInfo    The message info corresponding to the CoAP request.
      *
@@ -717,8 +795,32 @@ private:
 #endif
     };
 
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    // This structure caches the fields of a pending request needed by
+    // the retransmission timer and response matching, so that neither
+    // has to read the full `Metadata` of every pending request from
+    // the message buffers.
+    struct PendingRequestIndexEntry
+    {
+        Message * mMessage;        // The pending request, or `nullptr` when the entry is unused.
+        TimeMilli mNextTimerShot;  // Cached `Metadata::mNextTimerShot`.
+        uint32_t  mTokenHash;      // Hash of the request token.
+        uint16_t  mMessageId;      // The request message ID.
+        bool      mIsSubscription; // Whether this is an acknowledged RFC7641 subscription (never times out).
+    };
+
+    static constexpr uint16_t kPendingRequestIndexSize = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE;
+
+    static uint32_t           ComputeTokenHash(const Message &aMessage);
+    PendingRequestIndexEntry *FindPendingIndexEntry(const Message &aMessage);
+    void                      AddPendingIndexEntry(Message &aMessage, const Metadata &aMetadata);
+    void                      UpdatePendingIndexEntry(const Message &aMessage, const Metadata &aMetadata);
+    void                      RemovePendingIndexEntry(const Message &aMessage);
+#endif
+
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
+    void        ProcessPendingRequest(Message &aMessage, TimeMilli aNow, TimeMilli &aNextTime);
 
     void     ClearRequests(const Ip6::Address *aAddress);
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const Metadata &aMetadata);
@@ -761,18 +863,94 @@ private:
                                 const Metadata &        aCoapMetadata,
                                 uint32_t                aTotalLength,
                                 bool                    aBeginBlock1Transfer);
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART > 1
+    Error ContinuePipelinedBlock2Transfer(Message &               aRequest,
+                                          Message &               aMessage,
+                                          const Ip6::MessageInfo &aMessageInfo,
+                                          const Metadata &        aCoapMetadata,
+                                          uint32_t                aTotalLength);
+    Error SendBlock2RequestForBlock(Message &               aRequestOld,
+                                    Message &               aResponse,
+                                    const Ip6::MessageInfo &aMessageInfo,
+                                    const Metadata &        aCoapMetadata,
+                                    uint32_t                aBlockNumber,
+                                    uint32_t                aLastBlockNumber);
+#endif
 #endif
     void  SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     Error SendEmptyMessage(Type aType, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
+    Error SendEmptyMessage(Type aType, uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+    // This structure tracks a registered observer (RFC7641): the
+    // observed resource, the peer endpoint, the token to echo in
+    // notifications, and the message ID of the last notification (used
+    // to match a rejecting reset message from the peer).
+    struct Observer : public LinkedListEntry<Observer>
+    {
+        bool Matches(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+
+        Observer *       mNext;
+        const Resource * mResource;
+        Ip6::MessageInfo mMessageInfo;
+        uint16_t         mLastMessageId;
+        uint8_t          mToken[Message::kMaxTokenLength];
+        uint8_t          mTokenLength;
+    };
+
+    static constexpr uint16_t kMaxObservers         = OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS;
+    static constexpr uint32_t kObserveSequenceMask  = 0xffffff; // Observe option value is 24-bit (RFC7641).
+    static constexpr uint32_t kObserveSequenceFirst = 2;        // First sequence value (0 and 1 are reserved
+                                                                // for registration/deregistration in requests).
+
+    Observer *FindObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
+    Error     SendNotificationTo(Observer &aObserver, const Message &aPayload, bool aConfirmable);
+    void      HandleObserverReset(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+    // This structure tracks an empty ACK whose transmission is held
+    // back briefly so that a quick response from the resource handler
+    // can acknowledge the request instead.
+    struct DeferredAck
+    {
+        Ip6::MessageInfo mMessageInfo; // The message info of the confirmable request.
+        TimeMilli        mSendTime;    // Time when the empty ACK should be sent.
+        uint16_t         mMessageId;   // The request message ID.
+        bool             mInUse;       // Whether the entry is in use.
+    };
+
+    static constexpr uint8_t  kMaxDeferredAcks    = OPENTHREAD_CONFIG_COAP_MAX_DEFERRED_ACKS;
+    static constexpr uint32_t kDeferredAckTimeout = OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_TIMEOUT;
+
+    Error       DeferAck(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
+    void        CancelDeferredAck(const Message &aResponse, const Ip6::MessageInfo &aMessageInfo);
+    static void HandleDeferredAckTimer(Timer &aTimer);
+    void        HandleDeferredAckTimer(void);
+#endif
 
     Error Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
-    MessageQueue      mPendingRequests;
+    MessageQueue mPendingRequests;
+#if OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+    PendingRequestIndexEntry mPendingIndex[kPendingRequestIndexSize];
+    bool                     mPendingIndexOverflowed;
+#endif
     uint16_t          mMessageId;
     TimerMilliContext mRetransmissionTimer;
+#if OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+    DeferredAck       mDeferredAcks[kMaxDeferredAcks];
+    TimerMilliContext mDeferredAckTimer;
+#endif
 
     LinkedList<Resource> mResources;
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+    LinkedList<Observer>          mObservers;
+    Pool<Observer, kMaxObservers> mObserverPool;
+    uint32_t                      mObserveSequence;
+#endif
+
     void *         mContext;
     Interceptor    mInterceptor;
     ResponsesQueue mResponsesQueue;
@@ -785,6 +963,12 @@ private:
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     LinkedList<ResourceBlockWise> mBlockWiseResources;
     Message *                     mLastResponse;
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART > 1
+    bool     mBlock2PipelineActive;
+    uint32_t mBlock2NumRequested;
+    uint32_t mBlock2NumReceived;
+    uint32_t mBlock2LastBlockNum;
+#endif
 #endif
 };
 
@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include "common/code_utils.hpp"
+#include "common/clearable.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/equatable.hpp"
@@ -35,12 +35,69 @@
 
 namespace ot {
 
+#if OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION != OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE
+
+#if OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION == OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_SLICE_BY_4
+static constexpr uint8_t kNumTables = 4;
+#else
+static constexpr uint8_t kNumTables = 1;
+#endif
+
+// Tables for one polynomial. `mTables[k][v]` is the CRC16 of byte value
+// `v` followed by `k` zero bytes. Built on first use of the polynomial.
+struct Crc16Tables
+{
+    uint16_t mPolynomial;
+    uint16_t mTables[kNumTables][256];
+};
+
+static Crc16Tables sTables[2];
+
+static const uint16_t (*GetTables(uint16_t aPolynomial))[256]
+{
+    Crc16Tables *tables = &sTables[(aPolynomial == Crc16::kCcitt) ? 0 : 1];
+
+    if (tables->mPolynomial != aPolynomial)
+    {
+        for (uint16_t value = 0; value < 256; value++)
+        {
+            uint16_t crc = static_cast<uint16_t>(value << 8);
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 0x8000) ? static_cast<uint16_t>(crc << 1) ^ aPolynomial : static_cast<uint16_t>(crc << 1);
+            }
+
+            tables->mTables[0][value] = crc;
+        }
+
+        for (uint8_t k = 1; k < kNumTables; k++)
+        {
+            for (uint16_t value = 0; value < 256; value++)
+            {
+                uint16_t crc = tables->mTables[k - 1][value];
+
+                tables->mTables[k][value] =
+                    static_cast<uint16_t>(crc << 8) ^ tables->mTables[0][static_cast<uint8_t>(crc >> 8)];
+            }
+        }
+
+        tables->mPolynomial = aPolynomial;
+    }
+
+    return tables->mTables;
+}
+
+#endif // OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION != OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE
+
 Crc16::Crc16(Polynomial aPolynomial)
 {
     mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
+#if OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION == OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE
+
 void Crc16::Update(uint8_t aByte)
 {
     uint8_t i;
@@ -61,4 +118,44 @@ void Crc16::Update(uint8_t aByte)
     } while (--i);
 }
 
+void Crc16::Update(const uint8_t *aBytes, uint16_t aLength)
+{
+    while (aLength-- != 0)
+    {
+        Update(*aBytes++);
+    }
+}
+
+#else // OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION != OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE
+
+void Crc16::Update(uint8_t aByte)
+{
+    const uint16_t(*tables)[256] = GetTables(mPolynomial);
+
+    mCrc = static_cast<uint16_t>(mCrc << 8) ^ tables[0][static_cast<uint8_t>(mCrc >> 8) ^ aByte];
+}
+
+void Crc16::Update(const uint8_t *aBytes, uint16_t aLength)
+{
+    const uint16_t(*tables)[256] = GetTables(mPolynomial);
+
+#if OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION == OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_SLICE_BY_4
+    while (aLength >= 4)
+    {
+        mCrc = tables[3][static_cast<uint8_t>(mCrc >> 8) ^ aBytes[0]] ^
+               tables[2][static_cast<uint8_t>(mCrc) ^ aBytes[1]] ^ tables[1][aBytes[2]] ^ tables[0][aBytes[3]];
+
+        aBytes += 4;
+        aLength -= 4;
+    }
+#endif
+
+    while (aLength-- != 0)
+    {
+        mCrc = static_cast<uint16_t>(mCrc << 8) ^ tables[0][static_cast<uint8_t>(mCrc >> 8) ^ *aBytes++];
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION == OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE
+
 } // namespace ot
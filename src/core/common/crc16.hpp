@@ -75,6 +75,18 @@ public:
      */
     void Update(uint8_t aByte);
 
+    /**
+     * This method feeds a sequence of bytes into the CRC16 computation.
+     *
+     * With a table-driven implementation (see `OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION`), feeding a full buffer
+     * through this method is faster than repeated single-byte `Update()` calls.
+     *
+     * @param[in]  aBytes   A pointer to a buffer of bytes.
+     * @param[in]  aLength  The number of bytes in @p aBytes.
+     *
+     */
+    void Update(const uint8_t *aBytes, uint16_t aLength);
+
     /**
      * This method gets the current CRC16 value.
      *
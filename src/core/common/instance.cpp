@@ -35,6 +35,7 @@
 
 #include <openthread/platform/misc.h>
 
+#include "common/locator_getters.hpp"
 #include "common/logging.hpp"
 #include "common/new.hpp"
 #include "radio/trel_link.hpp"
@@ -87,12 +88,21 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
     , mChannelMonitor(*this)
 #endif
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+    , mCoexMonitor(*this)
+#endif
 #if OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE && OPENTHREAD_FTD
     , mChannelManager(*this)
 #endif
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+    , mFrameCapture(*this)
+#endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     , mHistoryTracker(*this)
 #endif
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    , mPipelineProfiler(*this)
+#endif
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
     , mDatasetUpdater(*this)
 #endif
@@ -170,9 +180,116 @@ exit:
 
 void Instance::Reset(void)
 {
+#if (OPENTHREAD_MTD || OPENTHREAD_FTD) && OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    Get<SettingsDriver>().Flush();
+#endif
     otPlatReset(this);
 }
 
+#if OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const otInstanceMemoryMapEntry *Instance::GetMemoryMap(uint16_t &aNumEntries)
+{
+    // `Instance` is not a standard-layout class, so `offsetof` on its
+    // members is only conditionally supported. It is well-defined on
+    // the compilers used to build OpenThread (the related warning is
+    // suppressed above). The entries mirror the member declarations
+    // (and their config guards) in `instance.hpp`. `mExtension` is a
+    // reference member and is intentionally not listed.
+
+#define OT_MEMORY_MAP_ENTRY(aMember)                                                            \
+    {                                                                                           \
+        #aMember, static_cast<uint32_t>(offsetof(Instance, aMember)), sizeof(Instance::aMember) \
+    }
+
+    static const otInstanceMemoryMapEntry kMemoryMap[] = {
+        OT_MEMORY_MAP_ENTRY(mTaskletScheduler),
+        OT_MEMORY_MAP_ENTRY(mTimerMilliScheduler),
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+        OT_MEMORY_MAP_ENTRY(mTimerMicroScheduler),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+        OT_MEMORY_MAP_ENTRY(mMbedTls),
+#endif
+        OT_MEMORY_MAP_ENTRY(mRandomManager),
+        OT_MEMORY_MAP_ENTRY(mRadio),
+#if OPENTHREAD_CONFIG_UPTIME_ENABLE
+        OT_MEMORY_MAP_ENTRY(mUptime),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+        OT_MEMORY_MAP_ENTRY(mNotifier),
+        OT_MEMORY_MAP_ENTRY(mTimeTicker),
+        OT_MEMORY_MAP_ENTRY(mSettings),
+        OT_MEMORY_MAP_ENTRY(mSettingsDriver),
+        OT_MEMORY_MAP_ENTRY(mMessagePool),
+        OT_MEMORY_MAP_ENTRY(mIp6),
+        OT_MEMORY_MAP_ENTRY(mThreadNetif),
+#if OPENTHREAD_CONFIG_COAP_API_ENABLE
+        OT_MEMORY_MAP_ENTRY(mApplicationCoap),
+#endif
+#if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
+        OT_MEMORY_MAP_ENTRY(mApplicationCoapSecure),
+#endif
+#if OPENTHREAD_CONFIG_PING_SENDER_ENABLE
+        OT_MEMORY_MAP_ENTRY(mPingSender),
+#endif
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+        OT_MEMORY_MAP_ENTRY(mChannelMonitor),
+#endif
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+        OT_MEMORY_MAP_ENTRY(mCoexMonitor),
+#endif
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE && OPENTHREAD_FTD
+        OT_MEMORY_MAP_ENTRY(mChannelManager),
+#endif
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+        OT_MEMORY_MAP_ENTRY(mFrameCapture),
+#endif
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
+        OT_MEMORY_MAP_ENTRY(mHistoryTracker),
+#endif
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+        OT_MEMORY_MAP_ENTRY(mPipelineProfiler),
+#endif
+#if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
+        OT_MEMORY_MAP_ENTRY(mDatasetUpdater),
+#endif
+#if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
+        OT_MEMORY_MAP_ENTRY(mAnnounceSender),
+#endif
+#if OPENTHREAD_CONFIG_OTNS_ENABLE
+        OT_MEMORY_MAP_ENTRY(mOtns),
+#endif
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
+        OT_MEMORY_MAP_ENTRY(mRoutingManager),
+#endif
+#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
+        OT_MEMORY_MAP_ENTRY(mLinkRaw),
+#endif
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+        OT_MEMORY_MAP_ENTRY(mDiags),
+#endif
+    };
+
+#undef OT_MEMORY_MAP_ENTRY
+
+    aNumEntries = OT_ARRAY_LENGTH(kMemoryMap);
+
+    return kMemoryMap;
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE
+
 void Instance::AfterInit(void)
 {
     mIsInitialized = true;
@@ -181,6 +298,11 @@ void Instance::AfterInit(void)
     // Restore datasets and network information
 
     Get<Settings>().Init();
+
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+    RandomManager::SetUpPersistedSeed(*this);
+#endif
+
     IgnoreError(Get<Mle::MleRouter>().Restore());
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -83,9 +83,18 @@
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 #include "utils/channel_monitor.hpp"
 #endif
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+#include "utils/coex_monitor.hpp"
+#endif
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+#include "utils/frame_capture.hpp"
+#endif
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
 #include "utils/history_tracker.hpp"
 #endif
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+#include "utils/pipeline_profiler.hpp"
+#endif
 
 #if (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 #include "backbone_router/bbr_leader.hpp"
@@ -194,6 +203,22 @@ public:
      */
     void Reset(void);
 
+#if OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE
+    /**
+     * This static method gets the memory map of the `Instance` class.
+     *
+     * The memory map lists the size and offset of each major `Instance` member (in declaration order), allowing
+     * the instance RAM footprint to be attributed by subsystem. The map is determined by the build configuration
+     * and is the same for all instances.
+     *
+     * @param[out]  aNumEntries  A reference to a variable to output the number of entries in the returned table.
+     *
+     * @returns A pointer to the first entry of the memory map table.
+     *
+     */
+    static const otInstanceMemoryMapEntry *GetMemoryMap(uint16_t &aNumEntries);
+#endif
+
     /**
      * This method returns the active log level.
      *
@@ -391,14 +416,26 @@ private:
     Utils::ChannelMonitor mChannelMonitor;
 #endif
 
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+    Utils::CoexMonitor mCoexMonitor;
+#endif
+
 #if OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE && OPENTHREAD_FTD
     Utils::ChannelManager mChannelManager;
 #endif
 
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+    Utils::FrameCapture mFrameCapture;
+#endif
+
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
     Utils::HistoryTracker mHistoryTracker;
 #endif
 
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    Utils::PipelineProfiler mPipelineProfiler;
+#endif
+
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
     MeshCoP::DatasetUpdater mDatasetUpdater;
 #endif
@@ -724,7 +761,11 @@ template <> inline TimeSync &Instance::Get(void)
 #if OPENTHREAD_CONFIG_COMMISSIONER_ENABLE && OPENTHREAD_FTD
 template <> inline MeshCoP::Commissioner &Instance::Get(void)
 {
+#if OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+    return mThreadNetif.mCommissioner.Get(*this);
+#else
     return mThreadNetif.mCommissioner;
+#endif
 }
 #endif
 
@@ -759,7 +800,11 @@ template <> inline Utils::SrpClientBuffers &Instance::Get(void)
 #if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
 template <> inline Dns::ServiceDiscovery::Server &Instance::Get(void)
 {
+#if OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+    return mThreadNetif.mDnssdServer.Get(*this);
+#else
     return mThreadNetif.mDnssdServer;
+#endif
 }
 #endif
 
@@ -839,6 +884,13 @@ template <> inline Utils::ChannelMonitor &Instance::Get(void)
 }
 #endif
 
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+template <> inline Utils::CoexMonitor &Instance::Get(void)
+{
+    return mCoexMonitor;
+}
+#endif
+
 #if OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE && OPENTHREAD_FTD
 template <> inline Utils::ChannelManager &Instance::Get(void)
 {
@@ -846,6 +898,13 @@ template <> inline Utils::ChannelManager &Instance::Get(void)
 }
 #endif
 
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+template <> inline Utils::FrameCapture &Instance::Get(void)
+{
+    return mFrameCapture;
+}
+#endif
+
 #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
 template <> inline Utils::HistoryTracker &Instance::Get(void)
 {
@@ -853,6 +912,13 @@ template <> inline Utils::HistoryTracker &Instance::Get(void)
 }
 #endif
 
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+template <> inline Utils::PipelineProfiler &Instance::Get(void)
+{
+    return mPipelineProfiler;
+}
+#endif
+
 #if (OPENTHREAD_CONFIG_DATASET_UPDATER_ENABLE || OPENTHREAD_CONFIG_CHANNEL_MANAGER_ENABLE) && OPENTHREAD_FTD
 template <> inline MeshCoP::DatasetUpdater &Instance::Get(void)
 {
@@ -956,7 +1022,11 @@ template <> inline BorderRouter::RoutingManager &Instance::Get(void)
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 template <> inline Srp::Server &Instance::Get(void)
 {
+#if OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+    return mThreadNetif.mSrpServer.Get(*this);
+#else
     return mThreadNetif.mSrpServer;
+#endif
 }
 #endif
 
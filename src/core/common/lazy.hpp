@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a lazily constructed object wrapper.
+ */
+
+#ifndef LAZY_HPP_
+#define LAZY_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/new.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+
+class Instance;
+
+/**
+ * This template class represents a lazily constructed object.
+ *
+ * The wrapped object's storage is reserved statically (as with a plain member), but its constructor does not run
+ * until the object is first accessed through `Get()`. This keeps `Instance` initialization fast and leaves the
+ * object's RAM pages untouched until the related feature is actually used.
+ *
+ * The wrapped `Type` class MUST provide a constructor taking a single `Instance &` argument, and its constructor
+ * MUST NOT have side effects beyond initializing the object itself (e.g., it must not register with or signal
+ * other modules), since the time of its invocation depends on first use.
+ *
+ * @tparam Type  The type of the wrapped object.
+ *
+ */
+template <typename Type> class Lazy : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the `Lazy` wrapper (without constructing the wrapped object).
+     *
+     */
+    Lazy(void)
+        : mIsInitialized(false)
+    {
+    }
+
+    /**
+     * This method indicates whether or not the wrapped object has been constructed.
+     *
+     * @retval TRUE   If the wrapped object has been constructed.
+     * @retval FALSE  If the wrapped object has not yet been constructed.
+     *
+     */
+    bool IsInitialized(void) const { return mIsInitialized; }
+
+    /**
+     * This method returns a reference to the wrapped object, constructing it on first use.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance (passed to the constructor on first use).
+     *
+     * @returns A reference to the wrapped object.
+     *
+     */
+    Type &Get(Instance &aInstance)
+    {
+        if (!mIsInitialized)
+        {
+            new (&mStorage) Type(aInstance);
+            mIsInitialized = true;
+        }
+
+        return *reinterpret_cast<Type *>(&mStorage);
+    }
+
+private:
+    OT_DEFINE_ALIGNED_VAR(mStorage, sizeof(Type), uint64_t);
+    bool mIsInitialized;
+};
+
+} // namespace ot
+
+#endif // LAZY_HPP_
@@ -54,25 +54,47 @@
 #error "OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME is not supported under OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE"
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE && OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY
+#error "OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE is not supported under OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #if !OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY
 
+#if OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+
+typedef struct LogEntry
+{
+    otLogLevel  mLevel;
+    otLogRegion mRegion;
+    char        mString[OPENTHREAD_CONFIG_LOG_MAX_SIZE];
+} LogEntry;
+
+static LogEntry sLogRing[OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE];
+static uint16_t sLogRingStart   = 0;
+static uint16_t sLogRingLength  = 0;
+static uint16_t sLogRingDropped = 0;
+
+#endif // OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+
 static void Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
 {
     ot::String<OPENTHREAD_CONFIG_LOG_MAX_SIZE> logString;
 
+#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
+    // Filter before any formatting work so that a dropped log costs
+    // only this check.
+    VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
+#endif
+
 #if OPENTHREAD_CONFIG_LOG_PREPEND_UPTIME
     ot::Uptime::UptimeToString(ot::Instance::Get().Get<ot::Uptime>().GetUptime(), logString);
     logString.Append(" ");
 #endif
 
-#if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
-    VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
-#endif
-
 #if OPENTHREAD_CONFIG_LOG_PREPEND_LEVEL
     logString.Append("%s", otLogLevelToPrefixString(aLogLevel));
 #endif
@@ -102,7 +124,31 @@ static void Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aForma
 #endif
 
     logString.AppendVarArgs(aFormat, aArgs);
+
+#if OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+    if (sLogRingLength < OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE)
+    {
+        LogEntry &entry  = sLogRing[(sLogRingStart + sLogRingLength) % OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE];
+        uint16_t  length = logString.GetLength();
+
+        if (length >= sizeof(entry.mString))
+        {
+            length = sizeof(entry.mString) - 1;
+        }
+
+        entry.mLevel  = aLogLevel;
+        entry.mRegion = aLogRegion;
+        memcpy(entry.mString, logString.AsCString(), length);
+        entry.mString[length] = '\0';
+        sLogRingLength++;
+    }
+    else if (sLogRingDropped < 0xffff)
+    {
+        sLogRingDropped++;
+    }
+#else
     otPlatLog(aLogLevel, aLogRegion, "%s" OPENTHREAD_CONFIG_LOG_SUFFIX, logString.AsCString());
+#endif
 
 #if OPENTHREAD_CONFIG_LOG_LEVEL_DYNAMIC_ENABLE
 exit:
@@ -110,6 +156,28 @@ exit:
 #endif
 }
 
+#if OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+void otLoggingFlushDeferred(void)
+{
+    if ((sLogRingDropped > 0) && (sLogRingLength < OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE))
+    {
+        uint16_t dropped = sLogRingDropped;
+
+        sLogRingDropped = 0;
+        otLogWarnCore("Deferred log ring overflowed, %u entries dropped", dropped);
+    }
+
+    while (sLogRingLength > 0)
+    {
+        const LogEntry &entry = sLogRing[sLogRingStart];
+
+        otPlatLog(entry.mLevel, entry.mRegion, "%s" OPENTHREAD_CONFIG_LOG_SUFFIX, entry.mString);
+        sLogRingStart = static_cast<uint16_t>((sLogRingStart + 1) % OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE);
+        sLogRingLength--;
+    }
+}
+#endif // OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+
 #if OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_CRIT
 void _otLogCrit(otLogRegion aRegion, const char *aFormat, ...)
 {
@@ -51,6 +51,10 @@
 #error "OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE is strongly discouraged when OPENTHREAD_CONFIG_DTLS_ENABLE is off."
 #endif
 
+#if OPENTHREAD_CONFIG_NUM_RESERVED_BUFFERS_FOR_NET_PRIORITY >= OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#error "OPENTHREAD_CONFIG_NUM_RESERVED_BUFFERS_FOR_NET_PRIORITY must be less than OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS."
+#endif
+
 namespace ot {
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -60,11 +64,19 @@ MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     , mNumFreeBuffers(kNumBuffers)
+    , mMaxAllocated{0}
 #endif
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    memset(mSharedChains, 0, sizeof(mSharedChains));
+#endif
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && \
+    !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    mBufferPool.SetName("MsgBuffer");
+#endif
 }
 
 Message *MessagePool::New(Message::Type aType, uint16_t aReserveHeader, Message::Priority aPriority)
@@ -109,6 +121,23 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(aMessage->Next() == nullptr && aMessage->Prev() == nullptr);
 
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    if (aMessage->IsTailShared())
+    {
+        SharedChain *chain = FindSharedChain(aMessage->GetNextBuffer());
+
+        OT_ASSERT(chain != nullptr);
+
+        aMessage->SetNextBuffer(nullptr);
+
+        if (--chain->mRefCount == 0)
+        {
+            FreeBuffers(chain->mTail);
+            chain->mTail = nullptr;
+        }
+    }
+#endif
+
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
@@ -122,7 +151,7 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
                buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()))
 #else
-               buffer = mBufferPool.Allocate()
+               buffer = CanAllocate(aPriority) ? mBufferPool.Allocate() : nullptr
 #endif
                    ) == nullptr)
     {
@@ -131,6 +160,11 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     mNumFreeBuffers--;
+
+    if (kNumBuffers - mNumFreeBuffers > mMaxAllocated[aPriority])
+    {
+        mMaxAllocated[aPriority] = kNumBuffers - mNumFreeBuffers;
+    }
 #endif
 
     buffer->SetNextBuffer(nullptr);
@@ -166,6 +200,39 @@ Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
     return Get<MeshForwarder>().EvictMessage(aPriority);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+
+MessagePool::SharedChain *MessagePool::FindSharedChain(const Buffer *aTail)
+{
+    SharedChain *chain = nullptr;
+
+    for (SharedChain &entry : mSharedChains)
+    {
+        if (entry.mTail == aTail)
+        {
+            chain = &entry;
+            break;
+        }
+    }
+
+    return chain;
+}
+
+MessagePool::SharedChain *MessagePool::NewSharedChain(Buffer *aTail)
+{
+    SharedChain *chain = FindSharedChain(nullptr);
+
+    if (chain != nullptr)
+    {
+        chain->mTail     = aTail;
+        chain->mRefCount = 1;
+    }
+
+    return chain;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -190,6 +257,29 @@ uint16_t MessagePool::GetTotalBufferCount(void) const
 #endif
 }
 
+uint16_t MessagePool::GetMaxUsedBufferCount(void) const
+{
+    uint16_t rval = 0;
+
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        rval = OT_MAX(rval, GetMaxUsedBufferCount(static_cast<Message::Priority>(priority)));
+    }
+
+    return rval;
+}
+
+uint16_t MessagePool::GetMaxUsedBufferCount(Message::Priority aPriority) const
+{
+#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    return mMaxAllocated[aPriority];
+#else
+    OT_UNUSED_VARIABLE(aPriority);
+
+    return 0;
+#endif
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Message::Settings
 
@@ -219,6 +309,10 @@ Error Message::ResizeMessage(uint16_t aLength)
     Buffer * lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
 
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    SuccessOrExit(error = EnsureTailExclusive());
+#endif
+
     while (curLength < aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
@@ -243,6 +337,9 @@ exit:
 
 void Message::Free(void)
 {
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    ReleaseExternalData();
+#endif
     GetMessagePool()->Free(this);
 }
 
@@ -275,6 +372,9 @@ Error Message::SetLength(uint16_t aLength)
     Error    error              = kErrorNone;
     uint16_t totalLengthRequest = GetReserved() + aLength;
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    VerifyOrExit(GetMetadata().mExternalData == nullptr, error = kErrorInvalidState);
+#endif
     VerifyOrExit(totalLengthRequest >= GetReserved(), error = kErrorInvalidArgs);
 
     SuccessOrExit(error = ResizeMessage(totalLengthRequest));
@@ -402,6 +502,10 @@ Error Message::AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset,
     Error    error       = kErrorNone;
     uint16_t writeOffset = GetLength();
     Chunk    chunk;
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    uint16_t requested  = aLength;
+    uint16_t writeStart = writeOffset;
+#endif
 
     VerifyOrExit(aMessage.GetLength() >= aOffset + aLength, error = kErrorParse);
     SuccessOrExit(error = SetLength(GetLength() + aLength));
@@ -415,15 +519,103 @@ Error Message::AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset,
         aMessage.GetNextChunk(aLength, chunk);
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    // Serve any remainder of the requested range from the external
+    // data tail of `aMessage` (not covered by the chunk walk).
+
+    if ((writeOffset - writeStart) < requested)
+    {
+        const uint8_t *extData  = nullptr;
+        uint16_t       consumed = writeOffset - writeStart;
+        uint16_t       extLength;
+
+        extLength = aMessage.GetExternalChunk(aOffset + consumed, requested - consumed, extData);
+        VerifyOrExit(extLength == requested - consumed, error = kErrorParse);
+        WriteBytes(writeOffset, extData, extLength);
+    }
+#endif
+
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+
+Error Message::AppendExternalData(const uint8_t *aData,
+                                  uint16_t       aLength,
+                                  otMessageExternalDataCallback aCallback,
+                                  void *                        aContext)
+{
+    Error     error    = kErrorNone;
+    Metadata &metadata = GetMetadata();
+
+    VerifyOrExit((aData != nullptr) && (aLength != 0), error = kErrorInvalidArgs);
+    VerifyOrExit(metadata.mExternalData == nullptr, error = kErrorInvalidState);
+
+    metadata.mExternalData     = aData;
+    metadata.mExternalLength   = aLength;
+    metadata.mExternalCallback = aCallback;
+    metadata.mExternalContext  = aContext;
+
+exit:
+    return error;
+}
+
+uint16_t Message::GetExternalChunk(uint16_t aOffset, uint16_t aLength, const uint8_t *&aData) const
+{
+    // This method maps a message offset range to the external data
+    // tail (the range following the buffered bytes). On exit `aData`
+    // points to the start of the range within the external data and
+    // the returned length gives the number of available bytes in it
+    // (clamped to `aLength`), or zero if the range does not overlap
+    // the external data.
+
+    const Metadata &metadata = GetMetadata();
+    uint16_t        length   = 0;
+
+    VerifyOrExit(aOffset >= metadata.mLength);
+    aOffset -= metadata.mLength;
+    VerifyOrExit(aOffset < metadata.mExternalLength);
+
+    aData  = metadata.mExternalData + aOffset;
+    length = metadata.mExternalLength - aOffset;
+
+    if (length > aLength)
+    {
+        length = aLength;
+    }
+
+exit:
+    return length;
+}
+
+void Message::ReleaseExternalData(void)
+{
+    Metadata &metadata = GetMetadata();
+
+    if (metadata.mExternalData != nullptr)
+    {
+        if (metadata.mExternalCallback != nullptr)
+        {
+            metadata.mExternalCallback(metadata.mExternalData, metadata.mExternalContext);
+        }
+
+        metadata.mExternalData   = nullptr;
+        metadata.mExternalLength = 0;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+
 Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 {
     Error   error     = kErrorNone;
     Buffer *newBuffer = nullptr;
 
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    SuccessOrExit(error = EnsureTailExclusive());
+#endif
+
     while (aLength > GetReserved())
     {
         VerifyOrExit((newBuffer = GetMessagePool()->NewBuffer(GetPriority())) != nullptr, error = kErrorNoBufs);
@@ -478,13 +670,14 @@ void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
     // `aChunk` is updated such that `aChunk.GetData()` gives the
     // pointer to the start of chunk and `aChunk.GetLength()` gives
     // its length. The `aLength` is also decreased by the chunk
-    // length.
+    // length. Chunks cover the buffered bytes only; any external
+    // data tail is not included.
 
-    VerifyOrExit(aOffset < GetLength(), aChunk.mLength = 0);
+    VerifyOrExit(aOffset < GetMetadata().mLength, aChunk.mLength = 0);
 
-    if (aOffset + aLength >= GetLength())
+    if (aOffset + aLength >= GetMetadata().mLength)
     {
-        aLength = GetLength() - aOffset;
+        aLength = GetMetadata().mLength - aOffset;
     }
 
     aOffset += GetReserved();
@@ -559,6 +752,9 @@ uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) cons
 {
     uint8_t *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
     Chunk    chunk;
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    uint16_t requested = aLength;
+#endif
 
     GetFirstChunk(aOffset, aLength, chunk);
 
@@ -569,6 +765,20 @@ uint16_t Message::ReadBytes(uint16_t aOffset, void *aBuf, uint16_t aLength) cons
         GetNextChunk(aLength, chunk);
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    {
+        const uint8_t *extData   = nullptr;
+        uint16_t       bytesRead = static_cast<uint16_t>(bufPtr - reinterpret_cast<uint8_t *>(aBuf));
+        uint16_t       extLength = GetExternalChunk(aOffset + bytesRead, requested - bytesRead, extData);
+
+        if (extLength > 0)
+        {
+            memcpy(bufPtr, extData, extLength);
+            bufPtr += extLength;
+        }
+    }
+#endif
+
     return static_cast<uint16_t>(bufPtr - reinterpret_cast<uint8_t *>(aBuf));
 }
 
@@ -593,6 +803,18 @@ bool Message::CompareBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
         GetNextChunk(aLength, chunk);
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    if (bytesToCompare > 0)
+    {
+        const uint8_t *extData = nullptr;
+        uint16_t       offset  = aOffset + static_cast<uint16_t>(bufPtr - reinterpret_cast<const uint8_t *>(aBuf));
+
+        VerifyOrExit(GetExternalChunk(offset, bytesToCompare, extData) == bytesToCompare);
+        VerifyOrExit(memcmp(bufPtr, extData, bytesToCompare) == 0);
+        bytesToCompare = 0;
+    }
+#endif
+
 exit:
     return (bytesToCompare == 0);
 }
@@ -604,6 +826,9 @@ bool Message::CompareBytes(uint16_t       aOffset,
 {
     uint16_t bytesToCompare = aLength;
     Chunk    chunk;
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    uint16_t requested = aLength;
+#endif
 
     GetFirstChunk(aOffset, aLength, chunk);
 
@@ -615,6 +840,18 @@ bool Message::CompareBytes(uint16_t       aOffset,
         GetNextChunk(aLength, chunk);
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    if (bytesToCompare > 0)
+    {
+        const uint8_t *extData = nullptr;
+        uint16_t       offset  = aOffset + (requested - bytesToCompare);
+
+        VerifyOrExit(GetExternalChunk(offset, bytesToCompare, extData) == bytesToCompare);
+        VerifyOrExit(aOtherMessage.CompareBytes(aOtherOffset, extData, bytesToCompare));
+        bytesToCompare = 0;
+    }
+#endif
+
 exit:
     return (bytesToCompare == 0);
 }
@@ -640,6 +877,9 @@ uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, ui
 {
     uint16_t bytesCopied = 0;
     Chunk    chunk;
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    uint16_t requested = aLength;
+#endif
 
     // This implementing can potentially overwrite the data when bytes are
     // being copied forward within the same message, i.e., source and
@@ -658,15 +898,183 @@ uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, ui
         GetNextChunk(aLength, chunk);
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    if (bytesCopied < requested)
+    {
+        const uint8_t *extData   = nullptr;
+        uint16_t       extLength = GetExternalChunk(aSourceOffset + bytesCopied, requested - bytesCopied, extData);
+
+        if (extLength > 0)
+        {
+            aMessage.WriteBytes(aDestinationOffset, extData, extLength);
+            bytesCopied += extLength;
+        }
+    }
+#endif
+
     return bytesCopied;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+
+Message *Message::TryCloneShared(uint16_t aLength) const
+{
+    Message *                 messageCopy = nullptr;
+    Message *                 self        = AsNonConst(this);
+    Buffer *                  tail;
+    MessagePool::SharedChain *chain;
+
+    // Sharing requires the copied content to extend into the tail
+    // buffers (otherwise the head buffer copy already covers it).
+    VerifyOrExit(aLength <= GetLength());
+    VerifyOrExit((tail = self->GetNextBuffer()) != nullptr);
+    VerifyOrExit(static_cast<uint32_t>(GetReserved()) + aLength > kHeadBufferDataSize);
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    VerifyOrExit(GetMetadata().mExternalData == nullptr);
+#endif
+
+    chain = GetMessagePool()->FindSharedChain(tail);
+
+    if (chain == nullptr)
+    {
+        VerifyOrExit((chain = GetMessagePool()->NewSharedChain(tail)) != nullptr);
+        self->GetMetadata().mTailShared = true;
+    }
+
+    VerifyOrExit((messageCopy = static_cast<Message *>(GetMessagePool()->NewBuffer(GetPriority()))) != nullptr);
+
+    memcpy(static_cast<Buffer *>(messageCopy)->GetData(), static_cast<const Buffer *>(self)->GetData(),
+           kBufferDataSize);
+    messageCopy->SetNextBuffer(tail);
+    chain->mRefCount++;
+
+    // The cloned message inherits the full metadata. Clear the fields
+    // tied to the original message's queuing and scheduling state.
+    messageCopy->GetMetadata().mNext        = nullptr;
+    messageCopy->GetMetadata().mPrev        = nullptr;
+    messageCopy->GetMetadata().mQueue       = nullptr;
+    messageCopy->GetMetadata().mInPriorityQ = false;
+    messageCopy->GetMetadata().mDatagramTag = 0;
+    messageCopy->GetMetadata().mDirectTx    = false;
+    messageCopy->GetMetadata().mTxSuccess   = false;
+    messageCopy->GetMetadata().mDoNotEvict  = false;
+    messageCopy->GetMetadata().mTailShared  = true;
+    messageCopy->GetMetadata().mChildMask.Clear();
+    messageCopy->GetMetadata().mLength = aLength;
+
+    if (messageCopy->GetOffset() > aLength)
+    {
+        messageCopy->SetOffset(aLength);
+    }
+
+exit:
+    return messageCopy;
+}
+
+Error Message::EnsureTailExclusive(void)
+{
+    Error                     error   = kErrorNone;
+    Buffer *                  newTail = nullptr;
+    Buffer *                  newLast = nullptr;
+    Buffer *                  sharedTail;
+    MessagePool::SharedChain *chain;
+    uint16_t                  remaining;
+
+    VerifyOrExit(IsTailShared());
+
+    sharedTail = GetNextBuffer();
+    chain      = GetMessagePool()->FindSharedChain(sharedTail);
+
+    OT_ASSERT(chain != nullptr);
+
+    if (chain->mRefCount == 1)
+    {
+        // This message is the only remaining holder and claims the
+        // chain as its private tail.
+        chain->mTail              = nullptr;
+        GetMetadata().mTailShared = false;
+        ExitNow();
+    }
+
+    remaining = GetReserved() + GetMetadata().mLength;
+    remaining = (remaining > kHeadBufferDataSize) ? remaining - kHeadBufferDataSize : 0;
+
+    for (Buffer *buffer = sharedTail; (buffer != nullptr) && (remaining > 0); buffer = buffer->GetNextBuffer())
+    {
+        Buffer *bufferCopy = GetMessagePool()->NewBuffer(GetPriority());
+
+        VerifyOrExit(bufferCopy != nullptr, error = kErrorNoBufs);
+
+        memcpy(bufferCopy->GetData(), buffer->GetData(), kBufferDataSize);
+
+        if (newLast == nullptr)
+        {
+            newTail = bufferCopy;
+        }
+        else
+        {
+            newLast->SetNextBuffer(bufferCopy);
+        }
+
+        newLast   = bufferCopy;
+        remaining = (remaining > kBufferDataSize) ? remaining - kBufferDataSize : 0;
+    }
+
+    SetNextBuffer(newTail);
+    newTail                   = nullptr;
+    GetMetadata().mTailShared = false;
+
+    if (--chain->mRefCount == 0)
+    {
+        GetMessagePool()->FreeBuffers(sharedTail);
+        chain->mTail = nullptr;
+    }
+
+exit:
+    if (newTail != nullptr)
+    {
+        GetMessagePool()->FreeBuffers(newTail);
+    }
+
+    return error;
+}
+
+void Message::PrepareTailForWrite(uint16_t aOffset, uint16_t aLength)
+{
+    Error error;
+
+    VerifyOrExit(IsTailShared());
+    VerifyOrExit(static_cast<uint32_t>(GetReserved()) + aOffset + aLength > kHeadBufferDataSize);
+
+    // Writable chunk users (e.g., `WriteBytes()`) cannot propagate an
+    // error, so failing to make a private copy of the shared tail
+    // (possible only when the pool is fully exhausted even after
+    // evicting lower priority messages) cannot be handled and asserts.
+    error = EnsureTailExclusive();
+    OT_ASSERT(error == kErrorNone);
+    OT_UNUSED_VARIABLE(error);
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+
 Message *Message::Clone(uint16_t aLength) const
 {
     Error    error = kErrorNone;
     Message *messageCopy;
     uint16_t offset;
 
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    messageCopy = TryCloneShared(aLength);
+
+    if (messageCopy != nullptr)
+    {
+        ExitNow();
+    }
+#endif
+
     VerifyOrExit((messageCopy = GetMessagePool()->New(GetType(), GetReserved(), GetPriority())) != nullptr,
                  error = kErrorNoBufs);
     SuccessOrExit(error = messageCopy->SetLength(aLength));
@@ -758,12 +1166,19 @@ Message *MessageQueue::GetHead(void) const
     return (GetTail() == nullptr) ? nullptr : GetTail()->Next();
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+void Message::SetQueueTimeToNow(void) { GetMetadata().mQueueTime = TimerMilli::GetNow().GetValue(); }
+#endif
+
 void MessageQueue::Enqueue(Message &aMessage, QueuePosition aPosition)
 {
     OT_ASSERT(!aMessage.IsInAQueue());
     OT_ASSERT((aMessage.Next() == nullptr) && (aMessage.Prev() == nullptr));
 
     aMessage.SetMessageQueue(this);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+    aMessage.SetQueueTimeToNow();
+#endif
 
     if (GetTail() == nullptr)
     {
@@ -850,6 +1265,16 @@ PriorityQueue::PriorityQueue(void)
     {
         tail = nullptr;
     }
+
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+    for (uint8_t priority = 0; priority < Message::kPriorityNet; priority++)
+    {
+        mQuantums[priority] = 0;
+        mDeficits[priority] = 0;
+    }
+
+    mDrrPriority = Message::kPriorityHigh;
+#endif
 }
 
 Message *PriorityQueue::FindFirstNonNullTail(Message::Priority aStartPriorityLevel) const
@@ -912,6 +1337,105 @@ Message *PriorityQueue::GetTail(void) const
     return FindFirstNonNullTail(Message::kPriorityLow);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+
+Message *PriorityQueue::GetSchedulerHead(void)
+{
+    Message *message     = nullptr;
+    bool     hasBudgeted = false;
+
+    // Network control traffic and priority levels with a zero quantum
+    // are served in strict priority order ahead of any budgeted level.
+
+    message = GetHeadForPriority(Message::kPriorityNet);
+    VerifyOrExit(message == nullptr);
+
+    for (uint8_t priority = Message::kPriorityHigh;; priority--)
+    {
+        if (mQuantums[priority] == 0)
+        {
+            message = GetHeadForPriority(static_cast<Message::Priority>(priority));
+            VerifyOrExit(message == nullptr);
+        }
+        else if (GetHeadForPriority(static_cast<Message::Priority>(priority)) != nullptr)
+        {
+            hasBudgeted = true;
+        }
+
+        if (priority == Message::kPriorityLow)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(hasBudgeted);
+
+    // Deficit round robin among the budgeted levels: a level earns its
+    // quantum each time the round visits it and is served once its
+    // accumulated deficit covers the head message length. The loop is
+    // guaranteed to terminate since at least one budgeted level is
+    // non-empty and the deficit grant condition is relaxed at
+    // `kMaxDeficit`.
+
+    while (true)
+    {
+        Message::Priority priority = static_cast<Message::Priority>(mDrrPriority);
+
+        if (mQuantums[priority] != 0)
+        {
+            Message *head = GetHeadForPriority(priority);
+
+            if (head == nullptr)
+            {
+                mDeficits[priority] = 0;
+            }
+            else if ((mDeficits[priority] >= head->GetLength()) || (mDeficits[priority] >= kMaxDeficit))
+            {
+                ExitNow(message = head);
+            }
+            else
+            {
+                mDeficits[priority] = OT_MIN(mDeficits[priority] + mQuantums[priority], kMaxDeficit);
+            }
+        }
+
+        mDrrPriority = (mDrrPriority == 0) ? (Message::kPriorityNet - 1) : (mDrrPriority - 1);
+    }
+
+exit:
+    return message;
+}
+
+Error PriorityQueue::SetQuantum(Message::Priority aPriority, uint16_t aQuantum)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aPriority < Message::kPriorityNet, error = kErrorInvalidArgs);
+
+    mQuantums[aPriority] = aQuantum;
+    mDeficits[aPriority] = 0;
+
+exit:
+    return error;
+}
+
+void PriorityQueue::ChargeDeficit(const Message &aMessage)
+{
+    if (aMessage.GetPriority() < Message::kPriorityNet)
+    {
+        int32_t &deficit = mDeficits[aMessage.GetPriority()];
+
+        deficit -= aMessage.GetLength();
+
+        if (deficit < 0)
+        {
+            deficit = 0;
+        }
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+
 void PriorityQueue::Enqueue(Message &aMessage)
 {
     Message::Priority priority;
@@ -921,6 +1445,9 @@ void PriorityQueue::Enqueue(Message &aMessage)
     OT_ASSERT(!aMessage.IsInAQueue());
 
     aMessage.SetPriorityQueue(this);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+    aMessage.SetQueueTimeToNow();
+#endif
 
     priority = aMessage.GetPriority();
 
@@ -973,6 +1500,10 @@ void PriorityQueue::Dequeue(Message &aMessage)
     aMessage.Prev()         = nullptr;
 
     aMessage.SetPriorityQueue(nullptr);
+
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+    ChargeDeficit(aMessage);
+#endif
 }
 
 void PriorityQueue::DequeueAndFree(Message &aMessage)
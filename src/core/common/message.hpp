@@ -48,6 +48,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/pool.hpp"
+#include "common/time.hpp"
 #include "common/type_traits.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/child_mask.hpp"
@@ -192,11 +193,20 @@ protected:
         uint16_t     mPanId;       // PAN ID (used for MLE Discover Request and Response).
         uint8_t      mChannel;     // The message channel (used for MLE Announce).
         uint8_t      mTimeout;     // Seconds remaining before dropping the message.
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+        uint32_t mQueueTime; // Time (`TimerMilli` value) the message was last enqueued.
+#endif
         RssAverager  mRssAverager; // The averager maintaining the received signal strength (RSS) average.
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
         LqiAverager mLqiAverager; // The averager maintaining the Link quality indicator (LQI) average.
 #endif
         ChildMask mChildMask; // ChildMask to indicate which sleepy children need to receive this.
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+        const uint8_t *               mExternalData;     // External (caller-owned) data tail (`nullptr` if none).
+        uint16_t                      mExternalLength;   // Number of external data bytes.
+        otMessageExternalDataCallback mExternalCallback; // Callback invoked when external data is released.
+        void *                        mExternalContext;  // Context passed to `mExternalCallback`.
+#endif
 
         uint8_t mType : 3;          // The message type.
         uint8_t mSubType : 4;       // The message sub type.
@@ -206,7 +216,11 @@ protected:
         bool    mInPriorityQ : 1;   // Whether the message is queued in normal or priority queue.
         bool    mTxSuccess : 1;     // Whether the direct tx of the message was successful.
         bool    mDoNotEvict : 1;    // Whether this message may be evicted.
-        bool    mMulticastLoop : 1; // Whether this multicast message may be looped back.
+        bool    mMulticastLoop : 1;    // Whether this multicast message may be looped back.
+        bool    mChecksumVerified : 1; // Whether the transport-layer checksum is already verified.
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+        bool mTailShared : 1; // Whether the tail buffer chain is shared with other messages (copy-on-write).
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
         uint8_t mRadioType : 2;      // The radio link type the message was received on, or should be sent on.
         bool    mIsRadioTypeSet : 1; // Whether the radio type is set.
@@ -253,9 +267,6 @@ static_assert(sizeof(Buffer) >= kBufferSize, "Buffer size if not valid");
  */
 class Message : public otMessage, public Buffer
 {
-    friend class Checksum;
-    friend class Crypto::HmacSha256;
-    friend class Crypto::Sha256;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
@@ -408,22 +419,70 @@ public:
     /**
      * This method returns the number of bytes in the message.
      *
+     * The returned length includes any external data appended with `AppendExternalData()`.
+     *
      * @returns The number of bytes in the message.
      *
      */
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    uint16_t GetLength(void) const { return GetMetadata().mLength + GetMetadata().mExternalLength; }
+#else
     uint16_t GetLength(void) const { return GetMetadata().mLength; }
+#endif
 
     /**
      * This method sets the number of bytes in the message.
      *
      * @param[in]  aLength  Requested number of bytes in the message.
      *
-     * @retval kErrorNone    Successfully set the length of the message.
-     * @retval kErrorNoBufs  Failed to grow the size of the message because insufficient buffers were available.
+     * @retval kErrorNone          Successfully set the length of the message.
+     * @retval kErrorNoBufs        Failed to grow the size of the message because insufficient buffers were available.
+     * @retval kErrorInvalidState  The message has external data appended and cannot be resized.
      *
      */
     Error SetLength(uint16_t aLength);
 
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    /**
+     * This method appends external (caller-owned) data to the message without copying it into message buffers.
+     *
+     * The data is referenced by pointer and must remain valid and unchanged until @p aCallback is invoked (when the
+     * message is freed). The external data always forms the tail of the message: the message must not be lengthened,
+     * shortened, or written to afterwards (prepending headers remains allowed). At most one external data buffer can
+     * be appended to a message.
+     *
+     * @param[in] aData      A pointer to the data to append.
+     * @param[in] aLength    Number of bytes to append.
+     * @param[in] aCallback  A pointer to a function that is called when the data is released (can be `nullptr`).
+     * @param[in] aContext   A pointer to application-specific context passed to @p aCallback.
+     *
+     * @retval kErrorNone          Successfully appended the external data to the message.
+     * @retval kErrorInvalidArgs   @p aData is `nullptr` or @p aLength is zero.
+     * @retval kErrorInvalidState  The message already has external data appended.
+     *
+     */
+    Error AppendExternalData(const uint8_t *aData,
+                             uint16_t       aLength,
+                             otMessageExternalDataCallback aCallback,
+                             void *                        aContext);
+
+    /**
+     * This method returns a pointer to the external data appended to the message (if any).
+     *
+     * @returns A pointer to the external data, or `nullptr` if the message has no external data.
+     *
+     */
+    const uint8_t *GetExternalData(void) const { return GetMetadata().mExternalData; }
+
+    /**
+     * This method returns the number of external data bytes appended to the message.
+     *
+     * @returns The number of external data bytes (zero if the message has no external data).
+     *
+     */
+    uint16_t GetExternalLength(void) const { return GetMetadata().mExternalLength; }
+#endif // OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+
     /**
      * This method returns the number of buffers in the message.
      *
@@ -686,6 +745,115 @@ public:
         return Read(aOffset, &aObject, sizeof(ObjectType));
     }
 
+    /**
+     * This structure represents a chunk of message data, i.e., the portion of the message payload stored in a single
+     * underlying `Buffer` of the message buffer chain.
+     *
+     */
+    struct Chunk
+    {
+        /**
+         * This method returns a pointer to the start of the chunk data.
+         *
+         * @returns A pointer to start of the chunk data.
+         *
+         */
+        const uint8_t *GetData(void) const { return mData; }
+
+        /**
+         * This method returns the length of the chunk (number of bytes).
+         *
+         * @returns The chunk length (in bytes).
+         *
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+        const uint8_t *mData;   // Pointer to start of chunk data buffer.
+        uint16_t       mLength; // Length of chunk data (in bytes).
+        const Buffer * mBuffer; // Buffer containing the chunk
+    };
+
+    /**
+     * This structure represents a writable (non-const) chunk of message data.
+     *
+     */
+    struct WritableChunk : public Chunk
+    {
+        /**
+         * This method returns a pointer to the start of the chunk data.
+         *
+         * @returns A pointer to start of the chunk data.
+         *
+         */
+        uint8_t *GetData(void) const { return AsNonConst(mData); }
+    };
+
+    /**
+     * This method gets the first chunk of message data at a given offset.
+     *
+     * The chunk iterator methods allow message payload to be processed in place, chunk by chunk, without copying it
+     * out of the buffer chain. Typical usage:
+     *
+     *     aMessage.GetFirstChunk(aOffset, aLength, chunk);
+     *
+     *     while (chunk.GetLength() > 0)
+     *     {
+     *         // Process `chunk.GetLength()` bytes at `chunk.GetData()`.
+     *         aMessage.GetNextChunk(aLength, chunk);
+     *     }
+     *
+     * @param[in]    aOffset  The offset in the message to start from.
+     * @param[inout] aLength  On input, the max number of bytes to cover. On exit, the remaining length (after the
+     *                        returned chunk).
+     * @param[out]   aChunk   A reference to a `Chunk` to output the first chunk (its length is set to zero if there
+     *                        are no remaining bytes).
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the next chunk of message data (following an earlier `GetFirstChunk()` call).
+     *
+     * @param[inout] aLength  On input, the remaining length from the previous call. On exit, the remaining length
+     *                        (after the returned chunk).
+     * @param[inout] aChunk   On input, the previous chunk. On exit, the next chunk (its length is set to zero if
+     *                        there are no remaining bytes).
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the first writable chunk of message data at a given offset.
+     *
+     * @param[in]    aOffset  The offset in the message to start from.
+     * @param[inout] aLength  On input, the max number of bytes to cover. On exit, the remaining length (after the
+     *                        returned chunk).
+     * @param[out]   aChunk   A reference to a `WritableChunk` to output the first chunk (its length is set to zero
+     *                        if there are no remaining bytes).
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
+    {
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+        PrepareTailForWrite(aOffset, aLength);
+#endif
+        AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
+    }
+
+    /**
+     * This method gets the next writable chunk of message data (following an earlier `GetFirstChunk()` call).
+     *
+     * @param[inout] aLength  On input, the remaining length from the previous call. On exit, the remaining length
+     *                        (after the returned chunk).
+     * @param[inout] aChunk   On input, the previous chunk. On exit, the next chunk (its length is set to zero if
+     *                        there are no remaining bytes).
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, WritableChunk &aChunk)
+    {
+        AsConst(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
+    }
+
     /**
      * This method compares the bytes in the message at a given offset with a given byte array.
      *
@@ -796,6 +964,11 @@ public:
      * of the payload. The `Type`, `SubType`, `LinkSecurity`, `Offset`, `InterfaceId`, and `Priority` fields on the
      * cloned message are also copied from the original one.
      *
+     * When `OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE` is enabled, the cloned message may share the tail buffer
+     * chain with the original (copy-on-write), in which case only the head buffer is allocated and the cloned
+     * message inherits the full metadata of the original. A private copy of the shared tail is made lazily when
+     * either message is about to be modified.
+     *
      * @param[in] aLength  Number of payload bytes to copy.
      *
      * @returns A pointer to the message or nullptr if insufficient message buffers are available.
@@ -959,6 +1132,22 @@ public:
      */
     bool GetDirectTransmission(void) const { return GetMetadata().mDirectTx; }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+    /**
+     * This method returns the time the message was last enqueued.
+     *
+     * @returns The `TimerMilli` time the message was last enqueued.
+     *
+     */
+    TimeMilli GetQueueTime(void) const { return TimeMilli(GetMetadata().mQueueTime); }
+
+    /**
+     * This method records the current time as the message's enqueue time.
+     *
+     */
+    void SetQueueTimeToNow(void);
+#endif
+
     /**
      * This method unschedules forwarding using direct transmission.
      *
@@ -1023,6 +1212,24 @@ public:
      */
     void SetLinkSecurityEnabled(bool aEnabled) { GetMetadata().mLinkSecurity = aEnabled; }
 
+    /**
+     * This method indicates whether the transport-layer checksum of the message is already verified.
+     *
+     * @retval TRUE   If the checksum is already verified.
+     * @retval FALSE  If the checksum is not already verified.
+     *
+     */
+    bool IsChecksumVerified(void) const { return GetMetadata().mChecksumVerified; }
+
+    /**
+     * This method sets whether the transport-layer checksum of the message is already verified (e.g., by the host
+     * network stack), allowing checksum verification to be skipped when the message is received.
+     *
+     * @param[in]  aVerified  TRUE if the checksum is already verified, FALSE otherwise.
+     *
+     */
+    void SetChecksumVerified(bool aVerified) { GetMetadata().mChecksumVerified = aVerified; }
+
     /**
      * This method updates the average RSS (Received Signal Strength) associated with the message by adding the given
      * RSS value to the average. Note that a message can be composed of multiple 802.15.4 data frame fragments each
@@ -1208,34 +1415,6 @@ protected:
     void     SetReserved(uint16_t aReservedHeader) { GetMetadata().mReserved = aReservedHeader; }
 
 private:
-    struct Chunk
-    {
-        const uint8_t *GetData(void) const { return mData; }
-        uint16_t       GetLength(void) const { return mLength; }
-
-        const uint8_t *mData;   // Pointer to start of chunk data buffer.
-        uint16_t       mLength; // Length of chunk data (in bytes).
-        const Buffer * mBuffer; // Buffer containing the chunk
-    };
-
-    struct WritableChunk : public Chunk
-    {
-        uint8_t *GetData(void) const { return AsNonConst(mData); }
-    };
-
-    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &chunk) const;
-    void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
-
-    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
-    {
-        AsConst(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
-    }
-
-    void GetNextChunk(uint16_t &aLength, WritableChunk &aChunk)
-    {
-        AsConst(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
-    }
-
     MessagePool *GetMessagePool(void) const { return GetMetadata().mMessagePool; }
     void         SetMessagePool(MessagePool *aMessagePool) { GetMetadata().mMessagePool = aMessagePool; }
 
@@ -1248,6 +1427,18 @@ private:
     Message *&      Prev(void) { return GetMetadata().mPrev; }
 
     Error ResizeMessage(uint16_t aLength);
+
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    bool     IsTailShared(void) const { return GetMetadata().mTailShared; }
+    Message *TryCloneShared(uint16_t aLength) const;
+    Error    EnsureTailExclusive(void);
+    void     PrepareTailForWrite(uint16_t aOffset, uint16_t aLength);
+#endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    uint16_t GetExternalChunk(uint16_t aOffset, uint16_t aLength, const uint8_t *&aData) const;
+    void     ReleaseExternalData(void);
+#endif
 };
 
 /**
@@ -1374,6 +1565,51 @@ public:
      */
     Message *GetHeadForPriority(Message::Priority aPriority) const;
 
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+    /**
+     * This method returns the message that the deficit round robin scheduler selects to be served next.
+     *
+     * Network control traffic and priority levels with a zero quantum are served in strict priority order ahead of
+     * any budgeted level. Among levels with a non-zero quantum, each level earns its quantum (in bytes) whenever the
+     * round robin visits it and is served while its accumulated deficit covers the length of its head message.
+     *
+     * This method updates the scheduler state (deficit counters and round position) and therefore is intended to be
+     * called once per transmit scheduling decision.
+     *
+     * @returns A pointer to the selected message, or `nullptr` if the queue is empty.
+     *
+     */
+    Message *GetSchedulerHead(void);
+
+    /**
+     * This method sets the deficit round robin byte quantum for a priority level.
+     *
+     * A quantum of zero (the default) excludes the level from round robin scheduling, keeping strict priority order
+     * for it. Setting the quantum resets the level's accumulated deficit.
+     *
+     * @param[in] aPriority  A priority level (must not be `Message::kPriorityNet`).
+     * @param[in] aQuantum   The byte quantum the level earns on each scheduler round.
+     *
+     * @retval kErrorNone         Successfully set the quantum.
+     * @retval kErrorInvalidArgs  @p aPriority is the network control priority level (which is always strict).
+     *
+     */
+    Error SetQuantum(Message::Priority aPriority, uint16_t aQuantum);
+
+    /**
+     * This method gets the deficit round robin byte quantum for a priority level.
+     *
+     * @param[in] aPriority  A priority level.
+     *
+     * @returns The byte quantum for @p aPriority (zero if the level is not budgeted).
+     *
+     */
+    uint16_t GetQuantum(Message::Priority aPriority) const
+    {
+        return (aPriority < Message::kPriorityNet) ? mQuantums[aPriority] : 0;
+    }
+#endif // OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+
     /**
      * This method adds a message to the queue.
      *
@@ -1429,7 +1665,22 @@ private:
 
     Message *FindFirstNonNullTail(Message::Priority aStartPriorityLevel) const;
 
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+    // Upper bound on the accumulated per-level deficit (in bytes). Caps
+    // the budget a level can bank while it is not being served and
+    // bounds the scheduler's replenish loop.
+    static constexpr int32_t kMaxDeficit = 8192;
+
+    void ChargeDeficit(const Message &aMessage);
+#endif
+
     Message *mTails[Message::kNumPriorities]; // Tail pointers associated with different priority levels.
+
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+    uint16_t mQuantums[Message::kPriorityNet]; // Byte quantum per level (zero keeps the level strict).
+    int32_t  mDeficits[Message::kPriorityNet]; // Accumulated unspent budget per level (in bytes).
+    uint8_t  mDrrPriority;                     // The priority level the round robin visits next.
+#endif
 };
 
 /**
@@ -1501,15 +1752,65 @@ public:
      */
     uint16_t GetTotalBufferCount(void) const;
 
+    /**
+     * This method returns the maximum number of buffers in use at the same time since stack initialization.
+     *
+     * The tracking is available only when the internal message buffer pool is used. Otherwise (heap or
+     * platform-managed buffers) this method returns zero.
+     *
+     * @returns The maximum number of buffers in use at the same time so far.
+     *
+     */
+    uint16_t GetMaxUsedBufferCount(void) const;
+
+    /**
+     * This method returns the maximum number of buffers in use at the same time as observed while allocating
+     * buffers at a given priority level.
+     *
+     * This provides a per-priority breakdown of buffer pool pressure, i.e., how full the pool was when messages of
+     * each priority level were being allocated.
+     *
+     * @param[in] aPriority   The message priority level.
+     *
+     * @returns The maximum number of in-use buffers observed on allocations at priority @p aPriority.
+     *
+     */
+    uint16_t GetMaxUsedBufferCount(Message::Priority aPriority) const;
+
 private:
+    static constexpr uint16_t kNumReservedNetBuffers = OPENTHREAD_CONFIG_NUM_RESERVED_BUFFERS_FOR_NET_PRIORITY;
+
     Buffer *NewBuffer(Message::Priority aPriority);
     void    FreeBuffers(Buffer *aBuffer);
     Error   ReclaimBuffers(Message::Priority aPriority);
 
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    struct SharedChain
+    {
+        Buffer * mTail;     // First buffer of the shared tail chain (`nullptr` when entry is unused).
+        uint16_t mRefCount; // Number of messages currently referencing the chain.
+    };
+
+    static constexpr uint16_t kMaxSharedChains = OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_MAX_CHAINS;
+
+    SharedChain *FindSharedChain(const Buffer *aTail);
+    SharedChain *NewSharedChain(Buffer *aTail);
+#endif
+
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    bool CanAllocate(Message::Priority aPriority) const
+    {
+        return (aPriority == Message::kPriorityNet) || (mNumFreeBuffers > kNumReservedNetBuffers);
+    }
+
     uint16_t                  mNumFreeBuffers;
+    uint16_t                  mMaxAllocated[Message::kNumPriorities];
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
+
+#if OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+    SharedChain mSharedChains[kMaxSharedChains];
+#endif
 };
 
 /**
@@ -44,15 +44,26 @@ namespace ot {
 Notifier::Notifier(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTask(aInstance, Notifier::EmitEvents)
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    , mNumEmits(0)
+#endif
 {
     for (ExternalCallback &callback : mExternalCallbacks)
     {
-        callback.mHandler = nullptr;
-        callback.mContext = nullptr;
+        callback.mHandler   = nullptr;
+        callback.mContext   = nullptr;
+        callback.mEventMask = 0;
+    }
+
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    for (uint32_t &count : mSignalCounts)
+    {
+        count = 0;
     }
+#endif
 }
 
-Error Notifier::RegisterCallback(otStateChangedCallback aCallback, void *aContext)
+Error Notifier::RegisterCallback(otStateChangedCallback aCallback, void *aContext, Events::Flags aEventMask)
 {
     Error             error          = kErrorNone;
     ExternalCallback *unusedCallback = nullptr;
@@ -76,8 +87,9 @@ Error Notifier::RegisterCallback(otStateChangedCallback aCallback, void *aContex
 
     VerifyOrExit(unusedCallback != nullptr, error = kErrorNoBufs);
 
-    unusedCallback->mHandler = aCallback;
-    unusedCallback->mContext = aContext;
+    unusedCallback->mHandler   = aCallback;
+    unusedCallback->mContext   = aContext;
+    unusedCallback->mEventMask = aEventMask;
 
 exit:
     return error;
@@ -91,8 +103,9 @@ void Notifier::RemoveCallback(otStateChangedCallback aCallback, void *aContext)
     {
         if ((callback.mHandler == aCallback) && (callback.mContext == aContext))
         {
-            callback.mHandler = nullptr;
-            callback.mContext = nullptr;
+            callback.mHandler   = nullptr;
+            callback.mContext   = nullptr;
+            callback.mEventMask = 0;
         }
     }
 
@@ -105,6 +118,17 @@ void Notifier::Signal(Event aEvent)
     mEventsToSignal.Add(aEvent);
     mSignaledEvents.Add(aEvent);
     mTask.Post();
+
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    for (uint8_t bit = 0; bit < kNumEvents; bit++)
+    {
+        if (aEvent == (static_cast<Events::Flags>(1) << bit))
+        {
+            mSignalCounts[bit]++;
+            break;
+        }
+    }
+#endif
 }
 
 void Notifier::SignalIfFirst(Event aEvent)
@@ -132,6 +156,10 @@ void Notifier::EmitEvents(void)
     events = mEventsToSignal;
     mEventsToSignal.Clear();
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    mNumEmits++;
+#endif
+
     LogEvents(events);
 
     // Emit events to core internal modules
@@ -153,6 +181,12 @@ void Notifier::EmitEvents(void)
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE || OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
     Get<NetworkData::Notifier>().HandleNotifierEvents(events);
 #endif
+#if OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+    Get<Lowpan::Lowpan>().HandleNotifierEvents(events);
+#endif
+#if OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+    Get<Ip6::Ip6>().HandleNotifierEvents(events);
+#endif
 #if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
     Get<AnnounceSender>().HandleNotifierEvents(events);
 #endif
@@ -198,7 +232,7 @@ void Notifier::EmitEvents(void)
 
     for (ExternalCallback &callback : mExternalCallbacks)
     {
-        if (callback.mHandler != nullptr)
+        if ((callback.mHandler != nullptr) && events.ContainsAny(callback.mEventMask))
         {
             callback.mHandler(events.GetAsFlags(), callback.mContext);
         }
@@ -208,6 +242,24 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+uint32_t Notifier::GetSignalCount(Event aEvent) const
+{
+    uint32_t count = 0;
+
+    for (uint8_t bit = 0; bit < kNumEvents; bit++)
+    {
+        if (aEvent == (static_cast<Events::Flags>(1) << bit))
+        {
+            count = mSignalCounts[bit];
+            break;
+        }
+    }
+
+    return count;
+}
+#endif // OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+
 // LCOV_EXCL_START
 
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO) && (OPENTHREAD_CONFIG_LOG_CORE == 1)
@@ -284,6 +336,7 @@ const char *Notifier::EventToString(Event aEvent) const
         "JoinerState",       // kEventJoinerStateChanged               (1 << 27)
         "ActDset",           // kEventActiveDatasetChanged             (1 << 28)
         "PndDset",           // kEventPendingDatasetChanged            (1 << 29)
+        "CoexMetrics",       // kEventCoexMetricsCrossedThreshold      (1 << 30)
     };
 
     for (uint8_t index = 0; index < OT_ARRAY_LENGTH(kEventStrings); index++)
@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -95,6 +96,7 @@ enum Event : uint32_t
     kEventJoinerStateChanged               = OT_CHANGED_JOINER_STATE,                 ///< Joiner state changed
     kEventActiveDatasetChanged             = OT_CHANGED_ACTIVE_DATASET,               ///< Active Dataset changed
     kEventPendingDatasetChanged            = OT_CHANGED_PENDING_DATASET,              ///< Pending Dataset changed
+    kEventCoexMetricsCrossedThreshold      = OT_CHANGED_COEX_METRICS,                 ///< Coex metrics threshold
 };
 
 /**
@@ -205,18 +207,27 @@ public:
      */
     explicit Notifier(Instance &aInstance);
 
+    /**
+     * This constant specifies an event mask selecting all events.
+     *
+     */
+    static constexpr Events::Flags kEventMaskAll = ~static_cast<Events::Flags>(0);
+
     /**
      * This method registers an `otStateChangedCallback` handler.
      *
+     * The handler is invoked only when at least one of the emitted events is included in @p aEventMask.
+     *
      * @param[in]  aCallback     A pointer to the handler function that is called to notify of the changes.
      * @param[in]  aContext      A pointer to arbitrary context information.
+     * @param[in]  aEventMask    A bit-field selecting the events of interest (default is all events).
      *
      * @retval kErrorNone     Successfully registered the callback.
      * @retval kErrorAlready  The callback was already registered.
      * @retval kErrorNoBufs   Could not add the callback due to resource constraints.
      *
      */
-    Error RegisterCallback(otStateChangedCallback aCallback, void *aContext);
+    Error RegisterCallback(otStateChangedCallback aCallback, void *aContext, Events::Flags aEventMask = kEventMaskAll);
 
     /**
      * This method removes/unregisters a previously registered `otStateChangedCallback` handler.
@@ -262,6 +273,26 @@ public:
      */
     bool HasSignaled(Event aEvent) const { return mSignaledEvents.Contains(aEvent); }
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    /**
+     * This method returns the number of times events have been emitted (number of `EmitEvents()` dispatches).
+     *
+     * @returns The number of emit dispatches.
+     *
+     */
+    uint32_t GetNumEmits(void) const { return mNumEmits; }
+
+    /**
+     * This method returns the number of times a given event has been signaled.
+     *
+     * @param[in]  aEvent    The event to query.
+     *
+     * @returns The number of times @p aEvent has been signaled.
+     *
+     */
+    uint32_t GetSignalCount(Event aEvent) const;
+#endif
+
     /**
      * This template method updates a variable of a type `Type` with a new value and signals the given event.
      *
@@ -307,10 +338,15 @@ private:
 
     static constexpr uint16_t kFlagsStringBufferSize = kFlagsStringLineLimit + kMaxFlagNameLength;
 
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    static constexpr uint8_t kNumEvents = sizeof(Events::Flags) * CHAR_BIT;
+#endif
+
     struct ExternalCallback
     {
         otStateChangedCallback mHandler;
         void *                 mContext;
+        Events::Flags          mEventMask;
     };
 
     static void EmitEvents(Tasklet &aTasklet);
@@ -323,6 +359,10 @@ private:
     Events           mSignaledEvents;
     Tasklet          mTask;
     ExternalCallback mExternalCallbacks[kMaxExternalHandlers];
+#if OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+    uint32_t mNumEmits;
+    uint32_t mSignalCounts[kNumEvents];
+#endif
 };
 
 /**
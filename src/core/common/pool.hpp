@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/code_utils.hpp"
 #include "common/linked_list.hpp"
 #include "common/non_copyable.hpp"
 
@@ -53,6 +54,161 @@ class Instance;
  *
  */
 
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+/**
+ * This class tracks usage statistics of an object pool and links it into the global pool registry.
+ *
+ * Every `Pool` instance inherits from this class when `OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE` is enabled. The
+ * registry is a global linked list over all constructed pools and can be iterated (e.g., by the `pools` factory
+ * diagnostics command) using `GetFirst()` and `GetNext()`.
+ *
+ */
+class PoolStats : private NonCopyable
+{
+public:
+    /**
+     * This method returns the name (owner tag) of the pool.
+     *
+     * @returns The pool name, or `"-"` if no name was set.
+     *
+     */
+    const char *GetName(void) const { return (mName != nullptr) ? mName : "-"; }
+
+    /**
+     * This method sets the name (owner tag) of the pool.
+     *
+     * @param[in] aName   The pool name (MUST be a C string with static lifetime).
+     *
+     */
+    void SetName(const char *aName) { mName = aName; }
+
+    /**
+     * This method returns the pool size (maximum number of objects in the pool).
+     *
+     * @returns The pool size.
+     *
+     */
+    uint16_t GetPoolSize(void) const { return mPoolSize; }
+
+    /**
+     * This method returns the size (in bytes) of a single pool entry.
+     *
+     * @returns The entry size (in bytes).
+     *
+     */
+    uint16_t GetEntrySize(void) const { return mEntrySize; }
+
+    /**
+     * This method returns the number of currently allocated entries.
+     *
+     * @returns The number of allocated entries.
+     *
+     */
+    uint16_t GetInUse(void) const { return mInUse; }
+
+    /**
+     * This method returns the maximum number of simultaneously allocated entries seen so far.
+     *
+     * @returns The maximum number of allocated entries.
+     *
+     */
+    uint16_t GetMaxInUse(void) const { return mMaxInUse; }
+
+    /**
+     * This method returns the number of allocations that failed due to pool exhaustion.
+     *
+     * @returns The number of failed allocations.
+     *
+     */
+    uint32_t GetNumFailedAllocations(void) const { return mNumFailedAllocations; }
+
+    /**
+     * This method returns the first entry in the global pool registry.
+     *
+     * @returns A pointer to the first registered pool, or nullptr if no pool is registered.
+     *
+     */
+    static const PoolStats *GetFirst(void) { return RegistryHead(); }
+
+    /**
+     * This method returns the next entry in the global pool registry.
+     *
+     * @returns A pointer to the next registered pool, or nullptr if this is the last one.
+     *
+     */
+    const PoolStats *GetNext(void) const { return mNext; }
+
+protected:
+    // Members are defined inline (header-only) so that `Pool` users
+    // outside of the core library (e.g., platform utils) do not require
+    // linking a separate translation unit.
+
+    PoolStats(uint16_t aPoolSize, uint16_t aEntrySize)
+        : mName(nullptr)
+        , mNext(RegistryHead())
+        , mPoolSize(aPoolSize)
+        , mEntrySize(aEntrySize)
+        , mInUse(0)
+        , mMaxInUse(0)
+        , mNumFailedAllocations(0)
+    {
+        RegistryHead() = this;
+    }
+
+    ~PoolStats(void)
+    {
+        PoolStats **prev = &RegistryHead();
+
+        while (*prev != nullptr)
+        {
+            if (*prev == this)
+            {
+                *prev = mNext;
+                break;
+            }
+
+            prev = &(*prev)->mNext;
+        }
+    }
+
+    void RecordAllocate(bool aSuccess)
+    {
+        if (!aSuccess)
+        {
+            mNumFailedAllocations++;
+        }
+        else
+        {
+            mInUse++;
+
+            if (mInUse > mMaxInUse)
+            {
+                mMaxInUse = mInUse;
+            }
+        }
+    }
+
+    void RecordFree(void) { mInUse--; }
+    void RecordFreeAll(void) { mInUse = 0; }
+
+private:
+    static PoolStats *&RegistryHead(void)
+    {
+        static PoolStats *sRegistryHead = nullptr;
+
+        return sRegistryHead;
+    }
+
+    const char *mName;
+    PoolStats * mNext;
+    uint16_t    mPoolSize;
+    uint16_t    mEntrySize;
+    uint16_t    mInUse;
+    uint16_t    mMaxInUse;
+    uint32_t    mNumFailedAllocations;
+};
+#endif // OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+
 /**
  * This template class represents an object pool.
  *
@@ -61,7 +217,13 @@ class Instance;
  * @tparam kPoolSize    Specifies the pool size (maximum number of objects in the pool).
  *
  */
-template <class Type, uint16_t kPoolSize> class Pool : private NonCopyable
+template <class Type, uint16_t kPoolSize>
+class Pool
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+    : public PoolStats
+#else
+    : private NonCopyable
+#endif
 {
 public:
     /**
@@ -69,7 +231,12 @@ public:
      *
      */
     Pool(void)
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+        : PoolStats(kPoolSize, sizeof(Type))
+        , mFreeList()
+#else
         : mFreeList()
+#endif
     {
         for (Type &entry : mPool)
         {
@@ -87,7 +254,12 @@ public:
      *
      */
     explicit Pool(Instance &aInstance)
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+        : PoolStats(kPoolSize, sizeof(Type))
+        , mFreeList()
+#else
         : mFreeList()
+#endif
     {
         for (Type &entry : mPool)
         {
@@ -102,7 +274,18 @@ public:
      * @returns A pointer to the newly allocated object, or nullptr if all entries from the pool are already allocated.
      *
      */
-    Type *Allocate(void) { return mFreeList.Pop(); }
+    Type *Allocate(void)
+    {
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+        Type *entry = mFreeList.Pop();
+
+        RecordAllocate(entry != nullptr);
+
+        return entry;
+#else
+        return mFreeList.Pop();
+#endif
+    }
 
     /**
      * This method frees a previously allocated object.
@@ -113,7 +296,13 @@ public:
      * @param[in]  aEntry   The pool object entry to free.
      *
      */
-    void Free(Type &aEntry) { mFreeList.Push(aEntry); }
+    void Free(Type &aEntry)
+    {
+        mFreeList.Push(aEntry);
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+        RecordFree();
+#endif
+    }
 
     /**
      * This method frees all previously allocated objects.
@@ -127,6 +316,10 @@ public:
         {
             mFreeList.Push(entry);
         }
+
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+        RecordFreeAll();
+#endif
     }
 
     /**
@@ -45,6 +45,11 @@
 #include "common/random.hpp"
 #include "crypto/mbedtls.hpp"
 
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+#include "common/instance.hpp"
+#include "common/locator_getters.hpp"
+#endif
+
 namespace ot {
 
 uint16_t                     RandomManager::sInitCount = 0;
@@ -99,6 +104,34 @@ exit:
     return;
 }
 
+#if !OPENTHREAD_RADIO && OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+void RandomManager::SetUpPersistedSeed(Instance &aInstance)
+{
+    uint8_t  seed[kPersistedSeedSize];
+    uint16_t length = sizeof(seed);
+
+    // Mix the seed sealed during the previous boot into the DRBG as
+    // additional input (NIST SP 800-90A). The DRBG is always seeded
+    // from the entropy source first, so the persisted value only ever
+    // adds entropy and its disclosure does not by itself compromise
+    // the DRBG output.
+
+    if (aInstance.Get<Settings>().ReadDrbgSeed(seed, length) == kErrorNone)
+    {
+        sCtrDrbg.Update(seed, length);
+    }
+
+    sCtrDrbg.SetReseedInterval(OPENTHREAD_CONFIG_RANDOM_DRBG_RESEED_INTERVAL);
+
+    // Seal fresh seed material for the next boot.
+
+    if (Random::Crypto::FillBuffer(seed, sizeof(seed)) == kErrorNone)
+    {
+        IgnoreError(aInstance.Get<Settings>().SaveDrbgSeed(seed, sizeof(seed)));
+    }
+}
+#endif
+
 uint32_t RandomManager::NonCryptoGetUint32(void)
 {
     OT_ASSERT(sInitCount > 0);
@@ -217,6 +250,24 @@ Error RandomManager::CryptoCtrDrbg::FillBuffer(uint8_t *aBuffer, uint16_t aSize)
         mbedtls_ctr_drbg_random(&mCtrDrbg, static_cast<unsigned char *>(aBuffer), static_cast<size_t>(aSize)));
 }
 
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+
+void RandomManager::CryptoCtrDrbg::Update(const uint8_t *aData, uint16_t aLength)
+{
+    int rval = mbedtls_ctr_drbg_update_ret(&mCtrDrbg, static_cast<const unsigned char *>(aData),
+                                           static_cast<size_t>(aLength));
+
+    OT_ASSERT(rval == 0);
+    OT_UNUSED_VARIABLE(rval);
+}
+
+void RandomManager::CryptoCtrDrbg::SetReseedInterval(int aInterval)
+{
+    mbedtls_ctr_drbg_set_reseed_interval(&mCtrDrbg, aInterval);
+}
+
+#endif // OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+
 #endif // #if !OPENTHREAD_RADIO
 
 } // namespace ot
@@ -53,6 +53,8 @@
 
 namespace ot {
 
+class Instance;
+
 /**
  * This class manages random number generator initialization/deinitialization.
  *
@@ -106,9 +108,27 @@ public:
      *
      */
     static mbedtls_ctr_drbg_context *GetMbedTlsCtrDrbgContext(void) { return sCtrDrbg.GetContext(); }
+
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+    /**
+     * This static method restores the seed material sealed in settings during the previous boot (mixing it into
+     * the CTR-DRBG as additional input), applies the configured reseed schedule, and seals fresh seed material
+     * for the next boot.
+     *
+     * This method is expected to be called once settings become available (after `Settings::Init()`).
+     *
+     * @param[in] aInstance  The OpenThread instance (used to access settings).
+     *
+     */
+    static void SetUpPersistedSeed(Instance &aInstance);
+#endif
 #endif
 
 private:
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+    static constexpr uint16_t kPersistedSeedSize = 32; // Size (in bytes) of the sealed seed material.
+#endif
+
     class NonCryptoPrng // A non-crypto Pseudo Random Number Generator (PRNG)
     {
     public:
@@ -142,6 +162,10 @@ private:
         void  Init(void);
         void  Deinit(void);
         Error FillBuffer(uint8_t *aBuffer, uint16_t aSize);
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+        void Update(const uint8_t *aData, uint16_t aLength);
+        void SetReseedInterval(int aInterval);
+#endif
 
         mbedtls_ctr_drbg_context *GetContext(void) { return &mCtrDrbg; }
 
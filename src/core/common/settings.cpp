@@ -34,6 +34,7 @@
 #include "settings.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/const_cast.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/logging.hpp"
@@ -42,6 +43,18 @@
 
 namespace ot {
 
+//---------------------------------------------------------------------------------------------------------------------
+// SettingsDriver
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+// Defined out-of-line since the `Instance::Get<SettingsDriver>()`
+// specialization is not yet available where the class is defined.
+void SettingsDriver::HandleFlushTimer(Timer &aTimer)
+{
+    aTimer.Get<SettingsDriver>().Flush();
+}
+#endif
+
 //---------------------------------------------------------------------------------------------------------------------
 // SettingsBase
 
@@ -154,6 +167,9 @@ const char *SettingsBase::KeyToString(Key aKey)
         "SrpEcdsaKey",       // (11) kKeySrpEcdsaKey
         "SrpClientInfo",     // (12) kKeySrpClientInfo
         "SrpServerInfo",     // (13) kKeySrpServerInfo
+        "SrpServerHost",     // (14) kKeySrpServerHost
+        "DtlsSession",       // (15) kKeyDtlsSession
+        "DrbgSeed",          // (16) kKeyDrbgSeed
     };
 
     static_assert(1 == kKeyActiveDataset, "kKeyActiveDataset value is incorrect");
@@ -169,8 +185,11 @@ const char *SettingsBase::KeyToString(Key aKey)
     static_assert(11 == kKeySrpEcdsaKey, "kKeySrpEcdsaKey value is incorrect");
     static_assert(12 == kKeySrpClientInfo, "kKeySrpClientInfo value is incorrect");
     static_assert(13 == kKeySrpServerInfo, "kKeySrpServerInfo value is incorrect");
+    static_assert(14 == kKeySrpServerHost, "kKeySrpServerHost value is incorrect");
+    static_assert(15 == kKeyDtlsSession, "kKeyDtlsSession value is incorrect");
+    static_assert(16 == kKeyDrbgSeed, "kKeyDrbgSeed value is incorrect");
 
-    static_assert(kLastKey == kKeySrpServerInfo, "kLastKey is not valid");
+    static_assert(kLastKey == kKeyDrbgSeed, "kLastKey is not valid");
 
     OT_ASSERT(aKey <= kLastKey);
 
@@ -188,6 +207,12 @@ const uint16_t Settings::kCriticalKeys[] = {
     SettingsBase::kKeyActiveDataset,
     SettingsBase::kKeyPendingDataset,
     SettingsBase::kKeySrpEcdsaKey,
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+    SettingsBase::kKeyDtlsSession,
+#endif
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+    SettingsBase::kKeyDrbgSeed,
+#endif
 };
 
 void Settings::Init(void)
@@ -198,20 +223,45 @@ void Settings::Init(void)
 
 void Settings::Deinit(void)
 {
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    InvalidateAllCachedEntries();
+#endif
     Get<SettingsDriver>().Deinit();
 }
 
 void Settings::Wipe(void)
 {
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    InvalidateAllCachedEntries();
+#endif
     Get<SettingsDriver>().Wipe();
     otLogInfoCore("[settings] Wiped all info");
 }
 
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+void Settings::BeginChange(void)
+{
+    Get<SettingsDriver>().BeginChange();
+}
+
+Error Settings::CommitChange(void)
+{
+    return Get<SettingsDriver>().CommitChange();
+}
+#endif
+
 Error Settings::SaveOperationalDataset(bool aIsActive, const MeshCoP::Dataset &aDataset)
 {
     Key   key   = (aIsActive ? kKeyActiveDataset : kKeyPendingDataset);
     Error error = Get<SettingsDriver>().Set(key, aDataset.GetBytes(), aDataset.GetSize());
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    if (error == kErrorNone)
+    {
+        UpdateCachedEntry(key, aDataset.GetBytes(), aDataset.GetSize());
+    }
+#endif
+
     Log(kActionSave, error, key);
 
     return error;
@@ -219,7 +269,24 @@ Error Settings::SaveOperationalDataset(bool aIsActive, const MeshCoP::Dataset &a
 
 Error Settings::ReadOperationalDataset(bool aIsActive, MeshCoP::Dataset &aDataset) const
 {
-    Error    error  = kErrorNone;
+    Error error = kErrorNone;
+
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    Key          key    = (aIsActive ? kKeyActiveDataset : kKeyPendingDataset);
+    CachedEntry *cached = FindCachedEntry(key);
+
+    if (!cached->mIsValid)
+    {
+        cached->mLength = kCachedEntryMaxSize;
+        SuccessOrExit(error = Get<SettingsDriver>().Get(key, cached->mData, &cached->mLength));
+        VerifyOrExit(cached->mLength <= MeshCoP::Dataset::kMaxSize, error = kErrorNotFound);
+
+        cached->mIsValid = true;
+    }
+
+    memcpy(aDataset.GetBytes(), cached->mData, cached->mLength);
+    aDataset.SetSize(cached->mLength);
+#else
     uint16_t length = MeshCoP::Dataset::kMaxSize;
 
     SuccessOrExit(error = Get<SettingsDriver>().Get(aIsActive ? kKeyActiveDataset : kKeyPendingDataset,
@@ -227,6 +294,7 @@ Error Settings::ReadOperationalDataset(bool aIsActive, MeshCoP::Dataset &aDatase
     VerifyOrExit(length <= MeshCoP::Dataset::kMaxSize, error = kErrorNotFound);
 
     aDataset.SetSize(length);
+#endif
 
 exit:
     return error;
@@ -237,11 +305,85 @@ Error Settings::DeleteOperationalDataset(bool aIsActive)
     Key   key   = (aIsActive ? kKeyActiveDataset : kKeyPendingDataset);
     Error error = Get<SettingsDriver>().Delete(key);
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    InvalidateCachedEntry(key);
+#endif
+
     Log(kActionDelete, error, key);
 
     return error;
 }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+Error Settings::AddSrpServerHost(const void *aData, uint16_t aLength)
+{
+    Error error = Get<SettingsDriver>().Add(kKeySrpServerHost, aData, aLength);
+
+#if OPENTHREAD_FTD
+    Log(kActionAdd, error, kKeySrpServerHost);
+#endif
+
+    return error;
+}
+
+Error Settings::ReadSrpServerHost(int aIndex, void *aData, uint16_t &aLength) const
+{
+    return Get<SettingsDriver>().Get(kKeySrpServerHost, aIndex, aData, &aLength);
+}
+
+Error Settings::DeleteAllSrpServerHosts(void)
+{
+    Error error = Get<SettingsDriver>().Delete(kKeySrpServerHost);
+
+#if OPENTHREAD_FTD
+    Log(kActionDeleteAll, error, kKeySrpServerHost);
+#endif
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+Error Settings::SaveDtlsSession(const void *aData, uint16_t aLength)
+{
+    Error error = Get<SettingsDriver>().Set(kKeyDtlsSession, aData, aLength);
+
+    Log(kActionSave, error, kKeyDtlsSession);
+
+    return error;
+}
+
+Error Settings::ReadDtlsSession(void *aData, uint16_t &aLength) const
+{
+    return Get<SettingsDriver>().Get(kKeyDtlsSession, aData, &aLength);
+}
+
+Error Settings::DeleteDtlsSession(void)
+{
+    Error error = Get<SettingsDriver>().Delete(kKeyDtlsSession);
+
+    Log(kActionDelete, error, kKeyDtlsSession);
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+Error Settings::SaveDrbgSeed(const void *aData, uint16_t aLength)
+{
+    Error error = Get<SettingsDriver>().Set(kKeyDrbgSeed, aData, aLength);
+
+    Log(kActionSave, error, kKeyDrbgSeed);
+
+    return error;
+}
+
+Error Settings::ReadDrbgSeed(void *aData, uint16_t &aLength) const
+{
+    return Get<SettingsDriver>().Get(kKeyDrbgSeed, aData, &aLength);
+}
+#endif // OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+
 #if OPENTHREAD_FTD
 Error Settings::AddChildInfo(const ChildInfo &aChildInfo)
 {
@@ -305,14 +447,107 @@ exit:
 }
 #endif // OPENTHREAD_FTD
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+
+Settings::CachedEntry *Settings::FindCachedEntry(Key aKey) const
+{
+    const CachedEntry *entry = nullptr;
+
+    switch (aKey)
+    {
+    case kKeyActiveDataset:
+        entry = &mCachedEntries[0];
+        break;
+    case kKeyPendingDataset:
+        entry = &mCachedEntries[1];
+        break;
+    case kKeyNetworkInfo:
+        entry = &mCachedEntries[2];
+        break;
+    case kKeyParentInfo:
+        entry = &mCachedEntries[3];
+        break;
+    default:
+        break;
+    }
+
+    return AsNonConst(entry);
+}
+
+void Settings::UpdateCachedEntry(Key aKey, const void *aValue, uint16_t aLength)
+{
+    CachedEntry *cached = FindCachedEntry(aKey);
+
+    VerifyOrExit(cached != nullptr);
+    VerifyOrExit(aLength <= kCachedEntryMaxSize, cached->mIsValid = false);
+
+    memcpy(cached->mData, aValue, aLength);
+    cached->mLength  = aLength;
+    cached->mIsValid = true;
+
+exit:
+    return;
+}
+
+void Settings::InvalidateCachedEntry(Key aKey)
+{
+    CachedEntry *cached = FindCachedEntry(aKey);
+
+    if (cached != nullptr)
+    {
+        cached->mIsValid = false;
+    }
+}
+
+void Settings::InvalidateAllCachedEntries(void)
+{
+    for (CachedEntry &entry : mCachedEntries)
+    {
+        entry.mIsValid = false;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+
 Error Settings::ReadEntry(Key aKey, void *aValue, uint16_t aMaxLength) const
 {
     Error    error;
     uint16_t length = aMaxLength;
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    {
+        CachedEntry *cached = FindCachedEntry(aKey);
+
+        if (cached != nullptr)
+        {
+            if (!cached->mIsValid)
+            {
+                cached->mLength = kCachedEntryMaxSize;
+
+                if ((Get<SettingsDriver>().Get(aKey, cached->mData, &cached->mLength) == kErrorNone) &&
+                    (cached->mLength <= kCachedEntryMaxSize))
+                {
+                    cached->mIsValid = true;
+                }
+            }
+
+            if (cached->mIsValid)
+            {
+                memcpy(aValue, cached->mData, OT_MIN(cached->mLength, aMaxLength));
+                error = kErrorNone;
+                Log(kActionRead, error, aKey, aValue);
+                ExitNow();
+            }
+        }
+    }
+#endif
+
     error = Get<SettingsDriver>().Get(aKey, aValue, &length);
     Log(kActionRead, error, aKey, aValue);
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -332,6 +567,13 @@ Error Settings::SaveEntry(Key aKey, const void *aValue, void *aPrev, uint16_t aL
         error = Get<SettingsDriver>().Set(aKey, aValue, aLength);
     }
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    if (error == kErrorNone)
+    {
+        UpdateCachedEntry(aKey, aValue, aLength);
+    }
+#endif
+
     Log(action, error, aKey, aValue);
 
     return error;
@@ -341,6 +583,10 @@ Error Settings::DeleteEntry(Key aKey)
 {
     Error error = Get<SettingsDriver>().Delete(aKey);
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    InvalidateCachedEntry(aKey);
+#endif
+
     Log(kActionDelete, error, aKey);
 
     return error;
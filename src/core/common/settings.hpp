@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/dataset.h>
 #include <openthread/platform/settings.h>
 
 #include "common/clearable.hpp"
@@ -126,9 +127,12 @@ public:
         kKeySrpEcdsaKey       = OT_SETTINGS_KEY_SRP_ECDSA_KEY,
         kKeySrpClientInfo     = OT_SETTINGS_KEY_SRP_CLIENT_INFO,
         kKeySrpServerInfo     = OT_SETTINGS_KEY_SRP_SERVER_INFO,
+        kKeySrpServerHost     = OT_SETTINGS_KEY_SRP_SERVER_HOST,
+        kKeyDtlsSession       = OT_SETTINGS_KEY_DTLS_SESSION,
+        kKeyDrbgSeed          = OT_SETTINGS_KEY_DRBG_SEED,
     };
 
-    static constexpr Key kLastKey = kKeySrpServerInfo; ///< The last (numerically) enumerator value in `Key`.
+    static constexpr Key kLastKey = kKeyDrbgSeed; ///< The last (numerically) enumerator value in `Key`.
 
     /**
      * This structure represents the device's own network information for settings storage.
@@ -756,6 +760,9 @@ public:
     explicit Settings(Instance &aInstance)
         : SettingsBase(aInstance)
     {
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+        InvalidateAllCachedEntries();
+#endif
     }
 
     /**
@@ -780,6 +787,27 @@ public:
      */
     void Wipe(void);
 
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    /**
+     * This method begins a group of settings changes which are committed to the non-volatile store together when the
+     * matching `CommitChange()` is called.
+     *
+     * Begin/commit pairs may nest; the buffered changes are applied when the outermost group is committed. While a
+     * group is open, repeated changes to the same key are coalesced and only the latest change is written.
+     *
+     */
+    void BeginChange(void);
+
+    /**
+     * This method commits the settings changes buffered since the matching `BeginChange()`.
+     *
+     * @retval kErrorNone    All buffered changes were applied successfully.
+     * @retval kErrorNoBufs  Not enough space to store a buffered value.
+     *
+     */
+    Error CommitChange(void);
+#endif
+
     /**
      * This method saves the Operational Dataset (active or pending).
      *
@@ -934,6 +962,111 @@ public:
      */
     template <typename EntryType> Error Delete(void) { return DeleteEntry(EntryType::kKey); }
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    /**
+     * This method adds an SRP server host record to settings.
+     *
+     * @note SRP server host is a list-based settings property and can contain multiple entries. The record content
+     * is an opaque serialized blob owned by the SRP server.
+     *
+     * @param[in]   aData    A pointer to the serialized host record.
+     * @param[in]   aLength  The length (number of bytes) of the record.
+     *
+     * @retval kErrorNone             Successfully added the host record in settings.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error AddSrpServerHost(const void *aData, uint16_t aLength);
+
+    /**
+     * This method reads an SRP server host record from settings.
+     *
+     * @param[in]     aIndex   The index of the record to read.
+     * @param[out]    aData    A pointer to a buffer to output the record content.
+     * @param[inout]  aLength  On entry, the size of @p aData buffer. On exit, the record length.
+     *
+     * @retval kErrorNone             Successfully read the host record.
+     * @retval kErrorNotFound         No host record at @p aIndex in the setting store.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error ReadSrpServerHost(int aIndex, void *aData, uint16_t &aLength) const;
+
+    /**
+     * This method deletes all SRP server host records from the settings.
+     *
+     * @retval kErrorNone            Successfully deleted the host records.
+     * @retval kErrorNotImplemented  The platform does not implement settings functionality.
+     *
+     */
+    Error DeleteAllSrpServerHosts(void);
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+    /**
+     * This method saves a serialized DTLS session to settings. The record content is an opaque serialized blob
+     * owned by the `MeshCoP::Dtls` module.
+     *
+     * @param[in]   aData    A pointer to the serialized session.
+     * @param[in]   aLength  The length (number of bytes) of the serialized session.
+     *
+     * @retval kErrorNone             Successfully saved the session in settings.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error SaveDtlsSession(const void *aData, uint16_t aLength);
+
+    /**
+     * This method reads the serialized DTLS session from settings.
+     *
+     * @param[out]    aData    A pointer to a buffer to output the serialized session.
+     * @param[inout]  aLength  On entry, the size of @p aData buffer. On exit, the serialized session length.
+     *
+     * @retval kErrorNone             Successfully read the session.
+     * @retval kErrorNotFound         No session in the setting store.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error ReadDtlsSession(void *aData, uint16_t &aLength) const;
+
+    /**
+     * This method deletes the DTLS session from the settings.
+     *
+     * @retval kErrorNone            Successfully deleted the session.
+     * @retval kErrorNotImplemented  The platform does not implement settings functionality.
+     *
+     */
+    Error DeleteDtlsSession(void);
+#endif // OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+
+#if OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+    /**
+     * This method saves (seals) CTR-DRBG seed material to settings for use on the next boot. The record content
+     * is an opaque blob owned by `RandomManager`.
+     *
+     * @param[in]   aData    A pointer to the seed material.
+     * @param[in]   aLength  The length (number of bytes) of the seed material.
+     *
+     * @retval kErrorNone             Successfully saved the seed material in settings.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error SaveDrbgSeed(const void *aData, uint16_t aLength);
+
+    /**
+     * This method reads the sealed CTR-DRBG seed material from settings.
+     *
+     * @param[out]    aData    A pointer to a buffer to output the seed material.
+     * @param[inout]  aLength  On entry, the size of @p aData buffer. On exit, the seed material length.
+     *
+     * @retval kErrorNone             Successfully read the seed material.
+     * @retval kErrorNotFound         No seed material in the setting store.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error ReadDrbgSeed(void *aData, uint16_t &aLength) const;
+#endif // OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+
 #if OPENTHREAD_FTD
     /**
      * This method adds a Child Info entry to settings.
@@ -1098,6 +1231,23 @@ private:
     };
 #endif
 
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    static constexpr uint16_t kNumCachedKeys      = 4;
+    static constexpr uint16_t kCachedEntryMaxSize = OT_OPERATIONAL_DATASET_MAX_LENGTH;
+
+    struct CachedEntry
+    {
+        uint8_t  mData[kCachedEntryMaxSize];
+        uint16_t mLength;
+        bool     mIsValid;
+    };
+
+    CachedEntry *FindCachedEntry(Key aKey) const;
+    void         UpdateCachedEntry(Key aKey, const void *aValue, uint16_t aLength);
+    void         InvalidateCachedEntry(Key aKey);
+    void         InvalidateAllCachedEntries(void);
+#endif
+
     Error ReadEntry(Key aKey, void *aValue, uint16_t aMaxLength) const;
     Error SaveEntry(Key aKey, const void *aValue, void *aPrev, uint16_t aLength);
     Error DeleteEntry(Key aKey);
@@ -1105,6 +1255,10 @@ private:
     static void Log(Action aAction, Error aError, Key aKey, const void *aValue = nullptr);
 
     static const uint16_t kCriticalKeys[];
+
+#if OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+    CachedEntry mCachedEntries[kNumCachedKeys];
+#endif
 };
 
 } // namespace ot
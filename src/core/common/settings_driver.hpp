@@ -38,10 +38,15 @@
 
 #include <openthread/platform/settings.h>
 
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/error.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/timer.hpp"
 #include "utils/flash.hpp"
 
 namespace ot {
@@ -59,8 +64,25 @@ public:
         : InstanceLocator(aInstance)
 #if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
         , mFlash(aInstance)
+#endif
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        , mFlushTimer(aInstance, HandleFlushTimer)
 #endif
     {
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        for (PendingEntry &entry : mPendingEntries)
+        {
+            entry.mValid = false;
+        }
+#endif
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+        mGroupDepth = 0;
+
+        for (GroupOp &op : mGroupOps)
+        {
+            op.mValid = false;
+        }
+#endif
     }
 
     /**
@@ -82,6 +104,12 @@ public:
      */
     void Deinit(void)
     {
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+        IgnoreError(CommitGroupOps());
+#endif
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        Flush();
+#endif
 #if !OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
         otPlatSettingsDeinit(GetInstancePtr());
 #endif
@@ -121,6 +149,19 @@ public:
         Error          error;
         const uint8_t *value = reinterpret_cast<const uint8_t *>(aValue);
 
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+        // `Add()` appends one of possibly multiple values of @p aKey
+        // and is not coalesced, so any buffered group changes are
+        // applied first to preserve the operation order.
+        IgnoreError(CommitGroupOps());
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        // Commit any pending change to @p aKey first so that the added
+        // value is appended after it.
+        FlushKey(aKey);
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
         error = mFlash.Add(aKey, value, aValueLength);
 #else
@@ -143,11 +184,49 @@ public:
     Error Delete(uint16_t aKey, int aIndex = -1)
     {
         Error error;
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        bool          hadPending = false;
+        PendingEntry *entry;
+#endif
 
-#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
-        error = mFlash.Delete(aKey, aIndex);
-#else
-        error = otPlatSettingsDelete(GetInstancePtr(), aKey, aIndex);
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+        if (mGroupDepth > 0)
+        {
+            // Only a "delete all values" request can be coalesced with
+            // other changes to the same key. A delete by index is
+            // applied through directly (after the buffered changes).
+            if ((aIndex == -1) && RecordGroupOp(aKey, /* aIsDelete */ true, nullptr, 0))
+            {
+                ExitNow(error = kErrorNone);
+            }
+
+            IgnoreError(CommitGroupOps());
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        entry = FindPendingEntry(aKey);
+
+        // A pending `Set()` replaced all previous values of @p aKey
+        // with a single value, so it is removed by index 0 or -1.
+        if ((entry != nullptr) && (aIndex <= 0))
+        {
+            entry->mValid = false;
+            hadPending    = true;
+        }
+#endif
+
+        error = DeleteThrough(aKey, aIndex);
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        if (hadPending && (error == kErrorNotFound))
+        {
+            error = kErrorNone;
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    exit:
 #endif
         return error;
     }
@@ -173,12 +252,69 @@ public:
     {
         Error    error;
         uint8_t *value = reinterpret_cast<uint8_t *>(aValue);
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        const PendingEntry *entry;
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+        if (mGroupDepth > 0)
+        {
+            const GroupOp *op = FindGroupOp(aKey);
+
+            if (op != nullptr)
+            {
+                // A buffered delete removed all values, and a buffered
+                // set replaced all previous values with a single value
+                // at index 0.
+                VerifyOrExit(!op->mIsDelete && (aIndex == 0), error = kErrorNotFound);
+
+                if (aValueLength != nullptr)
+                {
+                    if (value != nullptr)
+                    {
+                        memcpy(value, op->mValue, OT_MIN(*aValueLength, op->mValueLength));
+                    }
+
+                    *aValueLength = op->mValueLength;
+                }
+
+                ExitNow(error = kErrorNone);
+            }
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        entry = FindPendingEntry(aKey);
+
+        if (entry != nullptr)
+        {
+            // A pending `Set()` replaced all previous values of @p aKey
+            // with a single value at index 0.
+            VerifyOrExit(aIndex == 0, error = kErrorNotFound);
+
+            if (aValueLength != nullptr)
+            {
+                if (value != nullptr)
+                {
+                    memcpy(value, entry->mValue, OT_MIN(*aValueLength, entry->mValueLength));
+                }
+
+                *aValueLength = entry->mValueLength;
+            }
+
+            ExitNow(error = kErrorNone);
+        }
+#endif
 
 #if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
         error = mFlash.Get(aKey, aIndex, value, aValueLength);
 #else
         error = otPlatSettingsGet(GetInstancePtr(), aKey, aIndex, value, aValueLength);
 #endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE || OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    exit:
+#endif
         return error;
     }
 
@@ -217,15 +353,62 @@ public:
      */
     Error Set(uint16_t aKey, const void *aValue, uint16_t aValueLength)
     {
-        Error          error;
-        const uint8_t *value = reinterpret_cast<const uint8_t *>(aValue);
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+        if (mGroupDepth > 0)
+        {
+            Error error = kErrorNone;
 
-#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
-        error = mFlash.Set(aKey, value, aValueLength);
-#else
-        error = otPlatSettingsSet(GetInstancePtr(), aKey, value, aValueLength);
+            if (!RecordGroupOp(aKey, /* aIsDelete */ false, aValue, aValueLength))
+            {
+                // The value is too large or the group is full. The
+                // buffered changes are applied first to preserve the
+                // operation order, and the value is written through.
+                IgnoreError(CommitGroupOps());
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+                DiscardPendingEntry(aKey);
 #endif
+                error = SetThrough(aKey, aValue, aValueLength);
+            }
+
+            return error;
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        Error         error = kErrorNone;
+        PendingEntry *entry = FindPendingEntry(aKey);
+
+        if (aValueLength <= kWriteBehindValueSize)
+        {
+            if (entry == nullptr)
+            {
+                entry = FindFreePendingEntry();
+            }
+
+            if (entry != nullptr)
+            {
+                memcpy(entry->mValue, aValue, aValueLength);
+                entry->mKey         = aKey;
+                entry->mValueLength = aValueLength;
+                entry->mValid       = true;
+                mFlushTimer.FireAtIfEarlier(TimerMilli::GetNow() + kWriteBehindFlushDelay);
+                ExitNow();
+            }
+        }
+        else if (entry != nullptr)
+        {
+            // The new value is written through directly and replaces
+            // the buffered change.
+            entry->mValid = false;
+        }
+
+        error = SetThrough(aKey, aValue, aValueLength);
+
+    exit:
         return error;
+#else
+        return SetThrough(aKey, aValue, aValueLength);
+#endif
     }
 
     /**
@@ -234,6 +417,22 @@ public:
      */
     void Wipe(void)
     {
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+        for (GroupOp &op : mGroupOps)
+        {
+            op.mValid = false;
+        }
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        for (PendingEntry &entry : mPendingEntries)
+        {
+            entry.mValid = false;
+        }
+
+        mFlushTimer.Stop();
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
         mFlash.Wipe();
 #else
@@ -241,12 +440,299 @@ public:
 #endif
     }
 
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    /**
+     * This method commits all buffered (write-behind) changes to the underlying storage.
+     *
+     */
+    void Flush(void)
+    {
+        for (PendingEntry &entry : mPendingEntries)
+        {
+            if (!entry.mValid)
+            {
+                continue;
+            }
+
+            entry.mValid = false;
+            IgnoreError(SetThrough(entry.mKey, entry.mValue, entry.mValueLength));
+        }
+
+        mFlushTimer.Stop();
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    /**
+     * This method begins a group of settings changes which are applied to the underlying storage together when the
+     * matching `CommitChange()` is called.
+     *
+     * Begin/commit pairs may nest; the buffered changes are applied when the outermost group is committed. While a
+     * group is open, repeated changes to the same key are coalesced and only the latest change is written.
+     *
+     */
+    void BeginChange(void) { mGroupDepth++; }
+
+    /**
+     * This method commits the changes buffered since the matching `BeginChange()`.
+     *
+     * @retval kErrorNone    All buffered changes were applied successfully.
+     * @retval kErrorNoBufs  Not enough space to store a buffered value.
+     *
+     */
+    Error CommitChange(void)
+    {
+        Error error = kErrorNone;
+
+        OT_ASSERT(mGroupDepth > 0);
+
+        mGroupDepth--;
+
+        if (mGroupDepth == 0)
+        {
+            error = CommitGroupOps();
+        }
+
+        return error;
+    }
+#endif // OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+
 private:
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    static constexpr uint16_t kWriteBehindEntries    = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENTRIES;
+    static constexpr uint16_t kWriteBehindValueSize  = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_VALUE_SIZE;
+    static constexpr uint32_t kWriteBehindFlushDelay = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_FLUSH_DELAY;
+
+    struct PendingEntry
+    {
+        bool     mValid;
+        uint16_t mKey;
+        uint16_t mValueLength;
+        uint8_t  mValue[kWriteBehindValueSize];
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    static constexpr uint16_t kGroupCommitMaxOps    = OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_MAX_OPS;
+    static constexpr uint16_t kGroupCommitValueSize = OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_VALUE_SIZE;
+
+    struct GroupOp
+    {
+        bool     mValid;
+        bool     mIsDelete;
+        uint16_t mKey;
+        uint16_t mValueLength;
+        uint8_t  mValue[kGroupCommitValueSize];
+    };
+#endif
+
     otInstance *GetInstancePtr(void) const { return reinterpret_cast<otInstance *>(&InstanceLocator::GetInstance()); }
 
+    Error SetThrough(uint16_t aKey, const void *aValue, uint16_t aValueLength)
+    {
+        Error          error;
+        const uint8_t *value = reinterpret_cast<const uint8_t *>(aValue);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+        error = mFlash.Set(aKey, value, aValueLength);
+#else
+        error = otPlatSettingsSet(GetInstancePtr(), aKey, value, aValueLength);
+#endif
+        return error;
+    }
+
+    Error DeleteThrough(uint16_t aKey, int aIndex)
+    {
+        Error error;
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+        error = mFlash.Delete(aKey, aIndex);
+#else
+        error = otPlatSettingsDelete(GetInstancePtr(), aKey, aIndex);
+#endif
+        return error;
+    }
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    PendingEntry *FindPendingEntry(uint16_t aKey)
+    {
+        return const_cast<PendingEntry *>(const_cast<const SettingsDriver *>(this)->FindPendingEntry(aKey));
+    }
+
+    const PendingEntry *FindPendingEntry(uint16_t aKey) const
+    {
+        const PendingEntry *rval = nullptr;
+
+        for (const PendingEntry &entry : mPendingEntries)
+        {
+            if (entry.mValid && (entry.mKey == aKey))
+            {
+                rval = &entry;
+                break;
+            }
+        }
+
+        return rval;
+    }
+
+    PendingEntry *FindFreePendingEntry(void)
+    {
+        PendingEntry *rval = nullptr;
+
+        for (PendingEntry &entry : mPendingEntries)
+        {
+            if (!entry.mValid)
+            {
+                rval = &entry;
+                break;
+            }
+        }
+
+        return rval;
+    }
+
+    void FlushKey(uint16_t aKey)
+    {
+        PendingEntry *entry = FindPendingEntry(aKey);
+
+        if (entry != nullptr)
+        {
+            entry->mValid = false;
+            IgnoreError(SetThrough(entry->mKey, entry->mValue, entry->mValueLength));
+        }
+    }
+
+    static void HandleFlushTimer(Timer &aTimer);
+
+    void DiscardPendingEntry(uint16_t aKey)
+    {
+        PendingEntry *entry = FindPendingEntry(aKey);
+
+        if (entry != nullptr)
+        {
+            entry->mValid = false;
+        }
+    }
+#endif // OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    GroupOp *FindGroupOp(uint16_t aKey)
+    {
+        return const_cast<GroupOp *>(const_cast<const SettingsDriver *>(this)->FindGroupOp(aKey));
+    }
+
+    const GroupOp *FindGroupOp(uint16_t aKey) const
+    {
+        const GroupOp *rval = nullptr;
+
+        for (const GroupOp &op : mGroupOps)
+        {
+            if (op.mValid && (op.mKey == aKey))
+            {
+                rval = &op;
+                break;
+            }
+        }
+
+        return rval;
+    }
+
+    bool RecordGroupOp(uint16_t aKey, bool aIsDelete, const void *aValue, uint16_t aValueLength)
+    {
+        bool     recorded = false;
+        GroupOp *op;
+
+        VerifyOrExit(aValueLength <= kGroupCommitValueSize);
+
+        op = FindGroupOp(aKey);
+
+        if (op == nullptr)
+        {
+            for (GroupOp &freeOp : mGroupOps)
+            {
+                if (!freeOp.mValid)
+                {
+                    op = &freeOp;
+                    break;
+                }
+            }
+        }
+
+        VerifyOrExit(op != nullptr);
+
+        if (aValueLength > 0)
+        {
+            memcpy(op->mValue, aValue, aValueLength);
+        }
+
+        op->mKey         = aKey;
+        op->mIsDelete    = aIsDelete;
+        op->mValueLength = aValueLength;
+        op->mValid       = true;
+        recorded         = true;
+
+    exit:
+        return recorded;
+    }
+
+    Error CommitGroupOps(void)
+    {
+        Error error = kErrorNone;
+
+        for (GroupOp &op : mGroupOps)
+        {
+            Error opError;
+
+            if (!op.mValid)
+            {
+                continue;
+            }
+
+            op.mValid = false;
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+            // The group change is newer than any buffered write-behind
+            // change to the same key.
+            DiscardPendingEntry(op.mKey);
+#endif
+
+            if (op.mIsDelete)
+            {
+                opError = DeleteThrough(op.mKey, -1);
+
+                // Deleting a key with no stored value is not a failure
+                // of the group commit.
+                if (opError == kErrorNotFound)
+                {
+                    opError = kErrorNone;
+                }
+            }
+            else
+            {
+                opError = SetThrough(op.mKey, op.mValue, op.mValueLength);
+            }
+
+            if (error == kErrorNone)
+            {
+                error = opError;
+            }
+        }
+
+        return error;
+    }
+#endif // OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+
 #if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
     Flash mFlash;
 #endif
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    TimerMilli   mFlushTimer;
+    PendingEntry mPendingEntries[kWriteBehindEntries];
+#endif
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    uint8_t mGroupDepth;
+    GroupOp mGroupOps[kGroupCommitMaxOps];
+#endif
 };
 
 } // namespace ot
@@ -38,6 +38,8 @@
 
 namespace ot {
 
+static const char kHexChars[] = "0123456789abcdef";
+
 uint16_t StringLength(const char *aString, uint16_t aMaxLength)
 {
     uint16_t ret;
@@ -143,11 +145,68 @@ StringWriter &StringWriter::AppendVarArgs(const char *aFormat, va_list aArgs)
     return *this;
 }
 
+StringWriter &StringWriter::AppendChar(char aChar)
+{
+    if (mLength + 1 < mSize)
+    {
+        mBuffer[mLength]     = aChar;
+        mBuffer[mLength + 1] = '\0';
+    }
+
+    mLength++;
+
+    return *this;
+}
+
+StringWriter &StringWriter::AppendUint(uint32_t aUint)
+{
+    char    digits[10]; // Maximum number of digits in decimal representation of a `uint32_t`.
+    uint8_t index = 0;
+
+    do
+    {
+        digits[index++] = static_cast<char>('0' + (aUint % 10));
+        aUint /= 10;
+    } while (aUint != 0);
+
+    while (index > 0)
+    {
+        AppendChar(digits[--index]);
+    }
+
+    return *this;
+}
+
+StringWriter &StringWriter::AppendHexUint16(uint16_t aUint16)
+{
+    bool skipZero = true;
+
+    for (uint8_t shift = 16; shift > 0;)
+    {
+        uint8_t nibble;
+
+        shift -= 4;
+        nibble = (aUint16 >> shift) & 0xf;
+
+        if (skipZero && (nibble == 0) && (shift != 0))
+        {
+            continue;
+        }
+
+        skipZero = false;
+        AppendChar(kHexChars[nibble]);
+    }
+
+    return *this;
+}
+
 StringWriter &StringWriter::AppendHexBytes(const uint8_t *aBytes, uint16_t aLength)
 {
     while (aLength--)
     {
-        Append("%02x", *aBytes++);
+        AppendChar(kHexChars[*aBytes >> 4]);
+        AppendChar(kHexChars[*aBytes & 0xf]);
+        aBytes++;
     }
 
     return *this;
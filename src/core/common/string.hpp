@@ -175,7 +175,7 @@ public:
      * @returns The string writer.
      *
      */
-    StringWriter &Append(const char *aFormat, ...);
+    StringWriter &Append(const char *aFormat, ...) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 3);
 
     /**
      * This method appends `printf()` style formatted data to the buffer.
@@ -186,7 +186,44 @@ public:
      * @returns The string writer.
      *
      */
-    StringWriter &AppendVarArgs(const char *aFormat, va_list aArgs);
+    StringWriter &AppendVarArgs(const char *aFormat, va_list aArgs) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 0);
+
+    /**
+     * This method appends a single character to the buffer.
+     *
+     * Unlike `Append()` this method writes directly into the buffer bypassing the `printf()` machinery.
+     *
+     * @param[in] aChar   The character to append.
+     *
+     * @returns The string writer.
+     *
+     */
+    StringWriter &AppendChar(char aChar);
+
+    /**
+     * This method appends a `uint32_t` value in decimal representation (similar to "%u" style) to the buffer.
+     *
+     * Unlike `Append()` this method writes directly into the buffer bypassing the `printf()` machinery.
+     *
+     * @param[in] aUint   The `uint32_t` value to append.
+     *
+     * @returns The string writer.
+     *
+     */
+    StringWriter &AppendUint(uint32_t aUint);
+
+    /**
+     * This method appends a `uint16_t` value in hex representation without leading zeros (similar to "%x" style) to
+     * the buffer.
+     *
+     * Unlike `Append()` this method writes directly into the buffer bypassing the `printf()` machinery.
+     *
+     * @param[in] aUint16   The `uint16_t` value to append.
+     *
+     * @returns The string writer.
+     *
+     */
+    StringWriter &AppendHexUint16(uint16_t aUint16);
 
     /**
      * This method appends an array of bytes in hex representation (using "%02x" style) to the buffer.
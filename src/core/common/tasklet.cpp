@@ -35,6 +35,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/locator_getters.hpp"
+#include "common/timer.hpp"
 
 namespace ot {
 
@@ -50,20 +51,162 @@ void Tasklet::Scheduler::PostTasklet(Tasklet &aTasklet)
 {
     // Tasklets are saved in a circular singly linked list.
 
-    if (mTail == nullptr)
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    Tasklet *match;
+#endif
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+    bool      wasPending = AreTaskletsPending();
+    Tasklet *&tail       = aTasklet.mIsHighPriority ? mHighPriorityTail : mTail;
+
+    aTasklet.mPostTime = TimerMilli::GetNow();
+#else
+    bool      wasPending = (mTail != nullptr);
+    Tasklet *&tail       = mTail;
+#endif
+
+    if (tail == nullptr)
+    {
+        tail           = &aTasklet;
+        aTasklet.mNext = &aTasklet;
+    }
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    else if (((match = FindLastWithTag(tail, aTasklet.mTag)) != nullptr) && (match != tail))
+    {
+        // Insert the tasklet directly after the last queued tasklet
+        // with the same affinity tag, so same-tag tasklets run
+        // consecutively while their per-tag FIFO order is preserved.
+        // When the match is the tail (or there is no match) the
+        // tasklet is appended at the tail as usual.
+
+        aTasklet.mNext = match->mNext;
+        match->mNext   = &aTasklet;
+    }
+#endif
+    else
+    {
+        aTasklet.mNext = tail->mNext;
+        tail->mNext    = &aTasklet;
+        tail           = &aTasklet;
+    }
+
+    if (!wasPending)
     {
-        mTail        = &aTasklet;
-        mTail->mNext = mTail;
         otTaskletsSignalPending(&aTasklet.GetInstance());
     }
+}
+
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+
+Tasklet *Tasklet::Scheduler::FindLastWithTag(Tasklet *aTail, uint8_t aTag)
+{
+    Tasklet *match   = nullptr;
+    Tasklet *tasklet = aTail->mNext; // Head of the circular list.
+
+    do
+    {
+        if (tasklet->mTag == aTag)
+        {
+            match = tasklet;
+        }
+
+        tasklet = tasklet->mNext;
+    } while (tasklet != aTail->mNext);
+
+    return match;
+}
+
+void Tasklet::Scheduler::RunTasklet(Tasklet &aTasklet)
+{
+    uint8_t   tag   = (aTasklet.mTag < kNumAffinityTags) ? aTasklet.mTag : 0;
+    TimeMilli start = TimerMilli::GetNow();
+
+    aTasklet.RunTask();
+
+    mTagProfiles[tag].mRunCount++;
+    mTagProfiles[tag].mRunTime += TimerMilli::GetNow() - start;
+}
+
+#endif // OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+
+void Tasklet::Scheduler::ProcessQueuedTasklets(void)
+{
+    uint16_t quota    = kLowPriorityRunQuota;
+    Tasklet *highTail = mHighPriorityTail;
+    Tasklet *tail     = mTail;
+
+    // As in the `ProcessQueuedTasklets()` version below, both lists are
+    // copied and cleared so that only the tasklets queued when this is
+    // called are processed, and a newly posted tasklet triggers a call
+    // to `otTaskletsSignalPending()`.
+
+    mHighPriorityTail = nullptr;
+    mTail             = nullptr;
+
+    while (highTail != nullptr)
+    {
+        RunNextTasklet(highTail);
+    }
+
+    while ((tail != nullptr) && (quota > 0))
+    {
+        RunNextTasklet(tail);
+        quota--;
+    }
+
+    if (tail != nullptr)
+    {
+        // Re-queue the normal tasklets beyond the per-pass quota ahead
+        // of any newly posted ones and signal a new pass, so that
+        // high-priority tasklets posted in the meantime run first.
+
+        if (mTail == nullptr)
+        {
+            mTail = tail;
+        }
+        else
+        {
+            Tasklet *head = tail->mNext;
+
+            tail->mNext  = mTail->mNext;
+            mTail->mNext = head;
+        }
+
+        otTaskletsSignalPending(&tail->GetInstance());
+    }
+}
+
+void Tasklet::Scheduler::RunNextTasklet(Tasklet *&aTail)
+{
+    Tasklet *tasklet = aTail->mNext;
+    uint32_t latency = TimerMilli::GetNow() - tasklet->mPostTime;
+
+    if (tasklet == aTail)
+    {
+        aTail = nullptr;
+    }
     else
     {
-        aTasklet.mNext = mTail->mNext;
-        mTail->mNext   = &aTasklet;
-        mTail          = &aTasklet;
+        aTail->mNext = tasklet->mNext;
     }
+
+    tasklet->mNext = nullptr;
+
+    if (latency > mMaxQueueLatency)
+    {
+        mMaxQueueLatency = latency;
+    }
+
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    RunTasklet(*tasklet);
+#else
+    tasklet->RunTask();
+#endif
 }
 
+#else // OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+
 void Tasklet::Scheduler::ProcessQueuedTasklets(void)
 {
     Tasklet *tail = mTail;
@@ -90,8 +233,15 @@ void Tasklet::Scheduler::ProcessQueuedTasklets(void)
         }
 
         tasklet->mNext = nullptr;
+
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+        RunTasklet(*tasklet);
+#else
         tasklet->RunTask();
+#endif
     }
 }
 
+#endif // OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+
 } // namespace ot
@@ -40,8 +40,10 @@
 
 #include <openthread/tasklet.h>
 
+#include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/time.hpp"
 
 namespace ot {
 
@@ -79,7 +81,17 @@ public:
          */
         Scheduler(void)
             : mTail(nullptr)
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+            , mHighPriorityTail(nullptr)
+            , mMaxQueueLatency(0)
+#endif
         {
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+            for (TagProfile &profile : mTagProfiles)
+            {
+                profile.Clear();
+            }
+#endif
         }
 
         /**
@@ -89,7 +101,11 @@ public:
          * @retval FALSE  If there are no tasklets pending.
          *
          */
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+        bool AreTaskletsPending(void) const { return (mTail != nullptr) || (mHighPriorityTail != nullptr); }
+#else
         bool AreTaskletsPending(void) const { return mTail != nullptr; }
+#endif
 
         /**
          * This method processes all tasklets queued when this is called.
@@ -97,12 +113,95 @@ public:
          */
         void ProcessQueuedTasklets(void);
 
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+        /**
+         * This method returns the maximum time any tasklet has spent queued before running.
+         *
+         * @returns The maximum observed tasklet queue latency (in milliseconds).
+         *
+         */
+        uint32_t GetMaxQueueLatency(void) const { return mMaxQueueLatency; }
+#endif
+
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+        /**
+         * This constant specifies the number of distinct affinity tags tracked in the execution profile.
+         *
+         */
+        static constexpr uint8_t kNumAffinityTags = OPENTHREAD_CONFIG_TASKLET_AFFINITY_NUM_TAGS;
+
+        /**
+         * This structure holds the execution profile of tasklets with a given affinity tag.
+         *
+         */
+        struct TagProfile : public Clearable<TagProfile>
+        {
+            uint32_t mRunCount; ///< Number of tasklet runs with this tag.
+            uint32_t mRunTime;  ///< Cumulative execution time in msec (platform alarm granularity).
+        };
+
+        /**
+         * This method returns the execution profile of tasklets with a given affinity tag.
+         *
+         * @param[in] aTag  The affinity tag (tags beyond `kNumAffinityTags` are accounted under tag zero).
+         *
+         * @returns The execution profile of tasklets with @p aTag.
+         *
+         */
+        const TagProfile &GetTagProfile(uint8_t aTag) const
+        {
+            return mTagProfiles[(aTag < kNumAffinityTags) ? aTag : 0];
+        }
+
+        /**
+         * This method resets the per-tag execution profiles.
+         *
+         */
+        void ResetTagProfiles(void)
+        {
+            for (TagProfile &profile : mTagProfiles)
+            {
+                profile.Clear();
+            }
+        }
+#endif
+
     private:
+        static constexpr uint16_t kLowPriorityRunQuota = OPENTHREAD_CONFIG_TASKLET_LOW_PRIORITY_RUN_QUOTA;
+
         void PostTasklet(Tasklet &aTasklet);
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+        void RunNextTasklet(Tasklet *&aTail);
+#endif
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+        static Tasklet *FindLastWithTag(Tasklet *aTail, uint8_t aTag);
+        void            RunTasklet(Tasklet &aTasklet);
+#endif
 
         Tasklet *mTail; // A circular singly linked-list
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+        Tasklet *mHighPriorityTail; // A circular singly linked-list
+        uint32_t mMaxQueueLatency;
+#endif
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+        TagProfile mTagProfiles[kNumAffinityTags];
+#endif
     };
 
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    /**
+     * This enumeration defines the well-known tasklet affinity tags.
+     *
+     */
+    enum AffinityTag : uint8_t
+    {
+        kAffinityTagDefault       = 0, ///< Default tag (untagged tasklets).
+        kAffinityTagMac           = 1, ///< MAC / radio subsystem tasklets.
+        kAffinityTagMeshForwarder = 2, ///< Mesh forwarder tasklets.
+        kAffinityTagNet           = 3, ///< IPv6 / networking tasklets.
+    };
+#endif
+
     /**
      * This function reference is called when the tasklet is run.
      *
@@ -122,6 +221,12 @@ public:
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(nullptr)
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+        , mIsHighPriority(false)
+#endif
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+        , mTag(0)
+#endif
     {
     }
 
@@ -142,11 +247,51 @@ public:
      */
     bool IsPosted(void) const { return (mNext != nullptr); }
 
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+    /**
+     * This method marks the tasklet as high priority.
+     *
+     * A high-priority tasklet is placed on a separate scheduler lane which is always drained before any
+     * normal-priority tasklet runs and which is not subject to the per-pass run quota.
+     *
+     */
+    void SetHighPriority(void) { mIsHighPriority = true; }
+#endif
+
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    /**
+     * This method sets the affinity tag of the tasklet.
+     *
+     * The scheduler queues a newly posted tasklet after the last queued tasklet with the same tag, so same-tag
+     * tasklets run consecutively (preserving per-tag FIFO order). Tags at or beyond `Scheduler::kNumAffinityTags`
+     * are accounted under tag zero in the execution profile.
+     *
+     * @param[in] aTag  The affinity tag.
+     *
+     */
+    void SetTag(uint8_t aTag) { mTag = aTag; }
+
+    /**
+     * This method returns the affinity tag of the tasklet.
+     *
+     * @returns The affinity tag.
+     *
+     */
+    uint8_t GetTag(void) const { return mTag; }
+#endif
+
 private:
     void RunTask(void) { mHandler(*this); }
 
     Handler  mHandler;
     Tasklet *mNext;
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+    bool      mIsHighPriority;
+    TimeMilli mPostTime;
+#endif
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    uint8_t mTag;
+#endif
 };
 
 /**
@@ -114,30 +114,64 @@ void TimerMilli::RemoveAll(Instance &aInstance)
 
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
-    Timer *prev = nullptr;
-    Time   now(aAlarmApi.AlarmGetNow());
+    Time now(aAlarmApi.AlarmGetNow());
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+    uint16_t insertDepth = 0;
+#endif
 
     Remove(aTimer, aAlarmApi);
 
-    for (Timer &cur : mTimerList)
+    // Check the head and tail of the sorted list first. Most timers
+    // are armed (or re-armed) to fire either earliest or last, so the
+    // common patterns insert in O(1) without walking the list.
+
+    if (mTimerList.IsEmpty() || aTimer.DoesFireBefore(*mTimerList.GetHead(), now))
     {
-        if (aTimer.DoesFireBefore(cur, now))
+        if (mTimerList.IsEmpty())
         {
-            break;
+            mTimerListTail = &aTimer;
         }
 
-        prev = &cur;
-    }
-
-    if (prev == nullptr)
-    {
         mTimerList.Push(aTimer);
         SetAlarm(aAlarmApi);
     }
+    else if (!aTimer.DoesFireBefore(*mTimerListTail, now))
+    {
+        mTimerList.PushAfter(aTimer, *mTimerListTail);
+        mTimerListTail = &aTimer;
+    }
     else
     {
+        Timer *prev = nullptr;
+
+        for (Timer &cur : mTimerList)
+        {
+            if (aTimer.DoesFireBefore(cur, now))
+            {
+                break;
+            }
+
+            prev = &cur;
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+            insertDepth++;
+#endif
+        }
+
         mTimerList.PushAfter(aTimer, *prev);
+
+        if (prev == mTimerListTail)
+        {
+            mTimerListTail = &aTimer;
+        }
     }
+
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+    mNumTimers++;
+    mMaxNumTimers = OT_MAX(mMaxNumTimers, mNumTimers);
+    mNumInserts++;
+    mTotalInsertDepth += insertDepth;
+    mMaxInsertDepth = OT_MAX(mMaxInsertDepth, insertDepth);
+#endif
 }
 
 void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
@@ -147,15 +181,35 @@ void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
     if (mTimerList.GetHead() == &aTimer)
     {
         mTimerList.Pop();
+
+        if (mTimerList.IsEmpty())
+        {
+            mTimerListTail = nullptr;
+        }
+
         SetAlarm(aAlarmApi);
     }
     else
     {
-        IgnoreError(mTimerList.Remove(aTimer));
+        Timer *prev;
+
+        if (mTimerList.Find(aTimer, prev) == kErrorNone)
+        {
+            mTimerList.PopAfter(prev);
+
+            if (mTimerListTail == &aTimer)
+            {
+                mTimerListTail = prev;
+            }
+        }
     }
 
     aTimer.SetNext(&aTimer);
 
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+    mNumTimers--;
+#endif
+
 exit:
     return;
 }
@@ -207,8 +261,13 @@ void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
     while ((timer = mTimerList.Pop()) != nullptr)
     {
         timer->SetNext(timer);
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+        mNumTimers--;
+#endif
     }
 
+    mTimerListTail = nullptr;
+
     SetAlarm(aAlarmApi);
 }
 
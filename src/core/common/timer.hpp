@@ -121,6 +121,52 @@ protected:
     {
         friend class Timer;
 
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+    public:
+        /**
+         * This method returns the number of currently running timers.
+         *
+         * @returns The number of running timers.
+         *
+         */
+        uint16_t GetNumTimers(void) const { return mNumTimers; }
+
+        /**
+         * This method returns the maximum number of concurrently running timers seen so far.
+         *
+         * @returns The maximum number of running timers.
+         *
+         */
+        uint16_t GetMaxNumTimers(void) const { return mMaxNumTimers; }
+
+        /**
+         * This method returns the total number of timer insertions (`Add()` calls) so far.
+         *
+         * @returns The total number of timer insertions.
+         *
+         */
+        uint32_t GetNumInserts(void) const { return mNumInserts; }
+
+        /**
+         * This method returns the total number of sorted-list entries traversed by all insertions so far.
+         *
+         * The average insertion depth is `GetTotalInsertDepth() / GetNumInserts()`. Insertions served by the O(1)
+         * head/tail fast paths contribute zero depth.
+         *
+         * @returns The total insertion depth.
+         *
+         */
+        uint32_t GetTotalInsertDepth(void) const { return mTotalInsertDepth; }
+
+        /**
+         * This method returns the maximum sorted-list depth traversed by a single insertion so far.
+         *
+         * @returns The maximum insertion depth.
+         *
+         */
+        uint16_t GetMaxInsertDepth(void) const { return mMaxInsertDepth; }
+#endif // OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+
     protected:
         struct AlarmApi
         {
@@ -131,6 +177,14 @@ protected:
 
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+            , mTimerListTail(nullptr)
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+            , mNumTimers(0)
+            , mMaxNumTimers(0)
+            , mMaxInsertDepth(0)
+            , mNumInserts(0)
+            , mTotalInsertDepth(0)
+#endif
         {
         }
 
@@ -141,6 +195,14 @@ protected:
         void SetAlarm(const AlarmApi &aAlarmApi);
 
         LinkedList<Timer> mTimerList;
+        Timer *           mTimerListTail; // Last timer in the sorted list (`nullptr` when list is empty).
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+        uint16_t mNumTimers;
+        uint16_t mMaxNumTimers;
+        uint16_t mMaxInsertDepth;
+        uint32_t mNumInserts;
+        uint32_t mTotalInsertDepth;
+#endif
     };
 
     bool DoesFireBefore(const Timer &aSecondTimer, Time aNow) const;
@@ -181,6 +243,14 @@ public:
         {
         }
 
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+        using Timer::Scheduler::GetNumTimers;
+        using Timer::Scheduler::GetMaxNumTimers;
+        using Timer::Scheduler::GetNumInserts;
+        using Timer::Scheduler::GetTotalInsertDepth;
+        using Timer::Scheduler::GetMaxInsertDepth;
+#endif
+
     private:
         void Add(TimerMilli &aTimer) { Timer::Scheduler::Add(aTimer, sAlarmMilliApi); }
         void Remove(TimerMilli &aTimer) { Timer::Scheduler::Remove(aTimer, sAlarmMilliApi); }
@@ -324,6 +394,14 @@ public:
         {
         }
 
+#if OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+        using Timer::Scheduler::GetNumTimers;
+        using Timer::Scheduler::GetMaxNumTimers;
+        using Timer::Scheduler::GetNumInserts;
+        using Timer::Scheduler::GetTotalInsertDepth;
+        using Timer::Scheduler::GetMaxInsertDepth;
+#endif
+
     private:
         void Add(TimerMicro &aTimer) { Timer::Scheduler::Add(aTimer, sAlarmMicroApi); }
         void Remove(TimerMicro &aTimer) { Timer::Scheduler::Remove(aTimer, sAlarmMicroApi); }
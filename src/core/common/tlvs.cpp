@@ -269,4 +269,227 @@ exit:
     return error;
 }
 
+Error TlvBuilder::AppendBytes(const void *aBuffer, uint16_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aLength > 0);
+    VerifyOrExit(aLength <= mSize - mLength, error = kErrorNoBufs);
+
+    memcpy(mBuffer + mLength, aBuffer, aLength);
+    mLength += aLength;
+
+exit:
+    return error;
+}
+
+Error TlvBuilder::AppendTo(Message &aMessage) const
+{
+    return (mLength == 0) ? kErrorNone : aMessage.AppendBytes(mBuffer, mLength);
+}
+
+Error TlvBuilder::AppendTlv(uint8_t aType, const void *aValue, uint8_t aLength)
+{
+    Error    error      = kErrorNone;
+    uint16_t origLength = mLength;
+    Tlv      tlv;
+
+    OT_ASSERT(aLength <= Tlv::kBaseTlvMaxLength);
+
+    tlv.SetType(aType);
+    tlv.SetLength(aLength);
+    SuccessOrExit(error = AppendBytes(&tlv, sizeof(tlv)));
+    SuccessOrExit(error = AppendBytes(aValue, aLength));
+
+exit:
+    if (error != kErrorNone)
+    {
+        // Do not leave a partially written TLV (header without value)
+        // in the buffer.
+        mLength = origLength;
+    }
+
+    return error;
+}
+
+template <typename UintType> Error TlvBuilder::AppendUintTlv(uint8_t aType, UintType aValue)
+{
+    UintType value = Encoding::BigEndian::HostSwap<UintType>(aValue);
+
+    return AppendTlv(aType, &value, sizeof(UintType));
+}
+
+// Explicit instantiations of `TlvBuilder::AppendUintTlv<>()`
+template Error TlvBuilder::AppendUintTlv<uint8_t>(uint8_t aType, uint8_t aValue);
+template Error TlvBuilder::AppendUintTlv<uint16_t>(uint8_t aType, uint16_t aValue);
+template Error TlvBuilder::AppendUintTlv<uint32_t>(uint8_t aType, uint32_t aValue);
+
+TlvIndex::TlvIndex(const Message &aMessage)
+    : mMessage(aMessage)
+    , mNumEntries(0)
+    , mHasMoreTlvs(false)
+{
+    uint16_t offset       = aMessage.GetOffset();
+    uint16_t remainingLen = aMessage.GetLength();
+    Tlv      tlv;
+    uint32_t size;
+
+    VerifyOrExit(offset <= remainingLen);
+    remainingLen -= offset;
+
+    while (true)
+    {
+        Entry *entry;
+
+        SuccessOrExit(aMessage.Read(offset, tlv));
+
+        if (!tlv.IsExtended())
+        {
+            size = tlv.GetSize();
+        }
+        else
+        {
+            ExtendedTlv extTlv;
+
+            SuccessOrExit(aMessage.Read(offset, extTlv));
+
+            VerifyOrExit(extTlv.GetLength() <= (remainingLen - sizeof(ExtendedTlv)));
+            size = extTlv.GetSize();
+        }
+
+        VerifyOrExit(size <= remainingLen);
+
+        VerifyOrExit(mNumEntries < kMaxEntries, mHasMoreTlvs = true);
+
+        entry              = &mEntries[mNumEntries++];
+        entry->mType       = tlv.GetType();
+        entry->mIsExtended = tlv.IsExtended();
+        entry->mOffset     = offset;
+        entry->mSize       = static_cast<uint16_t>(size);
+
+        offset += size;
+        remainingLen -= size;
+    }
+
+exit:
+    return;
+}
+
+Error TlvIndex::Find(uint8_t aType, uint16_t *aOffset, uint16_t *aSize, bool *aIsExtendedTlv) const
+{
+    Error error = kErrorNotFound;
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        const Entry &entry = mEntries[index];
+
+        if (entry.mType != aType)
+        {
+            continue;
+        }
+
+        if (aOffset != nullptr)
+        {
+            *aOffset = entry.mOffset;
+        }
+
+        if (aSize != nullptr)
+        {
+            *aSize = entry.mSize;
+        }
+
+        if (aIsExtendedTlv != nullptr)
+        {
+            *aIsExtendedTlv = entry.mIsExtended;
+        }
+
+        error = kErrorNone;
+        ExitNow();
+    }
+
+    if (mHasMoreTlvs)
+    {
+        // The message contains more TLVs than the index capacity, fall
+        // back to a linear scan for the types beyond the indexed ones.
+        error = Tlv::Find(mMessage, aType, aOffset, aSize, aIsExtendedTlv);
+    }
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindTlvValueOffset(uint8_t aType, uint16_t &aValueOffset, uint16_t &aLength) const
+{
+    Error    error;
+    uint16_t offset;
+    uint16_t size;
+    bool     isExtendedTlv;
+
+    SuccessOrExit(error = Find(aType, &offset, &size, &isExtendedTlv));
+
+    if (!isExtendedTlv)
+    {
+        aValueOffset = offset + sizeof(Tlv);
+        aLength      = size - sizeof(Tlv);
+    }
+    else
+    {
+        aValueOffset = offset + sizeof(ExtendedTlv);
+        aLength      = size - sizeof(ExtendedTlv);
+    }
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindTlv(uint8_t aType, uint16_t aMaxSize, Tlv &aTlv) const
+{
+    Error    error;
+    uint16_t offset;
+    uint16_t size;
+
+    SuccessOrExit(error = Find(aType, &offset, &size, nullptr));
+
+    if (aMaxSize > size)
+    {
+        aMaxSize = size;
+    }
+
+    mMessage.ReadBytes(offset, &aTlv, aMaxSize);
+
+exit:
+    return error;
+}
+
+Error TlvIndex::FindTlv(uint8_t aType, void *aValue, uint8_t aLength) const
+{
+    Error    error;
+    uint16_t offset;
+    uint16_t length;
+
+    SuccessOrExit(error = FindTlvValueOffset(aType, offset, length));
+    VerifyOrExit(length >= aLength, error = kErrorParse);
+    mMessage.ReadBytes(offset, aValue, aLength);
+
+exit:
+    return error;
+}
+
+template <typename UintType> Error TlvIndex::FindUintTlv(uint8_t aType, UintType &aValue) const
+{
+    Error    error = kErrorNone;
+    uint16_t offset;
+
+    SuccessOrExit(error = Find(aType, &offset, nullptr, nullptr));
+    error = Tlv::ReadUintTlv<UintType>(mMessage, offset, aValue);
+
+exit:
+    return error;
+}
+
+// Explicit instantiations of `TlvIndex::FindUintTlv<>()`
+template Error TlvIndex::FindUintTlv<uint8_t>(uint8_t aType, uint8_t &aValue) const;
+template Error TlvIndex::FindUintTlv<uint16_t>(uint8_t aType, uint16_t &aValue) const;
+template Error TlvIndex::FindUintTlv<uint32_t>(uint8_t aType, uint32_t &aValue) const;
+
 } // namespace ot
@@ -431,6 +431,8 @@ protected:
     static const uint8_t kExtendedLength = 255; // Extended Length value.
 
 private:
+    friend class TlvIndex;
+
     static Error Find(const Message &aMessage, uint8_t aType, uint16_t *aOffset, uint16_t *aSize, bool *aIsExtendedTlv);
     static Error FindTlv(const Message &aMessage, uint8_t aType, void *aValue, uint8_t aLength);
     static Error AppendTlv(Message &aMessage, uint8_t aType, const void *aValue, uint8_t aLength);
@@ -468,6 +470,256 @@ private:
     uint16_t mLength;
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements a TLV builder that writes TLVs into a caller-provided scratch buffer and commits them to a
+ * message in a single append.
+ *
+ * Appending TLVs to a message one at a time traverses the message buffer chain on every append, and a failure
+ * mid-sequence leaves the message partially built. The builder instead writes all TLVs linearly into the
+ * contiguous scratch buffer; `AppendTo()` then grows the message once, so the message either receives all the
+ * TLVs or is left untouched.
+ *
+ */
+class TlvBuilder
+{
+public:
+    /**
+     * This constructor initializes the builder with a given scratch buffer.
+     *
+     * @param[in]  aBuffer   A pointer to the scratch buffer to write TLVs into.
+     * @param[in]  aSize     The size (number of bytes) of @p aBuffer.
+     *
+     */
+    TlvBuilder(uint8_t *aBuffer, uint16_t aSize)
+        : mBuffer(aBuffer)
+        , mSize(aSize)
+        , mLength(0)
+    {
+    }
+
+    /**
+     * This method returns the number of bytes written into the scratch buffer so far.
+     *
+     * @returns The number of written bytes.
+     *
+     */
+    uint16_t GetLength(void) const { return mLength; }
+
+    /**
+     * This method appends a TLV with a given type and value to the builder.
+     *
+     * @tparam     TlvType       The TLV type to append.
+     *
+     * @param[in]  aValue        A buffer containing the TLV value.
+     * @param[in]  aLength       The value length (in bytes).
+     *
+     * @retval kErrorNone     Successfully appended the TLV to the builder.
+     * @retval kErrorNoBufs   Insufficient room remaining in the scratch buffer.
+     *
+     */
+    template <typename TlvType> Error Append(const void *aValue, uint8_t aLength)
+    {
+        return AppendTlv(TlvType::kType, aValue, aLength);
+    }
+
+    /**
+     * This method appends a simple TLV with a single (non-integral) value to the builder.
+     *
+     * @tparam     SimpleTlvType The simple TLV type to append (must be a sub-class of `SimpleTlvInfo`)
+     *
+     * @param[in]  aValue        A reference to the object containing TLV's value.
+     *
+     * @retval kErrorNone     Successfully appended the TLV to the builder.
+     * @retval kErrorNoBufs   Insufficient room remaining in the scratch buffer.
+     *
+     */
+    template <typename SimpleTlvType> Error Append(const typename SimpleTlvType::ValueType &aValue)
+    {
+        return AppendTlv(SimpleTlvType::kType, &aValue, sizeof(aValue));
+    }
+
+    /**
+     * This method appends a simple TLV with a single integral value to the builder.
+     *
+     * @tparam     UintTlvType   The simple TLV type to append (must be a sub-class of `UintTlvInfo`)
+     *
+     * @param[in]  aValue        An unsigned int value to use as TLV's value.
+     *
+     * @retval kErrorNone     Successfully appended the TLV to the builder.
+     * @retval kErrorNoBufs   Insufficient room remaining in the scratch buffer.
+     *
+     */
+    template <typename UintTlvType> Error Append(typename UintTlvType::UintValueType aValue)
+    {
+        return AppendUintTlv(UintTlvType::kType, aValue);
+    }
+
+    /**
+     * This method appends a sequence of raw bytes (e.g., an already constructed TLV) to the builder.
+     *
+     * @param[in]  aBuffer   A pointer to the bytes to append.
+     * @param[in]  aLength   The number of bytes to append.
+     *
+     * @retval kErrorNone     Successfully appended the bytes to the builder.
+     * @retval kErrorNoBufs   Insufficient room remaining in the scratch buffer.
+     *
+     */
+    Error AppendBytes(const void *aBuffer, uint16_t aLength);
+
+    /**
+     * This method commits all the TLVs written into the builder to a message in a single append.
+     *
+     * On failure the message is left unchanged.
+     *
+     * @param[in]  aMessage  A reference to the message to append to.
+     *
+     * @retval kErrorNone     Successfully appended the TLVs to the message.
+     * @retval kErrorNoBufs   Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendTo(Message &aMessage) const;
+
+private:
+    Error AppendTlv(uint8_t aType, const void *aValue, uint8_t aLength);
+    template <typename UintType> Error AppendUintTlv(uint8_t aType, UintType aValue);
+
+    uint8_t *mBuffer;
+    uint16_t mSize;
+    uint16_t mLength;
+};
+
+/**
+ * This class represents an offset index of the TLVs in a received message.
+ *
+ * The index is built in a single pass over the message and can then answer repeated TLV searches without
+ * rescanning the message, unlike the static `Tlv::Find()` methods which scan from the start of the message on
+ * every call. If the message contains more TLVs than the index capacity, searches for types beyond the indexed
+ * ones fall back to a linear scan.
+ *
+ */
+class TlvIndex
+{
+public:
+    /**
+     * This constructor initializes the index from a given message.
+     *
+     * The TLVs between the message offset and the message length are indexed in a single pass. The index only
+     * stores offsets, so @p aMessage must outlive the index and must not be modified while the index is in use.
+     *
+     * @param[in]   aMessage    The message whose TLVs to index.
+     *
+     */
+    explicit TlvIndex(const Message &aMessage);
+
+    /**
+     * This method returns the message associated with the index.
+     *
+     * @returns A reference to the message associated with the index.
+     *
+     */
+    const Message &GetMessage(void) const { return mMessage; }
+
+    /**
+     * This method obtains the offset of a TLV with a given type (mirror of `Tlv::FindTlvOffset()`).
+     *
+     * @param[in]   aType       The Type value to search for.
+     * @param[out]  aOffset     A reference to the offset of the TLV.
+     *
+     * @retval kErrorNone       Successfully found the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     *
+     */
+    Error FindTlvOffset(uint8_t aType, uint16_t &aOffset) const { return Find(aType, &aOffset, nullptr, nullptr); }
+
+    /**
+     * This method obtains the value offset and length of a TLV with a given type (mirror of
+     * `Tlv::FindTlvValueOffset()`).
+     *
+     * @param[in]   aType         The Type value to search for.
+     * @param[out]  aValueOffset  The offset where the value starts.
+     * @param[out]  aLength       The length of the value.
+     *
+     * @retval kErrorNone       Successfully found the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     *
+     */
+    Error FindTlvValueOffset(uint8_t aType, uint16_t &aValueOffset, uint16_t &aLength) const;
+
+    /**
+     * This method searches for a given TLV type and reads the TLV into a given `TlvType` instance (mirror of
+     * `Tlv::FindTlv<TlvType>()`).
+     *
+     * @tparam      TlvType     The TlvType to search for (must be a sub-class of `Tlv`).
+     *
+     * @param[out]  aTlv        A reference to the TLV that will be copied to.
+     *
+     * @retval kErrorNone       Successfully copied the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     *
+     */
+    template <typename TlvType> Error FindTlv(TlvType &aTlv) const
+    {
+        return FindTlv(TlvType::kType, sizeof(TlvType), aTlv);
+    }
+
+    /**
+     * This method searches for a simple TLV with a single non-integral value and reads its value (mirror of
+     * `Tlv::Find<SimpleTlvType>()`).
+     *
+     * @tparam       SimpleTlvType   The simple TLV type to find (must be a sub-class of `SimpleTlvInfo`)
+     *
+     * @param[out]   aValue          A reference to the value object to output the read value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     *
+     */
+    template <typename SimpleTlvType> Error Find(typename SimpleTlvType::ValueType &aValue) const
+    {
+        return FindTlv(SimpleTlvType::kType, &aValue, sizeof(aValue));
+    }
+
+    /**
+     * This method searches for a simple TLV with a single integral value and reads its value (mirror of
+     * `Tlv::Find<UintTlvType>()`).
+     *
+     * @tparam       UintTlvType     The simple TLV type to find (must be a sub-class of `UintTlvInfo`)
+     *
+     * @param[out]   aValue          A reference to an unsigned int value to output the TLV's value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     *
+     */
+    template <typename UintTlvType> Error Find(typename UintTlvType::UintValueType &aValue) const
+    {
+        return FindUintTlv(UintTlvType::kType, aValue);
+    }
+
+private:
+    static constexpr uint8_t kMaxEntries = 20; // Maximum number of TLVs the index can hold.
+
+    struct Entry
+    {
+        uint8_t  mType;       // The TLV type.
+        bool     mIsExtended; // Whether the TLV is an Extended TLV.
+        uint16_t mOffset;     // Offset of the TLV in the message.
+        uint16_t mSize;       // Size (number of bytes) of the TLV (including its type and length fields).
+    };
+
+    Error Find(uint8_t aType, uint16_t *aOffset, uint16_t *aSize, bool *aIsExtendedTlv) const;
+    Error FindTlv(uint8_t aType, uint16_t aMaxSize, Tlv &aTlv) const;
+    Error FindTlv(uint8_t aType, void *aValue, uint8_t aLength) const;
+    template <typename UintType> Error FindUintTlv(uint8_t aType, UintType &aValue) const;
+
+    const Message &mMessage;
+    uint8_t        mNumEntries;
+    bool           mHasMoreTlvs; // Whether the message contains more TLVs than the index capacity.
+    Entry          mEntries[kMaxEntries];
+};
+
 /**
  * This class defines constants for a TLV.
  *
@@ -68,6 +68,12 @@ void TrickleTimer::Start(Mode aMode, uint32_t aIntervalMin, uint32_t aIntervalMa
     StartNewInterval();
 }
 
+void TrickleTimer::SetIntervalMax(uint32_t aIntervalMax)
+{
+    mIntervalMax = OT_MAX(aIntervalMax, mIntervalMin);
+    mInterval    = OT_MIN(mInterval, mIntervalMax);
+}
+
 void TrickleTimer::IndicateConsistent(void)
 {
     if (mCounter < kInfiniteRedundancyConstant)
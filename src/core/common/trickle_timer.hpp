@@ -131,6 +131,17 @@ public:
      */
     void Stop(void) { TimerMilli::Stop(); }
 
+    /**
+     * This method changes the maximum interval (`Imax`) of a running trickle timer.
+     *
+     * The new maximum interval is clamped to be no smaller than the minimum interval (`Imin`). The change takes
+     * effect from the next interval; the time already scheduled in the current interval is not modified.
+     *
+     * @param[in]  aIntervalMax   The maximum interval for the timer in milliseconds.
+     *
+     */
+    void SetIntervalMax(uint32_t aIntervalMax);
+
     /**
      * This method indicates to the trickle timer a 'consistent' event.
      *
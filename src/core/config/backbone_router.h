@@ -113,4 +113,16 @@
 #define OPENTHREAD_CONFIG_NDPROXY_TABLE_ENTRY_NUM 250
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+ *
+ * Define as 1 to maintain a hash index over the ND Proxy table keyed by the DUA IID, so DUA lookups (Backbone Query
+ * handling, DAD checks) cost a bucket walk instead of a linear scan of the whole table. Recommended for Backbone
+ * Routers configured with a large `OPENTHREAD_CONFIG_NDPROXY_TABLE_ENTRY_NUM`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_NDPROXY_TABLE_HASH_INDEX_ENABLE 0
+#endif
+
 #endif // CONFIG_BACKBONE_ROUTER_H_
@@ -75,4 +75,19 @@
 #define OPENTHREAD_CONFIG_BORDER_AGENT_UDP_PORT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE
+ *
+ * Define to 1 for the Border Agent to serve commissioner MGMT_ACTIVE_GET and MGMT_PENDING_GET requests from the
+ * device's own Operational Datasets instead of forwarding them to the leader.
+ *
+ * The local datasets are kept in sync with the leader through MLE, so they act as an always-current cache: an
+ * external commissioner polling datasets is answered in one hop, removing the leader round trip and its mesh
+ * airtime from the polling loop.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE
+#define OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE 0
+#endif
+
 #endif // CONFIG_BORDER_ROUTER_H_
@@ -136,4 +136,47 @@
 #define OPENTHREAD_CONFIG_CHANNEL_MANAGER_CCA_FAILURE_THRESHOLD (0xffff * 14 / 100)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE
+ *
+ * Define as 1 to enable continuous per-channel quality scoring in Channel Manager.
+ *
+ * When enabled (together with auto-channel-selection), Channel Manager periodically samples the CCA failure rate,
+ * the MAC retransmission rate and the average neighbor link margin on the current channel, maintains a smoothed
+ * per-channel transmit quality score, and blends it with the `ChannelMonitor` occupancy data when evaluating
+ * channels. A channel change is scheduled automatically once a better channel wins the evaluation for
+ * `OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_HYSTERESIS_COUNT` consecutive samples.
+ *
+ * Applicable only if Channel Manager and Channel Monitor features are enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SAMPLE_INTERVAL
+ *
+ * The interval (in seconds) between two channel quality samples.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SAMPLE_INTERVAL
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SAMPLE_INTERVAL 60
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_HYSTERESIS_COUNT
+ *
+ * The number of consecutive quality samples in which the same channel must beat the current channel (by
+ * `OPENTHREAD_CONFIG_CHANNEL_MANAGER_THRESHOLD_TO_CHANGE_CHANNEL`) before a channel change is scheduled.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_HYSTERESIS_COUNT
+#define OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_HYSTERESIS_COUNT 3
+#endif
+
 #endif // CONFIG_CHANNEL_MANAGER_H_
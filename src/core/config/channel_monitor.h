@@ -92,4 +92,33 @@
 #define OPENTHREAD_CONFIG_CHANNEL_MONITOR_SAMPLE_WINDOW 960
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+ *
+ * Define to 1 to offload the channel sampling to the radio using `otPlatRadioEnergyScanBatch()`.
+ *
+ * When enabled, the radio runs the sampling sequence autonomously and reports aggregated per-channel counts once
+ * per batch, so the host wakes once per report instead of once per sample. Requires platform support; if the
+ * radio does not implement batched scanning, Channel Monitoring falls back to the sampling timer.
+ *
+ * Applicable only if Channel Monitoring feature is enabled (i.e., `OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_SAMPLES_PER_REPORT
+ *
+ * The number of sample intervals aggregated by the radio into one batched scan report.
+ *
+ * Applicable only if the Channel Monitoring offload is enabled (i.e.,
+ * `OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_SAMPLES_PER_REPORT
+#define OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_SAMPLES_PER_REPORT 32
+#endif
+
 #endif // CONFIG_CHANNEL_MONITOR_H_
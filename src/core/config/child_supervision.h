@@ -91,4 +91,33 @@
 #define OPENTHREAD_CONFIG_CHILD_SUPERVISION_MSG_NO_ACK_REQUEST 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CHILD_SUPERVISION_BUCKETING_ENABLE
+ *
+ * Define as 1 to enable bucketed supervision scheduling on parent.
+ *
+ * Applicable only if child supervision feature is enabled (i.e., `OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE` is set).
+ *
+ * Without bucketing, sleepy children that attached at the same time all become due for a supervision message in the
+ * same one-second tick, producing a burst of transmissions. With bucketing, each child is deterministically assigned
+ * (by its child table index) to one of `OPENTHREAD_CONFIG_CHILD_SUPERVISION_NUM_BUCKETS` slots, staggering the
+ * supervision transmissions across consecutive ticks. A child's supervision message is delayed by at most the number
+ * of buckets (in seconds) beyond the configured supervision interval.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHILD_SUPERVISION_BUCKETING_ENABLE
+#define OPENTHREAD_CONFIG_CHILD_SUPERVISION_BUCKETING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CHILD_SUPERVISION_NUM_BUCKETS
+ *
+ * The number of supervision scheduling buckets (applicable when
+ * `OPENTHREAD_CONFIG_CHILD_SUPERVISION_BUCKETING_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CHILD_SUPERVISION_NUM_BUCKETS
+#define OPENTHREAD_CONFIG_CHILD_SUPERVISION_NUM_BUCKETS 8
+#endif
+
 #endif // CONFIG_CHILD_SUPERVISION_H_
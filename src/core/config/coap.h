@@ -47,6 +47,30 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+ *
+ * Define to 1 to keep a RAM index of the pending CoAP requests (next retransmission time, message ID, and
+ * token hash), so that the retransmission timer and response matching do not read the metadata of every
+ * pending request from the message buffers. Useful when many requests (e.g. RFC7641 observations) are
+ * pending at the same time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+ *
+ * Specifies the number of pending CoAP requests that can be indexed (per CoAP instance). When more requests
+ * are pending, the index is bypassed and the original linear walks are used until the queue empties.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
@@ -67,6 +91,30 @@
 #define OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+ *
+ * Define to 1 to enable the server-side CoAP Observe (RFC7641) engine. Registered observers are kept in pooled
+ * entries (peer endpoint, token, and observed resource), notifications are fanned out from one application-built
+ * payload with only the per-observer header (token, message ID, Observe option) built per observer, and an
+ * observer is dropped when its peer rejects a notification with a reset message.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE
+#define OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
+ *
+ * Specifies the maximum number of registered observers (per CoAP instance) when
+ * `OPENTHREAD_CONFIG_COAP_OBSERVE_SERVER_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
+#define OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
  *
@@ -87,6 +135,59 @@
 #define OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH 1024
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART
+ *
+ * This setting configures the number of concurrently outstanding Block2 (download) requests a CoAP client keeps in
+ * flight during a Block-Wise Transfer (RFC 7252 NSTART). Pipelining engages only when the total transfer size is
+ * known (the server included a Size2 option); otherwise the transfer proceeds in lock-step. Values above 1 improve
+ * sustained multi-hop throughput for large transfers such as firmware distribution.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_NSTART 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+ *
+ * Define to 1 to briefly defer empty ACK transmission for a confirmable request, so that a response emitted by the
+ * resource handler within the deferral window supersedes the empty ACK (the response itself acknowledges the
+ * request). This halves the CoAP messages on paths where handlers respond quickly.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE
+#define OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_TIMEOUT
+ *
+ * Specifies how long (in milliseconds) an empty ACK may be deferred waiting for a piggybacked response. Must be
+ * well below the CoAP `ACK_TIMEOUT` (2 seconds) so a slow handler does not trigger a peer retransmission.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_TIMEOUT
+#define OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_TIMEOUT 250
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_DEFERRED_ACKS
+ *
+ * Specifies the maximum number of empty ACKs that can be deferred at the same time. When the table is full, further
+ * empty ACKs are sent immediately.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_COAP_DEFERRED_ACK_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_DEFERRED_ACKS
+#define OPENTHREAD_CONFIG_COAP_MAX_DEFERRED_ACKS 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
  *
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for Coex Monitor.
+ *
+ */
+
+#ifndef CONFIG_COEX_MONITOR_H_
+#define CONFIG_COEX_MONITOR_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+ *
+ * Define to 1 to enable Coex Monitor support.
+ *
+ * Requires a radio platform implementing `otPlatRadioGetCoexMetrics()` (see
+ * `OPENTHREAD_CONFIG_PLATFORM_RADIO_COEX_ENABLE`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+#define OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COEX_MONITOR_SAMPLE_INTERVAL
+ *
+ * The sample interval in milliseconds used by Coex Monitor.
+ *
+ * Every interval the radio coex metrics counters are pulled once and the deltas against the previous pull form one
+ * aggregation window.
+ *
+ * Applicable only if Coex Monitor feature is enabled (i.e., `OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COEX_MONITOR_SAMPLE_INTERVAL
+#define OPENTHREAD_CONFIG_COEX_MONITOR_SAMPLE_INTERVAL 10000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COEX_MONITOR_HISTORY_SIZE
+ *
+ * The number of aggregation windows retained by Coex Monitor for min/avg/max stats.
+ *
+ * Applicable only if Coex Monitor feature is enabled (i.e., `OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COEX_MONITOR_HISTORY_SIZE
+#define OPENTHREAD_CONFIG_COEX_MONITOR_HISTORY_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COEX_MONITOR_GRANT_DENIAL_THRESHOLD
+ *
+ * The grant denial threshold (per aggregation window) used by Coex Monitor.
+ *
+ * When the number of grant denials (grant glitches plus tx/rx grant wait timeouts) within one window reaches this
+ * threshold, `OT_CHANGED_COEX_METRICS` is signaled. The event is edge-triggered: it is signaled again only after a
+ * window below the threshold is observed.
+ *
+ * Applicable only if Coex Monitor feature is enabled (i.e., `OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COEX_MONITOR_GRANT_DENIAL_THRESHOLD
+#define OPENTHREAD_CONFIG_COEX_MONITOR_GRANT_DENIAL_THRESHOLD 100
+#endif
+
+#endif // CONFIG_COEX_MONITOR_H_
@@ -55,4 +55,31 @@
 #define OPENTHREAD_CONFIG_COMMISSIONER_MAX_JOINER_ENTRIES 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+ *
+ * Define to 1 to pipeline Joiner DTLS sessions on the Commissioner.
+ *
+ * When enabled, a Relay Receive arriving from a different Joiner while a DTLS session is active is buffered
+ * instead of dropped, and is replayed as soon as the active session ends, so consecutive joins proceed
+ * back-to-back instead of waiting for each Joiner's handshake retransmission.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+#define OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_QUEUE_SIZE
+ *
+ * The maximum number of buffered Relay Receive messages awaiting a free Joiner DTLS session (at most one per
+ * pending Joiner).
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_QUEUE_SIZE
+#define OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_QUEUE_SIZE 4
+#endif
+
 #endif // CONFIG_COMMISSIONER_H_
@@ -150,4 +150,42 @@
 #define OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_RECURSION_DESIRED_FLAG 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+ *
+ * Define to 1 to enable caching of IPv6 address resolution responses by DNS client.
+ *
+ * When enabled, the DNS client keeps a small cache of positive and negative (name error) IPv6 address resolution
+ * results honoring the record TTL. An address resolution request for a cached (and not yet expired) host name is
+ * answered from the cache without any transmission to the server. Note that in this case the callback is invoked
+ * directly from within the `otDnsClientResolveAddress()` call itself.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NUM_ENTRIES
+ *
+ * Specifies the number of entries in the DNS client response cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NUM_ENTRIES
+#define OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NUM_ENTRIES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NEGATIVE_TTL
+ *
+ * Specifies the time-to-live (in seconds) used for negative (name error) entries in the DNS client response cache.
+ *
+ * The DNS client does not parse the SOA record from the authority section, so the negative caching TTL is a fixed
+ * configured value rather than the SOA minimum TTL.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NEGATIVE_TTL
+#define OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NEGATIVE_TTL 60
+#endif
+
 #endif // CONFIG_DNS_CLIENT_H_
@@ -75,4 +75,99 @@
 #define OPENTHREAD_CONFIG_DNSSD_QUERY_TIMEOUT 6000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+ *
+ * Define to 1 to cache the precompressed answer sections of browse (PTR) responses built from the SRP server
+ * records, so that repeated browse queries for the same service are answered by appending prebuilt bytes.
+ *
+ * Cached entries are invalidated whenever the SRP records change. Applicable only when
+ * `OPENTHREAD_CONFIG_SRP_SERVER_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENTRIES
+ *
+ * Specifies the number of service types for which a browse answer can be cached at the same time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENTRIES 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ANSWER_SIZE
+ *
+ * Specifies the maximum size (in bytes) of a cached browse answer. Larger answers are not cached.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ANSWER_SIZE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ANSWER_SIZE 512
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+ *
+ * Define to 1 to enable the built-in upstream query forwarder. Queries that neither the SRP records nor the
+ * registered query callbacks can answer are then relayed to a configured upstream resolver over a persistent UDP
+ * socket, with a transaction table supporting multiple concurrent outstanding queries and per-name negative
+ * caching of NXDOMAIN answers. The upstream resolver is configured with `Server::SetUpstreamResolver()`; forwarding
+ * stays disabled until a resolver address is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_MAX_TRANSACTIONS
+ *
+ * Specifies the number of concurrently outstanding upstream query transactions (applicable when
+ * `OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_MAX_TRANSACTIONS
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_MAX_TRANSACTIONS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_TIMEOUT
+ *
+ * Specifies the wait time (in msec) for an upstream resolver response before answering the client with a server
+ * failure (applicable when `OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_TIMEOUT
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_TIMEOUT 3000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_NEGATIVE_CACHE_ENTRIES
+ *
+ * Specifies the number of names for which a negative (NXDOMAIN) upstream answer is cached at the same time
+ * (applicable when `OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_NEGATIVE_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_NEGATIVE_CACHE_ENTRIES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+ *
+ * Define to 1 to aggregate identical concurrent queries. While a query for a name is outstanding, further client
+ * queries for the same name share its resolution instead of starting their own: the query callbacks see a single
+ * subscription per name (unsubscribed only when the last sharing query finalizes) and at most one upstream query
+ * per name is in flight, with the one upstream answer relayed to every waiting client. This collapses the query
+ * load caused by many clients browsing the same service concurrently (e.g. during a commissioning window).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE 0
+#endif
+
 #endif // CONFIG_DNSSD_SERVER_H_
@@ -50,6 +50,46 @@
 #define OPENTHREAD_CONFIG_DTLS_MAX_CONTENT_LEN MBEDTLS_SSL_MAX_CONTENT_LEN
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_MAX_BUFFERING
+ *
+ * The total number of bytes mbedTLS may use to buffer out-of-order and fragmented DTLS handshake messages.
+ *
+ * Buffered messages allow a multi-record flight which arrives out of order or fragmented across datagrams to be
+ * consumed without waiting for peer retransmission. The value is applied as `MBEDTLS_SSL_DTLS_MAX_BUFFERING` when
+ * building with the OpenThread mbedTLS configuration and scales with `MBEDTLS_SSL_MAX_CONTENT_LEN` by default.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_MAX_BUFFERING
+#define OPENTHREAD_CONFIG_DTLS_MAX_BUFFERING (MBEDTLS_SSL_MAX_CONTENT_LEN * 4)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+ *
+ * Define to 1 to cache the joiner-side DTLS session in settings and offer session resumption on the next
+ * connect.
+ *
+ * When the peer (commissioner) accepts the resumption, re-commissioning after an intermittent failure completes
+ * without repeating the full EC-JPAKE handshake flights. When the peer declines, the handshake proceeds as a
+ * full handshake.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+#define OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_MAX_LENGTH
+ *
+ * Specifies the maximum length (in bytes) of a serialized DTLS session cached in settings. A session which
+ * serializes to a larger size is not cached.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_MAX_LENGTH
+#define OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_MAX_LENGTH 256
+#endif
+
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE || OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE || \
     OPENTHREAD_CONFIG_COMMISSIONER_ENABLE || OPENTHREAD_CONFIG_JOINER_ENABLE
 #define OPENTHREAD_CONFIG_DTLS_ENABLE 1
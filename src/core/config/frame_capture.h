@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for the MAC frame capture tap.
+ *
+ */
+
+#ifndef CONFIG_FRAME_CAPTURE_H_
+#define CONFIG_FRAME_CAPTURE_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+ *
+ * Define to 1 to enable the MAC frame capture tap.
+ *
+ * When enabled, transmitted and received MAC frames are copied into a fixed-size ring buffer with pcap record
+ * framing, to be drained by a host-side consumer (e.g., over the daemon socket or a spinel debug stream). The
+ * capture is lossy by design: when the ring is full, new frames are dropped (and counted) rather than blocking or
+ * slowing down the MAC processing.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+#define OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FRAME_CAPTURE_BUFFER_SIZE
+ *
+ * The size (in bytes) of the MAC frame capture ring buffer (applicable when
+ * `OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE` is enabled). Each captured frame occupies a 16-byte pcap record header
+ * plus its PSDU.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FRAME_CAPTURE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_FRAME_CAPTURE_BUFFER_SIZE 2048
+#endif
+
+#endif // CONFIG_FRAME_CAPTURE_H_
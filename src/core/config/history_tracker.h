@@ -103,4 +103,16 @@
 #define OPENTHREAD_CONFIG_HISTORY_TRACKER_NEIGHBOR_LIST_SIZE 64
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HISTORY_TRACKER_FWD_QUEUE_LIST_SIZE
+ *
+ * Specifies the maximum number of entries in the mesh forwarder queue depth history list.
+ *
+ * Can be set to zero to configure History Tracker module not to collect any queue depth history.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_HISTORY_TRACKER_FWD_QUEUE_LIST_SIZE
+#define OPENTHREAD_CONFIG_HISTORY_TRACKER_FWD_QUEUE_LIST_SIZE 16
+#endif
+
 #endif // CONFIG_HISTORY_TRACKER_H_
@@ -147,6 +147,18 @@
 #define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME 5
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES
+ *
+ * The number of entries in the MPL Seed Set duplicate cache. The cache front-ends the Seed Set scan so that
+ * recently seen (Seed ID, Sequence) values are rejected in O(1). Must be a power of two. Set to zero to
+ * disable the cache.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_DYNAMIC_INTERVAL_ENABLE
  *
@@ -160,6 +172,23 @@
 #define OPENTHREAD_CONFIG_MPL_DYNAMIC_INTERVAL_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MPL_SUBSCRIPTION_AWARE_FORWARDING_ENABLE
+ *
+ * Define as 1 to enable subscription-aware MPL forwarding (FTD only).
+ *
+ * When enabled, a router only buffers a received MPL data message for trickle retransmission when the destination
+ * multicast group has an interested listener in its subtree, i.e., the device itself is subscribed to the group or
+ * one of its children has registered the address. Datagrams for groups without local listeners are still received
+ * and delivered but not retransmitted, cutting the airtime wasted on sparse-membership groups (e.g., lighting
+ * control). Well-known groups that all devices subscribe to (e.g., the realm-local All Thread Nodes address) are
+ * unaffected since the subscription check always passes for them.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MPL_SUBSCRIPTION_AWARE_FORWARDING_ENABLE
+#define OPENTHREAD_CONFIG_MPL_SUBSCRIPTION_AWARE_FORWARDING_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_UNSECURE_TRAFFIC_MANAGED_BY_STACK_ENABLE
  *
@@ -177,6 +206,156 @@
 #define OPENTHREAD_CONFIG_UNSECURE_TRAFFIC_MANAGED_BY_STACK_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+ *
+ * Define as 1 to enable the UDP socket demux cache. Inbound datagram demux then uses a port-hashed lookup table
+ * (maintained lazily over the open socket list) instead of scanning the socket linked-list for every datagram. This
+ * helps on builds with many open sockets (e.g., a Border Router running TMF, CoAP, DNS, SRP, and application
+ * sockets).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_SIZE
+ *
+ * The number of entries in the UDP socket demux cache (applicable when
+ * `OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE` is enabled). Should be sized to at least the expected number of
+ * concurrently bound ports; hash collisions fall back to the linked-list scan.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_SIZE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+ *
+ * Define as 1 to bound the message-buffer damage any one application UDP flow can do to the control plane. Inbound
+ * datagrams to application sockets are dropped when the number of free message buffers falls below a reserve (left
+ * for MLE/TMF sockets, which bypass the limiter) or when the socket exceeds its per-window receive byte budget.
+ * Drops are counted per socket.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+#define OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_RX_BACKLOG_RESERVED_BUFFERS
+ *
+ * The number of free message buffers reserved for control-plane (MLE/TMF) sockets. Inbound datagrams to other
+ * sockets are dropped while the free buffer count is below this reserve.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_RX_BACKLOG_RESERVED_BUFFERS
+#define OPENTHREAD_CONFIG_UDP_RX_BACKLOG_RESERVED_BUFFERS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_RX_BACKLOG_BYTES_PER_WINDOW
+ *
+ * The maximum number of UDP payload bytes a single application socket may receive within one accounting window.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_RX_BACKLOG_BYTES_PER_WINDOW
+#define OPENTHREAD_CONFIG_UDP_RX_BACKLOG_BYTES_PER_WINDOW 8192
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_RX_BACKLOG_WINDOW
+ *
+ * The per-socket receive accounting window duration (in milliseconds).
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_RX_BACKLOG_WINDOW
+#define OPENTHREAD_CONFIG_UDP_RX_BACKLOG_WINDOW 1000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_UDP_RX_BACKLOG_NUM_TRACKED_SOCKETS
+ *
+ * The number of application sockets for which receive accounting state is kept. When the table is full the entry
+ * with the oldest accounting window is recycled.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_RX_BACKLOG_NUM_TRACKED_SOCKETS
+#define OPENTHREAD_CONFIG_UDP_RX_BACKLOG_NUM_TRACKED_SOCKETS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+ *
+ * Define as 1 to enable the IPv6 flow classification cache. `Ip6::HandleDatagram()` then caches the unicast
+ * classification verdict (receive locally, forward to Thread, forward to host) per source/destination address
+ * pair, so established flows skip the netif address scan and route lookup on every datagram. The cache is
+ * invalidated on address, role, and Network Data changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_FLOW_CACHE_SIZE
+ *
+ * The number of entries in the IPv6 flow classification cache (applicable when
+ * `OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE` is enabled). Entries are direct-mapped by a hash of the address
+ * pair; a collision simply evicts the previous flow.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_FLOW_CACHE_SIZE
+#define OPENTHREAD_CONFIG_IP6_FLOW_CACHE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+ *
+ * Define as 1 to maintain per-netif address lookup filters. A compact hash bitmap is kept over the unicast and
+ * multicast address lists (rebuilt on the rare address add/remove) allowing `HasUnicastAddress()` and
+ * `IsMulticastSubscribed()` to reject non-matching destinations without walking the address linked lists, which
+ * helps on routers carrying many addresses (DUA, SLAAC, service ALOCs).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+#define OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
+ *
+ * Define to 1 to reuse the received message when sending an ICMPv6 Echo Reply. The Echo Request message is then
+ * rewritten in place (ICMPv6 type updated and IPv6 header replaced on send) instead of allocating a new message
+ * and copying the full payload, so replying costs no message buffer allocations.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
+#define OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT
+ *
+ * Specifies the maximum number of ICMPv6 Echo Requests answered per source address per second. Requests from a
+ * source beyond this rate are dropped (counted but not answered), protecting the message buffer pool against ping
+ * storms. Zero disables per-source rate limiting.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT
+#define OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TCP_ENABLE
  *
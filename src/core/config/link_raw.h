@@ -45,4 +45,19 @@
 #define OPENTHREAD_CONFIG_LINK_RAW_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+ *
+ * Define to 1 to enable the Link Raw receive frame filter.
+ *
+ * When enabled, a programmable filter (frame-type mask, PAN ID and source short address match) can be applied to
+ * the raw link-layer receive path with `otLinkRawSetRxFilter()` (settable over spinel with
+ * `SPINEL_PROP_MAC_RAW_RX_FILTER`), so that promiscuous/sniffer applications are delivered only matching frames.
+ * On an RCP the filter runs on the co-processor, discarding non-matching frames before they occupy the host link.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+#define OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE 0
+#endif
+
 #endif // CONFIG_LINK_RAW_H_
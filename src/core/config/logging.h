@@ -425,4 +425,28 @@
 #define OPENTHREAD_CONFIG_LOG_MAX_SIZE 150
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+ *
+ * Define to 1 to defer the platform log output. Log strings are captured into a ring buffer on the hot path and
+ * emitted to `otPlatLog()` later from `otLoggingFlushDeferred()`, keeping the backend write (e.g., a syscall on
+ * POSIX) off the paths being logged. When the ring is full, new logs are dropped and counted.
+ *
+ * Not applicable when `OPENTHREAD_CONFIG_LOG_DEFINE_AS_MACRO_ONLY` is used.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+#define OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE
+ *
+ * The number of log entries the deferred log ring buffer can hold.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE
+#define OPENTHREAD_CONFIG_LOG_DEFERRED_RING_SIZE 16
+#endif
+
 #endif // CONFIG_LOGGING_H_
@@ -0,0 +1,62 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes compile-time configurations for 6LoWPAN header compression.
+ *
+ */
+
+#ifndef CONFIG_LOWPAN_H_
+#define CONFIG_LOWPAN_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+ *
+ * Define to 1 to cache the 6LoWPAN contexts from the Thread Network Data in the `Lowpan` module, so that the
+ * per-datagram context lookups during header compression and decompression do not parse the Network Data TLVs.
+ *
+ * The cache is rebuilt when the Thread Network Data changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENTRIES
+ *
+ * Specifies the number of 6LoWPAN contexts that can be cached. Lookups fall back to parsing the Network Data
+ * when it contains more contexts than can be cached.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENTRIES
+#define OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENTRIES 8
+#endif
+
+#endif // CONFIG_LOWPAN_H_
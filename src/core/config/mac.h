@@ -121,6 +121,28 @@
     (OPENTHREAD_CONFIG_MAC_DEFAULT_MAX_FRAME_RETRIES_INDIRECT + 1)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+ *
+ * Define to 1 to enable tracking a histogram of queue-to-air latency for direct frame transmissions.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+#define OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_BIN_COUNT
+ *
+ * The number of bins in the MAC transmit latency histogram. The bins use power-of-two boundaries, i.e., bin `n`
+ * (for `n >= 1`) counts transmissions with latency in range `[2^n, 2^(n+1))` msec, with bin zero covering `[0,2)`
+ * and the last bin also covering all larger latencies.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_BIN_COUNT
+#define OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_BIN_COUNT 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_MAX_TX_ATTEMPTS_INDIRECT_POLLS
  *
@@ -139,6 +161,51 @@
 #define OPENTHREAD_CONFIG_MAC_MAX_TX_ATTEMPTS_INDIRECT_POLLS 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+ *
+ * Define to 1 to cache the prepared indirect frame per sleepy child across transmit attempts.
+ *
+ * When enabled, after a failed indirect transmission the fully prepared (and secured) frame bytes are retained in the
+ * child table entry. The retransmission triggered by the next data poll from the same child then reuses the cached
+ * bytes directly, skipping the frame preparation (6LoWPAN compression) and MAC security (AES-CCM) processing which
+ * would otherwise be repeated on every poll. This can noticeably reduce parent CPU load with lossy sleepy children at
+ * the cost of `OT_RADIO_FRAME_MAX_SIZE` bytes of RAM per child table entry.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_OFF_CHANNEL_OP_TX_QUEUE_THRESHOLD
+ *
+ * Specifies the transmit queue depth (number of queued messages in `MeshForwarder` send queue) at or above which
+ * background off-channel radio operations (MLE Announcement transmissions and TMF energy scans) are deferred and
+ * retried later, yielding the radio to pending data traffic.
+ *
+ * A value of zero disables the deferral (off-channel operations are scheduled independently of the queue depth).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_OFF_CHANNEL_OP_TX_QUEUE_THRESHOLD
+#define OPENTHREAD_CONFIG_MAC_OFF_CHANNEL_OP_TX_QUEUE_THRESHOLD 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+ *
+ * Define to 1 to defer and coalesce source address match table updates using a per-child dirty bitmap.
+ *
+ * When enabled, changes to a child's pending-frame state mark the child as dirty and the radio source match table is
+ * reconciled from a tasklet, so a burst of indirect message queue changes (e.g., many sleepy children polling at
+ * once) results in at most one radio table add/clear per child instead of one per change. This mainly benefits
+ * platforms where each table update is a separate transaction to the radio co-processor.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+#define OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_CSL_REQUEST_AHEAD_US
  *
@@ -149,6 +216,22 @@
 #define OPENTHREAD_CONFIG_MAC_CSL_REQUEST_AHEAD_US 2000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_CSL_TX_MISSED_WINDOW_RESELECT_ENABLE
+ *
+ * Define to 1 to re-select the CSL tx child when a scheduled transmit window is missed.
+ *
+ * When the MAC frame request arrives too late for the originally scheduled CSL transmit window (e.g., the radio was
+ * busy with other transmissions on a loaded parent), the scheduler by default silently slips the selected child to
+ * its next window, a full CSL period later. When this config is enabled, the scheduler detects the miss and
+ * re-selects the child with the earliest upcoming transmit window among all CSL children, bounding the added latency
+ * to the nearest window rather than the slipped child's period.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_CSL_TX_MISSED_WINDOW_RESELECT_ENABLE
+#define OPENTHREAD_CONFIG_MAC_CSL_TX_MISSED_WINDOW_RESELECT_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_FILTER_ENABLE
  *
@@ -193,6 +276,73 @@
 #define OPENTHREAD_CONFIG_MAC_STAY_AWAKE_BETWEEN_FRAGMENTS 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+ *
+ * Define as 1 to enable burst drain of queued indirect frames to a sleepy child.
+ *
+ * When enabled, a parent transmits the next queued indirect frame (or next fragment) to a sleepy child immediately
+ * after a successful indirect transmission with "frame pending" set, instead of waiting for the child to send
+ * another data poll. On the child, the data poll sender then no longer sends a data poll per pending frame and
+ * instead relies on the MAC delayed sleep behavior to keep the receiver on, scheduling a quick fallback poll to
+ * recover the pending frames in case a pushed frame is lost. This drains a multi-frame queue in a single wake
+ * instead of one poll cycle per frame.
+ *
+ * This option must be enabled on both the parent and the child. The child additionally requires
+ * `OPENTHREAD_CONFIG_MAC_STAY_AWAKE_BETWEEN_FRAGMENTS` so that its receiver stays on after receiving a frame with
+ * "frame pending" set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+#define OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+ *
+ * Define as 1 to defer per-neighbor RSS averaging out of the frame receive/transmit-done paths.
+ *
+ * When enabled, the receive and transmit-done paths only record the pending (neighbor, RSS) samples in a small
+ * buffer, and the averaging (which updates the per-neighbor link quality) runs over all pending samples in a
+ * deferred tasklet pass. This shortens the per-frame processing on busy routers at the cost of a small buffer and
+ * a slightly delayed link quality update.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+#define OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_RSS_SAMPLE_BUFFER_SIZE
+ *
+ * The number of pending (neighbor, RSS) samples buffered between deferred averaging passes.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE` is enabled. When the buffer is full,
+ * the pending samples are processed inline before recording a new sample.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_RSS_SAMPLE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_MAC_RSS_SAMPLE_BUFFER_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+ *
+ * Define to 1 to enable an early triage stage for received frames in `SubMac`.
+ *
+ * When enabled, frames with a truncated PSDU, an unsupported frame type, or a destination PAN ID or address that
+ * does not match this device are dropped before any upper-layer MAC processing, with per-reason drop counters.
+ * This reduces the CPU cost of frames overheard from co-located networks on platforms whose radio does not (or
+ * cannot) perform address filtering itself.
+ *
+ * The filter is bypassed while a pcap callback is set (promiscuous monitoring), and the destination PAN ID check
+ * is skipped while the PAN ID is the broadcast PAN ID (e.g., during scan operations).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+#define OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_JOIN_BEACON_VERSION
  *
@@ -439,4 +589,97 @@
 #define OPENTHREAD_CONFIG_MAC_SCAN_DURATION 300
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+ *
+ * Define to 1 to enable per-neighbor adaptive CSMA backoff. Each neighbor's `LinkQualityInfo` then tracks a
+ * backoff exponent offset which grows on channel access failures towards that neighbor and decays again on
+ * successful transmissions. The offset is added to `macMinBE` for frames sent to the neighbor, so that
+ * retransmissions to congested peers back off more while clean links keep the minimal delay.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+ *
+ * Define to 1 to allow higher-priority transmit requests to preempt a lower-priority frame whose CSMA backoff
+ * has not yet started transmission. A data poll request or a newly queued net-priority (MLE) message then cancels
+ * the pending backoff, is sent first, and the preempted frame is re-queued and prepared again afterwards. This
+ * bounds control-plane latency under bulk transfer load.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+#define OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_MAX_OFFSET
+ *
+ * Specifies the maximum backoff exponent offset added to `macMinBE` for a congested neighbor (applicable when
+ * `OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_MAX_OFFSET
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_MAX_OFFSET 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+ *
+ * Define to 1 to enable a sliding anti-replay window for received link frame counters.
+ *
+ * When enabled, a frame whose counter is below the highest value seen from a neighbor is still accepted once if it
+ * falls within the window and has not been seen before (tracked per neighbor as a bitmap), so frames legitimately
+ * reordered by radio-level retries do not need to be retransmitted end-to-end. A frame counter at or below the
+ * window is rejected as before.
+ *
+ * This option is not supported with `OPENTHREAD_CONFIG_MULTI_RADIO` (link frame counters are tracked per radio
+ * link while a single window is kept per neighbor).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+#define OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_SIZE
+ *
+ * Specifies the anti-replay window size, i.e., how far below the highest seen frame counter a reordered frame may
+ * still be accepted (applicable when `OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE` is enabled). Maximum value
+ * is 32.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_SIZE
+#define OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+ *
+ * Define to 1 to enable adaptive CSL receive window guard bands.
+ *
+ * When enabled, the CSL receiver scales down the clock-uncertainty guard bands around each sample window as
+ * successive synchronizing frames arrive well inside the window (indicating that the actual relative clock drift
+ * is smaller than the worst-case accuracy the guard bands are derived from), and restores the full guard bands as
+ * soon as a frame arrives near the window edge. This cuts the idle-listen time per CSL period on stable clocks.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+#define OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_MIN_SCALE
+ *
+ * Specifies the minimum scale (in percent) that the adaptive CSL guard bands may shrink to, relative to the
+ * worst-case guard bands (applicable when `OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_MIN_SCALE
+#define OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_MIN_SCALE 25
+#endif
+
 #endif // CONFIG_MAC_H_
@@ -68,6 +68,21 @@
 #define OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT 240
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY
+ *
+ * The delay (in milliseconds) to wait before writing child table changes to non-volatile settings.
+ *
+ * When non-zero, child table changes are coalesced and the whole table is rewritten to settings once per such quiet
+ * period, reducing flash wear under child churn. A value of zero (the default) stores each change immediately. Note
+ * that with a non-zero delay, changes from the last (at most) delay interval can be lost on an ungraceful reset,
+ * requiring the affected children to re-attach.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD
  *
@@ -98,6 +113,22 @@
 #define OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE
+ *
+ * Define as 1 to enable fast attach feature.
+ *
+ * When this feature is enabled, a device that has a parent restored from non-volatile settings starts its attach
+ * process by sending a directed (unicast) MLE Parent Request to the previous parent, using a shorter response wait
+ * time than the multicast Parent Request rounds. If the previous parent does not respond, the attach process falls
+ * back to the normal multicast Parent Request sequence. This shortens re-attach time after a power cycle when the
+ * previous parent is still present.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE
+#define OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_ATTACH_BACKOFF_ENABLE
  *
@@ -290,4 +321,140 @@
 #define OPENTHREAD_CONFIG_MLE_LINK_METRICS_MAX_SERIES_SUPPORTED 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE
+ *
+ * Define to 1 to use batched aggregation for Forward Tracking Series. Per-frame RSSI/LQI samples then accumulate
+ * in plain running sums and the series averages (arithmetic mean over the series) are computed only when the
+ * series is queried, minimizing the per-frame cost on the receive path. When disabled (default), the adaptive
+ * exponentially weighted averagers are used, matching the averaging of the neighbor link info.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE
+#define OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+ *
+ * Define to 1 to enable the next-hop cache on routers. The next hop computed for a destination router is then
+ * remembered and reused for subsequent forwarded frames until route state changes, so steady-state forwarding
+ * between fixed endpoints skips the per-frame route cost evaluation. The cache is also refreshed once per second
+ * to track link quality changes that do not alter route state.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTER_INDEX_MAP_ENABLE
+ *
+ * Define to 1 to enable the router-id-to-entry index map in the router table. `RouterTable::GetRouter()` then
+ * resolves a router id to its table entry with a direct array lookup instead of scanning the active entries, which
+ * helps the hot route evaluation and Route TLV building paths on networks with many routers. Costs one byte of RAM
+ * per possible router id.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTER_INDEX_MAP_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ROUTER_INDEX_MAP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+ *
+ * Define to 1 to adapt the MLE Advertisement trickle interval to topology stability. After a number of
+ * advertisements without a route change (tracked via the Router ID Sequence), the trickle `Imax` is extended
+ * beyond the default, shrinking control-plane airtime on long-stable networks. Any route change restores the
+ * default `Imax` and resets the trickle interval.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_STABLE_COUNT
+ *
+ * Specifies the number of consecutive MLE Advertisements without a route change after which the extended trickle
+ * `Imax` is applied.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_STABLE_COUNT
+#define OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_STABLE_COUNT 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_INTERVAL_MAX
+ *
+ * Specifies the extended MLE Advertisement trickle `Imax` (in seconds) used once the topology is deemed stable.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_INTERVAL_MAX
+#define OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_INTERVAL_MAX 128
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+ *
+ * Define to 1 to support the leader hot-standby (fast leader takeover) mode. A router designated as hot standby
+ * (using `otThreadSetLeaderHotStandbyEnabled()`), when it starts a new partition after losing the leader, seeds its
+ * leader state from the leader Network Data and router ID assignments it already mirrors as a router, instead of
+ * starting from an empty partition.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+#define OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE
+ *
+ * Define to 1 to drop a valid router link early when its average link margin stays collapsed. A per-router counter
+ * tracks consecutive seconds with the link margin below `OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_THRESHOLD`;
+ * once it reaches `OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_TICKS` the link is removed instead of waiting for
+ * the full neighbor age timeout, letting routing recover sooner from links hovering at the sensitivity floor.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE
+#define OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_THRESHOLD
+ *
+ * The link margin (in dB) below which a router link is counted as collapsed (applicable when
+ * `OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_THRESHOLD
+#define OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_THRESHOLD 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_HYSTERESIS
+ *
+ * The hysteresis (in dB) added to the drop threshold before the collapsed-link counter is reset: the counter only
+ * clears once the link margin recovers above threshold plus hysteresis, so a margin oscillating around the
+ * threshold keeps counting toward the drop.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_HYSTERESIS
+#define OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_HYSTERESIS 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_TICKS
+ *
+ * The number of consecutive seconds with collapsed link margin after which a router link is dropped.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_TICKS
+#define OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_TICKS 10
+#endif
+
 #endif // CONFIG_MLE_H_
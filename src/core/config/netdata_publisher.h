@@ -94,6 +94,65 @@
 #define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_EXTRA_DELAY_TIME_TO_REMOVE_PREFERRED 16000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+ *
+ * Define to 1 to enable desynchronized delay scheduling in the `Publisher`.
+ *
+ * When enabled, instead of drawing the add/remove wait time uniformly from the full delay window, each device
+ * deterministically derives a delay slot within the window from a stable hash of its extended address (with random
+ * jitter within the slot), and the window itself is stretched based on the observed Network Data churn rate. This
+ * smooths the registration load at the leader when many devices (e.g., border routers) react to the same event.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_NUM_SLOTS
+ *
+ * Specifies the number of delay slots the delay window is divided into when
+ * `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_NUM_SLOTS
+#define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_NUM_SLOTS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_WINDOW
+ *
+ * Specifies the time window (in milliseconds) over which Network Data changes are counted to estimate the leader
+ * load when `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_WINDOW
+#define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_WINDOW 60000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_THRESHOLD
+ *
+ * Specifies the number of Network Data changes within the churn window for each additional stretch factor applied to
+ * the delay window when `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_THRESHOLD
+#define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_THRESHOLD 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_MAX_LOAD_FACTOR
+ *
+ * Specifies the maximum stretch factor applied to the delay window based on the observed Network Data churn rate
+ * when `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_MAX_LOAD_FACTOR
+#define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_MAX_LOAD_FACTOR 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESIRED_NUM_ANYCAST_DNS_SRP_SERVICE_ENTRIES
  *
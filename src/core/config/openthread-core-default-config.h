@@ -118,6 +118,46 @@
 #define OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE
+ *
+ * Define to 1 to enable the OpenThread instance memory map (`otInstanceGetMemoryMap()`), exposing the size and
+ * offset of each major member of the OpenThread instance to attribute its RAM footprint by subsystem.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE
+#define OPENTHREAD_CONFIG_INSTANCE_MEMORY_MAP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+ *
+ * Define to 1 to seal CTR-DRBG seed material in settings on every boot and mix it back into the DRBG (as
+ * additional input, per NIST SP 800-90A) on the next boot.
+ *
+ * The persisted seed is never used as the sole seed (the DRBG is always seeded from the entropy source first),
+ * so disclosure of the settings store does not by itself compromise the DRBG output, while devices with a slow
+ * TRNG still benefit from entropy carried across boots.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE
+#define OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_RANDOM_DRBG_RESEED_INTERVAL
+ *
+ * Specifies the CTR-DRBG reseed interval (number of requests between reseeds from the entropy source) used when
+ * `OPENTHREAD_CONFIG_RANDOM_PERSISTED_DRBG_SEED_ENABLE` is enabled.
+ *
+ * Lower values reseed on a tighter schedule (approaching the SP 800-90A prediction-resistance behavior) at the
+ * cost of more frequent entropy source reads.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_RANDOM_DRBG_RESEED_INTERVAL
+#define OPENTHREAD_CONFIG_RANDOM_DRBG_RESEED_INTERVAL 1000
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
  *
@@ -138,6 +178,33 @@
 #define OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION
+ *
+ * Selects the `Crc16` implementation.
+ *
+ * The bit-by-bit implementation uses no tables. The table-driven variants trade RAM (tables are built once per
+ * polynomial on first use) for fewer cycles per byte, which matters when computing the FCS over full frames (e.g.
+ * HDLC framing of spinel frames on a border router).
+ *
+ * - @sa OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE
+ * - @sa OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_TABLE
+ * - @sa OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_SLICE_BY_4
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION
+#define OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE
+#endif
+
+/** Bit-by-bit CRC16 computation (no tables). */
+#define OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_BITWISE 0
+
+/** Byte-at-a-time CRC16 computation using one 256-entry table per polynomial (512 bytes each). */
+#define OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_TABLE 1
+
+/** Slice-by-4 CRC16 computation using four 256-entry tables per polynomial (2048 bytes each). */
+#define OPENTHREAD_CONFIG_CRC16_IMPLEMENTATION_SLICE_BY_4 2
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
  *
@@ -160,6 +227,88 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 44
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NUM_RESERVED_BUFFERS_FOR_NET_PRIORITY
+ *
+ * The number of message buffers in the buffer pool held back for `Message::kPriorityNet` allocations.
+ *
+ * When at most this many buffers remain free, buffer allocations at lower priority levels fail (after attempting
+ * message eviction), ensuring the stack can still send network-critical messages (e.g., MLE keep-alives) while
+ * application traffic saturates the pool.
+ *
+ * Applicable only when the internal message buffer pool is used, i.e., when neither
+ * `OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE` nor `OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_RESERVED_BUFFERS_FOR_NET_PRIORITY
+#define OPENTHREAD_CONFIG_NUM_RESERVED_BUFFERS_FOR_NET_PRIORITY 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+ *
+ * Define to 1 to enable deficit round robin scheduling between message priority levels in the forwarder transmit
+ * queue.
+ *
+ * When enabled, a byte quantum can be configured per priority level (`otMessageSetPriorityQuantum()`). Levels with a
+ * non-zero quantum share the transmit opportunities in proportion to their quanta instead of being drained in strict
+ * priority order, which prevents a sustained stream at one level (e.g., a bulk transfer at low priority) from
+ * monopolizing the queue relative to other budgeted levels. Levels with a zero quantum (the default) and network
+ * control traffic retain strict priority order.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+ *
+ * Define to 1 to enable appending external (caller-owned) payload data to a message without copying it into the
+ * message buffer pool (`otMessageAppendExternalData()`).
+ *
+ * The external data is referenced by pointer and must remain valid and unchanged until the release callback is
+ * invoked (when the message is freed). The message must not be lengthened, shortened, or written to after external
+ * data is appended. This is intended for transmit paths (e.g., high-rate application UDP telemetry) where copying
+ * each payload into message buffers would exhaust the buffer pool.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+ *
+ * Define to 1 to enable copy-on-write message cloning.
+ *
+ * When enabled, `Message::Clone()` lets the cloned message share the tail buffer chain of the original message
+ * (copying only the head buffer) and a private copy of the tail is made lazily when either message is about to be
+ * modified. This reduces the buffer cost of fanning one message out to many destinations (e.g., multicast
+ * retransmissions) to a single buffer per copy.
+ *
+ * If the pool is fully exhausted (even after evicting lower priority messages) when a direct in-place write into a
+ * shared tail requires a private copy, the write cannot be carried out safely and asserts.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_MAX_CHAINS
+ *
+ * The maximum number of distinct shared (copy-on-write) tail buffer chains that can be tracked at the same time.
+ *
+ * When all entries are in use, `Message::Clone()` falls back to a full buffer-chain copy.
+ *
+ * Applicable only when copy-on-write cloning is enabled (i.e., `OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_ENABLE` is set).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_MAX_CHAINS
+#define OPENTHREAD_CONFIG_MESSAGE_COW_CLONE_MAX_CHAINS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
  *
@@ -202,6 +351,125 @@
 #define OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PIPELINING_ENABLE
+ *
+ * Define as 1 to enable mesh forwarder frame pipelining.
+ *
+ * When enabled, after a fragment frame of a larger message is sent, the mesh forwarder requests the next fragment
+ * frame directly from the transmit-done context (which the MAC serves as its next operation) instead of going
+ * through the transmission scheduling tasklet. This minimizes the inter-frame gap between back-to-back fragments of
+ * a large datagram, improving throughput for, e.g., OTA image distribution.
+ *
+ * Note that with pipelining enabled, once transmission of a fragmented message starts, its remaining fragments are
+ * sent ahead of any higher priority message queued afterwards.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PIPELINING_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PIPELINING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+ *
+ * Define as 1 to enable fragment train bypass in the mesh forwarder.
+ *
+ * When enabled, a small datagram (fitting in a single frame) destined to a different IPv6 destination may be sent
+ * ahead of the remaining fragments of a partially sent larger message of the same priority, bounding the head-of-line
+ * blocking that a long fragment train (e.g., an OTA image block) otherwise adds to small urgent datagrams. The number
+ * of datagrams that may bypass a given fragment train is bounded (see
+ * `OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_MAX_BYPASS`) so the train cannot be starved.
+ *
+ * Higher priority messages already bypass a lower priority fragment train between fragments regardless of this
+ * setting. This option has no effect on fragments sent from the transmit-done context when
+ * `OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PIPELINING_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_MAX_BYPASS
+ *
+ * The maximum number of small datagrams that may bypass a given partially sent fragment train.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_MAX_BYPASS
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_MAX_BYPASS 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_SMALL_LENGTH
+ *
+ * The maximum IPv6 datagram length (in bytes) eligible to bypass a partially sent fragment train.
+ *
+ * The default is chosen such that an eligible datagram fits in a single 802.15.4 frame after 6LoWPAN compression.
+ * Applicable only when `OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_SMALL_LENGTH
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_SMALL_LENGTH 96
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+ *
+ * Define as 1 to enable mesh forwarder frame packing.
+ *
+ * When enabled, after preparing a direct data frame that carries a complete (unfragmented) 6LoWPAN datagram, the
+ * mesh forwarder packs additional small queued datagrams to the same source/destination into the remaining frame
+ * space as length-prefixed sub-payloads, amortizing the MAC header, security, ack and inter-frame-spacing overhead
+ * over multiple small datagrams. Packed frames use an unassigned 6LoWPAN dispatch value and are only parsed by
+ * receivers with this feature enabled, so it MUST be enabled on all devices exchanging packed traffic.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_MAX_MESSAGES
+ *
+ * The maximum number of datagrams (including the first one) packed into a single frame.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_MAX_MESSAGES
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_MAX_MESSAGES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+ *
+ * Define as 1 to enable per-destination pacing of direct transmissions.
+ *
+ * When enabled, the mesh forwarder applies a token bucket per next-hop destination when selecting the next queued
+ * message for direct transmission. The per-token refill interval tracks the measured link-layer service time of
+ * frames to that next hop (CSMA backoff, retries and ACK wait), so bulk transfers are paced to the rate the path
+ * actually sustains instead of thrashing the queues of intermediate hops, while traffic to other destinations and
+ * control traffic proceed unthrottled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_TABLE_SIZE
+ *
+ * The number of next-hop destinations for which pacing state is kept at the same time.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_TABLE_SIZE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_TABLE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
  *
@@ -212,6 +480,59 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+ *
+ * Define to 1 to enable a hash index over the 6LoWPAN reassembly list.
+ *
+ * When enabled, a received "next fragment" frame locates its reassembly buffer through a hash table keyed by the
+ * datagram tag instead of a linear scan of the reassembly list, and counters track index collisions and reassembly
+ * timeouts.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE
+ *
+ * The number of buckets in the 6LoWPAN reassembly hash index.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+ *
+ * Define to 1 to enable bounded buffering of out-of-order 6LoWPAN fragments.
+ *
+ * When enabled, a received "next fragment" frame that does not contiguously extend any reassembly buffer is parked
+ * (instead of dropped) and retried whenever a fragment is accepted in order, so that fragment reordering on the
+ * link does not void the whole datagram.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_SIZE
+ *
+ * The maximum number of parked out-of-order 6LoWPAN fragments. When the limit is reached the oldest parked
+ * fragment is evicted.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
  *
@@ -242,6 +563,104 @@
 #define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD 1000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_GUARD
+ *
+ * The remaining frame-counter window size at which storing the counters ahead again is scheduled (from a tasklet,
+ * outside the frame transmit path), before the persisted window is exhausted.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_GUARD
+#define OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_GUARD (OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD / 2)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+ *
+ * Define to 1 to enable timer scheduler statistics. The scheduler then tracks the number of running timers (current
+ * and maximum) and the depth of sorted-list insertions in `Add()` (total and maximum), which can be used to quantify
+ * the timer insertion cost on a given build.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_STATS_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_STATS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+ *
+ * Define to 1 to enable tasklet priority classes. The tasklet scheduler then maintains a separate high-priority lane
+ * (used for protocol-timing work such as the `Mac` operation and `MeshForwarder` transmission tasklets) which is
+ * always drained first, while normal tasklets are limited to a per-pass run quota (see
+ * `OPENTHREAD_CONFIG_TASKLET_LOW_PRIORITY_RUN_QUOTA`). The scheduler also tracks the maximum time a tasklet has
+ * spent queued before running.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+#define OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_LOW_PRIORITY_RUN_QUOTA
+ *
+ * The maximum number of normal-priority tasklets run per `ProcessQueuedTasklets()` pass when
+ * `OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE` is enabled. Tasklets beyond the quota stay queued and trigger a new
+ * `otTaskletsSignalPending()`, so high-priority tasklets posted in the meantime run first on the next pass.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_LOW_PRIORITY_RUN_QUOTA
+#define OPENTHREAD_CONFIG_TASKLET_LOW_PRIORITY_RUN_QUOTA 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+ *
+ * Define to 1 to enable tasklet affinity grouping. Tasklets can then declare a subsystem affinity tag and the
+ * scheduler queues a newly posted tasklet directly after the last queued tasklet with the same tag, so same-tag
+ * tasklets run consecutively (preserving per-tag FIFO order) instead of interleaving unrelated subsystems. This
+ * improves I/D-cache locality on platforms where the tasklet cycle cost is dominated by cache misses. The
+ * scheduler also maintains a per-tag execution profile (run count and cumulative execution time).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+#define OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_AFFINITY_NUM_TAGS
+ *
+ * The number of distinct tasklet affinity tags tracked in the per-tag execution profile when
+ * `OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE` is enabled. Tasklets with a tag beyond this number are still grouped
+ * but are accounted under tag zero (the default tag).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_AFFINITY_NUM_TAGS
+#define OPENTHREAD_CONFIG_TASKLET_AFFINITY_NUM_TAGS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+ *
+ * Define to 1 to enable `Notifier` statistics. The notifier then tracks the number of emit dispatches and a
+ * per-event signal count, which can be used to determine which state-change events dominate on a given build.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE
+#define OPENTHREAD_CONFIG_NOTIFIER_STATS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+ *
+ * Define to 1 to construct selected high-footprint optional modules (SRP server, DNS-SD server, Commissioner)
+ * lazily on first use instead of during `Instance` initialization. Storage remains statically reserved, but
+ * `otInstanceInitSingle()` returns faster and the modules' RAM stays untouched until the related feature is used.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+#define OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS
  *
@@ -269,6 +688,21 @@
 #define OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+ *
+ * The maximum number of basic elliptic curve operations an ECC computation (ECDSA, ECDHE) may perform before
+ * yielding back to the scheduler, using mbedTLS restartable ECC. Long-running DTLS handshake crypto is then
+ * time-sliced across tasklet runs instead of blocking MLE and MAC scheduling for the full computation.
+ *
+ * A value of zero (the default) disables restartable ECC and runs each computation to completion. Non-zero values
+ * require builtin mbedTLS. See `mbedtls_ecp_set_max_ops()` for guidance on selecting a value.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+#define OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
  *
@@ -377,6 +811,175 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+ *
+ * Define to 1 to enable the flash key directory. The `Flash` driver then maintains an in-RAM key-to-offset
+ * directory over the active swap area so that reading a single-value key resolves directly to its record instead
+ * of scanning all records. Keys with multiple values, and all keys if the directory overflows, fall back to the
+ * scan.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+#define OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_SIZE
+ *
+ * The number of entries in the flash key directory (applicable when
+ * `OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE` is enabled). Should cover the number of distinct settings keys in
+ * use (including vendor keys).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_SIZE
+#define OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+ *
+ * Define to 1 to enable background flash compaction. When the active swap area fills past three quarters, the
+ * `Flash` driver then copies the live records to the inactive area incrementally from a tasklet (a bounded number
+ * of records per pass, see `OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_RECORDS_PER_PASS`) instead of performing
+ * the full swap copy synchronously when the area eventually runs out of space.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+#define OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_RECORDS_PER_PASS
+ *
+ * The maximum number of records copied per tasklet pass during background flash compaction (applicable when
+ * `OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE` is enabled).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_RECORDS_PER_PASS
+#define OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_RECORDS_PER_PASS 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+ *
+ * Define to 1 to enable the mesh forwarder queue snapshot API (`otThreadGetForwarderQueueSnapshot()`), returning
+ * per-message metadata (priority, length, destination RLOC16, time in queue, security state) for the send queue
+ * and the 6LoWPAN reassembly list in a single packed call. Each queued message then also carries an enqueue
+ * timestamp.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE
+ *
+ * Define to 1 to skip saving an Operational Dataset to non-volatile storage when the stored dataset already
+ * matches. For a Pending Dataset the comparison excludes the Delay Timer TLV (whose remaining time is re-derived
+ * from the recorded update time on read), so the periodic pending-dataset propagation does not rewrite the full
+ * dataset blob on every cycle.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE
+#define OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+ *
+ * Define to 1 to buffer settings `Set()` operations in RAM and commit them to the underlying storage from a
+ * timer, coalescing repeated writes to the same key (e.g. frame-counter persistence) so they do not block the
+ * protocol path on flash page swaps.
+ *
+ * Note that buffered changes are lost if the device powers off before they are flushed. Changes are flushed
+ * when the timer fires, before an `otInstanceReset()`, and on instance finalization.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENTRIES
+ *
+ * Specifies the number of distinct settings keys whose pending writes can be buffered at the same time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENTRIES
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENTRIES 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_VALUE_SIZE
+ *
+ * Specifies the maximum settings value size (in bytes) that can be buffered. Larger values are written through
+ * to the underlying storage directly.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_VALUE_SIZE
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_VALUE_SIZE 128
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_FLUSH_DELAY
+ *
+ * Specifies the delay (in milliseconds) before buffered settings writes are committed to the underlying
+ * storage.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_FLUSH_DELAY
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_FLUSH_DELAY 500
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+ *
+ * Define to 1 to support grouping multiple settings changes into a single commit. Between
+ * `Settings::BeginChange()` and `Settings::CommitChange()` the `Set()` and `Delete()` operations are buffered in
+ * RAM and applied to the underlying storage together on commit, coalescing repeated changes to the same key.
+ * This makes multi-key updates (e.g., an active/pending dataset swap) cheaper in flash operations.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+#define OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_MAX_OPS
+ *
+ * Specifies the number of distinct settings keys whose changes can be buffered within a single group.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_MAX_OPS
+#define OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_MAX_OPS 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_VALUE_SIZE
+ *
+ * Specifies the maximum settings value size (in bytes) that can be buffered within a group. When a larger value
+ * is set, the buffered changes are applied first and the value is written through directly.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_VALUE_SIZE
+#define OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_VALUE_SIZE 256
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+ *
+ * Define to 1 to keep a RAM copy of the frequently read settings entries (Network Info, Parent Info, and the
+ * Active/Pending Operational Datasets) in the `Settings` front-end. The copy is filled on first read and updated
+ * write-through on save/delete, so repeated reads of these entries (e.g., during an MLE attach) do not touch the
+ * underlying storage.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_SETTINGS_READ_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -89,4 +89,33 @@
 #define OPENTHREAD_CONFIG_PING_SENDER_DEFAULT_COUNT 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+ *
+ * Define to 1 to enable ping sender high-rate mode.
+ *
+ * When enabled, a ping request may specify its tx interval in microseconds (`mIntervalUs`), in which case echo
+ * requests are paced by the microsecond timer and round-trip times are accumulated into a histogram instead of
+ * invoking the per-reply callback, making high probe rates (100+ pps) with precise spacing usable for RF testing.
+ *
+ * Requires `OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+#define OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PING_SENDER_RTT_HISTOGRAM_BIN_COUNT
+ *
+ * The number of bins in the ping sender round-trip time histogram. Bin `n` covers round-trip times in the range
+ * `[2^n, 2^(n+1))` milliseconds (first bin starts at 0, last bin is open ended).
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PING_SENDER_RTT_HISTOGRAM_BIN_COUNT
+#define OPENTHREAD_CONFIG_PING_SENDER_RTT_HISTOGRAM_BIN_COUNT 8
+#endif
+
 #endif // CONFIG_PING_SENDER_H_
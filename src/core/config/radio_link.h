@@ -55,6 +55,18 @@
 #define OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MULTI_RADIO_PARALLEL_TX_ENABLE
+ *
+ * Set to 1 to transmit unicast frames in parallel over all radio links on which the neighbor has a high
+ * preference, accepting the first successful acknowledgment ("first ack wins"), instead of selecting a
+ * single radio link. This increases tx opportunities at the cost of duplicate frames on air.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MULTI_RADIO_PARALLEL_TX_ENABLE
+#define OPENTHREAD_CONFIG_MULTI_RADIO_PARALLEL_TX_ENABLE 0
+#endif
+
 //--------------------------------------------------------------
 
 #if !OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && !OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -229,6 +229,52 @@
 #define OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_DELAY 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY
+ *
+ * Specifies the settle delay (in msec) restarted on every change while SRP client is waiting to send an update.
+ *
+ * When set to a non-zero value, each additional change (e.g., another service added or removed through API calls)
+ * while the client is waiting to transmit restarts the wait timer with this delay. This batches a burst of service
+ * adds/removes into a single update message. The total delay from the first change is bounded by
+ * `OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_MAX_SETTLE_DELAY`. When set to zero, the settle window behavior is
+ * disabled and `OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_DELAY` is used (applied on the first change only).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY
+#define OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_MAX_SETTLE_DELAY
+ *
+ * Specifies the maximum total delay (in msec) from the first change before an SRP update is sent.
+ *
+ * This bounds how long the settle window `OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY` can push out the
+ * update transmission when changes keep arriving. It is used only when the settle delay is non-zero.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_MAX_SETTLE_DELAY
+#define OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_MAX_SETTLE_DELAY 1000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+ *
+ * Define to 1 to limit opportunistic early lease renewal to updates that already carry a lease renewal.
+ *
+ * By default, whenever an SRP update is sent, previously registered services that are close to their lease renew
+ * time are also included (per the early lease renew factor configuration). With many registered services this makes
+ * every update (e.g., one triggered by adding a single new service) a near-full re-registration. When this config
+ * is enabled, registered services are early-renewed only when the update already carries a lease renewal (for host
+ * or for a service whose renew time is reached), so updates triggered solely by service adds/removes carry just the
+ * changed services while lease refreshes still batch services onto the same renewal schedule.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SRP_CLIENT_MIN_RETRY_WAIT_INTERVAL
  *
@@ -380,4 +426,30 @@
 #define OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_TXT_BUFFER_SIZE 64
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+ *
+ * Define to 1 to allow the SRP client buffers module to allocate additional service entries from the heap when the
+ * static service pool is exhausted. Heap-allocated entries are cached for reuse when freed, up to a runtime cap.
+ *
+ * This config is applicable only when `OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+#define OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_MAX_DYNAMIC_SERVICES
+ *
+ * Specifies the default runtime cap on the number of heap-allocated service entries (in use or cached for reuse).
+ * The cap can be changed at run-time using `otSrpClientBuffersSetMaxDynamicServices()`.
+ *
+ * This config is applicable only when `OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_MAX_DYNAMIC_SERVICES
+#define OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_MAX_DYNAMIC_SERVICES 8
+#endif
+
 #endif // CONFIG_SRP_CLIENT_H_
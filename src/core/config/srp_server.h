@@ -119,4 +119,96 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_MAX_ADDRESSES_NUM 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+ *
+ * Define to 1 to allocate the SRP server host and service records from fixed-size pools instead of the heap.
+ *
+ * Pool allocation bounds the number of registrations but avoids heap fragmentation from long-running
+ * registration churn. Name strings and TXT data are still heap-allocated.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_MAX_HOSTS
+ *
+ * Specifies the capacity of the SRP server host record pool.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_MAX_HOSTS
+#define OPENTHREAD_CONFIG_SRP_SERVER_MAX_HOSTS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_MAX_SERVICES
+ *
+ * Specifies the capacity of the SRP server service record pool.
+ *
+ * The same capacity is used for the service description pool. Applicable only when
+ * `OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_MAX_SERVICES
+#define OPENTHREAD_CONFIG_SRP_SERVER_MAX_SERVICES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES
+ *
+ * Specifies the maximum number of received SRP update messages queued for deferred processing.
+ *
+ * Received updates are processed (including the per-update ECDSA signature verification) one at a time from a
+ * tasklet, so a registration storm cannot monopolize the receive path. Messages received while the queue is full
+ * are dropped (clients retransmit).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES
+#define OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES_PER_CLIENT
+ *
+ * Specifies the maximum number of queued SRP update messages from a single client (source address).
+ *
+ * Messages from a client that already has this many updates queued are dropped, so a single misbehaving client
+ * cannot crowd out registrations from the rest of the mesh.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES_PER_CLIENT
+#define OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES_PER_CLIENT 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+ *
+ * Define to 1 to persist committed SRP host and service registrations in non-volatile settings.
+ *
+ * Persisted registrations are restored when the server starts, so a rebooted Border Router serves existing
+ * registrations immediately instead of forcing every client to re-register at once. Records are (re)written lazily
+ * from a tasklet after registry changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_PERSIST_BUFFER_SIZE
+ *
+ * Specifies the buffer size (in bytes) used to serialize or parse a single persisted host record (the host along
+ * with all its services). A host whose serialized form does not fit is not persisted.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_PERSIST_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_PERSIST_BUFFER_SIZE 512
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
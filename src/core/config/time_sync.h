@@ -94,4 +94,21 @@
 #define OPENTHREAD_CONFIG_TIME_SYNC_JUMP_NOTIF_MIN_US 10000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+ *
+ * Define as 1 to enable local clock drift estimation and compensation.
+ *
+ * When enabled, the device estimates the drift rate of its local clock relative to the network time from
+ * successive received time sync updates, and `otNetworkTimeGet()` compensates for the drift accumulated since
+ * the last update. This keeps the reported network time accurate over longer intervals, allowing the time
+ * synchronization period (`OPENTHREAD_CONFIG_TIME_SYNC_PERIOD`) to be increased to save airtime.
+ *
+ * Applicable only if time synchronization service feature is enabled (i.e., OPENTHREAD_CONFIG_TIME_SYNC_ENABLE is set)
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+#define OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE 0
+#endif
+
 #endif // CONFIG_TIME_SYNC_H_
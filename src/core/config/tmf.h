@@ -106,6 +106,82 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY 120
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_NEGATIVE_CACHE_THRESHOLD
+ *
+ * Number of consecutive address query timeouts for an EID after which the EID is treated as unreachable (negatively
+ * cached). Messages to a negatively cached EID are dropped immediately instead of being queued while the (background)
+ * address query is in progress. Zero disables the negative caching behavior.
+ *
+ * Default: 4
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_NEGATIVE_CACHE_THRESHOLD
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_NEGATIVE_CACHE_THRESHOLD 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+ *
+ * Define to 1 to coalesce Address Notification (ADDR_NTF.ans) responses. Address Query messages for the same target
+ * received within a short aggregation window are answered once (using a single multicast answer when the queries came
+ * from multiple queriers), and answers are rate limited using a token bucket.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_WINDOW
+ *
+ * Specifies the aggregation window (in milliseconds) during which Address Query messages for the same target are
+ * coalesced into a single Address Notification response.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_WINDOW
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_WINDOW 100
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_NUM_ENTRIES
+ *
+ * Specifies the number of distinct targets for which an Address Notification response can be pending (within its
+ * aggregation window) at the same time.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_NUM_ENTRIES
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_NUM_ENTRIES 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_BUCKET_SIZE
+ *
+ * Specifies the token bucket size (maximum burst) for Address Notification responses.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_BUCKET_SIZE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_BUCKET_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_INTERVAL
+ *
+ * Specifies the interval (in milliseconds) at which a new Address Notification response token is added to the bucket.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_INTERVAL
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_INTERVAL 250
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_PENDING_DATASET_MINIMUM_DELAY
  *
@@ -162,6 +238,46 @@
 #define OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_MAX_ALOCS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+ *
+ * Define to 1 to maintain an index of the server RLOC16s present in the leader Network Data.
+ *
+ * The index lets the leader skip the full Network Data scan when handling a registration or removal for an
+ * RLOC16 that has no entries, reducing the processing cost when many Border Routers re-register in a short
+ * period.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_SIZE
+ *
+ * The number of distinct server RLOC16s the leader Network Data index can track. When more servers register,
+ * the index saturates and the leader falls back to scanning for all RLOC16s.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_SIZE
+#define OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+ *
+ * Define to 1 to enable the 6LoWPAN context prefix index in the leader Network Data.
+ *
+ * When enabled, the prefixes carrying a 6LoWPAN Context ID are kept in a compact array sorted by decreasing prefix
+ * length, rebuilt whenever the Network Data changes. `GetContext()` lookups (which run per packet during 6LoWPAN
+ * compression and per route decision) then scan the parsed array with an early exit on the longest match instead of
+ * walking and parsing the Prefix TLVs in the Network Data for every lookup.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_MTD_ENABLE
  *
@@ -200,4 +316,28 @@
 #error "Thread 1.2 or higher version is required for OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE"
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+ *
+ * Define to 1 to enable the proxied MLR address table. `MlrManager` then aggregates the children's MLR-registered
+ * multicast addresses into a reference-counted table of unique addresses, so updating one child's subscriptions no
+ * longer re-walks the addresses of every other child. Helps on parents with large child tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_SIZE
+ *
+ * The number of entries in the proxied MLR address table (applicable when
+ * `OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE` is enabled). Should cover the number of unique multicast
+ * group addresses subscribed across all children; on overflow, queries fall back to walking the child table.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_SIZE
+#define OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_SIZE 16
+#endif
+
 #endif // CONFIG_TMF_H_
@@ -40,6 +40,7 @@
 
 #include <openthread/platform/crypto.h>
 #include "common/error.hpp"
+#include "common/message.hpp"
 #include "crypto/aes_ecb.hpp"
 #include "crypto/storage.hpp"
 #include "mac/mac_types.hpp"
@@ -136,6 +137,22 @@ public:
      */
     void Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode aMode);
 
+#if !OPENTHREAD_RADIO
+    /**
+     * This method processes the payload within a given message, encrypting or decrypting it in place.
+     *
+     * The data is processed in place directly within the `Message` buffer chunks (no copy into an intermediate
+     * buffer).
+     *
+     * @param[inout]  aMessage  The message to read the payload from and write the processed payload back to.
+     * @param[in]     aOffset   The offset in @p aMessage to start of payload.
+     * @param[in]     aLength   Payload length in bytes.
+     * @param[in]     aMode     Mode to indicate whether to encrypt (`kEncrypt`) or decrypt (`kDecrypt`).
+     *
+     */
+    void Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode);
+#endif
+
     /**
      * This method returns the tag length in bytes.
      *
@@ -35,6 +35,7 @@
 
 #include <mbedtls/ctr_drbg.h>
 #include <mbedtls/debug.h>
+#include <mbedtls/ecp.h>
 #include <mbedtls/entropy.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/threading.h>
@@ -58,6 +59,10 @@ MbedTls::MbedTls(void)
 #endif
     mbedtls_platform_set_calloc_free(Instance::HeapCAlloc, Instance::HeapFree);
 #endif // OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT
+
+#if OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS && defined(MBEDTLS_ECP_RESTARTABLE)
+    mbedtls_ecp_set_max_ops(OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS);
+#endif
 }
 
 Error MbedTls::MapError(int aMbedTlsError)
@@ -44,6 +44,7 @@
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
+#include "common/pool.hpp"
 #include "radio/radio.hpp"
 #include "utils/parse_cmdline.hpp"
 
@@ -145,9 +146,20 @@ extern "C" void otPlatDiagAlarmFired(otInstance *aInstance)
 #else // OPENTHREAD_RADIO
 
 const struct Diags::Command Diags::sCommands[] = {
-    {"channel", &Diags::ProcessChannel}, {"power", &Diags::ProcessPower}, {"radio", &Diags::ProcessRadio},
-    {"repeat", &Diags::ProcessRepeat},   {"send", &Diags::ProcessSend},   {"start", &Diags::ProcessStart},
-    {"stats", &Diags::ProcessStats},     {"stop", &Diags::ProcessStop},
+    {"channel", &Diags::ProcessChannel},
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+    {"pools", &Diags::ProcessPools},
+#endif
+    {"power", &Diags::ProcessPower},
+    {"radio", &Diags::ProcessRadio},
+    {"repeat", &Diags::ProcessRepeat},
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    {"rxprofile", &Diags::ProcessRxProfile},
+#endif
+    {"send", &Diags::ProcessSend},
+    {"start", &Diags::ProcessStart},
+    {"stats", &Diags::ProcessStats},
+    {"stop", &Diags::ProcessStop},
 };
 
 Diags::Diags(Instance &aInstance)
@@ -338,6 +350,85 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+Error Diags::ProcessRxProfile(uint8_t aArgsLength, char *aArgs[], char *aOutput, size_t aOutputMaxLen)
+{
+    Error                    error    = kErrorNone;
+    Utils::PipelineProfiler &profiler = Get<Utils::PipelineProfiler>();
+    size_t                   written  = 0;
+
+    if ((aArgsLength == 1) && (strcmp(aArgs[0], "clear") == 0))
+    {
+        profiler.Clear();
+        snprintf(aOutput, aOutputMaxLen, "rx profile cleared\r\n");
+        ExitNow();
+    }
+
+    VerifyOrExit(aArgsLength == 0, error = kErrorInvalidArgs);
+
+    for (uint8_t index = 0; index < Utils::PipelineProfiler::kNumStages; index++)
+    {
+        Utils::PipelineProfiler::Stage             stage = static_cast<Utils::PipelineProfiler::Stage>(index);
+        const Utils::PipelineProfiler::StageStats &stats = profiler.GetStageStats(stage);
+        uint32_t                                   avg   = 0;
+
+        if (stats.mNumSamples != 0)
+        {
+            avg = static_cast<uint32_t>(stats.mTotalDuration / stats.mNumSamples);
+        }
+
+        VerifyOrExit(written < aOutputMaxLen);
+        written += snprintf(aOutput + written, aOutputMaxLen - written,
+                            "%s: samples %u, avg %uus, max %uus\r\n  log2us buckets:",
+                            Utils::PipelineProfiler::StageToString(stage),
+                            static_cast<unsigned int>(stats.mNumSamples), static_cast<unsigned int>(avg),
+                            static_cast<unsigned int>(stats.mMaxDuration));
+
+        for (uint32_t bucket : stats.mBuckets)
+        {
+            VerifyOrExit(written < aOutputMaxLen);
+            written += snprintf(aOutput + written, aOutputMaxLen - written, " %u", static_cast<unsigned int>(bucket));
+        }
+
+        VerifyOrExit(written < aOutputMaxLen);
+        written += snprintf(aOutput + written, aOutputMaxLen - written, "\r\n");
+    }
+
+exit:
+    AppendErrorResult(error, aOutput, aOutputMaxLen);
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+Error Diags::ProcessPools(uint8_t aArgsLength, char *aArgs[], char *aOutput, size_t aOutputMaxLen)
+{
+    Error  error   = kErrorNone;
+    size_t written = 0;
+
+    OT_UNUSED_VARIABLE(aArgs);
+
+    VerifyOrExit(aArgsLength == 0, error = kErrorInvalidArgs);
+
+    written += snprintf(aOutput, aOutputMaxLen, "name, entry size, pool size, in use, max used, failed allocs\r\n");
+
+    for (const PoolStats *stats = PoolStats::GetFirst(); stats != nullptr; stats = stats->GetNext())
+    {
+        VerifyOrExit(written < aOutputMaxLen);
+        written += snprintf(aOutput + written, aOutputMaxLen - written, "%s, %u, %u, %u, %u, %u\r\n",
+                            stats->GetName(), static_cast<unsigned int>(stats->GetEntrySize()),
+                            static_cast<unsigned int>(stats->GetPoolSize()),
+                            static_cast<unsigned int>(stats->GetInUse()),
+                            static_cast<unsigned int>(stats->GetMaxInUse()),
+                            static_cast<unsigned int>(stats->GetNumFailedAllocations()));
+    }
+
+exit:
+    AppendErrorResult(error, aOutput, aOutputMaxLen);
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+
 Error Diags::ProcessStop(uint8_t aArgsLength, char *aArgs[], char *aOutput, size_t aOutputMaxLen)
 {
     OT_UNUSED_VARIABLE(aArgsLength);
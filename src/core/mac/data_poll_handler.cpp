@@ -69,6 +69,37 @@ inline void DataPollHandler::Callbacks::HandleFrameChangeDone(Child &aChild)
 
 //---------------------------------------------------------
 
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+
+void DataPollHandler::ChildInfo::SaveFrame(const Mac::TxFrame &aFrame, const IndirectSenderBase::FrameContext &aContext)
+{
+    memcpy(mCachedFramePsdu, aFrame.GetPsdu(), aFrame.GetLength());
+    mCachedFrameLength  = aFrame.GetLength();
+    mCachedFrameContext = aContext;
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+    mCachedFrameRadioType = aFrame.GetRadioType();
+#endif
+}
+
+void DataPollHandler::ChildInfo::RestoreFrame(Mac::TxFrame &aFrame, IndirectSenderBase::FrameContext &aContext) const
+{
+    memcpy(aFrame.GetPsdu(), mCachedFramePsdu, mCachedFrameLength);
+    aFrame.SetLength(mCachedFrameLength);
+
+    // The cached frame bytes already have the MAC header fields
+    // (including frame counter and key id) and security processing
+    // applied, so the MAC layer is told to skip both.
+
+    aFrame.SetIsHeaderUpdated(true);
+    aFrame.SetIsSecurityProcessed(true);
+
+    aContext = mCachedFrameContext;
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+
+//---------------------------------------------------------
+
 DataPollHandler::DataPollHandler(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mIndirectTxChild(nullptr)
@@ -85,6 +116,9 @@ void DataPollHandler::Clear(void)
         child.SetFrameReplacePending(false);
         child.SetFramePurgePending(false);
         child.ResetIndirectTxAttempts();
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+        child.ClearCachedFrame();
+#endif
     }
 
     mIndirectTxChild = nullptr;
@@ -104,6 +138,12 @@ void DataPollHandler::HandleNewFrame(Child &aChild)
 
 void DataPollHandler::RequestFrameChange(FrameChange aChange, Child &aChild)
 {
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+    // The cached frame (if any) is for the previous frame/message and
+    // can no longer be used once a frame change is requested.
+    aChild.ClearCachedFrame();
+#endif
+
     if ((mIndirectTxChild == &aChild) && Get<Mac::Mac>().IsPerformingIndirectTransmit())
     {
         switch (aChange)
@@ -183,6 +223,25 @@ Mac::TxFrame *DataPollHandler::HandleFrameRequest(Mac::TxFrames &aTxFrames)
     frame = &aTxFrames.GetTxFrame();
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+    if ((mIndirectTxChild->GetIndirectTxAttempts() > 0) && mIndirectTxChild->HasCachedFrame()
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+        && (mIndirectTxChild->GetCachedFrameRadioType() == mIndirectTxChild->GetLastPollRadioType())
+#endif
+    )
+    {
+        // For a re-transmission, reuse the cached frame bytes from the
+        // previous attempt directly. The cached frame already carries
+        // the same data sequence number, frame counter, and key id and
+        // has its security processed, so both the frame preparation
+        // and the AES processing are skipped.
+
+        mIndirectTxChild->RestoreFrame(*frame, mFrameContext);
+        frame->SetIsARetransmission(true);
+        ExitNow();
+    }
+#endif
+
     VerifyOrExit(mCallbacks.PrepareFrameForChild(*frame, mFrameContext, *mIndirectTxChild) == kErrorNone,
                  frame = nullptr);
 
@@ -219,12 +278,31 @@ void DataPollHandler::HandleSentFrame(const Mac::TxFrame &aFrame, Error aError)
     mIndirectTxChild = nullptr;
     HandleSentFrame(aFrame, aError, *child);
 
+#if OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+    // After a successful transmission of a frame with "frame pending"
+    // set, the child keeps its receiver on, so the next queued frame
+    // (or next fragment) is pushed to the child immediately rather
+    // than waiting for the child to send another data poll.
+
+    if ((aError == kErrorNone) && aFrame.GetFramePending() && (child->GetIndirectMessageCount() > 0) &&
+        child->IsStateValidOrRestoring())
+    {
+        child->SetDataPollPending(true);
+    }
+#endif
+
 exit:
     ProcessPendingPolls();
 }
 
 void DataPollHandler::HandleSentFrame(const Mac::TxFrame &aFrame, Error aError, Child &aChild)
 {
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+    // Any previously cached frame is now stale. It is saved again
+    // below if this attempt failed and a retransmission is expected.
+    aChild.ClearCachedFrame();
+#endif
+
     if (aChild.IsFramePurgePending())
     {
         aChild.SetFramePurgePending(false);
@@ -286,6 +364,18 @@ void DataPollHandler::HandleSentFrame(const Mac::TxFrame &aFrame, Error aError,
                 OT_UNUSED_VARIABLE(error);
             }
 
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+            // Cache the frame bytes for reuse on the retransmission,
+            // but only when the security processing happened in place
+            // in the frame buffer (i.e., it was not offloaded to the
+            // radio leaving the buffer content unsecured).
+
+            if (!aFrame.GetSecurityEnabled() || aFrame.IsSecurityProcessed())
+            {
+                aChild.SaveFrame(aFrame, mFrameContext);
+            }
+#endif
+
             ExitNow();
         }
 
@@ -121,6 +121,17 @@ public:
         void           SetLastPollRadioType(Mac::RadioType aRadioType) { mLastPollRadioType = aRadioType; }
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+        bool HasCachedFrame(void) const { return mCachedFrameLength != 0; }
+        void ClearCachedFrame(void) { mCachedFrameLength = 0; }
+        void SaveFrame(const Mac::TxFrame &aFrame, const IndirectSenderBase::FrameContext &aContext);
+        void RestoreFrame(Mac::TxFrame &aFrame, IndirectSenderBase::FrameContext &aContext) const;
+
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+        Mac::RadioType GetCachedFrameRadioType(void) const { return mCachedFrameRadioType; }
+#endif
+#endif
+
         uint32_t mIndirectFrameCounter;    // Frame counter for current indirect frame (used for retx).
         uint8_t  mIndirectKeyId;           // Key Id for current indirect frame (used for retx).
         uint8_t  mIndirectDsn;             // MAC level Data Sequence Number (DSN) for retx attempts.
@@ -132,6 +143,22 @@ public:
         Mac::RadioType mLastPollRadioType; // The radio link last data poll frame was received on.
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_INDIRECT_FRAME_CACHE_ENABLE
+        // Cached copy of the last prepared (and secured) indirect
+        // frame along with its context, retained after a failed tx
+        // attempt so the retransmission triggered by the next data
+        // poll can reuse it without re-preparing and re-securing the
+        // frame. A zero `mCachedFrameLength` indicates no cached
+        // frame.
+
+        IndirectSenderBase::FrameContext mCachedFrameContext;
+        uint16_t                         mCachedFrameLength;
+#if OPENTHREAD_CONFIG_MULTI_RADIO
+        Mac::RadioType mCachedFrameRadioType;
+#endif
+        uint8_t mCachedFramePsdu[OT_RADIO_FRAME_MAX_SIZE];
+#endif
+
         static_assert(kMaxPollTriggeredTxAttempts < (1 << 5), "mIndirectTxAttempts cannot fit max!");
     };
 
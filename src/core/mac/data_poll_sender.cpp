@@ -56,6 +56,9 @@ DataPollSender::DataPollSender(Instance &aInstance)
     , mEnabled(false)
     , mAttachMode(false)
     , mRetxMode(false)
+#if OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+    , mBurstDrainActive(false)
+#endif
     , mPollTimeoutCounter(0)
     , mPollTxFailureCounter(0)
     , mRemainingFastPolls(0)
@@ -87,6 +90,9 @@ void DataPollSender::StopPolling(void)
     mTimer.Stop();
     mAttachMode           = false;
     mRetxMode             = false;
+#if OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+    mBurstDrainActive = false;
+#endif
     mPollTimeoutCounter   = 0;
     mPollTxFailureCounter = 0;
     mRemainingFastPolls   = 0;
@@ -104,6 +110,9 @@ Error DataPollSender::SendDataPoll(void)
     VerifyOrExit(GetParent().IsStateValidOrRestoring(), error = kErrorInvalidState);
 
     mTimer.Stop();
+#if OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+    mBurstDrainActive = false;
+#endif
 
     SuccessOrExit(error = Get<Mac::Mac>().RequestDataPollTransmission());
 
@@ -325,10 +334,33 @@ void DataPollSender::ProcessRxFrame(const Mac::RxFrame &aFrame)
 
     mPollTimeoutCounter = 0;
 
+#if OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+    if (aFrame.GetFramePending())
+    {
+        // The parent pushes the remaining pending frames back-to-back
+        // while the MAC delayed sleep behavior keeps the receiver on.
+        // Instead of sending a data poll per pending frame, schedule a
+        // quick fallback poll to recover the pending frames in case a
+        // pushed frame is lost.
+
+        mBurstDrainActive = true;
+        mTimerStartTime   = TimerMilli::GetNow();
+        mTimer.StartAt(mTimerStartTime, kBurstDrainFallbackTimeout);
+    }
+    else if (mBurstDrainActive)
+    {
+        // The burst is drained, restore the normal poll schedule.
+
+        mBurstDrainActive = false;
+        mTimer.Stop();
+        ScheduleNextPoll(kUsePreviousPollPeriod);
+    }
+#else
     if (aFrame.GetFramePending())
     {
         IgnoreError(SendDataPoll());
     }
+#endif
 
 exit:
     return;
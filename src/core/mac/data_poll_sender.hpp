@@ -273,6 +273,11 @@ private:
     static constexpr uint32_t kMinPollPeriod        = OPENTHREAD_CONFIG_MAC_MINIMUM_POLL_PERIOD;
     static constexpr uint32_t kMaxExternalPeriod    = ((1 << 26) - 1); //< ~18.6 hours.
 
+#if OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+    // Fallback poll delay while waiting for the parent to push the next pending frame.
+    static constexpr uint32_t kBurstDrainFallbackTimeout = 2 * Mac::kDataPollTimeout;
+#endif
+
     void            ScheduleNextPoll(PollPeriodSelector aPollPeriodSelector);
     uint32_t        CalculatePollPeriod(void) const;
     const Neighbor &GetParent(void) const;
@@ -293,6 +298,9 @@ private:
     bool    mEnabled : 1;              //< Indicates whether data polling is enabled/started.
     bool    mAttachMode : 1;           //< Indicates whether in attach mode (to use attach poll period).
     bool    mRetxMode : 1;             //< Indicates whether last poll tx failed at mac/radio layer (poll retx mode).
+#if OPENTHREAD_CONFIG_MAC_DATA_POLL_BURST_DRAIN_ENABLE
+    bool mBurstDrainActive : 1; //< Indicates whether waiting for the parent to push pending frames.
+#endif
     uint8_t mPollTimeoutCounter : 4;   //< Poll timeouts counter (0 to `kQuickPollsAfterTimout`).
     uint8_t mPollTxFailureCounter : 4; //< Poll tx failure counter (0 to `kMaxPollRetxAttempts`).
     uint8_t mRemainingFastPolls : 4;   //< Number of remaining fast polls when in transient fast polling mode.
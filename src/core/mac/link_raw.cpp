@@ -53,6 +53,9 @@ LinkRaw::LinkRaw(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mReceiveChannel(OPENTHREAD_CONFIG_DEFAULT_CHANNEL)
     , mPanId(kPanIdBroadcast)
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+    , mRxFilterEnabled(false)
+#endif
     , mReceiveDoneCallback(nullptr)
     , mTransmitDoneCallback(nullptr)
     , mEnergyScanDoneCallback(nullptr)
@@ -167,12 +170,83 @@ void LinkRaw::InvokeReceiveDone(RxFrame *aFrame, Error aError)
     otLogDebgMac("LinkRaw::ReceiveDone(%d bytes), error:%s", (aFrame != nullptr) ? aFrame->mLength : 0,
                  ErrorToString(aError));
 
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+    if (mRxFilterEnabled && (aFrame != nullptr) && (aError == kErrorNone) && !FrameMatchesRxFilter(*aFrame))
+    {
+        ExitNow();
+    }
+#endif
+
     if (mReceiveDoneCallback && (aError == kErrorNone))
     {
         mReceiveDoneCallback(&GetInstance(), aFrame, aError);
     }
+
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+exit:
+    return;
+#endif
+}
+
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+
+Error LinkRaw::SetRxFilter(const otLinkRawRxFilter *aFilter)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsEnabled(), error = kErrorInvalidState);
+
+    if (aFilter == nullptr)
+    {
+        mRxFilterEnabled = false;
+    }
+    else
+    {
+        mRxFilter        = *aFilter;
+        mRxFilterEnabled = true;
+    }
+
+exit:
+    return error;
+}
+
+bool LinkRaw::FrameMatchesRxFilter(const RxFrame &aFrame) const
+{
+    bool    matches = false;
+    PanId   panId;
+    Address srcAddr;
+
+    if (mRxFilter.mFrameTypeMask != 0)
+    {
+        VerifyOrExit((mRxFilter.mFrameTypeMask & (1U << aFrame.GetType())) != 0);
+    }
+
+    if (mRxFilter.mFilterPanId)
+    {
+        // Match the destination PAN ID, falling back to the source PAN
+        // ID when the frame carries no destination (e.g. an ACK).
+        if (aFrame.GetDstPanId(panId) != kErrorNone)
+        {
+            SuccessOrExit(aFrame.GetSrcPanId(panId));
+        }
+
+        VerifyOrExit(panId == mRxFilter.mPanId);
+    }
+
+    if (mRxFilter.mFilterSrcShort)
+    {
+        SuccessOrExit(aFrame.GetSrcAddr(srcAddr));
+        VerifyOrExit(srcAddr.IsShort() && (srcAddr.GetShort() == mRxFilter.mSrcShortAddress));
+    }
+
+    matches = true;
+
+exit:
+    return matches;
 }
 
+#endif // OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+
 Error LinkRaw::Transmit(otLinkRawTransmitDone aCallback)
 {
     Error error = kErrorNone;
@@ -115,6 +115,19 @@ public:
      */
     void InvokeReceiveDone(RxFrame *aFrame, Error aError);
 
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+    /**
+     * This method sets the receive frame filter.
+     *
+     * @param[in]  aFilter  A pointer to the filter settings, or nullptr to clear the filter (accept all frames).
+     *
+     * @retval kErrorNone            Successfully set the filter.
+     * @retval kErrorInvalidState    The raw link-layer is not enabled.
+     *
+     */
+    Error SetRxFilter(const otLinkRawRxFilter *aFilter);
+#endif
+
     /**
      * This method gets the radio transmit frame.
      *
@@ -299,8 +312,16 @@ public:
 #endif
 
 private:
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+    bool FrameMatchesRxFilter(const RxFrame &aFrame) const;
+#endif
+
     uint8_t                 mReceiveChannel;
     PanId                   mPanId;
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+    bool                    mRxFilterEnabled;
+    otLinkRawRxFilter       mRxFilter;
+#endif
     otLinkRawReceiveDone    mReceiveDoneCallback;
     otLinkRawTransmitDone   mTransmitDoneCallback;
     otLinkRawEnergyScanDone mEnergyScanDoneCallback;
@@ -118,6 +118,13 @@ Mac::Mac(Instance &aInstance)
     , mTimer(aInstance, Mac::HandleTimer)
     , mKeyIdMode2FrameCounter(0)
     , mCcaSampleCount(0)
+#if OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+    , mRssSampleCount(0)
+    , mRssSampleTask(aInstance, Mac::HandleRssSampleTask)
+#endif
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+    , mTxLatencyStartTime(0)
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     , mTxError(kErrorNone)
 #endif
@@ -129,8 +136,18 @@ Mac::Mac(Instance &aInstance)
 
     randomExtAddress.GenerateRandom();
 
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+    mOperationTask.SetHighPriority();
+#endif
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    mOperationTask.SetTag(Tasklet::kAffinityTagMac);
+#endif
+
     mCcaSuccessRateTracker.Clear();
     ResetCounters();
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+    ResetTxLatencyHistogram();
+#endif
     mExtendedPanId.Clear();
 
     SetEnabled(true);
@@ -537,6 +554,10 @@ void Mac::RequestDirectFrameTransmission(void)
     VerifyOrExit(IsEnabled());
     VerifyOrExit(!mPendingTransmitDataDirect && (mOperation != kOperationTransmitDataDirect));
 
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+    mTxLatencyStartTime = TimerMilli::GetNow();
+#endif
+
     StartOperation(kOperationTransmitDataDirect);
 
 exit:
@@ -583,12 +604,40 @@ Error Mac::RequestDataPollTransmission(void)
 
     mShouldTxPollBeforeData = !mPendingTransmitDataDirect;
 
+#if OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+    if (TryPreemptTransmitDataDirect())
+    {
+        // The preempted data frame is re-queued; send the poll first.
+        mShouldTxPollBeforeData = true;
+    }
+#endif
+
     StartOperation(kOperationTransmitPoll);
 
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+bool Mac::TryPreemptTransmitDataDirect(void)
+{
+    bool didPreempt = false;
+
+    VerifyOrExit(mOperation == kOperationTransmitDataDirect);
+    VerifyOrExit(mLinks.GetSubMac().TryCancelCsmaBackoff());
+
+    otLogDebgMac("Preempted direct data transmit in CSMA backoff");
+
+    mOperation                 = kOperationIdle;
+    mPendingTransmitDataDirect = true;
+    mOperationTask.Post();
+    didPreempt = true;
+
+exit:
+    return didPreempt;
+}
+#endif
+
 void Mac::UpdateIdleMode(void)
 {
     bool shouldSleep = !mRxOnWhenIdle && !mPromiscuous;
@@ -711,6 +760,48 @@ void Mac::HandleOperationTask(Tasklet &aTasklet)
     aTasklet.Get<Mac>().PerformNextOperation();
 }
 
+#if OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+void Mac::RecordNeighborRss(Neighbor &aNeighbor, int8_t aRss)
+{
+    if (mRssSampleCount == kRssSampleBufferSize)
+    {
+        ProcessRssSamples();
+    }
+
+    mRssSampleNeighbors[mRssSampleCount] = &aNeighbor;
+    mRssSampleValues[mRssSampleCount]    = aRss;
+    mRssSampleCount++;
+
+    mRssSampleTask.Post();
+}
+
+void Mac::HandleRssSampleTask(Tasklet &aTasklet)
+{
+    aTasklet.Get<Mac>().ProcessRssSamples();
+}
+
+void Mac::ProcessRssSamples(void)
+{
+    // `Neighbor` objects are statically allocated in the child/router
+    // tables, so a recorded entry remains valid memory even if the
+    // neighbor is removed before this pass runs. An entry whose
+    // neighbor left the valid/restoring states since it was recorded
+    // is skipped.
+
+    for (uint8_t index = 0; index < mRssSampleCount; index++)
+    {
+        Neighbor &neighbor = *mRssSampleNeighbors[index];
+
+        if (neighbor.IsStateValidOrRestoring())
+        {
+            neighbor.GetLinkInfo().AddRss(mRssSampleValues[index]);
+        }
+    }
+
+    mRssSampleCount = 0;
+}
+#endif // OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+
 void Mac::PerformNextOperation(void)
 {
     VerifyOrExit(mOperation == kOperationIdle);
@@ -1026,7 +1117,16 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     VerifyOrExit(aFrame.mInfo.mTxInfo.mCslPresent == 0);
 #endif
 
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    {
+        TimeMicro start = TimerMicro::GetNow();
+
+        aFrame.ProcessTransmitAesCcm(*extAddress);
+        mCounters.mTxSecurityTime += TimerMicro::GetNow() - start;
+    }
+#else
     aFrame.ProcessTransmitAesCcm(*extAddress);
+#endif
 
 exit:
     return;
@@ -1207,6 +1307,23 @@ void Mac::BeginTransmit(void)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    {
+        Neighbor *neighbor;
+        uint8_t   minBeOffset = 0;
+
+        IgnoreError(frame->GetDstAddr(dstAddr));
+        neighbor = Get<NeighborTable>().FindNeighbor(dstAddr);
+
+        if (neighbor != nullptr)
+        {
+            minBeOffset = neighbor->GetLinkInfo().GetCsmaBackoffOffset();
+        }
+
+        mLinks.GetSubMac().SetCsmaMinBeOffset(minBeOffset);
+    }
+#endif
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     mLinks.Send(*frame, mTxPendingRadioLinks);
 #else
@@ -1291,6 +1408,16 @@ void Mac::RecordFrameTransmitStatus(const TxFrame &aFrame,
         }
     }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    // Update the neighbor's adaptive CSMA backoff state from the
+    // channel access outcome of this transmission attempt.
+
+    if (neighbor != nullptr)
+    {
+        neighbor->GetLinkInfo().UpdateCsmaBackoffOffset(aError != kErrorChannelAccessFailure);
+    }
+#endif
+
     // Log frame transmission failure.
 
     if (aError != kErrorNone)
@@ -1314,7 +1441,11 @@ void Mac::RecordFrameTransmitStatus(const TxFrame &aFrame,
 
     if ((aError == kErrorNone) && ackRequested && (aAckFrame != nullptr) && (neighbor != nullptr))
     {
+#if OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+        RecordNeighborRss(*neighbor, aAckFrame->GetRssi());
+#else
         neighbor->GetLinkInfo().AddRss(aAckFrame->GetRssi());
+#endif
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
         neighbor->AggregateLinkMetrics(/* aSeriesId */ 0, aAckFrame->GetType(), aAckFrame->GetLqi(),
                                        aAckFrame->GetRssi());
@@ -1516,6 +1647,10 @@ void Mac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, Error aError)
         }
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+        RecordTxLatency();
+#endif
+
         otDumpDebgMac("TX", aFrame.GetHeader(), aFrame.GetLength());
         FinishOperation();
         Get<MeshForwarder>().HandleSentFrame(aFrame, aError);
@@ -1680,6 +1815,11 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
 
             if (keySequence == aNeighbor->GetKeySequence())
             {
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+                Error counterError = aNeighbor->CheckLinkFrameCounter(frameCounter);
+
+                VerifyOrExit(counterError == kErrorNone, error = counterError);
+#else
                 uint32_t neighborFrameCounter;
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
@@ -1692,6 +1832,7 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
                 VerifyOrExit((frameCounter + 1) != neighborFrameCounter, error = kErrorDuplicated);
 
                 VerifyOrExit(frameCounter >= neighborFrameCounter);
+#endif // OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
             }
         }
 
@@ -1709,7 +1850,17 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         OT_UNREACHABLE_CODE(break);
     }
 
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    {
+        TimeMicro start    = TimerMicro::GetNow();
+        Error     ccmError = aFrame.ProcessReceiveAesCcm(*extAddress, *macKey);
+
+        mCounters.mRxSecurityTime += TimerMicro::GetNow() - start;
+        SuccessOrExit(ccmError);
+    }
+#else
     SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+#endif
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1717,9 +1868,15 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         {
             aNeighbor->SetKeySequence(keySequence);
             aNeighbor->SetMleFrameCounter(0);
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+            // The frame counter restarts with the new key sequence.
+            aNeighbor->ResetLinkFrameCounters();
+#endif
         }
 
-#if OPENTHREAD_CONFIG_MULTI_RADIO
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+        aNeighbor->UpdateLinkFrameCounter(frameCounter);
+#elif OPENTHREAD_CONFIG_MULTI_RADIO
         aNeighbor->GetLinkFrameCounters().Set(aFrame.GetRadioType(), frameCounter + 1);
 #else
         aNeighbor->GetLinkFrameCounters().Set(frameCounter + 1);
@@ -1829,7 +1986,16 @@ Error Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    {
+        TimeMicro start = TimerMicro::GetNow();
+
+        error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+        mCounters.mRxSecurityTime += TimerMicro::GetNow() - start;
+    }
+#else
     error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+#endif
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
@@ -1854,6 +2020,9 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     PanId     panid;
     Neighbor *neighbor;
     Error     error = aError;
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    uint64_t profileEnterTime = Get<Utils::PipelineProfiler>().GetNow();
+#endif
 
     mCounters.mRxTotal++;
 
@@ -1993,7 +2162,11 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
 
     if (neighbor != nullptr)
     {
+#if OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+        RecordNeighborRss(*neighbor, aFrame->GetRssi());
+#else
         neighbor->GetLinkInfo().AddRss(aFrame->GetRssi());
+#endif
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
         neighbor->AggregateLinkMetrics(/* aSeriesId */ 0, aFrame->GetType(), aFrame->GetLqi(), aFrame->GetRssi());
 #endif
@@ -2158,6 +2331,10 @@ exit:
             break;
         }
     }
+
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    Get<Utils::PipelineProfiler>().Sample(Utils::PipelineProfiler::kStageMacRx, profileEnterTime);
+#endif
 }
 
 bool Mac::HandleMacCommand(RxFrame &aFrame)
@@ -2251,6 +2428,34 @@ void Mac::ResetRetrySuccessHistogram()
 }
 #endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+void Mac::RecordTxLatency(void)
+{
+    uint32_t latency = TimerMilli::GetNow() - mTxLatencyStartTime;
+    uint8_t  bin     = 0;
+
+    while ((latency > 1) && (bin < TxLatencyHistogram::kNumBins - 1))
+    {
+        latency >>= 1;
+        bin++;
+    }
+
+    mTxLatencyHistogram.mBins[bin]++;
+}
+
+const uint32_t *Mac::GetTxLatencyHistogram(uint8_t &aNumberOfBins)
+{
+    aNumberOfBins = TxLatencyHistogram::kNumBins;
+
+    return mTxLatencyHistogram.mBins;
+}
+
+void Mac::ResetTxLatencyHistogram(void)
+{
+    memset(&mTxLatencyHistogram, 0, sizeof(mTxLatencyHistogram));
+}
+#endif // OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+
 // LCOV_EXCL_START
 
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
@@ -204,6 +204,22 @@ public:
      */
     void RequestDirectFrameTransmission(void);
 
+#if OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+    /**
+     * This method attempts to preempt an in-progress direct data transmit operation whose CSMA backoff has not
+     * yet started transmission.
+     *
+     * On success, the pending backoff is canceled and the direct transmit operation is re-queued, allowing a
+     * higher-priority transmit request (e.g., a data poll or a net-priority message) to be serviced first. The
+     * preempted frame is prepared again when the re-queued operation is performed.
+     *
+     * @retval TRUE   The direct data transmit operation was preempted and re-queued.
+     * @retval FALSE  There was no direct data transmit operation in a cancelable CSMA backoff.
+     *
+     */
+    bool TryPreemptTransmitDataDirect(void);
+#endif
+
 #if OPENTHREAD_FTD
     /**
      * This method requests an indirect data frame transmission.
@@ -618,6 +634,28 @@ public:
     void ResetRetrySuccessHistogram(void);
 #endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+    /**
+     * This method returns the histogram of queue-to-air latency for direct frame transmissions.
+     *
+     * The latency is measured from when a direct frame transmission is requested until the transmit-done callback
+     * for the frame is processed. Bin `n` (for `n >= 1`) counts transmissions with latency in range
+     * `[2^n, 2^(n+1))` msec, with bin zero covering `[0,2)` and the last bin also covering all larger latencies.
+     *
+     * @param[out]  aNumberOfBins    A reference to where the size of returned histogram array is placed.
+     *
+     * @returns     A pointer to the histogram of transmit latencies (in a form of an array).
+     *
+     */
+    const uint32_t *GetTxLatencyHistogram(uint8_t &aNumberOfBins);
+
+    /**
+     * This method resets the MAC transmit latency histogram.
+     *
+     */
+    void ResetTxLatencyHistogram(void);
+#endif // OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+
     /**
      * This method returns the noise floor value (currently use the radio receive sensitivity value).
      *
@@ -796,6 +834,18 @@ private:
     };
 #endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+    struct TxLatencyHistogram
+    {
+        static constexpr uint8_t kNumBins = OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_BIN_COUNT;
+
+        /**
+         * Histogram of queue-to-air latency for direct frame transmissions, with power-of-two bin boundaries.
+         */
+        uint32_t mBins[kNumBins];
+    };
+#endif
+
     Error ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor);
     void  ProcessTransmitSecurity(TxFrame &aFrame);
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
@@ -817,6 +867,16 @@ private:
     void        HandleTimer(void);
     static void HandleOperationTask(Tasklet &aTasklet);
 
+#if OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+    void        RecordNeighborRss(Neighbor &aNeighbor, int8_t aRss);
+    void        ProcessRssSamples(void);
+    static void HandleRssSampleTask(Tasklet &aTasklet);
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+    void RecordTxLatency(void);
+#endif
+
     void  Scan(Operation aScanOperation, uint32_t aScanChannels, uint16_t aScanDuration);
     Error UpdateScanChannel(void);
     void  PerformActiveScan(void);
@@ -909,10 +969,26 @@ private:
     uint32_t           mKeyIdMode2FrameCounter;
     SuccessRateTracker mCcaSuccessRateTracker;
     uint16_t           mCcaSampleCount;
+#if OPENTHREAD_CONFIG_MAC_DEFERRED_RSS_AVERAGING_ENABLE
+    static constexpr uint8_t kRssSampleBufferSize = OPENTHREAD_CONFIG_MAC_RSS_SAMPLE_BUFFER_SIZE;
+
+    // Pending (neighbor, RSS) samples kept as two parallel arrays and
+    // averaged together in a deferred tasklet pass.
+
+    Neighbor *mRssSampleNeighbors[kRssSampleBufferSize];
+    int8_t    mRssSampleValues[kRssSampleBufferSize];
+    uint8_t   mRssSampleCount;
+    Tasklet   mRssSampleTask;
+#endif
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
     RetryHistogram mRetryHistogram;
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_TX_LATENCY_HISTOGRAM_ENABLE
+    TimeMilli          mTxLatencyStartTime;
+    TxLatencyHistogram mTxLatencyHistogram;
+#endif
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     RadioTypes mTxPendingRadioLinks;
     RadioTypes mTxBeaconRadioLinks;
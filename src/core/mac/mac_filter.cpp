@@ -46,20 +46,40 @@ Filter::Filter(void)
 {
     for (FilterEntry &entry : mFilterEntries)
     {
-        entry.mFiltered = false;
-        entry.mRssIn    = kFixedRssDisabled;
+        entry.mFiltered  = false;
+        entry.mRssIn     = kFixedRssDisabled;
+        entry.mNextIndex = kNoEntryIndex;
+        entry.mNumHits   = 0;
     }
+
+    for (uint16_t &bucket : mHashTable)
+    {
+        bucket = kNoEntryIndex;
+    }
+}
+
+uint16_t Filter::HashBucketOf(const ExtAddress &aExtAddress)
+{
+    uint16_t hash = 0;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        hash = static_cast<uint16_t>((hash << 5) - hash + byte);
+    }
+
+    return hash % kNumHashBuckets;
 }
 
 Filter::FilterEntry *Filter::FindEntry(const ExtAddress &aExtAddress)
 {
     FilterEntry *rval = nullptr;
 
-    for (FilterEntry &entry : mFilterEntries)
+    for (uint16_t index = mHashTable[HashBucketOf(aExtAddress)]; index != kNoEntryIndex;
+         index = mFilterEntries[index].mNextIndex)
     {
-        if (entry.IsInUse() && (aExtAddress == entry.mExtAddress))
+        if (aExtAddress == mFilterEntries[index].mExtAddress)
         {
-            ExitNow(rval = &entry);
+            ExitNow(rval = &mFilterEntries[index]);
         }
     }
 
@@ -67,6 +87,36 @@ exit:
     return rval;
 }
 
+void Filter::AddToHashTable(FilterEntry &aEntry)
+{
+    uint16_t bucket = HashBucketOf(aEntry.mExtAddress);
+
+    aEntry.mNextIndex  = mHashTable[bucket];
+    mHashTable[bucket] = static_cast<uint16_t>(&aEntry - mFilterEntries);
+}
+
+void Filter::RemoveFromHashTable(const FilterEntry &aEntry)
+{
+    uint16_t bucket     = HashBucketOf(aEntry.mExtAddress);
+    uint16_t entryIndex = static_cast<uint16_t>(&aEntry - mFilterEntries);
+
+    if (mHashTable[bucket] == entryIndex)
+    {
+        mHashTable[bucket] = aEntry.mNextIndex;
+    }
+    else
+    {
+        uint16_t index = mHashTable[bucket];
+
+        while (mFilterEntries[index].mNextIndex != entryIndex)
+        {
+            index = mFilterEntries[index].mNextIndex;
+        }
+
+        mFilterEntries[index].mNextIndex = aEntry.mNextIndex;
+    }
+}
+
 Filter::FilterEntry *Filter::FindAvailableEntry(void)
 {
     FilterEntry *rval = nullptr;
@@ -92,6 +142,8 @@ Error Filter::AddAddress(const ExtAddress &aExtAddress)
     {
         VerifyOrExit((entry = FindAvailableEntry()) != nullptr, error = kErrorNoBufs);
         entry->mExtAddress = aExtAddress;
+        entry->mNumHits    = 0;
+        AddToHashTable(*entry);
     }
 
     entry->mFiltered = true;
@@ -107,6 +159,11 @@ void Filter::RemoveAddress(const ExtAddress &aExtAddress)
     if (entry != nullptr)
     {
         entry->mFiltered = false;
+
+        if (!entry->IsInUse())
+        {
+            RemoveFromHashTable(*entry);
+        }
     }
 }
 
@@ -114,7 +171,15 @@ void Filter::ClearAddresses(void)
 {
     for (FilterEntry &entry : mFilterEntries)
     {
-        entry.mFiltered = false;
+        if (entry.mFiltered)
+        {
+            entry.mFiltered = false;
+
+            if (!entry.IsInUse())
+            {
+                RemoveFromHashTable(entry);
+            }
+        }
     }
 }
 
@@ -130,6 +195,7 @@ Error Filter::GetNextAddress(Iterator &aIterator, Entry &aEntry) const
         {
             aEntry.mExtAddress = entry.mExtAddress;
             aEntry.mRssIn      = entry.mRssIn;
+            aEntry.mNumHits    = entry.mNumHits;
             error              = kErrorNone;
             aIterator++;
             break;
@@ -150,6 +216,8 @@ Error Filter::AddRssIn(const ExtAddress &aExtAddress, int8_t aRss)
         VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
 
         entry->mExtAddress = aExtAddress;
+        entry->mNumHits    = 0;
+        AddToHashTable(*entry);
     }
 
     entry->mRssIn = aRss;
@@ -166,6 +234,11 @@ void Filter::RemoveRssIn(const ExtAddress &aExtAddress)
 
     entry->mRssIn = kFixedRssDisabled;
 
+    if (!entry->IsInUse())
+    {
+        RemoveFromHashTable(*entry);
+    }
+
 exit:
     return;
 }
@@ -174,7 +247,15 @@ void Filter::ClearAllRssIn(void)
 {
     for (FilterEntry &entry : mFilterEntries)
     {
-        entry.mRssIn = kFixedRssDisabled;
+        if (entry.mRssIn != kFixedRssDisabled)
+        {
+            entry.mRssIn = kFixedRssDisabled;
+
+            if (!entry.IsInUse())
+            {
+                RemoveFromHashTable(entry);
+            }
+        }
     }
 
     mDefaultRssIn = kFixedRssDisabled;
@@ -192,6 +273,7 @@ Error Filter::GetNextRssIn(Iterator &aIterator, Entry &aEntry)
         {
             aEntry.mExtAddress = entry.mExtAddress;
             aEntry.mRssIn      = entry.mRssIn;
+            aEntry.mNumHits    = entry.mNumHits;
             error              = kErrorNone;
             aIterator++;
             ExitNow();
@@ -202,8 +284,9 @@ Error Filter::GetNextRssIn(Iterator &aIterator, Entry &aEntry)
     if ((aIterator == OT_ARRAY_LENGTH(mFilterEntries)) && (mDefaultRssIn != kFixedRssDisabled))
     {
         static_cast<ExtAddress &>(aEntry.mExtAddress).Fill(0xff);
-        aEntry.mRssIn = mDefaultRssIn;
-        error         = kErrorNone;
+        aEntry.mRssIn   = mDefaultRssIn;
+        aEntry.mNumHits = 0;
+        error           = kErrorNone;
         aIterator++;
     }
 
@@ -220,6 +303,11 @@ Error Filter::Apply(const ExtAddress &aExtAddress, int8_t &aRss)
     // Use the default RssIn setting for all receiving messages first.
     aRss = mDefaultRssIn;
 
+    if (entry != nullptr)
+    {
+        entry->mNumHits++;
+    }
+
     // In allowlist mode, entry must be present in the list, in
     // denylist mode it must not be present.
 
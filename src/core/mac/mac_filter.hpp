@@ -222,23 +222,37 @@ public:
     Error Apply(const ExtAddress &aExtAddress, int8_t &aRss);
 
 private:
-    static constexpr uint16_t kMaxEntries = OPENTHREAD_CONFIG_MAC_FILTER_SIZE;
+    static constexpr uint16_t kMaxEntries     = OPENTHREAD_CONFIG_MAC_FILTER_SIZE;
+    static constexpr uint16_t kNumHashBuckets = kMaxEntries;
+    static constexpr uint16_t kNoEntryIndex   = 0xffff; // Index value indicating end of a hash bucket chain.
 
     struct FilterEntry
     {
         bool       mFiltered;   // Indicates whether or not this entry is filtered (allowlist/denylist modes).
         int8_t     mRssIn;      // The RssIn value for this entry or `kFixedRssDisabled`.
         ExtAddress mExtAddress; // IEEE 802.15.4 Extended Address.
+        uint16_t   mNextIndex;  // Index of next entry in the same hash bucket chain (`kNoEntryIndex` at end).
+        uint32_t   mNumHits;    // Number of received frames that matched this entry.
 
         bool IsInUse(void) const { return mFiltered || (mRssIn != kFixedRssDisabled); }
     };
 
+    static uint16_t HashBucketOf(const ExtAddress &aExtAddress);
+
     FilterEntry *FindAvailableEntry(void);
     FilterEntry *FindEntry(const ExtAddress &aExtAddress);
+    void         AddToHashTable(FilterEntry &aEntry);
+    void         RemoveFromHashTable(const FilterEntry &aEntry);
 
     Mode        mMode;
     int8_t      mDefaultRssIn;
     FilterEntry mFilterEntries[kMaxEntries];
+
+    // Hash table over in-use entries (indexed by ext address), keeping
+    // the per-received-frame lookup in `Apply()` O(1) with large
+    // allow/deny lists. Buckets hold entry indices (`kNoEntryIndex`
+    // when empty), chained through `FilterEntry::mNextIndex`.
+    uint16_t mHashTable[kNumHashBuckets];
 };
 
 /**
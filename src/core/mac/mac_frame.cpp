@@ -901,18 +901,6 @@ template <typename IeType> Error Frame::AppendHeaderIeAt(uint8_t &aIndex)
 {
     Error error = kErrorNone;
 
-    SuccessOrExit(error = InitIeHeaderAt(aIndex, IeType::kHeaderIeId, IeType::kIeContentSize));
-
-    InitIeContentAt<IeType>(aIndex);
-
-exit:
-    return error;
-}
-
-Error Frame::InitIeHeaderAt(uint8_t &aIndex, uint8_t ieId, uint8_t ieContentSize)
-{
-    Error error = kErrorNone;
-
     if (aIndex == 0)
     {
         aIndex = FindHeaderIeIndex();
@@ -920,10 +908,15 @@ Error Frame::InitIeHeaderAt(uint8_t &aIndex, uint8_t ieId, uint8_t ieContentSize
 
     VerifyOrExit(aIndex != kInvalidIndex, error = kErrorNotFound);
 
-    reinterpret_cast<HeaderIe *>(mPsdu + aIndex)->Init(ieId, ieContentSize);
+    // The IE header (Id and content length) is a compile-time constant
+    // for each IE type.
+    WriteUint16(HeaderIe::MakeValue(IeType::kHeaderIeId, IeType::kIeContentSize), mPsdu + aIndex);
     aIndex += sizeof(HeaderIe);
 
-    mLength += sizeof(HeaderIe) + ieContentSize;
+    mLength += sizeof(HeaderIe) + IeType::kIeContentSize;
+
+    InitIeContentAt<IeType>(aIndex);
+
 exit:
     return error;
 }
@@ -931,7 +924,9 @@ exit:
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
 template <> void Frame::InitIeContentAt<TimeIe>(uint8_t &aIndex)
 {
-    reinterpret_cast<TimeIe *>(mPsdu + aIndex)->Init();
+    // The vendor header (OUI and sub-type) is a compile-time constant;
+    // only the time sequence and network time are patched per frame.
+    WriteUint32(VendorIeHeader::MakeValue(TimeIe::kVendorOuiNest, TimeIe::kVendorIeTime), mPsdu + aIndex);
     aIndex += sizeof(TimeIe);
 }
 #endif
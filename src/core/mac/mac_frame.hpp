@@ -81,6 +81,24 @@ public:
      */
     void Init(uint16_t aId, uint8_t aLen);
 
+    /**
+     * This static method returns the encoded two-byte Header IE value for a given Id and content length.
+     *
+     * The value matches the in-memory (little-endian) IE layout, so for compile-time constant Id and length the
+     * full IE header materializes as a single constant (to be written with `LittleEndian::WriteUint16()`) instead
+     * of being assembled field by field at runtime.
+     *
+     * @param[in]  aId      The IE Element Id.
+     * @param[in]  aLength  The IE content length.
+     *
+     * @returns The encoded Header IE value.
+     *
+     */
+    static constexpr uint16_t MakeValue(uint16_t aId, uint8_t aLength)
+    {
+        return static_cast<uint16_t>(((aId << kIdOffset) & kIdMask) | (aLength & kLengthMask));
+    }
+
     /**
      * This method returns the IE Element Id.
      *
@@ -183,6 +201,23 @@ public:
      */
     void SetSubType(uint8_t aSubType) { mSubType = aSubType; }
 
+    /**
+     * This static method returns the encoded vendor header (OUI and sub-type) as a 32-bit value.
+     *
+     * The value matches the in-memory (little-endian) layout, so for compile-time constant OUI and sub-type the
+     * full vendor header materializes as a single constant (to be written with `LittleEndian::WriteUint32()`).
+     *
+     * @param[in]  aVendorOui  The Vendor OUI.
+     * @param[in]  aSubType    The Vendor IE sub-type.
+     *
+     * @returns The encoded vendor header value.
+     *
+     */
+    static constexpr uint32_t MakeValue(uint32_t aVendorOui, uint8_t aSubType)
+    {
+        return (aVendorOui & 0xffffff) | (static_cast<uint32_t>(aSubType) << 24);
+    }
+
 private:
     static constexpr uint8_t kOuiSize = 3;
 
@@ -1080,7 +1115,6 @@ protected:
 #if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
     uint8_t FindHeaderIeIndex(void) const;
 
-    Error                           InitIeHeaderAt(uint8_t &aIndex, uint8_t ieId, uint8_t ieContentSize);
     template <typename IeType> void InitIeContentAt(uint8_t &aIndex);
 #endif
 
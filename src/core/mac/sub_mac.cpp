@@ -55,7 +55,13 @@ SubMac::SubMac(Instance &aInstance)
     , mState(kStateDisabled)
     , mCsmaBackoffs(0)
     , mTransmitRetries(0)
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    , mCsmaMinBeOffset(0)
+#endif
     , mShortAddress(kShortAddrInvalid)
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+    , mPanId(kPanIdBroadcast)
+#endif
     , mRxOnWhenBackoff(true)
     , mEnergyScanMaxRssi(kInvalidRssiValue)
     , mEnergyScanEndTime(0)
@@ -73,11 +79,18 @@ SubMac::SubMac(Instance &aInstance)
     , mCslLastSync(0)
     , mCslParentAccuracy(kCslWorstCrystalPpm)
     , mCslParentUncert(kCslWorstUncertainty)
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+    , mCslWindowScale(kCslWindowScaleMax)
+    , mCslGoodSyncCount(0)
+#endif
     , mCslState(kCslIdle)
     , mCslTimer(aInstance, SubMac::HandleCslTimer)
 #endif
 {
     mExtAddress.Clear();
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+    mRxFilterCounters.Clear();
+#endif
 }
 
 otRadioCaps SubMac::GetCaps(void) const
@@ -126,6 +139,9 @@ otRadioCaps SubMac::GetCaps(void) const
 
 void SubMac::SetPanId(PanId aPanId)
 {
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+    mPanId = aPanId;
+#endif
     Get<Radio>().SetPanId(aPanId);
     otLogDebgMac("RadioPanId: 0x%04x", aPanId);
 }
@@ -254,13 +270,99 @@ exit:
 }
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+bool SubMac::ShouldDropReceivedFrame(const RxFrame &aFrame)
+{
+    bool    drop = false;
+    PanId   dstPanId;
+    Address dstAddr;
+
+    // Cheap triage of the received frame (PSDU sanity, frame type, and
+    // destination PAN ID / address against the cached addresses) before
+    // any upper-layer MAC processing of the frame.
+
+    if (aFrame.ValidatePsdu() != kErrorNone)
+    {
+        mRxFilterCounters.mDropMinLength++;
+        ExitNow(drop = true);
+    }
+
+    switch (aFrame.GetType())
+    {
+    case Frame::kFcfFrameData:
+    case Frame::kFcfFrameMacCmd:
+        break;
+
+    case Frame::kFcfFrameBeacon:
+    case Frame::kFcfFrameAck:
+        // Beacons (used while scanning) and acks carry no destination
+        // address to triage against and are passed through.
+        ExitNow();
+
+    default:
+        mRxFilterCounters.mDropFrameType++;
+        ExitNow(drop = true);
+    }
+
+    if ((mPanId != kPanIdBroadcast) && aFrame.IsDstPanIdPresent() && (aFrame.GetDstPanId(dstPanId) == kErrorNone) &&
+        (dstPanId != kPanIdBroadcast) && (dstPanId != mPanId))
+    {
+        mRxFilterCounters.mDropDstPanId++;
+        ExitNow(drop = true);
+    }
+
+    SuccessOrExit(aFrame.GetDstAddr(dstAddr));
+
+    switch (dstAddr.GetType())
+    {
+    case Address::kTypeShort:
+        if ((dstAddr.GetShort() != kShortAddrBroadcast) && (dstAddr.GetShort() != mShortAddress))
+        {
+            mRxFilterCounters.mDropDstAddr++;
+            drop = true;
+        }
+        break;
+
+    case Address::kTypeExtended:
+        if (dstAddr.GetExtended() != mExtAddress)
+        {
+            mRxFilterCounters.mDropDstAddr++;
+            drop = true;
+        }
+        break;
+
+    case Address::kTypeNone:
+        break;
+    }
+
+exit:
+    return drop;
+}
+#endif // OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+
 void SubMac::HandleReceiveDone(RxFrame *aFrame, Error aError)
 {
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+    // The filter is bypassed while a pcap callback is set so that
+    // promiscuous monitoring continues to see all frames.
+    if ((aFrame != nullptr) && (aError == kErrorNone) && (mPcapCallback == nullptr) && ShouldDropReceivedFrame(*aFrame))
+    {
+        return;
+    }
+#endif
+
     if (mPcapCallback && (aFrame != nullptr) && (aError == kErrorNone))
     {
         mPcapCallback(aFrame, false, mPcapCallbackContext);
     }
 
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE && (OPENTHREAD_MTD || OPENTHREAD_FTD)
+    if ((aFrame != nullptr) && (aError == kErrorNone))
+    {
+        Get<Utils::FrameCapture>().HandleFrame(*aFrame, /* aIsTx */ false);
+    }
+#endif
+
     if (!ShouldHandleTransmitSecurity() && aFrame != nullptr && aFrame->mInfo.mRxInfo.mAckedWithSecEnhAck)
     {
         UpdateFrameCounter(aFrame->mInfo.mRxInfo.mAckFrameCounter);
@@ -272,6 +374,9 @@ void SubMac::HandleReceiveDone(RxFrame *aFrame, Error aError)
         // Assuming the risk of the parent missing the Enh-ACK in favor of smaller CSL receive window
         if ((mCslPeriod > 0) && aFrame->mInfo.mRxInfo.mAckedWithSecEnhAck)
         {
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+            UpdateCslWindowScale(TimeMicro(static_cast<uint32_t>(aFrame->mInfo.mRxInfo.mTimestamp)));
+#endif
             mCslLastSync = TimeMicro(static_cast<uint32_t>(aFrame->mInfo.mRxInfo.mTimestamp));
         }
 
@@ -321,6 +426,23 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+bool SubMac::TryCancelCsmaBackoff(void)
+{
+    bool didCancel = false;
+
+    VerifyOrExit(mState == kStateCsmaBackoff);
+
+    mTimer.Stop();
+    IgnoreError(Get<Radio>().Receive(mTransmitFrame.GetChannel()));
+    SetState(kStateReceive);
+    didCancel = true;
+
+exit:
+    return didCancel;
+}
+#endif
+
 void SubMac::ProcessTransmitSecurity(void)
 {
     const ExtAddress *extAddress = nullptr;
@@ -367,6 +489,10 @@ void SubMac::StartCsmaBackoff(void)
     uint32_t backoff;
     uint32_t backoffExponent = kMinBE + mTransmitRetries + mCsmaBackoffs;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    backoffExponent += mCsmaMinBeOffset;
+#endif
+
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     if (mTransmitFrame.mInfo.mTxInfo.mTxDelay != 0)
     {
@@ -450,6 +576,10 @@ void SubMac::BeginTransmit(void)
         mPcapCallback(&mTransmitFrame, true, mPcapCallbackContext);
     }
 
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE && (OPENTHREAD_MTD || OPENTHREAD_FTD)
+    Get<Utils::FrameCapture>().HandleFrame(mTransmitFrame, /* aIsTx */ true);
+#endif
+
     error = Get<Radio>().Transmit(mTransmitFrame);
     if (error == kErrorInvalidState && mTransmitFrame.mInfo.mTxInfo.mTxDelay > 0)
     {
@@ -957,7 +1087,11 @@ void SubMac::SetCslPeriod(uint16_t aPeriod)
     if (mCslPeriod > 0)
     {
         mCslSampleTime = TimeMicro(static_cast<uint32_t>(otPlatRadioGetNow(&GetInstance())));
-        mCslState      = kCslSleep;
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+        mCslWindowScale   = kCslWindowScaleMax;
+        mCslGoodSyncCount = 0;
+#endif
+        mCslState = kCslSleep;
         HandleCslTimer();
     }
     else
@@ -1071,9 +1205,66 @@ void SubMac::GetCslWindowEdges(uint32_t &ahead, uint32_t &after)
     semiWindow = static_cast<uint32_t>(elapsed * (Get<Radio>().GetCslAccuracy() + mCslParentAccuracy) / 1000000);
     semiWindow += mCslParentUncert * kUsPerUncertUnit;
 
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+    semiWindow = static_cast<uint32_t>(static_cast<uint64_t>(semiWindow) * mCslWindowScale / 100);
+#endif
+
     ahead = (semiWindow + kCslReceiveTimeAhead > semiPeriod) ? semiPeriod : semiWindow + kCslReceiveTimeAhead;
     after = (semiWindow + kMinCslWindow > semiPeriod) ? semiPeriod : semiWindow + kMinCslWindow;
 }
+
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+void SubMac::UpdateCslWindowScale(TimeMicro aSyncTimestamp)
+{
+    uint32_t elapsed = aSyncTimestamp.GetValue() - mCslLastSync.GetValue();
+    int32_t  offset  = static_cast<int32_t>(aSyncTimestamp.GetValue() - mCslSampleTime.GetValue());
+    uint32_t drift   = (offset < 0) ? static_cast<uint32_t>(-offset) : static_cast<uint32_t>(offset);
+    uint32_t semiWindow;
+    uint32_t scaledWindow;
+
+    VerifyOrExit(mCslLastSync.GetValue() != 0);
+
+    semiWindow = static_cast<uint32_t>(static_cast<uint64_t>(elapsed) *
+                                       (Get<Radio>().GetCslAccuracy() + mCslParentAccuracy) / 1000000);
+    semiWindow += mCslParentUncert * kUsPerUncertUnit;
+
+    // A frame outside even the worst-case guard band is not window
+    // synchronized (e.g. received during a data poll exchange) and
+    // carries no drift-rate information.
+    VerifyOrExit(drift <= semiWindow);
+
+    scaledWindow = static_cast<uint32_t>(static_cast<uint64_t>(semiWindow) * mCslWindowScale / 100);
+
+    if (drift > scaledWindow)
+    {
+        // Near miss: the frame would have fallen outside a further
+        // shrunken window. Restore the full guard bands.
+        mCslWindowScale   = kCslWindowScaleMax;
+        mCslGoodSyncCount = 0;
+        otLogDebgMac("CSL window scale reset (drift %u, window %u)", drift, scaledWindow);
+    }
+    else if (drift * kCslShrinkMarginDiv <= scaledWindow)
+    {
+        mCslGoodSyncCount++;
+
+        if (mCslGoodSyncCount >= kCslShrinkSyncCount)
+        {
+            mCslGoodSyncCount = 0;
+            mCslWindowScale   = (mCslWindowScale > kCslWindowScaleMin + kCslWindowScaleStep)
+                                  ? static_cast<uint8_t>(mCslWindowScale - kCslWindowScaleStep)
+                                  : kCslWindowScaleMin;
+            otLogDebgMac("CSL window scale %u%%", mCslWindowScale);
+        }
+    }
+    else
+    {
+        mCslGoodSyncCount = 0;
+    }
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
 #endif // OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
 
 } // namespace Mac
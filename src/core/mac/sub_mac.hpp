@@ -40,6 +40,7 @@
 
 #include <openthread/platform/crypto.h>
 
+#include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/timer.hpp"
@@ -348,6 +349,20 @@ public:
      */
     Error Send(void);
 
+#if OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+    /**
+     * This method attempts to cancel a pending CSMA backoff whose transmission has not yet started.
+     *
+     * On success the `SubMac` returns to receive state and the frame in `GetTransmitFrame()` is discarded. The
+     * caller is expected to prepare the preempted frame again later and re-request its transmission.
+     *
+     * @retval TRUE   The pending CSMA backoff was canceled.
+     * @retval FALSE  There was no pending CSMA backoff (e.g., transmission already started).
+     *
+     */
+    bool TryCancelCsmaBackoff(void);
+#endif
+
     /**
      * This method gets the number of transmit retries of last transmitted frame.
      *
@@ -540,11 +555,54 @@ public:
      */
     void SetFrameCounter(uint32_t aFrameCounter);
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    /**
+     * This method sets the backoff exponent offset added to `macMinBE` for the next frame transmission.
+     *
+     * The offset is determined by the MAC layer from the destination neighbor's adaptive backoff state.
+     *
+     * @param[in] aOffset  The backoff exponent offset.
+     *
+     */
+    void SetCsmaMinBeOffset(uint8_t aOffset) { mCsmaMinBeOffset = aOffset; }
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+    /**
+     * This structure contains the per-reason counters of frames dropped by the receive-path early filter.
+     *
+     */
+    struct RxFilterCounters : public Clearable<RxFilterCounters>
+    {
+        uint32_t mDropMinLength; ///< Number of frames dropped due to an invalid or truncated PSDU.
+        uint32_t mDropFrameType; ///< Number of frames dropped due to an unsupported frame type.
+        uint32_t mDropDstPanId;  ///< Number of frames dropped due to a destination PAN ID mismatch.
+        uint32_t mDropDstAddr;   ///< Number of frames dropped due to a destination address mismatch.
+    };
+
+    /**
+     * This method returns the counters of frames dropped by the receive-path early filter.
+     *
+     * @returns The early filter drop counters.
+     *
+     */
+    const RxFilterCounters &GetRxFilterCounters(void) const { return mRxFilterCounters; }
+
+    /**
+     * This method resets the counters of frames dropped by the receive-path early filter.
+     *
+     */
+    void ResetRxFilterCounters(void) { mRxFilterCounters.Clear(); }
+#endif
+
 private:
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
     static void HandleCslTimer(Timer &aTimer);
     void        HandleCslTimer(void);
     void        GetCslWindowEdges(uint32_t &ahead, uint32_t &after);
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+    void UpdateCslWindowScale(TimeMicro aSyncTimestamp);
+#endif
 #endif
 
     static constexpr uint8_t  kMinBE             = 3;   // macMinBE (IEEE 802.15.4-2006).
@@ -584,6 +642,20 @@ private:
     // than expected sample window. The value is in usec.
     static constexpr uint32_t kCslReceiveTimeAhead = OPENTHREAD_CONFIG_CSL_RECEIVE_TIME_AHEAD;
 
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+    // The guard bands shrink by `kCslWindowScaleStep` percent after
+    // `kCslShrinkSyncCount` consecutive synchronizing frames arrive
+    // within `1/kCslShrinkMarginDiv` of the scaled guard band, down to
+    // `kCslWindowScaleMin` percent of the worst-case guard band. A
+    // frame arriving outside the scaled guard band (a near miss)
+    // restores the full guard band.
+    static constexpr uint8_t kCslWindowScaleMin  = OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_MIN_SCALE;
+    static constexpr uint8_t kCslWindowScaleMax  = 100;
+    static constexpr uint8_t kCslWindowScaleStep = 15;
+    static constexpr uint8_t kCslShrinkSyncCount = 4;
+    static constexpr uint8_t kCslShrinkMarginDiv = 4;
+#endif
+
     enum CslState : uint8_t{
         kCslIdle,   // CSL receiver is not started.
         kCslSample, // Sampling CSL channel.
@@ -616,6 +688,10 @@ private:
     void BeginTransmit(void);
     void SampleRssi(void);
 
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+    bool ShouldDropReceivedFrame(const RxFrame &aFrame);
+#endif
+
     void HandleReceiveDone(RxFrame *aFrame, Error aError);
     void HandleTransmitStarted(TxFrame &aFrame);
     void HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, Error aError);
@@ -635,8 +711,15 @@ private:
     State              mState;
     uint8_t            mCsmaBackoffs;
     uint8_t            mTransmitRetries;
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    uint8_t            mCsmaMinBeOffset;
+#endif
     ShortAddress       mShortAddress;
     ExtAddress         mExtAddress;
+#if OPENTHREAD_CONFIG_MAC_RX_EARLY_FILTER_ENABLE
+    PanId            mPanId;
+    RxFilterCounters mRxFilterCounters;
+#endif
     bool               mRxOnWhenBackoff;
     int8_t             mEnergyScanMaxRssi;
     TimeMilli          mEnergyScanEndTime;
@@ -663,6 +746,10 @@ private:
     TimeMicro  mCslLastSync;               // The timestamp of the last successful CSL synchronization.
     uint8_t    mCslParentAccuracy;         // Drift of timer used for scheduling CSL tx by the parent, in ± ppm.
     uint8_t    mCslParentUncert;           // Uncertainty of the scheduling CSL of tx by the parent, in ±10 us units.
+#if OPENTHREAD_CONFIG_MAC_CSL_ADAPTIVE_WINDOW_ENABLE
+    uint8_t    mCslWindowScale;            // Scale (in percent) applied to the worst-case guard bands.
+    uint8_t    mCslGoodSyncCount;          // Number of consecutive syncs well inside the scaled guard band.
+#endif
     CslState   mCslState;
     TimerMicro mCslTimer;
 #endif
@@ -272,6 +272,30 @@ void BorderAgent::HandleRequest<&BorderAgent::mProxyTransmit>(void *
     static_cast<BorderAgent *>(aContext)->HandleProxyTransmit(*static_cast<Coap::Message *>(aMessage));
 }
 
+#if OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE
+
+template <>
+void BorderAgent::HandleRequest<&BorderAgent::mActiveGet>(void *               aContext,
+                                                          otMessage *          aMessage,
+                                                          const otMessageInfo *aMessageInfo)
+{
+    static_cast<BorderAgent *>(aContext)->HandleDatasetGet(*static_cast<Coap::Message *>(aMessage),
+                                                           *static_cast<const Ip6::MessageInfo *>(aMessageInfo),
+                                                           /* aIsActive */ true);
+}
+
+template <>
+void BorderAgent::HandleRequest<&BorderAgent::mPendingGet>(void *               aContext,
+                                                           otMessage *          aMessage,
+                                                           const otMessageInfo *aMessageInfo)
+{
+    static_cast<BorderAgent *>(aContext)->HandleDatasetGet(*static_cast<Coap::Message *>(aMessage),
+                                                           *static_cast<const Ip6::MessageInfo *>(aMessageInfo),
+                                                           /* aIsActive */ false);
+}
+
+#endif // OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE
+
 BorderAgent::BorderAgent(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mCommissionerPetition(UriPath::kCommissionerPetition,
@@ -450,6 +474,40 @@ void BorderAgent::HandleKeepAlive(const Coap::Message &aMessage, const Ip6::Mess
     }
 }
 
+#if OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE
+void BorderAgent::HandleDatasetGet(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo, bool aIsActive)
+{
+    Error          error = kErrorNone;
+    Coap::Message *message;
+
+    // The local dataset is kept in sync with the leader through MLE,
+    // so the request can be answered locally in one hop instead of
+    // being forwarded to the leader as a fresh TMF transaction.
+
+    if (aIsActive)
+    {
+        message = Get<ActiveDataset>().ProcessGetRequest(aMessage);
+    }
+    else
+    {
+        message = Get<PendingDataset>().ProcessGetRequest(aMessage);
+    }
+
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = Get<Coap::CoapSecure>().SendMessage(*message, aMessageInfo));
+
+    otLogInfoMeshCoP("Served %s dataset get locally", aIsActive ? "active" : "pending");
+
+exit:
+    if (error != kErrorNone)
+    {
+        FreeMessage(message);
+        SendErrorMessage(aMessage, /* aSeparate */ false, error);
+    }
+}
+#endif // OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE
+
 void BorderAgent::HandleRelayTransmit(const Coap::Message &aMessage)
 {
     Error            error = kErrorNone;
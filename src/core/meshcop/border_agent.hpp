@@ -163,6 +163,9 @@ private:
                                 bool                    aSeparate);
     Error       ForwardToCommissioner(Coap::Message &aForwardMessage, const Message &aMessage);
     void        HandleKeepAlive(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+#if OPENTHREAD_CONFIG_BORDER_AGENT_DATASET_GET_LOCAL_ENABLE
+    void        HandleDatasetGet(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo, bool aIsActive);
+#endif
     void        HandleRelayTransmit(const Coap::Message &aMessage);
     void        HandleRelayReceive(const Coap::Message &aMessage);
     void        HandleProxyTransmit(const Coap::Message &aMessage);
@@ -63,6 +63,9 @@ Commissioner::Commissioner(Instance &aInstance)
     , mTransmitAttempts(0)
     , mJoinerExpirationTimer(aInstance, HandleJoinerExpirationTimer)
     , mTimer(aInstance, HandleTimer)
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+    , mPendingRelayTask(aInstance, HandlePendingRelayTask)
+#endif
     , mRelayReceive(UriPath::kRelayRx, &Commissioner::HandleRelayReceive, this)
     , mDatasetChanged(UriPath::kDatasetChanged, &Commissioner::HandleDatasetChanged, this)
     , mJoinerFinalize(UriPath::kJoinerFinalize, &Commissioner::HandleJoinerFinalize, this)
@@ -76,6 +79,8 @@ Commissioner::Commissioner(Instance &aInstance)
 {
     memset(reinterpret_cast<void *>(mJoiners), 0, sizeof(mJoiners));
 
+    mSteeringData.Init();
+
     mCommissionerAloc.Clear();
     mCommissionerAloc.mPrefixLength       = 64;
     mCommissionerAloc.mPreferred          = true;
@@ -157,6 +162,13 @@ void Commissioner::HandleCoapsConnected(bool aConnected, void *aContext)
 void Commissioner::HandleCoapsConnected(bool aConnected)
 {
     SignalJoinerEvent(aConnected ? kJoinerEventConnected : kJoinerEventEnd, mActiveJoiner);
+
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+    if (!aConnected)
+    {
+        mPendingRelayTask.Post();
+    }
+#endif
 }
 
 Commissioner::Joiner *Commissioner::GetUnusedJoinerEntry(void)
@@ -288,6 +300,7 @@ void Commissioner::RemoveJoinerEntry(Commissioner::Joiner &aJoiner)
 
     UpdateJoinerExpirationTimer();
 
+    RebuildSteeringData();
     SendCommissionerSet();
 
     LogJoinerEntry("Removed", joinerCopy);
@@ -351,6 +364,10 @@ Error Commissioner::Stop(bool aResign)
 
     mTimer.Stop();
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+    mPendingRelayQueue.DequeueAndFreeAll();
+#endif
+
     SetState(kStateDisabled);
 
     if (needResign && aResign)
@@ -367,11 +384,13 @@ exit:
     return error;
 }
 
-void Commissioner::ComputeBloomFilter(SteeringData &aSteeringData) const
+void Commissioner::RebuildSteeringData(void)
 {
-    Mac::ExtAddress joinerId;
+    // Rebuild the steering data bloom filter from the hash bit indexes
+    // precomputed when each joiner entry was added, skipping the
+    // per-joiner hash calculations.
 
-    aSteeringData.Init();
+    mSteeringData.Init();
 
     for (const Joiner &joiner : mJoiners)
     {
@@ -381,16 +400,12 @@ void Commissioner::ComputeBloomFilter(SteeringData &aSteeringData) const
             break;
 
         case Joiner::kTypeEui64:
-            ComputeJoinerId(joiner.mSharedId.mEui64, joinerId);
-            aSteeringData.UpdateBloomFilter(joinerId);
-            break;
-
         case Joiner::kTypeDiscerner:
-            aSteeringData.UpdateBloomFilter(joiner.mSharedId.mDiscerner);
+            mSteeringData.UpdateBloomFilter(joiner.mHashIndexes);
             break;
 
         case Joiner::kTypeAny:
-            aSteeringData.SetToPermitAllJoiners();
+            mSteeringData.SetToPermitAllJoiners();
             ExitNow();
         }
     }
@@ -411,8 +426,8 @@ void Commissioner::SendCommissionerSet(void)
     dataset.mSessionId      = mSessionId;
     dataset.mIsSessionIdSet = true;
 
-    ComputeBloomFilter(static_cast<SteeringData &>(dataset.mSteeringData));
-    dataset.mIsSteeringDataSet = true;
+    static_cast<SteeringData &>(dataset.mSteeringData) = mSteeringData;
+    dataset.mIsSteeringDataSet                         = true;
 
     error = SendMgmtCommissionerSetRequest(dataset, nullptr, 0);
 
@@ -427,6 +442,7 @@ void Commissioner::ClearJoiners(void)
         joiner.mType = Joiner::kTypeUnused;
     }
 
+    mSteeringData.Init();
     SendCommissionerSet();
 }
 
@@ -463,11 +479,16 @@ Error Commissioner::AddJoiner(const Mac::ExtAddress *aEui64,
     {
         joiner->mType                = Joiner::kTypeDiscerner;
         joiner->mSharedId.mDiscerner = *aDiscerner;
+        SteeringData::CalculateHashBitIndexes(*aDiscerner, joiner->mHashIndexes);
     }
     else if (aEui64 != nullptr)
     {
+        Mac::ExtAddress joinerId;
+
         joiner->mType            = Joiner::kTypeEui64;
         joiner->mSharedId.mEui64 = *aEui64;
+        ComputeJoinerId(*aEui64, joinerId);
+        SteeringData::CalculateHashBitIndexes(joinerId, joiner->mHashIndexes);
     }
     else
     {
@@ -476,6 +497,18 @@ Error Commissioner::AddJoiner(const Mac::ExtAddress *aEui64,
 
     joiner->mExpirationTime = TimerMilli::GetNow() + Time::SecToMsec(aTimeout);
 
+    // Update the steering data incrementally (a full rebuild is only
+    // needed when a joiner entry is removed).
+
+    if (joiner->mType == Joiner::kTypeAny)
+    {
+        mSteeringData.SetToPermitAllJoiners();
+    }
+    else if (!mSteeringData.PermitsAllJoiners())
+    {
+        mSteeringData.UpdateBloomFilter(joiner->mHashIndexes);
+    }
+
     UpdateJoinerExpirationTimer();
 
     SendCommissionerSet();
@@ -1025,7 +1058,15 @@ void Commissioner::HandleRelayReceive(Coap::Message &aMessage, const Ip6::Messag
     }
     else
     {
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+        if (mJoinerIid != joinerIid)
+        {
+            QueuePendingRelay(aMessage, joinerIid);
+            ExitNow();
+        }
+#else
         VerifyOrExit(mJoinerIid == joinerIid);
+#endif
     }
 
     mJoinerPort = joinerPort;
@@ -1046,6 +1087,78 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+void Commissioner::QueuePendingRelay(Coap::Message &aMessage, const Ip6::InterfaceIdentifier &aJoinerIid)
+{
+    Mac::ExtAddress receivedId;
+    Coap::Message * clone;
+    uint16_t        numQueued = 0;
+
+    aJoinerIid.ConvertToExtAddress(receivedId);
+    VerifyOrExit(FindBestMatchingJoinerEntry(receivedId) != nullptr);
+    VerifyOrExit(!IsRelayQueuedForJoiner(aJoinerIid));
+
+    for (const Message *message = mPendingRelayQueue.GetHead(); message != nullptr; message = message->GetNext())
+    {
+        numQueued++;
+    }
+
+    VerifyOrExit(numQueued < kJoinerSessionQueueSize);
+
+    clone = aMessage.Clone();
+    VerifyOrExit(clone != nullptr);
+
+    mPendingRelayQueue.Enqueue(*clone);
+
+    otLogInfoMeshCoP("Queued Relay Receive for pending joiner (%s)", aJoinerIid.ToString().AsCString());
+
+exit:
+    return;
+}
+
+bool Commissioner::IsRelayQueuedForJoiner(const Ip6::InterfaceIdentifier &aJoinerIid) const
+{
+    bool rval = false;
+
+    for (const Message *message = mPendingRelayQueue.GetHead(); message != nullptr; message = message->GetNext())
+    {
+        Ip6::InterfaceIdentifier joinerIid;
+
+        if ((Tlv::Find<JoinerIidTlv>(*message, joinerIid) == kErrorNone) && (joinerIid == aJoinerIid))
+        {
+            rval = true;
+            break;
+        }
+    }
+
+    return rval;
+}
+
+void Commissioner::HandlePendingRelayTask(Tasklet &aTasklet)
+{
+    aTasklet.Get<Commissioner>().ProcessPendingRelay();
+}
+
+void Commissioner::ProcessPendingRelay(void)
+{
+    Message *        message;
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrExit(mState == kStateActive, mPendingRelayQueue.DequeueAndFreeAll());
+    VerifyOrExit(!Get<Coap::CoapSecure>().IsConnectionActive());
+
+    message = mPendingRelayQueue.GetHead();
+    VerifyOrExit(message != nullptr);
+
+    mPendingRelayQueue.Dequeue(*message);
+    HandleRelayReceive(static_cast<Coap::Message &>(*message), messageInfo);
+    message->Free();
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+
 void Commissioner::HandleDatasetChanged(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
     static_cast<Commissioner *>(aContext)->HandleDatasetChanged(*static_cast<Coap::Message *>(aMessage),
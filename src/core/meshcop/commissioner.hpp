@@ -44,6 +44,7 @@
 #include "coap/coap_secure.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "mac/mac_types.hpp"
 #include "meshcop/announce_begin_client.hpp"
@@ -332,6 +333,10 @@ private:
     static constexpr uint32_t kKeepAliveTimeout     = 50; // TIMEOUT_COMM_PET (seconds)
     static constexpr uint32_t kRemoveJoinerDelay    = 20; // Delay to remove successfully joined joiner
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+    static constexpr uint16_t kJoinerSessionQueueSize = OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_QUEUE_SIZE;
+#endif
+
     enum JoinerEvent : uint8_t
     {
         kJoinerEventStart     = OT_COMMISSIONER_JOINER_START,
@@ -362,6 +367,11 @@ private:
         JoinerPskd mPskd;
         Type       mType;
 
+        // Steering data bloom filter hash bit indexes for the Joiner
+        // ID, precomputed when the entry is added (valid for types
+        // `kTypeEui64` and `kTypeDiscerner` only).
+        SteeringData::HashBitIndexes mHashIndexes;
+
         void CopyToJoinerInfo(otJoinerInfo &aJoiner) const;
     };
 
@@ -420,6 +430,13 @@ private:
     static void HandleRelayReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleRelayReceive(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+    static void HandlePendingRelayTask(Tasklet &aTasklet);
+    void        ProcessPendingRelay(void);
+    void        QueuePendingRelay(Coap::Message &aMessage, const Ip6::InterfaceIdentifier &aJoinerIid);
+    bool        IsRelayQueuedForJoiner(const Ip6::InterfaceIdentifier &aJoinerIid) const;
+#endif
+
     static void HandleDatasetChanged(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleDatasetChanged(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
@@ -431,7 +448,7 @@ private:
     static Error SendRelayTransmit(void *aContext, Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     Error        SendRelayTransmit(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
-    void  ComputeBloomFilter(SteeringData &aSteeringData) const;
+    void  RebuildSteeringData(void);
     void  SendCommissionerSet(void);
     Error SendPetition(void);
     void  SendKeepAlive(void);
@@ -445,6 +462,11 @@ private:
 
     Joiner mJoiners[OPENTHREAD_CONFIG_COMMISSIONER_MAX_JOINER_ENTRIES];
 
+    // Steering data bloom filter maintained incrementally as joiners
+    // are added/removed (from the precomputed per-joiner hash bit
+    // indexes), so it does not need to be recomputed per use.
+    SteeringData mSteeringData;
+
     Joiner *                 mActiveJoiner;
     Ip6::InterfaceIdentifier mJoinerIid;
     uint16_t                 mJoinerPort;
@@ -454,6 +476,11 @@ private:
     TimerMilli               mJoinerExpirationTimer;
     TimerMilli               mTimer;
 
+#if OPENTHREAD_CONFIG_COMMISSIONER_JOINER_SESSION_PIPELINE_ENABLE
+    MessageQueue mPendingRelayQueue;
+    Tasklet      mPendingRelayTask;
+#endif
+
     Coap::Resource mRelayReceive;
     Coap::Resource mDatasetChanged;
     Coap::Resource mJoinerFinalize;
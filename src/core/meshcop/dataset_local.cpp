@@ -189,6 +189,17 @@ Error DatasetLocal::Save(const Dataset &aDataset)
     }
     else
     {
+#if OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE
+        if (!IsSaveNeeded(aDataset))
+        {
+            // The stored dataset already matches (for a pending dataset
+            // modulo the delay timer, which `Read()` re-derives from
+            // `mUpdateTime`), so the flash write is skipped along with
+            // the `mUpdateTime` update.
+            otLogInfoMeshCoP("%s dataset unchanged, save skipped", Dataset::TypeToString(mType));
+            ExitNow();
+        }
+#endif
         SuccessOrExit(error = Get<Settings>().SaveOperationalDataset(IsActive(), aDataset));
         mSaved = true;
         otLogInfoMeshCoP("%s dataset set", Dataset::TypeToString(mType));
@@ -212,6 +223,58 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE
+bool DatasetLocal::IsSaveNeeded(const Dataset &aDataset) const
+{
+    bool    needed = true;
+    Dataset stored;
+
+    VerifyOrExit(mSaved);
+    SuccessOrExit(Get<Settings>().ReadOperationalDataset(IsActive(), stored));
+
+    if (IsActive())
+    {
+        needed = (stored.GetSize() != aDataset.GetSize()) ||
+                 (memcmp(stored.GetBytes(), aDataset.GetBytes(), stored.GetSize()) != 0);
+    }
+    else
+    {
+        const DelayTimerTlv *storedDelay = stored.GetTlv<DelayTimerTlv>();
+        const DelayTimerTlv *newDelay    = aDataset.GetTlv<DelayTimerTlv>();
+        Dataset              newCopy;
+        uint32_t             remaining = 0;
+        uint32_t             elapsed;
+
+        // Each pending propagation cycle delivers the same dataset with
+        // only the delay timer counted down. Compare the datasets with
+        // the delay timer removed, and verify the received delay matches
+        // the remaining time derived from the stored value.
+
+        VerifyOrExit((storedDelay != nullptr) && (newDelay != nullptr));
+
+        elapsed = TimerMilli::GetNow() - mUpdateTime;
+
+        if (storedDelay->GetDelayTimer() > elapsed)
+        {
+            remaining = storedDelay->GetDelayTimer() - elapsed;
+        }
+
+        VerifyOrExit(newDelay->GetDelayTimer() <= remaining + kDelayTimerMatchGuard);
+        VerifyOrExit(remaining <= newDelay->GetDelayTimer() + kDelayTimerMatchGuard);
+
+        newCopy.Set(Dataset::kPending, aDataset);
+        newCopy.RemoveTlv(Tlv::kDelayTimer);
+        stored.RemoveTlv(Tlv::kDelayTimer);
+
+        needed = (stored.GetSize() != newCopy.GetSize()) ||
+                 (memcmp(stored.GetBytes(), newCopy.GetBytes(), stored.GetSize()) != 0);
+    }
+
+exit:
+    return needed;
+}
+#endif // OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE
+
 int DatasetLocal::Compare(const Timestamp *aCompare)
 {
     return (aCompare == nullptr) ? (!mTimestampPresent ? 0 : -1)
@@ -188,8 +188,15 @@ public:
     int Compare(const Timestamp *aCompare);
 
 private:
+#if OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE
+    static constexpr uint32_t kDelayTimerMatchGuard = 1000; // Max delay timer mismatch to still skip save (msec).
+#endif
+
     bool IsActive(void) const { return (mType == Dataset::kActive); }
     void SetTimestamp(const Dataset &aDataset);
+#if OPENTHREAD_CONFIG_DATASET_SAVE_DIFF_ENABLE
+    bool IsSaveNeeded(const Dataset &aDataset) const;
+#endif
 
     Timestamp     mTimestamp;            ///< Active or Pending Timestamp
     TimeMilli     mUpdateTime;           ///< Local time last updated
@@ -54,12 +54,30 @@ DatasetManager::DatasetManager(Instance &aInstance, Dataset::Type aType, Timer::
     : InstanceLocator(aInstance)
     , mLocal(aInstance, aType)
     , mTimestampValid(false)
+    , mCachedInfoValid(false)
     , mMgmtPending(false)
     , mTimer(aInstance, aTimerHandler)
     , mMgmtSetCallback(nullptr)
     , mMgmtSetCallbackContext(nullptr)
 {
     mTimestamp.Init();
+    mCachedInfo.Clear();
+}
+
+Error DatasetManager::Read(Dataset::Info &aDatasetInfo) const
+{
+    Error error = kErrorNone;
+
+    if (!mCachedInfoValid)
+    {
+        SuccessOrExit(error = mLocal.Read(mCachedInfo));
+        mCachedInfoValid = true;
+    }
+
+    aDatasetInfo = mCachedInfo;
+
+exit:
+    return error;
 }
 
 const Timestamp *DatasetManager::GetTimestamp(void) const
@@ -128,6 +146,7 @@ void DatasetManager::Clear(void)
     mTimestamp.Init();
     mTimestampValid = false;
     mLocal.Clear();
+    mCachedInfoValid = false;
     mTimer.Stop();
     SignalDatasetChange();
 }
@@ -162,6 +181,7 @@ Error DatasetManager::Save(const Dataset &aDataset)
     if (isNetworkkeyUpdated || compare > 0)
     {
         IgnoreError(mLocal.Save(aDataset));
+        mCachedInfoValid = false;
 
 #if OPENTHREAD_FTD
         Get<NetworkData::Leader>().IncrementVersionAndStableVersion();
@@ -183,6 +203,7 @@ Error DatasetManager::Save(const Dataset::Info &aDatasetInfo)
     Error error;
 
     SuccessOrExit(error = mLocal.Save(aDatasetInfo));
+    mCachedInfoValid = false;
     HandleDatasetUpdated();
 
 exit:
@@ -194,6 +215,7 @@ Error DatasetManager::Save(const otOperationalDatasetTlvs &aDataset)
     Error error;
 
     SuccessOrExit(error = mLocal.Save(aDataset));
+    mCachedInfoValid = false;
     HandleDatasetUpdated();
 
 exit:
@@ -205,6 +227,7 @@ Error DatasetManager::SaveLocal(const Dataset &aDataset)
     Error error;
 
     SuccessOrExit(error = mLocal.Save(aDataset));
+    mCachedInfoValid = false;
     HandleDatasetUpdated();
 
 exit:
@@ -386,15 +409,31 @@ exit:
 }
 
 void DatasetManager::HandleGet(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
+{
+    Error          error   = kErrorNone;
+    Coap::Message *message = ProcessGetRequest(aMessage);
+
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*message, aMessageInfo));
+
+    otLogInfoMeshCoP("sent %s dataset get response to %s", (GetType() == Dataset::kActive ? "active" : "pending"),
+                     aMessageInfo.GetPeerAddr().ToString().AsCString());
+
+exit:
+    FreeMessageOnError(message, error);
+}
+
+Coap::Message *DatasetManager::ProcessGetRequest(const Coap::Message &aRequest) const
 {
     Tlv      tlv;
-    uint16_t offset = aMessage.GetOffset();
+    uint16_t offset = aRequest.GetOffset();
     uint8_t  tlvs[Dataset::kMaxGetTypes];
     uint8_t  length = 0;
 
-    while (offset < aMessage.GetLength())
+    while (offset < aRequest.GetLength())
     {
-        IgnoreError(aMessage.Read(offset, tlv));
+        IgnoreError(aRequest.Read(offset, tlv));
 
         if (tlv.GetType() == Tlv::kGet)
         {
@@ -406,7 +445,7 @@ void DatasetManager::HandleGet(const Coap::Message &aMessage, const Ip6::Message
                 length = sizeof(tlvs) - 1;
             }
 
-            aMessage.ReadBytes(offset + sizeof(Tlv), tlvs, length);
+            aRequest.ReadBytes(offset + sizeof(Tlv), tlvs, length);
             break;
         }
 
@@ -427,16 +466,15 @@ void DatasetManager::HandleGet(const Coap::Message &aMessage, const Ip6::Message
     tlvs[length++] = Tlv::kDelayTimer;
 
 exit:
-    SendGetResponse(aMessage, aMessageInfo, tlvs, length);
+    return PrepareGetResponse(aRequest, tlvs, length);
 }
 
-void DatasetManager::SendGetResponse(const Coap::Message &   aRequest,
-                                     const Ip6::MessageInfo &aMessageInfo,
-                                     uint8_t *               aTlvs,
-                                     uint8_t                 aLength) const
+Coap::Message *DatasetManager::PrepareGetResponse(const Coap::Message &aRequest,
+                                                  const uint8_t *      aTlvs,
+                                                  uint8_t              aLength) const
 {
-    Error          error = kErrorNone;
-    Coap::Message *message;
+    Error          error   = kErrorNone;
+    Coap::Message *message = nullptr;
     Dataset        dataset;
 
     IgnoreError(Read(dataset));
@@ -474,13 +512,9 @@ void DatasetManager::SendGetResponse(const Coap::Message &   aRequest,
         }
     }
 
-    SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*message, aMessageInfo));
-
-    otLogInfoMeshCoP("sent %s dataset get response to %s", (GetType() == Dataset::kActive ? "active" : "pending"),
-                     aMessageInfo.GetPeerAddr().ToString().AsCString());
-
 exit:
-    FreeMessageOnError(message, error);
+    FreeAndNullMessageOnError(message, error);
+    return message;
 }
 
 Error DatasetManager::AppendDatasetToMessage(const Dataset::Info &aDatasetInfo, Message &aMessage) const
@@ -868,10 +902,21 @@ void PendingDataset::HandleDelayTimer(void)
 
     dataset.ConvertToActive();
 
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    // Group the active dataset save and the pending dataset delete
+    // into a single settings commit, so the swap is applied to the
+    // non-volatile store atomically.
+    Get<Settings>().BeginChange();
+#endif
+
     Get<ActiveDataset>().Save(dataset);
 
     Clear();
 
+#if OPENTHREAD_CONFIG_SETTINGS_GROUP_COMMIT_ENABLE
+    IgnoreError(Get<Settings>().CommitChange());
+#endif
+
 exit:
     return;
 }
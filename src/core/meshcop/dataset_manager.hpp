@@ -96,13 +96,17 @@ public:
     /**
      * This method retrieves the dataset from non-volatile memory.
      *
+     * The decoded dataset is cached in memory on first use, so repeated calls (e.g., from beacon or announce
+     * processing) do not re-parse the stored TLVs. The cache is invalidated whenever the dataset is saved or
+     * cleared.
+     *
      * @param[out]  aDatasetInfo  Where to place the dataset (as `Dataset::Info`).
      *
      * @retval kErrorNone      Successfully retrieved the dataset.
      * @retval kErrorNotFound  There is no corresponding dataset stored in non-volatile memory.
      *
      */
-    Error Read(Dataset::Info &aDatasetInfo) const { return mLocal.Read(aDatasetInfo); }
+    Error Read(Dataset::Info &aDatasetInfo) const;
 
     /**
      * This method retrieves the dataset from non-volatile memory.
@@ -192,6 +196,19 @@ public:
     Error AppendMleDatasetTlv(Message &aMessage) const;
 #endif
 
+    /**
+     * This method processes a MGMT_GET request message and prepares the response.
+     *
+     * The prepared response is not sent; ownership is passed to the caller (e.g., to send it over the mesh or over a
+     * secure commissioner session).
+     *
+     * @param[in]  aRequest  The MGMT_GET request message.
+     *
+     * @returns The prepared response message, or `nullptr` if it could not be prepared.
+     *
+     */
+    Coap::Message *ProcessGetRequest(const Coap::Message &aRequest) const;
+
 protected:
     /**
      * This class defines a generic Dataset TLV to read from a message.
@@ -336,9 +353,11 @@ protected:
     Error HandleSet(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 #endif
 
-    DatasetLocal mLocal;
-    Timestamp    mTimestamp;
-    bool         mTimestampValid : 1;
+    DatasetLocal          mLocal;
+    Timestamp             mTimestamp;
+    bool                  mTimestampValid : 1;
+    mutable bool          mCachedInfoValid : 1;
+    mutable Dataset::Info mCachedInfo;
 
 private:
     static void HandleMgmtSetResponse(void *               aContext,
@@ -353,10 +372,7 @@ private:
     void  HandleDatasetUpdated(void);
     Error AppendDatasetToMessage(const Dataset::Info &aDatasetInfo, Message &aMessage) const;
     void  SendSet(void);
-    void  SendGetResponse(const Coap::Message &   aRequest,
-                          const Ip6::MessageInfo &aMessageInfo,
-                          uint8_t *               aTlvs,
-                          uint8_t                 aLength) const;
+    Coap::Message *PrepareGetResponse(const Coap::Message &aRequest, const uint8_t *aTlvs, uint8_t aLength) const;
 
 #if OPENTHREAD_FTD
     void SendSetResponse(const Coap::Message &aRequest, const Ip6::MessageInfo &aMessageInfo, StateTlv::State aState);
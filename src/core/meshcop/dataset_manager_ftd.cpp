@@ -400,6 +400,7 @@ Error ActiveDataset::GenerateLocal(void)
     }
 
     SuccessOrExit(error = mLocal.Save(dataset));
+    mCachedInfoValid = false;
     IgnoreError(Restore());
 
     otLogInfoMeshCoP("Generated local dataset");
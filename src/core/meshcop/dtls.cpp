@@ -66,9 +66,15 @@ Dtls::Dtls(Instance &aInstance, bool aLayerTwoSecurity)
     , mPskLength(0)
     , mVerifyPeerCertificate(true)
     , mTimer(aInstance, Dtls::HandleTimer, this)
+#if OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+    , mProcessTask(aInstance, Dtls::HandleProcessTask, this)
+#endif
     , mTimerIntermediate(0)
     , mTimerSet(false)
     , mLayerTwoSecurity(aLayerTwoSecurity)
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+    , mCacheSession(false)
+#endif
     , mReceiveMessage(nullptr)
     , mConnectedHandler(nullptr)
     , mReceiveHandler(nullptr)
@@ -313,6 +319,10 @@ Error Dtls::Setup(bool aClient)
     mbedtls_ssl_set_bio(&mSsl, this, &Dtls::HandleMbedtlsTransmit, HandleMbedtlsReceive, nullptr);
     mbedtls_ssl_set_timer_cb(&mSsl, this, &Dtls::HandleMbedtlsSetTimer, HandleMbedtlsGetTimer);
 
+    // Cap handshake datagrams at the minimal IPv6 MTU so that mbedTLS coalesces flight records into as few
+    // datagrams as the MTU allows and fragments handshake messages which cannot fit into a single one.
+    mbedtls_ssl_set_mtu(&mSsl, kDatagramMaxLength);
+
     if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
     {
         rval = mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPsk, mPskLength);
@@ -325,6 +335,17 @@ Error Dtls::Setup(bool aClient)
 #endif
     VerifyOrExit(rval == 0);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+    // Session caching applies to the joiner side only, i.e., a client
+    // handshake using the EC-JPAKE cipher suite.
+    mCacheSession = aClient && (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8);
+
+    if (mCacheSession)
+    {
+        RestoreSession();
+    }
+#endif
+
     mReceiveMessage = nullptr;
     mMessageSubType = Message::kSubTypeNone;
     mState          = kStateConnecting;
@@ -354,6 +375,52 @@ exit:
     return Crypto::MbedTls::MapError(rval);
 }
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+void Dtls::RestoreSession(void)
+{
+    uint8_t             buffer[kSessionCacheMaxLength];
+    uint16_t            length = sizeof(buffer);
+    mbedtls_ssl_session session;
+
+    SuccessOrExit(Get<Settings>().ReadDtlsSession(buffer, length));
+
+    mbedtls_ssl_session_init(&session);
+
+    if ((mbedtls_ssl_session_load(&session, buffer, length) != 0) || (mbedtls_ssl_set_session(&mSsl, &session) != 0))
+    {
+        // A stale or corrupted cached session is dropped so that later
+        // attempts start directly with a full handshake.
+        IgnoreError(Get<Settings>().DeleteDtlsSession());
+    }
+    else
+    {
+        otLogInfoMeshCoP("DTLS session resumption offered");
+    }
+
+    mbedtls_ssl_session_free(&session);
+
+exit:
+    return;
+}
+
+void Dtls::SaveSession(void)
+{
+    uint8_t             buffer[kSessionCacheMaxLength];
+    size_t              length = 0;
+    mbedtls_ssl_session session;
+
+    mbedtls_ssl_session_init(&session);
+
+    SuccessOrExit(mbedtls_ssl_get_session(&mSsl, &session));
+    SuccessOrExit(mbedtls_ssl_session_save(&session, buffer, sizeof(buffer), &length));
+
+    IgnoreError(Get<Settings>().SaveDtlsSession(buffer, static_cast<uint16_t>(length)));
+
+exit:
+    mbedtls_ssl_session_free(&session);
+}
+#endif // OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 int Dtls::SetApplicationCoapSecureKeys(void)
 {
@@ -783,6 +850,21 @@ void Dtls::HandleTimer(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+void Dtls::HandleProcessTask(Tasklet &aTasklet)
+{
+    static_cast<Dtls *>(static_cast<TaskletContext &>(aTasklet).GetContext())->HandleProcessTask();
+}
+
+void Dtls::HandleProcessTask(void)
+{
+    if ((mState == kStateConnecting) || (mState == kStateConnected))
+    {
+        Process();
+    }
+}
+#endif
+
 void Dtls::Process(void)
 {
     uint8_t buf[OPENTHREAD_CONFIG_DTLS_MAX_CONTENT_LEN];
@@ -799,6 +881,13 @@ void Dtls::Process(void)
             {
                 mState = kStateConnected;
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+                if (mCacheSession)
+                {
+                    SaveSession();
+                }
+#endif
+
                 if (mConnectedHandler != nullptr)
                 {
                     mConnectedHandler(mContext, true);
@@ -821,6 +910,16 @@ void Dtls::Process(void)
         {
             break;
         }
+#if OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+        else if (rval == MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS)
+        {
+            // Restartable ECC paused the handshake crypto after reaching
+            // the per-slice operation budget. Resume from a tasklet so
+            // other pending work gets a chance to run in between.
+            mProcessTask.Post();
+            break;
+        }
+#endif
         else
         {
             switch (rval)
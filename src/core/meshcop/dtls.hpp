@@ -54,6 +54,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/random.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/sha256.hpp"
 #include "meshcop/meshcop_tlvs.hpp"
@@ -354,6 +355,13 @@ private:
 
     static constexpr uint32_t kGuardTimeNewConnectionMilli = 2000;
 
+    // Maximum DTLS datagram payload: the minimal IPv6 MTU minus the IPv6 and UDP header overhead.
+    static constexpr uint16_t kDatagramMaxLength = 1280 - sizeof(Ip6::Header) - sizeof(Ip6::Udp::Header);
+
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+    static constexpr uint16_t kSessionCacheMaxLength = OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_MAX_LENGTH;
+#endif
+
 #if !OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
     static constexpr uint16_t kApplicationDataMaxLength = 1152;
 #else
@@ -363,6 +371,11 @@ private:
     void  FreeMbedtls(void);
     Error Setup(bool aClient);
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+    void RestoreSession(void);
+    void SaveSession(void);
+#endif
+
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
     /**
      * Set keys and/or certificates for dtls session dependent of used cipher suite.
@@ -403,6 +416,11 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
+#if OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+    static void HandleProcessTask(Tasklet &aTasklet);
+    void        HandleProcessTask(void);
+#endif
+
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
     void  HandleDtlsReceive(const uint8_t *aBuf, uint16_t aLength);
@@ -452,11 +470,19 @@ private:
 
     TimerMilliContext mTimer;
 
+#if OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+    TaskletContext mProcessTask;
+#endif
+
     TimeMilli mTimerIntermediate;
     bool      mTimerSet : 1;
 
     bool mLayerTwoSecurity : 1;
 
+#if OPENTHREAD_CONFIG_DTLS_SESSION_RESUMPTION_ENABLE
+    bool mCacheSession : 1;
+#endif
+
     Message *mReceiveMessage;
 
     ConnectedHandler mConnectedHandler;
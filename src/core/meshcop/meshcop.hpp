@@ -320,6 +320,17 @@ public:
      */
     void UpdateBloomFilter(const JoinerDiscerner &aDiscerner);
 
+    /**
+     * This method updates the bloom filter adding a given set of hash bit indexes (derived from a Joiner ID).
+     *
+     * This can be used to add a Joiner ID whose hash bit indexes were previously calculated (e.g., using
+     * `CalculateHashBitIndexes()`), skipping the hash calculations.
+     *
+     * @param[in]  aIndexes  A hash bit index structure (derived from a Joiner ID).
+     *
+     */
+    void UpdateBloomFilter(const HashBitIndexes &aIndexes);
+
     /**
      * This method indicates whether the bloom filter is empty (all the bits are cleared).
      *
@@ -401,7 +412,6 @@ private:
     void ClearBit(uint8_t aBit) { m8[BitIndex(aBit)] &= ~BitFlag(aBit); }
 
     bool DoesAllMatch(uint8_t aMatch) const;
-    void UpdateBloomFilter(const HashBitIndexes &aIndexes);
 };
 
 /**
@@ -69,9 +69,40 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    uint32_t sum;
+
+    // If at odd index, add the first byte separately to get the
+    // checksum back to 16-bit word alignment.
+
+    if (mAtOddIndex && (aLength > 0))
     {
-        AddUint8(aBuffer[i]);
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    // One's complement sum over 16-bit big-endian words, accumulated in
+    // a 32-bit `sum` with all carries folded back at the end. The
+    // largest possible message length keeps `sum` from overflowing.
+
+    sum = mValue;
+
+    while (aLength >= 2)
+    {
+        sum += (static_cast<uint32_t>(aBuffer[0]) << 8) | aBuffer[1];
+        aBuffer += 2;
+        aLength -= 2;
+    }
+
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    mValue = static_cast<uint16_t>(sum);
+
+    if (aLength > 0)
+    {
+        AddUint8(*aBuffer);
     }
 }
 
@@ -113,15 +144,34 @@ void Checksum::Calculate(const Ip6::Address &aSource,
         AddData(chunk.GetData(), chunk.GetLength());
         aMessage.GetNextChunk(length, chunk);
     }
+
+#if OPENTHREAD_CONFIG_MESSAGE_EXTERNAL_DATA_ENABLE
+    // The external data tail (if any) is not covered by the message
+    // chunks and always follows the buffered content.
+
+    if (aMessage.GetExternalLength() > 0)
+    {
+        AddData(aMessage.GetExternalData(), aMessage.GetExternalLength());
+    }
+#endif
 }
 
 Error Checksum::VerifyMessageChecksum(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo, uint8_t aIpProto)
 {
+    Error    error = kErrorNone;
     Checksum checksum;
 
+    // Skip the calculation when the checksum is already verified (e.g.,
+    // by the host network stack for a message injected over a platform
+    // network interface).
+
+    VerifyOrExit(!aMessage.IsChecksumVerified());
+
     checksum.Calculate(aMessageInfo.GetPeerAddr(), aMessageInfo.GetSockAddr(), aIpProto, aMessage);
+    error = (checksum.GetValue() == kValidRxChecksum) ? kErrorNone : kErrorDrop;
 
-    return (checksum.GetValue() == kValidRxChecksum) ? kErrorNone : kErrorDrop;
+exit:
+    return error;
 }
 
 void Checksum::UpdateMessageChecksum(Message &           aMessage,
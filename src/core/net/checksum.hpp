@@ -48,6 +48,12 @@ namespace ot {
 /**
  * This class implements IP checksum calculation and verification.
  *
+ * Checksums are computed or verified only at the endpoints: on delivery to a local UDP/ICMPv6/TCP endpoint and when
+ * preparing a locally originated datagram. Transit traffic routed by `MeshForwarder` is checksum-neutral, since the
+ * transport checksum field is carried verbatim through 6LoWPAN compression round trips and none of the headers
+ * mutated in forwarding (e.g., hop limit) are covered by the transport pseudo-header, so no per-hop recomputation is
+ * needed or performed.
+ *
  */
 class Checksum
 {
@@ -573,6 +573,13 @@ Client::Client(Instance &aInstance)
     static_assert(kBrowseQuery == 1, "kBrowseQuery value is not correct");
     static_assert(kServiceQuery == 2, "kServiceQuery value is not correct");
 #endif
+
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        entry.MarkAsEmpty();
+    }
+#endif
 }
 
 Error Client::Start(void)
@@ -717,6 +724,23 @@ Error Client::StartQuery(QueryInfo &        aInfo,
     SuccessOrExit(error = AllocateQuery(aInfo, aLabel, aName, query));
     mQueries.Enqueue(*query);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+    if ((aInfo.mQueryType == kIp6AddressQuery) && (aLabel == nullptr))
+    {
+        const CacheEntry *entry = FindCacheEntry(aName);
+
+        // If the response can be served from the cache, the query is
+        // finalized (and freed) by `ReplyFromCache()`. On failure
+        // (e.g., no buffer for the response message) we fall back to
+        // sending the query to the server.
+
+        if ((entry != nullptr) && (ReplyFromCache(*query, *entry) == kErrorNone))
+        {
+            ExitNow();
+        }
+    }
+#endif
+
     SendQuery(*query, aInfo, /* aUpdateTimer */ true);
 
 exit:
@@ -942,6 +966,9 @@ void Client::ProcessResponse(const Message &aMessage)
     // finalizing the query and invoking the user's callback.
 
     SuccessOrExit(ParseResponse(response, type, responseError));
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+    UpdateResponseCache(response, type, responseError);
+#endif
     FinalizeQuery(response, type, responseError);
 
 exit:
@@ -1054,6 +1081,170 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+
+Client::CacheEntry *Client::FindCacheEntry(const char *aHostName)
+{
+    CacheEntry *match = nullptr;
+    TimeMilli   now   = TimerMilli::GetNow();
+
+    for (CacheEntry &entry : mCacheEntries)
+    {
+        if (entry.IsEmpty())
+        {
+            continue;
+        }
+
+        if (now >= entry.mExpireTime)
+        {
+            entry.MarkAsEmpty();
+            continue;
+        }
+
+        if (strcmp(entry.mHostName, aHostName) == 0)
+        {
+            match = &entry;
+            break;
+        }
+    }
+
+    return match;
+}
+
+Error Client::ReplyFromCache(Query &aQuery, const CacheEntry &aEntry)
+{
+    // This method prepares a synthesized response message from the
+    // cached entry `aEntry` and finalizes the query `aQuery` with it,
+    // invoking the user callback. On success, `aQuery` is freed.
+
+    Error    error   = kErrorNone;
+    Message *message = nullptr;
+    Header   header;
+    Response response;
+
+    header.SetType(Header::kTypeResponse);
+    header.SetQueryType(Header::kQueryTypeStandard);
+    header.SetQuestionCount(1);
+
+    if (aEntry.mError == kErrorNone)
+    {
+        header.SetAnswerCount(1);
+    }
+    else
+    {
+        header.SetResponseCode(Header::kResponseNameError);
+    }
+
+    message = mSocket.NewMessage(0);
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = message->Append(header));
+    SuccessOrExit(error = AppendNameFromQuery(aQuery, *message));
+    SuccessOrExit(error = message->Append(Question(ResourceRecord::kTypeAaaa)));
+
+    response.mAnswerOffset = message->GetLength();
+
+    if (aEntry.mError == kErrorNone)
+    {
+        AaaaRecord aaaaRecord;
+
+        aaaaRecord.Init();
+        aaaaRecord.SetTtl((aEntry.mExpireTime - TimerMilli::GetNow()) / 1000);
+        aaaaRecord.SetAddress(aEntry.mAddress);
+
+        SuccessOrExit(error = AppendNameFromQuery(aQuery, *message));
+        SuccessOrExit(error = message->Append(aaaaRecord));
+        response.mAnswerRecordCount = 1;
+    }
+
+    response.mInstance         = &Get<Instance>();
+    response.mQuery            = &aQuery;
+    response.mMessage          = message;
+    response.mAdditionalOffset = message->GetLength();
+
+    otLogInfoDns("Reply from cache, error:%s", ErrorToString(aEntry.mError));
+
+    FinalizeQuery(response, kIp6AddressQuery, aEntry.mError);
+
+exit:
+    FreeMessage(message);
+    return error;
+}
+
+void Client::UpdateResponseCache(const Response &aResponse, QueryType aType, Error aResponseError)
+{
+    char         hostName[Name::kMaxNameSize];
+    Ip6::Address address;
+    uint32_t     ttl;
+    CacheEntry * entry;
+    uint16_t     offset = kNameOffsetInQuery;
+
+    address.Clear();
+
+    VerifyOrExit(aType == kIp6AddressQuery);
+
+    if (aResponseError == kErrorNone)
+    {
+        Name queryName;
+
+        queryName.SetFromMessage(*aResponse.mQuery, kNameOffsetInQuery);
+
+        // Only the first address record is cached. A successful
+        // response with no address record in the answer section
+        // (e.g., one requiring NAT64 address synthesis) is not
+        // cached.
+
+        SuccessOrExit(aResponse.FindHostAddress(Response::kAnswerSection, queryName, /* aIndex */ 0, address, ttl));
+        VerifyOrExit(ttl > 0);
+        ttl = OT_MIN(ttl, kCacheMaxTtl);
+    }
+    else
+    {
+        // Only a name error response is cached as a negative entry.
+        // Since the SOA record from the authority section is not
+        // parsed, the negative TTL is a configured fixed value.
+
+        VerifyOrExit(aResponseError == kErrorNotFound);
+        ttl = kCacheNegativeTtl;
+    }
+
+    SuccessOrExit(Name::ReadName(*aResponse.mQuery, offset, hostName, sizeof(hostName)));
+
+    entry = FindCacheEntry(hostName);
+
+    if (entry == nullptr)
+    {
+        // Pick an empty entry if available, otherwise replace the
+        // entry expiring soonest.
+
+        entry = &mCacheEntries[0];
+
+        for (CacheEntry &candidate : mCacheEntries)
+        {
+            if (candidate.IsEmpty())
+            {
+                entry = &candidate;
+                break;
+            }
+
+            if (candidate.mExpireTime < entry->mExpireTime)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    memcpy(entry->mHostName, hostName, StringLength(hostName, sizeof(hostName)) + 1);
+    entry->mAddress    = address;
+    entry->mExpireTime = TimerMilli::GetNow() + Time::SecToMsec(ttl);
+    entry->mError      = aResponseError;
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+
 void Client::HandleTimer(Timer &aTimer)
 {
     aTimer.Get<Client>().HandleTimer();
@@ -698,6 +698,26 @@ private:
 
     static constexpr uint16_t kNameOffsetInQuery = sizeof(QueryInfo);
 
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+    static constexpr uint16_t kCacheNumEntries  = OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NUM_ENTRIES;
+    static constexpr uint32_t kCacheNegativeTtl = OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_NEGATIVE_TTL;
+
+    // Max TTL that can be cached, bounded to avoid `TimeMilli`
+    // roll-over (~24.8 days).
+    static constexpr uint32_t kCacheMaxTtl = (Timer::kMaxDelay / 1000) - 1;
+
+    struct CacheEntry
+    {
+        bool IsEmpty(void) const { return mHostName[0] == '\0'; }
+        void MarkAsEmpty(void) { mHostName[0] = '\0'; }
+
+        char         mHostName[Name::kMaxNameSize];
+        Ip6::Address mAddress;    // The resolved address (applicable when `mError` is `kErrorNone`).
+        TimeMilli    mExpireTime; // The time at which the entry expires.
+        Error        mError;      // `kErrorNone` (positive entry) or `kErrorNotFound` (negative entry).
+    };
+#endif
+
     Error       StartQuery(QueryInfo &        aInfo,
                            const QueryConfig *aConfig,
                            const char *       aLabel,
@@ -723,6 +743,11 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     void UpdateDefaultConfigAddress(void);
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+    CacheEntry *FindCacheEntry(const char *aHostName);
+    Error       ReplyFromCache(Query &aQuery, const CacheEntry &aEntry);
+    void        UpdateResponseCache(const Response &aResponse, QueryType aType, Error aResponseError);
+#endif
 
     static const uint8_t   kQuestionCount[];
     static const uint16_t *kQuestionRecordTypes[];
@@ -743,6 +768,9 @@ private:
 #if OPENTHREAD_CONFIG_DNS_CLIENT_DEFAULT_SERVER_ADDRESS_AUTO_SET_ENABLE
     bool mUserDidSetDefaultAddress;
 #endif
+#if OPENTHREAD_CONFIG_DNS_CLIENT_RESPONSE_CACHE_ENABLE
+    CacheEntry mCacheEntries[kCacheNumEntries];
+#endif
 };
 
 } // namespace Dns
@@ -482,6 +482,63 @@ Error Name::CompareName(const Message &aMessage, uint16_t &aOffset, const Name &
                                         : ParseName(aMessage, aOffset));
 }
 
+const uint8_t *Name::LabelIterator::GetCachedBytes(uint16_t aOffset, uint16_t aLength)
+{
+    // This method returns a pointer to `aLength` bytes of message data
+    // at `aOffset` from the cached chunk, re-populating the cache when
+    // the requested range is not covered. It returns `nullptr` if the
+    // range does not fit in a single contiguous chunk (e.g., it spans
+    // two message buffers), in which case the caller needs to read the
+    // bytes from the message directly. Caching the chunk avoids
+    // re-walking the message buffer chain on every label access (labels
+    // of a name are typically located close together).
+
+    const uint8_t *bytes = nullptr;
+
+    if ((mChunk.GetLength() == 0) || (aOffset < mChunkOffset) ||
+        (static_cast<uint32_t>(aOffset) + aLength > static_cast<uint32_t>(mChunkOffset) + mChunk.GetLength()))
+    {
+        uint16_t windowLength = kMaxEncodedLength;
+
+        mChunkOffset = aOffset;
+        mMessage.GetFirstChunk(aOffset, windowLength, mChunk);
+    }
+
+    if ((aOffset >= mChunkOffset) &&
+        (static_cast<uint32_t>(aOffset) + aLength <= static_cast<uint32_t>(mChunkOffset) + mChunk.GetLength()))
+    {
+        bytes = mChunk.GetData() + (aOffset - mChunkOffset);
+    }
+
+    return bytes;
+}
+
+Error Name::LabelIterator::ReadBytesAt(uint16_t aOffset, uint16_t aLength, void *aBuffer)
+{
+    Error          error = kErrorNone;
+    const uint8_t *bytes = GetCachedBytes(aOffset, aLength);
+
+    if (bytes != nullptr)
+    {
+        memcpy(aBuffer, bytes, aLength);
+    }
+    else
+    {
+        VerifyOrExit(mMessage.ReadBytes(aOffset, aBuffer, aLength) == aLength, error = kErrorParse);
+    }
+
+exit:
+    return error;
+}
+
+bool Name::LabelIterator::CompareBytesAt(uint16_t aOffset, const void *aBuffer, uint16_t aLength)
+{
+    const uint8_t *bytes = GetCachedBytes(aOffset, aLength);
+
+    return (bytes != nullptr) ? (memcmp(bytes, aBuffer, aLength) == 0)
+                              : mMessage.CompareBytes(aOffset, aBuffer, aLength);
+}
+
 Error Name::LabelIterator::GetNextLabel(void)
 {
     Error error;
@@ -491,7 +548,7 @@ Error Name::LabelIterator::GetNextLabel(void)
         uint8_t labelLength;
         uint8_t labelType;
 
-        SuccessOrExit(error = mMessage.Read(mNextLabelOffset, labelLength));
+        SuccessOrExit(error = ReadBytesAt(mNextLabelOffset, sizeof(uint8_t), &labelLength));
 
         labelType = labelLength & kLabelTypeMask;
 
@@ -522,7 +579,7 @@ Error Name::LabelIterator::GetNextLabel(void)
 
             uint16_t pointerValue;
 
-            SuccessOrExit(error = mMessage.Read(mNextLabelOffset, pointerValue));
+            SuccessOrExit(error = ReadBytesAt(mNextLabelOffset, sizeof(uint16_t), &pointerValue));
 
             if (!IsEndOffsetSet())
             {
@@ -545,13 +602,13 @@ exit:
     return error;
 }
 
-Error Name::LabelIterator::ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel) const
+Error Name::LabelIterator::ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel)
 {
     Error error;
 
     VerifyOrExit(mLabelLength < aLabelLength, error = kErrorNoBufs);
 
-    SuccessOrExit(error = mMessage.Read(mLabelStartOffset, aLabelBuffer, mLabelLength));
+    SuccessOrExit(error = ReadBytesAt(mLabelStartOffset, mLabelLength, aLabelBuffer));
     aLabelBuffer[mLabelLength] = kNullChar;
     aLabelLength               = mLabelLength;
 
@@ -564,7 +621,7 @@ exit:
     return error;
 }
 
-bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel) const
+bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel)
 {
     // This method compares the current label in the iterator with the
     // `aName` string. `aIsSingleLabel` indicates whether `aName` is a
@@ -577,7 +634,7 @@ bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel)
     bool matches = false;
 
     VerifyOrExit(StringLength(aName, mLabelLength) == mLabelLength);
-    matches = mMessage.CompareBytes(mLabelStartOffset, aName, mLabelLength);
+    matches = CompareBytesAt(mLabelStartOffset, aName, mLabelLength);
 
     VerifyOrExit(matches);
 
@@ -1008,21 +1008,29 @@ private:
             : mMessage(aMessage)
             , mNextLabelOffset(aLabelOffset)
             , mNameEndOffset(kUnsetNameEndOffset)
+            , mChunk()
+            , mChunkOffset(0)
         {
         }
 
         bool  IsEndOffsetSet(void) const { return (mNameEndOffset != kUnsetNameEndOffset); }
         Error GetNextLabel(void);
-        Error ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel) const;
-        bool  CompareLabel(const char *&aName, bool aIsSingleLabel) const;
+        Error ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel);
+        bool  CompareLabel(const char *&aName, bool aIsSingleLabel);
         bool  CompareLabel(const LabelIterator &aOtherIterator) const;
         Error AppendLabel(Message &aMessage) const;
 
+        const uint8_t *GetCachedBytes(uint16_t aOffset, uint16_t aLength);
+        Error          ReadBytesAt(uint16_t aOffset, uint16_t aLength, void *aBuffer);
+        bool           CompareBytesAt(uint16_t aOffset, const void *aBuffer, uint16_t aLength);
+
         const Message &mMessage;          // Message to read labels from.
         uint16_t       mLabelStartOffset; // Offset in `mMessage` to the first char of current label text.
         uint8_t        mLabelLength;      // Length of current label (number of chars).
         uint16_t       mNextLabelOffset;  // Offset in `mMessage` to the start of the next label.
         uint16_t       mNameEndOffset;    // Offset in `mMessage` to the byte after the end of domain name field.
+        Message::Chunk mChunk;            // Cached data chunk of `mMessage` (zero length when not yet populated).
+        uint16_t       mChunkOffset;      // Offset in `mMessage` corresponding to the start of `mChunk`.
     };
 
     Name(const char *aString, const Message *aMessage, uint16_t aOffset)
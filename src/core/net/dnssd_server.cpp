@@ -40,6 +40,9 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/logging.hpp"
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+#include "common/random.hpp"
+#endif
 #include "net/srp_server.hpp"
 #include "net/udp6.hpp"
 
@@ -55,11 +58,31 @@ const char Server::kDefaultDomainName[] = "default.service.arpa.";
 Server::Server(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mSocket(aInstance)
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    , mUpstreamSocket(aInstance)
+    , mUpstreamMessageId(Random::NonCrypto::GetUint16())
+#endif
     , mQueryCallbackContext(nullptr)
     , mQuerySubscribe(nullptr)
     , mQueryUnsubscribe(nullptr)
     , mTimer(aInstance, Server::HandleTimer)
 {
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+    InvalidateBrowseCache();
+#endif
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    mUpstreamResolver.Clear();
+
+    for (UpstreamTransaction &txn : mUpstreamTransactions)
+    {
+        txn.mValid = false;
+    }
+
+    for (NegativeCacheEntry &entry : mNegativeCache)
+    {
+        entry.mValid = false;
+    }
+#endif
 }
 
 Error Server::Start(void)
@@ -97,6 +120,18 @@ void Server::Stop(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    for (UpstreamTransaction &txn : mUpstreamTransactions)
+    {
+        if (txn.mValid)
+        {
+            FinalizeUpstreamTransaction(txn, Header::kResponseServerFailure);
+        }
+    }
+
+    IgnoreError(mUpstreamSocket.Close());
+#endif
+
     mTimer.Stop();
 
     IgnoreError(mSocket.Close());
@@ -142,6 +177,9 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     NameCompressInfo compressInfo(kDefaultDomainName);
     Header::Response response                = Header::kResponseSuccess;
     bool             resolveByQueryCallbacks = false;
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    bool forwardedToUpstream = false;
+#endif
 
     responseMessage = mSocket.NewMessage(0);
     VerifyOrExit(responseMessage != nullptr, error = kErrorNoBufs);
@@ -175,7 +213,36 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
         resolveByQueryCallbacks = true;
     }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    // Relay the query to the upstream resolver if neither the SRP
+    // records nor the query callbacks could answer it.
+    if (!resolveByQueryCallbacks && responseHeader.GetAnswerCount() == 0 && IsUpstreamForwardingEnabled())
+    {
+        char name[Name::kMaxNameSize];
+
+        VerifyOrExit(GetQueryTypeAndName(aRequestHeader, aRequestMessage, name) != kDnsQueryNone);
+
+        if (IsNameNegativelyCached(name))
+        {
+            response = Header::kResponseNameError;
+        }
+        else if (ForwardToUpstream(aRequestHeader, aRequestMessage, aMessageInfo, name) == kErrorNone)
+        {
+            forwardedToUpstream = true;
+        }
+    }
+#endif
+
 exit:
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    if (error == kErrorNone && forwardedToUpstream)
+    {
+        // The upstream answer is relayed back later; the locally built
+        // response message is no longer needed.
+        responseMessage->Free();
+    }
+    else
+#endif
     if (error == kErrorNone && !resolveByQueryCallbacks)
     {
         SendResponse(responseHeader, response, *responseMessage, aMessageInfo, mSocket);
@@ -644,6 +711,24 @@ Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
     Header::Response response   = Header::kResponseSuccess;
     char             name[Name::kMaxNameSize];
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+    // A single-question browse query may be answered by appending the
+    // prebuilt answer bytes cached from an earlier identical query.
+    if (aResponseHeader.GetQuestionCount() == 1)
+    {
+        IgnoreError(Name::ReadName(aResponseMessage, readOffset, name, sizeof(name)));
+        IgnoreError(aResponseMessage.Read(readOffset, question));
+
+        if ((question.GetType() == ResourceRecord::kTypePtr) &&
+            AnswerBrowseQuestionFromCache(name, aResponseHeader, aResponseMessage))
+        {
+            ExitNow(response = Header::kResponseSuccess);
+        }
+
+        readOffset = sizeof(Header);
+    }
+#endif
+
     for (uint16_t i = 0; i < aResponseHeader.GetQuestionCount(); i++)
     {
         IgnoreError(Name::ReadName(aResponseMessage, readOffset, name, sizeof(name)));
@@ -676,6 +761,18 @@ Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
                          aResponseHeader.GetMessageId(), name, question.GetClass(), question.GetType(), response);
         }
     }
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+    // At this point `readOffset` is the end of the question section,
+    // i.e. where the answer sections start, and `name` and `question`
+    // hold the only question of a single-question query.
+    if ((response == Header::kResponseSuccess) && (aResponseHeader.GetQuestionCount() == 1) &&
+        (question.GetType() == ResourceRecord::kTypePtr) && (aResponseHeader.GetAnswerCount() > 0))
+    {
+        CacheBrowseAnswer(name, aResponseHeader, aResponseMessage, readOffset);
+    }
+#endif
+
 exit:
     return response;
 }
@@ -789,6 +886,89 @@ const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &
 {
     return aHost.FindNextService(aService, Srp::Server::kFlagsAnyTypeActiveService);
 }
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+bool Server::AnswerBrowseQuestionFromCache(const char *aServiceName,
+                                           Header &    aResponseHeader,
+                                           Message &   aResponseMessage)
+{
+    bool answered = false;
+
+    for (BrowseCacheEntry &entry : mBrowseCache)
+    {
+        if (!entry.Matches(aServiceName))
+        {
+            continue;
+        }
+
+        // Refresh stale entries so that the TTLs in the cached records
+        // do not drift too far from the remaining SRP lease times.
+        if (TimerMilli::GetNow() - entry.mTimeCached >= kBrowseCacheMaxAge)
+        {
+            entry.mValid = false;
+            break;
+        }
+
+        VerifyOrExit(aResponseMessage.AppendBytes(entry.mAnswer, entry.mAnswerLength) == kErrorNone);
+        aResponseHeader.SetAnswerCount(entry.mAnswerCount);
+        aResponseHeader.SetAdditionalRecordCount(entry.mAdditionalCount);
+        answered = true;
+        break;
+    }
+
+exit:
+    return answered;
+}
+
+void Server::CacheBrowseAnswer(const char *   aServiceName,
+                               const Header & aResponseHeader,
+                               const Message &aResponseMessage,
+                               uint16_t       aAnswerOffset)
+{
+    BrowseCacheEntry *entry      = nullptr;
+    uint16_t          length     = aResponseMessage.GetLength() - aAnswerOffset;
+    uint16_t          nameLength = StringLength(aServiceName, Name::kMaxNameSize);
+
+    VerifyOrExit(length <= BrowseCacheEntry::kAnswerSize);
+    VerifyOrExit(nameLength < Name::kMaxNameSize);
+
+    // Prefer the entry already caching this service name, otherwise
+    // an invalid entry, otherwise evict the oldest entry.
+    for (BrowseCacheEntry &cacheEntry : mBrowseCache)
+    {
+        if (cacheEntry.Matches(aServiceName))
+        {
+            entry = &cacheEntry;
+            break;
+        }
+
+        if (entry == nullptr ||
+            (entry->mValid && (!cacheEntry.mValid || (cacheEntry.mTimeCached < entry->mTimeCached))))
+        {
+            entry = &cacheEntry;
+        }
+    }
+
+    SuccessOrExit(aResponseMessage.Read(aAnswerOffset, entry->mAnswer, length));
+    memcpy(entry->mServiceName, aServiceName, nameLength + 1);
+    entry->mAnswerLength    = length;
+    entry->mAnswerCount     = aResponseHeader.GetAnswerCount();
+    entry->mAdditionalCount = aResponseHeader.GetAdditionalRecordCount();
+    entry->mTimeCached      = TimerMilli::GetNow();
+    entry->mValid           = true;
+
+exit:
+    return;
+}
+
+void Server::InvalidateBrowseCache(void)
+{
+    for (BrowseCacheEntry &entry : mBrowseCache)
+    {
+        entry.mValid = false;
+    }
+}
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
 Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
@@ -810,6 +990,13 @@ Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
     query = NewQuery(aResponseHeader, aResponseMessage, aCompressInfo, aMessageInfo);
     VerifyOrExit(query != nullptr, error = kErrorNoBufs);
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+    // With query aggregation, a subscription is shared among all
+    // outstanding queries for the same name, so a new subscribe is
+    // issued only for the first one.
+    VerifyOrExit(!HasOtherQueryFor(*query, name));
+#endif
+
     mQuerySubscribe(mQueryCallbackContext, name);
 
 exit:
@@ -1037,11 +1224,20 @@ Server::DnsQueryType Server::GetQueryTypeAndName(const Header & aHeader,
                                                  const Message &aMessage,
                                                  char (&aName)[Name::kMaxNameSize])
 {
-    DnsQueryType sdType = kDnsQueryNone;
+    DnsQueryType sdType             = kDnsQueryNone;
+    uint16_t     hostQuestionOffset = 0;
+    bool         hasHostQuestion    = false;
+
+    // A single pass over the questions, parsing each question name only
+    // once. A service (PTR/SRV/TXT) question takes precedence over a
+    // host (AAAA/A) one, so the first host question is only remembered
+    // (by its offset) and its name re-read if no service question is
+    // found.
 
     for (uint16_t i = 0, readOffset = sizeof(Header); i < aHeader.GetQuestionCount(); i++)
     {
         Question question;
+        uint16_t nameOffset = readOffset;
 
         IgnoreError(Name::ReadName(aMessage, readOffset, aName, sizeof(aName)));
         IgnoreError(aMessage.Read(readOffset, question));
@@ -1054,23 +1250,21 @@ Server::DnsQueryType Server::GetQueryTypeAndName(const Header & aHeader,
         case ResourceRecord::kTypeSrv:
         case ResourceRecord::kTypeTxt:
             ExitNow(sdType = kDnsQueryResolve);
+        case ResourceRecord::kTypeAaaa:
+        case ResourceRecord::kTypeA:
+            if (!hasHostQuestion)
+            {
+                hasHostQuestion    = true;
+                hostQuestionOffset = nameOffset;
+            }
+            break;
         }
     }
 
-    for (uint16_t i = 0, readOffset = sizeof(Header); i < aHeader.GetQuestionCount(); i++)
+    if (hasHostQuestion)
     {
-        Question question;
-
-        IgnoreError(Name::ReadName(aMessage, readOffset, aName, sizeof(aName)));
-        IgnoreError(aMessage.Read(readOffset, question));
-        readOffset += sizeof(question);
-
-        switch (question.GetType())
-        {
-        case ResourceRecord::kTypeAaaa:
-        case ResourceRecord::kTypeA:
-            ExitNow(sdType = kDnsQueryResolveHost);
-        }
+        IgnoreError(Name::ReadName(aMessage, hostQuestionOffset, aName, sizeof(aName)));
+        sdType = kDnsQueryResolveHost;
     }
 
 exit:
@@ -1125,6 +1319,16 @@ void Server::HandleTimer(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    for (UpstreamTransaction &txn : mUpstreamTransactions)
+    {
+        if (txn.mValid && txn.mExpire <= now)
+        {
+            FinalizeUpstreamTransaction(txn, Header::kResponseServerFailure);
+        }
+    }
+#endif
+
     ResetTimer();
 }
 
@@ -1153,6 +1357,25 @@ void Server::ResetTimer(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    for (UpstreamTransaction &txn : mUpstreamTransactions)
+    {
+        if (!txn.mValid)
+        {
+            continue;
+        }
+
+        if (txn.mExpire <= now)
+        {
+            nextExpire = now;
+        }
+        else if (txn.mExpire < nextExpire)
+        {
+            nextExpire = txn.mExpire;
+        }
+    }
+#endif
+
     if (nextExpire < now.GetDistantFuture())
     {
         mTimer.FireAt(nextExpire);
@@ -1175,10 +1398,43 @@ void Server::FinalizeQuery(QueryTransaction &aQuery, Header::Response aResponseC
     OT_ASSERT(sdType != kDnsQueryNone);
     OT_UNUSED_VARIABLE(sdType);
 
-    mQueryUnsubscribe(mQueryCallbackContext, name);
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+    // The shared subscription is released only when the last
+    // outstanding query for the name finalizes.
+    if (!HasOtherQueryFor(aQuery, name))
+#endif
+    {
+        mQueryUnsubscribe(mQueryCallbackContext, name);
+    }
+
     aQuery.Finalize(aResponseCode, mSocket);
 }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+bool Server::HasOtherQueryFor(const QueryTransaction &aQuery, const char *aName) const
+{
+    bool found = false;
+    char name[Name::kMaxNameSize];
+
+    for (const QueryTransaction &query : mQueryTransactions)
+    {
+        if (!query.IsValid() || (&query == &aQuery))
+        {
+            continue;
+        }
+
+        if ((GetQueryTypeAndName(query.GetResponseHeader(), query.GetResponseMessage(), name) != kDnsQueryNone) &&
+            (strcmp(name, aName) == 0))
+        {
+            ExitNow(found = true);
+        }
+    }
+
+exit:
+    return found;
+}
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+
 void Server::QueryTransaction::Init(const Header &          aResponseHeader,
                                     Message &               aResponseMessage,
                                     const NameCompressInfo &aCompressInfo,
@@ -1201,6 +1457,246 @@ void Server::QueryTransaction::Finalize(Header::Response aResponseMessage, Ip6::
     mResponseMessage = nullptr;
 }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+Error Server::ForwardToUpstream(const Header &          aRequestHeader,
+                                const Message &         aRequestMessage,
+                                const Ip6::MessageInfo &aMessageInfo,
+                                const char *            aName)
+{
+    Error                error     = kErrorNone;
+    Message *            message   = nullptr;
+    UpstreamTransaction *txn       = nullptr;
+    uint16_t             messageId = mUpstreamMessageId;
+    bool                 shared    = false;
+    Header               header;
+    Ip6::MessageInfo     messageInfo;
+    uint16_t             nameLength = StringLength(aName, Name::kMaxNameSize);
+
+    VerifyOrExit(nameLength < Name::kMaxNameSize, error = kErrorInvalidArgs);
+
+    for (UpstreamTransaction &entry : mUpstreamTransactions)
+    {
+        if (!entry.mValid)
+        {
+            txn = &entry;
+            break;
+        }
+    }
+
+    VerifyOrExit(txn != nullptr, error = kErrorNoBufs);
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+    // With query aggregation, a client query for a name which is
+    // already outstanding upstream piggybacks on the pending upstream
+    // query (sharing its message ID) instead of sending a second one.
+    for (const UpstreamTransaction &entry : mUpstreamTransactions)
+    {
+        if (entry.mValid && (strcmp(entry.mName, aName) == 0))
+        {
+            messageId = entry.mUpstreamMessageId;
+            shared    = true;
+            break;
+        }
+    }
+#endif
+
+    if (!shared)
+    {
+        // The upstream socket is opened lazily on the first forwarded query
+        // and then kept open, so that consecutive queries reuse it.
+        if (!mUpstreamSocket.IsBound())
+        {
+            SuccessOrExit(error = mUpstreamSocket.Open(&Server::HandleUpstreamReceive, this));
+            SuccessOrExit(error = mUpstreamSocket.Bind(0, OT_NETIF_UNSPECIFIED));
+        }
+
+        message = mUpstreamSocket.NewMessage(0);
+        VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+        SuccessOrExit(error =
+                          message->AppendBytesFromMessage(aRequestMessage, aRequestMessage.GetOffset(),
+                                                          aRequestMessage.GetLength() - aRequestMessage.GetOffset()));
+
+        // The query is relayed verbatim, only rewriting the message ID so
+        // that the upstream answer can be matched back to its transaction.
+        header = aRequestHeader;
+        header.SetMessageId(messageId);
+        message->Write(0, header);
+
+        messageInfo.SetPeerAddr(mUpstreamResolver.GetAddress());
+        messageInfo.SetPeerPort(mUpstreamResolver.GetPort());
+
+        SuccessOrExit(error = mUpstreamSocket.SendTo(*message, messageInfo));
+        message = nullptr;
+
+        mUpstreamMessageId++;
+    }
+
+    txn->mValid             = true;
+    txn->mUpstreamMessageId = messageId;
+    txn->mOriginalMessageId = aRequestHeader.GetMessageId();
+    txn->mMessageInfo       = aMessageInfo;
+    txn->mExpire            = TimerMilli::GetNow() + kUpstreamTimeout;
+    memcpy(txn->mName, aName, nameLength + 1);
+
+    ResetTimer();
+
+    otLogInfoDns("[server] %s query for %s to upstream", shared ? "aggregated" : "forwarded", aName);
+
+exit:
+    FreeMessageOnError(message, error);
+    return error;
+}
+
+void Server::HandleUpstreamReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    static_cast<Server *>(aContext)->HandleUpstreamReceive(*static_cast<Message *>(aMessage),
+                                                           *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
+}
+
+void Server::HandleUpstreamReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    bool   matched = false;
+    Header header;
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    SuccessOrExit(aMessage.Read(aMessage.GetOffset(), header));
+    VerifyOrExit(header.GetType() == Header::kTypeResponse);
+
+    // All transactions pending on the received message ID are answered
+    // from the one upstream response (more than one when query
+    // aggregation has piggybacked identical client queries on a single
+    // upstream query).
+    for (UpstreamTransaction &txn : mUpstreamTransactions)
+    {
+        if (!txn.mValid || (txn.mUpstreamMessageId != header.GetMessageId()))
+        {
+            continue;
+        }
+
+        txn.mValid = false;
+
+        if (!matched)
+        {
+            matched = true;
+
+            if (header.GetResponseCode() == Header::kResponseNameError)
+            {
+                AddNegativeCacheEntry(txn.mName);
+            }
+        }
+
+        RelayUpstreamResponse(aMessage, header, txn);
+    }
+
+    VerifyOrExit(matched);
+    ResetTimer();
+
+exit:
+    return;
+}
+
+void Server::RelayUpstreamResponse(const Message &aMessage, Header aHeader, const UpstreamTransaction &aTxn)
+{
+    Error    error    = kErrorNone;
+    Message *response = mSocket.NewMessage(0);
+
+    VerifyOrExit(response != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = response->AppendBytesFromMessage(aMessage, aMessage.GetOffset(),
+                                                           aMessage.GetLength() - aMessage.GetOffset()));
+
+    // Relay the upstream answer back to the client, restoring the
+    // original message ID.
+    aHeader.SetMessageId(aTxn.mOriginalMessageId);
+    response->Write(0, aHeader);
+
+    error = mSocket.SendTo(*response, aTxn.mMessageInfo);
+
+exit:
+    FreeMessageOnError(response, error);
+
+    if (error != kErrorNone)
+    {
+        otLogWarnDns("[server] failed to relay upstream answer: %s", ErrorToString(error));
+    }
+}
+
+void Server::FinalizeUpstreamTransaction(UpstreamTransaction &aTxn, Header::Response aResponseCode)
+{
+    Message *message = mSocket.NewMessage(0);
+    Header   header;
+
+    aTxn.mValid = false;
+
+    VerifyOrExit(message != nullptr);
+    SuccessOrExit(message->SetLength(sizeof(Header)));
+
+    header.Clear();
+    header.SetType(Header::kTypeResponse);
+    header.SetMessageId(aTxn.mOriginalMessageId);
+
+    SendResponse(header, aResponseCode, *message, aTxn.mMessageInfo, mSocket);
+    message = nullptr;
+
+exit:
+    FreeMessage(message);
+}
+
+bool Server::IsNameNegativelyCached(const char *aName)
+{
+    bool      found = false;
+    TimeMilli now   = TimerMilli::GetNow();
+
+    for (NegativeCacheEntry &entry : mNegativeCache)
+    {
+        if (entry.mValid && (entry.mExpire <= now))
+        {
+            entry.mValid = false;
+        }
+
+        if (entry.mValid && (strcmp(entry.mName, aName) == 0))
+        {
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+void Server::AddNegativeCacheEntry(const char *aName)
+{
+    NegativeCacheEntry *victim     = nullptr;
+    uint16_t            nameLength = StringLength(aName, Name::kMaxNameSize);
+
+    VerifyOrExit(nameLength < Name::kMaxNameSize);
+
+    // Reuse an invalid entry, otherwise evict the entry closest to
+    // expiry.
+    for (NegativeCacheEntry &entry : mNegativeCache)
+    {
+        if (!entry.mValid)
+        {
+            victim = &entry;
+            break;
+        }
+
+        if ((victim == nullptr) || (entry.mExpire < victim->mExpire))
+        {
+            victim = &entry;
+        }
+    }
+
+    victim->mValid  = true;
+    victim->mExpire = TimerMilli::GetNow() + kNegativeCacheTimeout;
+    memcpy(victim->mName, aName, nameLength + 1);
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+
 } // namespace ServiceDiscovery
 } // namespace Dns
 } // namespace ot
@@ -154,6 +154,18 @@ public:
      */
     static DnsQueryType GetQueryTypeAndName(const otDnssdQuery *aQuery, char (&aName)[Name::kMaxNameSize]);
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    /**
+     * This method sets the upstream resolver to which unresolved queries are forwarded.
+     *
+     * Passing a socket address with an unspecified IPv6 address disables upstream forwarding.
+     *
+     * @param[in] aSockAddr   The socket address of the upstream resolver.
+     *
+     */
+    void SetUpstreamResolver(const Ip6::SockAddr &aSockAddr) { mUpstreamResolver = aSockAddr; }
+#endif
+
 private:
     class NameCompressInfo : public Clearable<NameCompressInfo>
     {
@@ -364,6 +376,80 @@ private:
     const Srp::Server::Host *          GetNextSrpHost(const Srp::Server::Host *aHost);
     static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host &   aHost,
                                                          const Srp::Server::Service *aService);
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+    // This structure caches the precompressed answer and additional sections of a browse (PTR)
+    // response built from the SRP records. The cached bytes are valid for any single-question
+    // browse query for the same service name, since the name compression pointers they contain
+    // refer only to the question section which is then identical.
+    struct BrowseCacheEntry
+    {
+        static constexpr uint16_t kAnswerSize = OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ANSWER_SIZE;
+
+        bool Matches(const char *aServiceName) const
+        {
+            return mValid && (strcmp(mServiceName, aServiceName) == 0);
+        }
+
+        bool      mValid;
+        char      mServiceName[Name::kMaxNameSize];
+        uint16_t  mAnswerLength;
+        uint16_t  mAnswerCount;
+        uint16_t  mAdditionalCount;
+        TimeMilli mTimeCached;
+        uint8_t   mAnswer[kAnswerSize];
+    };
+
+    static constexpr uint16_t kBrowseCacheEntries = OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENTRIES;
+    static constexpr uint32_t kBrowseCacheMaxAge  = 1000; // Max age of a cached answer (in msec) to bound TTL skew.
+
+    bool AnswerBrowseQuestionFromCache(const char *aServiceName, Header &aResponseHeader, Message &aResponseMessage);
+    void CacheBrowseAnswer(const char *   aServiceName,
+                           const Header & aResponseHeader,
+                           const Message &aResponseMessage,
+                           uint16_t       aAnswerOffset);
+    void InvalidateBrowseCache(void);
+#endif
+#endif
+
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    // This structure tracks one outstanding query forwarded to the upstream resolver. The client query is
+    // relayed verbatim with a rewritten message ID; the original ID and the client address are kept here so
+    // that the upstream answer can be relayed back.
+    struct UpstreamTransaction
+    {
+        bool             mValid;             // Whether this transaction is in use.
+        uint16_t         mUpstreamMessageId; // The rewritten message ID used towards the upstream resolver.
+        uint16_t         mOriginalMessageId; // The message ID used by the client.
+        Ip6::MessageInfo mMessageInfo;       // The message info of the client query (for relaying the answer).
+        TimeMilli        mExpire;            // The time at which the transaction times out.
+        char             mName[Name::kMaxNameSize]; // The queried name (for negative caching).
+    };
+
+    // This structure caches a name for which the upstream resolver answered NXDOMAIN, so that repeated
+    // queries for the same unknown name are answered locally without another upstream round trip.
+    struct NegativeCacheEntry
+    {
+        bool      mValid;
+        TimeMilli mExpire;
+        char      mName[Name::kMaxNameSize];
+    };
+
+    static constexpr uint16_t kMaxUpstreamTransactions = OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_MAX_TRANSACTIONS;
+    static constexpr uint32_t kUpstreamTimeout         = OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_TIMEOUT;
+    static constexpr uint16_t kNegativeCacheEntries = OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_NEGATIVE_CACHE_ENTRIES;
+    static constexpr uint32_t kNegativeCacheTimeout = 30000; // Lifetime of a negative cache entry (in msec).
+
+    bool IsUpstreamForwardingEnabled(void) const { return !mUpstreamResolver.GetAddress().IsUnspecified(); }
+    Error       ForwardToUpstream(const Header &          aRequestHeader,
+                                  const Message &         aRequestMessage,
+                                  const Ip6::MessageInfo &aMessageInfo,
+                                  const char *            aName);
+    static void HandleUpstreamReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    void        HandleUpstreamReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void        RelayUpstreamResponse(const Message &aMessage, Header aHeader, const UpstreamTransaction &aTxn);
+    void        FinalizeUpstreamTransaction(UpstreamTransaction &aTxn, Header::Response aResponseCode);
+    bool        IsNameNegativelyCached(const char *aName);
+    void        AddNegativeCacheEntry(const char *aName);
 #endif
 
     Error             ResolveByQueryCallbacks(Header &                aResponseHeader,
@@ -383,6 +469,9 @@ private:
     static bool       CanAnswerQuery(const Server::QueryTransaction &aQuery, const char *aHostFullName);
     void AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, const otDnssdHostInfo &aHostInfo);
     void FinalizeQuery(QueryTransaction &aQuery, Header::Response aResponseCode);
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_QUERY_AGGREGATION_ENABLE
+    bool HasOtherQueryFor(const QueryTransaction &aQuery, const char *aName) const;
+#endif
     static DnsQueryType GetQueryTypeAndName(const Header & aHeader,
                                             const Message &aMessage,
                                             char (&aName)[Name::kMaxNameSize]);
@@ -398,6 +487,16 @@ private:
     Ip6::Udp::Socket  mSocket;
 
     QueryTransaction                mQueryTransactions[kMaxConcurrentQueries];
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+    BrowseCacheEntry                mBrowseCache[kBrowseCacheEntries];
+#endif
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_UPSTREAM_FORWARDER_ENABLE
+    Ip6::Udp::Socket                mUpstreamSocket;
+    Ip6::SockAddr                   mUpstreamResolver;
+    uint16_t                        mUpstreamMessageId;
+    UpstreamTransaction             mUpstreamTransactions[kMaxUpstreamTransactions];
+    NegativeCacheEntry              mNegativeCache[kNegativeCacheEntries];
+#endif
     void *                          mQueryCallbackContext;
     otDnssdQuerySubscribeCallback   mQuerySubscribe;
     otDnssdQueryUnsubscribeCallback mQueryUnsubscribe;
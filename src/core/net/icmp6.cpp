@@ -39,6 +39,7 @@
 #include "common/locator_getters.hpp"
 #include "common/logging.hpp"
 #include "common/message.hpp"
+#include "common/timer.hpp"
 #include "net/checksum.hpp"
 #include "net/ip6.hpp"
 
@@ -50,6 +51,16 @@ Icmp::Icmp(Instance &aInstance)
     , mEchoSequence(1)
     , mEchoMode(OT_ICMP6_ECHO_HANDLER_ALL)
 {
+#if OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT > 0
+    for (EchoSource &source : mEchoSources)
+    {
+        source.mAddress.Clear();
+        source.mWindowStart = TimeMilli(0);
+        source.mCount       = 0;
+    }
+
+    mEchoRateLimitedCount = 0;
+#endif
 }
 
 Message *Icmp::NewMessage(uint16_t aReserved)
@@ -123,26 +134,39 @@ exit:
     return error;
 }
 
-Error Icmp::HandleMessage(Message &aMessage, MessageInfo &aMessageInfo)
+Error Icmp::HandleMessage(Message *&aMessagePtr, MessageInfo &aMessageInfo)
 {
-    Error  error = kErrorNone;
-    Header icmp6Header;
+    Error    error   = kErrorNone;
+    Message &message = *aMessagePtr;
+    Header   icmp6Header;
 
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), icmp6Header));
+    SuccessOrExit(error = message.Read(message.GetOffset(), icmp6Header));
 
-    SuccessOrExit(error = Checksum::VerifyMessageChecksum(aMessage, aMessageInfo, kProtoIcmp6));
+    SuccessOrExit(error = Checksum::VerifyMessageChecksum(message, aMessageInfo, kProtoIcmp6));
 
+#if !OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
     if (icmp6Header.GetType() == Header::kTypeEchoRequest)
     {
-        SuccessOrExit(error = HandleEchoRequest(aMessage, aMessageInfo));
+        SuccessOrExit(error = HandleEchoRequest(aMessagePtr, aMessageInfo));
     }
+#endif
 
-    aMessage.MoveOffset(sizeof(icmp6Header));
+    message.MoveOffset(sizeof(icmp6Header));
 
     for (Handler &handler : mHandlers)
     {
-        handler.HandleReceiveMessage(aMessage, aMessageInfo, icmp6Header);
+        handler.HandleReceiveMessage(message, aMessageInfo, icmp6Header);
+    }
+
+#if OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
+    if (icmp6Header.GetType() == Header::kTypeEchoRequest)
+    {
+        // Handlers have been notified at this point, so the request
+        // message can be reused in place to send the Echo Reply.
+        message.MoveOffset(-static_cast<int>(sizeof(icmp6Header)));
+        SuccessOrExit(error = HandleEchoRequest(aMessagePtr, aMessageInfo));
     }
+#endif
 
 exit:
     return error;
@@ -171,19 +195,64 @@ bool Icmp::ShouldHandleEchoRequest(const MessageInfo &aMessageInfo)
     return rval;
 }
 
-Error Icmp::HandleEchoRequest(Message &aRequestMessage, const MessageInfo &aMessageInfo)
+Error Icmp::HandleEchoRequest(Message *&aRequestPtr, const MessageInfo &aMessageInfo)
 {
-    Error       error = kErrorNone;
+    Error       error          = kErrorNone;
+    Message &   requestMessage = *aRequestPtr;
     Header      icmp6Header;
-    Message *   replyMessage = nullptr;
     MessageInfo replyMessageInfo;
-    uint16_t    payloadLength;
+#if OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
+    uint16_t sequence;
+#else
+    Message *replyMessage = nullptr;
+    uint16_t payloadLength;
+#endif
 
     // always handle Echo Request destined for RLOC or ALOC
     VerifyOrExit(ShouldHandleEchoRequest(aMessageInfo) || aMessageInfo.GetSockAddr().GetIid().IsLocator());
 
+#if OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT > 0
+    if (IsEchoRateLimited(aMessageInfo.GetPeerAddr()))
+    {
+        mEchoRateLimitedCount++;
+        otLogInfoIcmp("Echo Request rate limited from %s", aMessageInfo.GetPeerAddr().ToString().AsCString());
+        ExitNow();
+    }
+#endif
+
     otLogInfoIcmp("Received Echo Request");
 
+    replyMessageInfo.SetPeerAddr(aMessageInfo.GetPeerAddr());
+
+    if (!aMessageInfo.GetSockAddr().IsMulticast())
+    {
+        replyMessageInfo.SetSockAddr(aMessageInfo.GetSockAddr());
+    }
+
+#if OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
+
+    // Reuse the request message for the reply: rewrite the ICMPv6
+    // header in place (the checksum is recomputed on send), strip the
+    // received IPv6 header, and hand the message back to `Ip6` which
+    // prepends the reply IPv6 header into the space just freed.
+
+    IgnoreError(requestMessage.Read(requestMessage.GetOffset(), icmp6Header));
+    sequence = icmp6Header.GetSequence();
+
+    icmp6Header.Clear();
+    icmp6Header.SetType(Header::kTypeEchoReply);
+    requestMessage.WriteBytes(requestMessage.GetOffset(), &icmp6Header, Header::kDataFieldOffset);
+
+    requestMessage.RemoveHeader(requestMessage.GetOffset());
+    requestMessage.SetOffset(0);
+
+    SuccessOrExit(error = Get<Ip6>().SendDatagram(requestMessage, replyMessageInfo, kProtoIcmp6));
+    aRequestPtr = nullptr;
+
+    otLogInfoIcmp("Sent Echo Reply (seq = %d)", sequence);
+
+#else // OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
+
     icmp6Header.Clear();
     icmp6Header.SetType(Header::kTypeEchoReply);
 
@@ -193,29 +262,75 @@ Error Icmp::HandleEchoRequest(Message &aRequestMessage, const MessageInfo &aMess
         ExitNow();
     }
 
-    payloadLength = aRequestMessage.GetLength() - aRequestMessage.GetOffset() - Header::kDataFieldOffset;
+    payloadLength = requestMessage.GetLength() - requestMessage.GetOffset() - Header::kDataFieldOffset;
     SuccessOrExit(error = replyMessage->SetLength(Header::kDataFieldOffset + payloadLength));
 
     replyMessage->WriteBytes(0, &icmp6Header, Header::kDataFieldOffset);
-    aRequestMessage.CopyTo(aRequestMessage.GetOffset() + Header::kDataFieldOffset, Header::kDataFieldOffset,
+    requestMessage.CopyTo(requestMessage.GetOffset() + Header::kDataFieldOffset, Header::kDataFieldOffset,
                            payloadLength, *replyMessage);
 
-    replyMessageInfo.SetPeerAddr(aMessageInfo.GetPeerAddr());
-
-    if (!aMessageInfo.GetSockAddr().IsMulticast())
-    {
-        replyMessageInfo.SetSockAddr(aMessageInfo.GetSockAddr());
-    }
-
     SuccessOrExit(error = Get<Ip6>().SendDatagram(*replyMessage, replyMessageInfo, kProtoIcmp6));
 
     IgnoreError(replyMessage->Read(replyMessage->GetOffset(), icmp6Header));
     otLogInfoIcmp("Sent Echo Reply (seq = %d)", icmp6Header.GetSequence());
 
+#endif // OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
+
 exit:
+#if !OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE
     FreeMessageOnError(replyMessage, error);
+#endif
     return error;
 }
 
+#if OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT > 0
+bool Icmp::IsEchoRateLimited(const Address &aPeerAddress)
+{
+    bool        limited = false;
+    TimeMilli   now     = TimerMilli::GetNow();
+    EchoSource *entry   = nullptr;
+    EchoSource *oldest  = &mEchoSources[0];
+
+    for (EchoSource &source : mEchoSources)
+    {
+        if (source.mAddress == aPeerAddress)
+        {
+            entry = &source;
+            break;
+        }
+
+        if (source.mWindowStart < oldest->mWindowStart)
+        {
+            oldest = &source;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        entry               = oldest;
+        entry->mAddress     = aPeerAddress;
+        entry->mWindowStart = now;
+        entry->mCount       = 0;
+    }
+
+    if (now - entry->mWindowStart >= kEchoRateLimitWindow)
+    {
+        entry->mWindowStart = now;
+        entry->mCount       = 0;
+    }
+
+    if (entry->mCount < OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT)
+    {
+        entry->mCount++;
+    }
+    else
+    {
+        limited = true;
+    }
+
+    return limited;
+}
+#endif // OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT > 0
+
 } // namespace Ip6
 } // namespace ot
@@ -43,6 +43,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/time.hpp"
 #include "net/ip6_headers.hpp"
 
 namespace ot {
@@ -286,15 +287,19 @@ public:
     /**
      * This method handles an ICMPv6 message.
      *
-     * @param[in]  aMessage      A reference to the ICMPv6 message.
-     * @param[in]  aMessageInfo  A reference to the message info associated with @p aMessage.
+     * If the message is reused in place to send an Echo Reply (see
+     * `OPENTHREAD_CONFIG_ICMP6_REUSE_MESSAGE_FOR_ECHO_REPLY_ENABLE`), its ownership is taken over and
+     * @p aMessagePtr is set to `nullptr`.
+     *
+     * @param[in,out]  aMessagePtr   A reference to a pointer to the ICMPv6 message.
+     * @param[in]      aMessageInfo  A reference to the message info associated with @p aMessagePtr.
      *
      * @retval kErrorNone     Successfully processed the ICMPv6 message.
      * @retval kErrorNoBufs   Insufficient buffers available to generate the reply.
      * @retval kErrorDrop     The ICMPv6 message was invalid and dropped.
      *
      */
-    Error HandleMessage(Message &aMessage, MessageInfo &aMessageInfo);
+    Error HandleMessage(Message *&aMessagePtr, MessageInfo &aMessageInfo);
 
     /**
      * This method indicates whether or not ICMPv6 Echo processing is enabled.
@@ -330,13 +335,42 @@ public:
      */
     uint16_t GetEchoSequence(void) const { return mEchoSequence; }
 
+#if OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT > 0
+    /**
+     * This method returns the number of ICMPv6 Echo Requests dropped by the per-source rate limit.
+     *
+     * @returns The number of rate-limited (unanswered) Echo Requests.
+     *
+     */
+    uint32_t GetEchoRateLimitedCount(void) const { return mEchoRateLimitedCount; }
+#endif
+
 private:
-    Error HandleEchoRequest(Message &aRequestMessage, const MessageInfo &aMessageInfo);
+    Error HandleEchoRequest(Message *&aRequestPtr, const MessageInfo &aMessageInfo);
+
+#if OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT > 0
+    struct EchoSource
+    {
+        Address   mAddress;     // Source address of recent Echo Requests.
+        TimeMilli mWindowStart; // Start of the current accounting window.
+        uint16_t  mCount;       // Echo Requests answered within the window.
+    };
+
+    static constexpr uint8_t  kNumEchoSources      = 4;    // Number of tracked echo sources.
+    static constexpr uint32_t kEchoRateLimitWindow = 1000; // Accounting window length (in msec).
+
+    bool IsEchoRateLimited(const Address &aPeerAddress);
+#endif
 
     LinkedList<Handler> mHandlers;
 
     uint16_t        mEchoSequence;
     otIcmp6EchoMode mEchoMode;
+
+#if OPENTHREAD_CONFIG_ICMP6_ECHO_PER_SOURCE_RATE_LIMIT > 0
+    EchoSource mEchoSources[kNumEchoSources];
+    uint32_t   mEchoRateLimitedCount;
+#endif
 };
 
 /**
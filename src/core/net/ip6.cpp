@@ -76,6 +76,9 @@ Ip6::Ip6(Instance &aInstance)
     , mTcp(aInstance)
 #endif
 {
+#if OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+    ClearFlowCache();
+#endif
 }
 
 Message *Ip6::NewMessage(uint16_t aReserved, const Message::Settings &aSettings)
@@ -978,7 +981,9 @@ Error Ip6::HandlePayload(Header &           aIp6Header,
         break;
 
     case kProtoIcmp6:
-        error = mIcmp.HandleMessage(*message, aMessageInfo);
+        // `HandleMessage()` may take over the message ownership (when
+        // reusing it to send an Echo Reply) and set `message` to nullptr.
+        error = mIcmp.HandleMessage(message, aMessageInfo);
         break;
 
     default:
@@ -1125,6 +1130,9 @@ Error Ip6::HandleDatagram(Message &aMessage, Netif *aNetif, const void *aLinkMes
     bool        multicastPromiscuous;
     bool        shouldFreeMessage;
     uint8_t     nextHeader;
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    uint64_t profileEnterTime = Get<Utils::PipelineProfiler>().GetNow();
+#endif
 
 start:
     receive              = false;
@@ -1178,24 +1186,33 @@ start:
     }
     else
     {
-        // unicast
-        if (Get<ThreadNetif>().HasUnicastAddress(header.GetDestination()))
-        {
-            receive = true;
-        }
-        else if (!header.GetDestination().IsLinkLocal())
-        {
-            forwardThread = true;
-        }
-        else if (aNetif == nullptr)
+#if OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+        if (!FindFlowCacheVerdict(header, aNetif != nullptr, aFromNcpHost, receive, forwardThread, forwardHost))
+#endif
         {
-            forwardThread = true;
-        }
+            // unicast
+            if (Get<ThreadNetif>().HasUnicastAddress(header.GetDestination()))
+            {
+                receive = true;
+            }
+            else if (!header.GetDestination().IsLinkLocal())
+            {
+                forwardThread = true;
+            }
+            else if (aNetif == nullptr)
+            {
+                forwardThread = true;
+            }
 
-        if (forwardThread && !ShouldForwardToThread(messageInfo, aFromNcpHost))
-        {
-            forwardThread = false;
-            forwardHost   = true;
+            if (forwardThread && !ShouldForwardToThread(messageInfo, aFromNcpHost))
+            {
+                forwardThread = false;
+                forwardHost   = true;
+            }
+
+#if OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+            UpdateFlowCache(header, aNetif != nullptr, aFromNcpHost, receive, forwardThread, forwardHost);
+#endif
         }
     }
 
@@ -1329,6 +1346,10 @@ exit:
         aMessage.Free();
     }
 
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    Get<Utils::PipelineProfiler>().Sample(Utils::PipelineProfiler::kStageIp6, profileEnterTime);
+#endif
+
     return error;
 }
 
@@ -1373,6 +1394,85 @@ exit:
     return rval;
 }
 
+#if OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+
+uint16_t Ip6::ComputeFlowCacheIndex(const Header &aHeader)
+{
+    uint32_t hash = 0;
+
+    for (uint8_t i = 0; i < Address::kSize / sizeof(uint32_t); i++)
+    {
+        hash ^= aHeader.GetSource().mFields.m32[i];
+        hash ^= aHeader.GetDestination().mFields.m32[i];
+    }
+
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+
+    return static_cast<uint16_t>(hash % kFlowCacheSize);
+}
+
+bool Ip6::FindFlowCacheVerdict(const Header &aHeader,
+                               bool          aIsInbound,
+                               bool          aIsFromHost,
+                               bool &        aReceive,
+                               bool &        aForwardThread,
+                               bool &        aForwardHost) const
+{
+    bool                  found = false;
+    const FlowCacheEntry &entry = mFlowCache[ComputeFlowCacheIndex(aHeader)];
+
+    VerifyOrExit(entry.mIsValid);
+    VerifyOrExit(entry.mIsInbound == aIsInbound && entry.mIsFromHost == aIsFromHost);
+    VerifyOrExit(entry.mSource == aHeader.GetSource() && entry.mDestination == aHeader.GetDestination());
+
+    aReceive       = entry.mReceive;
+    aForwardThread = entry.mForwardThread;
+    aForwardHost   = entry.mForwardHost;
+    found          = true;
+
+exit:
+    return found;
+}
+
+void Ip6::UpdateFlowCache(const Header &aHeader,
+                          bool          aIsInbound,
+                          bool          aIsFromHost,
+                          bool          aReceive,
+                          bool          aForwardThread,
+                          bool          aForwardHost)
+{
+    FlowCacheEntry &entry = mFlowCache[ComputeFlowCacheIndex(aHeader)];
+
+    entry.mSource        = aHeader.GetSource();
+    entry.mDestination   = aHeader.GetDestination();
+    entry.mIsInbound     = aIsInbound;
+    entry.mIsFromHost    = aIsFromHost;
+    entry.mReceive       = aReceive;
+    entry.mForwardThread = aForwardThread;
+    entry.mForwardHost   = aForwardHost;
+    entry.mIsValid       = true;
+}
+
+void Ip6::ClearFlowCache(void)
+{
+    for (FlowCacheEntry &entry : mFlowCache)
+    {
+        entry.mIsValid = false;
+    }
+}
+
+void Ip6::HandleNotifierEvents(Events aEvents)
+{
+    if (aEvents.ContainsAny(kEventIp6AddressAdded | kEventIp6AddressRemoved | kEventThreadRoleChanged |
+                            kEventThreadNetdataChanged))
+    {
+        ClearFlowCache();
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+
 const Netif::UnicastAddress *Ip6::SelectSourceAddress(MessageInfo &aMessageInfo)
 {
     Address *                    destination                 = &aMessageInfo.GetPeerAddr();
@@ -45,6 +45,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "net/icmp6.hpp"
@@ -104,6 +105,7 @@ using ot::Encoding::BigEndian::HostSwap32;
 class Ip6 : public InstanceLocator, private NonCopyable
 {
     friend class ot::Instance;
+    friend class ot::Notifier;
     friend class ot::TimeTicker;
     friend class Mpl;
 
@@ -356,6 +358,38 @@ private:
     bool  ShouldForwardToThread(const MessageInfo &aMessageInfo, bool aFromNcpHost) const;
     bool  IsOnLink(const Address &aAddress) const;
 
+#if OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+    static constexpr uint16_t kFlowCacheSize = OPENTHREAD_CONFIG_IP6_FLOW_CACHE_SIZE;
+
+    struct FlowCacheEntry
+    {
+        Address mSource;
+        Address mDestination;
+        bool    mIsValid;
+        bool    mIsInbound;
+        bool    mIsFromHost;
+        bool    mReceive;
+        bool    mForwardThread;
+        bool    mForwardHost;
+    };
+
+    static uint16_t ComputeFlowCacheIndex(const Header &aHeader);
+    bool            FindFlowCacheVerdict(const Header &aHeader,
+                                         bool          aIsInbound,
+                                         bool          aIsFromHost,
+                                         bool &        aReceive,
+                                         bool &        aForwardThread,
+                                         bool &        aForwardHost) const;
+    void            UpdateFlowCache(const Header &aHeader,
+                                    bool          aIsInbound,
+                                    bool          aIsFromHost,
+                                    bool          aReceive,
+                                    bool          aForwardThread,
+                                    bool          aForwardHost);
+    void            ClearFlowCache(void);
+    void            HandleNotifierEvents(Events aEvents);
+#endif
+
     bool                 mForwardingEnabled;
     bool                 mIsReceiveIp6FilterEnabled;
     otIp6ReceiveCallback mReceiveIp6DatagramCallback;
@@ -375,6 +409,10 @@ private:
 #if OPENTHREAD_CONFIG_IP6_FRAGMENTATION_ENABLE
     MessageQueue mReassemblyList;
 #endif
+
+#if OPENTHREAD_CONFIG_IP6_FLOW_CACHE_ENABLE
+    FlowCacheEntry mFlowCache[kFlowCacheSize];
+#endif
 };
 
 /**
@@ -44,6 +44,7 @@
 #include "net/netif.hpp"
 
 using ot::Encoding::BigEndian::HostSwap32;
+using ot::Encoding::BigEndian::ReadUint32;
 
 namespace ot {
 namespace Ip6 {
@@ -89,32 +90,63 @@ exit:
     return isSmaller;
 }
 
+static uint8_t CountLeadingZeroBits(uint32_t aValue) // `aValue` MUST NOT be zero.
+{
+#ifdef __GNUC__
+    return static_cast<uint8_t>(__builtin_clz(aValue));
+#else
+    uint8_t count = 0;
+
+    while ((aValue & (1UL << 31)) == 0)
+    {
+        count++;
+        aValue <<= 1;
+    }
+
+    return count;
+#endif
+}
+
 uint8_t Prefix::MatchLength(const uint8_t *aPrefixA, const uint8_t *aPrefixB, uint8_t aMaxSize)
 {
     uint8_t matchedLength = 0;
+    uint8_t offset;
 
     OT_ASSERT(aMaxSize <= Address::kSize);
 
-    for (uint8_t i = 0; i < aMaxSize; i++)
+    // Compare one 32-bit word at a time: XOR the words and count the
+    // leading zero bits of the first differing word. `ReadUint32()`
+    // assembles each word byte-wise, so the input arrays require no
+    // particular alignment (`Address` and `Prefix` are packed types
+    // and callers may pass raw TLV buffers).
+
+    for (offset = 0; offset + sizeof(uint32_t) <= aMaxSize; offset += sizeof(uint32_t))
     {
-        uint8_t diff = aPrefixA[i] ^ aPrefixB[i];
+        uint32_t diff = ReadUint32(aPrefixA + offset) ^ ReadUint32(aPrefixB + offset);
 
-        if (diff == 0)
+        if (diff != 0)
         {
-            matchedLength += CHAR_BIT;
+            matchedLength += CountLeadingZeroBits(diff);
+            ExitNow();
         }
-        else
-        {
-            while ((diff & 0x80) == 0)
-            {
-                matchedLength++;
-                diff <<= 1;
-            }
 
-            break;
+        matchedLength += sizeof(uint32_t) * CHAR_BIT;
+    }
+
+    for (; offset < aMaxSize; offset++)
+    {
+        uint8_t diff = aPrefixA[offset] ^ aPrefixB[offset];
+
+        if (diff != 0)
+        {
+            matchedLength += CountLeadingZeroBits(static_cast<uint32_t>(diff) << 24);
+            ExitNow();
         }
+
+        matchedLength += CHAR_BIT;
     }
 
+exit:
     return matchedLength;
 }
 
@@ -148,10 +180,10 @@ void Prefix::ToString(StringWriter &aWriter) const
 
     if (GetBytesSize() < Address::kSize - 1)
     {
-        aWriter.Append("::");
+        aWriter.AppendChar(':').AppendChar(':');
     }
 
-    aWriter.Append("/%d", mLength);
+    aWriter.AppendChar('/').AppendUint(mLength);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -656,10 +688,10 @@ void Address::AppendHexWords(StringWriter &aWriter, uint8_t aLength) const
     {
         if (index > 0)
         {
-            aWriter.Append(":");
+            aWriter.AppendChar(':');
         }
 
-        aWriter.Append("%x", HostSwap16(mFields.m16[index]));
+        aWriter.AppendHexUint16(HostSwap16(mFields.m16[index]));
     }
 }
 
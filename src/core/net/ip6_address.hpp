@@ -273,6 +273,10 @@ public:
     /**
      * This static method returns the number of IPv6 prefix bits that match.
      *
+     * The comparison is performed word-wise (32-bit XOR plus leading-zero count of the first differing word). The
+     * byte arrays require no particular alignment (`Address` and `Prefix` are packed types with no alignment
+     * guarantee, and callers may pass raw message/TLV buffers).
+     *
      * @param[in]  aPrefixA     A pointer to a byte array containing a first prefix.
      * @param[in]  aPrefixB     A pointer to a byte array containing a second prefix.
      * @param[in]  aMaxSize     Number of bytes of the two prefixes.
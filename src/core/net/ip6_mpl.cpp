@@ -55,6 +55,9 @@ Mpl::Mpl(Instance &aInstance)
 #endif
 {
     memset(mSeedSet, 0, sizeof(mSeedSet));
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+    memset(mSeedCache, 0, sizeof(mSeedCache));
+#endif
 }
 
 void Mpl::InitOption(OptionMpl &aOption, const Address &aAddress)
@@ -134,6 +137,11 @@ exit:
  * - If evicting a valid entry (lifetime non-zero):
  *   - Require group size to have >=2 entries.
  *   - If inserting into existing group, require Sequence to be larger than oldest stored Sequence in group.
+ *
+ * A small direct-mapped cache of recently seen (Seed ID, Sequence) values front-ends the scan so that
+ * repeated copies of the same MPL Data Message (the common case on multicast-heavy networks) are rejected
+ * in O(1). The cache is exact (only values currently in the Seed Set are cached) and is cleared whenever
+ * an entry expires or is evicted, so it can never drop a message the full scan would have accepted.
  */
 Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
 {
@@ -144,6 +152,18 @@ Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
     uint8_t    curCount = 0;
     uint8_t    maxCount = 0;
 
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+    {
+        const CacheEntry &cacheEntry = mSeedCache[CacheBucketFor(aSeedId, aSequence)];
+
+        if (cacheEntry.mValid && (cacheEntry.mSeedId == aSeedId) && (cacheEntry.mSequence == aSequence))
+        {
+            // already received, drop message
+            ExitNow(error = kErrorDrop);
+        }
+    }
+#endif
+
     for (uint32_t i = 0; i < kNumSeedEntries; i++, curCount++)
     {
         if (mSeedSet[i].mLifetime == 0)
@@ -192,6 +212,9 @@ Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
             if (diff == 0)
             {
                 // already received, drop message
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+                CacheSeed(aSeedId, aSequence);
+#endif
                 ExitNow(error = kErrorDrop);
             }
             else if (insert == nullptr && diff < 0)
@@ -235,6 +258,12 @@ Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
             // require Sequence to be larger than oldest stored Sequence in group
             VerifyOrExit(insert > mSeedSet && aSeedId == (insert - 1)->mSeedId, error = kErrorDrop);
         }
+
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+        // A valid entry is about to be evicted, so cached values may no
+        // longer be present in the Seed Set.
+        ClearSeedCache();
+#endif
     }
 
     if (evict > insert)
@@ -253,6 +282,10 @@ Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
     insert->mSequence = aSequence;
     insert->mLifetime = kSeedEntryLifetime;
 
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+    CacheSeed(aSeedId, aSequence);
+#endif
+
     if (!mSeedSetTimer.IsRunning())
     {
         mSeedSetTimer.Start(kSeedEntryLifetimeDt);
@@ -271,6 +304,9 @@ void Mpl::HandleSeedSetTimer(void)
 {
     bool startTimer = false;
     int  j          = 0;
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+    bool hasExpired = false;
+#endif
 
     for (int i = 0; i < kNumSeedEntries && mSeedSet[i].mLifetime; i++)
     {
@@ -281,7 +317,22 @@ void Mpl::HandleSeedSetTimer(void)
             mSeedSet[j++] = mSeedSet[i];
             startTimer    = true;
         }
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+        else
+        {
+            hasExpired = true;
+        }
+#endif
+    }
+
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+    if (hasExpired)
+    {
+        // At least one entry expired, so cached values may no longer be
+        // present in the Seed Set.
+        ClearSeedCache();
     }
+#endif
 
     for (; j < kNumSeedEntries && mSeedSet[j].mLifetime; j++)
     {
@@ -294,6 +345,24 @@ void Mpl::HandleSeedSetTimer(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+
+void Mpl::CacheSeed(uint16_t aSeedId, uint8_t aSequence)
+{
+    CacheEntry &cacheEntry = mSeedCache[CacheBucketFor(aSeedId, aSequence)];
+
+    cacheEntry.mSeedId   = aSeedId;
+    cacheEntry.mSequence = aSequence;
+    cacheEntry.mValid    = true;
+}
+
+void Mpl::ClearSeedCache(void)
+{
+    memset(mSeedCache, 0, sizeof(mSeedCache));
+}
+
+#endif // OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+
 #if OPENTHREAD_FTD
 
 void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound)
@@ -311,6 +380,22 @@ void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSeque
 #endif
 
     VerifyOrExit(GetTimerExpirations() > 0);
+
+#if OPENTHREAD_CONFIG_MPL_SUBSCRIPTION_AWARE_FORWARDING_ENABLE
+    if (!aIsOutbound)
+    {
+        Address dstAddress;
+
+        // Only buffer a received data message for retransmission when
+        // the destination group has an interested listener in our
+        // subtree (the device itself or one of its children). Locally
+        // originated messages are always retransmitted.
+
+        IgnoreError(aMessage.Read(Header::kDestinationFieldOffset, dstAddress));
+        VerifyOrExit(HasInterestedListener(dstAddress));
+    }
+#endif
+
     VerifyOrExit((messageCopy = aMessage.Clone()) != nullptr, error = kErrorNoBufs);
 
     if (!aIsOutbound)
@@ -335,6 +420,34 @@ exit:
     FreeMessageOnError(messageCopy, error);
 }
 
+#if OPENTHREAD_CONFIG_MPL_SUBSCRIPTION_AWARE_FORWARDING_ENABLE
+
+bool Mpl::HasInterestedListener(const Address &aAddress) const
+{
+    // Indicates whether the destination group has a listener in this
+    // device's subtree: the device itself is subscribed (which covers
+    // the well-known groups all devices join) or one of its children
+    // has registered the address.
+
+    bool hasListener = Get<ThreadNetif>().IsMulticastSubscribed(aAddress);
+
+    VerifyOrExit(!hasListener);
+
+    for (const Child &child : Get<ChildTable>().Iterate(Child::kInStateValidOrRestoring))
+    {
+        if (child.HasIp6Address(aAddress))
+        {
+            hasListener = true;
+            break;
+        }
+    }
+
+exit:
+    return hasListener;
+}
+
+#endif // OPENTHREAD_CONFIG_MPL_SUBSCRIPTION_AWARE_FORWARDING_ENABLE
+
 void Mpl::HandleRetransmissionTimer(Timer &aTimer)
 {
     aTimer.Get<Mpl>().HandleRetransmissionTimer();
@@ -286,12 +286,34 @@ private:
         uint8_t  mLifetime;
     };
 
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+    static constexpr uint16_t kNumCacheEntries = OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES;
+
+    struct CacheEntry
+    {
+        uint16_t mSeedId;
+        uint8_t  mSequence;
+        bool     mValid;
+    };
+
+    uint16_t CacheBucketFor(uint16_t aSeedId, uint8_t aSequence) const
+    {
+        return ((aSeedId ^ aSequence) & (kNumCacheEntries - 1));
+    }
+
+    void CacheSeed(uint16_t aSeedId, uint8_t aSequence);
+    void ClearSeedCache(void);
+#endif
+
     static void HandleSeedSetTimer(Timer &aTimer);
     void        HandleSeedSetTimer(void);
 
     Error UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence);
 
     SeedEntry      mSeedSet[kNumSeedEntries];
+#if OPENTHREAD_CONFIG_MPL_SEED_SET_CACHE_ENTRIES > 0
+    CacheEntry mSeedCache[kNumCacheEntries];
+#endif
     const Address *mMatchingAddress;
     TimerMilli     mSeedSetTimer;
     uint16_t       mSeedId;
@@ -317,6 +339,9 @@ private:
     void        HandleRetransmissionTimer(void);
 
     void AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence, bool aIsOutbound);
+#if OPENTHREAD_CONFIG_MPL_SUBSCRIPTION_AWARE_FORWARDING_ENABLE
+    bool HasInterestedListener(const Address &aAddress) const;
+#endif
 
     MessageQueue mBufferedMessageSet;
     TimerMilli   mRetransmissionTimer;
@@ -109,6 +109,10 @@ const otNetifMulticastAddress Netif::kLinkLocalAllRoutersMulticastAddress = {
 Netif::Netif(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMulticastPromiscuous(false)
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    , mUnicastAddressFilter(0)
+    , mMulticastAddressFilter(0)
+#endif
     , mAddressCallback(nullptr)
     , mAddressCallbackContext(nullptr)
 {
@@ -116,7 +120,17 @@ Netif::Netif(Instance &aInstance)
 
 bool Netif::IsMulticastSubscribed(const Address &aAddress) const
 {
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    bool contains = false;
+
+    VerifyOrExit((mMulticastAddressFilter & FilterBit(aAddress)) != 0);
+    contains = mMulticastAddresses.ContainsMatching(aAddress);
+
+exit:
+    return contains;
+#else
     return mMulticastAddresses.ContainsMatching(aAddress);
+#endif
 }
 
 void Netif::SubscribeAllNodesMulticast(void)
@@ -143,6 +157,10 @@ void Netif::SubscribeAllNodesMulticast(void)
         tail->SetNext(&linkLocalAllNodesAddress);
     }
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -192,6 +210,10 @@ void Netif::UnsubscribeAllNodesMulticast(void)
         prev->SetNext(nullptr);
     }
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -252,6 +274,10 @@ void Netif::SubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllRoutersAddress);
     }
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -298,6 +324,10 @@ void Netif::UnsubscribeAllRoutersMulticast(void)
         prev->SetNext(&linkLocalAllNodesAddress);
     }
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -324,6 +354,10 @@ void Netif::SubscribeMulticast(MulticastAddress &aAddress)
 {
     SuccessOrExit(mMulticastAddresses.Add(aAddress));
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -343,6 +377,10 @@ void Netif::UnsubscribeMulticast(const MulticastAddress &aAddress)
 {
     SuccessOrExit(mMulticastAddresses.Remove(aAddress));
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -384,6 +422,10 @@ Error Netif::SubscribeExternalMulticast(const Address &aAddress)
     entry->mMlrState = kMlrStateToRegister;
 #endif
     mMulticastAddresses.Push(*entry);
+
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
     Get<Notifier>().Signal(kEventIp6MulticastSubscribed);
 
 exit:
@@ -403,6 +445,10 @@ Error Netif::UnsubscribeExternalMulticast(const Address &aAddress)
 
     mMulticastAddresses.PopAfter(prev);
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildMulticastAddressFilter();
+#endif
+
     mExtMulticastAddressPool.Free(static_cast<ExternalMulticastAddress &>(*entry));
 
     Get<Notifier>().Signal(kEventIp6MulticastUnsubscribed);
@@ -436,6 +482,10 @@ void Netif::AddUnicastAddress(UnicastAddress &aAddress)
 {
     SuccessOrExit(mUnicastAddresses.Add(aAddress));
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildUnicastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(aAddress.mRloc ? kEventThreadRlocAdded : kEventIp6AddressAdded);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -455,6 +505,10 @@ void Netif::RemoveUnicastAddress(const UnicastAddress &aAddress)
 {
     SuccessOrExit(mUnicastAddresses.Remove(aAddress));
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildUnicastAddressFilter();
+#endif
+
     Get<Notifier>().Signal(aAddress.mRloc ? kEventThreadRlocRemoved : kEventIp6AddressRemoved);
 
     VerifyOrExit(mAddressCallback != nullptr);
@@ -495,6 +549,10 @@ Error Netif::AddExternalUnicastAddress(const UnicastAddress &aAddress)
 
     *entry = aAddress;
     mUnicastAddresses.Push(*entry);
+
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildUnicastAddressFilter();
+#endif
     Get<Notifier>().Signal(kEventIp6AddressAdded);
 
 exit:
@@ -513,6 +571,10 @@ Error Netif::RemoveExternalUnicastAddress(const Address &aAddress)
     VerifyOrExit(IsUnicastAddressExternal(*entry), error = kErrorInvalidArgs);
 
     mUnicastAddresses.PopAfter(prev);
+
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    RebuildUnicastAddressFilter();
+#endif
     mExtUnicastAddressPool.Free(*entry);
     Get<Notifier>().Signal(kEventIp6AddressRemoved);
 
@@ -537,7 +599,17 @@ void Netif::RemoveAllExternalUnicastAddresses(void)
 
 bool Netif::HasUnicastAddress(const Address &aAddress) const
 {
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    bool contains = false;
+
+    VerifyOrExit((mUnicastAddressFilter & FilterBit(aAddress)) != 0);
+    contains = mUnicastAddresses.ContainsMatching(aAddress);
+
+exit:
+    return contains;
+#else
     return mUnicastAddresses.ContainsMatching(aAddress);
+#endif
 }
 
 bool Netif::IsUnicastAddressExternal(const UnicastAddress &aAddress) const
@@ -545,6 +617,42 @@ bool Netif::IsUnicastAddressExternal(const UnicastAddress &aAddress) const
     return mExtUnicastAddressPool.IsPoolEntry(aAddress);
 }
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+
+uint64_t Netif::FilterBit(const Address &aAddress)
+{
+    uint8_t hash = 0;
+
+    for (uint8_t byte : aAddress.mFields.m8)
+    {
+        hash ^= byte;
+    }
+
+    return static_cast<uint64_t>(1) << (hash & 0x3f);
+}
+
+void Netif::RebuildUnicastAddressFilter(void)
+{
+    mUnicastAddressFilter = 0;
+
+    for (const UnicastAddress *entry = mUnicastAddresses.GetHead(); entry != nullptr; entry = entry->GetNext())
+    {
+        mUnicastAddressFilter |= FilterBit(entry->GetAddress());
+    }
+}
+
+void Netif::RebuildMulticastAddressFilter(void)
+{
+    mMulticastAddressFilter = 0;
+
+    for (const MulticastAddress *entry = mMulticastAddresses.GetHead(); entry != nullptr; entry = entry->GetNext())
+    {
+        mMulticastAddressFilter |= FilterBit(entry->GetAddress());
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+
 //---------------------------------------------------------------------------------------------------------------------
 // Netif::UnicastAddress
 
@@ -610,10 +610,25 @@ protected:
     void UnsubscribeAllNodesMulticast(void);
 
 private:
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    static uint64_t FilterBit(const Address &aAddress);
+
+    void RebuildUnicastAddressFilter(void);
+    void RebuildMulticastAddressFilter(void);
+#endif
+
     LinkedList<UnicastAddress>   mUnicastAddresses;
     LinkedList<MulticastAddress> mMulticastAddresses;
     bool                         mMulticastPromiscuous;
 
+#if OPENTHREAD_CONFIG_IP6_NETIF_ADDRESS_FILTER_ENABLE
+    // Hash bitmaps over the unicast/multicast address lists (rebuilt
+    // on the rare address add/remove) used to quickly reject lookups
+    // of addresses not present on the lists.
+    uint64_t mUnicastAddressFilter;
+    uint64_t mMulticastAddressFilter;
+#endif
+
     otIp6AddressCallback mAddressCallback;
     void *               mAddressCallbackContext;
 
@@ -384,6 +384,20 @@ void Client::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessag
         unixTime += static_cast<uint64_t>(responseHeader.GetTransmitTimestampSeconds()) + (1ULL << 32) - kTimeAt1970;
     }
 
+    // Round to the nearest second using the transmit timestamp fraction
+    // plus half of the locally measured round-trip time (the response is
+    // received one-way delay after the server transmit timestamp).
+    {
+        uint32_t fractionMs =
+            static_cast<uint32_t>((static_cast<uint64_t>(responseHeader.GetTransmitTimestampFraction()) * 1000) >> 32);
+        uint32_t roundTripMs = TimerMilli::GetNow() - (queryMetadata.mTransmissionTime - kResponseTimeout);
+
+        if (fractionMs + (roundTripMs / 2) >= 500)
+        {
+            unixTime++;
+        }
+    }
+
     // Return the time since 1970.
     FinalizeSntpTransaction(*message, queryMetadata, unixTime, kErrorNone);
 
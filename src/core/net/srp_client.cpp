@@ -580,7 +580,12 @@ void Client::SetState(State aState)
         break;
 
     case kStateToUpdate:
+#if OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY != 0
+        mUpdateTxDeadline = TimerMilli::GetNow() + kUpdateTxMaxSettleDelay;
+        mTimer.Start(kUpdateTxSettleDelay);
+#else
         mTimer.Start(kUpdateTxDelay);
+#endif
         break;
 
     case kStateUpdating:
@@ -734,6 +739,10 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
 
     info.Clear();
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+    info.mLeaseRefreshDue = IsLeaseRefreshDue();
+#endif
+
     SuccessOrExit(error = ReadOrGenerateKey(info.mKeyPair));
 
     // Generate random Message ID and ensure it is different from last one
@@ -831,7 +840,15 @@ Error Client::AppendServiceInstructions(Service &aService, Message &aMessage, In
         // early and include it in this update. This helps put more
         // services on the same lease refresh schedule.
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+        // Early renewal piggybacks only on updates that already carry
+        // a lease renewal, so updates triggered solely by service
+        // adds/removes carry just the changed services.
+
+        VerifyOrExit(aInfo.mLeaseRefreshDue && ShouldRenewEarly(aService));
+#else
         VerifyOrExit(ShouldRenewEarly(aService));
+#endif
         aService.SetState(kToRefresh);
     }
 
@@ -1533,6 +1550,24 @@ void Client::UpdateState(void)
 
     if (shouldUpdate)
     {
+#if OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY != 0
+        if (GetState() == kStateToUpdate)
+        {
+            // A new change while already waiting to send: restart the
+            // settle window, bounded by the deadline set by the first
+            // change, so a burst of adds/removes is batched into one
+            // update message.
+
+            TimeMilli fireTime = now + kUpdateTxSettleDelay;
+
+            if (mUpdateTxDeadline < fireTime)
+            {
+                fireTime = mUpdateTxDeadline;
+            }
+
+            mTimer.FireAt(fireTime);
+        }
+#endif
         SetState(kStateToUpdate);
         ExitNow();
     }
@@ -1594,6 +1629,35 @@ bool Client::ShouldRenewEarly(const Service &aService) const
     return shouldRenew;
 }
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+bool Client::IsLeaseRefreshDue(void) const
+{
+    // Determine whether the update being prepared already carries a
+    // lease renewal, i.e., host info or any service is refreshing.
+    // Note that services whose lease renew time is reached are moved
+    // to `kToRefresh` in `UpdateState()` before the update message is
+    // prepared.
+
+    bool isDue = false;
+
+    if ((mHostInfo.GetState() == kToRefresh) || (mHostInfo.GetState() == kRefreshing))
+    {
+        ExitNow(isDue = true);
+    }
+
+    for (const Service &service : mServices)
+    {
+        if ((service.GetState() == kToRefresh) || (service.GetState() == kRefreshing))
+        {
+            ExitNow(isDue = true);
+        }
+    }
+
+exit:
+    return isDue;
+}
+#endif // OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+
 void Client::HandleTimer(Timer &aTimer)
 {
     aTimer.Get<Client>().HandleTimer();
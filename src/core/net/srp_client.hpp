@@ -714,6 +714,16 @@ private:
     // that are then all sent in same update message.
     static constexpr uint32_t kUpdateTxDelay = OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_DELAY; // in msec.
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY != 0
+    // When the settle window is enabled, every additional change
+    // while waiting to send restarts the wait timer with
+    // `kUpdateTxSettleDelay`, batching a burst of service
+    // adds/removes into one update message. The total delay from
+    // the first change is bounded by `kUpdateTxMaxSettleDelay`.
+    static constexpr uint32_t kUpdateTxSettleDelay    = OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY;
+    static constexpr uint32_t kUpdateTxMaxSettleDelay = OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_MAX_SETTLE_DELAY;
+#endif
+
     // -------------------------------
     // Retry related constants
     //
@@ -797,6 +807,9 @@ private:
         uint16_t                     mHostNameOffset;   // Offset of host name serialization.
         uint16_t                     mRecordCount;      // Number of resource records in Update section.
         Crypto::Ecdsa::P256::KeyPair mKeyPair;          // The ECDSA key pair.
+#if OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+        bool mLeaseRefreshDue; // Whether the update already carries a lease renewal.
+#endif
     };
 
     Error        Start(const Ip6::SockAddr &aServerSockAddr, Requester aRequester);
@@ -835,6 +848,9 @@ private:
     void         GrowRetryWaitInterval(void);
     uint32_t     GetBoundedLeaseInterval(uint32_t aInterval, uint32_t aDefaultInterval) const;
     bool         ShouldRenewEarly(const Service &aService) const;
+#if OPENTHREAD_CONFIG_SRP_CLIENT_SERVICE_DIFF_UPDATE_ENABLE
+    bool IsLeaseRefreshDue(void) const;
+#endif
     static void  HandleTimer(Timer &aTimer);
     void         HandleTimer(void);
 #if OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE
@@ -871,6 +887,9 @@ private:
     uint32_t mRetryWaitInterval;
 
     TimeMilli mLeaseRenewTime;
+#if OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_SETTLE_DELAY != 0
+    TimeMilli mUpdateTxDeadline;
+#endif
     uint32_t  mAcceptedLeaseInterval;
     uint32_t  mLeaseInterval;
     uint32_t  mKeyLeaseInterval;
@@ -40,6 +40,7 @@
 #include "common/locator_getters.hpp"
 #include "common/logging.hpp"
 #include "common/new.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/random.hpp"
 #include "net/dns_types.hpp"
 #include "thread/thread_netif.hpp"
@@ -86,6 +87,10 @@ Server::Server(Instance &aInstance)
     , mServiceUpdateHandlerContext(nullptr)
     , mLeaseTimer(aInstance, HandleLeaseTimer)
     , mOutstandingUpdatesTimer(aInstance, HandleOutstandingUpdatesTimer)
+    , mQueuedUpdatesTasklet(aInstance, HandleQueuedUpdates)
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    , mPersistTasklet(aInstance, HandlePersistTasklet)
+#endif
     , mServiceUpdateId(Random::NonCrypto::GetUint32())
     , mPort(kUdpPortMin)
     , mState(kStateDisabled)
@@ -295,6 +300,10 @@ void Server::RemoveHost(Host *aHost, bool aRetainName, bool aNotifyServiceHandle
         aHost->Free();
     }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+    Get<Dns::ServiceDiscovery::Server>().InvalidateBrowseCache();
+#endif
+
 exit:
     return;
 }
@@ -435,6 +444,15 @@ void Server::CommitSrpUpdate(Error                    aError,
 #endif
     }
 
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_DNSSD_SERVER_BROWSE_CACHE_ENABLE
+    Get<Dns::ServiceDiscovery::Server>().InvalidateBrowseCache();
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Lazily re-write the persisted registry to reflect this update.
+    SchedulePersist();
+#endif
+
     // Re-schedule the lease timer.
     HandleLeaseTimer();
 
@@ -481,6 +499,9 @@ void Server::Start(void)
     VerifyOrExit(mState == kStateStopped);
 
     mState = kStateRunning;
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    RestoreRegistry();
+#endif
     PrepareSocket();
     otLogInfoSrp("[server] start listening on port %u", mPort);
 
@@ -560,7 +581,7 @@ Error Server::HandleDnssdServerUdpReceive(Message &aMessage, const Ip6::MessageI
 
     VerifyOrExit((mState == kStateRunning) && !mSocket.IsOpen());
 
-    error = ProcessMessage(aMessage, aMessageInfo);
+    error = EnqueueUpdateMessage(aMessage, aMessageInfo);
 
 exit:
     return error;
@@ -586,6 +607,8 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+    mQueuedUpdates.DequeueAndFreeAll();
+
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -963,11 +986,11 @@ Error Server::ProcessServiceDescriptionInstructions(Host &                   aHo
     {
         VerifyOrExit(desc.mTimeLastUpdate == now, error = kErrorFailed);
 
-        // Check that either both `mPort` and `mTxtData` are set
+        // Check that either both `mPort` and `mTxtBlob` are set
         // (i.e., we saw both SRV and TXT record) or both are default
         // (cleared) value (i.e., we saw neither of them).
 
-        VerifyOrExit((desc.mPort == 0) == (desc.mTxtData == nullptr), error = kErrorFailed);
+        VerifyOrExit((desc.mPort == 0) == (desc.mTxtBlob == nullptr), error = kErrorFailed);
     }
 
 exit:
@@ -1246,7 +1269,7 @@ void Server::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessa
 
 void Server::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    Error error = ProcessMessage(aMessage, aMessageInfo);
+    Error error = EnqueueUpdateMessage(aMessage, aMessageInfo);
 
     if (error != kErrorNone)
     {
@@ -1254,6 +1277,102 @@ void Server::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessag
     }
 }
 
+Error Server::EnqueueUpdateMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    // Received updates are queued and processed one at a time from a
+    // tasklet, so the per-update ECDSA signature verification is spread
+    // across main-loop iterations instead of freezing the receive path
+    // when a registration storm (e.g., after a BR reboot) arrives.
+
+    Error             error       = kErrorNone;
+    Message *         messageCopy = nullptr;
+    Dns::UpdateHeader dnsHeader;
+    uint16_t          numQueued     = 0;
+    uint16_t          numFromClient = 0;
+
+    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), dnsHeader));
+    VerifyOrExit(dnsHeader.GetType() == Dns::UpdateHeader::Type::kTypeQuery, error = kErrorDrop);
+    VerifyOrExit(dnsHeader.GetQueryType() == Dns::UpdateHeader::kQueryTypeUpdate, error = kErrorDrop);
+
+    for (const Message *message = mQueuedUpdates.GetHead(); message != nullptr; message = message->GetNext())
+    {
+        Ip6::MessageInfo messageInfo;
+
+        IgnoreError(message->Read(message->GetLength() - sizeof(messageInfo), messageInfo));
+
+        numQueued++;
+
+        if (messageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr())
+        {
+            numFromClient++;
+        }
+    }
+
+    // Rate limit: silently drop the message when the queue is full or the
+    // client already has its share of updates queued (the client
+    // retransmits). The message still counts as consumed by the server.
+    if ((numQueued >= kMaxQueuedUpdates) || (numFromClient >= kMaxQueuedUpdatesPerClient))
+    {
+        otLogInfoSrp("[server] drop SRP update from %s (queue limit)",
+                     aMessageInfo.GetPeerAddr().ToString().AsCString());
+        ExitNow();
+    }
+
+    messageCopy = aMessage.Clone();
+    VerifyOrExit(messageCopy != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = messageCopy->Append(aMessageInfo));
+
+    mQueuedUpdates.Enqueue(*messageCopy);
+    messageCopy = nullptr;
+    mQueuedUpdatesTasklet.Post();
+
+exit:
+    FreeMessage(messageCopy);
+    return error;
+}
+
+void Server::HandleQueuedUpdates(Tasklet &aTasklet)
+{
+    aTasklet.Get<Server>().HandleQueuedUpdates();
+}
+
+void Server::HandleQueuedUpdates(void)
+{
+    Message *        message = mQueuedUpdates.GetHead();
+    Ip6::MessageInfo messageInfo;
+    Error            error;
+
+    VerifyOrExit(message != nullptr);
+
+    mQueuedUpdates.Dequeue(*message);
+
+    IgnoreError(message->Read(message->GetLength() - sizeof(messageInfo), messageInfo));
+    IgnoreError(message->SetLength(message->GetLength() - sizeof(messageInfo)));
+
+    if (mState == kStateRunning)
+    {
+        error = ProcessMessage(*message, messageInfo);
+
+        if (error != kErrorNone)
+        {
+            otLogInfoSrp("[server] failed to handle DNS message: %s", ErrorToString(error));
+        }
+    }
+
+    message->Free();
+
+    // Process one queued update per tasklet invocation so that other
+    // pending tasklets (e.g., mesh forwarding) run in between.
+    if (mQueuedUpdates.GetHead() != nullptr)
+    {
+        mQueuedUpdatesTasklet.Post();
+    }
+
+exit:
+    return;
+}
+
 Error Server::ProcessMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Error             error;
@@ -1397,6 +1516,12 @@ void Server::HandleLeaseTimer(void)
         otLogInfoSrp("[server] lease timer is stopped");
         mLeaseTimer.Stop();
     }
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    // Re-write the persisted registry so that removed records and the
+    // remaining lease times stay in sync with RAM state.
+    SchedulePersist();
+#endif
 }
 
 void Server::HandleOutstandingUpdatesTimer(Timer &aTimer)
@@ -1426,6 +1551,394 @@ const char *Server::AddressModeToString(AddressMode aMode)
     return kAddressModeStrings[aMode];
 }
 
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+static uint32_t RemainingLease(TimeMilli aExpireTime, TimeMilli aNow)
+{
+    return (aExpireTime > aNow) ? Time::MsecToSec(aExpireTime - aNow) : 0;
+}
+
+void Server::SchedulePersist(void)
+{
+    mPersistTasklet.Post();
+}
+
+void Server::HandlePersistTasklet(Tasklet &aTasklet)
+{
+    aTasklet.Get<Server>().PersistRegistry();
+}
+
+void Server::PersistRegistry(void)
+{
+    VerifyOrExit(mState == kStateRunning);
+
+    IgnoreError(Get<Settings>().DeleteAllSrpServerHosts());
+
+    for (const Host &host : mHosts)
+    {
+        if (PersistHost(host) != kErrorNone)
+        {
+            otLogWarnSrp("[server] failed to persist host %s", host.GetFullName());
+        }
+    }
+
+exit:
+    return;
+}
+
+Error Server::PersistHost(const Host &aHost)
+{
+    Error               error = kErrorNone;
+    uint8_t             buffer[kPersistBufferSize];
+    uint16_t            offset  = 0;
+    TimeMilli           now     = TimerMilli::GetNow();
+    uint8_t             version = kPersistFormatVersion;
+    uint32_t            lease   = aHost.IsDeleted() ? 0 : RemainingLease(aHost.GetExpireTime(), now);
+    uint32_t            keyLease;
+    uint8_t             addressesNum;
+    const Ip6::Address *addresses = aHost.GetAddresses(addressesNum);
+    uint16_t            numServices = 0;
+    uint8_t             numServices8;
+
+    keyLease = RemainingLease(aHost.GetKeyExpireTime(), now);
+    VerifyOrExit(keyLease > 0, error = kErrorInvalidState);
+
+    SuccessOrExit(error = PersistWrite(buffer, offset, &version, sizeof(version)));
+    SuccessOrExit(error = PersistWrite(buffer, offset, &lease, sizeof(lease)));
+    SuccessOrExit(error = PersistWrite(buffer, offset, &keyLease, sizeof(keyLease)));
+    SuccessOrExit(error = PersistWrite(buffer, offset, &aHost.mKey, sizeof(aHost.mKey)));
+    SuccessOrExit(error = PersistWrite(buffer, offset, &addressesNum, sizeof(addressesNum)));
+    SuccessOrExit(error = PersistWrite(buffer, offset, addresses, addressesNum * sizeof(Ip6::Address)));
+    SuccessOrExit(error = PersistWriteString(buffer, offset, aHost.GetFullName()));
+
+    for (const Service &service : aHost.mServices)
+    {
+        OT_UNUSED_VARIABLE(service);
+        numServices++;
+    }
+
+    VerifyOrExit(numServices <= NumericLimits<uint8_t>::kMax, error = kErrorNoBufs);
+    numServices8 = static_cast<uint8_t>(numServices);
+    SuccessOrExit(error = PersistWrite(buffer, offset, &numServices8, sizeof(numServices8)));
+
+    for (const Service &service : aHost.mServices)
+    {
+        const Service::Description &desc  = service.mDescription;
+        uint8_t                     flags = 0;
+        uint16_t                    txtLength;
+        uint32_t                    svcLease;
+        uint32_t                    svcKeyLease;
+
+        if (service.mIsDeleted)
+        {
+            flags |= kPersistServiceFlagDeleted;
+        }
+
+        if (service.mIsSubType)
+        {
+            flags |= kPersistServiceFlagSubType;
+        }
+
+        svcLease    = service.mIsDeleted ? 0 : RemainingLease(desc.mTimeLastUpdate + Time::SecToMsec(desc.mLease), now);
+        svcKeyLease = RemainingLease(desc.mTimeLastUpdate + Time::SecToMsec(desc.mKeyLease), now);
+
+        SuccessOrExit(error = PersistWrite(buffer, offset, &flags, sizeof(flags)));
+        SuccessOrExit(error = PersistWrite(buffer, offset, &desc.mPort, sizeof(desc.mPort)));
+        SuccessOrExit(error = PersistWrite(buffer, offset, &desc.mPriority, sizeof(desc.mPriority)));
+        SuccessOrExit(error = PersistWrite(buffer, offset, &desc.mWeight, sizeof(desc.mWeight)));
+        txtLength = desc.GetTxtDataLength();
+        SuccessOrExit(error = PersistWrite(buffer, offset, &txtLength, sizeof(txtLength)));
+        SuccessOrExit(error = PersistWrite(buffer, offset, desc.GetTxtData(), txtLength));
+        SuccessOrExit(error = PersistWrite(buffer, offset, &svcLease, sizeof(svcLease)));
+        SuccessOrExit(error = PersistWrite(buffer, offset, &svcKeyLease, sizeof(svcKeyLease)));
+        SuccessOrExit(error = PersistWriteString(buffer, offset, service.GetServiceName()));
+        SuccessOrExit(error = PersistWriteString(buffer, offset, service.GetInstanceName()));
+    }
+
+    error = Get<Settings>().AddSrpServerHost(buffer, offset);
+
+exit:
+    return error;
+}
+
+void Server::RestoreRegistry(void)
+{
+    uint16_t numRestored = 0;
+    uint8_t  buffer[kPersistBufferSize];
+
+    for (int index = 0;; index++)
+    {
+        uint16_t length = sizeof(buffer);
+
+        if (Get<Settings>().ReadSrpServerHost(index, buffer, length) != kErrorNone)
+        {
+            break;
+        }
+
+        if ((length <= sizeof(buffer)) && (RestoreHost(buffer, length) == kErrorNone))
+        {
+            numRestored++;
+        }
+        else
+        {
+            otLogWarnSrp("[server] discarding malformed persisted host record");
+        }
+    }
+
+    if (numRestored > 0)
+    {
+        otLogInfoSrp("[server] restored %u persisted host(s)", numRestored);
+
+        // Schedules lease expiry for the restored records.
+        HandleLeaseTimer();
+    }
+}
+
+Error Server::RestoreHost(const uint8_t *aData, uint16_t aLength)
+{
+    Error                  error  = kErrorNone;
+    uint16_t               offset = 0;
+    TimeMilli              now    = TimerMilli::GetNow();
+    uint8_t                version;
+    uint32_t               lease;
+    uint32_t               keyLease;
+    Dns::Ecdsa256KeyRecord key;
+    uint8_t                addressesNum;
+    uint8_t                numServices;
+    const char *           name;
+    Host *                 host = nullptr;
+
+    SuccessOrExit(error = PersistRead(aData, aLength, offset, &version, sizeof(version)));
+    VerifyOrExit(version == kPersistFormatVersion, error = kErrorParse);
+    SuccessOrExit(error = PersistRead(aData, aLength, offset, &lease, sizeof(lease)));
+    SuccessOrExit(error = PersistRead(aData, aLength, offset, &keyLease, sizeof(keyLease)));
+    SuccessOrExit(error = PersistRead(aData, aLength, offset, &key, sizeof(key)));
+    VerifyOrExit(key.IsValid() && (keyLease > 0), error = kErrorParse);
+
+    VerifyOrExit((host = Host::New(GetInstance())) != nullptr, error = kErrorNoBufs);
+
+    SuccessOrExit(error = PersistRead(aData, aLength, offset, &addressesNum, sizeof(addressesNum)));
+    VerifyOrExit(addressesNum <= Host::kMaxAddressesNum, error = kErrorParse);
+
+    for (uint8_t i = 0; i < addressesNum; i++)
+    {
+        Ip6::Address address;
+
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &address, sizeof(address)));
+        IgnoreError(host->AddIp6Address(address));
+    }
+
+    SuccessOrExit(error = PersistReadString(aData, aLength, offset, name));
+    VerifyOrExit(mHosts.FindMatching(name) == nullptr, error = kErrorDuplicated);
+    SuccessOrExit(error = host->SetFullName(name));
+
+    host->SetKey(key);
+    host->SetLease(lease);
+    host->SetKeyLease(keyLease);
+    host->mTimeLastUpdate = now;
+
+    SuccessOrExit(error = PersistRead(aData, aLength, offset, &numServices, sizeof(numServices)));
+
+    for (uint8_t i = 0; i < numServices; i++)
+    {
+        uint8_t        flags;
+        uint16_t       port;
+        uint16_t       priority;
+        uint16_t       weight;
+        uint16_t       txtLength;
+        uint32_t       svcLease;
+        uint32_t       svcKeyLease;
+        const uint8_t *txtData = nullptr;
+        const char *   serviceName;
+        const char *   instanceName;
+        Service *      service;
+
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &flags, sizeof(flags)));
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &port, sizeof(port)));
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &priority, sizeof(priority)));
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &weight, sizeof(weight)));
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &txtLength, sizeof(txtLength)));
+
+        if (txtLength > 0)
+        {
+            VerifyOrExit(txtLength <= aLength - offset, error = kErrorParse);
+            txtData = aData + offset;
+            offset += txtLength;
+        }
+
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &svcLease, sizeof(svcLease)));
+        SuccessOrExit(error = PersistRead(aData, aLength, offset, &svcKeyLease, sizeof(svcKeyLease)));
+        SuccessOrExit(error = PersistReadString(aData, aLength, offset, serviceName));
+        SuccessOrExit(error = PersistReadString(aData, aLength, offset, instanceName));
+
+        service = host->AddNewService(serviceName, instanceName, (flags & kPersistServiceFlagSubType) != 0);
+        VerifyOrExit(service != nullptr, error = kErrorNoBufs);
+
+        service->mIsDeleted      = ((flags & kPersistServiceFlagDeleted) != 0);
+        service->mIsCommitted    = true;
+        service->mTimeLastUpdate = now;
+
+        service->mDescription.mPort           = port;
+        service->mDescription.mPriority       = priority;
+        service->mDescription.mWeight         = weight;
+        service->mDescription.mLease          = svcLease;
+        service->mDescription.mKeyLease       = svcKeyLease;
+        service->mDescription.mTimeLastUpdate = now;
+
+        if ((txtLength > 0) && (service->mDescription.mTxtBlob == nullptr))
+        {
+            service->mDescription.mTxtBlob = AcquireTxtBlob(txtData, txtLength);
+            VerifyOrExit(service->mDescription.mTxtBlob != nullptr, error = kErrorNoBufs);
+        }
+    }
+
+    otLogInfoSrp("[server] restored host %s", host->GetFullName());
+    AddHost(*host);
+    host = nullptr;
+
+exit:
+    if (host != nullptr)
+    {
+        host->Free();
+    }
+
+    return error;
+}
+
+Error Server::PersistWrite(uint8_t *aBuffer, uint16_t &aOffset, const void *aData, uint16_t aSize)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aSize != 0);
+    VerifyOrExit(aSize <= kPersistBufferSize - aOffset, error = kErrorNoBufs);
+    memcpy(aBuffer + aOffset, aData, aSize);
+    aOffset += aSize;
+
+exit:
+    return error;
+}
+
+Error Server::PersistWriteString(uint8_t *aBuffer, uint16_t &aOffset, const char *aString)
+{
+    return PersistWrite(aBuffer, aOffset, aString,
+                        static_cast<uint16_t>(StringLength(aString, kPersistBufferSize) + 1));
+}
+
+Error Server::PersistRead(const uint8_t *aBuffer, uint16_t aLength, uint16_t &aOffset, void *aData, uint16_t aSize)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(aSize <= aLength - aOffset, error = kErrorParse);
+    memcpy(aData, aBuffer + aOffset, aSize);
+    aOffset += aSize;
+
+exit:
+    return error;
+}
+
+Error Server::PersistReadString(const uint8_t *aBuffer, uint16_t aLength, uint16_t &aOffset, const char *&aString)
+{
+    Error error = kErrorParse;
+
+    for (uint16_t i = aOffset; i < aLength; i++)
+    {
+        if (aBuffer[i] == '\0')
+        {
+            aString = reinterpret_cast<const char *>(aBuffer + aOffset);
+            aOffset = i + 1;
+            error   = kErrorNone;
+            break;
+        }
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+
+Server::TxtBlob *Server::AcquireTxtBlob(const uint8_t *aData, uint16_t aLength)
+{
+    TxtBlob *blob = nullptr;
+
+    VerifyOrExit(aLength > 0);
+
+    for (TxtBlob &entry : mTxtBlobs)
+    {
+        if ((entry.mLength == aLength) && (memcmp(entry.GetData(), aData, aLength) == 0))
+        {
+            entry.mRefCount++;
+            ExitNow(blob = &entry);
+        }
+    }
+
+    blob = static_cast<TxtBlob *>(Instance::HeapCAlloc(1, sizeof(TxtBlob) + aLength));
+    VerifyOrExit(blob != nullptr);
+
+    blob->mRefCount = 1;
+    blob->mLength   = aLength;
+    memcpy(blob->GetData(), aData, aLength);
+    mTxtBlobs.Push(*blob);
+
+exit:
+    return blob;
+}
+
+Error Server::AcquireTxtBlobFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength, TxtBlob *&aTxtBlob)
+{
+    Error    error = kErrorNone;
+    TxtBlob *blob  = nullptr;
+
+    VerifyOrExit(aLength > 0, error = kErrorParse);
+
+    for (TxtBlob &entry : mTxtBlobs)
+    {
+        // Entries already in the store were verified when first added,
+        // so a byte-for-byte match needs no re-validation.
+
+        if ((entry.mLength == aLength) && aMessage.CompareBytes(aOffset, entry.GetData(), aLength))
+        {
+            entry.mRefCount++;
+            ExitNow(aTxtBlob = &entry);
+        }
+    }
+
+    blob = static_cast<TxtBlob *>(Instance::HeapCAlloc(1, sizeof(TxtBlob) + aLength));
+    VerifyOrExit(blob != nullptr, error = kErrorNoBufs);
+
+    VerifyOrExit(aMessage.ReadBytes(aOffset, blob->GetData(), aLength) == aLength, error = kErrorParse);
+    VerifyOrExit(Dns::TxtRecord::VerifyTxtData(blob->GetData(), aLength, /* aAllowEmpty */ false),
+                 error = kErrorParse);
+
+    blob->mRefCount = 1;
+    blob->mLength   = aLength;
+    mTxtBlobs.Push(*blob);
+    aTxtBlob = blob;
+    blob     = nullptr;
+
+exit:
+    Instance::HeapFree(blob);
+    return error;
+}
+
+void Server::ReleaseTxtBlob(TxtBlob *&aTxtBlob)
+{
+    TxtBlob *blob = aTxtBlob;
+
+    VerifyOrExit(blob != nullptr);
+
+    aTxtBlob = nullptr;
+
+    blob->mRefCount--;
+    VerifyOrExit(blob->mRefCount == 0);
+
+    IgnoreError(mTxtBlobs.Remove(*blob));
+    Instance::HeapFree(blob);
+
+exit:
+    return;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::Service
 
@@ -1434,7 +1947,11 @@ Server::Service *Server::Service::New(const char *aServiceName, Description &aDe
     void *   buf;
     Service *service = nullptr;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    buf = aDescription.mHost.GetInstance().Get<Server>().mServicePool.Allocate();
+#else
     buf = Instance::HeapCAlloc(1, sizeof(Service));
+#endif
     VerifyOrExit(buf != nullptr);
 
     service = new (buf) Service(aDescription, aIsSubType);
@@ -1451,7 +1968,11 @@ exit:
 
 void Server::Service::Free(void)
 {
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    mDescription.mHost.GetInstance().Get<Server>().mServicePool.Free(this);
+#else
     Instance::HeapFree(this);
+#endif
 }
 
 Server::Service::Service(Description &aDescription, bool aIsSubType)
@@ -1583,7 +2104,11 @@ Server::Service::Description *Server::Service::Description::New(const char *aIns
     void *       buf;
     Description *desc = nullptr;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    buf = aHost.GetInstance().Get<Server>().mDescriptionPool.Allocate();
+#else
     buf = Instance::HeapCAlloc(1, sizeof(Description));
+#endif
     VerifyOrExit(buf != nullptr);
 
     desc = new (buf) Description(aHost);
@@ -1600,8 +2125,13 @@ exit:
 
 void Server::Service::Description::Free(void)
 {
+    mHost.GetInstance().Get<Server>().ReleaseTxtBlob(mTxtBlob);
     mInstanceName.Free();
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    mHost.GetInstance().Get<Server>().mDescriptionPool.Free(this);
+#else
     Instance::HeapFree(this);
+#endif
 }
 
 Server::Service::Description::Description(Host &aHost)
@@ -1610,8 +2140,7 @@ Server::Service::Description::Description(Host &aHost)
     , mPriority(0)
     , mWeight(0)
     , mPort(0)
-    , mTxtLength(0)
-    , mTxtData(nullptr)
+    , mTxtBlob(nullptr)
     , mLease(0)
     , mKeyLease(0)
     , mTimeLastUpdate(TimerMilli::GetNow().GetDistantPast())
@@ -1621,20 +2150,16 @@ Server::Service::Description::Description(Host &aHost)
 void Server::Service::Description::ClearResources(void)
 {
     mPort = 0;
-    Instance::HeapFree(mTxtData);
-    mTxtData   = nullptr;
-    mTxtLength = 0;
+    mHost.GetInstance().Get<Server>().ReleaseTxtBlob(mTxtBlob);
 }
 
 void Server::Service::Description::TakeResourcesFrom(Description &aDescription)
 {
-    // Take ownership and move the heap allocated `mTxtData` buffer
-    // from `aDescription
-    Instance::HeapFree(mTxtData);
-    mTxtData                = aDescription.mTxtData;
-    mTxtLength              = aDescription.mTxtLength;
-    aDescription.mTxtData   = nullptr;
-    aDescription.mTxtLength = 0;
+    // Take over the reference to the shared TXT data blob from
+    // `aDescription` (no refcount change).
+    mHost.GetInstance().Get<Server>().ReleaseTxtBlob(mTxtBlob);
+    mTxtBlob              = aDescription.mTxtBlob;
+    aDescription.mTxtBlob = nullptr;
 
     mPriority = aDescription.mPriority;
     mWeight   = aDescription.mWeight;
@@ -1647,25 +2172,16 @@ void Server::Service::Description::TakeResourcesFrom(Description &aDescription)
 
 Error Server::Service::Description::SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
 {
-    Error    error = kErrorNone;
-    uint8_t *txtData;
+    Error    error  = kErrorNone;
+    Server & server = mHost.GetInstance().Get<Server>();
+    TxtBlob *txtBlob;
 
-    txtData = static_cast<uint8_t *>(Instance::HeapCAlloc(1, aLength));
-    VerifyOrExit(txtData != nullptr, error = kErrorNoBufs);
+    SuccessOrExit(error = server.AcquireTxtBlobFromMessage(aMessage, aOffset, aLength, txtBlob));
 
-    VerifyOrExit(aMessage.ReadBytes(aOffset, txtData, aLength) == aLength, error = kErrorParse);
-    VerifyOrExit(Dns::TxtRecord::VerifyTxtData(txtData, aLength, /* aAllowEmpty */ false), error = kErrorParse);
-
-    Instance::HeapFree(mTxtData);
-    mTxtData   = txtData;
-    mTxtLength = aLength;
+    server.ReleaseTxtBlob(mTxtBlob);
+    mTxtBlob = txtBlob;
 
 exit:
-    if (error != kErrorNone)
-    {
-        Instance::HeapFree(txtData);
-    }
-
     return error;
 }
 
@@ -1677,7 +2193,11 @@ Server::Host *Server::Host::New(Instance &aInstance)
     void *buf;
     Host *host = nullptr;
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    buf = aInstance.Get<Server>().mHostPool.Allocate();
+#else
     buf = Instance::HeapCAlloc(1, sizeof(Host));
+#endif
     VerifyOrExit(buf != nullptr);
 
     host = new (buf) Host(aInstance);
@@ -1690,7 +2210,11 @@ void Server::Host::Free(void)
 {
     FreeAllServices();
     mFullName.Free();
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    GetInstance().Get<Server>().mHostPool.Free(this);
+#else
     Instance::HeapFree(this);
+#endif
 }
 
 Server::Host::Host(Instance &aInstance)
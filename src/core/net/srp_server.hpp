@@ -59,6 +59,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
 #include "net/dns_types.hpp"
@@ -89,6 +90,8 @@ class Server : public InstanceLocator, private NonCopyable
     friend class Host;
     friend class Dns::ServiceDiscovery::Server;
 
+    class TxtBlob;
+
 public:
     static constexpr uint16_t kUdpPortMin = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MIN; ///< The reserved min port.
     static constexpr uint16_t kUdpPortMax = OPENTHREAD_CONFIG_SRP_SERVER_UDP_PORT_MAX; ///< The reserved max port.
@@ -253,7 +256,7 @@ public:
          * @returns A pointer to the buffer containing the TXT record data.
          *
          */
-        const uint8_t *GetTxtData(void) const { return mDescription.mTxtData; }
+        const uint8_t *GetTxtData(void) const { return mDescription.GetTxtData(); }
 
         /**
          * This method returns the TXT record data length of the service instance.
@@ -261,7 +264,7 @@ public:
          * @return The TXT record data length (number of bytes in buffer returned from `GetTxtData()`).
          *
          */
-        uint16_t GetTxtDataLength(void) const { return mDescription.mTxtLength; }
+        uint16_t GetTxtDataLength(void) const { return mDescription.GetTxtDataLength(); }
 
         /**
          * This method returns the host which the service instance reside on.
@@ -325,14 +328,16 @@ public:
             void        TakeResourcesFrom(Description &aDescription);
             Error       SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
 
+            const uint8_t *GetTxtData(void) const { return (mTxtBlob != nullptr) ? mTxtBlob->GetData() : nullptr; }
+            uint16_t       GetTxtDataLength(void) const { return (mTxtBlob != nullptr) ? mTxtBlob->GetLength() : 0; }
+
             Description *mNext;
             HeapString   mInstanceName;
             Host &       mHost;
             uint16_t     mPriority;
             uint16_t     mWeight;
             uint16_t     mPort;
-            uint16_t     mTxtLength;
-            uint8_t *    mTxtData;
+            TxtBlob *    mTxtBlob;
             uint32_t     mLease;    // The LEASE time in seconds.
             uint32_t     mKeyLease; // The KEY-LEASE time in seconds.
             TimeMilli    mTimeLastUpdate;
@@ -741,6 +746,9 @@ private:
 
     static constexpr uint16_t kAnycastAddressModePort = 53;
 
+    static constexpr uint16_t kMaxQueuedUpdates          = OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES;
+    static constexpr uint16_t kMaxQueuedUpdatesPerClient = OPENTHREAD_CONFIG_SRP_SERVER_MAX_QUEUED_UPDATES_PER_CLIENT;
+
     // This class includes metadata for processing a SRP update (register, deregister)
     // and sending DNS response to the client.
     class UpdateMetadata : public InstanceLocator, public LinkedListEntry<UpdateMetadata>
@@ -774,6 +782,84 @@ private:
         UpdateMetadata *  mNext;
     };
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    // This class provides a fixed-size pool of raw blocks used in place of the heap for a record
+    // type (`Host`, `Service`, or `Service::Description`). Unlike `Pool<>` from "common/pool.hpp"
+    // it hands out uninitialized storage, since the record types are constructed with placement
+    // new and are not default-constructible. Allocated blocks are zeroed to match the behavior of
+    // `Instance::HeapCAlloc()`.
+    template <typename ObjectType, uint16_t kCapacity> class ObjectPool : private NonCopyable
+    {
+    public:
+        ObjectPool(void)
+            : mFreeList(nullptr)
+        {
+            for (Block &block : mBlocks)
+            {
+                block.mNext = mFreeList;
+                mFreeList   = &block;
+            }
+        }
+
+        void *Allocate(void)
+        {
+            Block *block = mFreeList;
+
+            if (block != nullptr)
+            {
+                mFreeList = block->mNext;
+                memset(block, 0, sizeof(Block));
+            }
+
+            return block;
+        }
+
+        void Free(void *aObject)
+        {
+            Block *block = reinterpret_cast<Block *>(aObject);
+
+            block->mNext = mFreeList;
+            mFreeList    = block;
+        }
+
+    private:
+        union Block
+        {
+            Block *  mNext;
+            uint8_t  mStorage[sizeof(ObjectType)];
+            uint64_t mAlign;
+        };
+
+        Block  mBlocks[kCapacity];
+        Block *mFreeList;
+    };
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+
+    // This class represents a refcounted, immutable TXT record data blob shared between service
+    // descriptions (and read in place by the DNS-SD server when emitting answers). The TXT bytes
+    // are stored in the same heap block immediately after the header, so a given TXT data value
+    // is stored once regardless of how many services or update generations reference it.
+    class TxtBlob : public LinkedListEntry<TxtBlob>
+    {
+        friend class Server;
+        friend class LinkedList<TxtBlob>;
+        friend class LinkedListEntry<TxtBlob>;
+
+    public:
+        const uint8_t *GetData(void) const { return reinterpret_cast<const uint8_t *>(this + 1); }
+        uint8_t *      GetData(void) { return reinterpret_cast<uint8_t *>(this + 1); }
+        uint16_t       GetLength(void) const { return mLength; }
+
+    private:
+        TxtBlob *mNext;
+        uint16_t mRefCount;
+        uint16_t mLength;
+    };
+
+    TxtBlob *AcquireTxtBlob(const uint8_t *aData, uint16_t aLength);
+    Error    AcquireTxtBlobFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength, TxtBlob *&aTxtBlob);
+    void     ReleaseTxtBlob(TxtBlob *&aTxtBlob);
+
     void              Start(void);
     void              Stop(void);
     void              SelectPort(void);
@@ -849,6 +935,9 @@ private:
                              const Ip6::MessageInfo & aMessageInfo);
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    Error       EnqueueUpdateMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    static void HandleQueuedUpdates(Tasklet &aTasklet);
+    void        HandleQueuedUpdates(void);
     static void HandleLeaseTimer(Timer &aTimer);
     void        HandleLeaseTimer(void);
     static void HandleOutstandingUpdatesTimer(Timer &aTimer);
@@ -858,6 +947,25 @@ private:
     const UpdateMetadata *FindOutstandingUpdate(const Ip6::MessageInfo &aMessageInfo, uint16_t aDnsMessageId);
     static const char *   AddressModeToString(AddressMode aMode);
 
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    static constexpr uint16_t kPersistBufferSize    = OPENTHREAD_CONFIG_SRP_SERVER_PERSIST_BUFFER_SIZE;
+    static constexpr uint8_t  kPersistFormatVersion = 1;
+
+    static constexpr uint8_t kPersistServiceFlagDeleted = 1 << 0;
+    static constexpr uint8_t kPersistServiceFlagSubType = 1 << 1;
+
+    void         SchedulePersist(void);
+    static void  HandlePersistTasklet(Tasklet &aTasklet);
+    void         PersistRegistry(void);
+    Error        PersistHost(const Host &aHost);
+    void         RestoreRegistry(void);
+    Error        RestoreHost(const uint8_t *aData, uint16_t aLength);
+    static Error PersistWrite(uint8_t *aBuffer, uint16_t &aOffset, const void *aData, uint16_t aSize);
+    static Error PersistWriteString(uint8_t *aBuffer, uint16_t &aOffset, const char *aString);
+    static Error PersistRead(const uint8_t *aBuffer, uint16_t aLength, uint16_t &aOffset, void *aData, uint16_t aSize);
+    static Error PersistReadString(const uint8_t *aBuffer, uint16_t aLength, uint16_t &aOffset, const char *&aString);
+#endif
+
     Ip6::Udp::Socket                mSocket;
     otSrpServerServiceUpdateHandler mServiceUpdateHandler;
     void *                          mServiceUpdateHandlerContext;
@@ -866,12 +974,26 @@ private:
 
     LeaseConfig mLeaseConfig;
 
-    LinkedList<Host> mHosts;
-    TimerMilli       mLeaseTimer;
+    LinkedList<Host>    mHosts;
+    LinkedList<TxtBlob> mTxtBlobs;
+    TimerMilli          mLeaseTimer;
 
     TimerMilli                 mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
 
+    MessageQueue mQueuedUpdates;
+    Tasklet      mQueuedUpdatesTasklet;
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_PERSISTENCE_ENABLE
+    Tasklet mPersistTasklet;
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_POOL_ALLOCATION_ENABLE
+    ObjectPool<Host, OPENTHREAD_CONFIG_SRP_SERVER_MAX_HOSTS>                    mHostPool;
+    ObjectPool<Service, OPENTHREAD_CONFIG_SRP_SERVER_MAX_SERVICES>              mServicePool;
+    ObjectPool<Service::Description, OPENTHREAD_CONFIG_SRP_SERVER_MAX_SERVICES> mDescriptionPool;
+#endif
+
     ServiceUpdateId mServiceUpdateId;
     uint16_t        mPort;
     State           mState;
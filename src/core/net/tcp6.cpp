@@ -40,18 +40,36 @@
 #include "common/code_utils.hpp"
 #include "common/error.hpp"
 #include "common/instance.hpp"
+#include "common/locator_getters.hpp"
 #include "common/logging.hpp"
+#include "common/random.hpp"
+#include "net/checksum.hpp"
 #include "net/ip6.hpp"
 
 namespace ot {
 namespace Ip6 {
 
+// Sequence number comparisons (RFC 793 modular arithmetic).
+
+static bool SeqLt(uint32_t aFirst, uint32_t aSecond) { return static_cast<int32_t>(aFirst - aSecond) < 0; }
+static bool SeqLeq(uint32_t aFirst, uint32_t aSecond) { return static_cast<int32_t>(aFirst - aSecond) <= 0; }
+
+static void ReverseBytes(uint8_t *aBuffer, size_t aLength)
+{
+    for (size_t i = 0, j = aLength; i + 1 < j; i++, j--)
+    {
+        uint8_t byte = aBuffer[i];
+
+        aBuffer[i]     = aBuffer[j - 1];
+        aBuffer[j - 1] = byte;
+    }
+}
+
 Tcp::Tcp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance, Tcp::HandleTimer)
     , mEphemeralPort(kDynamicPortMin)
 {
-    OT_UNUSED_VARIABLE(mEphemeralPort);
 }
 
 Error Tcp::Endpoint::Initialize(Instance &aInstance, otTcpEndpointInitializeArgs &aArgs)
@@ -63,6 +81,7 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, otTcpEndpointInitializeArgs
     mContext                  = aArgs.mContext;
     mEstablishedCallback      = aArgs.mEstablishedCallback;
     mSendDoneCallback         = aArgs.mSendDoneCallback;
+    mBytesAckedCallback       = aArgs.mBytesAckedCallback;
     mSendReadyCallback        = aArgs.mSendReadyCallback;
     mReceiveAvailableCallback = aArgs.mReceiveAvailableCallback;
     mDisconnectedCallback     = aArgs.mDisconnectedCallback;
@@ -70,6 +89,16 @@ Error Tcp::Endpoint::Initialize(Instance &aInstance, otTcpEndpointInitializeArgs
     mInstance = &aInstance;
 
     memset(mTimers, 0x00, sizeof(mTimers));
+    memset(&mSockName, 0x00, sizeof(mSockName));
+    memset(&mPeerName, 0x00, sizeof(mPeerName));
+
+    mReceiveBuffer     = aArgs.mReceiveBuffer;
+    mReceiveBufferSize = aArgs.mReceiveBufferSize;
+
+    ResetConnectionState();
+
+    mRttSrtt = 0;
+    mRttVar  = 0;
 
 exit:
     return error;
@@ -82,75 +111,217 @@ Instance &Tcp::Endpoint::GetInstance(void)
 
 const SockAddr &Tcp::Endpoint::GetLocalAddress(void) const
 {
-    static otSockAddr temp;
-    return *static_cast<SockAddr *>(&temp);
+    return *static_cast<const SockAddr *>(&mSockName);
 }
 
 const SockAddr &Tcp::Endpoint::GetPeerAddress(void) const
 {
-    static otSockAddr temp;
-    return *static_cast<SockAddr *>(&temp);
+    return *static_cast<const SockAddr *>(&mPeerName);
 }
 
 Error Tcp::Endpoint::Bind(const SockAddr &aSockName)
 {
-    OT_UNUSED_VARIABLE(aSockName);
+    Error error = kErrorNone;
+
+    VerifyOrExit(mState == kStateClosed, error = kErrorInvalidState);
+    VerifyOrExit(aSockName.GetAddress().IsUnspecified() ||
+                     GetInstance().Get<ThreadNetif>().HasUnicastAddress(aSockName.GetAddress()),
+                 error = kErrorInvalidArgs);
 
-    return kErrorNotImplemented;
+    mSockName = aSockName;
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::Connect(const SockAddr &aSockName, uint32_t aFlags)
 {
-    OT_UNUSED_VARIABLE(aSockName);
-    OT_UNUSED_VARIABLE(aFlags);
+    Error error = kErrorNone;
 
-    return kErrorNotImplemented;
+    VerifyOrExit(mState == kStateClosed, error = kErrorInvalidState);
+    VerifyOrExit(aSockName.mPort != 0, error = kErrorInvalidArgs);
+
+    mPeerName = aSockName;
+
+    if (mSockName.mPort == 0)
+    {
+        mSockName.mPort = GetInstance().Get<Tcp>().GetEphemeralPort();
+    }
+
+    mState = kStateReady;
+
+    if (aFlags & OT_TCP_CONNECT_NO_FAST_OPEN)
+    {
+        StartHandshake();
+    }
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::SendByReference(otLinkedBuffer &aBuffer, uint32_t aFlags)
 {
-    OT_UNUSED_VARIABLE(aBuffer);
     OT_UNUSED_VARIABLE(aFlags);
 
-    return kErrorNotImplemented;
+    Error error = kErrorNone;
+
+    VerifyOrExit((mState == kStateReady || mState == kStateSynSent || mState == kStateSynReceived ||
+                  mState == kStateEstablished || mState == kStateCloseWait) &&
+                     !(mInternalFlags & kFlagFinQueued),
+                 error = kErrorInvalidState);
+
+    aBuffer.mNext = nullptr;
+
+    if (mSendQueueTail == nullptr)
+    {
+        mSendQueueHead = &aBuffer;
+    }
+    else
+    {
+        mSendQueueTail->mNext = &aBuffer;
+    }
+
+    mSendQueueTail = &aBuffer;
+    mSendQueueBytes += aBuffer.mLength;
+
+    if (mState == kStateReady)
+    {
+        StartHandshake();
+    }
+    else
+    {
+        SendPending();
+    }
+
+    if (mSendReadyCallback != nullptr)
+    {
+        mSendReadyCallback(this);
+    }
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::SendByExtension(size_t aNumBytes, uint32_t aFlags)
 {
-    OT_UNUSED_VARIABLE(aNumBytes);
     OT_UNUSED_VARIABLE(aFlags);
 
-    return kErrorNotImplemented;
+    Error error = kErrorNone;
+
+    VerifyOrExit((mSendQueueTail != nullptr) && !(mInternalFlags & kFlagFinQueued), error = kErrorInvalidState);
+    VerifyOrExit(aNumBytes <= static_cast<size_t>(0xffff - mSendQueueTail->mLength), error = kErrorInvalidArgs);
+
+    mSendQueueTail->mLength += static_cast<uint16_t>(aNumBytes);
+    mSendQueueBytes += aNumBytes;
+
+    SendPending();
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::ReceiveByReference(const otLinkedBuffer *&aBuffer) const
 {
-    OT_UNUSED_VARIABLE(aBuffer);
+    Error          error  = kErrorNone;
+    Endpoint &     self   = *const_cast<Endpoint *>(this);
+    const uint8_t *buffer = static_cast<const uint8_t *>(mReceiveBuffer);
+    size_t         first;
+
+    VerifyOrExit(mReceiveBuffer != nullptr, error = kErrorInvalidState);
+
+    first = OT_MIN(mReceiveAvailable, mReceiveBufferSize - mReceiveStart);
 
-    return kErrorNotImplemented;
+    self.mReceiveLinks[0].mNext   = (mReceiveAvailable > first) ? &self.mReceiveLinks[1] : nullptr;
+    self.mReceiveLinks[0].mData   = buffer + mReceiveStart;
+    self.mReceiveLinks[0].mLength = static_cast<uint16_t>(first);
+
+    self.mReceiveLinks[1].mNext   = nullptr;
+    self.mReceiveLinks[1].mData   = buffer;
+    self.mReceiveLinks[1].mLength = static_cast<uint16_t>(mReceiveAvailable - first);
+
+    aBuffer = &self.mReceiveLinks[0];
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::ReceiveContiguify(void)
 {
-    return kErrorNotImplemented;
+    Error    error  = kErrorNone;
+    uint8_t *buffer = static_cast<uint8_t *>(mReceiveBuffer);
+
+    VerifyOrExit(mReceiveBuffer != nullptr, error = kErrorInvalidState);
+    VerifyOrExit(mReceiveStart != 0);
+
+    // Rotate the circular buffer in place (three reversals) so that the
+    // oldest byte moves to the start of the buffer.
+
+    ReverseBytes(buffer, mReceiveStart);
+    ReverseBytes(buffer + mReceiveStart, mReceiveBufferSize - mReceiveStart);
+    ReverseBytes(buffer, mReceiveBufferSize);
+
+    mReceiveStart = 0;
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::CommitReceive(size_t aNumBytes, uint32_t aFlags)
 {
-    OT_UNUSED_VARIABLE(aNumBytes);
     OT_UNUSED_VARIABLE(aFlags);
 
-    return kErrorNotImplemented;
+    Error error = kErrorNone;
+
+    VerifyOrExit(aNumBytes <= mReceiveAvailable, error = kErrorInvalidArgs);
+    VerifyOrExit(aNumBytes > 0);
+
+    mReceiveStart = (mReceiveStart + aNumBytes) % mReceiveBufferSize;
+    mReceiveAvailable -= aNumBytes;
+
+    // Advertise the newly freed receive window.
+    if ((mState >= kStateEstablished) && (mState != kStateTimeWait))
+    {
+        IgnoreError(SendSegment(Header::kFlagAck, mSndNxt, 0));
+    }
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::SendEndOfStream(void)
 {
-    return kErrorNotImplemented;
+    Error error = kErrorNone;
+
+    VerifyOrExit((mState == kStateReady || mState == kStateSynSent || mState == kStateSynReceived ||
+                  mState == kStateEstablished || mState == kStateCloseWait) &&
+                     !(mInternalFlags & kFlagFinQueued),
+                 error = kErrorInvalidState);
+
+    mInternalFlags |= kFlagFinQueued;
+
+    if (mState == kStateReady)
+    {
+        StartHandshake();
+    }
+    else
+    {
+        SendPending();
+    }
+
+exit:
+    return error;
 }
 
 Error Tcp::Endpoint::Abort(void)
 {
-    return kErrorNotImplemented;
+    if ((mState >= kStateSynSent) && (mState != kStateTimeWait))
+    {
+        IgnoreError(SendSegment(Header::kFlagRst | Header::kFlagAck, mSndNxt, 0));
+    }
+
+    ResetConnectionState();
+
+    return kErrorNone;
 }
 
 Error Tcp::Endpoint::Deinitialize(void)
@@ -159,6 +330,8 @@ Error Tcp::Endpoint::Deinitialize(void)
 
     Tcp &tcp = GetInstance().Get<Tcp>();
 
+    IgnoreError(Abort());
+
     SuccessOrExit(error = tcp.mEndpoints.Remove(*this));
     SetNext(nullptr);
 
@@ -166,35 +339,700 @@ exit:
     return error;
 }
 
+void Tcp::Endpoint::StartHandshake(void)
+{
+    uint32_t iss = Random::NonCrypto::GetUint32();
+
+    mSndUna   = iss;
+    mSndNxt   = iss + 1;
+    mRcvNxt   = 0;
+    mSndWnd   = 0;
+    mCwnd     = 2 * kMaxSegmentSize;
+    mSsthresh = 0xffff;
+    mRto      = kMinRto;
+    mRetries  = 0;
+    mState    = kStateSynSent;
+
+    otLogDebgTcp("Endpoint %p connecting to port %u", static_cast<void *>(this), mPeerName.mPort);
+
+    IgnoreError(SendSegment(Header::kFlagSyn, iss, 0));
+    SetTimer(kTimerFlagRexmtPersist, mRto);
+}
+
+void Tcp::Endpoint::SendPending(void)
+{
+    uint32_t window;
+
+    VerifyOrExit((mState == kStateEstablished) || (mState == kStateCloseWait) || (mState == kStateFinWait1) ||
+                 (mState == kStateClosing) || (mState == kStateLastAck));
+
+    window = OT_MIN(static_cast<uint32_t>(mSndWnd), static_cast<uint32_t>(mCwnd));
+
+    while (!(mInternalFlags & kFlagFinSent))
+    {
+        uint32_t flight = mSndNxt - mSndUna;
+        uint32_t unsent = static_cast<uint32_t>(mSendQueueBytes) - flight;
+        uint16_t length;
+        uint16_t flags = Header::kFlagAck;
+
+        if (unsent == 0)
+        {
+            if (mInternalFlags & kFlagFinQueued)
+            {
+                // The FIN occupies one sequence number after the queued data.
+                VerifyOrExit(SendSegment(Header::kFlagFin | Header::kFlagAck, mSndNxt, 0) == kErrorNone);
+
+                mInternalFlags |= kFlagFinSent;
+                mSndNxt++;
+
+                switch (mState)
+                {
+                case kStateEstablished:
+                    mState = kStateFinWait1;
+                    break;
+
+                case kStateCloseWait:
+                    mState = kStateLastAck;
+                    break;
+
+                default:
+                    break;
+                }
+
+                if (!IsTimerActive(kTimerRexmtPersist))
+                {
+                    SetTimer(kTimerFlagRexmtPersist, mRto);
+                }
+            }
+
+            break;
+        }
+
+        if (flight >= window)
+        {
+            break;
+        }
+
+        length = static_cast<uint16_t>(OT_MIN(unsent, window - flight));
+        length = OT_MIN(length, kMaxSegmentSize);
+
+        if ((length == unsent) && !(mInternalFlags & kFlagFinQueued))
+        {
+            flags |= Header::kFlagPsh;
+        }
+
+        VerifyOrExit(SendSegment(flags, mSndNxt, length) == kErrorNone);
+
+        if (!(mInternalFlags & kFlagRttTiming))
+        {
+            // Time one segment at a time for the RTT estimate (RFC 6298).
+            mRttSeq  = mSndNxt;
+            mRttTime = TimerMilli::GetNow().GetValue();
+            mInternalFlags |= kFlagRttTiming;
+        }
+
+        mSndNxt += length;
+
+        if (!IsTimerActive(kTimerRexmtPersist))
+        {
+            SetTimer(kTimerFlagRexmtPersist, mRto);
+        }
+    }
+
+    // When the peer closed its window, keep probing so that the window
+    // update cannot be lost (zero-window persist).
+    if ((mSndWnd == 0) && (mSendQueueBytes > 0) && !IsTimerActive(kTimerRexmtPersist))
+    {
+        SetTimer(kTimerFlagRexmtPersist, mRto);
+    }
+
+exit:
+    return;
+}
+
+Error Tcp::Endpoint::SendSegment(uint16_t aFlags, uint32_t aSequenceNumber, uint16_t aPayloadLength)
+{
+    Error       error   = kErrorNone;
+    Message *   message = nullptr;
+    Header      header;
+    MessageInfo messageInfo;
+
+    VerifyOrExit((message = GetInstance().Get<Ip6>().NewMessage(0)) != nullptr, error = kErrorNoBufs);
+
+    header.Init(aFlags);
+    header.SetSourcePort(mSockName.mPort);
+    header.SetDestinationPort(mPeerName.mPort);
+    header.SetSequenceNumber(aSequenceNumber);
+    header.SetAcknowledgmentNumber((aFlags & Header::kFlagAck) ? mRcvNxt : 0);
+    header.SetWindow(GetReceiveWindow());
+
+    SuccessOrExit(error = message->Append(header));
+
+    if (aPayloadLength > 0)
+    {
+        SuccessOrExit(error = AppendSendData(*message, aSequenceNumber, aPayloadLength));
+    }
+
+    messageInfo.SetPeerAddr(GetPeerAddress().GetAddress());
+    messageInfo.SetPeerPort(mPeerName.mPort);
+    messageInfo.SetSockAddr(GetLocalAddress().GetAddress());
+    messageInfo.SetSockPort(mSockName.mPort);
+
+    error = GetInstance().Get<Ip6>().SendDatagram(*message, messageInfo, kProtoTcp);
+
+exit:
+    FreeMessageOnError(message, error);
+    return error;
+}
+
+Error Tcp::Endpoint::AppendSendData(Message &aMessage, uint32_t aSequenceNumber, uint16_t aLength)
+{
+    Error                 error  = kErrorNone;
+    size_t                offset = mSendHeadOffset + (aSequenceNumber - mSndUna);
+    const otLinkedBuffer *buffer = mSendQueueHead;
+
+    // The send queue references the application's linked buffers directly;
+    // the data is only copied here, when a segment is actually serialized.
+
+    while ((buffer != nullptr) && (offset >= buffer->mLength))
+    {
+        offset -= buffer->mLength;
+        buffer = buffer->mNext;
+    }
+
+    while (aLength > 0)
+    {
+        uint16_t chunkLength;
+
+        VerifyOrExit(buffer != nullptr, error = kErrorInvalidArgs);
+
+        chunkLength = static_cast<uint16_t>(OT_MIN(static_cast<size_t>(aLength), buffer->mLength - offset));
+        SuccessOrExit(error = aMessage.AppendBytes(buffer->mData + offset, chunkLength));
+
+        aLength -= chunkLength;
+        offset = 0;
+        buffer = buffer->mNext;
+    }
+
+exit:
+    return error;
+}
+
+void Tcp::Endpoint::Retransmit(void)
+{
+    uint16_t length = static_cast<uint16_t>(OT_MIN(mSendQueueBytes, static_cast<size_t>(kMaxSegmentSize)));
+
+    if (length > 0)
+    {
+        IgnoreError(SendSegment(Header::kFlagAck, mSndUna, length));
+    }
+    else if ((mInternalFlags & kFlagFinSent) != 0)
+    {
+        IgnoreError(SendSegment(Header::kFlagFin | Header::kFlagAck, mSndUna, 0));
+    }
+}
+
+void Tcp::Endpoint::HandleSegment(const Header &     aHeader,
+                                  const Message &    aMessage,
+                                  uint16_t           aPayloadOffset,
+                                  uint16_t           aPayloadLength,
+                                  const MessageInfo &aMessageInfo)
+{
+    uint16_t flags = aHeader.GetFlags();
+
+    // Learn the local address when the endpoint was bound to the
+    // unspecified address.
+    if (GetLocalAddress().GetAddress().IsUnspecified())
+    {
+        mSockName.mAddress = aMessageInfo.GetSockAddr();
+    }
+
+    if (flags & Header::kFlagRst)
+    {
+        Disconnect((mState == kStateSynSent) ? OT_TCP_DISCONNECTED_REASON_REFUSED : OT_TCP_DISCONNECTED_REASON_RESET);
+        ExitNow();
+    }
+
+    switch (mState)
+    {
+    case kStateSynSent:
+        // Simultaneous open is not supported; expect a SYN-ACK of our SYN.
+        VerifyOrExit((flags & (Header::kFlagSyn | Header::kFlagAck)) == (Header::kFlagSyn | Header::kFlagAck));
+        VerifyOrExit(aHeader.GetAcknowledgmentNumber() == mSndNxt);
+
+        mRcvNxt  = aHeader.GetSequenceNumber() + 1;
+        mSndUna  = aHeader.GetAcknowledgmentNumber();
+        mSndWnd  = aHeader.GetWindow();
+        mRetries = 0;
+        CancelTimer(kTimerFlagRexmtPersist);
+
+        mState = kStateEstablished;
+        IgnoreError(SendSegment(Header::kFlagAck, mSndNxt, 0));
+
+        otLogDebgTcp("Endpoint %p established (active open)", static_cast<void *>(this));
+
+        if (mEstablishedCallback != nullptr)
+        {
+            mEstablishedCallback(this);
+        }
+
+        SendPending();
+        ExitNow();
+
+    case kStateSynReceived:
+        VerifyOrExit((flags & Header::kFlagAck) && (aHeader.GetAcknowledgmentNumber() == mSndNxt));
+
+        mSndUna  = aHeader.GetAcknowledgmentNumber();
+        mSndWnd  = aHeader.GetWindow();
+        mRetries = 0;
+        CancelTimer(kTimerFlagRexmtPersist);
+
+        mState = kStateEstablished;
+
+        otLogDebgTcp("Endpoint %p established (passive open)", static_cast<void *>(this));
+
+        if (mEstablishedCallback != nullptr)
+        {
+            mEstablishedCallback(this);
+        }
+
+        // The ACK completing the handshake may carry data; continue below.
+        break;
+
+    default:
+        break;
+    }
+
+    VerifyOrExit(mState >= kStateEstablished);
+    VerifyOrExit((flags & Header::kFlagAck) != 0);
+
+    if (mState == kStateTimeWait)
+    {
+        // Re-acknowledge a retransmitted FIN from the peer.
+        if (flags & Header::kFlagFin)
+        {
+            IgnoreError(SendSegment(Header::kFlagAck, mSndNxt, 0));
+        }
+
+        ExitNow();
+    }
+
+    ProcessAck(aHeader.GetAcknowledgmentNumber(), aHeader.GetWindow(),
+               (aPayloadLength == 0) && !(flags & Header::kFlagFin));
+
+    VerifyOrExit((mState != kStateClosed) && (mState != kStateTimeWait));
+
+    ProcessPayload(aHeader.GetSequenceNumber(), aMessage, aPayloadOffset, aPayloadLength,
+                   (flags & Header::kFlagFin) != 0);
+
+exit:
+    return;
+}
+
+void Tcp::Endpoint::ProcessAck(uint32_t aAckNumber, uint16_t aWindow, bool aCanBeDupAck)
+{
+    uint32_t acked;
+    size_t   dataAcked;
+
+    mSndWnd = aWindow;
+
+    VerifyOrExit(SeqLeq(aAckNumber, mSndNxt)); // Ignore acknowledgments of data not yet sent.
+
+    if (SeqLeq(aAckNumber, mSndUna))
+    {
+        if (aCanBeDupAck && (aAckNumber == mSndUna) && (mSndNxt != mSndUna))
+        {
+            mDupAcks++;
+
+            if (mDupAcks == kDupAckThreshold)
+            {
+                // Fast retransmit (RFC 5681): halve the congestion window
+                // and resend the oldest unacknowledged segment.
+                uint32_t flight = mSndNxt - mSndUna;
+
+                mSsthresh = static_cast<uint16_t>(OT_MAX(flight / 2, static_cast<uint32_t>(2 * kMaxSegmentSize)));
+                mCwnd     = mSsthresh;
+
+                Retransmit();
+            }
+        }
+
+        SendPending();
+        ExitNow();
+    }
+
+    acked    = aAckNumber - mSndUna;
+    mDupAcks = 0;
+    mRetries = 0;
+
+    if ((mInternalFlags & kFlagRttTiming) && SeqLt(mRttSeq, aAckNumber))
+    {
+        UpdateRtt(TimerMilli::GetNow());
+        mInternalFlags &= static_cast<uint8_t>(~kFlagRttTiming);
+    }
+
+    // Grow the congestion window: slow start below `mSsthresh`,
+    // congestion avoidance above it (RFC 5681).
+    if (mCwnd < mSsthresh)
+    {
+        mCwnd = static_cast<uint16_t>(
+            OT_MIN(static_cast<uint32_t>(mCwnd) + OT_MIN(acked, static_cast<uint32_t>(kMaxSegmentSize)),
+                   static_cast<uint32_t>(0xffff)));
+    }
+    else
+    {
+        uint32_t increase = OT_MAX(static_cast<uint32_t>(kMaxSegmentSize) * kMaxSegmentSize / mCwnd, 1u);
+
+        mCwnd = static_cast<uint16_t>(OT_MIN(static_cast<uint32_t>(mCwnd) + increase, static_cast<uint32_t>(0xffff)));
+    }
+
+    dataAcked = acked;
+
+    if ((mInternalFlags & kFlagFinSent) &&
+        (aAckNumber == mSndUna + static_cast<uint32_t>(mSendQueueBytes) + 1))
+    {
+        mInternalFlags |= kFlagFinAcked;
+        dataAcked--;
+    }
+
+    if ((dataAcked > 0) && (mBytesAckedCallback != nullptr))
+    {
+        mBytesAckedCallback(this, dataAcked);
+    }
+
+    // Return fully acknowledged linked buffers to the application.
+    while (dataAcked > 0)
+    {
+        otLinkedBuffer *buffer = mSendQueueHead;
+        size_t          avail  = buffer->mLength - mSendHeadOffset;
+
+        if (dataAcked >= avail)
+        {
+            mSendQueueHead = buffer->mNext;
+
+            if (mSendQueueHead == nullptr)
+            {
+                mSendQueueTail = nullptr;
+            }
+
+            mSendQueueBytes -= avail;
+            mSendHeadOffset = 0;
+            dataAcked -= avail;
+
+            buffer->mNext = nullptr;
+
+            if (mSendDoneCallback != nullptr)
+            {
+                mSendDoneCallback(this, buffer);
+            }
+        }
+        else
+        {
+            mSendHeadOffset += dataAcked;
+            mSendQueueBytes -= dataAcked;
+            dataAcked = 0;
+        }
+    }
+
+    mSndUna = aAckNumber;
+
+    if (mSndNxt == mSndUna)
+    {
+        CancelTimer(kTimerFlagRexmtPersist);
+    }
+    else
+    {
+        // Restart the retransmission timer for the next oldest segment.
+        SetTimer(kTimerFlagRexmtPersist, mRto);
+    }
+
+    if (mInternalFlags & kFlagFinAcked)
+    {
+        HandleFinAcked();
+    }
+
+    VerifyOrExit((mState != kStateClosed) && (mState != kStateTimeWait));
+
+    SendPending();
+
+exit:
+    return;
+}
+
+void Tcp::Endpoint::ProcessPayload(uint32_t       aSegmentSeq,
+                                   const Message &aMessage,
+                                   uint16_t       aPayloadOffset,
+                                   uint16_t       aPayloadLength,
+                                   bool           aFin)
+{
+    bool     shouldAck     = false;
+    bool     enterTimeWait = false;
+    uint32_t seq           = aSegmentSeq;
+    uint16_t length        = aPayloadLength;
+    uint16_t accepted      = 0;
+
+    VerifyOrExit((length > 0) || aFin);
+
+    if (SeqLt(seq, mRcvNxt))
+    {
+        uint32_t stale = mRcvNxt - seq;
+
+        if (stale <= length)
+        {
+            // Trim the already-received prefix.
+            aPayloadOffset += static_cast<uint16_t>(stale);
+            length -= static_cast<uint16_t>(stale);
+            seq = mRcvNxt;
+        }
+        else
+        {
+            // Everything (including any FIN) is old; our ACK was likely
+            // lost, so re-acknowledge.
+            IgnoreError(SendSegment(Header::kFlagAck, mSndNxt, 0));
+            ExitNow();
+        }
+    }
+
+    if (seq != mRcvNxt)
+    {
+        // Out-of-order segment; re-acknowledge so the peer can fast
+        // retransmit the missing segment.
+        IgnoreError(SendSegment(Header::kFlagAck, mSndNxt, 0));
+        ExitNow();
+    }
+
+    if ((length > 0) && (mReceiveBuffer != nullptr))
+    {
+        uint8_t *buffer = static_cast<uint8_t *>(mReceiveBuffer);
+        size_t   space  = mReceiveBufferSize - mReceiveAvailable;
+        size_t   end;
+        size_t   first;
+
+        accepted = static_cast<uint16_t>(OT_MIN(static_cast<size_t>(length), space));
+
+        end   = (mReceiveStart + mReceiveAvailable) % mReceiveBufferSize;
+        first = OT_MIN(static_cast<size_t>(accepted), mReceiveBufferSize - end);
+
+        aMessage.ReadBytes(aPayloadOffset, buffer + end, static_cast<uint16_t>(first));
+
+        if (accepted > first)
+        {
+            aMessage.ReadBytes(aPayloadOffset + static_cast<uint16_t>(first), buffer,
+                               static_cast<uint16_t>(accepted - first));
+        }
+
+        mReceiveAvailable += accepted;
+        mRcvNxt += accepted;
+        shouldAck = true;
+    }
+
+    if (aFin && (accepted == length))
+    {
+        // The peer's FIN occupies one sequence number after its data.
+        mRcvNxt++;
+        mInternalFlags |= kFlagFinReceived;
+        shouldAck = true;
+
+        switch (mState)
+        {
+        case kStateEstablished:
+            mState = kStateCloseWait;
+            break;
+
+        case kStateFinWait1:
+            if (mInternalFlags & kFlagFinAcked)
+            {
+                enterTimeWait = true;
+            }
+            else
+            {
+                mState = kStateClosing;
+            }
+            break;
+
+        case kStateFinWait2:
+            enterTimeWait = true;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if (shouldAck)
+    {
+        IgnoreError(SendSegment(Header::kFlagAck, mSndNxt, 0));
+        SignalReceiveAvailable();
+    }
+
+    if (enterTimeWait)
+    {
+        EnterTimeWait();
+    }
+
+exit:
+    return;
+}
+
+void Tcp::Endpoint::UpdateRtt(TimeMilli aNow)
+{
+    uint32_t rtt = aNow.GetValue() - mRttTime;
+    uint32_t rto;
+
+    if (mRttSrtt == 0)
+    {
+        // First measurement (RFC 6298).
+        mRttSrtt = rtt;
+        mRttVar  = rtt / 2;
+    }
+    else
+    {
+        uint32_t diff = (mRttSrtt > rtt) ? (mRttSrtt - rtt) : (rtt - mRttSrtt);
+
+        mRttVar  = (3 * mRttVar + diff) / 4;
+        mRttSrtt = (7 * mRttSrtt + rtt) / 8;
+    }
+
+    rto  = mRttSrtt + OT_MAX(4 * mRttVar, kRttGranularity);
+    mRto = OT_MIN(OT_MAX(rto, kMinRto), kMaxRto);
+}
+
+void Tcp::Endpoint::HandleFinAcked(void)
+{
+    switch (mState)
+    {
+    case kStateFinWait1:
+        mState = kStateFinWait2;
+        break;
+
+    case kStateClosing:
+        EnterTimeWait();
+        break;
+
+    case kStateLastAck:
+        Disconnect(OT_TCP_DISCONNECTED_REASON_NORMAL);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void Tcp::Endpoint::EnterTimeWait(void)
+{
+    mState = kStateTimeWait;
+    CancelTimer(kTimerFlagRexmtPersist);
+    SetTimer(kTimerFlag2Msl, kTimeWaitTime);
+
+    if (mDisconnectedCallback != nullptr)
+    {
+        mDisconnectedCallback(this, OT_TCP_DISCONNECTED_REASON_TIME_WAIT);
+    }
+}
+
+void Tcp::Endpoint::Disconnect(otTcpDisconnectedReason aReason)
+{
+    otLogDebgTcp("Endpoint %p disconnected (reason %d)", static_cast<void *>(this), static_cast<int>(aReason));
+
+    ResetConnectionState();
+
+    if (mDisconnectedCallback != nullptr)
+    {
+        mDisconnectedCallback(this, aReason);
+    }
+}
+
+void Tcp::Endpoint::ResetConnectionState(void)
+{
+    // Any linked buffers remaining in the send queue are returned to the
+    // application (which reclaims them after the "disconnected" callback).
+
+    mState          = kStateClosed;
+    mInternalFlags  = 0;
+    mTimerFlags     = 0;
+    mDupAcks        = 0;
+    mRetries        = 0;
+    mSendQueueHead  = nullptr;
+    mSendQueueTail  = nullptr;
+    mSendQueueBytes = 0;
+    mSendHeadOffset = 0;
+    mReceiveStart   = 0;
+
+    mReceiveAvailable = 0;
+
+    mSndUna = 0;
+    mSndNxt = 0;
+    mRcvNxt = 0;
+    mSndWnd = 0;
+    mCwnd   = 0;
+
+    mSsthresh = 0;
+    mRto      = kMinRto;
+}
+
+uint16_t Tcp::Endpoint::GetReceiveWindow(void) const
+{
+    size_t space = (mReceiveBuffer != nullptr) ? (mReceiveBufferSize - mReceiveAvailable) : 0;
+
+    return (space > 0xffff) ? 0xffff : static_cast<uint16_t>(space);
+}
+
+void Tcp::Endpoint::SignalReceiveAvailable(void)
+{
+    if (mReceiveAvailableCallback != nullptr)
+    {
+        mReceiveAvailableCallback(this, mReceiveAvailable, (mInternalFlags & kFlagFinReceived) != 0,
+                                  mReceiveBufferSize - mReceiveAvailable);
+    }
+}
+
+bool Tcp::Endpoint::Matches(const MessageInfo &aMessageInfo) const
+{
+    bool matches = false;
+
+    VerifyOrExit((mState != kStateClosed) && (mState != kStateReady));
+    VerifyOrExit(mPeerName.mPort == aMessageInfo.GetPeerPort());
+    VerifyOrExit(mSockName.mPort == aMessageInfo.GetSockPort());
+    VerifyOrExit(GetPeerAddress().GetAddress() == aMessageInfo.GetPeerAddr());
+    VerifyOrExit(GetLocalAddress().GetAddress().IsUnspecified() ||
+                 GetLocalAddress().GetAddress() == aMessageInfo.GetSockAddr());
+
+    matches = true;
+
+exit:
+    return matches;
+}
+
 uint8_t Tcp::Endpoint::TimerFlagToIndex(uint8_t aTimerFlag)
 {
-    OT_UNUSED_VARIABLE(aTimerFlag);
-    /*
-     * TODO: Convert from the timer flag provided by TCPlp to the index in
-     * our timers array.
-     */
-    return 0;
+    uint8_t index;
+
+    for (index = 0; index < kNumTimers; index++)
+    {
+        if (aTimerFlag == (1 << index))
+        {
+            break;
+        }
+    }
+
+    return index;
 }
 
 bool Tcp::Endpoint::IsTimerActive(uint8_t aTimerIndex)
 {
-    OT_UNUSED_VARIABLE(aTimerIndex);
-    /* TODO: Check whether TCPlp has marked this timer as active. */
-    return false;
+    return (mTimerFlags & (1 << aTimerIndex)) != 0;
 }
 
 void Tcp::Endpoint::SetTimer(uint8_t aTimerFlag, uint32_t aDelay)
 {
-    /*
-     * TCPlp has already set the flag for this timer to record that it's
-     * running. So, all that's left to do is record the expiry time and
-     * (re)set the main timer as appropriate.
-     */
+    // Record that the timer is running along with its expiry time, and
+    // (re)set the main timer as appropriate.
 
     TimeMilli now         = TimerMilli::GetNow();
     TimeMilli newFireTime = now + aDelay;
     uint8_t   timerIndex  = TimerFlagToIndex(aTimerFlag);
 
+    mTimerFlags |= aTimerFlag;
     mTimers[timerIndex] = newFireTime.GetValue();
     otLogDebgTcp("Endpoint %p set timer %u to %u ms", static_cast<void *>(this), static_cast<unsigned int>(timerIndex),
                  static_cast<unsigned int>(aDelay));
@@ -204,13 +1042,10 @@ void Tcp::Endpoint::SetTimer(uint8_t aTimerFlag, uint32_t aDelay)
 
 void Tcp::Endpoint::CancelTimer(uint8_t aTimerFlag)
 {
-    /*
-     * TCPlp has already cleared the timer flag before calling this. Since the
-     * main timer's callback properly handles the case where no timers are
-     * actually due, there's actually no work to be done here.
-     */
+    // Since the main timer's callback properly handles the case where no
+    // timers are actually due, clearing the flag is all that is needed.
 
-    OT_UNUSED_VARIABLE(aTimerFlag);
+    mTimerFlags &= static_cast<uint8_t>(~aTimerFlag);
 
     otLogDebgTcp("Endpoint %p cancelled timer %u", static_cast<void *>(this),
                  static_cast<unsigned int>(TimerFlagToIndex(aTimerFlag)));
@@ -218,6 +1053,8 @@ void Tcp::Endpoint::CancelTimer(uint8_t aTimerFlag)
 
 bool Tcp::Endpoint::FirePendingTimers(TimeMilli aNow, bool &aHasFutureTimer, TimeMilli &aEarliestFutureExpiry)
 {
+    bool calledUserCallback = false;
+
     /*
      * NOTE: Firing a timer might potentially activate/deactivate other timers.
      * If timers x and y expire at the same time, but the callback for timer x
@@ -241,8 +1078,14 @@ bool Tcp::Endpoint::FirePendingTimers(TimeMilli aNow, bool &aHasFutureTimer, Tim
 
             if (expiry <= aNow)
             {
-                /* TODO: Call TCPlp's callback for this timer. */
-                /* If a user callback is called, then return true. */
+                mTimerFlags &= static_cast<uint8_t>(~(1 << timerIndex));
+
+                if (HandleTimerExpiry(timerIndex, aNow))
+                {
+                    // A user callback was called; the caller must restart
+                    // the traversal of the endpoint list.
+                    ExitNow(calledUserCallback = true);
+                }
             }
             else
             {
@@ -252,7 +1095,82 @@ bool Tcp::Endpoint::FirePendingTimers(TimeMilli aNow, bool &aHasFutureTimer, Tim
         }
     }
 
-    return false;
+exit:
+    return calledUserCallback;
+}
+
+bool Tcp::Endpoint::HandleTimerExpiry(uint8_t aTimerIndex, TimeMilli aNow)
+{
+    OT_UNUSED_VARIABLE(aNow);
+
+    bool calledUserCallback = false;
+
+    switch (aTimerIndex)
+    {
+    case kTimerRexmtPersist:
+        if (++mRetries > kMaxRetries)
+        {
+            Disconnect(OT_TCP_DISCONNECTED_REASON_TIMED_OUT);
+            ExitNow(calledUserCallback = true);
+        }
+
+        mRto = OT_MIN(mRto * 2, kMaxRto);
+
+        switch (mState)
+        {
+        case kStateSynSent:
+            IgnoreError(SendSegment(Header::kFlagSyn, mSndUna, 0));
+            SetTimer(kTimerFlagRexmtPersist, mRto);
+            break;
+
+        case kStateSynReceived:
+            IgnoreError(SendSegment(Header::kFlagSyn | Header::kFlagAck, mSndUna, 0));
+            SetTimer(kTimerFlagRexmtPersist, mRto);
+            break;
+
+        default:
+            if ((mSndNxt == mSndUna) && (mSendQueueBytes > 0) && (mSndWnd == 0))
+            {
+                // Zero-window persist: probe with a single byte so that a
+                // lost window update cannot deadlock the connection.
+                IgnoreError(SendSegment(Header::kFlagAck, mSndUna, 1));
+                SetTimer(kTimerFlagRexmtPersist, mRto);
+            }
+            else if (mSndNxt != mSndUna)
+            {
+                // Retransmission timeout (RFC 6298/5681): collapse the
+                // congestion window and resend from the oldest
+                // unacknowledged byte.
+                uint32_t flight = mSndNxt - mSndUna;
+
+                mSsthresh = static_cast<uint16_t>(OT_MAX(flight / 2, static_cast<uint32_t>(2 * kMaxSegmentSize)));
+                mCwnd     = kMaxSegmentSize;
+                mInternalFlags &= static_cast<uint8_t>(~kFlagRttTiming); // Karn's algorithm.
+
+                mSndNxt = mSndUna;
+                mInternalFlags &= static_cast<uint8_t>(~kFlagFinSent);
+
+                SendPending();
+                SetTimer(kTimerFlagRexmtPersist, mRto);
+            }
+            break;
+        }
+        break;
+
+    case kTimer2Msl:
+        if (mState == kStateTimeWait)
+        {
+            Disconnect(OT_TCP_DISCONNECTED_REASON_NORMAL);
+            ExitNow(calledUserCallback = true);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return calledUserCallback;
 }
 
 Error Tcp::Listener::Initialize(Instance &aInstance, otTcpListenerInitializeArgs &aArgs)
@@ -267,6 +1185,8 @@ Error Tcp::Listener::Initialize(Instance &aInstance, otTcpListenerInitializeArgs
 
     mInstance = &aInstance;
 
+    memset(&mSockName, 0x00, sizeof(mSockName));
+
 exit:
     return error;
 }
@@ -278,14 +1198,21 @@ Instance &Tcp::Listener::GetInstance(void)
 
 Error Tcp::Listener::Listen(const SockAddr &aSockName)
 {
-    OT_UNUSED_VARIABLE(aSockName);
+    Error error = kErrorNone;
+
+    VerifyOrExit(aSockName.mPort != 0, error = kErrorInvalidArgs);
 
-    return kErrorNotImplemented;
+    mSockName = aSockName;
+
+exit:
+    return error;
 }
 
 Error Tcp::Listener::StopListening(void)
 {
-    return kErrorNotImplemented;
+    memset(&mSockName, 0x00, sizeof(mSockName));
+
+    return kErrorNone;
 }
 
 Error Tcp::Listener::Deinitialize(void)
@@ -304,24 +1231,231 @@ exit:
 Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, MessageInfo &aMessageInfo)
 {
     OT_UNUSED_VARIABLE(aIp6Header);
-    OT_UNUSED_VARIABLE(aMessage);
-    OT_UNUSED_VARIABLE(aMessageInfo);
 
-    Error error = kErrorNotImplemented;
+    Error     error = kErrorNone;
+    Header    header;
+    Endpoint *endpoint;
+    Listener *listener;
+    uint16_t  headerSize;
+    uint16_t  payloadOffset;
+    uint16_t  payloadLength;
+
+    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), header));
+
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    SuccessOrExit(error = Checksum::VerifyMessageChecksum(aMessage, aMessageInfo, kProtoTcp));
+#endif
+
+    headerSize = header.GetHeaderSize();
+    VerifyOrExit(headerSize >= sizeof(Header), error = kErrorParse);
+    VerifyOrExit(aMessage.GetOffset() + headerSize <= aMessage.GetLength(), error = kErrorParse);
+
+    aMessageInfo.mPeerPort = header.GetSourcePort();
+    aMessageInfo.mSockPort = header.GetDestinationPort();
+
+    payloadOffset = aMessage.GetOffset() + headerSize;
+    payloadLength = aMessage.GetLength() - payloadOffset;
+
+    endpoint = FindEndpoint(aMessageInfo);
 
-    for (Endpoint &active : mEndpoints)
+    if (endpoint != nullptr)
     {
-        OT_UNUSED_VARIABLE(active);
+        endpoint->HandleSegment(header, aMessage, payloadOffset, payloadLength, aMessageInfo);
+        ExitNow();
     }
 
-    for (Listener &passive : mListeners)
+    if ((header.GetFlags() & (Header::kFlagSyn | Header::kFlagAck | Header::kFlagRst)) == Header::kFlagSyn)
     {
-        OT_UNUSED_VARIABLE(passive);
+        listener = FindListener(aMessageInfo);
+
+        if (listener != nullptr)
+        {
+            HandleIncomingConnection(*listener, header, aMessageInfo);
+            ExitNow();
+        }
+    }
+
+    if ((header.GetFlags() & Header::kFlagRst) == 0)
+    {
+        SendReset(header, payloadLength, aMessageInfo);
     }
 
+exit:
     return error;
 }
 
+Tcp::Endpoint *Tcp::FindEndpoint(const MessageInfo &aMessageInfo)
+{
+    Endpoint *matched = nullptr;
+
+    for (Endpoint &endpoint : mEndpoints)
+    {
+        if (endpoint.Matches(aMessageInfo))
+        {
+            matched = &endpoint;
+            break;
+        }
+    }
+
+    return matched;
+}
+
+Tcp::Listener *Tcp::FindListener(const MessageInfo &aMessageInfo)
+{
+    Listener *matched = nullptr;
+
+    for (Listener &listener : mListeners)
+    {
+        const SockAddr &sockName = *static_cast<const SockAddr *>(&listener.mSockName);
+
+        if ((sockName.mPort != 0) && (sockName.mPort == aMessageInfo.GetSockPort()) &&
+            (sockName.GetAddress().IsUnspecified() || (sockName.GetAddress() == aMessageInfo.GetSockAddr())))
+        {
+            matched = &listener;
+            break;
+        }
+    }
+
+    return matched;
+}
+
+void Tcp::HandleIncomingConnection(Listener &aListener, const Header &aHeader, const MessageInfo &aMessageInfo)
+{
+    otSockAddr     peer;
+    otTcpEndpoint *acceptInto = nullptr;
+    Endpoint *     endpoint;
+    uint32_t       iss;
+
+    VerifyOrExit(aListener.mAcceptReadyCallback != nullptr);
+
+    peer.mAddress = aMessageInfo.GetPeerAddr();
+    peer.mPort    = aMessageInfo.GetPeerPort();
+
+    switch (aListener.mAcceptReadyCallback(&aListener, &peer, &acceptInto))
+    {
+    case OT_TCP_INCOMING_CONNECTION_ACTION_ACCEPT:
+        endpoint = static_cast<Endpoint *>(acceptInto);
+
+        VerifyOrExit((endpoint != nullptr) && (endpoint->mState == Endpoint::kStateClosed));
+
+        endpoint->mSockName.mAddress = aMessageInfo.GetSockAddr();
+        endpoint->mSockName.mPort    = aMessageInfo.GetSockPort();
+        endpoint->mPeerName          = peer;
+
+        iss = Random::NonCrypto::GetUint32();
+
+        endpoint->mSndUna   = iss;
+        endpoint->mSndNxt   = iss + 1;
+        endpoint->mRcvNxt   = aHeader.GetSequenceNumber() + 1;
+        endpoint->mSndWnd   = aHeader.GetWindow();
+        endpoint->mCwnd     = 2 * Endpoint::kMaxSegmentSize;
+        endpoint->mSsthresh = 0xffff;
+        endpoint->mRto      = Endpoint::kMinRto;
+        endpoint->mRetries  = 0;
+        endpoint->mState    = Endpoint::kStateSynReceived;
+
+        IgnoreError(endpoint->SendSegment(Header::kFlagSyn | Header::kFlagAck, iss, 0));
+        endpoint->SetTimer(Endpoint::kTimerFlagRexmtPersist, endpoint->mRto);
+
+        if (aListener.mAcceptDoneCallback != nullptr)
+        {
+            aListener.mAcceptDoneCallback(&aListener, endpoint, &peer);
+        }
+        break;
+
+    case OT_TCP_INCOMING_CONNECTION_ACTION_DEFER:
+        break;
+
+    case OT_TCP_INCOMING_CONNECTION_ACTION_REFUSE:
+        SendReset(aHeader, 0, aMessageInfo);
+        break;
+    }
+
+exit:
+    return;
+}
+
+void Tcp::SendReset(const Header &aHeader, uint16_t aPayloadLength, const MessageInfo &aMessageInfo)
+{
+    Error       error   = kErrorNone;
+    Message *   message = nullptr;
+    Header      header;
+    MessageInfo messageInfo;
+
+    VerifyOrExit((message = Get<Ip6>().NewMessage(0)) != nullptr, error = kErrorNoBufs);
+
+    if (aHeader.GetFlags() & Header::kFlagAck)
+    {
+        header.Init(Header::kFlagRst);
+        header.SetSequenceNumber(aHeader.GetAcknowledgmentNumber());
+        header.SetAcknowledgmentNumber(0);
+    }
+    else
+    {
+        uint32_t ack = aHeader.GetSequenceNumber() + aPayloadLength;
+
+        if (aHeader.GetFlags() & Header::kFlagSyn)
+        {
+            ack++;
+        }
+
+        if (aHeader.GetFlags() & Header::kFlagFin)
+        {
+            ack++;
+        }
+
+        header.Init(Header::kFlagRst | Header::kFlagAck);
+        header.SetSequenceNumber(0);
+        header.SetAcknowledgmentNumber(ack);
+    }
+
+    header.SetSourcePort(aHeader.GetDestinationPort());
+    header.SetDestinationPort(aHeader.GetSourcePort());
+    header.SetWindow(0);
+
+    SuccessOrExit(error = message->Append(header));
+
+    messageInfo.SetPeerAddr(aMessageInfo.GetPeerAddr());
+    messageInfo.SetPeerPort(aHeader.GetSourcePort());
+    messageInfo.SetSockAddr(aMessageInfo.GetSockAddr());
+    messageInfo.SetSockPort(aHeader.GetDestinationPort());
+
+    error = Get<Ip6>().SendDatagram(*message, messageInfo, kProtoTcp);
+
+exit:
+    FreeMessageOnError(message, error);
+}
+
+uint16_t Tcp::GetEphemeralPort(void)
+{
+    bool inUse;
+
+    do
+    {
+        inUse = false;
+
+        if (mEphemeralPort < kDynamicPortMax)
+        {
+            mEphemeralPort++;
+        }
+        else
+        {
+            mEphemeralPort = kDynamicPortMin;
+        }
+
+        for (Endpoint &endpoint : mEndpoints)
+        {
+            if (endpoint.mSockName.mPort == mEphemeralPort)
+            {
+                inUse = true;
+                break;
+            }
+        }
+    } while (inUse);
+
+    return mEphemeralPort;
+}
+
 void Tcp::HandleTimer(Timer &aTimer)
 {
     OT_ASSERT(&aTimer == &aTimer.GetInstance().Get<Tcp>().mTimer);
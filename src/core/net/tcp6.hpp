@@ -66,6 +66,161 @@ namespace Ip6 {
 class Tcp : public InstanceLocator, private NonCopyable
 {
 public:
+    /**
+     * This class implements TCP header parsing.
+     *
+     */
+    OT_TOOL_PACKED_BEGIN
+    class Header
+    {
+    public:
+        static constexpr uint8_t kChecksumFieldOffset = 16; ///< Byte offset of the Checksum field in the TCP header.
+
+        static constexpr uint16_t kFlagFin = 1 << 0; ///< FIN flag (no more data from sender).
+        static constexpr uint16_t kFlagSyn = 1 << 1; ///< SYN flag (synchronize sequence numbers).
+        static constexpr uint16_t kFlagRst = 1 << 2; ///< RST flag (reset the connection).
+        static constexpr uint16_t kFlagPsh = 1 << 3; ///< PSH flag (push function).
+        static constexpr uint16_t kFlagAck = 1 << 4; ///< ACK flag (acknowledgment field is significant).
+
+        static constexpr uint16_t kDataOffsetShift = 12; ///< Bit offset of the Data Offset field within the flags.
+
+        /**
+         * This method initializes the TCP header, setting the given flags and the Data Offset to the header size
+         * (no TCP options) and clearing the Checksum and Urgent Pointer fields.
+         *
+         * @param[in] aFlags  The TCP flags (`kFlag*` constants).
+         *
+         */
+        void Init(uint16_t aFlags)
+        {
+            mFlags         = HostSwap16(static_cast<uint16_t>((sizeof(Header) / 4) << kDataOffsetShift) | aFlags);
+            mChecksum      = 0;
+            mUrgentPointer = 0;
+        }
+
+        /**
+         * This method returns the TCP Source Port.
+         *
+         * @returns The TCP Source Port.
+         *
+         */
+        uint16_t GetSourcePort(void) const { return HostSwap16(mSource); }
+
+        /**
+         * This method sets the TCP Source Port.
+         *
+         * @param[in] aPort  The TCP Source Port.
+         *
+         */
+        void SetSourcePort(uint16_t aPort) { mSource = HostSwap16(aPort); }
+
+        /**
+         * This method returns the TCP Destination Port.
+         *
+         * @returns The TCP Destination Port.
+         *
+         */
+        uint16_t GetDestinationPort(void) const { return HostSwap16(mDestination); }
+
+        /**
+         * This method sets the TCP Destination Port.
+         *
+         * @param[in] aPort  The TCP Destination Port.
+         *
+         */
+        void SetDestinationPort(uint16_t aPort) { mDestination = HostSwap16(aPort); }
+
+        /**
+         * This method returns the TCP Sequence Number.
+         *
+         * @returns The TCP Sequence Number.
+         *
+         */
+        uint32_t GetSequenceNumber(void) const { return HostSwap32(mSequenceNumber); }
+
+        /**
+         * This method sets the TCP Sequence Number.
+         *
+         * @param[in] aSequenceNumber  The TCP Sequence Number.
+         *
+         */
+        void SetSequenceNumber(uint32_t aSequenceNumber) { mSequenceNumber = HostSwap32(aSequenceNumber); }
+
+        /**
+         * This method returns the TCP Acknowledgment Sequence Number.
+         *
+         * @returns The TCP Acknowledgment Sequence Number.
+         *
+         */
+        uint32_t GetAcknowledgmentNumber(void) const { return HostSwap32(mAckNumber); }
+
+        /**
+         * This method sets the TCP Acknowledgment Sequence Number.
+         *
+         * @param[in] aAckNumber  The TCP Acknowledgment Sequence Number.
+         *
+         */
+        void SetAcknowledgmentNumber(uint32_t aAckNumber) { mAckNumber = HostSwap32(aAckNumber); }
+
+        /**
+         * This method returns the TCP Flags.
+         *
+         * @returns The TCP Flags.
+         *
+         */
+        uint16_t GetFlags(void) const { return HostSwap16(mFlags); }
+
+        /**
+         * This method returns the TCP header size derived from the Data Offset field.
+         *
+         * @returns The TCP header size (in bytes).
+         *
+         */
+        uint8_t GetHeaderSize(void) const { return static_cast<uint8_t>((GetFlags() >> kDataOffsetShift) * 4); }
+
+        /**
+         * This method returns the TCP Window.
+         *
+         * @returns The TCP Window.
+         *
+         */
+        uint16_t GetWindow(void) const { return HostSwap16(mWindow); }
+
+        /**
+         * This method sets the TCP Window.
+         *
+         * @param[in] aWindow  The TCP Window.
+         *
+         */
+        void SetWindow(uint16_t aWindow) { mWindow = HostSwap16(aWindow); }
+
+        /**
+         * This method returns the TCP Checksum.
+         *
+         * @returns The TCP Checksum.
+         *
+         */
+        uint16_t GetChecksum(void) const { return HostSwap16(mChecksum); }
+
+        /**
+         * This method returns the TCP Urgent Pointer.
+         *
+         * @returns The TCP Urgent Pointer.
+         *
+         */
+        uint16_t GetUrgentPointer(void) const { return HostSwap16(mUrgentPointer); }
+
+    private:
+        uint16_t mSource;
+        uint16_t mDestination;
+        uint32_t mSequenceNumber;
+        uint32_t mAckNumber;
+        uint16_t mFlags;
+        uint16_t mWindow;
+        uint16_t mChecksum;
+        uint16_t mUrgentPointer;
+    } OT_TOOL_PACKED_END;
+
     /**
      * This class represents an endpoint of a TCP/IPv6 connection.
      *
@@ -339,12 +494,86 @@ public:
             kNumTimers         = 4,
         };
 
+        enum : uint8_t
+        {
+            kTimerFlagDelack       = 1 << kTimerDelack,
+            kTimerFlagRexmtPersist = 1 << kTimerRexmtPersist,
+            kTimerFlagKeep         = 1 << kTimerKeep,
+            kTimerFlag2Msl         = 1 << kTimer2Msl,
+        };
+
+        // TCP connection states (`mState`).
+        enum : uint8_t
+        {
+            kStateClosed = 0,  // No connection (initial state).
+            kStateReady,       // `Connect()` recorded the peer; handshake starts on first send (TCP Fast Open).
+            kStateSynSent,     // SYN sent, awaiting SYN-ACK (active open).
+            kStateSynReceived, // SYN received and SYN-ACK sent, awaiting ACK (passive open).
+            kStateEstablished, // Connection established.
+            kStateFinWait1,    // FIN sent, awaiting its acknowledgment (or peer's FIN).
+            kStateFinWait2,    // FIN acknowledged, awaiting peer's FIN.
+            kStateCloseWait,   // Peer's FIN received, local end still open for sending.
+            kStateClosing,     // Both FINs exchanged, awaiting acknowledgment of ours.
+            kStateLastAck,     // FIN sent after peer's FIN, awaiting its acknowledgment.
+            kStateTimeWait,    // Connection done, lingering to absorb delayed segments.
+        };
+
+        // Internal state flags (`mInternalFlags`).
+        enum : uint8_t
+        {
+            kFlagFinQueued   = 1 << 0, // `SendEndOfStream()` was called; FIN follows the queued data.
+            kFlagFinSent     = 1 << 1, // Our FIN has been transmitted (occupies sequence space).
+            kFlagFinAcked    = 1 << 2, // Our FIN has been acknowledged by the peer.
+            kFlagFinReceived = 1 << 3, // The peer's FIN has been received (end of incoming stream).
+            kFlagRttTiming   = 1 << 4, // A segment transmission is currently being timed for RTT.
+        };
+
+        static constexpr uint16_t kMaxSegmentSize =
+            OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH - sizeof(ot::Ip6::Header) - sizeof(Header);
+
+        static constexpr uint32_t kMinRto          = 1000;      // Minimum retransmission timeout (in msec, RFC 6298).
+        static constexpr uint32_t kMaxRto          = 60 * 1000; // Maximum retransmission timeout (in msec).
+        static constexpr uint32_t kRttGranularity  = 100;       // Assumed clock granularity "G" (in msec, RFC 6298).
+        static constexpr uint32_t kTimeWaitTime    = 60 * 1000; // Time spent in TIME-WAIT state (2 * MSL, in msec).
+        static constexpr uint8_t  kMaxRetries      = 12;        // Max retransmissions before dropping a connection.
+        static constexpr uint8_t  kDupAckThreshold = 3;         // Duplicate ACKs triggering a fast retransmit.
+
         static uint8_t TimerFlagToIndex(uint8_t aTimerFlag);
 
         bool IsTimerActive(uint8_t aTimerIndex);
         void SetTimer(uint8_t aTimerFlag, uint32_t aDelay);
         void CancelTimer(uint8_t aTimerFlag);
         bool FirePendingTimers(TimeMilli aNow, bool &aHasFutureTimer, TimeMilli &aEarliestFutureExpiry);
+        bool HandleTimerExpiry(uint8_t aTimerIndex, TimeMilli aNow);
+
+        bool Matches(const MessageInfo &aMessageInfo) const;
+
+        void  StartHandshake(void);
+        void  SendPending(void);
+        Error SendSegment(uint16_t aFlags, uint32_t aSequenceNumber, uint16_t aPayloadLength);
+        Error AppendSendData(Message &aMessage, uint32_t aSequenceNumber, uint16_t aLength);
+        void  Retransmit(void);
+
+        void HandleSegment(const Header & aHeader,
+                           const Message &aMessage,
+                           uint16_t       aPayloadOffset,
+                           uint16_t       aPayloadLength,
+                           const MessageInfo &aMessageInfo);
+        void ProcessAck(uint32_t aAckNumber, uint16_t aWindow, bool aCanBeDupAck);
+        void ProcessPayload(uint32_t       aSegmentSeq,
+                            const Message &aMessage,
+                            uint16_t       aPayloadOffset,
+                            uint16_t       aPayloadLength,
+                            bool           aFin);
+
+        void UpdateRtt(TimeMilli aNow);
+        void HandleFinAcked(void);
+        void EnterTimeWait(void);
+        void Disconnect(otTcpDisconnectedReason aReason);
+        void ResetConnectionState(void);
+
+        uint16_t GetReceiveWindow(void) const;
+        void     SignalReceiveAvailable(void);
     };
 
     /**
@@ -440,91 +669,6 @@ public:
         Error Deinitialize(void);
     };
 
-    /**
-     * This class implements TCP header parsing.
-     *
-     */
-    OT_TOOL_PACKED_BEGIN
-    class Header
-    {
-    public:
-        static constexpr uint8_t kChecksumFieldOffset = 16; ///< Byte offset of the Checksum field in the TCP header.
-
-        /**
-         * This method returns the TCP Source Port.
-         *
-         * @returns The TCP Source Port.
-         *
-         */
-        uint16_t GetSourcePort(void) const { return HostSwap16(mSource); }
-
-        /**
-         * This method returns the TCP Destination Port.
-         *
-         * @returns The TCP Destination Port.
-         *
-         */
-        uint16_t GetDestinationPort(void) const { return HostSwap16(mDestination); }
-
-        /**
-         * This method returns the TCP Sequence Number.
-         *
-         * @returns The TCP Sequence Number.
-         *
-         */
-        uint32_t GetSequenceNumber(void) const { return HostSwap32(mSequenceNumber); }
-
-        /**
-         * This method returns the TCP Acknowledgment Sequence Number.
-         *
-         * @returns The TCP Acknowledgment Sequence Number.
-         *
-         */
-        uint32_t GetAcknowledgmentNumber(void) const { return HostSwap32(mAckNumber); }
-
-        /**
-         * This method returns the TCP Flags.
-         *
-         * @returns The TCP Flags.
-         *
-         */
-        uint16_t GetFlags(void) const { return HostSwap16(mFlags); }
-
-        /**
-         * This method returns the TCP Window.
-         *
-         * @returns The TCP Window.
-         *
-         */
-        uint16_t GetWindow(void) const { return HostSwap16(mWindow); }
-
-        /**
-         * This method returns the TCP Checksum.
-         *
-         * @returns The TCP Checksum.
-         *
-         */
-        uint16_t GetChecksum(void) const { return HostSwap16(mChecksum); }
-
-        /**
-         * This method returns the TCP Urgent Pointer.
-         *
-         * @returns The TCP Urgent Pointer.
-         *
-         */
-        uint16_t GetUrgentPointer(void) const { return HostSwap16(mUrgentPointer); }
-
-    private:
-        uint16_t mSource;
-        uint16_t mDestination;
-        uint32_t mSequenceNumber;
-        uint32_t mAckNumber;
-        uint16_t mFlags;
-        uint16_t mWindow;
-        uint16_t mChecksum;
-        uint16_t mUrgentPointer;
-    } OT_TOOL_PACKED_END;
-
     /**
      * This constructor initializes the object.
      *
@@ -556,6 +700,12 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        ProcessTimers(void);
 
+    Endpoint *FindEndpoint(const MessageInfo &aMessageInfo);
+    Listener *FindListener(const MessageInfo &aMessageInfo);
+    void      HandleIncomingConnection(Listener &aListener, const Header &aHeader, const MessageInfo &aMessageInfo);
+    void      SendReset(const Header &aHeader, uint16_t aPayloadLength, const MessageInfo &aMessageInfo);
+    uint16_t  GetEphemeralPort(void);
+
     TimerMilli mTimer;
 
     LinkedList<Endpoint> mEndpoints;
@@ -161,6 +161,14 @@ exit:
 Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+    , mDemuxCacheValid(false)
+    , mDemuxCacheHits(0)
+    , mDemuxCacheMisses(0)
+#endif
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    , mRxReserveDrops(0)
+#endif
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     , mPrevBackboneSockets(nullptr)
 #endif
@@ -169,6 +177,15 @@ Udp::Udp(Instance &aInstance)
     , mUdpForwarder(nullptr)
 #endif
 {
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    for (RxSocketAccounting &entry : mRxAccounting)
+    {
+        entry.mSocket      = nullptr;
+        entry.mWindowStart = TimeMilli(0);
+        entry.mWindowBytes = 0;
+        entry.mDropCount   = 0;
+    }
+#endif
 }
 
 Error Udp::AddReceiver(Receiver &aReceiver)
@@ -231,6 +248,10 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr, otNetifIdentif
 
     aSocket.mSockName = aSockAddr;
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+    mDemuxCacheValid = false;
+#endif
+
     if (!aSocket.IsBound())
     {
         do
@@ -389,6 +410,10 @@ void Udp::AddSocket(SocketHandle &aSocket)
 {
     SuccessOrExit(mSockets.Add(aSocket));
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+    mDemuxCacheValid = false;
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     if (mPrevBackboneSockets == nullptr)
     {
@@ -408,6 +433,20 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
     mSockets.PopAfter(prev);
     aSocket.SetNext(nullptr);
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+    mDemuxCacheValid = false;
+#endif
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    for (RxSocketAccounting &entry : mRxAccounting)
+    {
+        if (entry.mSocket == &aSocket)
+        {
+            entry.mSocket = nullptr;
+        }
+    }
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     if (&aSocket == mPrevBackboneSockets)
     {
@@ -419,6 +458,169 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+
+void Udp::RebuildDemuxCache(void)
+{
+    const SocketHandle *end = nullptr;
+
+    memset(mDemuxCache, 0, sizeof(mDemuxCache));
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    // Only Thread netif sockets are cached. Host interface (backbone)
+    // traffic always uses the linked-list scan.
+    end = GetBackboneSockets();
+#endif
+
+    for (SocketHandle *socket = mSockets.GetHead(); socket != end; socket = socket->GetNext())
+    {
+        uint16_t port = socket->GetSockName().mPort;
+
+        if (port != 0)
+        {
+            DemuxCacheEntry &entry = mDemuxCache[port % kDemuxCacheSize];
+
+            if (entry.mPort == 0)
+            {
+                entry.mPort   = port;
+                entry.mSocket = socket;
+            }
+            else
+            {
+                // Another socket (bound to the same or a colliding
+                // port) already claimed this entry. Mark the entry as
+                // collided so lookups for either port fall back to the
+                // linked-list scan, preserving its first-match order.
+                entry.mSocket = nullptr;
+            }
+        }
+    }
+}
+
+Udp::DemuxCacheEntry &Udp::FindDemuxCacheEntry(uint16_t aPort)
+{
+    if (!mDemuxCacheValid)
+    {
+        RebuildDemuxCache();
+        mDemuxCacheValid = true;
+    }
+
+    return mDemuxCache[aPort % kDemuxCacheSize];
+}
+
+#endif // OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+
+bool Udp::IsPrioritySocket(const SocketHandle &aSocket)
+{
+    uint16_t port = aSocket.GetSockName().GetPort();
+
+    return (port == Mle::kUdpPort) || (port == Tmf::kUdpPort);
+}
+
+bool Udp::ShouldDropReceivedMessage(const SocketHandle &aSocket, uint16_t aPayloadLength)
+{
+    bool      drop = false;
+    TimeMilli now  = TimerMilli::GetNow();
+
+    // Control-plane (MLE and TMF) sockets inherit priority: they are
+    // never rate limited and may consume the reserved buffers.
+    VerifyOrExit(!IsPrioritySocket(aSocket));
+
+    if (Get<MessagePool>().GetFreeBufferCount() < kRxBacklogReservedBuffers)
+    {
+        mRxReserveDrops++;
+        drop = true;
+    }
+
+    {
+        RxSocketAccounting &accounting = FindOrAddRxAccounting(aSocket);
+
+        if (now - accounting.mWindowStart >= kRxBacklogWindow)
+        {
+            accounting.mWindowStart = now;
+            accounting.mWindowBytes = 0;
+        }
+
+        if (drop)
+        {
+            accounting.mDropCount++;
+            ExitNow();
+        }
+
+        if (static_cast<uint32_t>(accounting.mWindowBytes) + aPayloadLength > kRxBacklogBytesPerWindow)
+        {
+            accounting.mDropCount++;
+            drop = true;
+        }
+        else
+        {
+            accounting.mWindowBytes += aPayloadLength;
+        }
+    }
+
+exit:
+    return drop;
+}
+
+Udp::RxSocketAccounting &Udp::FindOrAddRxAccounting(const SocketHandle &aSocket)
+{
+    RxSocketAccounting *match = nullptr;
+    RxSocketAccounting *freeEntry = nullptr;
+    RxSocketAccounting *oldest;
+
+    oldest = &mRxAccounting[0];
+
+    for (RxSocketAccounting &entry : mRxAccounting)
+    {
+        if (entry.mSocket == &aSocket)
+        {
+            match = &entry;
+            break;
+        }
+
+        if (entry.mSocket == nullptr)
+        {
+            freeEntry = &entry;
+        }
+        else if (entry.mWindowStart < oldest->mWindowStart)
+        {
+            oldest = &entry;
+        }
+    }
+
+    if (match == nullptr)
+    {
+        match = (freeEntry != nullptr) ? freeEntry : oldest;
+
+        match->mSocket      = &aSocket;
+        match->mWindowStart = TimerMilli::GetNow();
+        match->mWindowBytes = 0;
+        match->mDropCount   = 0;
+    }
+
+    return *match;
+}
+
+uint32_t Udp::GetSocketRxDropCount(const SocketHandle &aSocket) const
+{
+    uint32_t count = 0;
+
+    for (const RxSocketAccounting &entry : mRxAccounting)
+    {
+        if (entry.mSocket == &aSocket)
+        {
+            count = entry.mDropCount;
+            break;
+        }
+    }
+
+    return count;
+}
+
+#endif // OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+
 uint16_t Udp::GetEphemeralPort(void)
 {
     do
@@ -505,11 +707,41 @@ exit:
 
 void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
-    SocketHandle *socket;
+    SocketHandle *socket = nullptr;
     SocketHandle *prev;
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    uint64_t profileEnterTime = Get<Utils::PipelineProfiler>().GetNow();
+#endif
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    if (!aMessageInfo.IsHostInterface())
+#endif
     {
+        DemuxCacheEntry &entry = FindDemuxCacheEntry(aMessageInfo.GetSockPort());
+
+        if ((entry.mSocket != nullptr) && (entry.mPort == aMessageInfo.GetSockPort()))
+        {
+            // The entry holds the only socket bound to this port, so
+            // the linked-list scan can be skipped: either this socket
+            // matches or none does.
+
+            mDemuxCacheHits++;
+            VerifyOrExit(entry.mSocket->Matches(aMessageInfo));
+            entry.mRxCount++;
+            socket = entry.mSocket;
+        }
+        else
+        {
+            mDemuxCacheMisses++;
+        }
+    }
+
+#endif // OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+
+    if (socket == nullptr)
+    {
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
         const SocketHandle *socketsBegin, *socketsEnd;
 
         if (!aMessageInfo.IsHostInterface())
@@ -524,18 +756,25 @@ void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
         }
 
         socket = mSockets.FindMatching(socketsBegin, socketsEnd, aMessageInfo, prev);
-    }
 #else
-    socket = mSockets.FindMatching(aMessageInfo, prev);
+        socket = mSockets.FindMatching(aMessageInfo, prev);
 #endif
+    }
 
     VerifyOrExit(socket != nullptr);
 
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    VerifyOrExit(!ShouldDropReceivedMessage(*socket, aMessage.GetLength() - aMessage.GetOffset()));
+#endif
+
     aMessage.RemoveHeader(aMessage.GetOffset());
     OT_ASSERT(aMessage.GetOffset() == 0);
     socket->HandleUdpReceive(aMessage, aMessageInfo);
 
 exit:
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    Get<Utils::PipelineProfiler>().Sample(Utils::PipelineProfiler::kStageUdp, profileEnterTime);
+#endif
     return;
 }
 
@@ -611,6 +611,44 @@ public:
      */
     bool ShouldUsePlatformUdp(uint16_t aPort) const;
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+    /**
+     * This method returns the number of inbound datagrams demultiplexed directly from the demux cache.
+     *
+     * @returns The number of demux cache hits.
+     *
+     */
+    uint32_t GetDemuxCacheHits(void) const { return mDemuxCacheHits; }
+
+    /**
+     * This method returns the number of inbound datagrams that fell back to the socket linked-list scan.
+     *
+     * @returns The number of demux cache misses.
+     *
+     */
+    uint32_t GetDemuxCacheMisses(void) const { return mDemuxCacheMisses; }
+#endif
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    /**
+     * This method returns the number of inbound datagrams dropped on a given socket by the receive backlog limiter.
+     *
+     * @param[in]  aSocket  The socket to query.
+     *
+     * @returns The number of dropped inbound datagrams for @p aSocket (zero if the socket is not tracked).
+     *
+     */
+    uint32_t GetSocketRxDropCount(const SocketHandle &aSocket) const;
+
+    /**
+     * This method returns the total number of inbound datagrams dropped to protect the reserved buffer count.
+     *
+     * @returns The number of inbound datagrams dropped while the free buffer count was below the reserve.
+     *
+     */
+    uint32_t GetRxReserveDropCount(void) const { return mRxReserveDrops; }
+#endif
+
 private:
     static constexpr uint16_t kDynamicPortMin = 49152; // Service Name and Transport Protocol Port Number Registry
     static constexpr uint16_t kDynamicPortMax = 65535; // Service Name and Transport Protocol Port Number Registry
@@ -621,6 +659,44 @@ private:
 
     static bool IsPortReserved(uint16_t aPort);
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+    static constexpr uint16_t kDemuxCacheSize = OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_SIZE;
+
+    // An entry holds the only cached socket bound to `mPort`, along with
+    // the number of datagrams delivered to it from the cache. A cleared
+    // `mSocket` with a non-zero `mPort` marks a hash collision.
+    struct DemuxCacheEntry
+    {
+        uint16_t      mPort;
+        SocketHandle *mSocket;
+        uint32_t      mRxCount;
+    };
+
+    void             RebuildDemuxCache(void);
+    DemuxCacheEntry &FindDemuxCacheEntry(uint16_t aPort);
+#endif
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    static constexpr uint16_t kRxBacklogReservedBuffers = OPENTHREAD_CONFIG_UDP_RX_BACKLOG_RESERVED_BUFFERS;
+    static constexpr uint16_t kRxBacklogBytesPerWindow  = OPENTHREAD_CONFIG_UDP_RX_BACKLOG_BYTES_PER_WINDOW;
+    static constexpr uint32_t kRxBacklogWindow          = OPENTHREAD_CONFIG_UDP_RX_BACKLOG_WINDOW;
+    static constexpr uint16_t kRxBacklogNumTracked      = OPENTHREAD_CONFIG_UDP_RX_BACKLOG_NUM_TRACKED_SOCKETS;
+
+    // Per-socket receive accounting for the current window, tracked
+    // for application (non control-plane) sockets only.
+    struct RxSocketAccounting
+    {
+        const SocketHandle *mSocket;
+        TimeMilli           mWindowStart;
+        uint16_t            mWindowBytes;
+        uint32_t            mDropCount;
+    };
+
+    static bool         IsPrioritySocket(const SocketHandle &aSocket);
+    bool                ShouldDropReceivedMessage(const SocketHandle &aSocket, uint16_t aPayloadLength);
+    RxSocketAccounting &FindOrAddRxAccounting(const SocketHandle &aSocket);
+#endif
+
     void AddSocket(SocketHandle &aSocket);
     void RemoveSocket(SocketHandle &aSocket);
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
@@ -636,6 +712,16 @@ private:
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+#if OPENTHREAD_CONFIG_UDP_SOCKET_DEMUX_CACHE_ENABLE
+    DemuxCacheEntry mDemuxCache[kDemuxCacheSize];
+    bool            mDemuxCacheValid;
+    uint32_t        mDemuxCacheHits;
+    uint32_t        mDemuxCacheMisses;
+#endif
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    RxSocketAccounting mRxAccounting[kRxBacklogNumTracked];
+    uint32_t           mRxReserveDrops;
+#endif
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SocketHandle *mPrevBackboneSockets;
 #endif
@@ -63,6 +63,7 @@
 #include "config/channel_monitor.h"
 #include "config/child_supervision.h"
 #include "config/coap.h"
+#include "config/coex_monitor.h"
 #include "config/commissioner.h"
 #include "config/dataset_updater.h"
 #include "config/dhcp6_client.h"
@@ -71,18 +72,22 @@
 #include "config/dns_client.h"
 #include "config/dnssd_server.h"
 #include "config/dtls.h"
+#include "config/frame_capture.h"
 #include "config/history_tracker.h"
 #include "config/ip6.h"
 #include "config/joiner.h"
 #include "config/link_quality.h"
 #include "config/link_raw.h"
 #include "config/logging.h"
+#include "config/lowpan.h"
 #include "config/mac.h"
 #include "config/mle.h"
 #include "config/netdata_publisher.h"
 #include "config/parent_search.h"
 #include "config/ping_sender.h"
+#include "config/pipeline_profiler.h"
 #include "config/platform.h"
+#include "config/pool.h"
 #include "config/radio_link.h"
 #include "config/sntp_client.h"
 #include "config/srp_client.h"
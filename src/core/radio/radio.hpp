@@ -317,6 +317,17 @@ public:
      */
     Error SetTransmitPower(int8_t aPower);
 
+    /**
+     * This method gets the radio coexistence metrics.
+     *
+     * @param[out] aMetrics    A reference to output the coexistence metrics.
+     *
+     * @retval kErrorNone             Successfully retrieved the coex metrics.
+     * @retval kErrorNotImplemented   Radio coex metrics are not supported.
+     *
+     */
+    Error GetCoexMetrics(otRadioCoexMetrics &aMetrics);
+
     /**
      * This method gets the radio's CCA ED threshold in dBm.
      *
@@ -521,6 +532,25 @@ public:
      */
     Error EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration);
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    /**
+     * This method begins an autonomous batched energy scan sequence on the radio.
+     *
+     * The radio samples every channel in @p aChannelMask once per @p aSampleInterval for @p aSampleCount intervals
+     * and reports aggregated per-channel occupancy counts via `otPlatRadioEnergyScanBatchDone()`.
+     *
+     * @param[in] aChannelMask     The channel mask to sample.
+     * @param[in] aSampleInterval  The interval between samples, in milliseconds.
+     * @param[in] aSampleCount     The number of sample intervals to aggregate into one report.
+     * @param[in] aRssiThreshold   The RSSI threshold in dBm used for the occupancy counts.
+     *
+     * @retval kErrorNone            Successfully started the batched scan sequence.
+     * @retval kErrorNotImplemented  The radio doesn't support batched energy scanning.
+     *
+     */
+    Error EnergyScanBatch(uint32_t aChannelMask, uint32_t aSampleInterval, uint16_t aSampleCount, int8_t aRssiThreshold);
+#endif
+
     /**
      * This method enables/disables source address match feature.
      *
@@ -732,6 +762,11 @@ inline Error Radio::SetTransmitPower(int8_t aPower)
     return otPlatRadioSetTransmitPower(GetInstancePtr(), aPower);
 }
 
+inline Error Radio::GetCoexMetrics(otRadioCoexMetrics &aMetrics)
+{
+    return otPlatRadioGetCoexMetrics(GetInstancePtr(), &aMetrics);
+}
+
 inline Error Radio::GetCcaEnergyDetectThreshold(int8_t &aThreshold)
 {
     return otPlatRadioGetCcaEnergyDetectThreshold(GetInstancePtr(), &aThreshold);
@@ -826,6 +861,16 @@ inline Error Radio::EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration)
     return otPlatRadioEnergyScan(GetInstancePtr(), aScanChannel, aScanDuration);
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+inline Error Radio::EnergyScanBatch(uint32_t aChannelMask,
+                                    uint32_t aSampleInterval,
+                                    uint16_t aSampleCount,
+                                    int8_t   aRssiThreshold)
+{
+    return otPlatRadioEnergyScanBatch(GetInstancePtr(), aChannelMask, aSampleInterval, aSampleCount, aRssiThreshold);
+}
+#endif
+
 inline void Radio::EnableSrcMatch(bool aEnable)
 {
     otPlatRadioEnableSrcMatch(GetInstancePtr(), aEnable);
@@ -903,6 +948,11 @@ inline Error Radio::SetTransmitPower(int8_t)
     return kErrorNotImplemented;
 }
 
+inline Error Radio::GetCoexMetrics(otRadioCoexMetrics &)
+{
+    return kErrorNotImplemented;
+}
+
 inline Error Radio::GetCcaEnergyDetectThreshold(int8_t &)
 {
     return kErrorNotImplemented;
@@ -1000,6 +1050,13 @@ inline Error Radio::EnergyScan(uint8_t, uint16_t)
     return kErrorNotImplemented;
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+inline Error Radio::EnergyScanBatch(uint32_t, uint32_t, uint16_t, int8_t)
+{
+    return kErrorNotImplemented;
+}
+#endif
+
 inline void Radio::EnableSrcMatch(bool)
 {
 }
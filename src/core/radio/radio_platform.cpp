@@ -36,6 +36,7 @@
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "radio/radio.hpp"
+#include "utils/channel_monitor.hpp"
 
 using namespace ot;
 
@@ -115,6 +116,29 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+extern "C" void otPlatRadioEnergyScanBatchDone(otInstance *    aInstance,
+                                               uint32_t        aChannelMask,
+                                               const uint16_t *aAboveThresholdCounts)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    VerifyOrExit(instance.IsInitialized());
+    instance.Get<Utils::ChannelMonitor>().HandleEnergyScanBatchDone(aChannelMask, aAboveThresholdCounts);
+
+exit:
+    return;
+}
+#else
+// The channel monitor (and thus the batch report consumer) is not
+// present in radio-only builds.
+extern "C" void otPlatRadioEnergyScanBatchDone(otInstance *, uint32_t, const uint16_t *)
+{
+}
+#endif
+#endif
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
 extern "C" void otPlatDiagRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
 {
@@ -162,6 +186,12 @@ extern "C" void otPlatRadioEnergyScanDone(otInstance *, int8_t)
 {
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+extern "C" void otPlatRadioEnergyScanBatchDone(otInstance *, uint32_t, const uint16_t *)
+{
+}
+#endif
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
 extern "C" void otPlatDiagRadioReceiveDone(otInstance *, otRadioFrame *, otError)
 {
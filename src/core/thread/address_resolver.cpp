@@ -57,8 +57,27 @@ AddressResolver::AddressResolver(Instance &aInstance)
     , mAddressQuery(UriPath::kAddressQuery, &AddressResolver::HandleAddressQuery, this)
     , mAddressNotification(UriPath::kAddressNotify, &AddressResolver::HandleAddressNotification, this)
     , mCacheEntryPool(aInstance)
+    , mCacheEntryCounters()
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    , mCoalesceTimer(aInstance, AddressResolver::HandleCoalesceTimer)
+    , mLastTokenAddTime(0)
+    , mAnswerTokens(kAnswerTokenBucketSize)
+#endif
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 {
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+    mCacheEntryPool.SetName("AddrCacheEntry");
+#endif
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    for (PendingAnswer &answer : mPendingAnswers)
+    {
+        answer.Clear();
+    }
+
+    mAnswerCounters.Clear();
+#endif
+
     Get<Tmf::Agent>().AddResource(mAddressError);
     Get<Tmf::Agent>().AddResource(mAddressQuery);
     Get<Tmf::Agent>().AddResource(mAddressNotification);
@@ -214,12 +233,13 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntry *&       aPrevEntry)
 {
     CacheEntry *    entry   = nullptr;
+    EidKey          key(aEid);
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
     for (CacheEntryList *list : lists)
     {
         aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
+        entry = aList->FindMatching(key, aPrevEntry);
         VerifyOrExit(entry == nullptr);
     }
 
@@ -427,6 +447,36 @@ exit:
     return;
 }
 
+Error AddressResolver::PreloadCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
+{
+    Error       error = kErrorNone;
+    CacheEntry *entry;
+
+    VerifyOrExit(Get<Mle::MleRouter>().IsFullThreadDevice(), error = kErrorInvalidState);
+
+    VerifyOrExit(UpdateCacheEntry(aEid, aRloc16) != kErrorNone);
+
+    entry = NewCacheEntry(/* aSnoopedEntry */ true);
+    VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
+
+    entry->SetTarget(aEid);
+    entry->SetRloc16(aRloc16);
+
+    // Unlike snooped entries added from received messages, preloaded
+    // entries are always evictable (with no timeout), so that entries
+    // learned from live traffic can readily replace them.
+
+    entry->SetCanEvict(true);
+    entry->SetTimeout(0);
+
+    mSnoopedList.Push(*entry);
+
+    LogCacheEntryChange(kEntryAdded, kReasonPreload, *entry);
+
+exit:
+    return error;
+}
+
 void AddressResolver::RestartAddressQueries(void)
 {
     CacheEntry *tail;
@@ -455,6 +505,31 @@ void AddressResolver::RestartAddressQueries(void)
         entry.SetTimeout(kAddressQueryTimeout);
         entry.SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry.SetCanEvict(false);
+        entry.ClearFailureCount();
+    }
+}
+
+void AddressResolver::UpdateCacheEntryCounters(const CacheEntryList *aList, bool aHit)
+{
+    if (!aHit)
+    {
+        mCacheEntryCounters.mMisses++;
+    }
+    else if (aList == &mCachedList)
+    {
+        mCacheEntryCounters.mCachedHits++;
+    }
+    else if (aList == &mSnoopedList)
+    {
+        mCacheEntryCounters.mSnoopedHits++;
+    }
+    else if (aList == &mQueryList)
+    {
+        mCacheEntryCounters.mQueryHits++;
+    }
+    else if (aList == &mQueryRetryList)
+    {
+        mCacheEntryCounters.mQueryRetryHits++;
     }
 }
 
@@ -466,6 +541,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     CacheEntryList *list;
 
     entry = FindCacheEntry(aEid, list, prev);
+    UpdateCacheEntryCounters(list, (entry != nullptr));
 
     if (entry == nullptr)
     {
@@ -482,6 +558,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         entry->SetRloc16(Mac::kShortAddrInvalid);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
+        entry->ClearFailureCount();
         list = nullptr;
     }
 
@@ -509,7 +586,11 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 
     if (list == &mQueryList)
     {
-        ExitNow(error = kErrorAddressQuery);
+        // For a negatively cached EID (repeatedly timed out address
+        // queries), fail fast instead of queuing the message while
+        // the in-progress query is pending.
+
+        ExitNow(error = IsNegativelyCached(*entry) ? kErrorDrop : kErrorAddressQuery);
     }
 
     if (list == &mQueryRetryList)
@@ -533,7 +614,11 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
     }
 
     mQueryList.Push(*entry);
-    error = kErrorAddressQuery;
+
+    // A query is still sent for a negatively cached EID (so it can
+    // recover when the destination reappears), but the triggering
+    // message is dropped rather than queued.
+    error = IsNegativelyCached(*entry) ? kErrorDrop : kErrorAddressQuery;
 
 exit:
     return error;
@@ -597,7 +682,13 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     CacheEntry *             entry;
     CacheEntry *             prev;
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    // Coalesced answers to multiple queriers arrive as non-confirmable
+    // multicast messages.
+    VerifyOrExit(aMessage.IsPostRequest());
+#else
     VerifyOrExit(aMessage.IsConfirmablePostRequest());
+#endif
 
     SuccessOrExit(Tlv::Find<ThreadTargetTlv>(aMessage, target));
     SuccessOrExit(Tlv::Find<ThreadMeshLocalEidTlv>(aMessage, meshLocalIid));
@@ -644,9 +735,14 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
 
     LogCacheEntryChange(kEntryUpdated, kReasonReceivedNotification, *entry);
 
-    if (Get<Tmf::Agent>().SendEmptyAck(aMessage, aMessageInfo) == kErrorNone)
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    if (aMessage.IsConfirmable())
+#endif
     {
-        otLogInfoArp("Sending address notification acknowledgment");
+        if (Get<Tmf::Agent>().SendEmptyAck(aMessage, aMessageInfo) == kErrorNone)
+        {
+            otLogInfoArp("Sending address notification acknowledgment");
+        }
     }
 
     Get<MeshForwarder>().HandleResolved(target, kErrorNone);
@@ -798,8 +894,13 @@ void AddressResolver::HandleAddressQuery(Coap::Message &aMessage, const Ip6::Mes
 
     if (Get<ThreadNetif>().HasUnicastAddress(target))
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+        EnqueueAddressQueryResponse(target, Get<Mle::MleRouter>().GetMeshLocal64().GetIid(), nullptr,
+                                    aMessageInfo.GetPeerAddr());
+#else
         SendAddressQueryResponse(target, Get<Mle::MleRouter>().GetMeshLocal64().GetIid(), nullptr,
                                  aMessageInfo.GetPeerAddr());
+#endif
         ExitNow();
     }
 
@@ -813,7 +914,12 @@ void AddressResolver::HandleAddressQuery(Coap::Message &aMessage, const Ip6::Mes
         if (child.HasIp6Address(target))
         {
             lastTransactionTime = Time::MsecToSec(TimerMilli::GetNow() - child.GetLastHeard());
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+            EnqueueAddressQueryResponse(target, child.GetMeshLocalIid(), &lastTransactionTime,
+                                        aMessageInfo.GetPeerAddr());
+#else
             SendAddressQueryResponse(target, child.GetMeshLocalIid(), &lastTransactionTime, aMessageInfo.GetPeerAddr());
+#endif
             ExitNow();
         }
     }
@@ -844,7 +950,19 @@ void AddressResolver::SendAddressQueryResponse(const Ip6::Address &            a
 
     VerifyOrExit((message = Get<Tmf::Agent>().NewPriorityMessage()) != nullptr, error = kErrorNoBufs);
 
-    message->InitAsConfirmablePost();
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    if (aDestination.IsMulticast())
+    {
+        // A coalesced answer to multiple queriers is sent as a single
+        // non-confirmable multicast message.
+        message->InitAsNonConfirmablePost();
+    }
+    else
+#endif
+    {
+        message->InitAsConfirmablePost();
+    }
+
     SuccessOrExit(error = message->AppendUriPathOptions(UriPath::kAddressNotify));
     SuccessOrExit(error = message->SetPayloadMarker());
 
@@ -869,6 +987,156 @@ exit:
     FreeMessageOnError(message, error);
 }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+
+void AddressResolver::EnqueueAddressQueryResponse(const Ip6::Address &            aTarget,
+                                                  const Ip6::InterfaceIdentifier &aMeshLocalIid,
+                                                  const uint32_t *                aLastTransactionTime,
+                                                  const Ip6::Address &            aQuerier)
+{
+    PendingAnswer *answer = nullptr;
+
+    for (PendingAnswer &entry : mPendingAnswers)
+    {
+        if (entry.mInUse && (entry.mTarget == aTarget))
+        {
+            // A query for this target is already pending; absorb the
+            // new query into the pending answer.
+
+            if (entry.mQuerier != aQuerier)
+            {
+                entry.mMultipleQueriers = true;
+            }
+
+            mAnswerCounters.mCoalescedQueries++;
+            ExitNow();
+        }
+
+        if (!entry.mInUse && (answer == nullptr))
+        {
+            answer = &entry;
+        }
+    }
+
+    if (answer == nullptr)
+    {
+        // No room to buffer the answer; send it immediately (still
+        // subject to the token-bucket rate limit).
+
+        if (ConsumeAnswerToken())
+        {
+            SendAddressQueryResponse(aTarget, aMeshLocalIid, aLastTransactionTime, aQuerier);
+        }
+        else
+        {
+            mAnswerCounters.mDroppedAnswers++;
+            otLogNoteArp("Dropped address notification for %s (rate limit)", aTarget.ToString().AsCString());
+        }
+
+        ExitNow();
+    }
+
+    answer->mInUse                  = true;
+    answer->mMultipleQueriers       = false;
+    answer->mTarget                 = aTarget;
+    answer->mMeshLocalIid           = aMeshLocalIid;
+    answer->mQuerier                = aQuerier;
+    answer->mHasLastTransactionTime = (aLastTransactionTime != nullptr);
+    answer->mLastTransactionTime    = (aLastTransactionTime != nullptr) ? *aLastTransactionTime : 0;
+    answer->mExpireTime             = TimerMilli::GetNow() + kCoalesceWindow;
+
+    mCoalesceTimer.FireAtIfEarlier(answer->mExpireTime);
+
+exit:
+    return;
+}
+
+void AddressResolver::SendCoalescedAnswer(PendingAnswer &aAnswer)
+{
+    Ip6::Address destination;
+
+    if (!ConsumeAnswerToken())
+    {
+        mAnswerCounters.mDroppedAnswers++;
+        otLogNoteArp("Dropped address notification for %s (rate limit)", aAnswer.mTarget.ToString().AsCString());
+        ExitNow();
+    }
+
+    if (aAnswer.mMultipleQueriers)
+    {
+        destination.SetToRealmLocalAllRoutersMulticast();
+        mAnswerCounters.mMulticastAnswers++;
+    }
+    else
+    {
+        destination = aAnswer.mQuerier;
+    }
+
+    SendAddressQueryResponse(aAnswer.mTarget, aAnswer.mMeshLocalIid,
+                             aAnswer.mHasLastTransactionTime ? &aAnswer.mLastTransactionTime : nullptr, destination);
+
+exit:
+    return;
+}
+
+bool AddressResolver::ConsumeAnswerToken(void)
+{
+    bool     consumed  = false;
+    uint32_t newTokens = (TimerMilli::GetNow() - mLastTokenAddTime) / kAnswerTokenInterval;
+
+    if (newTokens > 0)
+    {
+        uint32_t tokens = mAnswerTokens + newTokens;
+
+        mAnswerTokens     = static_cast<uint8_t>(OT_MIN(tokens, static_cast<uint32_t>(kAnswerTokenBucketSize)));
+        mLastTokenAddTime = mLastTokenAddTime + newTokens * kAnswerTokenInterval;
+    }
+
+    if (mAnswerTokens > 0)
+    {
+        mAnswerTokens--;
+        consumed = true;
+    }
+
+    return consumed;
+}
+
+void AddressResolver::HandleCoalesceTimer(Timer &aTimer)
+{
+    aTimer.Get<AddressResolver>().HandleCoalesceTimer();
+}
+
+void AddressResolver::HandleCoalesceTimer(void)
+{
+    TimeMilli now      = TimerMilli::GetNow();
+    TimeMilli nextTime = now.GetDistantFuture();
+
+    for (PendingAnswer &answer : mPendingAnswers)
+    {
+        if (!answer.mInUse)
+        {
+            continue;
+        }
+
+        if (answer.mExpireTime <= now)
+        {
+            answer.mInUse = false;
+            SendCoalescedAnswer(answer);
+        }
+        else
+        {
+            nextTime = OT_MIN(nextTime, answer.mExpireTime);
+        }
+    }
+
+    if (nextTime != now.GetDistantFuture())
+    {
+        mCoalesceTimer.FireAt(nextTime);
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+
 void AddressResolver::HandleTimeTick(void)
 {
     bool continueRxingTicks = false;
@@ -926,6 +1194,7 @@ void AddressResolver::HandleTimeTick(void)
 
                 entry->SetRetryDelay(retryDelay);
                 entry->SetCanEvict(true);
+                entry->IncrementFailureCount();
 
                 // Move the entry from `mQueryList` to `mQueryRetryList`
                 mQueryList.PopAfter(prev);
@@ -1015,6 +1284,9 @@ void AddressResolver::LogCacheEntryChange(EntryChange       aChange,
     case kReasonSnoop:
         reason = "snoop";
         break;
+    case kReasonPreload:
+        reason = "preload";
+        break;
     case kReasonReceivedNotification:
         reason = "rx notification";
         break;
@@ -1069,6 +1341,24 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
     mNextIndex = kNoNextIndex;
+    mHash      = 0;
+}
+
+uint8_t AddressResolver::CacheEntry::CalculateHash(const Ip6::Address &aEid)
+{
+    uint8_t hash = 0;
+
+    for (uint8_t byte : aEid.mFields.m8)
+    {
+        hash ^= byte;
+    }
+
+    return hash;
+}
+
+bool AddressResolver::CacheEntry::Matches(const EidKey &aKey) const
+{
+    return (mHash == aKey.mHash) && (GetTarget() == aKey.mEid);
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
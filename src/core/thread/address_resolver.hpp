@@ -39,9 +39,11 @@
 #if OPENTHREAD_FTD
 
 #include "coap/coap.hpp"
+#include "common/clearable.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
@@ -144,6 +146,23 @@ public:
      */
     void UpdateSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16, Mac::ShortAddress aDest);
 
+    /**
+     * This method preloads a cache entry mapping a given EID to a RLOC16.
+     *
+     * The method is intended for hosts with a known (static) set of destinations to install the mappings at
+     * startup, avoiding the initial Address Query round trip per destination. The entry is added to the snooped
+     * list and is always evictable, so preloaded mappings never displace entries learned from live traffic.
+     *
+     * @param[in] aEid     A reference to the EID.
+     * @param[in] aRloc16  The RLOC16 corresponding to @p aEid.
+     *
+     * @retval kErrorNone          Successfully added (or updated) the cache entry.
+     * @retval kErrorInvalidState  The device is not a Full Thread Device (FTD).
+     * @retval kErrorNoBufs        No cache entry is available.
+     *
+     */
+    Error PreloadCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
+
     /**
      * This method returns the RLOC16 for a given EID, initiates an Address Query if allowed and the mapping is not
      * known.
@@ -196,6 +215,41 @@ public:
                           const Ip6::InterfaceIdentifier &aMeshLocalIid,
                           const Ip6::Address *            aDestination);
 
+    /**
+     * This method gets the EID cache lookup counters (per-list hits and overall misses).
+     *
+     * @returns The EID cache lookup counters.
+     *
+     */
+    const otCacheEntryCounters &GetCacheEntryCounters(void) const { return mCacheEntryCounters; }
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    /**
+     * This structure contains the Address Notification response coalescing counters.
+     *
+     */
+    struct AnswerCounters : public Clearable<AnswerCounters>
+    {
+        uint32_t mCoalescedQueries; ///< Number of queries absorbed into an already pending answer.
+        uint32_t mMulticastAnswers; ///< Number of coalesced answers sent multicast (multiple queriers).
+        uint32_t mDroppedAnswers;   ///< Number of answers dropped by the token-bucket rate limiter.
+    };
+
+    /**
+     * This method gets the Address Notification response coalescing counters.
+     *
+     * @returns The response coalescing counters.
+     *
+     */
+    const AnswerCounters &GetAnswerCounters(void) const { return mAnswerCounters; }
+
+    /**
+     * This method resets the Address Notification response coalescing counters.
+     *
+     */
+    void ResetAnswerCounters(void) { mAnswerCounters.Clear(); }
+#endif
+
 private:
     static constexpr uint16_t kCacheEntries                  = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES;
     static constexpr uint16_t kMaxNonEvictableSnoopedEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES;
@@ -206,9 +260,24 @@ private:
     static constexpr uint16_t kAddressQueryMaxRetryDelay     = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY;
     static constexpr uint16_t kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT;
 
+    // Number of consecutive address query timeouts after which an EID
+    // is negatively cached (zero disables negative caching).
+    static constexpr uint8_t kNegativeCacheThreshold = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_NEGATIVE_CACHE_THRESHOLD;
+
     static constexpr uint8_t kIteratorListIndex  = 0;
     static constexpr uint8_t kIteratorEntryIndex = 1;
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    // Aggregation window (msec) and token interval (msec) for
+    // coalesced Address Notification responses.
+    static constexpr uint32_t kCoalesceWindow        = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_WINDOW;
+    static constexpr uint16_t kCoalesceNumEntries    = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_NUM_ENTRIES;
+    static constexpr uint8_t  kAnswerTokenBucketSize = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_BUCKET_SIZE;
+    static constexpr uint32_t kAnswerTokenInterval   = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_TOKEN_INTERVAL;
+#endif
+
+    struct EidKey;
+
     class CacheEntry : public InstanceLocatorInit
     {
     public:
@@ -218,8 +287,15 @@ private:
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
 
+        static uint8_t CalculateHash(const Ip6::Address &aEid);
+
         const Ip6::Address &GetTarget(void) const { return mTarget; }
-        void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
+
+        void SetTarget(const Ip6::Address &aTarget)
+        {
+            mTarget = aTarget;
+            mHash   = CalculateHash(aTarget);
+        }
 
         Mac::ShortAddress GetRloc16(void) const { return mRloc16; }
         void              SetRloc16(Mac::ShortAddress aRloc16) { mRloc16 = aRloc16; }
@@ -240,10 +316,21 @@ private:
         uint16_t GetRetryDelay(void) const { return mInfo.mOther.mRetryDelay; }
         void     SetRetryDelay(uint16_t aDelay) { mInfo.mOther.mRetryDelay = aDelay; }
 
+        uint8_t GetFailureCount(void) const { return mInfo.mOther.mFailures; }
+        void    ClearFailureCount(void) { mInfo.mOther.mFailures = 0; }
+        void    IncrementFailureCount(void)
+        {
+            if (mInfo.mOther.mFailures < NumericLimits<uint8_t>::kMax)
+            {
+                mInfo.mOther.mFailures++;
+            }
+        }
+
         bool CanEvict(void) const { return mInfo.mOther.mCanEvict; }
         void SetCanEvict(bool aCanEvict) { mInfo.mOther.mCanEvict = aCanEvict; }
 
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
+        bool Matches(const EidKey &aKey) const;
 
     private:
         static constexpr uint16_t kNoNextIndex          = 0xffff;     // `mNextIndex` value when at end of list.
@@ -252,6 +339,7 @@ private:
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+        uint8_t           mHash;
 
         union
         {
@@ -266,6 +354,7 @@ private:
                 uint16_t mTimeout;
                 uint16_t mRetryDelay;
                 bool     mCanEvict;
+                uint8_t  mFailures;
             } mOther;
 
         } mInfo;
@@ -274,6 +363,20 @@ private:
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
     typedef LinkedList<CacheEntry>          CacheEntryList;
 
+    // Pairs an EID with its precomputed hash, so a list lookup can
+    // skip the full (16-byte) address comparison on most entries.
+    struct EidKey
+    {
+        explicit EidKey(const Ip6::Address &aEid)
+            : mEid(aEid)
+            , mHash(CacheEntry::CalculateHash(aEid))
+        {
+        }
+
+        const Ip6::Address &mEid;
+        uint8_t             mHash;
+    };
+
     enum EntryChange : uint8_t
     {
         kEntryAdded,
@@ -285,6 +388,7 @@ private:
     {
         kReasonQueryRequest,
         kReasonSnoop,
+        kReasonPreload,
         kReasonReceivedNotification,
         kReasonRemovingRouterId,
         kReasonRemovingRloc16,
@@ -302,6 +406,11 @@ private:
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
 
+    static bool IsNegativelyCached(const CacheEntry &aEntry)
+    {
+        return (kNegativeCacheThreshold != 0) && (aEntry.GetFailureCount() >= kNegativeCacheThreshold);
+    }
+
     Error SendAddressQuery(const Ip6::Address &aEid);
 
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
@@ -312,6 +421,29 @@ private:
     static void HandleAddressQuery(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleAddressQuery(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    struct PendingAnswer : public Clearable<PendingAnswer>
+    {
+        Ip6::Address             mTarget;
+        Ip6::InterfaceIdentifier mMeshLocalIid;
+        Ip6::Address             mQuerier;
+        uint32_t                 mLastTransactionTime;
+        TimeMilli                mExpireTime;
+        bool                     mHasLastTransactionTime : 1;
+        bool                     mMultipleQueriers : 1;
+        bool                     mInUse : 1;
+    };
+
+    void        EnqueueAddressQueryResponse(const Ip6::Address &            aTarget,
+                                            const Ip6::InterfaceIdentifier &aMeshLocalIid,
+                                            const uint32_t *                aLastTransactionTime,
+                                            const Ip6::Address &            aQuerier);
+    void        SendCoalescedAnswer(PendingAnswer &aAnswer);
+    bool        ConsumeAnswerToken(void);
+    static void HandleCoalesceTimer(Timer &aTimer);
+    void        HandleCoalesceTimer(void);
+#endif
+
     static void HandleAddressNotification(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleAddressNotification(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
@@ -333,6 +465,7 @@ private:
     const char *ListToString(const CacheEntryList *aList) const;
 
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
+    void UpdateCacheEntryCounters(const CacheEntryList *aList, bool aHit);
 
     Coap::Resource mAddressError;
     Coap::Resource mAddressQuery;
@@ -344,6 +477,16 @@ private:
     CacheEntryList mQueryList;
     CacheEntryList mQueryRetryList;
 
+    otCacheEntryCounters mCacheEntryCounters;
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_RESPONSE_COALESCE_ENABLE
+    PendingAnswer  mPendingAnswers[kCoalesceNumEntries];
+    TimerMilli     mCoalesceTimer;
+    TimeMilli      mLastTokenAddTime;
+    uint8_t        mAnswerTokens;
+    AnswerCounters mAnswerCounters;
+#endif
+
     Ip6::Icmp::Handler mIcmpHandler;
 };
 
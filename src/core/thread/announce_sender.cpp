@@ -43,6 +43,7 @@
 #include "meshcop/meshcop.hpp"
 #include "meshcop/meshcop_tlvs.hpp"
 #include "radio/radio.hpp"
+#include "thread/mesh_forwarder.hpp"
 
 namespace ot {
 
@@ -123,6 +124,16 @@ exit:
 
 void AnnounceSenderBase::HandleTimer(void)
 {
+    // Defer the Announce transmission (staying on the current channel)
+    // when the forwarder's transmit queue is deep, yielding the radio
+    // to the pending data traffic.
+
+    if (Get<MeshForwarder>().ShouldDeferOffChannelOperation())
+    {
+        mTimer.Start(Random::NonCrypto::AddJitter(mPeriod, mJitter));
+        ExitNow();
+    }
+
     Get<Mle::MleRouter>().SendAnnounce(mChannel);
 
     // Go to the next channel in the mask. If we have reached the end
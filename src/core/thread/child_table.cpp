@@ -76,12 +76,17 @@ exit:
 ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY > 0
+    , mStoreTimer(aInstance, HandleStoreTimer)
+#endif
 {
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
         child.Clear();
     }
+
+    ClearLookupCaches();
 }
 
 void ChildTable::Clear(void)
@@ -90,6 +95,21 @@ void ChildTable::Clear(void)
     {
         child.Clear();
     }
+
+    ClearLookupCaches();
+}
+
+void ChildTable::ClearLookupCaches(void)
+{
+    for (uint16_t &index : mRloc16LookupCache)
+    {
+        index = kCacheIndexInvalid;
+    }
+
+    for (uint16_t &index : mExtAddressLookupCache)
+    {
+        index = kCacheIndexInvalid;
+    }
 }
 
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex)
@@ -114,6 +134,64 @@ exit:
     return child;
 }
 
+Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher)
+{
+    Child *  child  = nullptr;
+    uint16_t bucket = 0;
+    bool     cached = false;
+
+    // Consult the direct-mapped lookup caches first, turning the
+    // per-frame source address resolution into O(1) in steady state.
+    // A cached entry is verified against the matcher (address and
+    // state filter) before use; a stale or colliding entry simply
+    // falls back to the linear search below, which then refreshes
+    // the cache entry.
+
+    if (aMatcher.GetShortAddress() != Mac::kShortAddrInvalid)
+    {
+        bucket = CacheBucketFor(aMatcher.GetShortAddress());
+        cached = true;
+
+        if (mRloc16LookupCache[bucket] < mMaxChildrenAllowed)
+        {
+            child = &mChildren[mRloc16LookupCache[bucket]];
+        }
+    }
+    else if (aMatcher.GetExtAddress() != nullptr)
+    {
+        bucket = CacheBucketFor(*aMatcher.GetExtAddress());
+        cached = true;
+
+        if (mExtAddressLookupCache[bucket] < mMaxChildrenAllowed)
+        {
+            child = &mChildren[mExtAddressLookupCache[bucket]];
+        }
+    }
+
+    if ((child != nullptr) && child->Matches(aMatcher))
+    {
+        ExitNow();
+    }
+
+    child = AsNonConst(AsConst(this)->FindChild(aMatcher));
+    VerifyOrExit(child != nullptr);
+
+    if (cached)
+    {
+        if (aMatcher.GetShortAddress() != Mac::kShortAddrInvalid)
+        {
+            mRloc16LookupCache[bucket] = GetChildIndex(*child);
+        }
+        else
+        {
+            mExtAddressLookupCache[bucket] = GetChildIndex(*child);
+        }
+    }
+
+exit:
+    return child;
+}
+
 const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
     const Child *child = mChildren;
@@ -216,6 +294,26 @@ exit:
     return error;
 }
 
+Error ChildTable::GetNextChildInfo(uint16_t &aIterator, Child::Info &aChildInfo)
+{
+    Error  error = kErrorNotFound;
+    Child *child;
+
+    while ((child = GetChildAtIndex(aIterator)) != nullptr)
+    {
+        aIterator++;
+
+        if (child->IsStateValidOrRestoring())
+        {
+            aChildInfo.SetFrom(*child);
+            error = kErrorNone;
+            break;
+        }
+    }
+
+    return error;
+}
+
 void ChildTable::Restore(void)
 {
     Error    error          = kErrorNone;
@@ -268,6 +366,11 @@ exit:
 
 void ChildTable::RemoveStoredChild(const Child &aChild)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY > 0
+    OT_UNUSED_VARIABLE(aChild);
+
+    ScheduleStoreChildren();
+#else
     for (Settings::ChildInfoIterator iter(GetInstance()); !iter.IsDone(); iter++)
     {
         if (iter.GetChildInfo().GetRloc16() == aChild.GetRloc16())
@@ -276,14 +379,28 @@ void ChildTable::RemoveStoredChild(const Child &aChild)
             break;
         }
     }
+#endif
 }
 
 Error ChildTable::StoreChild(const Child &aChild)
 {
-    Settings::ChildInfo childInfo;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY > 0
+    OT_UNUSED_VARIABLE(aChild);
 
+    ScheduleStoreChildren();
+
+    return kErrorNone;
+#else
     RemoveStoredChild(aChild);
 
+    return StoreChildInSettings(aChild);
+#endif
+}
+
+Error ChildTable::StoreChildInSettings(const Child &aChild)
+{
+    Settings::ChildInfo childInfo;
+
     childInfo.Init();
     childInfo.SetExtAddress(aChild.GetExtAddress());
     childInfo.SetTimeout(aChild.GetTimeout());
@@ -307,13 +424,35 @@ void ChildTable::RefreshStoredChildren(void)
             continue;
         }
 
-        SuccessOrExit(StoreChild(*child));
+        SuccessOrExit(StoreChildInSettings(*child));
     }
 
 exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY > 0
+
+void ChildTable::ScheduleStoreChildren(void)
+{
+    // Changes within the delay window are coalesced into a single
+    // rewrite of all stored entries when the timer fires. The timer is
+    // intentionally not restarted on new changes so that continuous
+    // churn cannot postpone the write indefinitely.
+
+    if (!mStoreTimer.IsRunning())
+    {
+        mStoreTimer.Start(OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY);
+    }
+}
+
+void ChildTable::HandleStoreTimer(Timer &aTimer)
+{
+    aTimer.Get<ChildTable>().RefreshStoredChildren();
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY > 0
+
 bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const
 {
     bool         hasChild = false;
@@ -42,6 +42,7 @@
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/timer.hpp"
 #include "thread/topology.hpp"
 
 namespace ot {
@@ -267,6 +268,22 @@ public:
      */
     Error GetChildInfoByIndex(uint16_t aChildIndex, Child::Info &aChildInfo);
 
+    /**
+     * This method retrieves diagnostic information for the next attached child (using an iterator).
+     *
+     * Unlike `GetChildInfoByIndex()`, the iterator resumes the table walk from where the previous call left off,
+     * making a full-table dump linear in the table size.
+     *
+     * @param[inout]  aIterator   A reference to the iterator. To get the first child, it should be set to zero. On
+     *                            success, the iterator is updated to point past the returned child.
+     * @param[out]    aChildInfo  A reference to a `Child::Info` to populate with the child information.
+     *
+     * @retval kErrorNone      Successfully found the next attached child and populated @p aChildInfo.
+     * @retval kErrorNotFound  No subsequent attached child entry in the table.
+     *
+     */
+    Error GetNextChildInfo(uint16_t &aIterator, Child::Info &aChildInfo);
+
     /**
      * This method restores child table from non-volatile memory.
      *
@@ -276,6 +293,9 @@ public:
     /**
      * This method removes a stored child information from non-volatile memory.
      *
+     * When `OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY` is non-zero, the removal is coalesced with other child
+     * table changes and written to non-volatile memory after the configured delay.
+     *
      * @param[in]  aChildRloc16     A reference to the child to remove from non-volatile memory.
      *
      */
@@ -284,6 +304,9 @@ public:
     /**
      * This method store a child information into non-volatile memory.
      *
+     * When `OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY` is non-zero, the change is coalesced with other child
+     * table changes and written to non-volatile memory after the configured delay.
+     *
      * @param[in]  aChild          A reference to the child to store.
      *
      * @retval  kErrorNone     Successfully store child.
@@ -323,13 +346,38 @@ private:
         Child::StateFilter mFilter;
     };
 
-    Child *FindChild(const Child::AddressMatcher &aMatcher) { return AsNonConst(AsConst(this)->FindChild(aMatcher)); }
+    // Number of entries in the direct-mapped lookup caches (must be a
+    // power of two). Cached entries are verified against the matcher
+    // before use, so a stale or colliding entry only costs a fallback
+    // to the linear search.
+    static constexpr uint16_t kLookupCacheSize  = (kMaxChildren <= 32) ? 32 : 128;
+    static constexpr uint16_t kCacheIndexInvalid = 0xffff;
+
+    Child *FindChild(const Child::AddressMatcher &aMatcher);
 
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
+    Error        StoreChildInSettings(const Child &aChild);
     void         RefreshStoredChildren(void);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY > 0
+    void        ScheduleStoreChildren(void);
+    static void HandleStoreTimer(Timer &aTimer);
+#endif
+
+    void     ClearLookupCaches(void);
+    uint16_t CacheBucketFor(uint16_t aRloc16) const { return (aRloc16 & (kLookupCacheSize - 1)); }
+    uint16_t CacheBucketFor(const Mac::ExtAddress &aExtAddress) const
+    {
+        return ((aExtAddress.m8[6] ^ aExtAddress.m8[7]) & (kLookupCacheSize - 1));
+    }
+
     uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+    uint16_t mRloc16LookupCache[kLookupCacheSize];
+    uint16_t mExtAddressLookupCache[kLookupCacheSize];
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_STORE_DELAY > 0
+    TimerMilli mStoreTimer;
+#endif
+    Child mChildren[kMaxChildren];
 };
 
 } // namespace ot
@@ -61,6 +61,9 @@ inline void CslTxScheduler::Callbacks::HandleSentFrameToChild(const Mac::TxFrame
 
 CslTxScheduler::CslTxScheduler(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_MISSED_WINDOW_RESELECT_ENABLE
+    , mCslTxWindow(0)
+#endif
     , mCslTxChild(nullptr)
     , mCslTxMessage(nullptr)
     , mFrameContext()
@@ -118,6 +121,19 @@ void CslTxScheduler::Clear(void)
  *
  */
 void CslTxScheduler::RescheduleCslTx(void)
+{
+    uint32_t minDelayTime;
+    Child *  bestChild = FindNextCslTxChild(minDelayTime);
+
+    if (bestChild != nullptr)
+    {
+        Get<Mac::Mac>().RequestCslFrameTransmission(minDelayTime / 1000UL);
+    }
+
+    mCslTxChild = bestChild;
+}
+
+Child *CslTxScheduler::FindNextCslTxChild(uint32_t &aMinDelay)
 {
     uint32_t minDelayTime = Time::kMaxDuration;
     Child *  bestChild    = nullptr;
@@ -138,15 +154,15 @@ void CslTxScheduler::RescheduleCslTx(void)
         {
             minDelayTime = delay;
             bestChild    = &child;
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_MISSED_WINDOW_RESELECT_ENABLE
+            mCslTxWindow = child.GetLastRxTimestamp() + cslTxDelay;
+#endif
         }
     }
 
-    if (bestChild != nullptr)
-    {
-        Get<Mac::Mac>().RequestCslFrameTransmission(minDelayTime / 1000UL);
-    }
+    aMinDelay = minDelayTime;
 
-    mCslTxChild = bestChild;
+    return bestChild;
 }
 
 uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const
@@ -172,6 +188,30 @@ Mac::TxFrame *CslTxScheduler::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     VerifyOrExit(mCslTxChild != nullptr);
 
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_MISSED_WINDOW_RESELECT_ENABLE
+    {
+        uint32_t delayFromLastRx;
+        uint32_t minDelay;
+
+        GetNextCslTransmissionDelay(*mCslTxChild, delayFromLastRx);
+
+        if (mCslTxChild->GetLastRxTimestamp() + delayFromLastRx != mCslTxWindow)
+        {
+            // The frame request arrived too late for the originally
+            // scheduled transmit window (e.g., the radio was busy
+            // with other transmissions). Instead of silently slipping
+            // the selected child to its next window (a full CSL
+            // period later), re-select the child with the earliest
+            // upcoming window.
+
+            otLogInfoMac("CSL tx window missed, re-selecting child");
+
+            mCslTxChild = FindNextCslTxChild(minDelay);
+            VerifyOrExit(mCslTxChild != nullptr);
+        }
+    }
+#endif
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     frame = &aTxFrames.GetTxFrame(Mac::kRadioTypeIeee802154);
 #else
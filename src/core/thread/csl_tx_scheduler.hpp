@@ -187,8 +187,9 @@ public:
     void Clear(void);
 
 private:
-    void InitFrameRequestAhead(void);
-    void RescheduleCslTx(void);
+    void   InitFrameRequestAhead(void);
+    void   RescheduleCslTx(void);
+    Child *FindNextCslTxChild(uint32_t &aMinDelay);
 
     uint32_t GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const;
 
@@ -199,6 +200,9 @@ private:
     void HandleSentFrame(const Mac::TxFrame &aFrame, Error aError, Child &aChild);
 
     uint32_t                mCslFrameRequestAheadUs;
+#if OPENTHREAD_CONFIG_MAC_CSL_TX_MISSED_WINDOW_RESELECT_ENABLE
+    uint64_t                mCslTxWindow;
+#endif
     Child *                 mCslTxChild;
     Message *               mCslTxMessage;
     Callbacks::FrameContext mFrameContext;
@@ -48,13 +48,18 @@ DiscoverScanner::DiscoverScanner(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mHandler(nullptr)
     , mHandlerContext(nullptr)
+    , mEarlyTerminatePredicate(nullptr)
+    , mEarlyTerminateContext(nullptr)
     , mTimer(aInstance, DiscoverScanner::HandleTimer)
     , mFilterIndexes()
     , mState(kStateIdle)
     , mScanChannel(0)
+    , mLastResponseChannel(0)
     , mAdvDataLength(0)
     , mEnableFiltering(false)
     , mShouldRestorePanId(false)
+    , mScanHintFirst(false)
+    , mDwellingOnHint(false)
 {
 }
 
@@ -152,8 +157,24 @@ Error DiscoverScanner::Discover(const Mac::ChannelMask &aScanChannels,
         mShouldRestorePanId = true;
     }
 
-    mScanChannel = Mac::ChannelMask::kChannelIteratorFirst;
-    mState       = (mScanChannels.GetNextChannel(mScanChannel) == kErrorNone) ? kStateScanning : kStateScanDone;
+    mScanChannel    = Mac::ChannelMask::kChannelIteratorFirst;
+    mScanHintFirst  = false;
+    mDwellingOnHint = false;
+
+    if ((mLastResponseChannel != 0) && mScanChannels.ContainsChannel(mLastResponseChannel))
+    {
+        // Dwell first on the channel where the last Discovery Response
+        // was received, so a rejoin scan (with an early-terminate
+        // predicate) can typically finish within a single dwell.
+        mScanChannel    = mLastResponseChannel;
+        mScanHintFirst  = true;
+        mDwellingOnHint = true;
+        mState          = kStateScanning;
+    }
+    else
+    {
+        mState = (mScanChannels.GetNextChannel(mScanChannel) == kErrorNone) ? kStateScanning : kStateScanDone;
+    }
 
     Mle::Log(Mle::kMessageSend, Mle::kTypeDiscoveryRequest, destination);
 
@@ -247,7 +268,9 @@ void DiscoverScanner::HandleDiscoverComplete(void)
             mShouldRestorePanId = false;
         }
 
-        mState = kStateIdle;
+        mState                   = kStateIdle;
+        mEarlyTerminatePredicate = nullptr;
+        mEarlyTerminateContext   = nullptr;
 
         if (mHandler)
         {
@@ -274,18 +297,30 @@ void DiscoverScanner::HandleTimer(void)
     // frame tx is aborted  from `PrepareDiscoveryRequestFrame()` and
     // then wraps up the scan (invoking handler callback).
 
-    if (mScanChannels.GetNextChannel(mScanChannel) != kErrorNone)
+    if (mDwellingOnHint)
     {
-        mState = kStateScanDone;
+        // The hint channel was dwelled on first; continue with the
+        // regular channel iteration (skipping the hint channel below).
+        mDwellingOnHint = false;
+        mScanChannel    = Mac::ChannelMask::kChannelIteratorFirst;
     }
 
+    do
+    {
+        if (mScanChannels.GetNextChannel(mScanChannel) != kErrorNone)
+        {
+            mState = kStateScanDone;
+            break;
+        }
+    } while (mScanHintFirst && (mScanChannel == mLastResponseChannel));
+
     Get<MeshForwarder>().ResumeMessageTransmissions();
 
 exit:
     return;
 }
 
-void DiscoverScanner::HandleDiscoveryResponse(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
+void DiscoverScanner::HandleDiscoveryResponse(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Error                         error    = kErrorNone;
     const ThreadLinkInfo *        linkInfo = aMessageInfo.GetThreadLinkInfo();
@@ -381,11 +416,20 @@ void DiscoverScanner::HandleDiscoveryResponse(const Message &aMessage, const Ip6
 
     VerifyOrExit(!mEnableFiltering || didCheckSteeringData);
 
+    mLastResponseChannel = result.mChannel;
+
     if (mHandler)
     {
         mHandler(&result, mHandlerContext);
     }
 
+    if ((mEarlyTerminatePredicate != nullptr) && mEarlyTerminatePredicate(result, mEarlyTerminateContext))
+    {
+        // A result matching the caller's criteria was found; wrap up
+        // the scan without dwelling on the remaining channels.
+        HandleDiscoverComplete();
+    }
+
 exit:
     Mle::LogProcessError(Mle::kTypeDiscoveryResponse, error);
 }
@@ -84,6 +84,16 @@ public:
      */
     typedef otHandleActiveScanResult Handler;
 
+    /**
+     * This type represents a predicate function pointer used to decide whether a Discover Scan can terminate early.
+     *
+     * The predicate is invoked for every scan result passed to the handler. Returning `true` indicates the result
+     * matches the caller's criteria (e.g., a sought Extended PAN ID) and the scan is wrapped up without dwelling on
+     * the remaining channels.
+     *
+     */
+    typedef bool (*ResultPredicate)(const ScanResult &aResult, void *aContext);
+
     /**
      * This type represents the filter indexes, i.e., hash bit index values for the bloom filter (calculated from a
      * Joiner ID).
@@ -150,6 +160,21 @@ public:
      */
     Error SetJoinerAdvertisement(uint32_t aOui, const uint8_t *aAdvData, uint8_t aAdvDataLength);
 
+    /**
+     * This method sets a predicate allowing the current/next Discover Scan to terminate early.
+     *
+     * The predicate applies to a single scan and is cleared automatically when the scan completes.
+     *
+     * @param[in]  aPredicate  The predicate function pointer (or nullptr to disable early termination).
+     * @param[in]  aContext    A pointer to arbitrary context information passed to @p aPredicate.
+     *
+     */
+    void SetEarlyTerminatePredicate(ResultPredicate aPredicate, void *aContext)
+    {
+        mEarlyTerminatePredicate = aPredicate;
+        mEarlyTerminateContext   = aContext;
+    }
+
 private:
     enum State : uint8_t
     {
@@ -166,7 +191,7 @@ private:
     void          Stop(void) { HandleDiscoverComplete(); }
 
     // Methods used from `Mle`
-    void HandleDiscoveryResponse(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const;
+    void HandleDiscoveryResponse(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
     void        HandleDiscoverComplete(void);
     static void HandleTimer(Timer &aTimer);
@@ -174,16 +199,21 @@ private:
 
     Handler          mHandler;
     void *           mHandlerContext;
+    ResultPredicate  mEarlyTerminatePredicate;
+    void *           mEarlyTerminateContext;
     TimerMilli       mTimer;
     FilterIndexes    mFilterIndexes;
     Mac::ChannelMask mScanChannels;
     State            mState;
     uint32_t         mOui;
     uint8_t          mScanChannel;
+    uint8_t          mLastResponseChannel;
     uint8_t          mAdvDataLength;
     uint8_t          mAdvData[MeshCoP::JoinerAdvertisementTlv::kAdvDataMaxLength];
     bool             mEnableFiltering : 1;
     bool             mShouldRestorePanId : 1;
+    bool             mScanHintFirst : 1;
+    bool             mDwellingOnHint : 1;
 };
 
 } // namespace Mle
@@ -61,6 +61,7 @@ DuaManager::DuaManager(Instance &aInstance)
 #endif
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
     , mChildIndexDuaRegistering(Mle::kMaxChildren)
+    , mChildIndexDuaNext(0)
 #endif
 {
     mDelay.mValue = 0;
@@ -476,18 +477,32 @@ void DuaManager::PerformNextRegistration(void)
 
         OT_ASSERT(mChildIndexDuaRegistering == Mle::kMaxChildren);
 
-        for (Child &iter : Get<ChildTable>().Iterate(Child::kInStateValid))
+        // Scan the pending mask directly (round-robin starting from where the
+        // previous pass left off) instead of walking the full child table.
+        for (uint16_t numChecked = 0; numChecked < Mle::kMaxChildren; numChecked++)
         {
-            uint16_t childIndex = Get<ChildTable>().GetChildIndex(iter);
+            uint16_t childIndex = mChildIndexDuaNext;
+
+            mChildIndexDuaNext = (mChildIndexDuaNext + 1 < Mle::kMaxChildren) ? (mChildIndexDuaNext + 1) : 0;
 
-            if (mChildDuaMask.Get(childIndex) && !mChildDuaRegisteredMask.Get(childIndex))
+            if (!mChildDuaMask.Get(childIndex) || mChildDuaRegisteredMask.Get(childIndex))
+            {
+                continue;
+            }
+
+            child = Get<ChildTable>().GetChildAtIndex(childIndex);
+
+            if (child != nullptr && child->IsStateValid())
             {
                 mChildIndexDuaRegistering = childIndex;
                 break;
             }
+
+            child = nullptr;
         }
 
-        child  = Get<ChildTable>().GetChildAtIndex(mChildIndexDuaRegistering);
+        VerifyOrExit(child != nullptr, error = kErrorNotFound);
+
         duaPtr = child->GetDomainUnicastAddress();
 
         OT_ASSERT(duaPtr != nullptr);
@@ -261,6 +261,7 @@ private:
     ChildMask mChildDuaMask;             // Child Mask for child who registers DUA via Child Update Request.
     ChildMask mChildDuaRegisteredMask;   // Child Mask for child's DUA that was registered by the parent on behalf.
     uint16_t  mChildIndexDuaRegistering; // Child Index of the DUA being registered.
+    uint16_t  mChildIndexDuaNext;        // Child Index to consider next for proxy registration (round-robin).
 #endif
 };
 
@@ -41,6 +41,7 @@
 #include "common/logging.hpp"
 #include "meshcop/meshcop.hpp"
 #include "meshcop/meshcop_tlvs.hpp"
+#include "thread/mesh_forwarder.hpp"
 #include "thread/thread_netif.hpp"
 #include "thread/uri_paths.hpp"
 
@@ -115,8 +116,19 @@ void EnergyScanServer::HandleTimer(void)
 
     if (mCount)
     {
+        uint32_t channelMask;
+
+        // Defer the scan when the forwarder's transmit queue is deep,
+        // yielding the radio to the pending data traffic.
+
+        if (Get<MeshForwarder>().ShouldDeferOffChannelOperation())
+        {
+            mTimer.Start(kScanDelay);
+            ExitNow();
+        }
+
         // grab the lowest channel to scan
-        uint32_t channelMask = mChannelMaskCurrent & ~(mChannelMaskCurrent - 1);
+        channelMask = mChannelMaskCurrent & ~(mChannelMaskCurrent - 1);
         IgnoreError(Get<Mac::Mac>().EnergyScan(channelMask, mScanDuration, HandleScanResult, this));
     }
     else
@@ -101,6 +101,7 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
 
     aMessage.SetChildMask(childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
+    UpdateFirstQueuedMessageOnAdd(aMessage, aChild);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -128,6 +129,7 @@ Error IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &aCh
 
     aMessage.ClearChildMask(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
+    UpdateFirstQueuedMessageOnRemove(aMessage, aChild);
 
     RequestMessageUpdate(aChild);
 
@@ -152,6 +154,7 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
     }
 
     aChild.SetIndirectMessage(nullptr);
+    aChild.SetFirstQueuedMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -197,6 +200,7 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
         }
 
         aChild.SetIndirectMessage(nullptr);
+        aChild.SetFirstQueuedMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -214,20 +218,69 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 }
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
+{
+    // The child tracks its earliest queued message, so the search can
+    // start from it instead of walking the entire send queue (all other
+    // queued messages for the child follow it in the queue).
+
+    Message *message = aChild.GetFirstQueuedMessage();
+
+    if (aSupervisionTypeOnly)
+    {
+        uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+        for (; message; message = message->GetNext())
+        {
+            if (message->GetChildMask(childIndex) && (message->GetType() == Message::kTypeSupervision))
+            {
+                break;
+            }
+        }
+    }
+
+    return message;
+}
+
+void IndirectSender::UpdateFirstQueuedMessageOnAdd(Message &aMessage, Child &aChild)
+{
+    Message *first = aChild.GetFirstQueuedMessage();
+
+    // The send queue orders messages by descending priority with FIFO
+    // order within the same priority, so the newly added message
+    // precedes the tracked first message only when it has a strictly
+    // higher priority.
+
+    if ((first == nullptr) || (aMessage.GetPriority() > first->GetPriority()))
+    {
+        aChild.SetFirstQueuedMessage(&aMessage);
+    }
+}
+
+void IndirectSender::UpdateFirstQueuedMessageOnRemove(Message &aMessage, Child &aChild)
 {
     Message *message;
-    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    uint16_t childIndex;
+
+    VerifyOrExit(&aMessage == aChild.GetFirstQueuedMessage());
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+    // All remaining queued messages for the child follow the removed
+    // one in the send queue (a message added with a higher priority
+    // would have itself been tracked as the first queued message).
+
+    childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    for (message = aMessage.GetNext(); message != nullptr; message = message->GetNext())
     {
-        if (message->GetChildMask(childIndex) &&
-            (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision)))
+        if (message->GetChildMask(childIndex))
         {
             break;
         }
     }
 
-    return message;
+    aChild.SetFirstQueuedMessage(message);
+
+exit:
+    return;
 }
 
 void IndirectSender::RequestMessageUpdate(Child &aChild)
@@ -542,6 +595,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         {
             message->ClearChildMask(childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
+            UpdateFirstQueuedMessageOnRemove(*message, aChild);
         }
 
         Get<MeshForwarder>().RemoveMessageIfNoPendingTx(*message);
@@ -100,6 +100,9 @@ public:
         Message *GetIndirectMessage(void) { return mIndirectMessage; }
         void     SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
 
+        Message *GetFirstQueuedMessage(void) const { return mFirstQueuedMessage; }
+        void     SetFirstQueuedMessage(Message *aMessage) { mFirstQueuedMessage = aMessage; }
+
         uint16_t GetIndirectFragmentOffset(void) const { return mIndirectFragmentOffset; }
         void     SetIndirectFragmentOffset(uint16_t aFragmentOffset) { mIndirectFragmentOffset = aFragmentOffset; }
 
@@ -122,6 +125,7 @@ public:
         const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
 
         Message *mIndirectMessage;             // Current indirect message.
+        Message *mFirstQueuedMessage;          // Earliest (in send queue order) queued message for the child.
         uint16_t mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
         bool     mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
         bool     mWaitingForMessageUpdate : 1; // Indicates waiting for updating the indirect message.
@@ -216,6 +220,8 @@ private:
 
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly = false);
+    void     UpdateFirstQueuedMessageOnAdd(Message &aMessage, Child &aChild);
+    void     UpdateFirstQueuedMessageOnRemove(Message &aMessage, Child &aChild);
     void     RequestMessageUpdate(Child &aChild);
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
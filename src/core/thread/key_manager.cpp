@@ -170,6 +170,9 @@ exit:
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    , mKeyCacheCount(0)
+#endif
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
     , mStoredMleFrameCounter(0)
@@ -177,6 +180,7 @@ KeyManager::KeyManager(Instance &aInstance)
     , mKeySwitchGuardTime(kDefaultKeySwitchGuardTime)
     , mKeySwitchGuardEnabled(false)
     , mKeyRotationTimer(aInstance, KeyManager::HandleKeyRotationTimer)
+    , mStoreFrameCountersTask(aInstance, KeyManager::HandleStoreFrameCountersTask)
     , mKekFrameCounter(0)
     , mIsPskcSet(false)
 {
@@ -239,7 +243,7 @@ void KeyManager::ResetFrameCounters(void)
     // reset parent frame counters
     parent = &Get<Mle::MleRouter>().GetParent();
     parent->SetKeySequence(0);
-    parent->GetLinkFrameCounters().Reset();
+    parent->ResetLinkFrameCounters();
     parent->SetLinkAckFrameCounter(0);
     parent->SetMleFrameCounter(0);
 
@@ -248,7 +252,7 @@ void KeyManager::ResetFrameCounters(void)
     for (Router &router : Get<RouterTable>().Iterate())
     {
         router.SetKeySequence(0);
-        router.GetLinkFrameCounters().Reset();
+        router.ResetLinkFrameCounters();
         router.SetLinkAckFrameCounter(0);
         router.SetMleFrameCounter(0);
     }
@@ -257,7 +261,7 @@ void KeyManager::ResetFrameCounters(void)
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
         child.SetKeySequence(0);
-        child.GetLinkFrameCounters().Reset();
+        child.ResetLinkFrameCounters();
         child.SetLinkAckFrameCounter(0);
         child.SetMleFrameCounter(0);
     }
@@ -284,6 +288,9 @@ void KeyManager::SetNetworkKey(const NetworkKey &aNetworkKey)
     Get<Notifier>().Signal(kEventThreadKeySeqCounterChanged);
 
     mKeySequence = 0;
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    mKeyCacheCount = 0; // Cached keys were derived from the old Network Key.
+#endif
     UpdateKeyMaterial();
     ResetFrameCounters();
 
@@ -297,10 +304,34 @@ void KeyManager::ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys)
     uint8_t            keySequenceBytes[sizeof(uint32_t)];
     Crypto::Key        cryptoKey;
 
-#if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
-    cryptoKey.SetAsKeyRef(mNetworkKeyRef);
-#else
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    // During a key rotation window, frames secured with adjacent key
+    // sequences arrive interleaved, repeatedly asking for the same few
+    // sequences. A small cache of recently derived keys (moved to the
+    // front on a hit, so eviction is LRU) avoids re-running the HMAC
+    // derivation per frame. The cache is cleared when the Network Key
+    // changes.
+
+    for (uint8_t i = 0; i < mKeyCacheCount; i++)
+    {
+        if (mKeyCache[i].mKeySequence == aKeySequence)
+        {
+            KeyCacheEntry entry = mKeyCache[i];
+
+            for (; i > 0; i--)
+            {
+                mKeyCache[i] = mKeyCache[i - 1];
+            }
+
+            mKeyCache[0] = entry;
+            aHashKeys    = entry.mHashKeys;
+            ExitNow();
+        }
+    }
+
     cryptoKey.Set(mNetworkKey.m8, NetworkKey::kSize);
+#else
+    cryptoKey.SetAsKeyRef(mNetworkKeyRef);
 #endif
 
     hmac.Start(cryptoKey);
@@ -310,6 +341,24 @@ void KeyManager::ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys)
     hmac.Update(kThreadString);
 
     hmac.Finish(aHashKeys.mHash);
+
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    if (mKeyCacheCount < kNumCachedKeys)
+    {
+        mKeyCacheCount++;
+    }
+
+    for (uint8_t i = mKeyCacheCount - 1; i > 0; i--)
+    {
+        mKeyCache[i] = mKeyCache[i - 1];
+    }
+
+    mKeyCache[0].mKeySequence = aKeySequence;
+    mKeyCache[0].mHashKeys    = aHashKeys;
+
+exit:
+    return;
+#endif
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -365,6 +414,17 @@ void KeyManager::UpdateKeyMaterial(void)
 
         ComputeTrelKey(mKeySequence, key);
         mTrelKey.SetFrom(key);
+
+        // Also pre-compute and cache the TREL keys for the previous and
+        // next key sequences, so that during a key rotation window the
+        // receive path can look up the key for a frame secured with an
+        // adjacent sequence instead of re-deriving it per frame.
+
+        ComputeTrelKey(mKeySequence - 1, key);
+        mTrelPrevKey.SetFrom(key);
+
+        ComputeTrelKey(mKeySequence + 1, key);
+        mTrelNextKey.SetFrom(key);
     }
 #endif
 }
@@ -410,12 +470,29 @@ const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
-    Mac::Key key;
+    const Mac::KeyMaterial *key = &mTemporaryTrelKey;
+
+    // The keys for the previous and next key sequences are pre-computed
+    // in `UpdateKeyMaterial()` (invalidated on every rotation), so the
+    // common rotation-window cases avoid a per-frame key derivation.
+
+    if (aKeySequence == mKeySequence - 1)
+    {
+        key = &mTrelPrevKey;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        key = &mTrelNextKey;
+    }
+    else
+    {
+        Mac::Key trelKey;
 
-    ComputeTrelKey(aKeySequence, key);
-    mTemporaryTrelKey.SetFrom(key);
+        ComputeTrelKey(aKeySequence, trelKey);
+        mTemporaryTrelKey.SetFrom(trelKey);
+    }
 
-    return mTemporaryTrelKey;
+    return *key;
 }
 #endif
 
@@ -433,10 +510,7 @@ void KeyManager::MacFrameCounterUpdated(uint32_t aMacFrameCounter)
 {
     mMacFrameCounters.Set154(aMacFrameCounter);
 
-    if (mMacFrameCounters.Get154() >= mStoredMacFrameCounter)
-    {
-        IgnoreError(Get<Mle::MleRouter>().Store());
-    }
+    CheckFrameCounterStorage(mMacFrameCounters.Get154(), mStoredMacFrameCounter);
 }
 #else
 void KeyManager::MacFrameCounterUpdated(uint32_t)
@@ -449,10 +523,7 @@ void KeyManager::IncrementTrelMacFrameCounter(void)
 {
     mMacFrameCounters.IncrementTrel();
 
-    if (mMacFrameCounters.GetTrel() >= mStoredMacFrameCounter)
-    {
-        IgnoreError(Get<Mle::MleRouter>().Store());
-    }
+    CheckFrameCounterStorage(mMacFrameCounters.GetTrel(), mStoredMacFrameCounter);
 }
 #endif
 
@@ -460,12 +531,36 @@ void KeyManager::IncrementMleFrameCounter(void)
 {
     mMleFrameCounter++;
 
-    if (mMleFrameCounter >= mStoredMleFrameCounter)
+    CheckFrameCounterStorage(mMleFrameCounter, mStoredMleFrameCounter);
+}
+
+void KeyManager::CheckFrameCounterStorage(uint32_t aFrameCounter, uint32_t aStoredFrameCounter)
+{
+    if (aFrameCounter >= aStoredFrameCounter)
+    {
+        // The persisted window is exhausted, so the counters must be
+        // stored before any more frames are secured.
+        StoreFrameCounters();
+    }
+    else if (aFrameCounter + kFrameCounterStoreGuard >= aStoredFrameCounter)
     {
-        IgnoreError(Get<Mle::MleRouter>().Store());
+        // Nearing the end of the persisted window. Schedule the store
+        // from a tasklet, keeping the settings write (and any flash
+        // stall it causes) off the frame transmit path.
+        mStoreFrameCountersTask.Post();
     }
 }
 
+void KeyManager::HandleStoreFrameCountersTask(Tasklet &aTasklet)
+{
+    aTasklet.Get<KeyManager>().StoreFrameCounters();
+}
+
+void KeyManager::StoreFrameCounters(void)
+{
+    IgnoreError(Get<Mle::MleRouter>().Store());
+}
+
 void KeyManager::SetKek(const Kek &aKek)
 {
     mKek.SetFrom(aKek, /* aIsExportable */ true);
@@ -47,6 +47,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
@@ -550,7 +551,9 @@ public:
 
 private:
     static constexpr uint32_t kDefaultKeySwitchGuardTime = 624;
+    static constexpr uint8_t  kNumCachedKeys             = 4;
     static constexpr uint32_t kOneHourIntervalInMsec     = 3600u * 1000u;
+    static constexpr uint32_t kFrameCounterStoreGuard    = OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_GUARD;
 
     OT_TOOL_PACKED_BEGIN
     struct Keys
@@ -568,6 +571,14 @@ private:
         const Mac::Key &GetMacKey(void) const { return mKeys.mMacKey; }
     };
 
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    struct KeyCacheEntry
+    {
+        uint32_t mKeySequence;
+        HashKeys mHashKeys;
+    };
+#endif
+
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys);
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -585,6 +596,10 @@ private:
 
     void ResetFrameCounters(void);
 
+    void        CheckFrameCounterStorage(uint32_t aFrameCounter, uint32_t aStoredFrameCounter);
+    static void HandleStoreFrameCountersTask(Tasklet &aTasklet);
+    void        StoreFrameCounters(void);
+
     static const uint8_t kThreadString[];
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -598,12 +613,20 @@ private:
     NetworkKey mNetworkKey;
 #endif
 
-    uint32_t         mKeySequence;
+    uint32_t mKeySequence;
+
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    KeyCacheEntry mKeyCache[kNumCachedKeys];
+    uint8_t       mKeyCacheCount;
+#endif
+
     Mle::KeyMaterial mMleKey;
     Mle::KeyMaterial mTemporaryMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     Mac::KeyMaterial mTrelKey;
+    Mac::KeyMaterial mTrelPrevKey;
+    Mac::KeyMaterial mTrelNextKey;
     Mac::KeyMaterial mTemporaryTrelKey;
 #endif
 
@@ -616,6 +639,7 @@ private:
     uint32_t   mKeySwitchGuardTime;
     bool       mKeySwitchGuardEnabled;
     TimerMilli mKeyRotationTimer;
+    Tasklet    mStoreFrameCountersTask;
 
 #if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
     PskcRef mPskcRef;
@@ -51,8 +51,13 @@ void SeriesInfo::Init(uint8_t aSeriesId, const SeriesFlags &aSeriesFlags, const
     mSeriesId    = aSeriesId;
     mSeriesFlags = aSeriesFlags;
     mMetrics     = aMetrics;
+#if OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE
+    mRssSum = 0;
+    mLqiSum = 0;
+#else
     mRssAverager.Clear();
     mLqiAverager.Clear();
+#endif
     mPduCount = 0;
 }
 
@@ -61,8 +66,13 @@ void SeriesInfo::AggregateLinkMetrics(uint8_t aFrameType, uint8_t aLqi, int8_t a
     if (IsFrameTypeMatch(aFrameType))
     {
         mPduCount++;
+#if OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE
+        mLqiSum += aLqi;
+        mRssSum += aRss;
+#else
         mLqiAverager.Add(aLqi);
         IgnoreError(mRssAverager.Add(aRss));
+#endif
     }
 }
 
@@ -102,6 +112,9 @@ LinkMetrics::LinkMetrics(Instance &aInstance)
     , mEnhAckProbingIeReportCallback(nullptr)
     , mEnhAckProbingIeReportCallbackContext(nullptr)
 {
+#if OPENTHREAD_CONFIG_POOL_DIAGNOSTICS_ENABLE
+    mSeriesInfoPool.SetName("SeriesInfo");
+#endif
 }
 
 Error LinkMetrics::Query(const Ip6::Address &aDestination, uint8_t aSeriesId, const Metrics *aMetrics)
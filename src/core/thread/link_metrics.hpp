@@ -159,7 +159,11 @@ public:
      * @returns  The average LQI.
      *
      */
+#if OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE
+    uint8_t GetAverageLqi(void) const { return (mPduCount > 0) ? static_cast<uint8_t>(mLqiSum / mPduCount) : 0; }
+#else
     uint8_t GetAverageLqi(void) const { return mLqiAverager.GetAverage(); }
+#endif
 
     /**
      * This method gets the average RSS.
@@ -167,7 +171,15 @@ public:
      * @returns  The average RSS.
      *
      */
+#if OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE
+    int8_t GetAverageRss(void) const
+    {
+        return (mPduCount > 0) ? static_cast<int8_t>(mRssSum / static_cast<int32_t>(mPduCount))
+                               : static_cast<int8_t>(OT_RADIO_RSSI_INVALID);
+    }
+#else
     int8_t GetAverageRss(void) const { return mRssAverager.GetAverage(); }
+#endif
 
     /**
      * This method aggregates the Link Metrics data of a frame into this series.
@@ -195,9 +207,14 @@ private:
     uint8_t     mSeriesId;
     SeriesFlags mSeriesFlags;
     Metrics     mMetrics;
+#if OPENTHREAD_CONFIG_MLE_LINK_METRICS_BATCHED_AGGREGATION_ENABLE
+    int32_t  mRssSum;
+    uint32_t mLqiSum;
+#else
     RssAverager mRssAverager;
     LqiAverager mLqiAverager;
-    uint32_t    mPduCount;
+#endif
+    uint32_t mPduCount;
 };
 
 /**
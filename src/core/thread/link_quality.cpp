@@ -136,7 +136,37 @@ void LinkQualityInfo::Clear(void)
 
     mFrameErrorRate.Clear();
     mMessageErrorRate.Clear();
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    mCsmaBackoffOffset = 0;
+    mCsmaClearCount    = 0;
+#endif
+}
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+void LinkQualityInfo::UpdateCsmaBackoffOffset(bool aChannelClear)
+{
+    if (!aChannelClear)
+    {
+        mCsmaClearCount = 0;
+
+        if (mCsmaBackoffOffset < kMaxCsmaBackoffOffset)
+        {
+            mCsmaBackoffOffset++;
+        }
+    }
+    else if (mCsmaBackoffOffset != 0)
+    {
+        mCsmaClearCount++;
+
+        if (mCsmaClearCount >= kCsmaBackoffDecayCount)
+        {
+            mCsmaClearCount = 0;
+            mCsmaBackoffOffset--;
+        }
+    }
 }
+#endif
 
 void LinkQualityInfo::AddRss(int8_t aRss)
 {
@@ -358,6 +358,28 @@ public:
      */
     uint16_t GetFrameErrorRate(void) const { return mFrameErrorRate.GetFailureRate(); }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    /**
+     * This method returns the adaptive CSMA backoff exponent offset for the link.
+     *
+     * The offset is added to `macMinBE` for frames sent to this neighbor.
+     *
+     * @returns The CSMA backoff exponent offset.
+     *
+     */
+    uint8_t GetCsmaBackoffOffset(void) const { return mCsmaBackoffOffset; }
+
+    /**
+     * This method updates the adaptive CSMA backoff exponent offset from a frame transmission attempt.
+     *
+     * The offset grows on channel access failures and decays again after a number of attempts without one.
+     *
+     * @param[in]  aChannelClear   Whether channel access succeeded for the attempt (`false` -> CCA failure).
+     *
+     */
+    void UpdateCsmaBackoffOffset(bool aChannelClear);
+#endif
+
     /**
      * This method returns the message error rate for the link.
      *
@@ -442,6 +464,14 @@ private:
 
     SuccessRateTracker mFrameErrorRate;
     SuccessRateTracker mMessageErrorRate;
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_ENABLE
+    static constexpr uint8_t kMaxCsmaBackoffOffset = OPENTHREAD_CONFIG_MAC_ADAPTIVE_CSMA_BACKOFF_MAX_OFFSET;
+    static constexpr uint8_t kCsmaBackoffDecayCount = 8; // Number of clear attempts before the offset is lowered.
+
+    uint8_t mCsmaBackoffOffset; // CSMA backoff exponent offset added to `macMinBE` for this neighbor.
+    uint8_t mCsmaClearCount;    // Number of consecutive attempts with clear channel access.
+#endif
 };
 
 /**
@@ -52,9 +52,139 @@ namespace Lowpan {
 
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+    , mContextCacheValid(false)
+    , mContextCacheHasMore(false)
+    , mContextCacheLength(0)
+#endif
 {
 }
 
+Error Lowpan::FindContext(const Ip6::Address &aAddress, Context &aContext)
+{
+#if OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+    Error error;
+
+    if (!mContextCacheValid)
+    {
+        RefreshContextCache();
+    }
+
+    if (mContextCacheHasMore)
+    {
+        // The Network Data contains more contexts than can be cached,
+        // so the cache cannot determine the longest matching prefix.
+        error = Get<NetworkData::Leader>().GetContext(aAddress, aContext);
+    }
+    else
+    {
+        aContext.mPrefix.SetLength(0);
+
+        if (Get<Mle::MleRouter>().IsMeshLocalAddress(aAddress))
+        {
+            aContext.mPrefix.Set(Get<Mle::MleRouter>().GetMeshLocalPrefix());
+            aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
+            aContext.mCompressFlag = true;
+        }
+
+        for (uint8_t i = 0; i < mContextCacheLength; i++)
+        {
+            const Context &context = mContextCache[i];
+
+            if (aAddress.MatchesPrefix(context.mPrefix) &&
+                (context.mPrefix.GetLength() > aContext.mPrefix.GetLength()))
+            {
+                aContext = context;
+            }
+        }
+
+        error = (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
+    }
+
+    return error;
+#else
+    return Get<NetworkData::Leader>().GetContext(aAddress, aContext);
+#endif
+}
+
+Error Lowpan::FindContext(uint8_t aContextId, Context &aContext)
+{
+#if OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+    Error error = kErrorNotFound;
+
+    if (aContextId == Mle::kMeshLocalPrefixContextId)
+    {
+        aContext.mPrefix.Set(Get<Mle::MleRouter>().GetMeshLocalPrefix());
+        aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
+        aContext.mCompressFlag = true;
+        ExitNow(error = kErrorNone);
+    }
+
+    if (!mContextCacheValid)
+    {
+        RefreshContextCache();
+    }
+
+    if (mContextCacheHasMore)
+    {
+        ExitNow(error = Get<NetworkData::Leader>().GetContext(aContextId, aContext));
+    }
+
+    for (uint8_t i = 0; i < mContextCacheLength; i++)
+    {
+        if (mContextCache[i].mContextId == aContextId)
+        {
+            aContext = mContextCache[i];
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+#else
+    return Get<NetworkData::Leader>().GetContext(aContextId, aContext);
+#endif
+}
+
+#if OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+void Lowpan::RefreshContextCache(void)
+{
+    mContextCacheLength  = 0;
+    mContextCacheHasMore = false;
+
+    // The mesh-local prefix context (Context ID 0) is not cached since
+    // it is always resolved directly from the MLE mesh-local prefix.
+
+    for (uint8_t contextId = Mle::kMeshLocalPrefixContextId + 1; contextId <= kMaxContextId; contextId++)
+    {
+        Context context;
+
+        if (Get<NetworkData::Leader>().GetContext(contextId, context) != kErrorNone)
+        {
+            continue;
+        }
+
+        if (mContextCacheLength == kNumContextCacheEntries)
+        {
+            mContextCacheHasMore = true;
+            break;
+        }
+
+        mContextCache[mContextCacheLength++] = context;
+    }
+
+    mContextCacheValid = true;
+}
+
+void Lowpan::HandleNotifierEvents(Events aEvents)
+{
+    if (aEvents.Contains(kEventThreadNetdataChanged))
+    {
+        mContextCacheValid = false;
+    }
+}
+#endif // OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+
 void Lowpan::CopyContext(const Context &aContext, Ip6::Address &aAddress)
 {
     aAddress.SetPrefix(aContext.mPrefix);
@@ -212,7 +342,7 @@ Error Lowpan::CompressMulticast(const Ip6::Address &aIpAddr, uint16_t &aHcCtl, B
             else
             {
                 // Check if multicast address can be compressed using Context ID 0.
-                if (Get<NetworkData::Leader>().GetContext(0, multicastContext) == kErrorNone &&
+                if (FindContext(0, multicastContext) == kErrorNone &&
                     multicastContext.mPrefix.GetLength() == aIpAddr.mFields.m8[3] &&
                     memcmp(multicastContext.mPrefix.GetBytes(), aIpAddr.mFields.m8 + 4, 8) == 0)
                 {
@@ -262,7 +392,6 @@ Error Lowpan::Compress(Message &           aMessage,
                        uint8_t &           aHeaderDepth)
 {
     Error                error       = kErrorNone;
-    NetworkData::Leader &networkData = Get<NetworkData::Leader>();
     uint16_t             startOffset = aMessage.GetOffset();
     BufferWriter         buf         = aBuf;
     uint16_t             hcCtl       = kHcDispatch;
@@ -279,19 +408,19 @@ Error Lowpan::Compress(Message &           aMessage,
     SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), ip6Header));
 
     srcContextValid =
-        (networkData.GetContext(ip6Header.GetSource(), srcContext) == kErrorNone && srcContext.mCompressFlag);
+        (FindContext(ip6Header.GetSource(), srcContext) == kErrorNone && srcContext.mCompressFlag);
 
     if (!srcContextValid)
     {
-        IgnoreError(networkData.GetContext(0, srcContext));
+        IgnoreError(FindContext(0, srcContext));
     }
 
     dstContextValid =
-        (networkData.GetContext(ip6Header.GetDestination(), dstContext) == kErrorNone && dstContext.mCompressFlag);
+        (FindContext(ip6Header.GetDestination(), dstContext) == kErrorNone && dstContext.mCompressFlag);
 
     if (!dstContextValid)
     {
-        IgnoreError(networkData.GetContext(0, dstContext));
+        IgnoreError(FindContext(0, dstContext));
     }
 
     // Lowpan HC Control Bits
@@ -596,6 +725,8 @@ Error Lowpan::CompressUdp(Message &aMessage, BufferWriter &aBuf)
         SuccessOrExit(error = buf.Write(&udpHeader, Ip6::Udp::Header::kLengthFieldOffset));
     }
 
+    // The UDP checksum is always carried inline (never elided), so a
+    // compression round trip on a forwarding hop is checksum-neutral.
     SuccessOrExit(error =
                       buf.Write(reinterpret_cast<uint8_t *>(&udpHeader) + Ip6::Udp::Header::kChecksumFieldOffset, 2));
 
@@ -662,9 +793,8 @@ int Lowpan::DecompressBaseHeader(Ip6::Header &       aIp6Header,
                                  const uint8_t *     aBuf,
                                  uint16_t            aBufLength)
 {
-    NetworkData::Leader &networkData = Get<NetworkData::Leader>();
-    Error                error       = kErrorParse;
-    const uint8_t *      cur         = aBuf;
+    Error          error = kErrorParse;
+    const uint8_t *cur   = aBuf;
     const uint8_t *      end         = aBuf + aBufLength;
     uint16_t             hcCtl;
     Context              srcContext, dstContext;
@@ -687,12 +817,12 @@ int Lowpan::DecompressBaseHeader(Ip6::Header &       aIp6Header,
     {
         VerifyOrExit(cur < end);
 
-        if (networkData.GetContext(cur[0] >> 4, srcContext) != kErrorNone)
+        if (FindContext(cur[0] >> 4, srcContext) != kErrorNone)
         {
             srcContextValid = false;
         }
 
-        if (networkData.GetContext(cur[0] & 0xf, dstContext) != kErrorNone)
+        if (FindContext(cur[0] & 0xf, dstContext) != kErrorNone)
         {
             dstContextValid = false;
         }
@@ -701,8 +831,8 @@ int Lowpan::DecompressBaseHeader(Ip6::Header &       aIp6Header,
     }
     else
     {
-        IgnoreError(networkData.GetContext(0, srcContext));
-        IgnoreError(networkData.GetContext(0, dstContext));
+        IgnoreError(FindContext(0, srcContext));
+        IgnoreError(FindContext(0, dstContext));
     }
 
     memset(&aIp6Header, 0, sizeof(aIp6Header));
@@ -40,6 +40,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/notifier.hpp"
 #include "mac/mac_types.hpp"
 #include "net/ip6.hpp"
 #include "net/ip6_address.hpp"
@@ -308,6 +309,17 @@ public:
      */
     int DecompressUdpHeader(Ip6::Udp::Header &aUdpHeader, const uint8_t *aBuf, uint16_t aBufLength);
 
+#if OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+    /**
+     * This method handles notifier events, invalidating the cached 6LoWPAN contexts when the Thread Network
+     * Data changes.
+     *
+     * @param[in]  aEvents  The notifier events.
+     *
+     */
+    void HandleNotifierEvents(Events aEvents);
+#endif
+
 private:
     static constexpr uint16_t kHcDispatch     = 3 << 13;
     static constexpr uint16_t kHcDispatchMask = 7 << 13;
@@ -362,6 +374,9 @@ private:
                    BufferWriter &      aBuf,
                    uint8_t &           aHeaderDepth);
 
+    Error FindContext(const Ip6::Address &aAddress, Context &aContext);
+    Error FindContext(uint8_t aContextId, Context &aContext);
+
     Error CompressExtensionHeader(Message &aMessage, BufferWriter &aBuf, uint8_t &aNextHeader);
     Error CompressSourceIid(const Mac::Address &aMacAddr,
                             const Ip6::Address &aIpAddr,
@@ -382,6 +397,18 @@ private:
 
     static void  CopyContext(const Context &aContext, Ip6::Address &aAddress);
     static Error ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::Address &aIpAddress);
+
+#if OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENABLE
+    static constexpr uint8_t kMaxContextId           = 15; // Context ID is a 4-bit field.
+    static constexpr uint8_t kNumContextCacheEntries = OPENTHREAD_CONFIG_LOWPAN_CONTEXT_CACHE_ENTRIES;
+
+    void RefreshContextCache(void);
+
+    bool    mContextCacheValid;
+    bool    mContextCacheHasMore;
+    uint8_t mContextCacheLength;
+    Context mContextCache[kNumContextCacheEntries];
+#endif
 };
 
 /**
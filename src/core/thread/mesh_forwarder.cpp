@@ -83,6 +83,13 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMessageNextOffset(0)
     , mSendMessage(nullptr)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+    , mFragmentTrainMessage(nullptr)
+    , mFragmentTrainBypassCount(0)
+#endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+    , mNumPackedMessages(0)
+#endif
     , mMeshSource()
     , mMeshDest()
     , mAddMeshHeader(false)
@@ -90,6 +97,10 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mTxPaused(false)
     , mSendBusy(false)
     , mScheduleTransmissionTask(aInstance, MeshForwarder::ScheduleTransmissionTask)
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+    , mPacingTimer(aInstance, MeshForwarder::HandlePacingTimer)
+    , mPacingTxStartTime(0)
+#endif
 #if OPENTHREAD_FTD
     , mIndirectSender(aInstance)
 #endif
@@ -97,11 +108,28 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
 {
     mFragTag = Random::NonCrypto::GetUint16();
 
+#if OPENTHREAD_CONFIG_TASKLET_PRIORITY_ENABLE
+    mScheduleTransmissionTask.SetHighPriority();
+#endif
+#if OPENTHREAD_CONFIG_TASKLET_AFFINITY_ENABLE
+    mScheduleTransmissionTask.SetTag(Tasklet::kAffinityTagMeshForwarder);
+#endif
+
     ResetCounters();
 
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    ClearReassemblyIndex();
+    mReassemblyCollisions = 0;
+    mReassemblyTimeouts   = 0;
+#endif
+
 #if OPENTHREAD_FTD
     mFragmentPriorityList.Clear();
 #endif
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+    memset(mPacingTable, 0, sizeof(mPacingTable));
+#endif
 }
 
 void MeshForwarder::Start(void)
@@ -127,6 +155,12 @@ void MeshForwarder::Stop(void)
 
     mSendQueue.DequeueAndFreeAll();
     mReassemblyList.DequeueAndFreeAll();
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    ClearReassemblyIndex();
+#endif
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+    mParkedFragmentList.DequeueAndFreeAll();
+#endif
 
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
@@ -135,6 +169,13 @@ void MeshForwarder::Stop(void)
 
     mEnabled     = false;
     mSendMessage = nullptr;
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+    mNumPackedMessages = 0;
+#endif
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+    mPacingTimer.Stop();
+    memset(mPacingTable, 0, sizeof(mPacingTable));
+#endif
     Get<Mac::Mac>().SetRxOnWhenIdle(false);
 
 exit:
@@ -210,12 +251,38 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
         {
             mSendMessage = nullptr;
         }
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+        for (uint8_t i = 0; i < mNumPackedMessages; i++)
+        {
+            if (mPackedMessages[i] == &aMessage)
+            {
+                mPackedMessages[i] = mPackedMessages[--mNumPackedMessages];
+                break;
+            }
+        }
+#endif
     }
 
     LogMessage(kMessageEvict, aMessage, nullptr, kErrorNoBufs);
     queue->DequeueAndFree(aMessage);
 }
 
+bool MeshForwarder::ShouldDeferOffChannelOperation(void) const
+{
+    bool shouldDefer = false;
+
+#if OPENTHREAD_CONFIG_MAC_OFF_CHANNEL_OP_TX_QUEUE_THRESHOLD > 0
+    uint16_t messageCount;
+    uint16_t bufferCount;
+
+    mSendQueue.GetInfo(messageCount, bufferCount);
+    shouldDefer = (messageCount >= OPENTHREAD_CONFIG_MAC_OFF_CHANNEL_OP_TX_QUEUE_THRESHOLD);
+#endif
+
+    return shouldDefer;
+}
+
 void MeshForwarder::ResumeMessageTransmissions(void)
 {
     if (mTxPaused)
@@ -225,6 +292,61 @@ void MeshForwarder::ResumeMessageTransmissions(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+uint16_t MeshForwarder::GetQueueSnapshot(otForwarderQueueEntry *aEntries, uint16_t aMaxEntries) const
+{
+    uint16_t  count = 0;
+    TimeMilli now   = TimerMilli::GetNow();
+
+    for (uint8_t iter = 0; iter < 2; iter++)
+    {
+        bool           isSendQueue = (iter == 0);
+        const Message *head        = isSendQueue ? mSendQueue.GetHead() : mReassemblyList.GetHead();
+
+        for (const Message *message = head; message != nullptr && count < aMaxEntries; message = message->GetNext())
+        {
+            otForwarderQueueEntry &entry = aEntries[count++];
+
+            entry.mLength       = message->GetLength();
+            entry.mDestRloc16   = Mac::kShortAddrInvalid;
+            entry.mTimeInQueue  = now - message->GetQueueTime();
+            entry.mPriority     = static_cast<uint8_t>(message->GetPriority());
+            entry.mInSendQueue  = isSendQueue;
+            entry.mLinkSecurity = message->IsLinkSecurityEnabled();
+            entry.mDirectTx     = isSendQueue && message->GetDirectTransmission();
+
+            if (message->GetType() == Message::kTypeIp6)
+            {
+                Ip6::Header ip6Header;
+
+                if ((message->Read(0, ip6Header) == kErrorNone) && ip6Header.IsVersion6() &&
+                    ip6Header.GetDestination().GetIid().IsLocator())
+                {
+                    entry.mDestRloc16 = ip6Header.GetDestination().GetIid().GetLocator();
+                }
+            }
+        }
+    }
+
+    return count;
+}
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
+void MeshForwarder::RecordQueueDepthHistory(void)
+{
+    uint16_t sendMessages;
+    uint16_t sendBuffers;
+    uint16_t reassemblyMessages;
+    uint16_t reassemblyBuffers;
+
+    mSendQueue.GetInfo(sendMessages, sendBuffers);
+    mReassemblyList.GetInfo(reassemblyMessages, reassemblyBuffers);
+
+    Get<Utils::HistoryTracker>().RecordForwarderQueueDepth(sendMessages, reassemblyMessages);
+}
+#endif
+
 void MeshForwarder::ScheduleTransmissionTask(Tasklet &aTasklet)
 {
     aTasklet.Get<MeshForwarder>().ScheduleTransmissionTask();
@@ -232,7 +354,33 @@ void MeshForwarder::ScheduleTransmissionTask(Tasklet &aTasklet)
 
 void MeshForwarder::ScheduleTransmissionTask(void)
 {
-    VerifyOrExit(!mSendBusy && !mTxPaused);
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
+    RecordQueueDepthHistory();
+#endif
+
+    VerifyOrExit(!mTxPaused);
+
+#if OPENTHREAD_CONFIG_MAC_TX_PREEMPTION_ENABLE
+    if (mSendBusy)
+    {
+        // If a net-priority message is queued behind a lower-priority
+        // message whose frame is still waiting out its CSMA backoff (no
+        // fragment sent yet), preempt the pending attempt and re-select
+        // so that the net-priority message is sent first.
+
+        Message *head = mSendQueue.GetHead();
+
+        VerifyOrExit((head != nullptr) && (head->GetPriority() == Message::kPriorityNet) &&
+                     head->GetDirectTransmission());
+        VerifyOrExit((mSendMessage != nullptr) && (mSendMessage->GetPriority() < Message::kPriorityNet) &&
+                     (mSendMessage->GetOffset() == 0));
+        VerifyOrExit(Get<Mac::Mac>().TryPreemptTransmitDataDirect());
+
+        mSendBusy = false;
+    }
+#else
+    VerifyOrExit(!mSendBusy);
+#endif
 
     mSendMessage = GetDirectTransmission();
     VerifyOrExit(mSendMessage != nullptr);
@@ -249,12 +397,65 @@ exit:
 }
 
 Message *MeshForwarder::GetDirectTransmission(void)
+{
+    Message *message = nullptr;
+
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+    Message *schedulerHead = mSendQueue.GetSchedulerHead();
+
+    if ((schedulerHead != nullptr) && (schedulerHead != mSendQueue.GetHead()))
+    {
+        // The scheduler granted a lower priority level its byte budget.
+        // Limit the scan to that level; if no message in it is ready to
+        // go out, fall back to a strict priority scan below so that the
+        // grant cannot stall the queue.
+
+        message = FindDirectTransmission(schedulerHead, schedulerHead->GetPriority());
+    }
+#endif
+
+    if (message == nullptr)
+    {
+        message = FindDirectTransmission(mSendQueue.GetHead(), Message::kPriorityLow);
+    }
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+    if ((message != nullptr) && (message->GetOffset() > 0) && (message->GetType() == Message::kTypeIp6))
+    {
+        Message *bypass;
+
+        if (message != mFragmentTrainMessage)
+        {
+            mFragmentTrainMessage     = message;
+            mFragmentTrainBypassCount = 0;
+        }
+
+        bypass = FindFragmentTrainBypass(*message);
+
+        if (bypass != nullptr)
+        {
+            mFragmentTrainBypassCount++;
+            message = bypass;
+        }
+    }
+#endif
+
+    return message;
+}
+
+Message *MeshForwarder::FindDirectTransmission(Message *aStart, Message::Priority aMinPriority)
 {
     Message *curMessage, *nextMessage;
     Error    error = kErrorNone;
 
-    for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
+    for (curMessage = aStart; curMessage; curMessage = nextMessage)
     {
+        if (curMessage->GetPriority() < aMinPriority)
+        {
+            curMessage = nullptr;
+            break;
+        }
+
         if (!curMessage->GetDirectTransmission())
         {
             nextMessage = curMessage->GetNext();
@@ -296,6 +497,12 @@ Message *MeshForwarder::GetDirectTransmission(void)
         switch (error)
         {
         case kErrorNone:
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+            if (!PacingAllowsTransmission(*curMessage))
+            {
+                continue;
+            }
+#endif
             ExitNow();
 
 #if OPENTHREAD_FTD
@@ -318,6 +525,186 @@ exit:
     return curMessage;
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+
+Message *MeshForwarder::FindFragmentTrainBypass(Message &aTrainMessage)
+{
+    Message *   bypass = nullptr;
+    Ip6::Header trainHeader;
+    Ip6::Header header;
+
+    VerifyOrExit(mFragmentTrainBypassCount < kFragmentTrainMaxBypass);
+    SuccessOrExit(aTrainMessage.Read(0, trainHeader));
+
+    // Candidates are limited to the train's own priority level: any
+    // higher priority message would already have been selected ahead
+    // of the train, and a lower priority one must not jump the queue.
+
+    for (Message *cur = aTrainMessage.GetNext();
+         (cur != nullptr) && (cur->GetPriority() == aTrainMessage.GetPriority()); cur = cur->GetNext())
+    {
+        if (!cur->GetDirectTransmission() || (cur->GetOffset() != 0) || (cur->GetType() != Message::kTypeIp6) ||
+            (cur->GetLength() > kFragmentTrainBypassLength))
+        {
+            continue;
+        }
+
+        if ((cur->Read(0, header) != kErrorNone) || (header.GetDestination() == trainHeader.GetDestination()))
+        {
+            continue;
+        }
+
+        bypass = cur;
+        break;
+    }
+
+    VerifyOrExit(bypass != nullptr);
+
+    bypass->SetDoNotEvict(true);
+
+    if (UpdateIp6Route(*bypass) != kErrorNone)
+    {
+        // Leave the candidate for the normal selection path (which
+        // handles address query and drop) and restore the routing
+        // state (`mMacDest` et al.) computed for the train message.
+
+        bypass->SetDoNotEvict(false);
+        bypass = nullptr;
+        IgnoreError(UpdateIp6Route(aTrainMessage));
+        ExitNow();
+    }
+
+    bypass->SetDoNotEvict(false);
+
+exit:
+    return bypass;
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+
+MeshForwarder::PacingEntry *MeshForwarder::FindPacingEntry(uint16_t aNextHop, bool aAllocate)
+{
+    PacingEntry *found  = nullptr;
+    PacingEntry *victim = nullptr;
+
+    for (PacingEntry &entry : mPacingTable)
+    {
+        if (entry.Matches(aNextHop))
+        {
+            ExitNow(found = &entry);
+        }
+
+        // Prefer an unused entry, otherwise evict the least recently
+        // refilled (i.e., least recently sent to) one.
+        if (!entry.mInUse)
+        {
+            victim = &entry;
+        }
+        else if ((victim == nullptr) || (victim->mInUse && (entry.mLastRefill < victim->mLastRefill)))
+        {
+            victim = &entry;
+        }
+    }
+
+    VerifyOrExit(aAllocate);
+
+    found              = victim;
+    found->mInUse      = true;
+    found->mNextHop    = aNextHop;
+    found->mTokens     = kPacingBurstSize;
+    found->mTxInterval = kPacingDefaultInterval;
+    found->mLastRefill = TimerMilli::GetNow();
+
+exit:
+    return found;
+}
+
+bool MeshForwarder::PacingAllowsTransmission(const Message &aMessage)
+{
+    bool         allow = true;
+    PacingEntry *entry;
+    TimeMilli    now = TimerMilli::GetNow();
+
+    // Only normal and low priority unicasts towards a short next-hop
+    // address are paced; control traffic goes out unthrottled.
+    VerifyOrExit(aMessage.GetPriority() <= Message::kPriorityNormal);
+    VerifyOrExit(mMacDest.IsShort() && (mMacDest.GetShort() != Mac::kShortAddrBroadcast));
+
+    entry = FindPacingEntry(mMacDest.GetShort(), /* aAllocate */ true);
+
+    if (now - entry->mLastRefill >= entry->mTxInterval)
+    {
+        uint32_t newTokens = (now - entry->mLastRefill) / entry->mTxInterval;
+
+        if (newTokens >= static_cast<uint32_t>(kPacingBurstSize - entry->mTokens))
+        {
+            entry->mTokens     = kPacingBurstSize;
+            entry->mLastRefill = now;
+        }
+        else
+        {
+            entry->mTokens += static_cast<uint8_t>(newTokens);
+            entry->mLastRefill += newTokens * entry->mTxInterval;
+        }
+    }
+
+    if (entry->mTokens > 0)
+    {
+        entry->mTokens--;
+    }
+    else
+    {
+        // Out of tokens: skip this destination for now and retry once
+        // the next token becomes available.
+        mPacingTimer.FireAtIfEarlier(entry->mLastRefill + entry->mTxInterval);
+        allow = false;
+    }
+
+exit:
+    return allow;
+}
+
+void MeshForwarder::UpdatePacingInterval(Error aTxError, const Mac::Address &aMacDest)
+{
+    uint32_t     serviceTime = TimerMilli::GetNow() - mPacingTxStartTime;
+    uint32_t     interval;
+    PacingEntry *entry;
+
+    VerifyOrExit(aMacDest.IsShort() && (aMacDest.GetShort() != Mac::kShortAddrBroadcast));
+
+    entry = FindPacingEntry(aMacDest.GetShort(), /* aAllocate */ false);
+    VerifyOrExit(entry != nullptr);
+
+    if (aTxError != kErrorNone)
+    {
+        // A failed frame (channel access failure or no ACK) indicates
+        // congestion towards this next hop: back off multiplicatively.
+        interval = static_cast<uint32_t>(entry->mTxInterval) * 2;
+    }
+    else
+    {
+        // Track the measured per-frame service time (CSMA backoff,
+        // retries and ACK wait) with an exponentially weighted moving
+        // average.
+        interval = (3u * entry->mTxInterval + serviceTime) / 4;
+    }
+
+    interval           = OT_MAX(interval, static_cast<uint32_t>(kPacingMinInterval));
+    entry->mTxInterval = static_cast<uint16_t>(OT_MIN(interval, static_cast<uint32_t>(kPacingMaxInterval)));
+
+exit:
+    return;
+}
+
+void MeshForwarder::HandlePacingTimer(Timer &aTimer)
+{
+    aTimer.Get<MeshForwarder>().mScheduleTransmissionTask.Post();
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+
 Error MeshForwarder::UpdateIp6Route(Message &aMessage)
 {
     Mle::MleRouter &mle   = Get<Mle::MleRouter>();
@@ -492,6 +879,10 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     mSendBusy = true;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+    mPacingTxStartTime = TimerMilli::GetNow();
+#endif
+
     switch (mSendMessage->GetType())
     {
     case Message::kTypeIp6:
@@ -509,6 +900,14 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
         mMessageNextOffset = PrepareDataFrame(*frame, *mSendMessage, mMacSource, mMacDest, mAddMeshHeader, mMeshSource,
                                               mMeshDest, addFragHeader);
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+        if ((mMessageNextOffset == mSendMessage->GetLength()) && !mAddMeshHeader && !mMacDest.IsBroadcast() &&
+            (mSendMessage->GetSubType() == Message::kSubTypeNone))
+        {
+            AppendPackedMessages(*frame);
+        }
+#endif
+
         if ((mSendMessage->GetSubType() == Message::kSubTypeMleChildIdRequest) && mSendMessage->IsLinkSecurityEnabled())
         {
             otLogNoteMac("Child ID Request requires fragmentation, aborting tx");
@@ -887,6 +1286,112 @@ start:
     return nextOffset;
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+
+// This method packs additional small queued datagrams to the same
+// source/destination into the remaining space of a prepared frame. The
+// frame must hold a single complete (unfragmented) 6LoWPAN datagram of
+// `mSendMessage`. On success the frame payload is converted to the
+// packed format (dispatch byte followed by length-prefixed
+// sub-payloads); if no other datagram fits, the frame is left
+// unchanged.
+void MeshForwarder::AppendPackedMessages(Mac::TxFrame &aFrame)
+{
+    uint8_t *   payload          = aFrame.GetPayload();
+    uint16_t    maxPayloadLength = aFrame.GetMaxPayloadLength();
+    uint16_t    length           = aFrame.GetPayloadLength();
+    uint16_t    offset;
+    Ip6::Header firstHeader;
+    Message *   next;
+
+    mNumPackedMessages = 0;
+
+    VerifyOrExit(Lowpan::Lowpan::IsLowpanHc(payload));
+    VerifyOrExit(maxPayloadLength - length > static_cast<uint16_t>(kPackedFrameOverhead + sizeof(uint16_t)));
+    SuccessOrExit(mSendMessage->Read(0, firstHeader));
+
+    // Tentatively convert the payload to the packed format. The
+    // conversion is undone if no other queued datagram fits.
+
+    memmove(payload + kPackedFrameOverhead, payload, length);
+    payload[0] = kPackedFrameDispatch;
+    Encoding::BigEndian::WriteUint16(length, payload + sizeof(uint8_t));
+    offset = kPackedFrameOverhead + length;
+
+    for (Message *message = mSendQueue.GetHead(); message != nullptr; message = next)
+    {
+        Lowpan::BufferWriter buffer(payload + offset + sizeof(uint16_t),
+                                    maxPayloadLength - offset - sizeof(uint16_t));
+        Ip6::Header          ip6Header;
+        uint16_t             hcLength;
+        uint16_t             ip6PayloadLength;
+
+        next = message->GetNext();
+
+        if (mNumPackedMessages == kMaxPackedMessages - 1)
+        {
+            break;
+        }
+
+        if ((message == mSendMessage) || (message->GetType() != Message::kTypeIp6) ||
+            (message->GetSubType() != Message::kSubTypeNone) || !message->GetDirectTransmission() ||
+            message->IsChildPending() || (message->GetOffset() != 0) ||
+            (message->IsLinkSecurityEnabled() != mSendMessage->IsLinkSecurityEnabled()))
+        {
+            continue;
+        }
+
+        // Same IPv6 source and destination implies the same MAC
+        // addressing and route decision as the first datagram.
+
+        if ((message->Read(0, ip6Header) != kErrorNone) || (ip6Header.GetSource() != firstHeader.GetSource()) ||
+            (ip6Header.GetDestination() != firstHeader.GetDestination()))
+        {
+            continue;
+        }
+
+        if (Get<Lowpan::Lowpan>().Compress(*message, mMacSource, mMacDest, buffer) != kErrorNone)
+        {
+            message->SetOffset(0);
+            continue;
+        }
+
+        hcLength         = static_cast<uint16_t>(buffer.GetWritePointer() - (payload + offset + sizeof(uint16_t)));
+        ip6PayloadLength = message->GetLength() - message->GetOffset();
+
+        if (hcLength + ip6PayloadLength > maxPayloadLength - offset - sizeof(uint16_t))
+        {
+            message->SetOffset(0);
+            continue;
+        }
+
+        message->ReadBytes(message->GetOffset(), payload + offset + sizeof(uint16_t) + hcLength, ip6PayloadLength);
+        Encoding::BigEndian::WriteUint16(hcLength + ip6PayloadLength, payload + offset);
+        offset += sizeof(uint16_t) + hcLength + ip6PayloadLength;
+
+        message->SetOffset(0);
+        mPackedMessages[mNumPackedMessages++] = message;
+
+        otLogDebgMac("Frame packing: packed msg len:%d (sub-payload len:%d)", message->GetLength(),
+                     hcLength + ip6PayloadLength);
+    }
+
+    if (mNumPackedMessages == 0)
+    {
+        // No other datagram was packed; restore the plain payload.
+        memmove(payload, payload + kPackedFrameOverhead, length);
+    }
+    else
+    {
+        aFrame.SetPayloadLength(offset);
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+
 Neighbor *MeshForwarder::UpdateNeighborOnSentFrame(Mac::TxFrame &aFrame, Error aError, const Mac::Address &aMacDest)
 {
     Neighbor *neighbor = nullptr;
@@ -1007,6 +1512,10 @@ void MeshForwarder::UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDes
 
     OT_ASSERT(mSendMessage->GetDirectTransmission());
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+    UpdatePacingInterval(aFrameTxError, aMacDest);
+#endif
+
     if (aFrameTxError != kErrorNone)
     {
         // If the transmission of any fragment frame fails,
@@ -1027,11 +1536,32 @@ void MeshForwarder::UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDes
     if (mMessageNextOffset < mSendMessage->GetLength())
     {
         mSendMessage->SetOffset(mMessageNextOffset);
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PIPELINING_ENABLE
+        if (!mTxPaused)
+        {
+            // Request the next fragment frame right away from the
+            // transmit-done context. The MAC serves the request as its
+            // next operation (after this call chain returns), skipping
+            // the per-fragment scheduling tasklet round trip.
+            Get<Mac::Mac>().RequestDirectFrameTransmission();
+            return;
+        }
+#endif
+
         ExitNow();
     }
 
     txError = aFrameTxError;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+    if (mSendMessage == mFragmentTrainMessage)
+    {
+        mFragmentTrainMessage     = nullptr;
+        mFragmentTrainBypassCount = 0;
+    }
+#endif
+
     mSendMessage->ClearDirectTransmission();
     mSendMessage->SetOffset(0);
 
@@ -1102,6 +1632,35 @@ void MeshForwarder::UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDes
 
     RemoveMessageIfNoPendingTx(*mSendMessage);
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+    while (mNumPackedMessages > 0)
+    {
+        Message &message = *mPackedMessages[--mNumPackedMessages];
+
+        message.SetTxSuccess(aFrameTxError == kErrorNone);
+        message.ClearDirectTransmission();
+        message.SetOffset(0);
+
+        if (aNeighbor != nullptr)
+        {
+            aNeighbor->GetLinkInfo().AddMessageTxStatus(message.GetTxSuccess());
+        }
+
+        LogMessage(kMessageTransmit, message, &aMacDest, aFrameTxError);
+
+        if (message.GetTxSuccess())
+        {
+            mIpCounters.mTxSuccess++;
+        }
+        else
+        {
+            mIpCounters.mTxFailure++;
+        }
+
+        RemoveMessageIfNoPendingTx(message);
+    }
+#endif
+
 exit:
     mScheduleTransmissionTask.Post();
 }
@@ -1130,6 +1689,9 @@ void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
     uint8_t *      payload;
     uint16_t       payloadLength;
     Error          error = kErrorNone;
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    uint64_t profileEnterTime = Get<Utils::PipelineProfiler>().GetNow();
+#endif
 
     VerifyOrExit(mEnabled, error = kErrorInvalidState);
 
@@ -1162,6 +1724,12 @@ void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
         {
             HandleLowpanHC(payload, payloadLength, macSource, macDest, linkInfo);
         }
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+        else if (payloadLength >= 1 && payload[0] == kPackedFrameDispatch)
+        {
+            HandlePackedFrame(payload, payloadLength, macSource, macDest, linkInfo);
+        }
+#endif
         else
         {
             VerifyOrExit(payloadLength == 0, error = kErrorNotLowpanDataFrame);
@@ -1185,6 +1753,10 @@ exit:
     {
         LogFrame("Dropping rx frame", aFrame, error);
     }
+
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+    Get<Utils::PipelineProfiler>().Sample(Utils::PipelineProfiler::kStageMeshForwarder, profileEnterTime);
+#endif
 }
 
 void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
@@ -1270,21 +1842,49 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
 
         mReassemblyList.Enqueue(*message);
 
+#if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
+        RecordQueueDepthHistory();
+#endif
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+        FindReassemblyBucket(fragmentHeader.GetDatagramTag()) = message;
+#endif
+
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+        ApplyParkedFragments(*message);
+#endif
+
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
     }
     else // Received frame is a "next fragment".
     {
-        for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+        message = FindReassemblyBucket(fragmentHeader.GetDatagramTag());
+
+        if ((message != nullptr) && !MatchesReassemblyBuffer(*message, fragmentHeader, aFrameLength, aLinkInfo))
+        {
+            message = nullptr;
+        }
+
+        if (message == nullptr)
+#endif
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (message->GetLength() == fragmentHeader.GetDatagramSize() &&
-                message->GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                message->GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                message->GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize() &&
-                message->IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled())
+            for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
             {
-                break;
+                if (MatchesReassemblyBuffer(*message, fragmentHeader, aFrameLength, aLinkInfo))
+                {
+                    break;
+                }
+            }
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+            if (message != nullptr)
+            {
+                // The reassembly buffer was displaced from its hash
+                // bucket by another datagram with the same bucket.
+                mReassemblyCollisions++;
             }
+#endif
         }
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
@@ -1298,6 +1898,21 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
             ClearReassemblyList();
         }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+        if (message == nullptr)
+        {
+            // The fragment does not contiguously extend any reassembly
+            // buffer (e.g., the link reordered a fragment pair). Park
+            // it (bounded) so it can be retried whenever a fragment is
+            // accepted in order, instead of voiding the whole datagram.
+
+            if (ParkFragment(fragmentHeader, aFrame, aFrameLength, aLinkInfo) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
+        }
+#endif
+
         VerifyOrExit(message != nullptr, error = kErrorDrop);
 
         message->WriteBytes(message->GetOffset(), aFrame, aFrameLength);
@@ -1307,19 +1922,26 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
         message->AddLqi(aLinkInfo.GetLqi());
 #endif
         message->SetTimeout(kReassemblyTimeout);
+
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+        ApplyParkedFragments(*message);
+#endif
     }
 
 exit:
 
-    if (error == kErrorNone)
+    if ((error == kErrorNone) && (message != nullptr))
     {
         if (message->GetOffset() >= message->GetLength())
         {
             mReassemblyList.Dequeue(*message);
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+            RemoveFromReassemblyIndex(*message);
+#endif
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacSource));
         }
     }
-    else
+    else if (error != kErrorNone)
     {
         LogFragmentFrameDrop(error, aFrameLength, aMacSource, aMacDest, fragmentHeader,
                              aLinkInfo.IsLinkSecurityEnabled());
@@ -1340,8 +1962,162 @@ void MeshForwarder::ClearReassemblyList(void)
     }
 
     mReassemblyList.DequeueAndFreeAll();
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    ClearReassemblyIndex();
+#endif
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+    mParkedFragmentList.DequeueAndFreeAll();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+
+Error MeshForwarder::ParkFragment(const Lowpan::FragmentHeader &aFragmentHeader,
+                                  const uint8_t *               aFrame,
+                                  uint16_t                      aFrameLength,
+                                  const ThreadLinkInfo &        aLinkInfo)
+{
+    Error    error = kErrorNone;
+    Message *parked;
+    uint8_t  header[Lowpan::FragmentHeader::kSubsequentFragmentHeaderSize];
+    uint16_t numParked = 0;
+
+    for (const Message *cur = mParkedFragmentList.GetHead(); cur != nullptr; cur = cur->GetNext())
+    {
+        numParked++;
+    }
+
+    if (numParked >= kMaxParkedFragments)
+    {
+        mParkedFragmentList.DequeueAndFree(*mParkedFragmentList.GetHead());
+    }
+
+    parked = Get<MessagePool>().New(Message::kType6lowpan, 0);
+    VerifyOrExit(parked != nullptr, error = kErrorNoBufs);
+
+    // The parked message contains the fragment header followed by the
+    // fragment payload, so it can be re-matched against a reassembly
+    // buffer later by parsing the header again.
+
+    SuccessOrExit(error = parked->AppendBytes(header, aFragmentHeader.WriteTo(header)));
+    SuccessOrExit(error = parked->AppendBytes(aFrame, aFrameLength));
+
+    parked->SetLinkSecurityEnabled(aLinkInfo.IsLinkSecurityEnabled());
+    parked->SetTimeout(kReassemblyTimeout);
+
+    mParkedFragmentList.Enqueue(*parked);
+    parked = nullptr;
+
+    Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
+
+exit:
+    FreeMessage(parked);
+    return error;
+}
+
+void MeshForwarder::ApplyParkedFragments(Message &aMessage)
+{
+    // Applies any parked fragment that now contiguously extends
+    // @p aMessage, repeating until no parked fragment applies (e.g., a
+    // parked pair can complete a datagram in one pass). Parked
+    // fragments that fall behind the reassembly progress are stale
+    // (duplicates) and are freed.
+
+    bool applied;
+
+    do
+    {
+        Message *next;
+
+        applied = false;
+
+        for (Message *parked = mParkedFragmentList.GetHead(); parked != nullptr; parked = next)
+        {
+            Lowpan::FragmentHeader fragmentHeader;
+            uint16_t               headerLength;
+
+            next = parked->GetNext();
+
+            if ((fragmentHeader.ParseFrom(*parked, 0, headerLength) != kErrorNone) ||
+                (fragmentHeader.GetDatagramTag() != aMessage.GetDatagramTag()) ||
+                (fragmentHeader.GetDatagramSize() != aMessage.GetLength()) ||
+                (parked->IsLinkSecurityEnabled() != aMessage.IsLinkSecurityEnabled()))
+            {
+                continue;
+            }
+
+            if (fragmentHeader.GetDatagramOffset() < aMessage.GetOffset())
+            {
+                mParkedFragmentList.DequeueAndFree(*parked);
+                continue;
+            }
+
+            if (fragmentHeader.GetDatagramOffset() == aMessage.GetOffset())
+            {
+                uint16_t length = parked->GetLength() - headerLength;
+
+                if (aMessage.GetOffset() + length <= aMessage.GetLength())
+                {
+                    parked->CopyTo(headerLength, aMessage.GetOffset(), length, aMessage);
+                    aMessage.MoveOffset(length);
+                    aMessage.SetTimeout(kReassemblyTimeout);
+                    applied = true;
+                }
+
+                mParkedFragmentList.DequeueAndFree(*parked);
+            }
+        }
+    } while (applied && (aMessage.GetOffset() < aMessage.GetLength()));
+}
+
+bool MeshForwarder::UpdateParkedFragmentList(void)
+{
+    Message *next = nullptr;
+
+    for (Message *parked = mParkedFragmentList.GetHead(); parked != nullptr; parked = next)
+    {
+        next = parked->GetNext();
+
+        if (parked->GetTimeout() > 0)
+        {
+            parked->DecrementTimeout();
+        }
+        else
+        {
+            mParkedFragmentList.DequeueAndFree(*parked);
+        }
+    }
+
+    return mParkedFragmentList.GetHead() != nullptr;
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+
+bool MeshForwarder::MatchesReassemblyBuffer(const Message &               aMessage,
+                                            const Lowpan::FragmentHeader &aFragmentHeader,
+                                            uint16_t                      aFrameLength,
+                                            const ThreadLinkInfo &        aLinkInfo)
+{
+    // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+    return (aMessage.GetLength() == aFragmentHeader.GetDatagramSize()) &&
+           (aMessage.GetDatagramTag() == aFragmentHeader.GetDatagramTag()) &&
+           (aMessage.GetOffset() == aFragmentHeader.GetDatagramOffset()) &&
+           (aMessage.GetOffset() + aFrameLength <= aFragmentHeader.GetDatagramSize()) &&
+           (aMessage.IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled());
 }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+void MeshForwarder::RemoveFromReassemblyIndex(const Message &aMessage)
+{
+    Message *&bucket = FindReassemblyBucket(aMessage.GetDatagramTag());
+
+    if (bucket == &aMessage)
+    {
+        bucket = nullptr;
+    }
+}
+#endif
+
 void MeshForwarder::HandleTimeTick(void)
 {
     bool contineRxingTicks = false;
@@ -1352,6 +2128,10 @@ void MeshForwarder::HandleTimeTick(void)
 
     contineRxingTicks = UpdateReassemblyList() || contineRxingTicks;
 
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+    contineRxingTicks = UpdateParkedFragmentList() || contineRxingTicks;
+#endif
+
     if (!contineRxingTicks)
     {
         Get<TimeTicker>().UnregisterReceiver(TimeTicker::kMeshForwarder);
@@ -1379,6 +2159,10 @@ bool MeshForwarder::UpdateReassemblyList(void)
                 mIpCounters.mRxFailure++;
             }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+            RemoveFromReassemblyIndex(*message);
+            mReassemblyTimeouts++;
+#endif
             mReassemblyList.DequeueAndFree(*message);
         }
     }
@@ -1418,6 +2202,34 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+
+void MeshForwarder::HandlePackedFrame(const uint8_t *       aFrame,
+                                      uint16_t              aFrameLength,
+                                      const Mac::Address &  aMacSource,
+                                      const Mac::Address &  aMacDest,
+                                      const ThreadLinkInfo &aLinkInfo)
+{
+    uint16_t offset = sizeof(uint8_t);
+
+    while (offset + sizeof(uint16_t) <= aFrameLength)
+    {
+        uint16_t subLength = Encoding::BigEndian::ReadUint16(aFrame + offset);
+
+        offset += sizeof(uint16_t);
+
+        if ((subLength == 0) || (subLength > aFrameLength - offset))
+        {
+            break;
+        }
+
+        HandleLowpanHC(aFrame + offset, subLength, aMacSource, aMacDest, aLinkInfo);
+        offset += subLength;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+
 void MeshForwarder::HandleLowpanHC(const uint8_t *       aFrame,
                                    uint16_t              aFrameLength,
                                    const Mac::Address &  aMacSource,
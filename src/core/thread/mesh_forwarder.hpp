@@ -277,6 +277,48 @@ public:
      */
     const PriorityQueue &GetSendQueue(void) const { return mSendQueue; }
 
+    /**
+     * This method indicates whether a background off-channel radio operation (e.g., an MLE Announcement transmission
+     * or an energy scan) should be deferred to yield the radio to pending data traffic.
+     *
+     * The decision is based on the current send queue depth compared against the threshold specified by
+     * `OPENTHREAD_CONFIG_MAC_OFF_CHANNEL_OP_TX_QUEUE_THRESHOLD` (a zero threshold disables the deferral).
+     *
+     * @retval TRUE   The off-channel operation should be deferred and retried later.
+     * @retval FALSE  The off-channel operation can proceed.
+     *
+     */
+    bool ShouldDeferOffChannelOperation(void) const;
+
+#if OPENTHREAD_CONFIG_MESSAGE_PRIORITY_DRR_ENABLE
+    /**
+     * This method sets the deficit round robin byte quantum used by the transmit scheduler for a priority level.
+     *
+     * A quantum of zero (the default) keeps strict priority order for the level.
+     *
+     * @param[in] aPriority  A priority level.
+     * @param[in] aQuantum   The byte quantum the level earns on each scheduler round.
+     *
+     * @retval kErrorNone         Successfully set the quantum.
+     * @retval kErrorInvalidArgs  @p aPriority is the network control priority level (which is always strict).
+     *
+     */
+    Error SetTxQuantum(Message::Priority aPriority, uint16_t aQuantum)
+    {
+        return mSendQueue.SetQuantum(aPriority, aQuantum);
+    }
+
+    /**
+     * This method gets the deficit round robin byte quantum used by the transmit scheduler for a priority level.
+     *
+     * @param[in] aPriority  A priority level.
+     *
+     * @returns The byte quantum for @p aPriority (zero if the level is not budgeted).
+     *
+     */
+    uint16_t GetTxQuantum(Message::Priority aPriority) const { return mSendQueue.GetQuantum(aPriority); }
+#endif
+
     /**
      * This method returns a reference to the reassembly queue.
      *
@@ -285,6 +327,22 @@ public:
      */
     const MessageQueue &GetReassemblyQueue(void) const { return mReassemblyList; }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_QUEUE_SNAPSHOT_ENABLE
+    /**
+     * This method writes a packed snapshot of the messages in the send queue and the reassembly list.
+     *
+     * Send queue entries are written first (in queue order), followed by reassembly list entries. At most
+     * @p aMaxEntries entries are written.
+     *
+     * @param[out] aEntries     A pointer to an array of entries to populate.
+     * @param[in]  aMaxEntries  The number of entries in @p aEntries array.
+     *
+     * @returns The number of entries written to @p aEntries.
+     *
+     */
+    uint16_t GetQueueSnapshot(otForwarderQueueEntry *aEntries, uint16_t aMaxEntries) const;
+#endif
+
     /**
      * This method returns a reference to the IP level counters.
      *
@@ -299,6 +357,25 @@ public:
      */
     void ResetCounters(void) { memset(&mIpCounters, 0, sizeof(mIpCounters)); }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    /**
+     * This method returns the number of "next fragment" frames whose reassembly buffer was found by scanning the
+     * reassembly list after a hash index miss.
+     *
+     * @returns The number of reassembly index collisions.
+     *
+     */
+    uint32_t GetReassemblyCollisions(void) const { return mReassemblyCollisions; }
+
+    /**
+     * This method returns the number of messages dropped from the reassembly list due to timeout.
+     *
+     * @returns The number of reassembly timeouts.
+     *
+     */
+    uint32_t GetReassemblyTimeouts(void) const { return mReassemblyTimeouts; }
+#endif
+
 #if OPENTHREAD_FTD
     /**
      * This method returns a reference to the resolving queue.
@@ -388,6 +465,9 @@ private:
     void  SendIcmpErrorIfDstUnreach(const Message &     aMessage,
                                     const Mac::Address &aMacSource,
                                     const Mac::Address &aMacDest);
+    #if OPENTHREAD_CONFIG_HISTORY_TRACKER_ENABLE
+    void RecordQueueDepthHistory(void);
+#endif
     Error CheckReachability(const uint8_t *     aFrame,
                             uint16_t            aFrameLength,
                             const Mac::Address &aMeshSource,
@@ -418,6 +498,10 @@ private:
     void     GetMacDestinationAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     void     GetMacSourceAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     Message *GetDirectTransmission(void);
+    Message *FindDirectTransmission(Message *aStart, Message::Priority aMinPriority);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+    Message *FindFragmentTrainBypass(Message &aTrainMessage);
+#endif
     void     HandleMesh(uint8_t *             aFrame,
                         uint16_t              aFrameLength,
                         const Mac::Address &  aMacSource,
@@ -432,6 +516,14 @@ private:
                             const Mac::Address &  aMacSource,
                             const Mac::Address &  aMacDest,
                             const ThreadLinkInfo &aLinkInfo);
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+    void     AppendPackedMessages(Mac::TxFrame &aFrame);
+    void     HandlePackedFrame(const uint8_t *       aFrame,
+                               uint16_t              aFrameLength,
+                               const Mac::Address &  aMacSource,
+                               const Mac::Address &  aMacDest,
+                               const ThreadLinkInfo &aLinkInfo);
+#endif
     uint16_t PrepareDataFrame(Mac::TxFrame &      aFrame,
                               Message &           aMessage,
                               const Mac::Address &aMacSource,
@@ -459,6 +551,33 @@ private:
     void  RemoveMessage(Message &aMessage);
     void  HandleDiscoverComplete(void);
 
+    static bool MatchesReassemblyBuffer(const Message &               aMessage,
+                                        const Lowpan::FragmentHeader &aFragmentHeader,
+                                        uint16_t                      aFrameLength,
+                                        const ThreadLinkInfo &        aLinkInfo);
+
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+    static constexpr uint16_t kMaxParkedFragments = OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_SIZE;
+
+    Error ParkFragment(const Lowpan::FragmentHeader &aFragmentHeader,
+                       const uint8_t *               aFrame,
+                       uint16_t                      aFrameLength,
+                       const ThreadLinkInfo &        aLinkInfo);
+    void  ApplyParkedFragments(Message &aMessage);
+    bool  UpdateParkedFragmentList(void);
+#endif
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    static constexpr uint16_t kReassemblyIndexSize = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_SIZE;
+
+    Message *&FindReassemblyBucket(uint16_t aDatagramTag)
+    {
+        return mReassemblyIndex[aDatagramTag % kReassemblyIndexSize];
+    }
+    void RemoveFromReassemblyIndex(const Message &aMessage);
+    void ClearReassemblyIndex(void) { memset(mReassemblyIndex, 0, sizeof(mReassemblyIndex)); }
+#endif
+
     void          HandleReceivedFrame(Mac::RxFrame &aFrame);
     Mac::TxFrame *HandleFrameRequest(Mac::TxFrames &aTxFrames);
     Neighbor *    UpdateNeighborOnSentFrame(Mac::TxFrame &aFrame, Error aError, const Mac::Address &aMacDest);
@@ -470,6 +589,35 @@ private:
     void          UpdateSendMessage(Error aFrameTxError, Mac::Address &aMacDest, Neighbor *aNeighbor);
     void          RemoveMessageIfNoPendingTx(Message &aMessage);
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+    // Token-bucket pacing state for one next-hop destination. Tokens
+    // are counted in frames; one token is consumed per selected frame
+    // and tokens refill at one per `mTxInterval` msec, which tracks
+    // the measured link-layer service time (CSMA backoff, retries and
+    // ACK wait) of frames to this next hop.
+    struct PacingEntry
+    {
+        bool Matches(uint16_t aNextHop) const { return mInUse && (mNextHop == aNextHop); }
+
+        bool      mInUse;      // Whether this entry is in use.
+        uint16_t  mNextHop;    // The next-hop RLOC16.
+        uint8_t   mTokens;     // Available frame tokens.
+        uint16_t  mTxInterval; // Per-token refill interval (in msec).
+        TimeMilli mLastRefill; // The time of the last token refill.
+    };
+
+    static constexpr uint16_t kPacingTableSize        = OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_TABLE_SIZE;
+    static constexpr uint8_t  kPacingBurstSize        = 4;   // Token bucket capacity (in frames).
+    static constexpr uint16_t kPacingDefaultInterval  = 8;   // Initial per-token interval (in msec).
+    static constexpr uint16_t kPacingMinInterval      = 2;   // Lower bound on the per-token interval (in msec).
+    static constexpr uint16_t kPacingMaxInterval      = 250; // Upper bound on the per-token interval (in msec).
+
+    PacingEntry *FindPacingEntry(uint16_t aNextHop, bool aAllocate);
+    bool         PacingAllowsTransmission(const Message &aMessage);
+    void         UpdatePacingInterval(Error aTxError, const Mac::Address &aMacDest);
+    static void  HandlePacingTimer(Timer &aTimer);
+#endif
+
     void        HandleTimeTick(void);
     static void ScheduleTransmissionTask(Tasklet &aTasklet);
     void        ScheduleTransmissionTask(void);
@@ -562,11 +710,42 @@ private:
 
     PriorityQueue mSendQueue;
     MessageQueue  mReassemblyList;
+#if OPENTHREAD_CONFIG_6LOWPAN_OOO_FRAGMENT_BUFFER_ENABLE
+    MessageQueue mParkedFragmentList;
+#endif
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_INDEX_ENABLE
+    Message *mReassemblyIndex[kReassemblyIndexSize];
+    uint32_t mReassemblyCollisions;
+    uint32_t mReassemblyTimeouts;
+#endif
     uint16_t      mFragTag;
     uint16_t      mMessageNextOffset;
 
     Message *mSendMessage;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_ENABLE
+    static constexpr uint8_t  kFragmentTrainMaxBypass    = OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_MAX_BYPASS;
+    static constexpr uint16_t kFragmentTrainBypassLength = OPENTHREAD_CONFIG_MESH_FORWARDER_FRAGMENT_INTERLEAVE_SMALL_LENGTH;
+
+    // Only used for identity comparison (never dereferenced), to reset
+    // the bypass budget when a different fragment train starts.
+    const Message *mFragmentTrainMessage;
+    uint8_t        mFragmentTrainBypassCount;
+#endif
+
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_ENABLE
+    // A packed frame starts with the dispatch byte followed by
+    // length-prefixed sub-payloads (2-byte length, big-endian).
+    static constexpr uint8_t kPackedFrameDispatch = 0x48; // An unassigned 6LoWPAN dispatch value (0b0100_1000).
+    static constexpr uint8_t kPackedFrameOverhead = sizeof(uint8_t) + sizeof(uint16_t);
+    static constexpr uint8_t kMaxPackedMessages   = OPENTHREAD_CONFIG_MESH_FORWARDER_FRAME_PACKING_MAX_MESSAGES;
+
+    static_assert(kMaxPackedMessages >= 2, "FRAME_PACKING_MAX_MESSAGES must be at least 2");
+
+    Message *mPackedMessages[kMaxPackedMessages - 1];
+    uint8_t  mNumPackedMessages;
+#endif
+
     Mac::Address mMacSource;
     Mac::Address mMacDest;
     uint16_t     mMeshSource;
@@ -578,6 +757,12 @@ private:
 
     Tasklet mScheduleTransmissionTask;
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_PACING_ENABLE
+    TimerMilli  mPacingTimer;
+    TimeMilli   mPacingTxStartTime;
+    PacingEntry mPacingTable[kPacingTableSize];
+#endif
+
     otIpCounters mIpCounters;
 
 #if OPENTHREAD_FTD
@@ -88,6 +88,9 @@ Mle::Mle(Instance &aInstance)
     , mDataRequestState(kDataRequestNone)
     , mAddressRegistrationMode(kAppendAllAddresses)
     , mHasRestored(false)
+#if OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE
+    , mFastAttachPending(false)
+#endif
     , mParentLinkMargin(0)
     , mParentIsSingleton(false)
     , mReceivedResponseFromParent(false)
@@ -385,6 +388,10 @@ Error Mle::Restore(void)
         mParent.SetRloc16(Rloc16FromRouterId(RouterIdFromRloc16(networkInfo.GetRloc16())));
         mParent.SetState(Neighbor::kStateRestored);
 
+#if OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE
+        mFastAttachPending = true;
+#endif
+
 #if OPENTHREAD_CONFIG_MLE_INFORM_PREVIOUS_PARENT_ON_REATTACH
         mPreviousParentRloc = mParent.GetRloc16();
 #endif
@@ -1053,6 +1060,11 @@ Error Mle::AppendSourceAddress(Message &aMessage) const
     return Tlv::Append<SourceAddressTlv>(aMessage, GetRloc16());
 }
 
+Error Mle::AppendSourceAddress(TlvBuilder &aBuilder) const
+{
+    return aBuilder.Append<SourceAddressTlv>(GetRloc16());
+}
+
 Error Mle::AppendStatus(Message &aMessage, StatusTlv::Status aStatus)
 {
     return Tlv::Append<StatusTlv>(aMessage, aStatus);
@@ -1104,11 +1116,37 @@ exit:
     return error;
 }
 
+Error Mle::ReadChallengeOrResponse(const TlvIndex &aTlvIndex, uint8_t aTlvType, Challenge &aBuffer)
+{
+    Error    error;
+    uint16_t offset;
+    uint16_t length;
+
+    SuccessOrExit(error = aTlvIndex.FindTlvValueOffset(aTlvType, offset, length));
+    VerifyOrExit(length >= kMinChallengeSize, error = kErrorParse);
+
+    if (length > kMaxChallengeSize)
+    {
+        length = kMaxChallengeSize;
+    }
+
+    aTlvIndex.GetMessage().ReadBytes(offset, aBuffer.mBuffer, length);
+    aBuffer.mLength = static_cast<uint8_t>(length);
+
+exit:
+    return error;
+}
+
 Error Mle::ReadChallenge(const Message &aMessage, Challenge &aChallenge)
 {
     return ReadChallengeOrResponse(aMessage, Tlv::kChallenge, aChallenge);
 }
 
+Error Mle::ReadChallenge(const TlvIndex &aTlvIndex, Challenge &aChallenge)
+{
+    return ReadChallengeOrResponse(aTlvIndex, Tlv::kChallenge, aChallenge);
+}
+
 Error Mle::ReadResponse(const Message &aMessage, Challenge &aResponse)
 {
     return ReadChallengeOrResponse(aMessage, Tlv::kResponse, aResponse);
@@ -1177,6 +1215,19 @@ Error Mle::AppendLeaderData(Message &aMessage)
     return leaderDataTlv.AppendTo(aMessage);
 }
 
+Error Mle::AppendLeaderData(TlvBuilder &aBuilder)
+{
+    LeaderDataTlv leaderDataTlv;
+
+    mLeaderData.SetDataVersion(Get<NetworkData::Leader>().GetVersion());
+    mLeaderData.SetStableDataVersion(Get<NetworkData::Leader>().GetStableVersion());
+
+    leaderDataTlv.Init();
+    leaderDataTlv.Set(mLeaderData);
+
+    return aBuilder.AppendBytes(&leaderDataTlv, static_cast<uint16_t>(leaderDataTlv.GetSize()));
+}
+
 Error Mle::ReadLeaderData(const Message &aMessage, LeaderData &aLeaderData)
 {
     Error         error;
@@ -1190,6 +1241,19 @@ exit:
     return error;
 }
 
+Error Mle::ReadLeaderData(const TlvIndex &aTlvIndex, LeaderData &aLeaderData)
+{
+    Error         error;
+    LeaderDataTlv leaderDataTlv;
+
+    SuccessOrExit(error = aTlvIndex.FindTlv(leaderDataTlv));
+    VerifyOrExit(leaderDataTlv.IsValid(), error = kErrorParse);
+    leaderDataTlv.Get(aLeaderData);
+
+exit:
+    return error;
+}
+
 Error Mle::AppendNetworkData(Message &aMessage, bool aStableOnly)
 {
     Error   error = kErrorNone;
@@ -1232,6 +1296,26 @@ exit:
     return error;
 }
 
+Error Mle::FindTlvRequest(const TlvIndex &aTlvIndex, RequestedTlvs &aRequestedTlvs)
+{
+    Error    error;
+    uint16_t offset;
+    uint16_t length;
+
+    SuccessOrExit(error = aTlvIndex.FindTlvValueOffset(Tlv::kTlvRequest, offset, length));
+
+    if (length > sizeof(aRequestedTlvs.mTlvs))
+    {
+        length = sizeof(aRequestedTlvs.mTlvs);
+    }
+
+    aTlvIndex.GetMessage().ReadBytes(offset, aRequestedTlvs.mTlvs, length);
+    aRequestedTlvs.mNumTlvs = static_cast<uint8_t>(length);
+
+exit:
+    return error;
+}
+
 Error Mle::AppendScanMask(Message &aMessage, uint8_t aScanMask)
 {
     return Tlv::Append<ScanMaskTlv>(aMessage, aScanMask);
@@ -1760,6 +1844,27 @@ void Mle::HandleAttachTimer(void)
         mReceivedResponseFromParent = false;
         Get<MeshForwarder>().SetRxOnWhenIdle(true);
 
+#if OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE
+        if (mFastAttachPending)
+        {
+            if (mParent.IsStateRestored() && (mParentRequestMode == kAttachAny))
+            {
+                // Try a directed Parent Request to the parent restored
+                // from settings first, using a shorter response wait
+                // time than the multicast rounds.
+
+                Ip6::Address destination;
+
+                destination.SetToLinkLocalAddress(mParent.GetExtAddress());
+                IgnoreError(SendParentRequest(kParentRequestTypeRouters, destination));
+                delay = kParentRequestFastTimeout;
+                break;
+            }
+
+            mFastAttachPending = false;
+        }
+#endif
+
         // initial MLE Parent Request has both E and R flags set in Scan Mask TLV
         // during reattach when losing connectivity.
         if (mParentRequestMode == kAttachSame1 || mParentRequestMode == kAttachSame2)
@@ -1778,6 +1883,19 @@ void Mle::HandleAttachTimer(void)
         break;
 
     case kAttachStateParentRequestRouter:
+#if OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE
+        if (mFastAttachPending)
+        {
+            // The directed Parent Request to the restored parent did not
+            // yield a usable response - fall back to the normal multicast
+            // Parent Request sequence.
+
+            mFastAttachPending = false;
+            IgnoreError(SendParentRequest(kParentRequestTypeRouters));
+            delay = kParentRequestRouterTimeout;
+            break;
+        }
+#endif
         SetAttachState(kAttachStateParentRequestReed);
         IgnoreError(SendParentRequest(kParentRequestTypeRoutersAndReeds));
         delay = kParentRequestReedTimeout;
@@ -2042,11 +2160,19 @@ void Mle::RemoveDelayedDataRequestMessage(const Ip6::Address &aDestination)
 
 Error Mle::SendParentRequest(ParentRequestType aType)
 {
-    Error        error = kErrorNone;
-    Message *    message;
-    uint8_t      scanMask = 0;
     Ip6::Address destination;
 
+    destination.SetToLinkLocalAllRoutersMulticast();
+
+    return SendParentRequest(aType, destination);
+}
+
+Error Mle::SendParentRequest(ParentRequestType aType, const Ip6::Address &aDestination)
+{
+    Error    error = kErrorNone;
+    Message *message;
+    uint8_t  scanMask = 0;
+
     mParentRequestChallenge.GenerateRandom();
 
     switch (aType)
@@ -2070,17 +2196,16 @@ Error Mle::SendParentRequest(ParentRequestType aType)
     SuccessOrExit(error = AppendTimeRequest(*message));
 #endif
 
-    destination.SetToLinkLocalAllRoutersMulticast();
-    SuccessOrExit(error = SendMessage(*message, destination));
+    SuccessOrExit(error = SendMessage(*message, aDestination));
 
     switch (aType)
     {
     case kParentRequestTypeRouters:
-        Log(kMessageSend, kTypeParentRequestToRouters, destination);
+        Log(kMessageSend, kTypeParentRequestToRouters, aDestination);
         break;
 
     case kParentRequestTypeRoutersAndReeds:
-        Log(kMessageSend, kTypeParentRequestToRoutersReeds, destination);
+        Log(kMessageSend, kTypeParentRequestToRoutersReeds, aDestination);
         break;
     }
 
@@ -2631,8 +2756,6 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
     uint8_t          nonce[Crypto::AesCcm::kNonceSize];
     uint8_t          tag[kMleSecurityTagSize];
     Crypto::AesCcm   aesCcm;
-    uint8_t          buf[64];
-    uint16_t         length;
     Ip6::MessageInfo messageInfo;
 
     IgnoreError(aMessage.Read(0, header));
@@ -2659,13 +2782,9 @@ Error Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
 
         aMessage.SetOffset(header.GetLength() - 1);
 
-        while (aMessage.GetOffset() < aMessage.GetLength())
-        {
-            length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
-            aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kEncrypt);
-            aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
-            aMessage.MoveOffset(length);
-        }
+        aesCcm.Payload(aMessage, aMessage.GetOffset(), aMessage.GetLength() - aMessage.GetOffset(),
+                       Crypto::AesCcm::kEncrypt);
+        aMessage.SetOffset(aMessage.GetLength());
 
         aesCcm.Finalize(tag);
         SuccessOrExit(error = aMessage.AppendBytes(tag, sizeof(tag)));
@@ -2719,7 +2838,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     Mac::ExtAddress    extAddr;
     Crypto::AesCcm     aesCcm;
     uint16_t           mleOffset;
-    uint8_t            buf[64];
     uint16_t           length;
     uint8_t            tag[kMleSecurityTagSize];
     uint8_t            command;
@@ -2792,15 +2910,22 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     mleOffset = aMessage.GetOffset();
 
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    aesCcm.Payload(aMessage, mleOffset, aMessage.GetLength() - mleOffset, Crypto::AesCcm::kDecrypt);
+    aMessage.SetOffset(aMessage.GetLength());
+#else
+    // In fuzzing builds, decrypt into a scratch buffer (leaving the
+    // message content unchanged) so the fuzzed payload is processed
+    // as is.
     while (aMessage.GetOffset() < aMessage.GetLength())
     {
+        uint8_t buf[64];
+
         length = aMessage.ReadBytes(aMessage.GetOffset(), buf, sizeof(buf));
         aesCcm.Payload(buf, buf, length, Crypto::AesCcm::kDecrypt);
-#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-        aMessage.WriteBytes(aMessage.GetOffset(), buf, length);
-#endif
         aMessage.MoveOffset(length);
     }
+#endif
 
     aesCcm.Finalize(tag);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
@@ -2852,7 +2977,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
         {
             VerifyOrExit(keySequence > neighbor->GetKeySequence(), error = kErrorDuplicated);
             neighbor->SetKeySequence(keySequence);
-            neighbor->GetLinkFrameCounters().Reset();
+            neighbor->ResetLinkFrameCounters();
             neighbor->SetLinkAckFrameCounter(0);
         }
 
@@ -3558,7 +3683,7 @@ void Mle::HandleParentResponse(const Message &aMessage, const Ip6::MessageInfo &
 
     mParentCandidate.SetExtAddress(extAddress);
     mParentCandidate.SetRloc16(sourceAddress);
-    mParentCandidate.GetLinkFrameCounters().SetAll(linkFrameCounter);
+    mParentCandidate.SetLinkFrameCounters(linkFrameCounter);
     mParentCandidate.SetLinkAckFrameCounter(linkFrameCounter);
     mParentCandidate.SetMleFrameCounter(mleFrameCounter);
     mParentCandidate.SetVersion(static_cast<uint8_t>(version));
@@ -3724,6 +3849,7 @@ void Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::MessageIn
     static const uint8_t kMaxResponseTlvs = 6;
 
     Error         error = kErrorNone;
+    TlvIndex      tlvIndex(aMessage);
     uint16_t      sourceAddress;
     Challenge     challenge;
     RequestedTlvs requestedTlvs;
@@ -3731,12 +3857,12 @@ void Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::MessageIn
     uint8_t       numTlvs                = 0;
 
     // Source Address
-    SuccessOrExit(error = Tlv::Find<SourceAddressTlv>(aMessage, sourceAddress));
+    SuccessOrExit(error = tlvIndex.Find<SourceAddressTlv>(sourceAddress));
 
     Log(kMessageReceive, kTypeChildUpdateRequestOfParent, aMessageInfo.GetPeerAddr(), sourceAddress);
 
     // Challenge
-    switch (ReadChallenge(aMessage, challenge))
+    switch (ReadChallenge(tlvIndex, challenge))
     {
     case kErrorNone:
         tlvs[numTlvs++] = Tlv::kResponse;
@@ -3754,7 +3880,7 @@ void Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::MessageIn
     {
         uint8_t status;
 
-        switch (Tlv::Find<StatusTlv>(aMessage, status))
+        switch (tlvIndex.Find<StatusTlv>(status))
         {
         case kErrorNone:
             VerifyOrExit(status != StatusTlv::kError, IgnoreError(BecomeDetached()));
@@ -3781,7 +3907,7 @@ void Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::MessageIn
     }
 
     // TLV Request
-    switch (FindTlvRequest(aMessage, requestedTlvs))
+    switch (FindTlvRequest(tlvIndex, requestedTlvs))
     {
     case kErrorNone:
         for (uint8_t i = 0; i < requestedTlvs.mNumTlvs; i++)
@@ -3861,7 +3987,7 @@ void Mle::HandleChildUpdateResponse(const Message &         aMessage,
     case kRoleDetached:
         SuccessOrExit(error = ReadFrameCounters(aMessage, linkFrameCounter, mleFrameCounter));
 
-        mParent.GetLinkFrameCounters().SetAll(linkFrameCounter);
+        mParent.SetLinkFrameCounters(linkFrameCounter);
         mParent.SetLinkAckFrameCounter(linkFrameCounter);
         mParent.SetMleFrameCounter(mleFrameCounter);
 
@@ -979,6 +979,17 @@ protected:
      */
     Error AppendSourceAddress(Message &aMessage) const;
 
+    /**
+     * This method appends a Source Address TLV to a TLV builder.
+     *
+     * @param[in]  aBuilder  A reference to the TLV builder.
+     *
+     * @retval kErrorNone    Successfully appended the Source Address TLV.
+     * @retval kErrorNoBufs  Insufficient room remaining in the builder's buffer.
+     *
+     */
+    Error AppendSourceAddress(TlvBuilder &aBuilder) const;
+
     /**
      * This method appends a Mode TLV to a message.
      *
@@ -1041,6 +1052,19 @@ protected:
      */
     Error ReadChallenge(const Message &aMessage, Challenge &aChallenge);
 
+    /**
+     * This method reads Challenge TLV from an indexed message.
+     *
+     * @param[in]  aTlvIndex         A reference to the TLV index of the message.
+     * @param[out] aChallenge        A reference to the Challenge data where to output the read value.
+     *
+     * @retval kErrorNone       Successfully read the Challenge TLV.
+     * @retval kErrorNotFound   Challenge TLV was not found in the message.
+     * @retval kErrorParse      Challenge TLV was found but could not be parsed.
+     *
+     */
+    Error ReadChallenge(const TlvIndex &aTlvIndex, Challenge &aChallenge);
+
     /**
      * This method appends a Response TLV to a message.
      *
@@ -1156,6 +1180,19 @@ protected:
      */
     Error FindTlvRequest(const Message &aMessage, RequestedTlvs &aRequestedTlvs);
 
+    /**
+     * This method reads TLV Request TLV from an indexed message.
+     *
+     * @param[in]  aTlvIndex        A reference to the TLV index of the message.
+     * @param[out] aRequestedTlvs   A reference to output the read list of requested TLVs.
+     *
+     * @retval kErrorNone       Successfully read the TLV.
+     * @retval kErrorNotFound   TLV was not found in the message.
+     * @retval kErrorParse      TLV was found but could not be parsed.
+     *
+     */
+    Error FindTlvRequest(const TlvIndex &aTlvIndex, RequestedTlvs &aRequestedTlvs);
+
     /**
      * This method appends a Leader Data TLV to a message.
      *
@@ -1167,6 +1204,17 @@ protected:
      */
     Error AppendLeaderData(Message &aMessage);
 
+    /**
+     * This method appends a Leader Data TLV to a TLV builder.
+     *
+     * @param[in]  aBuilder  A reference to the TLV builder.
+     *
+     * @retval kErrorNone     Successfully appended the Leader Data TLV.
+     * @retval kErrorNoBufs   Insufficient room remaining in the builder's buffer.
+     *
+     */
+    Error AppendLeaderData(TlvBuilder &aBuilder);
+
     /**
      * This method reads Leader Data TLV from a message.
      *
@@ -1180,6 +1228,19 @@ protected:
      */
     Error ReadLeaderData(const Message &aMessage, LeaderData &aLeaderData);
 
+    /**
+     * This method reads Leader Data TLV from an indexed message.
+     *
+     * @param[in]  aTlvIndex       A reference to the TLV index of the message.
+     * @param[out] aLeaderData     A reference to output the Leader Data.
+     *
+     * @retval kErrorNone       Successfully read the TLV.
+     * @retval kErrorNotFound   TLV was not found in the message.
+     * @retval kErrorParse      TLV was found but could not be parsed.
+     *
+     */
+    Error ReadLeaderData(const TlvIndex &aTlvIndex, LeaderData &aLeaderData);
+
     /**
      * This method appends a Scan Mask TLV to a message.
      *
@@ -1776,6 +1837,7 @@ private:
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void        ScheduleMessageTransmissionTimer(void);
     Error       ReadChallengeOrResponse(const Message &aMessage, uint8_t aTlvType, Challenge &aBuffer);
+    Error       ReadChallengeOrResponse(const TlvIndex &aTlvIndex, uint8_t aTlvType, Challenge &aBuffer);
 
     void HandleAdvertisement(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo, Neighbor *aNeighbor);
     void HandleChildIdResponse(const Message &         aMessage,
@@ -1807,6 +1869,7 @@ private:
 
     uint32_t GetAttachStartDelay(void) const;
     Error    SendParentRequest(ParentRequestType aType);
+    Error    SendParentRequest(ParentRequestType aType, const Ip6::Address &aDestination);
     Error    SendChildIdRequest(void);
     Error    GetNextAnnouceChannel(uint8_t &aChannel) const;
     bool     HasMoreChannelsToAnnouce(void) const;
@@ -1874,6 +1937,9 @@ private:
     AddressRegistrationMode mAddressRegistrationMode;
 
     bool       mHasRestored;
+#if OPENTHREAD_CONFIG_MLE_FAST_ATTACH_ENABLE
+    bool       mFastAttachPending;
+#endif
     uint8_t    mParentLinkMargin;
     bool       mParentIsSingleton;
     bool       mReceivedResponseFromParent;
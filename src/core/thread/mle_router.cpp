@@ -35,6 +35,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -58,6 +59,10 @@ namespace Mle {
 MleRouter::MleRouter(Instance &aInstance)
     : Mle(aInstance)
     , mAdvertiseTrickleTimer(aInstance, MleRouter::HandleAdvertiseTrickleTimer)
+#if OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+    , mStableAdvCount(0)
+    , mStableRouterIdSequence(0)
+#endif
     , mAddressSolicit(UriPath::kAddressSolicit, &MleRouter::HandleAddressSolicit, this)
     , mAddressRelease(UriPath::kAddressRelease, &MleRouter::HandleAddressRelease, this)
     , mChildTable(aInstance)
@@ -74,6 +79,9 @@ MleRouter::MleRouter(Instance &aInstance)
     , mRouterEligible(true)
     , mAddressSolicitPending(false)
     , mAddressSolicitRejected(false)
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+    , mLeaderHotStandbyEnabled(false)
+#endif
     , mPreviousPartitionIdRouter(0)
     , mPreviousPartitionId(0)
     , mPreviousPartitionRouterIdSequence(0)
@@ -81,6 +89,7 @@ MleRouter::MleRouter(Instance &aInstance)
     , mRouterSelectionJitter(kRouterSelectionJitter)
     , mRouterSelectionJitterTimeout(0)
     , mParentPriority(kParentPriorityUnspecified)
+    , mRouteUpdateCounters()
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     , mBackboneRouterRegistrationDelay(0)
 #endif
@@ -94,6 +103,10 @@ MleRouter::MleRouter(Instance &aInstance)
 
     SetRouterId(kInvalidRouterId);
 
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    ClearNextHopCache();
+#endif
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
     mSteeringData.Clear();
 #endif
@@ -208,12 +221,42 @@ Error MleRouter::BecomeLeader(void)
     Router * router;
     uint32_t partitionId;
     uint8_t  leaderId;
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+    bool            takeOver           = false;
+    uint8_t         numMirroredRouters = 0;
+    uint8_t         mirroredRouterIds[kMaxRouters];
+    Mac::ExtAddress mirroredRouterExtAddresses[kMaxRouters];
+#endif
 
     VerifyOrExit(!Get<MeshCoP::ActiveDataset>().IsPartiallyComplete(), error = kErrorInvalidState);
     VerifyOrExit(!IsDisabled(), error = kErrorInvalidState);
     VerifyOrExit(!IsLeader(), error = kErrorNone);
     VerifyOrExit(IsRouterEligible(), error = kErrorNotCapable);
 
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+    takeOver = mLeaderHotStandbyEnabled && !mRetrieveNewNetworkData;
+
+    if (takeOver)
+    {
+        // Snapshot the (router ID, extended address) pairs of the
+        // routers known from the previous partition, so that their
+        // router ID assignments can be re-seeded after the router
+        // table is cleared for the new partition.
+
+        for (Router &mirroredRouter : mRouterTable.Iterate())
+        {
+            if (!mirroredRouter.IsStateValid())
+            {
+                continue;
+            }
+
+            mirroredRouterIds[numMirroredRouters]          = RouterIdFromRloc16(mirroredRouter.GetRloc16());
+            mirroredRouterExtAddresses[numMirroredRouters] = mirroredRouter.GetExtAddress();
+            numMirroredRouters++;
+        }
+    }
+#endif
+
     mRouterTable.Clear();
 
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
@@ -233,7 +276,39 @@ Error MleRouter::BecomeLeader(void)
     SetRouterId(leaderId);
     router->SetExtAddress(Get<Mac::Mac>().GetExtAddress());
 
-    Get<NetworkData::Leader>().Reset();
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+    if (takeOver)
+    {
+        // Re-seed the mirrored router ID assignments, so returning
+        // routers keep their RLOC16s (and with them the Network Data
+        // entries they registered). IDs whose owner never returns are
+        // released through the normal router ID aging.
+
+        for (uint8_t i = 0; i < numMirroredRouters; i++)
+        {
+            Router *mirroredRouter;
+
+            if (mirroredRouterIds[i] == leaderId)
+            {
+                continue;
+            }
+
+            mirroredRouter = mRouterTable.Allocate(mirroredRouterIds[i]);
+
+            if (mirroredRouter != nullptr)
+            {
+                mirroredRouter->SetExtAddress(mirroredRouterExtAddresses[i]);
+            }
+        }
+
+        Get<NetworkData::Leader>().HandleLeaderTakeover();
+    }
+    else
+#endif
+    {
+        Get<NetworkData::Leader>().Reset();
+    }
+
     Get<MeshCoP::Leader>().SetEmptyCommissionerData();
 
     SetStateLeader(Rloc16FromRouterId(leaderId));
@@ -418,12 +493,46 @@ void MleRouter::HandleAdvertiseTrickleTimer(void)
 {
     VerifyOrExit(IsRouterEligible(), mAdvertiseTrickleTimer.Stop());
 
+#if OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+    UpdateAdvertiseTrickleIntervalMax();
+#endif
+
     SendAdvertisement();
 
 exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+void MleRouter::UpdateAdvertiseTrickleIntervalMax(void)
+{
+    // Extends the trickle `Imax` after `kAdaptiveAdvStableCount`
+    // advertisements without a route change (observed via the Router ID
+    // Sequence), shrinking control-plane airtime on long-stable
+    // topologies. A route change falls back to the default bound (a
+    // trickle reset through `ResetAdvertiseInterval()` also restores it).
+
+    uint8_t routerIdSequence = mRouterTable.GetRouterIdSequence();
+
+    if (routerIdSequence != mStableRouterIdSequence)
+    {
+        mStableRouterIdSequence = routerIdSequence;
+        mStableAdvCount         = 0;
+        mAdvertiseTrickleTimer.SetIntervalMax(Time::SecToMsec(kAdvertiseIntervalMax));
+    }
+    else if (mStableAdvCount < kAdaptiveAdvStableCount)
+    {
+        mStableAdvCount++;
+
+        if (mStableAdvCount == kAdaptiveAdvStableCount)
+        {
+            otLogInfoMle("Stable topology - extending advertisement trickle Imax");
+            mAdvertiseTrickleTimer.SetIntervalMax(Time::SecToMsec(kAdaptiveAdvIntervalMax));
+        }
+    }
+}
+#endif // OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+
 void MleRouter::StopAdvertiseTrickleTimer(void)
 {
     mAdvertiseTrickleTimer.Stop();
@@ -433,6 +542,11 @@ void MleRouter::ResetAdvertiseInterval(void)
 {
     VerifyOrExit(IsRouterOrLeader());
 
+#if OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+    mStableAdvCount = 0;
+    mAdvertiseTrickleTimer.SetIntervalMax(Time::SecToMsec(kAdvertiseIntervalMax));
+#endif
+
     if (!mAdvertiseTrickleTimer.IsRunning())
     {
         mAdvertiseTrickleTimer.Start(TrickleTimer::kModeTrickle, Time::SecToMsec(kAdvertiseIntervalMin),
@@ -450,6 +564,8 @@ void MleRouter::SendAdvertisement(void)
     Error        error = kErrorNone;
     Ip6::Address destination;
     Message *    message = nullptr;
+    uint8_t      tlvsBuffer[sizeof(Tlv) + sizeof(uint16_t) + sizeof(LeaderDataTlv) + sizeof(RouteTlv)];
+    TlvBuilder   tlvBuilder(tlvsBuffer, sizeof(tlvsBuffer));
 
     // Suppress MLE Advertisements when trying to attach to a better partition.
     //
@@ -466,8 +582,12 @@ void MleRouter::SendAdvertisement(void)
 
     VerifyOrExit((message = NewMleMessage()) != nullptr, error = kErrorNoBufs);
     SuccessOrExit(error = AppendHeader(*message, kCommandAdvertisement));
-    SuccessOrExit(error = AppendSourceAddress(*message));
-    SuccessOrExit(error = AppendLeaderData(*message));
+
+    // The TLVs are first assembled in the contiguous scratch buffer and
+    // committed to the message in a single append, so the message buffer
+    // chain is grown once and never holds a partially built TLV set.
+    SuccessOrExit(error = AppendSourceAddress(tlvBuilder));
+    SuccessOrExit(error = AppendLeaderData(tlvBuilder));
 
     switch (mRole)
     {
@@ -481,10 +601,12 @@ void MleRouter::SendAdvertisement(void)
 
     case kRoleRouter:
     case kRoleLeader:
-        SuccessOrExit(error = AppendRoute(*message));
+        SuccessOrExit(error = AppendRoute(tlvBuilder));
         break;
     }
 
+    SuccessOrExit(error = tlvBuilder.AppendTo(*message));
+
     destination.SetToLinkLocalAllNodesMulticast();
     SuccessOrExit(error = SendMessage(*message, destination));
 
@@ -965,7 +1087,7 @@ Error MleRouter::HandleLinkAccept(const Message &         aMessage,
     aMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddr);
     router->SetExtAddress(extAddr);
     router->SetRloc16(sourceAddress);
-    router->GetLinkFrameCounters().SetAll(linkFrameCounter);
+    router->SetLinkFrameCounters(linkFrameCounter);
     router->SetLinkAckFrameCounter(linkFrameCounter);
     router->SetMleFrameCounter(mleFrameCounter);
     router->SetLastHeard(TimerMilli::GetNow());
@@ -979,6 +1101,7 @@ Error MleRouter::HandleLinkAccept(const Message &         aMessage,
     router->SetState(Neighbor::kStateValid);
     router->SetKeySequence(aKeySequence);
 
+    mRouterTable.SignalRouteChanged();
     mNeighborTable.Signal(NeighborTable::kRouterAdded, *router);
 
     if (aRequest)
@@ -1332,6 +1455,8 @@ Error MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Message
                             leader->SetCost(0);
                         }
 
+                        mRouterTable.SignalRouteChanged();
+
                         break;
                     }
                 }
@@ -1421,13 +1546,34 @@ exit:
 
 void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
 {
-    Router *neighbor;
-    bool    resetAdvInterval = false;
-    bool    changed          = false;
+    Router * neighbor;
+    bool     resetAdvInterval = false;
+    bool     changed          = false;
+    uint16_t digest;
 
     neighbor = mRouterTable.GetRouter(aRouterId);
     VerifyOrExit(neighbor != nullptr);
 
+    // Skip the route evaluation when neither the advertised Route TLV,
+    // nor the link cost to the advertising neighbor, nor any other
+    // route state (tracked by the route generation number) has changed
+    // since the previous advertisement from the same neighbor was
+    // processed. The digest covers everything `UpdateLinkQualityOut()`
+    // derives its updates from (the TLV bytes and the link cost), so on
+    // a match the advertisement costs no more than the digest itself.
+    // In a stable mesh most periodic advertisements take this path.
+
+    digest = CalculateRouteTlvDigest(aRoute, *neighbor);
+
+    if ((neighbor->GetLastRouteGeneration() == mRouterTable.GetRouteGeneration()) &&
+        (neighbor->GetLastRouteTlvDigest() == digest))
+    {
+        mRouteUpdateCounters.mSkippedUpdates++;
+        ExitNow();
+    }
+
+    mRouteUpdateCounters.mFullUpdates++;
+
     // update link quality out to neighbor
     changed = UpdateLinkQualityOut(aRoute, *neighbor, resetAdvInterval);
 
@@ -1514,6 +1660,14 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
         routeCount++;
     }
 
+    if (changed)
+    {
+        mRouterTable.SignalRouteChanged();
+    }
+
+    neighbor->SetLastRouteTlvDigest(digest);
+    neighbor->SetLastRouteGeneration(mRouterTable.GetRouteGeneration());
+
     if (resetAdvInterval)
     {
         ResetAdvertiseInterval();
@@ -1541,6 +1695,17 @@ exit:
     return;
 }
 
+uint16_t MleRouter::CalculateRouteTlvDigest(const RouteTlv &aRoute, Router &aNeighbor)
+{
+    Crc16   crc(Crc16::kCcitt);
+    uint8_t linkCost = mRouterTable.GetLinkCost(aNeighbor);
+
+    crc.Update(aRoute.GetValue(), aRoute.GetLength());
+    crc.Update(&linkCost, sizeof(linkCost));
+
+    return crc.Get();
+}
+
 bool MleRouter::UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor, bool &aResetAdvInterval)
 {
     bool    changed = false;
@@ -1687,6 +1852,12 @@ void MleRouter::HandleTimeTick(void)
 
     VerifyOrExit(IsFullThreadDevice(), Get<TimeTicker>().UnregisterReceiver(TimeTicker::kMleRouter));
 
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    // Refresh the cache once per second so that link quality changes
+    // which do not alter route state are picked up with bounded delay.
+    ClearNextHopCache();
+#endif
+
     if (mChallengeTimeout > 0)
     {
         mChallengeTimeout--;
@@ -1852,6 +2023,15 @@ void MleRouter::HandleTimeTick(void)
 
         if (router.IsStateValid())
         {
+#if OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE
+            if (router.UpdateLowLinkMarginTicks(router.GetLinkInfo().GetLinkMargin()))
+            {
+                otLogInfoMle("Router link margin collapsed");
+                RemoveNeighbor(router);
+                continue;
+            }
+#endif
+
 #if OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT == 0
 
             if (age >= Time::SecToMsec(kMaxNeighborAge))
@@ -2289,7 +2469,7 @@ void MleRouter::HandleChildIdRequest(const Message &         aMessage,
     }
 
     child->SetLastHeard(TimerMilli::GetNow());
-    child->GetLinkFrameCounters().SetAll(linkFrameCounter);
+    child->SetLinkFrameCounters(linkFrameCounter);
     child->SetLinkAckFrameCounter(linkFrameCounter);
     child->SetMleFrameCounter(mleFrameCounter);
     child->SetKeySequence(aKeySequence);
@@ -2354,6 +2534,7 @@ void MleRouter::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Mes
     static const uint8_t kMaxResponseTlvs = 10;
 
     Error           error = kErrorNone;
+    TlvIndex        tlvIndex(aMessage);
     Mac::ExtAddress extAddr;
     uint8_t         modeBitmask;
     DeviceMode      mode;
@@ -2371,11 +2552,11 @@ void MleRouter::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Mes
     Log(kMessageReceive, kTypeChildUpdateRequestOfChild, aMessageInfo.GetPeerAddr());
 
     // Mode
-    SuccessOrExit(error = Tlv::Find<ModeTlv>(aMessage, modeBitmask));
+    SuccessOrExit(error = tlvIndex.Find<ModeTlv>(modeBitmask));
     mode.Set(modeBitmask);
 
     // Challenge
-    switch (ReadChallenge(aMessage, challenge))
+    switch (ReadChallenge(tlvIndex, challenge))
     {
     case kErrorNone:
         tlvs[tlvslength++] = Tlv::kResponse;
@@ -2428,14 +2609,14 @@ void MleRouter::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Mes
     }
 
     // IPv6 Address TLV
-    if (Tlv::FindTlvOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset) == kErrorNone)
+    if (tlvIndex.FindTlvOffset(Tlv::kAddressRegistration, addressRegistrationOffset) == kErrorNone)
     {
         SuccessOrExit(error = UpdateChildAddresses(aMessage, addressRegistrationOffset, *child));
         tlvs[tlvslength++] = Tlv::kAddressRegistration;
     }
 
     // Leader Data
-    switch (ReadLeaderData(aMessage, leaderData))
+    switch (ReadLeaderData(tlvIndex, leaderData))
     {
     case kErrorNone:
     case kErrorNotFound:
@@ -2445,7 +2626,7 @@ void MleRouter::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Mes
     }
 
     // Timeout
-    switch (Tlv::Find<TimeoutTlv>(aMessage, timeout))
+    switch (tlvIndex.Find<TimeoutTlv>(timeout))
     {
     case kErrorNone:
         if (child->GetTimeout() != timeout)
@@ -2465,7 +2646,7 @@ void MleRouter::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Mes
     }
 
     // TLV Request
-    switch (FindTlvRequest(aMessage, requestedTlvs))
+    switch (FindTlvRequest(tlvIndex, requestedTlvs))
     {
     case kErrorNone:
         VerifyOrExit(requestedTlvs.mNumTlvs <= (kMaxResponseTlvs - tlvslength), error = kErrorParse);
@@ -2490,12 +2671,12 @@ void MleRouter::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Mes
         CslChannelTlv cslChannel;
         uint32_t      cslTimeout;
 
-        if (Tlv::Find<CslTimeoutTlv>(aMessage, cslTimeout) == kErrorNone)
+        if (tlvIndex.Find<CslTimeoutTlv>(cslTimeout) == kErrorNone)
         {
             child->SetCslTimeout(cslTimeout);
         }
 
-        if (Tlv::FindTlv(aMessage, cslChannel) == kErrorNone)
+        if (tlvIndex.FindTlv(cslChannel) == kErrorNone)
         {
             child->SetCslChannel(static_cast<uint8_t>(cslChannel.GetChannel()));
         }
@@ -2629,7 +2810,7 @@ void MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     switch (Tlv::Find<LinkFrameCounterTlv>(aMessage, linkFrameCounter))
     {
     case kErrorNone:
-        child->GetLinkFrameCounters().SetAll(linkFrameCounter);
+        child->SetLinkFrameCounters(linkFrameCounter);
         child->SetLinkAckFrameCounter(linkFrameCounter);
         break;
     case kErrorNotFound:
@@ -3429,6 +3610,20 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
         ExitNow(rval = aDestination);
     }
 
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    if (mNextHopCacheGeneration == mRouterTable.GetRouteGeneration())
+    {
+        if (mNextHopCache[destinationId] != kNextHopCacheEmpty)
+        {
+            ExitNow(rval = mNextHopCache[destinationId]);
+        }
+    }
+    else
+    {
+        ClearNextHopCache();
+    }
+#endif
+
     router = mRouterTable.GetRouter(destinationId);
     VerifyOrExit(router != nullptr);
 
@@ -3447,10 +3642,33 @@ uint16_t MleRouter::GetNextHop(uint16_t aDestination)
         rval = Rloc16FromRouterId(destinationId);
     }
 
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    // Only successful lookups are cached. Negative results can become
+    // valid without a route state change (e.g. when a neighbor link is
+    // established) and are cheap to recompute.
+
+    if (rval != Mac::kShortAddrInvalid)
+    {
+        mNextHopCache[destinationId] = rval;
+    }
+#endif
+
 exit:
     return rval;
 }
 
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+void MleRouter::ClearNextHopCache(void)
+{
+    for (uint16_t &entry : mNextHopCache)
+    {
+        entry = kNextHopCacheEmpty;
+    }
+
+    mNextHopCacheGeneration = mRouterTable.GetRouteGeneration();
+}
+#endif
+
 uint8_t MleRouter::GetCost(uint16_t aRloc16)
 {
     uint8_t routerId = RouterIdFromRloc16(aRloc16);
@@ -3518,6 +3736,7 @@ void MleRouter::ResolveRoutingLoops(uint16_t aSourceMac, uint16_t aDestRloc16)
 
     // invalidate next hop
     router->SetNextHop(kInvalidRouterId);
+    mRouterTable.SignalRouteChanged();
     ResetAdvertiseInterval();
 
 exit:
@@ -4198,6 +4417,16 @@ Error MleRouter::AppendRoute(Message &aMessage, Neighbor *aNeighbor)
     return tlv.AppendTo(aMessage);
 }
 
+Error MleRouter::AppendRoute(TlvBuilder &aBuilder, Neighbor *aNeighbor)
+{
+    RouteTlv tlv;
+
+    tlv.Init();
+    FillRouteTlv(tlv, aNeighbor);
+
+    return aBuilder.AppendBytes(&tlv, static_cast<uint16_t>(tlv.GetSize()));
+}
+
 Error MleRouter::AppendActiveDataset(Message &aMessage)
 {
     return Get<MeshCoP::ActiveDataset>().AppendMleDatasetTlv(aMessage);
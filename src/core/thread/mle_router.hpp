@@ -110,6 +110,29 @@ public:
      */
     Error SetRouterEligible(bool aEligible);
 
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+    /**
+     * This method indicates whether the device is designated as a leader hot standby.
+     *
+     * @retval TRUE   The device is designated as a leader hot standby.
+     * @retval FALSE  The device is not designated as a leader hot standby.
+     *
+     */
+    bool IsLeaderHotStandbyEnabled(void) const { return mLeaderHotStandbyEnabled; }
+
+    /**
+     * This method sets whether the device is designated as a leader hot standby.
+     *
+     * A hot-standby router, when it starts a new partition after losing the leader, seeds its leader state from the
+     * leader Network Data and router ID assignments it already mirrors as a router, instead of starting from an
+     * empty partition.
+     *
+     * @param[in]  aEnabled  TRUE to designate the device as a leader hot standby, FALSE otherwise.
+     *
+     */
+    void SetLeaderHotStandbyEnabled(bool aEnabled) { mLeaderHotStandbyEnabled = aEnabled; }
+#endif
+
     /**
      * This method indicates whether a node is the only router on the network.
      *
@@ -539,6 +562,17 @@ public:
      */
     uint8_t GetMaxChildIpAddresses(void) const;
 
+    /**
+     * This method gets the route update counters.
+     *
+     * The counters track how many received advertisements triggered a full route re-evaluation and how many were
+     * skipped because the advertised Route TLV and the route state were unchanged.
+     *
+     * @returns A reference to the route update counters.
+     *
+     */
+    const otRouteUpdateCounters &GetRouteUpdateCounters(void) const { return mRouteUpdateCounters; }
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     /**
      * This method sets/restores the maximum number of IP addresses that each MTD child may register with this
@@ -562,6 +596,7 @@ private:
     Error AppendConnectivity(Message &aMessage);
     Error AppendChildAddresses(Message &aMessage, Child &aChild);
     Error AppendRoute(Message &aMessage, Neighbor *aNeighbor = nullptr);
+    Error AppendRoute(TlvBuilder &aBuilder, Neighbor *aNeighbor = nullptr);
     Error AppendActiveDataset(Message &aMessage);
     Error AppendPendingDataset(Message &aMessage);
     void  HandleDetachStart(void);
@@ -628,6 +663,13 @@ private:
     Error UpdateChildAddresses(const Message &aMessage, uint16_t aOffset, Child &aChild);
     void  UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId);
     bool  UpdateLinkQualityOut(const RouteTlv &aRoute, Router &aNeighbor, bool &aResetAdvInterval);
+    uint16_t CalculateRouteTlvDigest(const RouteTlv &aRoute, Router &aNeighbor);
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    // The broadcast address is never a valid next hop, so it marks an empty cache entry.
+    static constexpr uint16_t kNextHopCacheEmpty = Mac::kShortAddrBroadcast;
+
+    void ClearNextHopCache(void);
+#endif
 
     static void HandleAddressSolicitResponse(void *               aContext,
                                              otMessage *          aMessage,
@@ -654,8 +696,20 @@ private:
     void        HandleAdvertiseTrickleTimer(void);
     void        HandleTimeTick(void);
 
+#if OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+    static constexpr uint16_t kAdaptiveAdvStableCount = OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_STABLE_COUNT;
+    static constexpr uint32_t kAdaptiveAdvIntervalMax = OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_INTERVAL_MAX;
+
+    void UpdateAdvertiseTrickleIntervalMax(void);
+#endif
+
     TrickleTimer mAdvertiseTrickleTimer;
 
+#if OPENTHREAD_CONFIG_MLE_ADAPTIVE_ADVERTISEMENT_ENABLE
+    uint16_t mStableAdvCount;
+    uint8_t  mStableRouterIdSequence;
+#endif
+
     Coap::Resource mAddressSolicit;
     Coap::Resource mAddressRelease;
 
@@ -676,6 +730,9 @@ private:
     bool mRouterEligible : 1;
     bool mAddressSolicitPending : 1;
     bool mAddressSolicitRejected : 1;
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+    bool mLeaderHotStandbyEnabled : 1;
+#endif
 
     uint8_t mRouterId;
     uint8_t mPreviousRouterId;
@@ -689,6 +746,16 @@ private:
     uint8_t mRouterSelectionJitterTimeout; ///< The Timeout prior to request/release Router ID.
 
     int8_t mParentPriority; ///< The assigned parent priority value, -2 means not assigned.
+
+    otRouteUpdateCounters mRouteUpdateCounters;
+
+#if OPENTHREAD_CONFIG_MLE_NEXT_HOP_CACHE_ENABLE
+    // Cached next hop RLOC16 indexed by destination router ID. Sized to cover `kInvalidRouterId` as well since
+    // `RouterIdFromRloc16()` can yield it for a malformed destination RLOC16.
+    uint16_t mNextHopCache[kInvalidRouterId + 1];
+    uint16_t mNextHopCacheGeneration; ///< The route generation number the cache entries were computed at.
+#endif
+
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     uint8_t mBackboneRouterRegistrationDelay; ///< Delay before registering Backbone Router service.
 #endif
@@ -82,6 +82,7 @@ constexpr uint16_t kUdpPort       = 19788;                            ///< MLE U
  *
  */
 constexpr uint32_t kParentRequestRouterTimeout     = 750;  ///< Router Parent Request timeout (in msec)
+constexpr uint32_t kParentRequestFastTimeout       = 250;  ///< Directed (fast attach) Parent Request timeout (in msec)
 constexpr uint32_t kParentRequestDuplicateMargin   = 50;   ///< Margin for duplicate parent request
 constexpr uint32_t kParentRequestReedTimeout       = 1250; ///< Router and REEDs Parent Request timeout (in msec)
 constexpr uint32_t kAttachStartJitter              = 50;   ///< Max jitter time added to start of attach (in msec)
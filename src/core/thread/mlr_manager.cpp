@@ -51,6 +51,11 @@ MlrManager::MlrManager(Instance &aInstance)
 #if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE) && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
     , mRegisterMulticastListenersCallback(nullptr)
     , mRegisterMulticastListenersContext(nullptr)
+#endif
+#if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE) && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    , mChildAddressTableLength(0)
+    , mChildAddressTableValid(false)
+    , mChildAddressTableOverflowed(false)
 #endif
     , mReregistrationDelay(0)
     , mSendDelay(0)
@@ -92,6 +97,10 @@ void MlrManager::HandleBackboneRouterPrimaryUpdate(BackboneRouter::Leader::State
 void MlrManager::UpdateLocalSubscriptions(void)
 {
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    UpdateChildAddressTable();
+#endif
+
     // Check multicast addresses are newly listened against Children
     for (Ip6::Netif::ExternalMulticastAddress &addr :
          Get<ThreadNetif>().IterateExternalMulticastAddresses(Ip6::Address::kTypeMulticastLargerThanRealmLocal))
@@ -135,6 +144,24 @@ bool MlrManager::IsAddressMlrRegisteredByAnyChildExcept(const Ip6::Address &aAdd
 
     OT_ASSERT(aAddress.IsMulticastLargerThanRealmLocal());
 
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    if (mChildAddressTableValid && !mChildAddressTableOverflowed)
+    {
+        for (uint16_t i = 0; i < mChildAddressTableLength; i++)
+        {
+            const ChildAddressEntry &entry = mChildAddressTable[i];
+
+            if (entry.mAddress == aAddress)
+            {
+                ret = (entry.mCount > 1) || (entry.mSoleChild != aExceptChild);
+                break;
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
     {
         if (&child != aExceptChild && child.HasMlrRegisteredAddress(aAddress))
@@ -153,6 +180,13 @@ void MlrManager::UpdateProxiedSubscriptions(Child &             aChild,
 {
     VerifyOrExit(aChild.IsStateValid());
 
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    // Build the table once for this update. The loop below changes only
+    // `aChild`'s MLR states, and the queries it issues all exclude
+    // `aChild`, so the snapshot remains valid throughout the loop.
+    UpdateChildAddressTable();
+#endif
+
     // Search the new multicast addresses and set its flag accordingly
     for (const Ip6::Address &address : aChild.IterateIp6Addresses(Ip6::Address::kTypeMulticastLargerThanRealmLocal))
     {
@@ -179,6 +213,9 @@ void MlrManager::UpdateProxiedSubscriptions(Child &             aChild,
     }
 
 exit:
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    InvalidateChildAddressTable();
+#endif
     LogMulticastAddresses();
     CheckInvariants();
 
@@ -188,6 +225,56 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+
+void MlrManager::UpdateChildAddressTable(void)
+{
+    mChildAddressTableLength     = 0;
+    mChildAddressTableOverflowed = false;
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        for (const Ip6::Address &address : child.IterateIp6Addresses(Ip6::Address::kTypeMulticastLargerThanRealmLocal))
+        {
+            ChildAddressEntry *entry = nullptr;
+
+            if (child.GetAddressMlrState(address) != kMlrStateRegistered)
+            {
+                continue;
+            }
+
+            for (uint16_t i = 0; i < mChildAddressTableLength; i++)
+            {
+                if (mChildAddressTable[i].mAddress == address)
+                {
+                    entry = &mChildAddressTable[i];
+                    break;
+                }
+            }
+
+            if (entry == nullptr)
+            {
+                if (mChildAddressTableLength >= kChildAddressTableSize)
+                {
+                    mChildAddressTableOverflowed = true;
+                    continue;
+                }
+
+                entry           = &mChildAddressTable[mChildAddressTableLength++];
+                entry->mAddress = address;
+                entry->mCount   = 0;
+            }
+
+            entry->mCount++;
+            entry->mSoleChild = &child;
+        }
+    }
+
+    mChildAddressTableValid = true;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+
 #endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
 
 void MlrManager::ScheduleSend(uint16_t aDelay)
@@ -561,6 +648,10 @@ void MlrManager::SetMulticastAddressMlrState(MlrState aFromState, MlrState aToSt
             }
         }
     }
+
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    InvalidateChildAddressTable();
+#endif
 #endif
 }
 
@@ -597,6 +688,10 @@ void MlrManager::FinishMulticastListenerRegistration(bool                aSucces
             }
         }
     }
+
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    InvalidateChildAddressTable();
+#endif
 #endif
 
     LogMulticastAddresses();
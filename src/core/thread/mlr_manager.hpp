@@ -185,6 +185,23 @@ private:
         return IsAddressMlrRegisteredByAnyChildExcept(aAddress, nullptr);
     }
     bool IsAddressMlrRegisteredByAnyChildExcept(const Ip6::Address &aAddress, const Child *aExceptChild) const;
+
+#if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    static constexpr uint16_t kChildAddressTableSize = OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_SIZE;
+
+    // An entry counts the child-address pairs in `kMlrStateRegistered`
+    // state for a unique multicast address. `mSoleChild` identifies the
+    // contributing child and is meaningful only when `mCount` is 1.
+    struct ChildAddressEntry
+    {
+        Ip6::Address mAddress;
+        uint16_t     mCount;
+        const Child *mSoleChild;
+    };
+
+    void UpdateChildAddressTable(void);
+    void InvalidateChildAddressTable(void) { mChildAddressTableValid = false; }
+#endif
 #endif
 
     void SetMulticastAddressMlrState(MlrState aFromState, MlrState aToState);
@@ -218,6 +235,13 @@ private:
     void *                                  mRegisterMulticastListenersContext;
 #endif
 
+#if (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE) && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ADDRESS_TABLE_ENABLE
+    ChildAddressEntry mChildAddressTable[kChildAddressTableSize];
+    uint16_t          mChildAddressTableLength;
+    bool              mChildAddressTableValid;
+    bool              mChildAddressTableOverflowed;
+#endif
+
     uint32_t mReregistrationDelay;
     uint16_t mSendDelay;
 
@@ -66,6 +66,44 @@ exit:
     return error;
 }
 
+Error NetworkData::GetNextEntry(Iterator &aIterator, otNetworkDataEntry &aEntry) const
+{
+    return GetNextEntry(aIterator, Mac::kShortAddrBroadcast, aEntry);
+}
+
+Error NetworkData::GetNextEntry(Iterator &aIterator, uint16_t aRloc16, otNetworkDataEntry &aEntry) const
+{
+    // The union members in `aEntry.mData` share storage. This is safe
+    // since `Iterate()` fills in only the one config matching the found
+    // entry (indicated by the remaining non-nullptr pointer in `config`
+    // on successful return).
+
+    Error  error;
+    Config config;
+
+    config.mOnMeshPrefix  = static_cast<OnMeshPrefixConfig *>(&aEntry.mData.mOnMeshPrefix);
+    config.mExternalRoute = static_cast<ExternalRouteConfig *>(&aEntry.mData.mExternalRoute);
+    config.mService       = static_cast<ServiceConfig *>(&aEntry.mData.mService);
+
+    SuccessOrExit(error = Iterate(aIterator, aRloc16, config));
+
+    if (config.mOnMeshPrefix != nullptr)
+    {
+        aEntry.mType = OT_NETWORK_DATA_ENTRY_ON_MESH_PREFIX;
+    }
+    else if (config.mExternalRoute != nullptr)
+    {
+        aEntry.mType = OT_NETWORK_DATA_ENTRY_EXTERNAL_ROUTE;
+    }
+    else
+    {
+        aEntry.mType = OT_NETWORK_DATA_ENTRY_SERVICE;
+    }
+
+exit:
+    return error;
+}
+
 Error NetworkData::GetNextOnMeshPrefix(Iterator &aIterator, OnMeshPrefixConfig &aConfig) const
 {
     return GetNextOnMeshPrefix(aIterator, Mac::kShortAddrBroadcast, aConfig);
@@ -144,6 +144,34 @@ public:
      */
     Error GetNetworkData(bool aStable, uint8_t *aData, uint8_t &aDataLength) const;
 
+    /**
+     * This method provides the next entry (of any type) in the Thread Network Data.
+     *
+     * The entries are decoded one at a time directly from the Network Data TLVs in the order they appear,
+     * without requiring an intermediate full copy of the Network Data.
+     *
+     * @param[inout]  aIterator  A reference to the Network Data iterator.
+     * @param[out]    aEntry     A reference to where the entry information will be placed.
+     *
+     * @retval kErrorNone       Successfully found the next entry.
+     * @retval kErrorNotFound   No subsequent entry exists in the Thread Network Data.
+     *
+     */
+    Error GetNextEntry(Iterator &aIterator, otNetworkDataEntry &aEntry) const;
+
+    /**
+     * This method provides the next entry (of any type) in the Thread Network Data for a given RLOC16.
+     *
+     * @param[inout]  aIterator  A reference to the Network Data iterator.
+     * @param[in]     aRloc16    The RLOC16 value.
+     * @param[out]    aEntry     A reference to where the entry information will be placed.
+     *
+     * @retval kErrorNone       Successfully found the next entry.
+     * @retval kErrorNotFound   No subsequent entry exists in the Thread Network Data.
+     *
+     */
+    Error GetNextEntry(Iterator &aIterator, uint16_t aRloc16, otNetworkDataEntry &aEntry) const;
+
     /**
      * This method provides the next On Mesh prefix in the Thread Network Data.
      *
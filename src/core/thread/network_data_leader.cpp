@@ -58,6 +58,9 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     mLength        = 0;
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+    UpdateContextIndex();
+#endif
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -105,8 +108,10 @@ const PrefixTlv *LeaderBase::FindNextMatchingPrefix(const Ip6::Address &aAddress
 
 Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
 {
+#if !OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
     const PrefixTlv * prefix = nullptr;
     const ContextTlv *contextTlv;
+#endif
 
     aContext.mPrefix.SetLength(0);
 
@@ -117,6 +122,32 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         aContext.mCompressFlag = true;
     }
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+
+    for (uint8_t index = 0; index < mContextIndexLength; index++)
+    {
+        const ContextIndexEntry &entry = mContextIndex[index];
+
+        if (!aAddress.MatchesPrefix(entry.mPrefix))
+        {
+            continue;
+        }
+
+        // Index entries are sorted by decreasing prefix length, so
+        // the first matching entry is the longest prefix match.
+
+        if (entry.mPrefix.GetLength() > aContext.mPrefix.GetLength())
+        {
+            aContext.mPrefix       = entry.mPrefix;
+            aContext.mContextId    = entry.mContextId;
+            aContext.mCompressFlag = entry.mCompress;
+        }
+
+        break;
+    }
+
+#else // OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+
     while ((prefix = FindNextMatchingPrefix(aAddress, prefix)) != nullptr)
     {
         contextTlv = prefix->FindSubTlv<ContextTlv>();
@@ -134,14 +165,18 @@ Error LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aCon
         }
     }
 
+#endif // OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+
     return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
 }
 
 Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
 {
-    Error            error = kErrorNotFound;
+    Error error = kErrorNotFound;
+#if !OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
     TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
     const PrefixTlv *prefix;
+#endif
 
     if (aContextId == Mle::kMeshLocalPrefixContextId)
     {
@@ -151,6 +186,25 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
         ExitNow(error = kErrorNone);
     }
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+
+    for (uint8_t index = 0; index < mContextIndexLength; index++)
+    {
+        const ContextIndexEntry &entry = mContextIndex[index];
+
+        if (entry.mContextId != aContextId)
+        {
+            continue;
+        }
+
+        aContext.mPrefix       = entry.mPrefix;
+        aContext.mContextId    = entry.mContextId;
+        aContext.mCompressFlag = entry.mCompress;
+        ExitNow(error = kErrorNone);
+    }
+
+#else // OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+
     while ((prefix = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
     {
         const ContextTlv *contextTlv = prefix->FindSubTlv<ContextTlv>();
@@ -166,10 +220,57 @@ Error LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext) cons
         ExitNow(error = kErrorNone);
     }
 
+#endif // OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+void LeaderBase::UpdateContextIndex(void)
+{
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+    const PrefixTlv *prefix;
+
+    mContextIndexLength = 0;
+
+    while ((prefix = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        const ContextTlv *contextTlv = prefix->FindSubTlv<ContextTlv>();
+        uint8_t           index;
+
+        if (contextTlv == nullptr)
+        {
+            continue;
+        }
+
+        VerifyOrExit(mContextIndexLength < kMaxContextIndexEntries);
+
+        // Insert while keeping the entries sorted by decreasing
+        // prefix length, so that during lookup the first entry
+        // matching an address is the longest prefix match.
+
+        for (index = mContextIndexLength; index > 0; index--)
+        {
+            if (mContextIndex[index - 1].mPrefix.GetLength() >= prefix->GetPrefixLength())
+            {
+                break;
+            }
+
+            mContextIndex[index] = mContextIndex[index - 1];
+        }
+
+        mContextIndex[index].mPrefix.Set(prefix->GetPrefix(), prefix->GetPrefixLength());
+        mContextIndex[index].mContextId = contextTlv->GetContextId();
+        mContextIndex[index].mCompress  = contextTlv->IsCompress();
+        mContextIndexLength++;
+    }
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress) const
 {
     const PrefixTlv *prefix = nullptr;
@@ -378,6 +479,10 @@ Error LeaderBase::SetNetworkData(uint8_t        aVersion,
 
     otDumpDebgNetData("set network data", mTlvs, mLength);
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+    UpdateContextIndex();
+#endif
+
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 
 exit:
@@ -276,12 +276,29 @@ public:
                        uint8_t &      aServiceId) const;
 
 protected:
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+    void UpdateContextIndex(void);
+#endif
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
     using FilterIndexes = MeshCoP::SteeringData::HashBitIndexes;
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+    // One entry per possible 6LoWPAN Context ID (IDs are 4-bit, with
+    // zero reserved for the mesh-local prefix).
+    static constexpr uint8_t kMaxContextIndexEntries = 16;
+
+    struct ContextIndexEntry
+    {
+        Ip6::Prefix mPrefix;
+        uint8_t     mContextId;
+        bool        mCompress;
+    };
+#endif
+
     const PrefixTlv *FindNextMatchingPrefix(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
 
     void RemoveCommissioningData(void);
@@ -292,6 +309,11 @@ private:
                               uint16_t *          aRloc16) const;
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t *aRloc16) const;
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+    ContextIndexEntry mContextIndex[kMaxContextIndexEntries];
+    uint8_t           mContextIndexLength;
+#endif
 };
 
 /**
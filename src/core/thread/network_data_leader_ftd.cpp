@@ -72,8 +72,47 @@ void Leader::Reset(void)
     memset(reinterpret_cast<void *>(mContextLastUsed), 0, sizeof(mContextLastUsed));
     mContextUsed         = 0;
     mContextIdReuseDelay = kContextIdReuseDelay;
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    RlocIndexClear();
+#endif
 }
 
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+void Leader::HandleLeaderTakeover(void)
+{
+    memset(reinterpret_cast<void *>(mContextLastUsed), 0, sizeof(mContextLastUsed));
+    mContextUsed         = 0;
+    mContextIdReuseDelay = kContextIdReuseDelay;
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    // The preserved entries are unknown to the index, so mark it
+    // saturated to have lookups fall back to scanning until `Reset()`.
+    RlocIndexClear();
+    mRlocIndexSaturated = true;
+#endif
+
+    UpdateContextsAfterReset();
+    IncrementVersions(/* aIncludeStable */ true);
+}
+#endif
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+Error Leader::SetNetworkData(uint8_t        aVersion,
+                             uint8_t        aStableVersion,
+                             bool           aStableOnly,
+                             const Message &aMessage,
+                             uint16_t       aMessageOffset)
+{
+    // The received data replaces the Network Data wholesale, so the
+    // entries are unknown to the index. Mark it saturated so lookups
+    // fall back to scanning until `Reset()`.
+
+    RlocIndexClear();
+    mRlocIndexSaturated = true;
+
+    return LeaderBase::SetNetworkData(aVersion, aStableVersion, aStableOnly, aMessage, aMessageOffset);
+}
+#endif
+
 void Leader::Start(void)
 {
     Get<Tmf::Agent>().AddResource(mServerData);
@@ -120,6 +159,9 @@ void Leader::IncrementVersions(bool aIncludeStable)
     }
 
     mVersion++;
+#if OPENTHREAD_CONFIG_TMF_NETDATA_CONTEXT_INDEX_ENABLE
+    UpdateContextIndex();
+#endif
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -373,6 +415,77 @@ exit:
     FreeMessageOnError(message, error);
 }
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+void Leader::RlocIndexClear(void)
+{
+    mRlocIndexLength    = 0;
+    mRlocIndexSaturated = false;
+}
+
+void Leader::RlocIndexAdd(uint16_t aRloc16)
+{
+    VerifyOrExit(!mRlocIndexSaturated);
+
+    for (uint8_t index = 0; index < mRlocIndexLength; index++)
+    {
+        VerifyOrExit(mRlocIndex[index] != aRloc16);
+    }
+
+    if (mRlocIndexLength < kRlocIndexSize)
+    {
+        mRlocIndex[mRlocIndexLength++] = aRloc16;
+    }
+    else
+    {
+        // Index is full; fall back to scanning for all RLOC16s.
+        mRlocIndexSaturated = true;
+    }
+
+exit:
+    return;
+}
+
+void Leader::RlocIndexRemove(uint16_t aRloc16, MatchMode aMatchMode)
+{
+    VerifyOrExit(!mRlocIndexSaturated);
+
+    for (uint8_t index = 0; index < mRlocIndexLength;)
+    {
+        if (RlocMatch(mRlocIndex[index], aRloc16, aMatchMode))
+        {
+            mRlocIndex[index] = mRlocIndex[--mRlocIndexLength];
+        }
+        else
+        {
+            index++;
+        }
+    }
+
+exit:
+    return;
+}
+
+bool Leader::RlocIndexMayContain(uint16_t aRloc16, MatchMode aMatchMode) const
+{
+    bool mayContain = true;
+
+    VerifyOrExit(!mRlocIndexSaturated);
+
+    mayContain = false;
+
+    for (uint8_t index = 0; index < mRlocIndexLength; index++)
+    {
+        if (RlocMatch(mRlocIndex[index], aRloc16, aMatchMode))
+        {
+            ExitNow(mayContain = true);
+        }
+    }
+
+exit:
+    return mayContain;
+}
+#endif // OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+
 bool Leader::RlocMatch(uint16_t aFirstRloc16, uint16_t aSecondRloc16, MatchMode aMatchMode)
 {
     bool matched = false;
@@ -705,7 +818,12 @@ void Leader::RegisterNetworkData(uint16_t aRloc16, const uint8_t *aTlvs, uint8_t
     SuccessOrExit(error = Validate(aTlvs, aTlvsLength, aRloc16));
 
     // Remove all entries matching `aRloc16` excluding entries that are
-    // present in `aTlvs`
+    // present in `aTlvs`. Note that this realizes a delta update: the
+    // entries from an earlier registration that are unchanged in
+    // `aTlvs` are left in place (and not flagged in `flags`), so a
+    // re-registration with identical content does not bump the
+    // Network Data version numbers (see `IncrementVersions(flags)`
+    // below) and therefore does not re-propagate anything.
     RemoveRloc(aRloc16, kMatchModeRloc16, aTlvs, aTlvsLength, flags);
 
     // Now add all new entries in `aTlvs` to Network Data.
@@ -857,6 +975,9 @@ Error Leader::AddHasRoute(const HasRouteTlv &aHasRoute, PrefixTlv &aDstPrefix, C
 
     *dstHasRoute->GetLastEntry() = *entry;
     aChangedFlags.Update(*dstHasRoute);
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    RlocIndexAdd(entry->GetRloc());
+#endif
 
 exit:
     return error;
@@ -925,6 +1046,9 @@ Error Leader::AddBorderRouter(const BorderRouterTlv &aBorderRouter, PrefixTlv &a
     aDstPrefix.IncreaseLength(sizeof(BorderRouterEntry));
     *dstBorderRouter->GetLastEntry() = *entry;
     aChangedFlags.Update(*dstBorderRouter);
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    RlocIndexAdd(entry->GetRloc());
+#endif
 
 exit:
     return error;
@@ -951,6 +1075,9 @@ Error Leader::AddServer(const ServerTlv &aServer, ServiceTlv &aDstService, Chang
 
     aDstService.IncreaseLength(tlvSize);
     aChangedFlags.Update(*dstServer);
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    RlocIndexAdd(aServer.GetServer16());
+#endif
 
 exit:
     return error;
@@ -1054,6 +1181,12 @@ void Leader::RemoveRloc(uint16_t       aRloc16,
 
     NetworkDataTlv *cur = GetTlvsStart();
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    // Skip the full Network Data scan when the index shows no entry
+    // can match `aRloc16`.
+    VerifyOrExit(RlocIndexMayContain(aRloc16, aMatchMode));
+#endif
+
     while (cur < GetTlvsEnd())
     {
         switch (cur->GetType())
@@ -1100,6 +1233,15 @@ void Leader::RemoveRloc(uint16_t       aRloc16,
         cur = cur->GetNext();
     }
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    if (aExcludeTlvs == nullptr)
+    {
+        // With no exclusions every matching entry was removed.
+        RlocIndexRemove(aRloc16, aMatchMode);
+    }
+
+exit:
+#endif
     otDumpDebgNetData("remove done", mTlvs, mLength);
 }
 
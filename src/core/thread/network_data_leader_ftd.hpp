@@ -92,6 +92,18 @@ public:
      */
     void Reset(void);
 
+#if OPENTHREAD_CONFIG_MLE_LEADER_HOT_STANDBY_ENABLE
+    /**
+     * This method adopts the mirrored leader Network Data as this device's own leader state on a hot-standby leader
+     * takeover.
+     *
+     * Unlike `Reset()`, the Network Data TLVs are preserved, while the 6LoWPAN Context ID accounting is rebuilt from
+     * the preserved TLVs and both version numbers are incremented.
+     *
+     */
+    void HandleLeaderTakeover(void);
+#endif
+
     /**
      * This method starts the Leader services.
      *
@@ -173,6 +185,30 @@ public:
      */
     Error RemoveStaleChildEntries(Coap::ResponseHandler aHandler, void *aContext);
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    /**
+     * This method sets the network data from an MLE message received from the Leader.
+     *
+     * Since the received data replaces the Network Data wholesale, the RLOC16 index is invalidated (saturated)
+     * until the next `Reset()` (when this device itself becomes leader).
+     *
+     * @param[in]  aVersion        The Version value.
+     * @param[in]  aStableVersion  The Stable Version value.
+     * @param[in]  aStableOnly     TRUE if storing only the stable data, FALSE otherwise.
+     * @param[in]  aMessage        A reference to the MLE message.
+     * @param[in]  aMessageOffset  The offset in @p aMessage for the Network Data TLV.
+     *
+     * @retval kErrorNone   Successfully set the network data.
+     * @retval kErrorParse  Network Data TLV in @p aMessage is not valid.
+     *
+     */
+    Error SetNetworkData(uint8_t        aVersion,
+                         uint8_t        aStableVersion,
+                         bool           aStableOnly,
+                         const Message &aMessage,
+                         uint16_t       aMessageOffset);
+#endif
+
 private:
     class ChangedFlags
     {
@@ -289,6 +325,13 @@ private:
     void IncrementVersions(bool aIncludeStable);
     void IncrementVersions(const ChangedFlags &aFlags);
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    void RlocIndexClear(void);
+    void RlocIndexAdd(uint16_t aRloc16);
+    void RlocIndexRemove(uint16_t aRloc16, MatchMode aMatchMode);
+    bool RlocIndexMayContain(uint16_t aRloc16, MatchMode aMatchMode) const;
+#endif
+
     static constexpr uint8_t  kMinContextId        = 1;            // Minimum Context ID (0 is used for Mesh Local)
     static constexpr uint8_t  kNumContextIds       = 15;           // Maximum Context ID
     static constexpr uint32_t kContextIdReuseDelay = 48 * 60 * 60; // in seconds
@@ -299,6 +342,14 @@ private:
     uint32_t   mContextIdReuseDelay;
     TimerMilli mTimer;
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_ENABLE
+    static constexpr uint8_t kRlocIndexSize = OPENTHREAD_CONFIG_TMF_NETDATA_LEADER_RLOC_INDEX_SIZE;
+
+    uint16_t mRlocIndex[kRlocIndexSize]; // Server RLOC16s present in the Network Data (conservative superset).
+    uint8_t  mRlocIndexLength;
+    bool     mRlocIndexSaturated;
+#endif
+
     Coap::Resource mServerData;
 
     Coap::Resource mCommissioningDataGet;
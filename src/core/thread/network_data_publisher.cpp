@@ -40,6 +40,8 @@
 #include "common/const_cast.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
+#include "common/logging.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/random.hpp"
 #include "thread/network_data_local.hpp"
 #include "thread/network_data_service.hpp"
@@ -58,6 +60,10 @@ Publisher::Publisher(Instance &aInstance)
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
     , mPrefixCallback(nullptr)
     , mPrefixCallbackContext(nullptr)
+#endif
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+    , mChurnWindowStart(0)
+    , mChurnCount(0)
 #endif
     , mTimer(aInstance, Publisher::HandleTimer)
 {
@@ -202,6 +208,13 @@ void Publisher::HandleNotifierEvents(Events aEvents)
 
     bool registerWithLeader = false;
 
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+    if (aEvents.Contains(kEventThreadNetdataChanged))
+    {
+        RecordNetDataChange();
+    }
+#endif
+
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
     if (mDnsSrpServiceEntry.HandleNotifierEvents(aEvents))
     {
@@ -222,6 +235,75 @@ void Publisher::HandleNotifierEvents(Events aEvents)
     }
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+
+void Publisher::RecordNetDataChange(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    if (now - mChurnWindowStart >= kChurnWindow)
+    {
+        mChurnWindowStart = now;
+        mChurnCount       = 0;
+    }
+
+    if (mChurnCount < NumericLimits<uint8_t>::kMax)
+    {
+        mChurnCount++;
+    }
+}
+
+uint8_t Publisher::DetermineLoadFactor(void) const
+{
+    // Estimates the leader load from the Network Data churn rate
+    // (number of Network Data changes seen within the churn window)
+    // and maps it to a delay window stretch factor.
+
+    uint8_t factor = 1;
+
+    VerifyOrExit(TimerMilli::GetNow() - mChurnWindowStart < kChurnWindow);
+
+    factor += mChurnCount / kChurnThreshold;
+
+    if (factor > kMaxLoadFactor)
+    {
+        factor = kMaxLoadFactor;
+    }
+
+exit:
+    return factor;
+}
+
+uint32_t Publisher::SelectDelay(uint32_t aMaxDelay)
+{
+    // Selects a wait time within the delay window. Instead of drawing
+    // uniformly from the full window, the device deterministically
+    // derives a delay slot from a stable hash of its extended address
+    // (so co-located devices spread across the window rather than all
+    // converging within it) and adds random jitter within the slot.
+    // The window itself is stretched by the observed leader load.
+
+    uint32_t maxDelay = aMaxDelay * DetermineLoadFactor();
+    uint32_t slotSize = maxDelay / kDesyncNumSlots;
+    uint32_t slot     = 0;
+
+    for (uint8_t byte : Get<Mac::Mac>().GetExtAddress().m8)
+    {
+        slot = slot * 33 + byte;
+    }
+
+    slot %= kDesyncNumSlots;
+
+    if (slotSize < 2)
+    {
+        slotSize = 2;
+    }
+
+    return slot * slotSize + Random::NonCrypto::GetUint32InRange(1, slotSize);
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+
 void Publisher::HandleTimer(Timer &aTimer)
 {
     aTimer.Get<Publisher>().HandleTimer();
@@ -304,7 +386,11 @@ void Publisher::Entry::UpdateState(uint8_t aNumEntries, uint8_t aNumPreferredEnt
 
         if (aNumEntries < aDesiredNumEntries)
         {
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+            mUpdateTime = TimerMilli::GetNow() + Get<Publisher>().SelectDelay(kMaxDelayToAdd);
+#else
             mUpdateTime = TimerMilli::GetNow() + Random::NonCrypto::GetUint32InRange(1, kMaxDelayToAdd);
+#endif
             SetState(kAdding);
             Get<Publisher>().GetTimer().FireAtIfEarlier(mUpdateTime);
             LogUpdateTime();
@@ -334,7 +420,11 @@ void Publisher::Entry::UpdateState(uint8_t aNumEntries, uint8_t aNumPreferredEnt
 
         if (aNumEntries > aDesiredNumEntries)
         {
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+            mUpdateTime = TimerMilli::GetNow() + Get<Publisher>().SelectDelay(kMaxDelayToRemove);
+#else
             mUpdateTime = TimerMilli::GetNow() + Random::NonCrypto::GetUint32InRange(1, kMaxDelayToRemove);
+#endif
 
             if (aNumPreferredEntries < aDesiredNumEntries)
             {
@@ -443,6 +443,18 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+    // All in milliseconds (except the counts/factors).
+    static constexpr uint8_t  kDesyncNumSlots = OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_NUM_SLOTS;
+    static constexpr uint32_t kChurnWindow    = OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_WINDOW;
+    static constexpr uint8_t  kChurnThreshold = OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_CHURN_THRESHOLD;
+    static constexpr uint8_t  kMaxLoadFactor  = OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_MAX_LOAD_FACTOR;
+
+    uint32_t SelectDelay(uint32_t aMaxDelay);
+    uint8_t  DetermineLoadFactor(void) const;
+    void     RecordNetDataChange(void);
+#endif
+
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
     DnsSrpServiceEntry mDnsSrpServiceEntry;
 #endif
@@ -453,6 +465,11 @@ private:
     void *         mPrefixCallbackContext;
 #endif
 
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_DESYNC_ENABLE
+    TimeMilli mChurnWindowStart;
+    uint8_t   mChurnCount;
+#endif
+
     TimerMilli mTimer;
 };
 
@@ -62,6 +62,7 @@ NetworkDiagnostic::NetworkDiagnostic(Instance &aInstance)
     , mDiagnosticReset(UriPath::kDiagnosticReset, &NetworkDiagnostic::HandleDiagnosticReset, this)
     , mReceiveDiagnosticGetCallback(nullptr)
     , mReceiveDiagnosticGetCallbackContext(nullptr)
+    , mQueryChildIndex(kChildIndexDone)
 {
     Get<Tmf::Agent>().AddResource(mDiagnosticGetRequest);
     Get<Tmf::Agent>().AddResource(mDiagnosticGetQuery);
@@ -259,6 +260,42 @@ exit:
 
     return error;
 }
+Error NetworkDiagnostic::AppendChildTlvs(Message &aMessage, uint16_t &aChildIndex)
+{
+    Error    error       = kErrorNone;
+    uint16_t maxChildren = Get<ChildTable>().GetMaxChildrenAllowed();
+
+    for (; aChildIndex < maxChildren; aChildIndex++)
+    {
+        const Child *child = Get<ChildTable>().GetChildAtIndex(aChildIndex);
+        ChildTlv     tlv;
+
+        if ((child == nullptr) || !child->IsStateValid())
+        {
+            continue;
+        }
+
+        // Stop at the page length limit, leaving `aChildIndex` at the
+        // first child which did not fit (to be sent in a follow-up
+        // answer message).
+        VerifyOrExit(aMessage.GetLength() + sizeof(ChildTlv) <= kChildTlvPageLength);
+
+        tlv.Init();
+        tlv.SetExtAddress(child->GetExtAddress());
+        tlv.SetRloc16(child->GetRloc16());
+        tlv.SetMode(child->GetDeviceMode().Get());
+        tlv.SetLinkQuality(child->GetLinkInfo().GetLinkQuality());
+        tlv.SetTimeout(child->GetTimeout());
+        tlv.SetAge(Time::MsecToSec(TimerMilli::GetNow() - child->GetLastHeard()));
+
+        SuccessOrExit(error = tlv.AppendTo(aMessage));
+    }
+
+    aChildIndex = kChildIndexDone;
+
+exit:
+    return error;
+}
 #endif // OPENTHREAD_FTD
 
 void NetworkDiagnostic::FillMacCountersTlv(MacCountersTlv &aMacCountersTlv)
@@ -440,6 +477,22 @@ Error NetworkDiagnostic::FillRequestedTlvs(const Message &       aRequest,
 
             break;
         }
+
+        case NetworkDiagnosticTlv::kChild:
+        {
+            // Answer on behalf of the attached children with one Child
+            // TLV per child, so a collector can learn about all
+            // children from a single query to the parent. Children
+            // which do not fit in this message are sent in follow-up
+            // answer messages when handling a query (see
+            // `HandleDiagnosticGetQuery()`).
+            if (Get<Mle::MleRouter>().IsRouterOrLeader())
+            {
+                mQueryChildIndex = 0;
+                SuccessOrExit(error = AppendChildTlvs(aResponse, mQueryChildIndex));
+            }
+            break;
+        }
 #endif
 
         default:
@@ -505,12 +558,35 @@ void NetworkDiagnostic::HandleDiagnosticGetQuery(Coap::Message &aMessage, const
     messageInfo.SetPeerAddr(aMessageInfo.GetPeerAddr());
     messageInfo.SetPeerPort(Tmf::kUdpPort);
 
+    mQueryChildIndex = kChildIndexDone;
+
     SuccessOrExit(error = FillRequestedTlvs(aMessage, *message, networkDiagnosticTlv));
 
     SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*message, messageInfo, nullptr, this));
+    message = nullptr;
 
     otLogInfoNetDiag("Sent diagnostic get answer");
 
+#if OPENTHREAD_FTD
+    // Send the remaining Child TLVs (which did not fit in the first
+    // answer) paginated over follow-up answer messages.
+
+    while (mQueryChildIndex != kChildIndexDone)
+    {
+        VerifyOrExit((message = Get<Tmf::Agent>().NewMessage()) != nullptr, error = kErrorNoBufs);
+
+        SuccessOrExit(error = message->InitAsConfirmablePost(UriPath::kDiagnosticGetAnswer));
+        SuccessOrExit(error = message->SetPayloadMarker());
+
+        SuccessOrExit(error = AppendChildTlvs(*message, mQueryChildIndex));
+
+        SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*message, messageInfo, nullptr, this));
+        message = nullptr;
+
+        otLogInfoNetDiag("Sent diagnostic get answer page");
+    }
+#endif
+
 exit:
     FreeMessageOnError(message, error);
 }
@@ -865,6 +941,22 @@ Error NetworkDiagnostic::GetNextDiagTlv(const Coap::Message &aMessage,
                               Tlv::Read<MaxChildTimeoutTlv>(aMessage, offset, aNetworkDiagTlv.mData.mMaxChildTimeout));
             break;
 
+        case NetworkDiagnosticTlv::kChild:
+        {
+            ChildTlv childTlv;
+
+            SuccessOrExit(error = aMessage.Read(offset, childTlv));
+            VerifyOrExit(childTlv.IsValid(), error = kErrorParse);
+
+            static_cast<Mac::ExtAddress &>(aNetworkDiagTlv.mData.mChild.mExtAddress) = childTlv.GetExtAddress();
+            aNetworkDiagTlv.mData.mChild.mRloc16                                     = childTlv.GetRloc16();
+            ParseMode(Mle::DeviceMode(childTlv.GetMode()), aNetworkDiagTlv.mData.mChild.mMode);
+            aNetworkDiagTlv.mData.mChild.mLinkQuality = childTlv.GetLinkQuality();
+            aNetworkDiagTlv.mData.mChild.mTimeout     = childTlv.GetTimeout();
+            aNetworkDiagTlv.mData.mChild.mAge         = childTlv.GetAge();
+            break;
+        }
+
         default:
             // Ignore unrecognized Network Diagnostic TLV silently and
             // continue to top of the `while(true)` loop.
@@ -123,8 +123,19 @@ public:
     static Error GetNextDiagTlv(const Coap::Message &aMessage, Iterator &aIterator, otNetworkDiagTlv &aNetworkDiagTlv);
 
 private:
+    // Index value indicating that all children have been appended
+    // (see `AppendChildTlvs()`).
+    static constexpr uint16_t kChildIndexDone = 0xffff;
+
+    // Maximum message length of an answer page carrying Child TLVs,
+    // keeping each DIAG_GET.ans message (with its headers) within a
+    // single IPv6 MTU. Children which do not fit are sent in
+    // follow-up answer messages.
+    static constexpr uint16_t kChildTlvPageLength = 1024;
+
     Error AppendIp6AddressList(Message &aMessage);
     Error AppendChildTable(Message &aMessage);
+    Error AppendChildTlvs(Message &aMessage, uint16_t &aChildIndex);
     void  FillMacCountersTlv(MacCountersTlv &aMacCountersTlv);
     Error FillRequestedTlvs(const Message &aRequest, Message &aResponse, NetworkDiagnosticTlv &aNetworkDiagnosticTlv);
 
@@ -153,6 +164,11 @@ private:
 
     otReceiveDiagnosticGetCallback mReceiveDiagnosticGetCallback;
     void *                         mReceiveDiagnosticGetCallbackContext;
+
+    // Table index of the next child to include when answering a query
+    // requesting Child TLVs (`kChildIndexDone` when no more children
+    // remain to be sent).
+    uint16_t mQueryChildIndex;
 };
 
 /**
@@ -92,6 +92,7 @@ public:
         kChannelPages    = OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES,
         kTypeList        = OT_NETWORK_DIAGNOSTIC_TLV_TYPE_LIST,
         kMaxChildTimeout = OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT,
+        kChild           = OT_NETWORK_DIAGNOSTIC_TLV_CHILD,
     };
 
     /**
@@ -1110,6 +1111,140 @@ public:
 
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements Child TLV generation and parsing.
+ *
+ * A router appends one Child TLV per attached child when answering a diagnostic get on behalf of its children.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class ChildTlv : public NetworkDiagnosticTlv, public TlvInfo<NetworkDiagnosticTlv::kChild>
+{
+public:
+    /**
+     * This method initializes the TLV.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kChild);
+        SetLength(sizeof(*this) - sizeof(NetworkDiagnosticTlv));
+    }
+
+    /**
+     * This method indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= sizeof(*this) - sizeof(NetworkDiagnosticTlv); }
+
+    /**
+     * This method returns the Extended MAC Address of the child.
+     *
+     * @returns The Extended MAC Address of the child.
+     *
+     */
+    const Mac::ExtAddress &GetExtAddress(void) const { return mExtAddress; }
+
+    /**
+     * This method sets the Extended MAC Address of the child.
+     *
+     * @param[in]  aExtAddress  The Extended MAC Address of the child.
+     *
+     */
+    void SetExtAddress(const Mac::ExtAddress &aExtAddress) { mExtAddress = aExtAddress; }
+
+    /**
+     * This method returns the RLOC16 of the child.
+     *
+     * @returns The RLOC16 of the child.
+     *
+     */
+    uint16_t GetRloc16(void) const { return HostSwap16(mRloc16); }
+
+    /**
+     * This method sets the RLOC16 of the child.
+     *
+     * @param[in]  aRloc16  The RLOC16 of the child.
+     *
+     */
+    void SetRloc16(uint16_t aRloc16) { mRloc16 = HostSwap16(aRloc16); }
+
+    /**
+     * This method returns the Mode of the child.
+     *
+     * @returns The Mode of the child.
+     *
+     */
+    uint8_t GetMode(void) const { return mMode; }
+
+    /**
+     * This method sets the Mode of the child.
+     *
+     * @param[in]  aMode  The Mode of the child.
+     *
+     */
+    void SetMode(uint8_t aMode) { mMode = aMode; }
+
+    /**
+     * This method returns the incoming link quality of the child as seen by its parent.
+     *
+     * @returns The incoming link quality (1-3) of the child.
+     *
+     */
+    uint8_t GetLinkQuality(void) const { return mLinkQuality; }
+
+    /**
+     * This method sets the incoming link quality of the child.
+     *
+     * @param[in]  aLinkQuality  The incoming link quality (1-3) of the child.
+     *
+     */
+    void SetLinkQuality(uint8_t aLinkQuality) { mLinkQuality = aLinkQuality; }
+
+    /**
+     * This method returns the Timeout of the child (in seconds).
+     *
+     * @returns The Timeout of the child (in seconds).
+     *
+     */
+    uint32_t GetTimeout(void) const { return HostSwap32(mTimeout); }
+
+    /**
+     * This method sets the Timeout of the child (in seconds).
+     *
+     * @param[in]  aTimeout  The Timeout of the child (in seconds).
+     *
+     */
+    void SetTimeout(uint32_t aTimeout) { mTimeout = HostSwap32(aTimeout); }
+
+    /**
+     * This method returns the time (in seconds) since the parent last heard from the child.
+     *
+     * @returns The time (in seconds) since the parent last heard from the child.
+     *
+     */
+    uint32_t GetAge(void) const { return HostSwap32(mAge); }
+
+    /**
+     * This method sets the time (in seconds) since the parent last heard from the child.
+     *
+     * @param[in]  aAge  The time (in seconds) since the parent last heard from the child.
+     *
+     */
+    void SetAge(uint32_t aAge) { mAge = HostSwap32(aAge); }
+
+private:
+    Mac::ExtAddress mExtAddress;
+    uint16_t        mRloc16;
+    uint8_t         mMode;
+    uint8_t         mLinkQuality;
+    uint32_t        mTimeout;
+    uint32_t        mAge;
+} OT_TOOL_PACKED_END;
+
 /**
  * This class implements Channel Pages TLV generation and parsing.
  *
@@ -296,6 +296,25 @@ Mac::TxFrame &RadioSelector::SelectRadio(Message &aMessage, const Mac::Address &
 
     aMessage.SetRadioType(selectedRadio);
 
+#if OPENTHREAD_CONFIG_MULTI_RADIO_PARALLEL_TX_ENABLE
+    // In parallel tx mode the frame is additionally sent over every
+    // other supported radio link on which the neighbor has a high
+    // preference. The "required radio types" set is left empty, so a
+    // successful tx (ack) over any one of the selected links makes
+    // the overall tx successful ("first ack wins").
+
+    for (Mac::RadioType radio : sRadioSelectionOrder)
+    {
+        if ((radio != selectedRadio) && neighbor->GetSupportedRadioTypes().Contains(radio) &&
+            (neighbor->GetRadioPreference(radio) >= kHighPreference))
+        {
+            selections.Add(radio);
+
+            Log(OT_LOG_LEVEL_DEBG, "ParallelTx", radio, *neighbor);
+        }
+    }
+#endif
+
     // We (probabilistically) decide whether to probe on another radio
     // link for the current frame tx. When probing we allow the same
     // frame to be sent in parallel over multiple radio links but only
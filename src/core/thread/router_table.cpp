@@ -56,6 +56,7 @@ void RouterTable::Iterator::Advance(void)
 RouterTable::RouterTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mRouterIdSequenceLastUpdated(0)
+    , mRouteGeneration(1)
     , mRouterIdSequence(Random::NonCrypto::GetUint8())
     , mActiveRouterCount(0)
 {
@@ -195,6 +196,12 @@ void RouterTable::UpdateAllocation(void)
         router.Clear();
         router.SetRloc16(0xffff);
     }
+
+#if OPENTHREAD_CONFIG_MLE_ROUTER_INDEX_MAP_ENABLE
+    memcpy(mRouterIndexMap, indexMap, sizeof(mRouterIndexMap));
+#endif
+
+    SignalRouteChanged();
 }
 
 Router *RouterTable::Allocate(void)
@@ -311,6 +318,7 @@ void RouterTable::RemoveRouterLink(Router &aRouter)
 {
     aRouter.SetLinkQualityOut(0);
     aRouter.SetLastHeard(TimerMilli::GetNow());
+    SignalRouteChanged();
 
     for (Router *cur = GetFirstEntry(); cur != nullptr; cur = GetNextEntry(cur))
     {
@@ -389,13 +397,25 @@ Router *RouterTable::GetNeighbor(const Mac::Address &aMacAddress)
 const Router *RouterTable::GetRouter(uint8_t aRouterId) const
 {
     const Router *router = nullptr;
-    uint16_t      rloc16;
+#if OPENTHREAD_CONFIG_MLE_ROUTER_INDEX_MAP_ENABLE
+    uint8_t index;
+#else
+    uint16_t rloc16;
+#endif
 
     // Skip if invalid router id is passed.
     VerifyOrExit(aRouterId < Mle::kInvalidRouterId);
 
+#if OPENTHREAD_CONFIG_MLE_ROUTER_INDEX_MAP_ENABLE
+    // The index map (rebuilt in `UpdateAllocation()`) resolves the
+    // router id to its table entry directly.
+    index = mRouterIndexMap[aRouterId];
+    VerifyOrExit(index != Mle::kInvalidRouterId);
+    router = &mRouters[index];
+#else
     rloc16 = Mle::Mle::Rloc16FromRouterId(aRouterId);
     router = FindRouter(Router::AddressMatcher(rloc16, Router::kInStateAny));
+#endif
 
 exit:
     return router;
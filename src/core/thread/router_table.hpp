@@ -286,6 +286,34 @@ public:
      */
     TimeMilli GetRouterIdSequenceLastUpdated(void) const { return mRouterIdSequenceLastUpdated; }
 
+    /**
+     * This method returns the current route generation number.
+     *
+     * The route generation number is incremented whenever the set of allocated routers, a router link, or any
+     * router's next hop or path cost changes. It allows a received Route TLV which matches the one previously
+     * processed from the same router to skip route re-evaluation when no other route state has changed either.
+     *
+     * @returns The current route generation number.
+     *
+     */
+    uint16_t GetRouteGeneration(void) const { return mRouteGeneration; }
+
+    /**
+     * This method signals that route state has changed, incrementing the route generation number.
+     *
+     */
+    void SignalRouteChanged(void)
+    {
+        // Zero is skipped so that a cleared `Router` entry (with a zero
+        // last-processed generation number) never matches the current
+        // generation number.
+
+        if (++mRouteGeneration == 0)
+        {
+            mRouteGeneration = 1;
+        }
+    }
+
     /**
      * This method returns the number of neighbor links.
      *
@@ -365,8 +393,12 @@ private:
 
     Router           mRouters[Mle::kMaxRouters];
     Mle::RouterIdSet mAllocatedRouterIds;
+#if OPENTHREAD_CONFIG_MLE_ROUTER_INDEX_MAP_ENABLE
+    uint8_t mRouterIndexMap[Mle::kMaxRouterId + 1];
+#endif
     uint8_t          mRouterIdReuseDelay[Mle::kMaxRouterId + 1];
     TimeMilli        mRouterIdSequenceLastUpdated;
+    uint16_t         mRouteGeneration;
     uint8_t          mRouterIdSequence;
     uint8_t          mActiveRouterCount;
 };
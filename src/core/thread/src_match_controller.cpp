@@ -51,7 +51,15 @@ namespace ot {
 SourceMatchController::SourceMatchController(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+    , mSyncTask(aInstance, HandleSyncTask)
+#endif
 {
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+    mDirtyMask.Clear();
+    mInTableMask.Clear();
+#endif
+
     ClearTable();
 }
 
@@ -59,7 +67,11 @@ void SourceMatchController::IncrementMessageCount(Child &aChild)
 {
     if (aChild.GetIndirectMessageCount() == 0)
     {
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+        MarkDirty(aChild);
+#else
         AddEntry(aChild);
+#endif
     }
 
     aChild.IncrementIndirectMessageCount();
@@ -77,7 +89,11 @@ void SourceMatchController::DecrementMessageCount(Child &aChild)
 
     if (aChild.GetIndirectMessageCount() == 0)
     {
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+        MarkDirty(aChild);
+#else
         ClearEntry(aChild);
+#endif
     }
 
 exit:
@@ -87,13 +103,37 @@ exit:
 void SourceMatchController::ResetMessageCount(Child &aChild)
 {
     aChild.ResetIndirectMessageCount();
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+    // Sync immediately (not via the deferred task) since this is used
+    // on child removal paths where the child entry (and its address)
+    // may be cleared right after.
+    SyncChild(aChild);
+#else
     ClearEntry(aChild);
+#endif
 }
 
 void SourceMatchController::SetSrcMatchAsShort(Child &aChild, bool aUseShortAddress)
 {
     VerifyOrExit(aChild.IsIndirectSourceMatchShort() != aUseShortAddress);
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+    if (mInTableMask.Get(Get<ChildTable>().GetChildIndex(aChild)))
+    {
+        // The table entry uses the old address format, so it is
+        // cleared before updating the setting. Re-adding with the new
+        // format is deferred to the sync task.
+        mInTableMask.Set(Get<ChildTable>().GetChildIndex(aChild), false);
+        ClearEntry(aChild);
+        aChild.SetIndirectSourceMatchShort(aUseShortAddress);
+        MarkDirty(aChild);
+    }
+    else
+    {
+        aChild.SetIndirectSourceMatchShort(aUseShortAddress);
+    }
+#else
     if (aChild.GetIndirectMessageCount() > 0)
     {
         ClearEntry(aChild);
@@ -104,6 +144,7 @@ void SourceMatchController::SetSrcMatchAsShort(Child &aChild, bool aUseShortAddr
     {
         aChild.SetIndirectSourceMatchShort(aUseShortAddress);
     }
+#endif
 
 exit:
     return;
@@ -218,6 +259,9 @@ Error SourceMatchController::AddPendingEntries(void)
         {
             SuccessOrExit(error = AddAddress(child));
             child.SetIndirectSourceMatchPending(false);
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+            mInTableMask.Set(Get<ChildTable>().GetChildIndex(child), true);
+#endif
         }
     }
 
@@ -225,6 +269,73 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+
+void SourceMatchController::MarkDirty(Child &aChild)
+{
+    mDirtyMask.Set(Get<ChildTable>().GetChildIndex(aChild), true);
+    mSyncTask.Post();
+}
+
+void SourceMatchController::SyncChild(Child &aChild)
+{
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    bool     desired    = (aChild.GetIndirectMessageCount() > 0);
+
+    mDirtyMask.Set(childIndex, false);
+
+    if (desired && !mInTableMask.Get(childIndex))
+    {
+        AddEntry(aChild);
+
+        if (!aChild.IsIndirectSourceMatchPending())
+        {
+            mInTableMask.Set(childIndex, true);
+        }
+    }
+    else if (!desired && mInTableMask.Get(childIndex))
+    {
+        mInTableMask.Set(childIndex, false);
+        ClearEntry(aChild);
+    }
+    else if (!desired)
+    {
+        // Never added to the table (e.g., message count went back to
+        // zero before the sync task ran), so only the pending flag (if
+        // set) needs to be cleared.
+        aChild.SetIndirectSourceMatchPending(false);
+    }
+}
+
+void SourceMatchController::HandleSyncTask(Tasklet &aTasklet)
+{
+    aTasklet.Get<SourceMatchController>().HandleSyncTask();
+}
+
+void SourceMatchController::HandleSyncTask(void)
+{
+    for (uint16_t childIndex = 0; childIndex < Get<ChildTable>().GetMaxChildrenAllowed(); childIndex++)
+    {
+        Child *child;
+
+        if (!mDirtyMask.Get(childIndex))
+        {
+            continue;
+        }
+
+        mDirtyMask.Set(childIndex, false);
+
+        child = Get<ChildTable>().GetChildAtIndex(childIndex);
+
+        if ((child != nullptr) && child->IsStateValidOrRestoring())
+        {
+            SyncChild(*child);
+        }
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
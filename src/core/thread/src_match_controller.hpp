@@ -41,6 +41,10 @@
 #include "common/error.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+#include "common/tasklet.hpp"
+#include "thread/child_mask.hpp"
+#endif
 
 namespace ot {
 
@@ -186,7 +190,36 @@ private:
      */
     Error AddPendingEntries(void);
 
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+    /**
+     * This method marks a given child as dirty (its desired source match table state may differ from the radio) and
+     * schedules the deferred sync task.
+     *
+     * @param[in] aChild   A reference to the child.
+     *
+     */
+    void MarkDirty(Child &aChild);
+
+    /**
+     * This method reconciles the radio source match table entry of a given child with its desired state (derived
+     * from the child's indirect message count), clearing the child's dirty bit.
+     *
+     * @param[in] aChild   A reference to the child.
+     *
+     */
+    void SyncChild(Child &aChild);
+
+    static void HandleSyncTask(Tasklet &aTasklet);
+    void        HandleSyncTask(void);
+#endif
+
     bool mEnabled;
+
+#if OPENTHREAD_CONFIG_MAC_SRC_MATCH_DEFERRED_SYNC_ENABLE
+    ChildMask mDirtyMask;   // Children whose desired table state may differ from the radio table.
+    ChildMask mInTableMask; // Children whose address is currently in the radio table.
+    Tasklet   mSyncTask;
+#endif
 };
 
 /**
@@ -71,7 +71,7 @@ ThreadNetif::ThreadNetif(Instance &aInstance)
 #if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_ENABLE
     , mSrpClientBuffers(aInstance)
 #endif
-#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+#if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && !OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
     , mDnssdServer(aInstance)
 #endif
 #if OPENTHREAD_CONFIG_SNTP_CLIENT_ENABLE
@@ -107,7 +107,7 @@ ThreadNetif::ThreadNetif(Instance &aInstance)
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
     , mBorderAgent(aInstance)
 #endif
-#if OPENTHREAD_CONFIG_COMMISSIONER_ENABLE && OPENTHREAD_FTD
+#if OPENTHREAD_CONFIG_COMMISSIONER_ENABLE && OPENTHREAD_FTD && !OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
     , mCommissioner(aInstance)
 #endif
 #if OPENTHREAD_CONFIG_DTLS_ENABLE
@@ -138,7 +138,7 @@ ThreadNetif::ThreadNetif(Instance &aInstance)
 #if OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
     , mDuaManager(aInstance)
 #endif
-#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && !OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
     , mSrpServer(aInstance)
 #endif
 
@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include "coap/coap_secure.hpp"
+#include "common/lazy.hpp"
 #include "mac/mac.hpp"
 #include "thread/tmf.hpp"
 
@@ -217,8 +218,12 @@ private:
     Utils::SrpClientBuffers mSrpClientBuffers;
 #endif
 #if OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+#if OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+    Lazy<Dns::ServiceDiscovery::Server> mDnssdServer;
+#else
     Dns::ServiceDiscovery::Server mDnssdServer;
 #endif
+#endif
 #if OPENTHREAD_CONFIG_SNTP_CLIENT_ENABLE
     Sntp::Client mSntpClient;
 #endif
@@ -254,7 +259,11 @@ private:
     MeshCoP::BorderAgent mBorderAgent;
 #endif
 #if OPENTHREAD_CONFIG_COMMISSIONER_ENABLE && OPENTHREAD_FTD
+#if OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+    Lazy<MeshCoP::Commissioner> mCommissioner;
+#else
     MeshCoP::Commissioner mCommissioner;
+#endif
 #endif // OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
 
 #if OPENTHREAD_CONFIG_DTLS_ENABLE
@@ -289,8 +298,12 @@ private:
     DuaManager mDuaManager;
 #endif
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+#if OPENTHREAD_CONFIG_LAZY_SUBSYSTEM_INIT_ENABLE
+    Lazy<Srp::Server> mSrpServer;
+#else
     Srp::Server mSrpServer;
 #endif
+#endif
 
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
 #if OPENTHREAD_FTD
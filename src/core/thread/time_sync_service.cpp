@@ -47,6 +47,12 @@
 
 #define ABS(value) (((value) >= 0) ? (value) : -(value))
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+// The minimum interval between received time sync updates for a drift
+// rate sample to be taken, in microseconds.
+static constexpr uint64_t kMinDriftSampleIntervalUs = 1000000;
+#endif
+
 namespace ot {
 
 TimeSync::TimeSync(Instance &aInstance)
@@ -64,13 +70,30 @@ TimeSync::TimeSync(Instance &aInstance)
     , mTimeSyncCallbackContext(nullptr)
     , mTimer(aInstance, HandleTimeout)
     , mCurrentStatus(OT_NETWORK_TIME_UNSYNCHRONIZED)
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+    , mDriftPpb(0)
+    , mDriftValid(false)
+    , mLastSyncLocalTime(0)
+#endif
 {
     CheckAndHandleChanges(false);
 }
 
 otNetworkTimeStatus TimeSync::GetTime(uint64_t &aNetworkTime) const
 {
-    aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(otPlatTimeGet()) + mNetworkTimeOffset);
+    uint64_t now    = otPlatTimeGet();
+    int64_t  offset = mNetworkTimeOffset;
+
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+    // Compensate for the estimated local clock drift accumulated since
+    // the last received time sync update.
+    if (mDriftValid)
+    {
+        offset += static_cast<int64_t>(now - mLastSyncLocalTime) * mDriftPpb / 1000000000;
+    }
+#endif
+
+    aNetworkTime = static_cast<uint64_t>(static_cast<int64_t>(now) + offset);
 
     return mCurrentStatus;
 }
@@ -113,6 +136,9 @@ void TimeSync::HandleTimeSyncMessage(const Message &aMessage)
         if (mTimeSyncSeq == OT_TIME_SYNC_INVALID_SEQ || timeSyncSeqDelta > 0 || Get<Mle::MleRouter>().IsDetached())
         {
             // Update network time and forward it.
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+            UpdateDriftEstimate(aMessage.GetNetworkTimeOffset());
+#endif
             mLastTimeSyncReceived = TimerMilli::GetNow();
             mTimeSyncSeq          = aMessage.GetTimeSyncSeq();
             mNetworkTimeOffset    = aMessage.GetNetworkTimeOffset();
@@ -131,6 +157,55 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+void TimeSync::UpdateDriftEstimate(int64_t aNewOffset)
+{
+    uint64_t now         = otPlatTimeGet();
+    uint64_t elapsed     = now - mLastSyncLocalTime;
+    int64_t  offsetDelta = aNewOffset - mNetworkTimeOffset;
+    int64_t  samplePpb;
+
+    // A previous update and a long enough interval are needed for a
+    // meaningful rate sample.
+    VerifyOrExit(mLastSyncLocalTime != 0 && elapsed >= kMinDriftSampleIntervalUs);
+
+    if (static_cast<uint64_t>(ABS(offsetDelta)) > elapsed / 1000)
+    {
+        // The offset moved by more than 1000 ppm of the elapsed time.
+        // This is a time jump (e.g., a new leader seeding time) rather
+        // than oscillator drift; restart the estimation.
+        ResetDriftEstimate();
+        ExitNow();
+    }
+
+    samplePpb = offsetDelta * 1000000000 / static_cast<int64_t>(elapsed);
+
+    if (!mDriftValid)
+    {
+        mDriftPpb   = static_cast<int32_t>(samplePpb);
+        mDriftValid = true;
+    }
+    else
+    {
+        // Exponential smoothing with 1/4 weight for the new sample.
+        mDriftPpb += (static_cast<int32_t>(samplePpb) - mDriftPpb) / 4;
+    }
+
+    otLogInfoCore("Time sync drift estimate updated: %d ppb (sample %d ppb)", mDriftPpb,
+                  static_cast<int32_t>(samplePpb));
+
+exit:
+    mLastSyncLocalTime = now;
+}
+
+void TimeSync::ResetDriftEstimate(void)
+{
+    mDriftPpb          = 0;
+    mDriftValid        = false;
+    mLastSyncLocalTime = 0;
+}
+#endif // OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+
 void TimeSync::IncrementTimeSyncSeq(void)
 {
     if (++mTimeSyncSeq == OT_TIME_SYNC_INVALID_SEQ)
@@ -192,6 +267,12 @@ void TimeSync::HandleNotifierEvents(Events aEvents)
         // on the new partition.
         mLastTimeSyncReceived.SetValue(0);
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+        // The drift estimate is relative to the previous partition's
+        // network time and is no longer meaningful.
+        ResetDriftEstimate();
+#endif
+
         stateChanged = true;
 
         otLogInfoCore("Resetting time sync seq, partition changed");
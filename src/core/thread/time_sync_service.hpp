@@ -199,6 +199,25 @@ private:
      */
     void NotifyTimeSyncCallback(void);
 
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+    /**
+     * Update the local clock drift estimate from a newly received network time offset.
+     *
+     * The estimate is derived from the change of the offset over the local time elapsed since the previous
+     * update, exponentially smoothed across updates.
+     *
+     * @param[in] aNewOffset The newly received network time offset, in microseconds.
+     *
+     */
+    void UpdateDriftEstimate(int64_t aNewOffset);
+
+    /**
+     * Reset the local clock drift estimate.
+     *
+     */
+    void ResetDriftEstimate(void);
+#endif
+
     bool     mTimeSyncRequired; ///< Indicate whether or not a time synchronization message is required.
     uint8_t  mTimeSyncSeq;      ///< The time synchronization sequence.
     uint16_t mTimeSyncPeriod;   ///< The time synchronization period.
@@ -213,6 +232,11 @@ private:
     void *              mTimeSyncCallbackContext; ///< The context to be passed to callback.
     TimerMilli          mTimer;                   ///< Timer for checking if a resync is required.
     otNetworkTimeStatus mCurrentStatus;           ///< Current network time status.
+#if OPENTHREAD_CONFIG_TIME_SYNC_DRIFT_COMPENSATION_ENABLE
+    int32_t  mDriftPpb;          ///< Estimated local clock drift relative to network time, in parts per billion.
+    bool     mDriftValid;        ///< Whether `mDriftPpb` holds a valid estimate.
+    uint64_t mLastSyncLocalTime; ///< Local time (`otPlatTimeGet()`) when the network time offset was last updated.
+#endif
 };
 
 /**
@@ -87,6 +87,9 @@ void Neighbor::Init(Instance &aInstance)
     InstanceLocatorInit::Init(aInstance);
     mLinkInfo.Init(aInstance);
     SetState(kStateInvalid);
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+    ResetReplayWindow();
+#endif
 }
 
 bool Neighbor::IsStateValidOrAttaching(void) const
@@ -160,6 +163,73 @@ void Neighbor::GenerateChallenge(void)
         Random::Crypto::FillBuffer(mValidPending.mPending.mChallenge, sizeof(mValidPending.mPending.mChallenge)));
 }
 
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+
+static_assert(OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_SIZE <= 32,
+              "OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_SIZE must not be larger than 32");
+
+Error Neighbor::CheckLinkFrameCounter(uint32_t aFrameCounter) const
+{
+    Error    error   = kErrorNone;
+    uint32_t counter = GetLinkFrameCounters().Get();
+    uint32_t diff;
+
+    // `counter` holds one past the highest accepted frame counter
+    // value. Any value at or beyond it is new and acceptable (this
+    // also covers the case where no frame has been received yet and
+    // `counter` is zero).
+
+    VerifyOrExit(aFrameCounter < counter);
+
+    diff = (counter - 1) - aFrameCounter;
+
+    VerifyOrExit(diff != 0, error = kErrorDuplicated);
+    VerifyOrExit(diff <= OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_SIZE, error = kErrorSecurity);
+    VerifyOrExit((mValidPending.mValid.mLinkFrameCounterWindow & (1U << (diff - 1))) == 0, error = kErrorDuplicated);
+
+exit:
+    return error;
+}
+
+void Neighbor::UpdateLinkFrameCounter(uint32_t aFrameCounter)
+{
+    uint32_t &window  = mValidPending.mValid.mLinkFrameCounterWindow;
+    uint32_t  counter = GetLinkFrameCounters().Get();
+
+    if (aFrameCounter >= counter)
+    {
+        if (counter == 0)
+        {
+            window = 0;
+        }
+        else
+        {
+            // Slide the window so that bit zero tracks the previous
+            // highest value (`counter - 1`).
+
+            uint32_t shift = aFrameCounter - (counter - 1);
+
+            window = (shift >= 32) ? 0 : (window << shift);
+
+            if (shift <= 32)
+            {
+                window |= (1U << (shift - 1));
+            }
+        }
+
+        GetLinkFrameCounters().Set(aFrameCounter + 1);
+    }
+    else
+    {
+        // A reordered frame within the window (validated by
+        // `CheckLinkFrameCounter()`), mark it as seen.
+
+        window |= (1U << (((counter - 1) - aFrameCounter) - 1));
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_INITIATOR_ENABLE || OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
 void Neighbor::AggregateLinkMetrics(uint8_t aSeriesId, uint8_t aFrameType, uint8_t aLqi, int8_t aRss)
 {
@@ -57,6 +57,10 @@
 #include "thread/mle_types.hpp"
 #include "thread/radio_selector.hpp"
 
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE && OPENTHREAD_CONFIG_MULTI_RADIO
+#error "OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE is not supported with OPENTHREAD_CONFIG_MULTI_RADIO"
+#endif
+
 namespace ot {
 
 /**
@@ -177,6 +181,22 @@ public:
          */
         bool Matches(const Neighbor &aNeighbor) const;
 
+        /**
+         * This method returns the MAC short address of the `AddressMatcher`.
+         *
+         * @returns The short address, or `Mac::kShortAddrInvalid` if the matcher has no short address.
+         *
+         */
+        Mac::ShortAddress GetShortAddress(void) const { return mShortAddress; }
+
+        /**
+         * This method returns the MAC extended address of the `AddressMatcher`.
+         *
+         * @returns A pointer to the extended address, or `nullptr` if the matcher has no extended address.
+         *
+         */
+        const Mac::ExtAddress *GetExtAddress(void) const { return mExtAddress; }
+
     private:
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
@@ -429,6 +449,63 @@ public:
      */
     const Mac::LinkFrameCounters &GetLinkFrameCounters(void) const { return mValidPending.mValid.mLinkFrameCounters; }
 
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+    /**
+     * This method checks a received link frame counter against the anti-replay window.
+     *
+     * @param[in] aFrameCounter  The received frame counter value.
+     *
+     * @retval kErrorNone        The frame counter is acceptable (new, or unseen within the window).
+     * @retval kErrorDuplicated  The frame counter was already seen.
+     * @retval kErrorSecurity    The frame counter is below the anti-replay window.
+     *
+     */
+    Error CheckLinkFrameCounter(uint32_t aFrameCounter) const;
+
+    /**
+     * This method updates the link frame counter and anti-replay window after a received frame with counter
+     * @p aFrameCounter passed security verification.
+     *
+     * @param[in] aFrameCounter  The verified frame counter value.
+     *
+     */
+    void UpdateLinkFrameCounter(uint32_t aFrameCounter);
+
+    /**
+     * This method resets the anti-replay window (all frame counters marked as unseen).
+     *
+     */
+    void ResetReplayWindow(void) { mValidPending.mValid.mLinkFrameCounterWindow = 0; }
+#endif
+
+    /**
+     * This method resets the link frame counters (for all supported radio links) and clears the anti-replay window
+     * (when enabled).
+     *
+     */
+    void ResetLinkFrameCounters(void)
+    {
+        GetLinkFrameCounters().Reset();
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+        ResetReplayWindow();
+#endif
+    }
+
+    /**
+     * This method sets the link frame counters (for all supported radio links) to a given value and clears the
+     * anti-replay window (when enabled).
+     *
+     * @param[in] aFrameCounter  The new frame counter value.
+     *
+     */
+    void SetLinkFrameCounters(uint32_t aFrameCounter)
+    {
+        GetLinkFrameCounters().SetAll(aFrameCounter);
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+        ResetReplayWindow();
+#endif
+    }
+
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
     /**
      * This method gets the link ACK frame counter value.
@@ -777,6 +854,9 @@ private:
             uint32_t               mMleFrameCounter;   ///< The MLE Frame Counter
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
             uint32_t mLinkAckFrameCounter; ///< The Link Ack Frame Counter
+#endif
+#if OPENTHREAD_CONFIG_MAC_RX_REPLAY_WINDOW_ENABLE
+            uint32_t mLinkFrameCounterWindow; ///< Anti-replay window bitmap (bit `n` marks counter `top - 1 - n`)
 #endif
         } mValid;
         struct
@@ -1349,6 +1429,9 @@ public:
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
         SetCslClockAccuracy(kCslWorstCrystalPpm);
         SetCslClockUncertainty(kCslWorstUncertainty);
+#endif
+#if OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE
+        mLowMarginTicks = 0;
 #endif
     }
 
@@ -1406,6 +1489,38 @@ public:
      */
     void SetCost(uint8_t aCost) { mCost = aCost; }
 
+    /**
+     * This method gets the digest of the Route TLV most recently processed from this router.
+     *
+     * @returns The digest of the Route TLV most recently processed from this router.
+     *
+     */
+    uint16_t GetLastRouteTlvDigest(void) const { return mLastRouteTlvDigest; }
+
+    /**
+     * This method sets the digest of the Route TLV most recently processed from this router.
+     *
+     * @param[in]  aDigest  The digest of the Route TLV most recently processed from this router.
+     *
+     */
+    void SetLastRouteTlvDigest(uint16_t aDigest) { mLastRouteTlvDigest = aDigest; }
+
+    /**
+     * This method gets the route generation number when a Route TLV from this router was last processed.
+     *
+     * @returns The route generation number when a Route TLV from this router was last processed.
+     *
+     */
+    uint16_t GetLastRouteGeneration(void) const { return mLastRouteGeneration; }
+
+    /**
+     * This method sets the route generation number when a Route TLV from this router was last processed.
+     *
+     * @param[in]  aGeneration  The route generation number.
+     *
+     */
+    void SetLastRouteGeneration(uint16_t aGeneration) { mLastRouteGeneration = aGeneration; }
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
     /**
      * This method get the CSL clock accuracy of this router.
@@ -1440,9 +1555,42 @@ public:
     void SetCslClockUncertainty(uint8_t aCslClockUncertainty) { mCslClockUncertainty = aCslClockUncertainty; }
 #endif
 
+#if OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE
+    /**
+     * This method updates the collapsed link margin tick counter for this router (with hysteresis).
+     *
+     * The counter increments while @p aLinkMargin is below the early drop threshold and resets only once the
+     * margin recovers above threshold plus hysteresis.
+     *
+     * @param[in] aLinkMargin  The current average link margin (in dB).
+     *
+     * @returns TRUE if the link margin has stayed collapsed long enough that the link should be dropped.
+     *
+     */
+    bool UpdateLowLinkMarginTicks(uint8_t aLinkMargin)
+    {
+        if (aLinkMargin < OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_THRESHOLD)
+        {
+            if (mLowMarginTicks < 0xff)
+            {
+                mLowMarginTicks++;
+            }
+        }
+        else if (aLinkMargin >= OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_THRESHOLD +
+                                    OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_HYSTERESIS)
+        {
+            mLowMarginTicks = 0;
+        }
+
+        return (mLowMarginTicks >= OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_TICKS);
+    }
+#endif
+
 private:
-    uint8_t mNextHop;            ///< The next hop towards this router
-    uint8_t mLinkQualityOut : 2; ///< The link quality out for this router
+    uint8_t  mNextHop;             ///< The next hop towards this router
+    uint16_t mLastRouteTlvDigest;  ///< The digest of the Route TLV most recently processed from this router
+    uint16_t mLastRouteGeneration; ///< The route generation number when a Route TLV was last processed
+    uint8_t  mLinkQualityOut : 2;  ///< The link quality out for this router
 
 #if OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
     uint8_t mCost; ///< The cost to this router via neighbor router
@@ -1453,6 +1601,9 @@ private:
     uint8_t mCslClockAccuracy;    ///< Crystal accuracy, in units of ± ppm.
     uint8_t mCslClockUncertainty; ///< Scheduling uncertainty, in units of 10 us.
 #endif
+#if OPENTHREAD_CONFIG_MLE_LINK_MARGIN_EARLY_DROP_ENABLE
+    uint8_t mLowMarginTicks; ///< Consecutive seconds with collapsed link margin
+#endif
 };
 
 } // namespace ot
@@ -58,7 +58,18 @@ ChannelManager::ChannelManager(Instance &aInstance)
     , mAutoSelectInterval(kDefaultAutoSelectInterval)
     , mAutoSelectEnabled(false)
     , mCcaFailureRateThreshold(kCcaFailureRateThreshold)
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    , mQualityTimer(aInstance, ChannelManager::HandleQualityTimer)
+    , mPrevTxTotal(0)
+    , mPrevTxRetry(0)
+    , mTxQualityValidMask(0)
+    , mCandidateChannel(0)
+    , mBetterChannelCount(0)
+#endif
 {
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    memset(mTxQuality, 0, sizeof(mTxQuality));
+#endif
 }
 
 void ChannelManager::RequestChannelChange(uint8_t aChannel)
@@ -288,6 +299,223 @@ exit:
 
     return error;
 }
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE
+
+void ChannelManager::HandleQualityTimer(Timer &aTimer)
+{
+    aTimer.Get<ChannelManager>().HandleQualityTimer();
+}
+
+void ChannelManager::HandleQualityTimer(void)
+{
+    SampleChannelQuality();
+    EvaluateChannelMigration();
+    StartQualityTimer();
+}
+
+void ChannelManager::StartQualityTimer(void)
+{
+    if (mAutoSelectEnabled)
+    {
+        mQualityTimer.Start(Time::SecToMsec(kQualitySampleInterval));
+    }
+    else
+    {
+        mQualityTimer.Stop();
+        mCandidateChannel   = 0;
+        mBetterChannelCount = 0;
+    }
+}
+
+void ChannelManager::SampleChannelQuality(void)
+{
+    uint8_t                channel = Get<Mac::Mac>().GetPanChannel();
+    uint8_t                index;
+    uint32_t               txTotal;
+    uint32_t               txRetry;
+    uint32_t               retxCost   = 0;
+    uint32_t               marginCost = 0;
+    uint32_t               cost;
+    uint32_t               marginSum    = 0;
+    uint16_t               numNeighbors = 0;
+    otNeighborInfoIterator iterator     = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    Neighbor::Info         neighInfo;
+
+    VerifyOrExit(!Get<Mle::Mle>().IsDisabled());
+    VerifyOrExit((channel >= Radio::kChannelMin) && (channel <= Radio::kChannelMax));
+
+    index = channel - Radio::kChannelMin;
+
+    // Retransmission rate since the previous sample, scaled so that one
+    // retry per transmitted frame maps to 0xffff.
+
+    txTotal = Get<Mac::Mac>().GetCounters().mTxTotal;
+    txRetry = Get<Mac::Mac>().GetCounters().mTxRetry;
+
+    if (txTotal > mPrevTxTotal)
+    {
+        retxCost = static_cast<uint32_t>(static_cast<uint64_t>(txRetry - mPrevTxRetry) * 0xffff /
+                                         (txTotal - mPrevTxTotal));
+
+        if (retxCost > 0xffff)
+        {
+            retxCost = 0xffff;
+        }
+    }
+
+    mPrevTxTotal = txTotal;
+    mPrevTxRetry = txRetry;
+
+    // Average link margin over all neighbors, mapped to a cost where
+    // margin at/above `kQualityMaxLinkMargin` contributes zero.
+
+    while (Get<NeighborTable>().GetNextNeighborInfo(iterator, neighInfo) == kErrorNone)
+    {
+        marginSum += LinkQualityInfo::ConvertRssToLinkMargin(Get<Mac::Mac>().GetNoiseFloor(), neighInfo.mAverageRssi);
+        numNeighbors++;
+    }
+
+    if (numNeighbors != 0)
+    {
+        uint32_t avgMargin = marginSum / numNeighbors;
+
+        if (avgMargin < kQualityMaxLinkMargin)
+        {
+            marginCost = (kQualityMaxLinkMargin - avgMargin) * 0xffff / kQualityMaxLinkMargin;
+        }
+    }
+
+    cost = (Get<Mac::Mac>().GetCcaFailureRate() + retxCost + marginCost) / 3;
+
+    if (mTxQualityValidMask & (1UL << index))
+    {
+        cost = (mTxQuality[index] * (kQualitySmoothingFactor - 1) + cost) / kQualitySmoothingFactor;
+    }
+    else
+    {
+        mTxQualityValidMask |= (1UL << index);
+    }
+
+    mTxQuality[index] = static_cast<uint16_t>(cost);
+
+    otLogInfoUtil("ChannelManager: Channel %d tx-quality cost 0x%04x (retx 0x%04x, margin 0x%04x)", channel,
+                  mTxQuality[index], retxCost, marginCost);
+
+exit:
+    return;
+}
+
+uint16_t ChannelManager::GetChannelCost(uint8_t aChannel) const
+{
+    uint32_t cost = Get<ChannelMonitor>().GetChannelOccupancy(aChannel);
+    uint8_t  index;
+
+    VerifyOrExit((aChannel >= Radio::kChannelMin) && (aChannel <= Radio::kChannelMax));
+
+    index = aChannel - Radio::kChannelMin;
+
+    if (mTxQualityValidMask & (1UL << index))
+    {
+        // Blend the passive occupancy measurement with the transmit
+        // quality observed while operating on the channel.
+        cost = (cost + mTxQuality[index]) / 2;
+    }
+
+exit:
+    return static_cast<uint16_t>(cost);
+}
+
+void ChannelManager::EvaluateChannelMigration(void)
+{
+    uint8_t  curChannel = Get<Mac::Mac>().GetPanChannel();
+    uint16_t curCost;
+    uint8_t  favoredBest    = 0;
+    uint16_t favoredCost    = 0xffff;
+    uint8_t  supportedBest  = 0;
+    uint16_t supportedCost  = 0xffff;
+    uint8_t  bestChannel;
+    uint16_t bestCost;
+
+    VerifyOrExit(mState == kStateIdle);
+    VerifyOrExit(!Get<Mle::Mle>().IsDisabled());
+    VerifyOrExit(Get<ChannelMonitor>().GetSampleCount() > kMinChannelMonitorSampleCount);
+
+    curCost = GetChannelCost(curChannel);
+
+    for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
+    {
+        uint16_t cost;
+
+        if (!mSupportedChannelMask.ContainsChannel(channel))
+        {
+            continue;
+        }
+
+        cost = GetChannelCost(channel);
+
+        if (cost < supportedCost)
+        {
+            supportedBest = channel;
+            supportedCost = cost;
+        }
+
+        if (mFavoredChannelMask.ContainsChannel(channel) && (cost < favoredCost))
+        {
+            favoredBest = channel;
+            favoredCost = cost;
+        }
+    }
+
+    bestChannel = favoredBest;
+    bestCost    = favoredCost;
+
+    // Prefer favored channels unless the best favored channel is worse
+    // than the best overall by at least `kThresholdToSkipFavored`.
+
+    if ((favoredBest == 0) || ((favoredCost >= kThresholdToSkipFavored) &&
+                               (supportedCost < favoredCost - kThresholdToSkipFavored)))
+    {
+        bestChannel = supportedBest;
+        bestCost    = supportedCost;
+    }
+
+    VerifyOrExit(bestChannel != 0);
+
+    if ((bestChannel != curChannel) && (bestCost < curCost) &&
+        (static_cast<uint16_t>(curCost - bestCost) >= kThresholdToChangeChannel))
+    {
+        if (bestChannel == mCandidateChannel)
+        {
+            mBetterChannelCount++;
+        }
+        else
+        {
+            mCandidateChannel   = bestChannel;
+            mBetterChannelCount = 1;
+        }
+
+        otLogInfoUtil("ChannelManager: Channel %d cost 0x%04x beats current %d cost 0x%04x (%d/%d)", bestChannel,
+                      bestCost, curChannel, curCost, mBetterChannelCount, kQualityHysteresisCount);
+
+        if (mBetterChannelCount >= kQualityHysteresisCount)
+        {
+            mCandidateChannel   = 0;
+            mBetterChannelCount = 0;
+            RequestChannelChange(bestChannel);
+        }
+    }
+    else
+    {
+        mCandidateChannel   = 0;
+        mBetterChannelCount = 0;
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE
+
 #endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 
 void ChannelManager::StartAutoSelectTimer(void)
@@ -314,6 +542,9 @@ void ChannelManager::SetAutoChannelSelectionEnabled(bool aEnabled)
         mAutoSelectEnabled = aEnabled;
         IgnoreError(RequestChannelSelect(false));
         StartAutoSelectTimer();
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+        StartQualityTimer();
+#endif
     }
 }
 
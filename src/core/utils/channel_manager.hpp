@@ -44,6 +44,7 @@
 #include "common/non_copyable.hpp"
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
+#include "radio/radio.hpp"
 
 namespace ot {
 namespace Utils {
@@ -240,6 +241,23 @@ public:
      */
     void SetCcaFailureRateThreshold(uint16_t aThreshold);
 
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    /**
+     * This method gets the combined quality cost of a given channel.
+     *
+     * The cost blends the `ChannelMonitor` occupancy rate with the smoothed transmit quality score (CCA failure
+     * rate, retransmission rate, and neighbor link margins) collected while operating on the channel. For channels
+     * the device has not yet operated on, the cost is the occupancy rate alone. Value 0 maps to best and 0xffff to
+     * worst quality.
+     *
+     * @param[in] aChannel   The channel to get the cost of.
+     *
+     * @returns The combined quality cost of @p aChannel.
+     *
+     */
+    uint16_t GetChannelCost(uint8_t aChannel) const;
+#endif
+
 private:
     // Retry interval to resend Pending Dataset in case of tx failure (in ms).
     static constexpr uint32_t kPendingDatasetTxRetryInterval = 20000;
@@ -285,6 +303,29 @@ private:
     bool  ShouldAttemptChannelChange(void);
 #endif
 
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    // Interval between two channel quality samples (in seconds).
+    static constexpr uint32_t kQualitySampleInterval = OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SAMPLE_INTERVAL;
+
+    // Number of consecutive samples the same channel must win before a change is scheduled.
+    static constexpr uint8_t kQualityHysteresisCount = OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_HYSTERESIS_COUNT;
+
+    // Average neighbor link margin (in dB) at or above which the link margin contributes no cost.
+    static constexpr uint8_t kQualityMaxLinkMargin = 50;
+
+    // Exponential smoothing factor for the per-channel transmit quality score (weight `1/kQualitySmoothingFactor`
+    // given to the latest sample).
+    static constexpr uint8_t kQualitySmoothingFactor = 4;
+
+    static constexpr uint8_t kNumChannels = Radio::kChannelMax - Radio::kChannelMin + 1;
+
+    static void HandleQualityTimer(Timer &aTimer);
+    void        HandleQualityTimer(void);
+    void        StartQualityTimer(void);
+    void        SampleChannelQuality(void);
+    void        EvaluateChannelMigration(void);
+#endif
+
     Mac::ChannelMask mSupportedChannelMask;
     Mac::ChannelMask mFavoredChannelMask;
     uint16_t         mDelay;
@@ -294,6 +335,15 @@ private:
     uint32_t         mAutoSelectInterval;
     bool             mAutoSelectEnabled;
     uint16_t         mCcaFailureRateThreshold;
+#if OPENTHREAD_CONFIG_CHANNEL_MANAGER_QUALITY_SCORING_ENABLE && OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    TimerMilli mQualityTimer;
+    uint32_t   mPrevTxTotal;
+    uint32_t   mPrevTxRetry;
+    uint32_t   mTxQualityValidMask;
+    uint16_t   mTxQuality[kNumChannels];
+    uint8_t    mCandidateChannel;
+    uint8_t    mBetterChannelCount;
+#endif
 };
 
 /**
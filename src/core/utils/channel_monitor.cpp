@@ -63,6 +63,9 @@ ChannelMonitor::ChannelMonitor(Instance &aInstance)
     , mChannelMaskIndex(0)
     , mSampleCount(0)
     , mTimer(aInstance, ChannelMonitor::HandleTimer)
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    , mBatchScanActive(false)
+#endif
 {
     memset(mChannelOccupancy, 0, sizeof(mChannelOccupancy));
 }
@@ -73,7 +76,11 @@ Error ChannelMonitor::Start(void)
 
     VerifyOrExit(!IsRunning(), error = kErrorAlready);
     Clear();
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    StartBatchScan();
+#else
     mTimer.Start(kTimerInterval);
+#endif
     otLogDebgUtil("ChannelMonitor: Starting");
 
 exit:
@@ -86,6 +93,10 @@ Error ChannelMonitor::Stop(void)
 
     VerifyOrExit(IsRunning(), error = kErrorAlready);
     mTimer.Stop();
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    // Any in-flight batch report is ignored once the flag is cleared.
+    mBatchScanActive = false;
+#endif
     otLogDebgUtil("ChannelMonitor: Stopping");
 
 exit:
@@ -187,6 +198,71 @@ void ChannelMonitor::HandleEnergyScanResult(Mac::EnergyScanResult *aResult)
     }
 }
 
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+void ChannelMonitor::StartBatchScan(void)
+{
+    uint32_t channelMask = 0;
+
+    for (uint32_t mask : mScanChannelMasks)
+    {
+        channelMask |= mask;
+    }
+
+    if (Get<Radio>().EnergyScanBatch(channelMask, kSampleInterval, kReportSampleCount, kRssiThreshold) == kErrorNone)
+    {
+        mBatchScanActive = true;
+    }
+    else
+    {
+        // The radio does not support batched scanning, fall back to
+        // sampling from the host using the timer.
+        otLogNoteUtil("ChannelMonitor: Batched scan unsupported, sampling from host");
+        mTimer.Start(kTimerInterval);
+    }
+}
+
+void ChannelMonitor::HandleEnergyScanBatchDone(uint32_t aChannelMask, const uint16_t *aAboveThresholdCounts)
+{
+    uint8_t index = 0;
+
+    VerifyOrExit(mBatchScanActive);
+
+    for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
+    {
+        uint32_t average;
+        uint32_t newValue;
+
+        if ((aChannelMask & (1UL << channel)) == 0)
+        {
+            continue;
+        }
+
+        average  = mChannelOccupancy[channel - Radio::kChannelMin];
+        newValue = kMaxOccupancy * aAboveThresholdCounts[index++] / kReportSampleCount;
+
+        // Fold the aggregated report into the average as `kReportSampleCount`
+        // samples of the batch occupancy rate, using the same window logic as
+        // the per-sample update in `HandleEnergyScanResult()`.
+
+        for (uint32_t sample = 0; sample < kReportSampleCount; sample++)
+        {
+            uint32_t weight = ((mSampleCount + sample) >= kSampleWindow) ? (kSampleWindow - 1) : (mSampleCount + sample);
+
+            average = (average * weight + newValue) / (weight + 1);
+        }
+
+        mChannelOccupancy[channel - Radio::kChannelMin] = static_cast<uint16_t>(average);
+    }
+
+    mSampleCount += kReportSampleCount;
+    LogResults();
+    StartBatchScan();
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+
 void ChannelMonitor::LogResults(void)
 {
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO) && (OPENTHREAD_CONFIG_LOG_UTIL == 1)
@@ -130,7 +130,24 @@ public:
      * @returns TRUE if the Channel Monitoring operation is running, FALSE otherwise.
      *
      */
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    bool IsRunning(void) const { return mBatchScanActive || mTimer.IsRunning(); }
+#else
     bool IsRunning(void) const { return mTimer.IsRunning(); }
+#endif
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    /**
+     * This method handles a batched energy scan report from the radio (invoked from
+     * `otPlatRadioEnergyScanBatchDone()`).
+     *
+     * @param[in] aChannelMask           The channel mask the batch was run on.
+     * @param[in] aAboveThresholdCounts  Per-channel counts of samples at or above the RSSI threshold, with one
+     *                                   entry per set bit in @p aChannelMask, ordered from the lowest channel.
+     *
+     */
+    void HandleEnergyScanBatchDone(uint32_t aChannelMask, const uint16_t *aAboveThresholdCounts);
+#endif
 
     /**
      * This method clears all currently stored data.
@@ -192,12 +209,18 @@ private:
     static constexpr uint32_t kTimerInterval     = (kSampleInterval / kNumChannelMasks);
     static constexpr uint16_t kMaxJitterInterval = 4096;
     static constexpr uint32_t kMaxOccupancy      = 0xffff;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    static constexpr uint16_t kReportSampleCount = OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_SAMPLES_PER_REPORT;
+#endif
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
     static void HandleEnergyScanResult(Mac::EnergyScanResult *aResult, void *aContext);
     void        HandleEnergyScanResult(Mac::EnergyScanResult *aResult);
     void        LogResults(void);
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    void StartBatchScan(void);
+#endif
 
     static const uint32_t mScanChannelMasks[kNumChannelMasks];
 
@@ -205,6 +228,9 @@ private:
     uint32_t   mSampleCount : 29;
     uint16_t   mChannelOccupancy[kNumChannels];
     TimerMilli mTimer;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_OFFLOAD_ENABLE
+    bool mBatchScanActive;
+#endif
 };
 
 /**
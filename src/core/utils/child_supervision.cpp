@@ -105,13 +105,29 @@ void ChildSupervisor::UpdateOnSend(Child &aChild)
     aChild.ResetSecondsSinceLastSupervision();
 }
 
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_BUCKETING_ENABLE
+uint16_t ChildSupervisor::GetSupervisionSlot(const Child &aChild) const
+{
+    return Get<ChildTable>().GetChildIndex(aChild) % kNumBuckets;
+}
+#endif
+
 void ChildSupervisor::HandleTimeTick(void)
 {
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
     {
+        uint16_t threshold = mSupervisionInterval;
+
         child.IncrementSecondsSinceLastSupervision();
 
-        if ((child.GetSecondsSinceLastSupervision() >= mSupervisionInterval) && !child.IsRxOnWhenIdle())
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_BUCKETING_ENABLE
+        // Stagger children that became due at the same time across
+        // consecutive ticks, deterministically by child table index, so
+        // the supervision transmissions do not burst within one tick.
+        threshold += GetSupervisionSlot(child);
+#endif
+
+        if ((child.GetSecondsSinceLastSupervision() >= threshold) && !child.IsRxOnWhenIdle())
         {
             SendMessage(child);
         }
@@ -161,6 +161,12 @@ public:
 private:
     static constexpr uint16_t kDefaultSupervisionInterval = OPENTHREAD_CONFIG_CHILD_SUPERVISION_INTERVAL; // (seconds)
 
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_BUCKETING_ENABLE
+    static constexpr uint16_t kNumBuckets = OPENTHREAD_CONFIG_CHILD_SUPERVISION_NUM_BUCKETS;
+
+    uint16_t GetSupervisionSlot(const Child &aChild) const;
+#endif
+
     void SendMessage(Child &aChild);
     void CheckState(void);
     void HandleTimeTick(void);
@@ -0,0 +1,204 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the coex monitor module.
+ */
+
+#include "coex_monitor.hpp"
+
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+
+#include "common/code_utils.hpp"
+#include "common/locator_getters.hpp"
+#include "common/logging.hpp"
+#include "common/notifier.hpp"
+#include "radio/radio.hpp"
+
+namespace ot {
+namespace Utils {
+
+CoexMonitor::CoexMonitor(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mTimer(aInstance, CoexMonitor::HandleTimer)
+    , mWindowHead(0)
+    , mNumWindows(0)
+    , mHasLastMetrics(false)
+    , mAboveThreshold(false)
+{
+    memset(&mLastMetrics, 0, sizeof(mLastMetrics));
+    memset(mWindows, 0, sizeof(mWindows));
+}
+
+Error CoexMonitor::Start(void)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(!IsRunning(), error = kErrorAlready);
+
+    Clear();
+    SuccessOrExit(error = Get<Radio>().GetCoexMetrics(mLastMetrics));
+    mHasLastMetrics = true;
+
+    otLogDebgUtil("Coex monitor: Starting");
+    mTimer.Start(kSampleInterval);
+
+exit:
+    return error;
+}
+
+Error CoexMonitor::Stop(void)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(IsRunning(), error = kErrorAlready);
+
+    otLogDebgUtil("Coex monitor: Stopping");
+    mTimer.Stop();
+
+exit:
+    return error;
+}
+
+void CoexMonitor::Clear(void)
+{
+    mWindowHead     = 0;
+    mNumWindows     = 0;
+    mHasLastMetrics = false;
+    mAboveThreshold = false;
+    memset(mWindows, 0, sizeof(mWindows));
+}
+
+void CoexMonitor::HandleTimer(Timer &aTimer)
+{
+    aTimer.Get<CoexMonitor>().HandleTimer();
+}
+
+void CoexMonitor::HandleTimer(void)
+{
+    Sample();
+    mTimer.Start(kSampleInterval);
+}
+
+void CoexMonitor::Sample(void)
+{
+    otRadioCoexMetrics metrics;
+    Window             window;
+    bool               validDelta;
+
+    SuccessOrExit(Get<Radio>().GetCoexMetrics(metrics));
+
+    // The counters are cumulative. A decrease (or the radio flagging
+    // saturation) indicates the radio restarted its counters, in which
+    // case the delta cannot be computed and the new values become the
+    // baseline of the next window.
+
+    validDelta = mHasLastMetrics && !metrics.mStopped && (metrics.mNumTxRequest >= mLastMetrics.mNumTxRequest) &&
+                 (metrics.mNumRxRequest >= mLastMetrics.mNumRxRequest) &&
+                 (metrics.mNumGrantGlitch >= mLastMetrics.mNumGrantGlitch) &&
+                 (metrics.mNumTxGrantWaitTimeout >= mLastMetrics.mNumTxGrantWaitTimeout) &&
+                 (metrics.mNumRxGrantWaitTimeout >= mLastMetrics.mNumRxGrantWaitTimeout);
+
+    if (validDelta)
+    {
+        window.mGrantDenials = (metrics.mNumGrantGlitch - mLastMetrics.mNumGrantGlitch) +
+                               (metrics.mNumTxGrantWaitTimeout - mLastMetrics.mNumTxGrantWaitTimeout) +
+                               (metrics.mNumRxGrantWaitTimeout - mLastMetrics.mNumRxGrantWaitTimeout);
+        window.mRequests = (metrics.mNumTxRequest - mLastMetrics.mNumTxRequest) +
+                           (metrics.mNumRxRequest - mLastMetrics.mNumRxRequest);
+
+        mWindows[mWindowHead] = window;
+        mWindowHead           = (mWindowHead + 1) % kHistorySize;
+
+        if (mNumWindows < kHistorySize)
+        {
+            mNumWindows++;
+        }
+
+        if (window.mGrantDenials >= kGrantDenialThreshold)
+        {
+            if (!mAboveThreshold)
+            {
+                mAboveThreshold = true;
+                otLogNoteUtil("Coex monitor: Grant denials %u (of %u requests) crossed threshold %u",
+                              window.mGrantDenials, window.mRequests, kGrantDenialThreshold);
+                Get<Notifier>().Signal(kEventCoexMetricsCrossedThreshold);
+            }
+        }
+        else
+        {
+            mAboveThreshold = false;
+        }
+    }
+
+    mLastMetrics    = metrics;
+    mHasLastMetrics = true;
+
+exit:
+    return;
+}
+
+Error CoexMonitor::GetStats(Stats &aStats) const
+{
+    Error    error         = kErrorNone;
+    uint64_t totalDenials  = 0;
+    uint64_t totalRequests = 0;
+
+    memset(&aStats, 0, sizeof(aStats));
+
+    VerifyOrExit(mNumWindows > 0, error = kErrorInvalidState);
+
+    aStats.mNumWindows      = mNumWindows;
+    aStats.mMinGrantDenials = mWindows[0].mGrantDenials;
+    aStats.mMinRequests     = mWindows[0].mRequests;
+
+    for (uint16_t i = 0; i < mNumWindows; i++)
+    {
+        const Window &window = mWindows[i];
+
+        totalDenials += window.mGrantDenials;
+        totalRequests += window.mRequests;
+
+        aStats.mMinGrantDenials = OT_MIN(aStats.mMinGrantDenials, window.mGrantDenials);
+        aStats.mMaxGrantDenials = OT_MAX(aStats.mMaxGrantDenials, window.mGrantDenials);
+        aStats.mMinRequests     = OT_MIN(aStats.mMinRequests, window.mRequests);
+        aStats.mMaxRequests     = OT_MAX(aStats.mMaxRequests, window.mRequests);
+    }
+
+    aStats.mAvgGrantDenials = static_cast<uint32_t>(totalDenials / mNumWindows);
+    aStats.mAvgRequests     = static_cast<uint32_t>(totalRequests / mNumWindows);
+
+exit:
+    return error;
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
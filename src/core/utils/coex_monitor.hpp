@@ -0,0 +1,180 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the coex monitor module.
+ */
+
+#ifndef COEX_MONITOR_HPP_
+#define COEX_MONITOR_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+
+#include <openthread/coex_monitor.h>
+#include <openthread/platform/radio.h>
+
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+#include "common/timer.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * @addtogroup utils-coex-monitor
+ *
+ * @brief
+ *   This module includes definitions for the coex monitor.
+ *
+ * @{
+ */
+
+/**
+ * This class implements the coex monitor logic.
+ *
+ * When running, every `kSampleInterval` the coex monitor pulls the cumulative radio coexistence metrics counters
+ * (see `otPlatRadioGetCoexMetrics()`) and computes the deltas against the previous pull, forming one aggregation
+ * window. The recent windows are retained in a small ring buffer, from which min/avg/max stats of grant denials
+ * (grant glitches plus tx/rx grant wait timeouts) and grant requests are provided. When the grant denials within
+ * one window reach `kGrantDenialThreshold`, `kEventCoexMetricsCrossedThreshold` is signaled through the `Notifier`
+ * (edge-triggered, re-armed by a window below the threshold).
+ *
+ */
+class CoexMonitor : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * The metrics sample interval in milliseconds.
+     *
+     */
+    static constexpr uint32_t kSampleInterval = OPENTHREAD_CONFIG_COEX_MONITOR_SAMPLE_INTERVAL;
+
+    /**
+     * The number of aggregation windows retained for min/avg/max stats.
+     *
+     */
+    static constexpr uint16_t kHistorySize = OPENTHREAD_CONFIG_COEX_MONITOR_HISTORY_SIZE;
+
+    /**
+     * The grant denial threshold (per aggregation window) for signaling the threshold crossed event.
+     *
+     */
+    static constexpr uint32_t kGrantDenialThreshold = OPENTHREAD_CONFIG_COEX_MONITOR_GRANT_DENIAL_THRESHOLD;
+
+    /**
+     * This type represents the aggregated stats over the retained windows.
+     *
+     */
+    typedef otCoexMonitorStats Stats;
+
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in]  aInstance     A reference to the OpenThread instance.
+     *
+     */
+    explicit CoexMonitor(Instance &aInstance);
+
+    /**
+     * This method starts the coex monitor operation.
+     *
+     * Once started, any previously collected data is cleared and the current counter values are taken as the
+     * baseline of the first aggregation window.
+     *
+     * @retval kErrorNone            Coex monitor started successfully.
+     * @retval kErrorAlready         Coex monitor has already been started.
+     * @retval kErrorNotImplemented  The radio does not provide coex metrics.
+     *
+     */
+    Error Start(void);
+
+    /**
+     * This method stops the coex monitor operation.
+     *
+     * @note After `Stop()`, the previously collected windows are still valid and can be read.
+     *
+     * @retval kErrorNone      Coex monitor stopped successfully.
+     * @retval kErrorAlready   Coex monitor has already been stopped.
+     *
+     */
+    Error Stop(void);
+
+    /**
+     * This method indicates whether the coex monitor operation is started and running.
+     *
+     * @returns TRUE if the coex monitor operation is running, FALSE otherwise.
+     *
+     */
+    bool IsRunning(void) const { return mTimer.IsRunning(); }
+
+    /**
+     * This method gets the aggregated stats over the retained windows.
+     *
+     * @param[out]  aStats  A reference to the stats structure to populate.
+     *
+     * @retval kErrorNone          Successfully retrieved the stats.
+     * @retval kErrorInvalidState  No aggregation window has completed yet.
+     *
+     */
+    Error GetStats(Stats &aStats) const;
+
+private:
+    // One aggregation window (deltas of the cumulative counters over one sample interval).
+    struct Window
+    {
+        uint32_t mGrantDenials; // Grant glitches + tx/rx grant wait timeouts.
+        uint32_t mRequests;     // Tx + rx grant requests.
+    };
+
+    void        Clear(void);
+    void        Sample(void);
+    static void HandleTimer(Timer &aTimer);
+    void        HandleTimer(void);
+
+    TimerMilli         mTimer;
+    otRadioCoexMetrics mLastMetrics;
+    Window             mWindows[kHistorySize];
+    uint16_t           mWindowHead;
+    uint16_t           mNumWindows;
+    bool               mHasLastMetrics;
+    bool               mAboveThreshold;
+};
+
+/**
+ * @}
+ */
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_COEX_MONITOR_ENABLE
+
+#endif // COEX_MONITOR_HPP_
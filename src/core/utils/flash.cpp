@@ -84,6 +84,10 @@ void Flash::Init(void)
 
     SanitizeFreeSpace();
 
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+    BuildDirectory();
+#endif
+
 exit:
     return;
 }
@@ -122,6 +126,40 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
     uint32_t     offset;
     RecordHeader record;
 
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+    {
+        const DirectoryEntry *entry = FindDirectoryEntry(aKey);
+
+        if (entry == nullptr)
+        {
+            // Unless the directory has overflowed it covers all keys,
+            // so a missing entry means the key has no valid record.
+            VerifyOrExit(mDirectoryOverflowed);
+        }
+        else if (!entry->mHasMultiple)
+        {
+            VerifyOrExit(aIndex == 0);
+
+            otPlatFlashRead(&GetInstance(), mSwapIndex, entry->mOffset, &record, sizeof(record));
+
+            if (aValue && aValueLength)
+            {
+                uint16_t readLength = *aValueLength;
+
+                if (readLength > record.GetLength())
+                {
+                    readLength = record.GetLength();
+                }
+
+                otPlatFlashRead(&GetInstance(), mSwapIndex, entry->mOffset + sizeof(record), aValue, readLength);
+            }
+
+            valueLength = record.GetLength();
+            ExitNow(error = kErrorNone);
+        }
+    }
+#endif
+
     for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -157,6 +195,9 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
         index++;
     }
 
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+exit:
+#endif
     if (aValueLength)
     {
         *aValueLength = valueLength;
@@ -198,6 +239,23 @@ Error Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aVa
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+    UpdateDirectory(aKey, aFirst, mSwapUsed);
+#endif
+
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+    // Start background compaction when the usage crosses the
+    // threshold, so the eventual synchronous `Swap()` on a full area
+    // is avoided. Checking the crossing (rather than the level alone)
+    // ensures compaction is started at most once per fill cycle.
+
+    if (!mCompactInProgress && (mSwapUsed < GetCompactThreshold()) &&
+        (mSwapUsed + record.GetSize() >= GetCompactThreshold()))
+    {
+        StartCompact();
+    }
+#endif
+
     mSwapUsed += record.GetSize();
 
 exit:
@@ -229,6 +287,12 @@ void Flash::Swap(void)
     uint32_t dstOffset = kSwapMarkerSize;
     Record   record;
 
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+    // The destination area is about to be erased, discarding any
+    // partial background compaction progress.
+    mCompactInProgress = false;
+#endif
+
     otPlatFlashErase(&GetInstance(), dstIndex);
 
     for (uint32_t srcOffset = kSwapMarkerSize; srcOffset < mSwapUsed; srcOffset += record.GetSize())
@@ -253,6 +317,10 @@ exit:
 
     mSwapIndex = dstIndex;
     mSwapUsed  = dstOffset;
+
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+    BuildDirectory();
+#endif
 }
 
 Error Flash::Delete(uint16_t aKey, int aIndex)
@@ -295,6 +363,24 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
         index++;
     }
 
+    if (error == kErrorNone)
+    {
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+        BuildDirectory();
+#endif
+
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+        // A record already copied to the destination area may have
+        // been the one just deleted, so any in-progress compaction is
+        // restarted from scratch.
+
+        if (mCompactInProgress)
+        {
+            StartCompact();
+        }
+#endif
+    }
+
     return error;
 }
 
@@ -305,8 +391,161 @@ void Flash::Wipe(void)
 
     mSwapIndex = 0;
     mSwapUsed  = sizeof(sSwapActive);
+
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+    mDirectoryLength     = 0;
+    mDirectoryOverflowed = false;
+#endif
+
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+    mCompactInProgress = false;
+#endif
+}
+
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+
+const Flash::DirectoryEntry *Flash::FindDirectoryEntry(uint16_t aKey) const
+{
+    const DirectoryEntry *entry = nullptr;
+
+    for (uint8_t i = 0; i < mDirectoryLength; i++)
+    {
+        if (mDirectory[i].mKey == aKey)
+        {
+            entry = &mDirectory[i];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+Flash::DirectoryEntry *Flash::FindDirectoryEntry(uint16_t aKey)
+{
+    return const_cast<DirectoryEntry *>(const_cast<const Flash *>(this)->FindDirectoryEntry(aKey));
+}
+
+void Flash::UpdateDirectory(uint16_t aKey, bool aFirst, uint32_t aOffset)
+{
+    DirectoryEntry *entry = FindDirectoryEntry(aKey);
+
+    if (entry == nullptr)
+    {
+        if (mDirectoryLength >= kDirectorySize)
+        {
+            mDirectoryOverflowed = true;
+        }
+        else
+        {
+            entry               = &mDirectory[mDirectoryLength++];
+            entry->mKey         = aKey;
+            entry->mOffset      = aOffset;
+            entry->mHasMultiple = !aFirst;
+        }
+    }
+    else if (aFirst)
+    {
+        // A later "first" record supersedes the earlier values for the
+        // key when scanning, matching the last-match-wins behavior of
+        // `Get()`. `mHasMultiple` is deliberately left as-is: once a
+        // key has held multiple values, reads keep using the scan.
+        entry->mOffset = aOffset;
+    }
+    else
+    {
+        entry->mHasMultiple = true;
+    }
+}
+
+void Flash::BuildDirectory(void)
+{
+    RecordHeader record;
+
+    mDirectoryLength     = 0;
+    mDirectoryOverflowed = false;
+
+    for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+
+        if (record.IsValid())
+        {
+            UpdateDirectory(record.GetKey(), record.IsFirst(), offset);
+        }
+    }
 }
 
+#endif // OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+
+void Flash::HandleCompactTask(Tasklet &aTasklet)
+{
+    static_cast<Flash *>(static_cast<TaskletContext &>(aTasklet).GetContext())->ProcessCompact();
+}
+
+void Flash::StartCompact(void)
+{
+    otPlatFlashErase(&GetInstance(), !mSwapIndex);
+
+    mCompactSrcOffset  = kSwapMarkerSize;
+    mCompactDstOffset  = kSwapMarkerSize;
+    mCompactInProgress = true;
+    mCompactTask.Post();
+}
+
+void Flash::ProcessCompact(void)
+{
+    uint8_t dstIndex = !mSwapIndex;
+    Record  record;
+
+    VerifyOrExit(mCompactInProgress);
+
+    for (uint8_t numCopied = 0; numCopied < kCompactRecordsPerPass; numCopied++)
+    {
+        if (mCompactSrcOffset >= mSwapUsed)
+        {
+            // All records are copied; activate the destination area.
+
+            otPlatFlashWrite(&GetInstance(), dstIndex, 0, &sSwapActive, sizeof(sSwapActive));
+            otPlatFlashWrite(&GetInstance(), mSwapIndex, 0, &sSwapInactive, sizeof(sSwapInactive));
+
+            mSwapIndex         = dstIndex;
+            mSwapUsed          = mCompactDstOffset;
+            mCompactInProgress = false;
+
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+            BuildDirectory();
+#endif
+            ExitNow();
+        }
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, mCompactSrcOffset, &record, sizeof(RecordHeader));
+
+        if (!record.IsAddBeginSet())
+        {
+            mCompactSrcOffset = mSwapUsed;
+            continue;
+        }
+
+        if (record.IsValid() && !DoesValidRecordExist(mCompactSrcOffset + record.GetSize(), record.GetKey()))
+        {
+            otPlatFlashRead(&GetInstance(), mSwapIndex, mCompactSrcOffset, &record, record.GetSize());
+            otPlatFlashWrite(&GetInstance(), dstIndex, mCompactDstOffset, &record, record.GetSize());
+            mCompactDstOffset += record.GetSize();
+        }
+
+        mCompactSrcOffset += record.GetSize();
+    }
+
+    mCompactTask.Post();
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
@@ -41,6 +41,7 @@
 #include "common/debug.hpp"
 #include "common/error.hpp"
 #include "common/locator.hpp"
+#include "common/tasklet.hpp"
 
 namespace ot {
 
@@ -57,6 +58,16 @@ public:
      */
     explicit Flash(Instance &aInstance)
         : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+        , mDirectoryLength(0)
+        , mDirectoryOverflowed(false)
+#endif
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+        , mCompactTask(aInstance, HandleCompactTask, this)
+        , mCompactSrcOffset(0)
+        , mCompactDstOffset(0)
+        , mCompactInProgress(false)
+#endif
     {
     }
 
@@ -218,9 +229,49 @@ private:
     void  SanitizeFreeSpace(void);
     void  Swap(void);
 
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+    static constexpr uint8_t kDirectorySize = OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_SIZE;
+
+    // An entry maps a key to the offset of its last valid "first"
+    // record in the active swap area. A key with multiple values
+    // (`mHasMultiple`) falls back to scanning the records.
+    struct DirectoryEntry
+    {
+        uint32_t mOffset;
+        uint16_t mKey;
+        bool     mHasMultiple;
+    };
+
+    const DirectoryEntry *FindDirectoryEntry(uint16_t aKey) const;
+    DirectoryEntry *      FindDirectoryEntry(uint16_t aKey);
+    void                  UpdateDirectory(uint16_t aKey, bool aFirst, uint32_t aOffset);
+    void                  BuildDirectory(void);
+#endif
+
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+    static constexpr uint8_t kCompactRecordsPerPass = OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_RECORDS_PER_PASS;
+
+    static void HandleCompactTask(Tasklet &aTasklet);
+    void        StartCompact(void);
+    void        ProcessCompact(void);
+
+    uint32_t GetCompactThreshold(void) const { return mSwapSize - (mSwapSize / 4); }
+#endif
+
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
+#if OPENTHREAD_CONFIG_FLASH_KEY_DIRECTORY_ENABLE
+    DirectoryEntry mDirectory[kDirectorySize];
+    uint8_t        mDirectoryLength;
+    bool           mDirectoryOverflowed;
+#endif
+#if OPENTHREAD_CONFIG_FLASH_BACKGROUND_COMPACT_ENABLE
+    TaskletContext mCompactTask;
+    uint32_t       mCompactSrcOffset;
+    uint32_t       mCompactDstOffset;
+    bool           mCompactInProgress;
+#endif
 };
 
 } // namespace ot
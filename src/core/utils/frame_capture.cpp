@@ -0,0 +1,157 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the MAC frame capture tap.
+ */
+
+#include "frame_capture.hpp"
+
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/timer.hpp"
+
+namespace ot {
+namespace Utils {
+
+FrameCapture::FrameCapture(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mEnabled(false)
+{
+    Clear();
+}
+
+void FrameCapture::Clear(void)
+{
+    mWriteIndex    = 0;
+    mReadIndex     = 0;
+    mUsed          = 0;
+    mCapturedCount = 0;
+    mDroppedCount  = 0;
+}
+
+void FrameCapture::SetEnabled(bool aEnable)
+{
+    VerifyOrExit(mEnabled != aEnable);
+
+    mEnabled = aEnable;
+
+    if (mEnabled)
+    {
+        Clear();
+    }
+
+exit:
+    return;
+}
+
+void FrameCapture::HandleFrame(const Mac::Frame &aFrame, bool aIsTx)
+{
+    RecordHeader header;
+    uint16_t     length = aFrame.GetLength();
+    uint32_t     now;
+
+    OT_UNUSED_VARIABLE(aIsTx);
+
+    VerifyOrExit(mEnabled);
+    VerifyOrExit(sizeof(header) + length <= static_cast<uint16_t>(kBufferSize - mUsed), mDroppedCount++);
+
+    now = TimerMilli::GetNow().GetValue();
+
+    header.mSeconds        = now / 1000;
+    header.mMicroseconds   = (now % 1000) * 1000;
+    header.mCapturedLength = length;
+    header.mOriginalLength = length;
+
+    WriteBytes(reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+    WriteBytes(aFrame.GetPsdu(), length);
+    mCapturedCount++;
+
+exit:
+    return;
+}
+
+Error FrameCapture::Read(uint8_t *aBuffer, uint16_t &aLength)
+{
+    Error        error = kErrorNone;
+    RecordHeader header;
+    uint16_t     recordLength;
+
+    VerifyOrExit(mUsed > 0, error = kErrorNotFound);
+
+    OT_ASSERT(mUsed >= sizeof(header));
+
+    PeekBytes(reinterpret_cast<uint8_t *>(&header), sizeof(header));
+
+    recordLength = static_cast<uint16_t>(sizeof(header) + header.mCapturedLength);
+    VerifyOrExit(aLength >= recordLength, aLength = recordLength; error = kErrorNoBufs);
+
+    ReadBytes(aBuffer, recordLength);
+    aLength = recordLength;
+
+exit:
+    return error;
+}
+
+void FrameCapture::WriteBytes(const uint8_t *aData, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        mBuffer[mWriteIndex] = aData[i];
+        mWriteIndex          = (mWriteIndex + 1) % kBufferSize;
+    }
+
+    mUsed += aLength;
+}
+
+void FrameCapture::PeekBytes(uint8_t *aBuffer, uint16_t aLength) const
+{
+    uint16_t index = mReadIndex;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aBuffer[i] = mBuffer[index];
+        index      = (index + 1) % kBufferSize;
+    }
+}
+
+void FrameCapture::ReadBytes(uint8_t *aBuffer, uint16_t aLength)
+{
+    PeekBytes(aBuffer, aLength);
+    mReadIndex = (mReadIndex + aLength) % kBufferSize;
+    mUsed -= aLength;
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
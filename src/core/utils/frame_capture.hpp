@@ -0,0 +1,166 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the MAC frame capture tap.
+ */
+
+#ifndef FRAME_CAPTURE_HPP_
+#define FRAME_CAPTURE_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+
+#include <openthread/platform/toolchain.h>
+
+#include "common/error.hpp"
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+#include "mac/mac_frame.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * This class implements the MAC frame capture tap.
+ *
+ * Transmitted and received MAC frames are copied into a fixed-size ring buffer with pcap record framing (pcap
+ * link type `LINKTYPE_IEEE802_15_4_WITHFCS`). The capture is lossy by design: when the ring has no room for a new
+ * frame, the frame is dropped and counted, so capture never slows down MAC processing or forwarding. A host-side
+ * consumer drains whole records using `Read()`.
+ *
+ */
+class FrameCapture : public InstanceLocator, private NonCopyable
+{
+public:
+    static constexpr uint16_t kBufferSize = OPENTHREAD_CONFIG_FRAME_CAPTURE_BUFFER_SIZE; ///< Ring buffer size.
+
+    /**
+     * This constructor initializes the `FrameCapture` object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit FrameCapture(Instance &aInstance);
+
+    /**
+     * This method indicates whether the frame capture is enabled.
+     *
+     * @returns TRUE if the frame capture is enabled, FALSE otherwise.
+     *
+     */
+    bool IsEnabled(void) const { return mEnabled; }
+
+    /**
+     * This method enables or disables the frame capture.
+     *
+     * Enabling the capture clears the ring buffer and resets the captured/dropped frame counters (starting a fresh
+     * capture session).
+     *
+     * @param[in] aEnable   TRUE to enable, FALSE to disable.
+     *
+     */
+    void SetEnabled(bool aEnable);
+
+    /**
+     * This method appends a MAC frame to the capture ring buffer.
+     *
+     * The frame is silently dropped (and the dropped frame counter incremented) when the capture is disabled or the
+     * ring buffer has no room for the frame.
+     *
+     * @param[in] aFrame   The MAC frame to capture.
+     * @param[in] aIsTx    TRUE if @p aFrame is a transmitted frame, FALSE if it is a received frame.
+     *
+     */
+    void HandleFrame(const Mac::Frame &aFrame, bool aIsTx);
+
+    /**
+     * This method reads (and removes) the oldest captured record from the ring buffer.
+     *
+     * Each record is a 16-byte pcap record header (`ts_sec`, `ts_usec`, `incl_len`, `orig_len` - all little-endian
+     * host byte order) followed by the frame PSDU.
+     *
+     * @param[out]    aBuffer   A pointer to a buffer to output the record.
+     * @param[inout]  aLength   On entry, the size of @p aBuffer (in bytes). On exit, the record length (in bytes).
+     *
+     * @retval kErrorNone       Successfully read the oldest record into @p aBuffer.
+     * @retval kErrorNotFound   The ring buffer is empty.
+     * @retval kErrorNoBufs     @p aBuffer is too small (@p aLength is updated to the required record length and the
+     *                          record is retained in the ring buffer).
+     *
+     */
+    Error Read(uint8_t *aBuffer, uint16_t &aLength);
+
+    /**
+     * This method returns the number of frames captured into the ring buffer since the capture was enabled.
+     *
+     * @returns The captured frame count.
+     *
+     */
+    uint32_t GetCapturedCount(void) const { return mCapturedCount; }
+
+    /**
+     * This method returns the number of frames dropped (due to a full ring buffer) since the capture was enabled.
+     *
+     * @returns The dropped frame count.
+     *
+     */
+    uint32_t GetDroppedCount(void) const { return mDroppedCount; }
+
+private:
+    OT_TOOL_PACKED_BEGIN
+    struct RecordHeader
+    {
+        uint32_t mSeconds;        // pcap `ts_sec`.
+        uint32_t mMicroseconds;   // pcap `ts_usec`.
+        uint32_t mCapturedLength; // pcap `incl_len`.
+        uint32_t mOriginalLength; // pcap `orig_len`.
+    } OT_TOOL_PACKED_END;
+
+    void Clear(void);
+    void WriteBytes(const uint8_t *aData, uint16_t aLength);
+    void PeekBytes(uint8_t *aBuffer, uint16_t aLength) const;
+    void ReadBytes(uint8_t *aBuffer, uint16_t aLength);
+
+    bool     mEnabled;
+    uint16_t mWriteIndex;
+    uint16_t mReadIndex;
+    uint16_t mUsed;
+    uint32_t mCapturedCount;
+    uint32_t mDroppedCount;
+    uint8_t  mBuffer[kBufferSize];
+};
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_FRAME_CAPTURE_ENABLE
+
+#endif // FRAME_CAPTURE_HPP_
@@ -58,15 +58,23 @@ Heap::Heap(void)
     super.SetNext(BlockOffset(first));
     first.SetNext(BlockOffset(guard));
 
+    for (uint16_t i = 0; i < kNumSmallBlockLists; i++)
+    {
+        mSmallList[i] = SmallListEnd(i);
+    }
+
+    memset(mAllocHistogram, 0, sizeof(mAllocHistogram));
+
     mMemory.mFreeSize = kFirstBlockSize;
 }
 
 void *Heap::CAlloc(size_t aCount, size_t aSize)
 {
     void *   ret  = nullptr;
-    Block *  prev = nullptr;
     Block *  curr = nullptr;
     uint16_t size = static_cast<uint16_t>(aCount * aSize);
+    uint16_t listIndex;
+    bool     isSmall;
 
     VerifyOrExit(size);
 
@@ -74,18 +82,42 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
     size &= ~(kAlignSize - 1);
     size += kBlockRemainderSize;
 
-    prev = &BlockSuper();
-    curr = &BlockNext(*prev);
+    isSmall = IsSmallBlockSize(size, listIndex);
+
+    mAllocHistogram[isSmall ? listIndex : kNumSmallBlockLists]++;
 
-    while (curr->GetSize() < size)
+    if (isSmall)
     {
-        prev = curr;
-        curr = &BlockNext(*curr);
+        // Pop the first block from the matching (or next larger)
+        // small block list, if any.
+
+        for (uint16_t i = listIndex; i < kNumSmallBlockLists; i++)
+        {
+            if (!IsSmallListEnd(mSmallList[i]))
+            {
+                curr          = &BlockAt(mSmallList[i]);
+                mSmallList[i] = curr->GetNext();
+                break;
+            }
+        }
     }
 
-    VerifyOrExit(curr->IsFree());
+    if (curr == nullptr)
+    {
+        Block *prev = &BlockSuper();
 
-    prev->SetNext(curr->GetNext());
+        curr = &BlockNext(*prev);
+
+        while (curr->GetSize() < size)
+        {
+            prev = curr;
+            curr = &BlockNext(*curr);
+        }
+
+        VerifyOrExit(curr->IsFree());
+
+        prev->SetNext(curr->GetNext());
+    }
 
     if (curr->GetSize() > size + sizeof(Block))
     {
@@ -96,14 +128,7 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
         newBlock.SetSize(newBlockSize);
         newBlock.SetNext(0);
 
-        if (prev->GetSize() < newBlockSize)
-        {
-            BlockInsert(*prev, newBlock);
-        }
-        else
-        {
-            BlockInsert(BlockSuper(), newBlock);
-        }
+        InsertFreeBlock(newBlock);
 
         mMemory.mFreeSize -= sizeof(Block);
     }
@@ -144,77 +169,140 @@ Block &Heap::BlockPrev(const Block &aBlock)
     return *prev;
 }
 
-void Heap::Free(void *aPointer)
+void Heap::InsertFreeBlock(Block &aBlock)
 {
-    if (aPointer == nullptr)
+    uint16_t listIndex;
+
+    if (IsSmallBlockSize(aBlock.GetSize(), listIndex))
     {
-        return;
+        aBlock.SetNext(mSmallList[listIndex]);
+        mSmallList[listIndex] = BlockOffset(aBlock);
     }
+    else
+    {
+        BlockInsert(BlockSuper(), aBlock);
+    }
+}
 
-    Block &block = BlockOf(aPointer);
-    Block &right = BlockRight(block);
-
-    mMemory.mFreeSize += block.GetSize();
+void Heap::RemoveFreeBlock(Block &aBlock)
+{
+    uint16_t listIndex;
 
-    if (IsLeftFree(block))
+    if (IsSmallBlockSize(aBlock.GetSize(), listIndex))
     {
-        Block *prev = &BlockSuper();
-        Block *left = &BlockNext(*prev);
+        if (mSmallList[listIndex] == BlockOffset(aBlock))
+        {
+            mSmallList[listIndex] = aBlock.GetNext();
+        }
+        else
+        {
+            Block *prev = &BlockAt(mSmallList[listIndex]);
 
-        mMemory.mFreeSize += sizeof(Block);
+            while (prev->GetNext() != BlockOffset(aBlock))
+            {
+                prev = &BlockNext(*prev);
+            }
 
-        for (const uint16_t offset = block.GetLeftNext(); left->GetNext() != offset; left = &BlockNext(*left))
-        {
-            prev = left;
+            prev->SetNext(aBlock.GetNext());
         }
+    }
+    else
+    {
+        BlockPrev(aBlock).SetNext(aBlock.GetNext());
+    }
+
+    aBlock.SetNext(0);
+}
 
-        // Remove left from free list.
-        prev->SetNext(left->GetNext());
-        left->SetNext(0);
+Block &Heap::RemoveFreeBlockWithNext(uint16_t aNextOffset)
+{
+    Block *block = nullptr;
 
-        if (right.IsFree())
+    // The next offsets (and per-list end markers) are unique across
+    // all free blocks, so searching all the lists for a block with a
+    // matching next offset finds exactly the block identified by
+    // @p aNextOffset.
+
+    for (uint16_t i = 0; i < kNumSmallBlockLists; i++)
+    {
+        Block *prev = nullptr;
+
+        for (uint16_t offset = mSmallList[i]; !IsSmallListEnd(offset); offset = block->GetNext())
         {
-            mMemory.mFreeSize += sizeof(Block);
+            block = &BlockAt(offset);
 
-            if (right.GetSize() > left->GetSize())
-            {
-                for (const uint16_t offset = BlockOffset(right); prev->GetNext() != offset; prev = &BlockNext(*prev))
-                    ;
-            }
-            else
+            if (block->GetNext() == aNextOffset)
             {
-                prev = &BlockPrev(right);
+                if (prev == nullptr)
+                {
+                    mSmallList[i] = aNextOffset;
+                }
+                else
+                {
+                    prev->SetNext(aNextOffset);
+                }
+
+                ExitNow();
             }
 
-            // Remove right from free list.
-            prev->SetNext(right.GetNext());
-            right.SetNext(0);
+            prev = block;
+        }
+    }
+
+    {
+        Block *prev = &BlockSuper();
+
+        block = &BlockNext(*prev);
 
-            // Add size of right.
-            left->SetSize(left->GetSize() + right.GetSize() + sizeof(Block));
+        while (block->GetNext() != aNextOffset)
+        {
+            prev  = block;
+            block = &BlockNext(*block);
         }
 
-        // Add size of current block.
-        left->SetSize(left->GetSize() + block.GetSize() + sizeof(Block));
+        prev->SetNext(aNextOffset);
+    }
+
+exit:
+    block->SetNext(0);
+    return *block;
+}
 
-        BlockInsert(*prev, *left);
+void Heap::Free(void *aPointer)
+{
+    if (aPointer == nullptr)
+    {
+        return;
     }
-    else
+
+    Block &block  = BlockOf(aPointer);
+    Block *merged = &block;
+
+    mMemory.mFreeSize += block.GetSize();
+
+    if (IsLeftFree(block))
     {
+        Block &left = RemoveFreeBlockWithNext(block.GetLeftNext());
+
+        left.SetSize(left.GetSize() + block.GetSize() + sizeof(Block));
+        merged = &left;
+
+        mMemory.mFreeSize += sizeof(Block);
+    }
+
+    {
+        Block &right = BlockRight(*merged);
+
         if (right.IsFree())
         {
-            Block &prev = BlockPrev(right);
-            prev.SetNext(right.GetNext());
-            block.SetSize(block.GetSize() + right.GetSize() + sizeof(Block));
-            BlockInsert(prev, block);
+            RemoveFreeBlock(right);
+            merged->SetSize(merged->GetSize() + right.GetSize() + sizeof(Block));
 
             mMemory.mFreeSize += sizeof(Block);
         }
-        else
-        {
-            BlockInsert(BlockSuper(), block);
-        }
     }
+
+    InsertFreeBlock(*merged);
 }
 
 } // namespace Utils
@@ -172,10 +172,17 @@ private:
  *     | kAlignSize - 2 | kAlignSize | 4 + s1  | 4 + s2  | ... | 4 + s4  |   2    |
  *     +--------------------------------------------------------------------------+
  *
+ * Free blocks are tracked in segregated free lists: small blocks (up to `kNumSmallBlockLists` size classes, one
+ * exact size per class) go on per-class LIFO lists allowing O(1) allocation, while larger blocks stay on a single
+ * list sorted by size. Neighboring free blocks are coalesced immediately on `Free()`.
+ *
  */
 class Heap : private NonCopyable
 {
 public:
+    static constexpr uint16_t kNumSmallBlockLists = 8; ///< Number of small block size classes (segregated lists).
+    static constexpr uint16_t kNumHistogramBins   = kNumSmallBlockLists + 1; ///< Number of allocation histogram bins.
+
     /**
      * This constructor initializes a memory heap.
      *
@@ -226,6 +233,18 @@ public:
      */
     size_t GetFreeSize(void) const { return mMemory.mFreeSize; }
 
+    /**
+     * This method returns the histogram of allocation request sizes.
+     *
+     * Bin `i` (for `i < kNumSmallBlockLists`) counts allocation requests whose (aligned) block size maps to small
+     * block size class `i` (sizes growing by the heap alignment per class). The last bin counts all larger
+     * requests. Requests are counted whether or not the allocation succeeds.
+     *
+     * @returns A pointer to an array of `kNumHistogramBins` counters.
+     *
+     */
+    const uint32_t *GetAllocationHistogram(void) const { return mAllocHistogram; }
+
 private:
 #if OPENTHREAD_CONFIG_DTLS_ENABLE
     static constexpr uint16_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE;
@@ -239,9 +258,54 @@ private:
     static constexpr uint16_t kSuperBlockOffset   = kAlignSize - sizeof(uint16_t);
     static constexpr uint16_t kFirstBlockOffset   = kAlignSize * 2 - sizeof(uint16_t);
     static constexpr uint16_t kGuardBlockOffset   = kMemorySize - sizeof(uint16_t);
+    static constexpr uint16_t kSmallBlockSizeMax  = kBlockRemainderSize + (kNumSmallBlockLists - 1) * kAlignSize;
 
     static_assert(kMemorySize % kAlignSize == 0, "The heap memory size is not aligned to kAlignSize!");
 
+    /**
+     * This static method returns the end-of-list marker of the small block list at @p aListIndex.
+     *
+     * Block offsets are always even, so an odd value can never collide with a real block offset. The markers are
+     * additionally unique per list, which keeps the search for a free block by its stored next offset (used to
+     * locate a free left neighbor) unambiguous across all the lists.
+     *
+     * @param[in]   aListIndex  A small block list index.
+     *
+     * @returns The end-of-list marker for the list at @p aListIndex.
+     *
+     */
+    static uint16_t SmallListEnd(uint16_t aListIndex) { return static_cast<uint16_t>((aListIndex << 1) | 1); }
+
+    /**
+     * This static method indicates whether @p aOffset is an end-of-list marker of a small block list.
+     *
+     * @param[in]   aOffset     An offset (or marker) read from a free list link.
+     *
+     */
+    static bool IsSmallListEnd(uint16_t aOffset) { return (aOffset & 1) != 0; }
+
+    /**
+     * This static method maps a block size to its small block size class (if any).
+     *
+     * @param[in]   aSize       A block size in bytes.
+     * @param[out]  aListIndex  The small block list index for @p aSize (valid only when `true` is returned).
+     *
+     * @retval  true    @p aSize maps to a small block size class.
+     * @retval  false   @p aSize is larger than the largest small block size class.
+     *
+     */
+    static bool IsSmallBlockSize(uint16_t aSize, uint16_t &aListIndex)
+    {
+        bool isSmall = (aSize <= kSmallBlockSizeMax);
+
+        if (isSmall)
+        {
+            aListIndex = (aSize - kBlockRemainderSize) / kAlignSize;
+        }
+
+        return isSmall;
+    }
+
     /**
      * This method returns the block at offset @p aOffset.
      *
@@ -325,9 +389,9 @@ private:
     }
 
     /**
-     * This method inserts @p aBlock into the free block list.
+     * This method inserts @p aBlock into the sorted (large block) free list.
      *
-     * The free block list is single linked and is sorted by size from minimal to maximum.
+     * The list is single linked and is sorted by size from minimal to maximum.
      *
      * @param[in]   aPrev   A reference to the block after which to place @p aBlock.
      * @param[in]   aBlock  A reference to the block.
@@ -335,6 +399,38 @@ private:
      */
     void BlockInsert(Block &aPrev, Block &aBlock);
 
+    /**
+     * This method inserts a free block into the free list matching its size (small block list or sorted list).
+     *
+     * @param[in]   aBlock  A reference to the block.
+     *
+     */
+    void InsertFreeBlock(Block &aBlock);
+
+    /**
+     * This method removes a given free block from the free list it resides in.
+     *
+     * @param[in]   aBlock  A reference to the block.
+     *
+     */
+    void RemoveFreeBlock(Block &aBlock);
+
+    /**
+     * This method finds and removes the free block whose stored next offset equals @p aNextOffset.
+     *
+     * This is used to locate (and unlink) a free left neighbor block, which is identified by its next offset (the
+     * last two bytes of the block, read using `GetLeftNext()` of its right neighbor).
+     *
+     * @param[in]   aNextOffset     The next offset (or end-of-list marker) stored in the block to find.
+     *
+     * @returns A reference to the removed block.
+     *
+     */
+    Block &RemoveFreeBlockWithNext(uint16_t aNextOffset);
+
+    uint16_t mSmallList[kNumSmallBlockLists]; // Head offsets of the small block free lists.
+    uint32_t mAllocHistogram[kNumHistogramBins]; // Histogram of allocation requests (by small size class).
+
     union
     {
         uint16_t mFreeSize;
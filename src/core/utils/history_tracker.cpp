@@ -51,6 +51,8 @@ namespace Utils {
 HistoryTracker::HistoryTracker(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mTimer(aInstance, HandleTimer)
+    , mLastSendQueueDepth(0)
+    , mLastReassemblyDepth(0)
 {
     mTimer.Start(kAgeCheckPeriod);
 }
@@ -193,6 +195,28 @@ exit:
     return;
 }
 
+void HistoryTracker::RecordForwarderQueueDepth(uint16_t aSendQueueDepth, uint16_t aReassemblyDepth)
+{
+    ForwarderQueueInfo *entry;
+    uint16_t            sendDelta = (aSendQueueDepth > mLastSendQueueDepth) ? (aSendQueueDepth - mLastSendQueueDepth)
+                                                                            : (mLastSendQueueDepth - aSendQueueDepth);
+
+    VerifyOrExit((aReassemblyDepth != mLastReassemblyDepth) || (sendDelta >= kSendQueueDepthRecordDelta) ||
+                 ((aSendQueueDepth == 0) && (mLastSendQueueDepth != 0)));
+
+    entry = mFwdQueueHistory.AddNewEntry();
+    VerifyOrExit(entry != nullptr);
+
+    entry->mSendQueueMessages  = aSendQueueDepth;
+    entry->mReassemblyMessages = aReassemblyDepth;
+
+    mLastSendQueueDepth  = aSendQueueDepth;
+    mLastReassemblyDepth = aReassemblyDepth;
+
+exit:
+    return;
+}
+
 void HistoryTracker::RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo)
 {
     NeighborInfo *entry = mNeighborHistory.AddNewEntry();
@@ -274,6 +298,7 @@ void HistoryTracker::HandleTimer(void)
     mRxHistory.UpdateAgedEntries();
     mTxHistory.UpdateAgedEntries();
     mNeighborHistory.UpdateAgedEntries();
+    mFwdQueueHistory.UpdateAgedEntries();
 
     mTimer.Start(kAgeCheckPeriod);
 }
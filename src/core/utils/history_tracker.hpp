@@ -125,6 +125,12 @@ public:
      */
     typedef otHistoryTrackerNeighborInfo NeighborInfo;
 
+    /**
+     * This type represents a mesh forwarder queue depth sample.
+     *
+     */
+    typedef otHistoryTrackerForwarderQueueInfo ForwarderQueueInfo;
+
     /**
      * This constructor initializes the `HistoryTracker`.
      *
@@ -186,6 +192,52 @@ public:
         return mNeighborHistory.Iterate(aIterator, aEntryAge);
     }
 
+    /**
+     * This method iterates over the entries in the mesh forwarder queue depth history list.
+     *
+     * @param[inout] aIterator  An iterator. MUST be initialized.
+     * @param[out]   aEntryAge  A reference to a variable to output the entry's age.
+     *                          Age is provided as the duration (in milliseconds) from when entry was recorded to
+     *                          @p aIterator initialization time. It is set to `kMaxAge` for entries older than max age.
+     *
+     * @returns A pointer to `ForwarderQueueInfo` entry or `nullptr` if no more entries in the list.
+     *
+     */
+    const ForwarderQueueInfo *IterateForwarderQueueHistory(Iterator &aIterator, uint32_t &aEntryAge) const
+    {
+        return mFwdQueueHistory.Iterate(aIterator, aEntryAge);
+    }
+
+    /**
+     * This method exports a packed binary snapshot of the RX history list in a single call.
+     *
+     * Entries are written to @p aBuffer from newest to oldest. Each exported record is a 32-bit entry age (duration
+     * in milliseconds from when the entry was recorded to the time of this call) followed by the `MessageInfo` entry
+     * itself. As many whole records as fit in @p aSize bytes are written.
+     *
+     * @param[out] aBuffer  A pointer to a buffer to output the snapshot (MUST NOT be `nullptr`).
+     * @param[in]  aSize    The size of @p aBuffer (in bytes).
+     *
+     * @returns The number of bytes written to @p aBuffer.
+     *
+     */
+    uint16_t ExportRxHistory(void *aBuffer, uint16_t aSize) const { return mRxHistory.Export(aBuffer, aSize); }
+
+    /**
+     * This method exports a packed binary snapshot of the TX history list in a single call.
+     *
+     * Entries are written to @p aBuffer from newest to oldest. Each exported record is a 32-bit entry age (duration
+     * in milliseconds from when the entry was recorded to the time of this call) followed by the `MessageInfo` entry
+     * itself. As many whole records as fit in @p aSize bytes are written.
+     *
+     * @param[out] aBuffer  A pointer to a buffer to output the snapshot (MUST NOT be `nullptr`).
+     * @param[in]  aSize    The size of @p aBuffer (in bytes).
+     *
+     * @returns The number of bytes written to @p aBuffer.
+     *
+     */
+    uint16_t ExportTxHistory(void *aBuffer, uint16_t aSize) const { return mTxHistory.Export(aBuffer, aSize); }
+
     /**
      * This static method converts a given entry age to a human-readable string.
      *
@@ -218,6 +270,11 @@ private:
     static constexpr uint16_t kRxListSize       = OPENTHREAD_CONFIG_HISTORY_TRACKER_RX_LIST_SIZE;
     static constexpr uint16_t kTxListSize       = OPENTHREAD_CONFIG_HISTORY_TRACKER_TX_LIST_SIZE;
     static constexpr uint16_t kNeighborListSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_NEIGHBOR_LIST_SIZE;
+    static constexpr uint16_t kFwdQueueListSize = OPENTHREAD_CONFIG_HISTORY_TRACKER_FWD_QUEUE_LIST_SIZE;
+
+    // A new queue depth sample is recorded when the reassembly list depth changes, the send queue empties, or the
+    // send queue depth moves by at least this many messages since the last recorded sample.
+    static constexpr uint16_t kSendQueueDepthRecordDelta = 4;
 
     static constexpr int8_t   kInvalidRss    = OT_RADIO_RSSI_INVALID;
     static constexpr uint16_t kInvalidRloc16 = Mac::kShortAddrInvalid;
@@ -287,6 +344,36 @@ private:
                                                                                                      : nullptr;
         }
 
+        // Exports a packed snapshot of the list (newest entry first)
+        // into `aBuffer`, writing as many whole records (32-bit entry
+        // age followed by the `Entry`) as fit in `aSize` bytes, and
+        // returns the number of bytes written.
+        uint16_t Export(void *aBuffer, uint16_t aSize) const
+        {
+            Iterator     iterator;
+            uint32_t     entryAge;
+            const Entry *entry;
+            uint8_t *    bufPtr  = static_cast<uint8_t *>(aBuffer);
+            uint16_t     written = 0;
+
+            iterator.Init();
+
+            while ((entry = Iterate(iterator, entryAge)) != nullptr)
+            {
+                if (static_cast<uint16_t>(aSize - written) < sizeof(uint32_t) + sizeof(Entry))
+                {
+                    break;
+                }
+
+                memcpy(bufPtr + written, &entryAge, sizeof(uint32_t));
+                written += sizeof(uint32_t);
+                memcpy(bufPtr + written, entry, sizeof(Entry));
+                written += sizeof(Entry);
+            }
+
+            return written;
+        }
+
     private:
         Timestamp mTimestamps[kMaxSize];
         Entry     mEntries[kMaxSize];
@@ -301,6 +388,7 @@ private:
         Entry *      AddNewEntry(void) { return nullptr; }
         void         AddNewEntry(const Entry &) {}
         const Entry *Iterate(Iterator &, uint32_t &) const { return nullptr; }
+        uint16_t     Export(void *, uint16_t) const { return 0; }
         void         RemoveAgedEntries(void) {}
     };
 
@@ -322,16 +410,20 @@ private:
 
     void        RecordNetworkInfo(void);
     void        RecordMessage(const Message &aMessage, const Mac::Address &aMacAddress, MessageType aType);
+    void        RecordForwarderQueueDepth(uint16_t aSendQueueDepth, uint16_t aReassemblyDepth);
     void        RecordNeighborEvent(NeighborTable::Event aEvent, const NeighborTable::EntryInfo &aInfo);
     void        HandleNotifierEvents(Events aEvents);
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    EntryList<NetworkInfo, kNetInfoListSize>   mNetInfoHistory;
-    EntryList<MessageInfo, kRxListSize>        mRxHistory;
-    EntryList<MessageInfo, kTxListSize>        mTxHistory;
-    EntryList<NeighborInfo, kNeighborListSize> mNeighborHistory;
-    TimerMilli                                 mTimer;
+    EntryList<NetworkInfo, kNetInfoListSize>         mNetInfoHistory;
+    EntryList<MessageInfo, kRxListSize>              mRxHistory;
+    EntryList<MessageInfo, kTxListSize>              mTxHistory;
+    EntryList<NeighborInfo, kNeighborListSize>       mNeighborHistory;
+    EntryList<ForwarderQueueInfo, kFwdQueueListSize> mFwdQueueHistory;
+    TimerMilli                                       mTimer;
+    uint16_t                                         mLastSendQueueDepth;
+    uint16_t                                         mLastReassemblyDepth;
 };
 
 } // namespace Utils
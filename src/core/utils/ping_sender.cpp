@@ -90,8 +90,14 @@ PingSender::PingSender(Instance &aInstance)
     , mIdentifier(0)
     , mTargetEchoSequence(0)
     , mTimer(aInstance, PingSender::HandleTimer)
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    , mMicroTimer(aInstance, PingSender::HandleMicroTimer)
+#endif
     , mIcmpHandler(PingSender::HandleIcmpReceive, this)
 {
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    memset(mRttHistogram, 0, sizeof(mRttHistogram));
+#endif
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 }
 
@@ -100,11 +106,19 @@ Error PingSender::Ping(const Config &aConfig)
     Error error = kErrorNone;
 
     VerifyOrExit(!mTimer.IsRunning(), error = kErrorBusy);
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    VerifyOrExit(!mMicroTimer.IsRunning(), error = kErrorBusy);
+#endif
 
     mConfig = aConfig;
     mConfig.SetUnspecifiedToDefault();
 
     VerifyOrExit(mConfig.mInterval <= Timer::kMaxDelay, error = kErrorInvalidArgs);
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    memset(mRttHistogram, 0, sizeof(mRttHistogram));
+#else
+    VerifyOrExit(mConfig.mIntervalUs == 0, error = kErrorInvalidArgs);
+#endif
 
     mStatistics.Clear();
     mStatistics.mIsMulticast = static_cast<Ip6::Address *>(&mConfig.mDestination)->IsMulticast();
@@ -119,6 +133,9 @@ exit:
 void PingSender::Stop(void)
 {
     mTimer.Stop();
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    mMicroTimer.Stop();
+#endif
     mIdentifier++;
 }
 
@@ -159,7 +176,16 @@ exit:
 
     if (mConfig.mCount > 0)
     {
-        mTimer.Start(mConfig.mInterval);
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+        if (IsHighRate())
+        {
+            mMicroTimer.Start(mConfig.mIntervalUs);
+        }
+        else
+#endif
+        {
+            mTimer.Start(mConfig.mInterval);
+        }
     }
     else
     {
@@ -184,6 +210,32 @@ void PingSender::HandleTimer(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+void PingSender::HandleMicroTimer(Timer &aTimer)
+{
+    aTimer.Get<PingSender>().SendPing();
+}
+
+void PingSender::UpdateRttHistogram(uint16_t aRoundTripTime)
+{
+    uint8_t bin = 0;
+
+    while ((bin + 1 < kRttHistogramBins) && (aRoundTripTime >= (1u << (bin + 1))))
+    {
+        bin++;
+    }
+
+    mRttHistogram[bin]++;
+}
+
+const uint32_t *PingSender::GetRttHistogram(uint8_t &aNumberOfBins) const
+{
+    aNumberOfBins = kRttHistogramBins;
+
+    return mRttHistogram;
+}
+#endif // OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+
 void PingSender::HandleIcmpReceive(void *               aContext,
                                    otMessage *          aMessage,
                                    const otMessageInfo *aMessageInfo,
@@ -201,7 +253,11 @@ void PingSender::HandleIcmpReceive(const Message &          aMessage,
     Reply    reply;
     uint32_t timestamp;
 
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    VerifyOrExit(mTimer.IsRunning() || mMicroTimer.IsRunning());
+#else
     VerifyOrExit(mTimer.IsRunning());
+#endif
     VerifyOrExit(aIcmpHeader.GetType() == Ip6::Icmp::Header::kTypeEchoReply);
     VerifyOrExit(aIcmpHeader.GetId() == mIdentifier);
 
@@ -228,7 +284,16 @@ void PingSender::HandleIcmpReceive(const Message &          aMessage,
     {
         mTimer.Stop();
     }
-    mConfig.InvokeReplyCallback(reply);
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    if (IsHighRate())
+    {
+        UpdateRttHistogram(reply.mRoundTripTime);
+    }
+    else
+#endif
+    {
+        mConfig.InvokeReplyCallback(reply);
+    }
     // Received all ping replies, no need to wait longer.
     if (!mStatistics.mIsMulticast && mConfig.mCount == 0 && aIcmpHeader.GetSequence() == mTargetEchoSequence)
     {
@@ -40,6 +40,10 @@
 
 #include <openthread/ping_sender.h>
 
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+#error "OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE requires OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE"
+#endif
+
 #include "common/code_utils.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -163,10 +167,30 @@ public:
      */
     void Stop(void);
 
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    /**
+     * This method gets the round-trip time histogram.
+     *
+     * The histogram is cleared when a new ping is started. Bin `n` counts replies with round-trip time in the range
+     * `[2^n, 2^(n+1))` milliseconds (first bin starts at 0, last bin is open ended).
+     *
+     * @param[out] aNumberOfBins  A reference to return the number of bins in the histogram.
+     *
+     * @returns A pointer to the histogram bins (reply counts per round-trip time range).
+     *
+     */
+    const uint32_t *GetRttHistogram(uint8_t &aNumberOfBins) const;
+#endif
+
 private:
     void        SendPing(void);
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    bool        IsHighRate(void) const { return mConfig.mIntervalUs != 0; }
+    void        UpdateRttHistogram(uint16_t aRoundTripTime);
+    static void HandleMicroTimer(Timer &aTimer);
+#endif
     static void HandleIcmpReceive(void *               aContext,
                                   otMessage *          aMessage,
                                   const otMessageInfo *aMessageInfo,
@@ -180,6 +204,12 @@ private:
     uint16_t           mIdentifier;
     uint16_t           mTargetEchoSequence;
     TimerMilli         mTimer;
+#if OPENTHREAD_CONFIG_PING_SENDER_HIGH_RATE_ENABLE
+    static constexpr uint8_t kRttHistogramBins = OPENTHREAD_CONFIG_PING_SENDER_RTT_HISTOGRAM_BIN_COUNT;
+
+    TimerMicro mMicroTimer;
+    uint32_t   mRttHistogram[kRttHistogramBins];
+#endif
     Ip6::Icmp::Handler mIcmpHandler;
 };
 
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the receive pipeline profiler.
+ */
+
+#include "pipeline_profiler.hpp"
+
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace Utils {
+
+PipelineProfiler::PipelineProfiler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    Clear();
+}
+
+void PipelineProfiler::Sample(Stage aStage, uint64_t aEnterTime)
+{
+    uint64_t    duration = otPlatTimeGet() - aEnterTime;
+    StageStats &stats    = mStats[aStage];
+    uint8_t     bucket   = 0;
+    uint64_t    value    = duration;
+
+    stats.mNumSamples++;
+    stats.mTotalDuration += duration;
+
+    if (duration > stats.mMaxDuration)
+    {
+        stats.mMaxDuration = (duration <= UINT32_MAX) ? static_cast<uint32_t>(duration) : UINT32_MAX;
+    }
+
+    while ((value >>= 1) != 0)
+    {
+        bucket++;
+    }
+
+    if (bucket >= kNumBuckets)
+    {
+        bucket = kNumBuckets - 1;
+    }
+
+    stats.mBuckets[bucket]++;
+}
+
+void PipelineProfiler::Clear(void)
+{
+    for (StageStats &stats : mStats)
+    {
+        stats.Clear();
+    }
+}
+
+const char *PipelineProfiler::StageToString(Stage aStage)
+{
+    static const char *const kStageStrings[] = {
+        "mac-rx",    // (0) kStageMacRx
+        "forwarder", // (1) kStageMeshForwarder
+        "ip6",       // (2) kStageIp6
+        "udp",       // (3) kStageUdp
+    };
+
+    static_assert(0 == kStageMacRx, "kStageMacRx value is incorrect");
+    static_assert(1 == kStageMeshForwarder, "kStageMeshForwarder value is incorrect");
+    static_assert(2 == kStageIp6, "kStageIp6 value is incorrect");
+    static_assert(3 == kStageUdp, "kStageUdp value is incorrect");
+
+    return kStageStrings[aStage];
+}
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
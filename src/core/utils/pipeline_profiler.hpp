@@ -0,0 +1,149 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the receive pipeline profiler.
+ */
+
+#ifndef PIPELINE_PROFILER_HPP_
+#define PIPELINE_PROFILER_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+
+#include <openthread/platform/time.h>
+
+#include "common/clearable.hpp"
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+
+namespace ot {
+namespace Utils {
+
+/**
+ * This class implements the receive pipeline profiler.
+ *
+ * The profiler accumulates, per receive pipeline stage, a histogram of the time spent processing a packet in that
+ * stage. Each stage duration covers the stage handler inclusively, i.e., it also contains the time spent in the
+ * later (nested) stages. The histograms use power-of-two microsecond buckets and fixed RAM.
+ *
+ */
+class PipelineProfiler : public InstanceLocator, private NonCopyable
+{
+public:
+    static constexpr uint8_t kNumBuckets = 12; ///< Number of histogram buckets (power-of-two microsecond ranges).
+
+    /**
+     * This enumeration represents the profiled receive pipeline stages.
+     *
+     */
+    enum Stage : uint8_t
+    {
+        kStageMacRx,         ///< MAC frame processing (`Mac::HandleReceivedFrame()`).
+        kStageMeshForwarder, ///< Mesh forwarding (`MeshForwarder::HandleReceivedFrame()`).
+        kStageIp6,           ///< IPv6 datagram handling (`Ip6::HandleDatagram()`).
+        kStageUdp,           ///< UDP payload dispatch (`Udp::HandlePayload()`).
+
+        kNumStages, ///< Number of stages.
+    };
+
+    /**
+     * This structure represents the accumulated statistics of a single stage.
+     *
+     */
+    struct StageStats : public Clearable<StageStats>
+    {
+        uint32_t mNumSamples;           ///< Number of samples.
+        uint32_t mMaxDuration;          ///< Longest observed duration (in microseconds).
+        uint64_t mTotalDuration;        ///< Sum of all observed durations (in microseconds).
+        uint32_t mBuckets[kNumBuckets]; ///< Histogram; bucket `i` counts durations in `[2^i, 2^(i+1))` microseconds.
+    };
+
+    /**
+     * This constructor initializes the `PipelineProfiler` object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit PipelineProfiler(Instance &aInstance);
+
+    /**
+     * This method returns the current platform time, to be passed back to `Sample()` when the stage finishes.
+     *
+     * @returns The current platform time (in microseconds).
+     *
+     */
+    uint64_t GetNow(void) const { return otPlatTimeGet(); }
+
+    /**
+     * This method records one sample for a given stage.
+     *
+     * @param[in]  aStage      The stage that finished.
+     * @param[in]  aEnterTime  The platform time at which the stage was entered (from `GetNow()`).
+     *
+     */
+    void Sample(Stage aStage, uint64_t aEnterTime);
+
+    /**
+     * This method returns the accumulated statistics of a given stage.
+     *
+     * @param[in]  aStage  The stage.
+     *
+     * @returns The accumulated statistics of @p aStage.
+     *
+     */
+    const StageStats &GetStageStats(Stage aStage) const { return mStats[aStage]; }
+
+    /**
+     * This method clears the accumulated statistics of all stages.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This static method returns a human-readable name of a given stage.
+     *
+     * @param[in]  aStage  The stage.
+     *
+     * @returns The name of @p aStage.
+     *
+     */
+    static const char *StageToString(Stage aStage);
+
+private:
+    StageStats mStats[kNumStages];
+};
+
+} // namespace Utils
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PIPELINE_PROFILER_ENABLE
+
+#endif // PIPELINE_PROFILER_HPP_
@@ -46,6 +46,10 @@ namespace Utils {
 
 SrpClientBuffers::SrpClientBuffers(Instance &aInstance)
     : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    , mNumDynamicEntries(0)
+    , mMaxDynamicServices(kDefaultMaxDynamicServices)
+#endif
 {
 }
 
@@ -53,6 +57,13 @@ SrpClientBuffers::ServiceEntry *SrpClientBuffers::AllocateService(void)
 {
     ServiceEntry *entry = mServicePool.Allocate();
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    if (entry == nullptr)
+    {
+        entry = AllocateDynamicService();
+    }
+#endif
+
     VerifyOrExit(entry != nullptr);
 
     entry->Clear();
@@ -67,6 +78,79 @@ exit:
     return entry;
 }
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+
+SrpClientBuffers::ServiceEntry *SrpClientBuffers::AllocateDynamicService(void)
+{
+    ServiceEntry *entry = mFreeDynamicEntries.Pop();
+
+    if (entry == nullptr)
+    {
+        VerifyOrExit(mNumDynamicEntries < mMaxDynamicServices);
+
+        entry = static_cast<ServiceEntry *>(Instance::HeapCAlloc(1, sizeof(ServiceEntry)));
+        VerifyOrExit(entry != nullptr);
+
+        mNumDynamicEntries++;
+    }
+
+exit:
+    return entry;
+}
+
+void SrpClientBuffers::FreeService(ServiceEntry &aServiceEntry)
+{
+    if (mServicePool.IsPoolEntry(aServiceEntry))
+    {
+        mServicePool.Free(aServiceEntry);
+    }
+    else if (mNumDynamicEntries > mMaxDynamicServices)
+    {
+        // The runtime cap was lowered while this entry was in use, so
+        // release it back to the heap instead of caching it for reuse.
+
+        mNumDynamicEntries--;
+        Instance::HeapFree(&aServiceEntry);
+    }
+    else
+    {
+        mFreeDynamicEntries.Push(aServiceEntry);
+    }
+}
+
+void SrpClientBuffers::FreeAllServices(void)
+{
+    ServiceEntry *entry;
+
+    mServicePool.FreeAll();
+
+    while ((entry = mFreeDynamicEntries.Pop()) != nullptr)
+    {
+        mNumDynamicEntries--;
+        Instance::HeapFree(entry);
+    }
+}
+
+void SrpClientBuffers::SetMaxDynamicServices(uint16_t aMaxServices)
+{
+    mMaxDynamicServices = aMaxServices;
+
+    while (mNumDynamicEntries > mMaxDynamicServices)
+    {
+        ServiceEntry *entry = mFreeDynamicEntries.Pop();
+
+        VerifyOrExit(entry != nullptr);
+
+        mNumDynamicEntries--;
+        Instance::HeapFree(entry);
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+
 } // namespace Utils
 } // namespace ot
 
@@ -102,6 +102,14 @@ public:
      */
     static constexpr uint16_t kTxtBufferSize = OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_TXT_BUFFER_SIZE;
 
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    /**
+     * Default runtime cap on the number of heap-allocated service entries (in use or cached for reuse).
+     *
+     */
+    static constexpr uint16_t kDefaultMaxDynamicServices = OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_MAX_DYNAMIC_SERVICES;
+#endif
+
     /**
      * This class represents a SRP client service entry from the pool.
      *
@@ -246,18 +254,60 @@ public:
      * @param[in] aServiceEntry     A service entry to free.
      *
      */
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    void FreeService(ServiceEntry &aServiceEntry);
+#else
     void FreeService(ServiceEntry &aServiceEntry) { mServicePool.Free(aServiceEntry); }
+#endif
 
     /**
      * This method frees all previously allocated service entries.
      *
+     * When `OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE` is used, this method frees the static pool and
+     * releases the cached heap-allocated entries back to the heap. Any heap-allocated entry that is still in use
+     * MUST be freed individually using `FreeService()`.
+     *
      */
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    void FreeAllServices(void);
+#else
     void FreeAllServices(void) { mServicePool.FreeAll(); }
+#endif
+
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    /**
+     * This method returns the runtime cap on the number of heap-allocated service entries.
+     *
+     * @returns The maximum number of heap-allocated service entries (in use or cached for reuse).
+     *
+     */
+    uint16_t GetMaxDynamicServices(void) const { return mMaxDynamicServices; }
+
+    /**
+     * This method sets the runtime cap on the number of heap-allocated service entries.
+     *
+     * If the new cap is smaller than the number of currently heap-allocated entries, cached (free) entries are
+     * released back to the heap immediately and in-use entries are released as they are freed.
+     *
+     * @param[in] aMaxServices   The maximum number of heap-allocated service entries.
+     *
+     */
+    void SetMaxDynamicServices(uint16_t aMaxServices);
+#endif
 
 private:
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    ServiceEntry *AllocateDynamicService(void);
+#endif
+
     char                             mHostName[kHostNameSize];
     Ip6::Address                     mHostAddresses[kMaxHostAddresses];
     Pool<ServiceEntry, kMaxServices> mServicePool;
+#if OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_DYNAMIC_ENABLE
+    LinkedList<ServiceEntry>         mFreeDynamicEntries;
+    uint16_t                         mNumDynamicEntries;
+    uint16_t                         mMaxDynamicServices;
+#endif
 };
 
 #endif // OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_ENABLE
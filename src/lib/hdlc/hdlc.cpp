@@ -50,6 +50,18 @@ namespace Hdlc {
  */
 static uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte);
 
+/**
+ * This method updates an FCS over a given buffer.
+ *
+ * @param[in]  aFcs     The FCS to update.
+ * @param[in]  aBuffer  A pointer to a data buffer.
+ * @param[in]  aLength  Number of bytes in @p aBuffer.
+ *
+ * @returns The updated FCS.
+ *
+ */
+static uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aBuffer, uint16_t aLength);
+
 enum
 {
     kFlagXOn        = 0x11,
@@ -95,6 +107,16 @@ uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte)
     return (aFcs >> 8) ^ sFcsTable[(aFcs ^ aByte) & 0xff];
 }
 
+uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aBuffer, uint16_t aLength)
+{
+    while (aLength--)
+    {
+        aFcs = UpdateFcs(aFcs, *aBuffer++);
+    }
+
+    return aFcs;
+}
+
 static bool HdlcByteNeedsEscape(uint8_t aByte)
 {
     bool rval;
@@ -158,9 +180,31 @@ otError Encoder::Encode(const uint8_t *aData, uint16_t aLength)
     uint16_t          oldFcs     = mFcs;
     FrameWritePointer oldPointer = mWritePointer;
 
-    while (aLength--)
+    while (aLength > 0)
     {
-        SuccessOrExit(error = Encode(*aData++));
+        uint16_t runLength = 0;
+
+        // Scan the run of bytes needing no escaping, then copy the
+        // whole run in one shot with the FCS folded over the same pass.
+
+        while ((runLength < aLength) && !HdlcByteNeedsEscape(aData[runLength]))
+        {
+            runLength++;
+        }
+
+        if (runLength > 0)
+        {
+            SuccessOrExit(error = mWritePointer.WriteBytes(aData, runLength));
+            mFcs = UpdateFcs(mFcs, aData, runLength);
+            aData += runLength;
+            aLength -= runLength;
+        }
+
+        if (aLength > 0)
+        {
+            SuccessOrExit(error = Encode(*aData++));
+            aLength--;
+        }
     }
 
 exit:
@@ -218,9 +262,44 @@ void Decoder::Reset(void)
 
 void Decoder::Decode(const uint8_t *aData, uint16_t aLength)
 {
-    while (aLength--)
+    while (aLength > 0)
     {
-        uint8_t byte = *aData++;
+        uint8_t byte;
+
+        if (mState == kStateSync)
+        {
+            // Bulk path: scan (using `memchr()`) for the next flag or
+            // escape byte and process the run of plain data bytes
+            // preceding it in one shot, with the FCS folded over the
+            // same pass. When the run does not fit in the buffer, fall
+            // through to the byte-by-byte path which reports
+            // `OT_ERROR_NO_BUFS` on the byte that does not fit.
+
+            const uint8_t *flag = static_cast<const uint8_t *>(memchr(aData, kFlagSequence, aLength));
+            const uint8_t *escape;
+            uint16_t       runLength;
+
+            runLength = (flag != nullptr) ? static_cast<uint16_t>(flag - aData) : aLength;
+            escape    = static_cast<const uint8_t *>(memchr(aData, kEscapeSequence, runLength));
+
+            if (escape != nullptr)
+            {
+                runLength = static_cast<uint16_t>(escape - aData);
+            }
+
+            if ((runLength > 0) && mWritePointer.CanWrite(runLength))
+            {
+                mFcs = UpdateFcs(mFcs, aData, runLength);
+                IgnoreError(mWritePointer.WriteBytes(aData, runLength));
+                mDecodedLength += runLength;
+                aData += runLength;
+                aLength -= runLength;
+                continue;
+            }
+        }
+
+        byte = *aData++;
+        aLength--;
 
         switch (mState)
         {
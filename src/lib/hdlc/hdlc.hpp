@@ -98,6 +98,32 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a given number of bytes into the buffer and updates the write pointer (if space is
+     * available).
+     *
+     * @param[in]  aBuffer   A pointer to a data buffer.
+     * @param[in]  aLength   Number of bytes in @p aBuffer.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     *
+     */
+    otError WriteBytes(const uint8_t *aBuffer, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NO_BUFS;
+
+        if (CanWrite(aLength))
+        {
+            memcpy(mWritePointer, aBuffer, aLength);
+            mWritePointer += aLength;
+            mRemainingLength -= aLength;
+            error = OT_ERROR_NONE;
+        }
+
+        return error;
+    }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
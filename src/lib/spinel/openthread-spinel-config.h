@@ -55,4 +55,18 @@
 #define OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT 0
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+ *
+ * Define 1 to restore the RCP state after a failure by sending all restoration
+ * property commands back-to-back and waiting for the responses collectively,
+ * instead of waiting for each response before sending the next command.
+ *
+ * Requires `OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0`.
+ *
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+#define OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE 0
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_H_
@@ -765,7 +765,7 @@ private:
 
     static void HandleReceivedFrame(void *aContext);
 
-    otError CheckSpinelVersion(void);
+    otError CheckSpinelVersion(unsigned int aVersionMajor, unsigned int aVersionMinor);
     otError CheckRadioCapabilities(void);
     otError CheckRcpApiVersion(bool aSupportsRcpApiVersion);
 
@@ -795,6 +795,40 @@ private:
      */
     otError Get(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * This structure represents a single property entry in a batched property get (see `GetBatch()`).
+     *
+     */
+    struct BatchedGet
+    {
+        spinel_prop_key_t mKey;    ///< Spinel property key.
+        const char *      mFormat; ///< Spinel formatter to unpack property value (in-place unpack semantics).
+        void *            mArg1;   ///< First argument to unpack property value into.
+        void *            mArg2;   ///< Second argument (e.g., buffer size or length pointer), or `nullptr`.
+        otError           mError;  ///< Result of the property get for this entry (output).
+        spinel_tid_t      mTid;    ///< Transaction id of this entry (internal use only).
+    };
+
+    /**
+     * This method tries to retrieve multiple spinel properties from OpenThread transceiver in a pipelined manner.
+     *
+     * All `SPINEL_CMD_PROP_VALUE_GET` commands are sent back to back, each with a distinct transaction id, before
+     * waiting for any response. The responses are then completed from a single wait loop, which avoids a full
+     * round trip to the transceiver per property.
+     *
+     * The `mFormat` and arguments of each entry follow `spinel_datatype_unpack_in_place()` semantics, i.e. same as
+     * the variable arguments accepted by `Get()`.
+     *
+     * @param[inout]  aProperties     An array of `BatchedGet` entries to retrieve (`mError` is updated per entry).
+     * @param[in]     aNumProperties  Number of entries in @p aProperties.
+     *
+     * @retval  OT_ERROR_NONE               Successfully got all the properties.
+     * @retval  OT_ERROR_BUSY               Failed due to insufficient available transaction ids.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError GetBatch(BatchedGet *aProperties, uint8_t aNumProperties);
+
     /**
      * This method tries to retrieve a spinel property from OpenThread transceiver with parameter appended.
      *
@@ -911,6 +945,13 @@ private:
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
 
+    BatchedGet *FindBatchedGet(spinel_tid_t aTid);
+    void        HandleBatchedGetResponse(BatchedGet &      aEntry,
+                                         uint32_t          aCommand,
+                                         spinel_prop_key_t aKey,
+                                         const uint8_t *   aBuffer,
+                                         uint16_t          aLength);
+
     void RadioReceive(void);
 
     void TransmitDone(otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError);
@@ -923,6 +964,15 @@ private:
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
     void RestoreProperties(void);
+#if OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+    void SendRestoreCommand(uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, ...);
+    void FlushRestoreCommands(void);
+    void HandleRestoreResponse(spinel_prop_key_t aExpectedKey,
+                               uint32_t          aCommand,
+                               spinel_prop_key_t aKey,
+                               const uint8_t *   aBuffer,
+                               uint16_t          aLength);
+#endif
 #endif
 
     otInstance *mInstance;
@@ -940,6 +990,9 @@ private:
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
+    BatchedGet *      mBatchedGets;        ///< Ongoing batched property gets (`nullptr` if none).
+    uint8_t           mBatchedGetCount;    ///< Number of entries in `mBatchedGets`.
+    uint8_t           mBatchedGetsPending; ///< Number of batched property gets still awaiting a response.
 
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -995,6 +1048,12 @@ private:
     bool mRcpFailed : 1;                   ///< RCP failure happened, should recover and retry operation.
     bool mEnergyScanning : 1;              ///< If fails while scanning, restarts scanning.
 
+#if OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+    uint16_t          mRestoreTids;     ///< Transaction ids of in-flight restore property commands.
+    spinel_prop_key_t mRestoreKeys[16]; ///< Property key of each restore command, indexed by transaction id.
+    otError           mRestoreError;    ///< First error reported for an in-flight restore command.
+#endif
+
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
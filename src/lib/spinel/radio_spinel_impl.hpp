@@ -184,6 +184,9 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mBatchedGets(nullptr)
+    , mBatchedGetCount(0)
+    , mBatchedGetsPending(0)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -206,6 +209,10 @@ RadioSpinel<InterfaceType, ProcessContextType>::RadioSpinel(void)
     , mFemLnaGainSet(false)
     , mRcpFailed(false)
     , mEnergyScanning(false)
+#if OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+    , mRestoreTids(0)
+    , mRestoreError(OT_ERROR_NONE)
+#endif
 #endif
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
     , mDiagMode(false)
@@ -240,9 +247,20 @@ void RadioSpinel<InterfaceType, ProcessContextType>::Init(bool aResetRadio,
     SuccessOrExit(error = WaitResponse());
     VerifyOrExit(mIsReady, error = OT_ERROR_FAILED);
 
-    SuccessOrExit(error = CheckSpinelVersion());
-    SuccessOrExit(error = Get(SPINEL_PROP_NCP_VERSION, SPINEL_DATATYPE_UTF8_S, mVersion, sizeof(mVersion)));
-    SuccessOrExit(error = Get(SPINEL_PROP_HWADDR, SPINEL_DATATYPE_EUI64_S, mIeeeEui64.m8));
+    {
+        unsigned int versionMajor;
+        unsigned int versionMinor;
+        BatchedGet   props[] = {
+            {SPINEL_PROP_PROTOCOL_VERSION, (SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S),
+             &versionMajor, &versionMinor, OT_ERROR_NONE, 0},
+            {SPINEL_PROP_NCP_VERSION, SPINEL_DATATYPE_UTF8_S, mVersion, reinterpret_cast<void *>(sizeof(mVersion)),
+             OT_ERROR_NONE, 0},
+            {SPINEL_PROP_HWADDR, SPINEL_DATATYPE_EUI64_S, mIeeeEui64.m8, nullptr, OT_ERROR_NONE, 0},
+        };
+
+        SuccessOrExit(error = GetBatch(props, sizeof(props) / sizeof(props[0])));
+        SuccessOrExit(error = CheckSpinelVersion(versionMajor, versionMinor));
+    }
 
     if (!IsRcp(supportsRcpApiVersion))
     {
@@ -273,25 +291,19 @@ exit:
 }
 
 template <typename InterfaceType, typename ProcessContextType>
-otError RadioSpinel<InterfaceType, ProcessContextType>::CheckSpinelVersion(void)
+otError RadioSpinel<InterfaceType, ProcessContextType>::CheckSpinelVersion(unsigned int aVersionMajor,
+                                                                           unsigned int aVersionMinor)
 {
-    otError      error = OT_ERROR_NONE;
-    unsigned int versionMajor;
-    unsigned int versionMinor;
-
-    SuccessOrExit(error =
-                      Get(SPINEL_PROP_PROTOCOL_VERSION, (SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_UINT_PACKED_S),
-                          &versionMajor, &versionMinor));
+    otError error = OT_ERROR_NONE;
 
-    if ((versionMajor != SPINEL_PROTOCOL_VERSION_THREAD_MAJOR) ||
-        (versionMinor != SPINEL_PROTOCOL_VERSION_THREAD_MINOR))
+    if ((aVersionMajor != SPINEL_PROTOCOL_VERSION_THREAD_MAJOR) ||
+        (aVersionMinor != SPINEL_PROTOCOL_VERSION_THREAD_MINOR))
     {
         otLogCritPlat("Spinel version mismatch - Posix:%d.%d, RCP:%d.%d", SPINEL_PROTOCOL_VERSION_THREAD_MAJOR,
-                      SPINEL_PROTOCOL_VERSION_THREAD_MINOR, versionMajor, versionMinor);
+                      SPINEL_PROTOCOL_VERSION_THREAD_MINOR, aVersionMajor, aVersionMinor);
         DieNow(OT_EXIT_RADIO_SPINEL_INCOMPATIBLE);
     }
 
-exit:
     return error;
 }
 
@@ -560,6 +572,7 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
     uint32_t          cmd    = 0;
     spinel_ssize_t    rval   = 0;
     otError           error  = OT_ERROR_NONE;
+    BatchedGet *      batchedGet;
 
     rval = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
     VerifyOrExit(rval > 0 && cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED,
@@ -581,6 +594,21 @@ void RadioSpinel<InterfaceType, ProcessContextType>::HandleResponse(const uint8_
         FreeTid(mTxRadioTid);
         mTxRadioTid = 0;
     }
+    else if ((batchedGet = FindBatchedGet(SPINEL_HEADER_GET_TID(header))) != nullptr)
+    {
+        HandleBatchedGetResponse(*batchedGet, cmd, key, data, static_cast<uint16_t>(len));
+        FreeTid(batchedGet->mTid);
+        batchedGet->mTid = 0;
+        mBatchedGetsPending--;
+    }
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0 && OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+    else if ((mRestoreTids & (1 << SPINEL_HEADER_GET_TID(header))) != 0)
+    {
+        HandleRestoreResponse(mRestoreKeys[SPINEL_HEADER_GET_TID(header)], cmd, key, data, static_cast<uint16_t>(len));
+        mRestoreTids &= ~(1 << SPINEL_HEADER_GET_TID(header));
+        FreeTid(SPINEL_HEADER_GET_TID(header));
+    }
+#endif
     else
     {
         otLogWarnPlat("Unexpected Spinel transaction message: %u", SPINEL_HEADER_GET_TID(header));
@@ -939,27 +967,27 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ParseRadioFrame(otRadioF
     otError        error        = OT_ERROR_NONE;
     uint16_t       flags        = 0;
     int8_t         noiseFloor   = -128;
-    spinel_size_t  size         = OT_RADIO_FRAME_MAX_SIZE;
+    spinel_size_t  size         = 0;
+    const uint8_t *psdu         = nullptr;
     unsigned int   receiveError = 0;
     spinel_ssize_t unpacked;
 
     VerifyOrExit(aLength > 0, aFrame.mLength = 0);
 
-    unpacked = spinel_datatype_unpack_in_place(aBuffer, aLength,
-                                               SPINEL_DATATYPE_DATA_WLEN_S                          // Frame
-                                                   SPINEL_DATATYPE_INT8_S                           // RSSI
-                                                       SPINEL_DATATYPE_INT8_S                       // Noise Floor
-                                                           SPINEL_DATATYPE_UINT16_S                 // Flags
-                                                               SPINEL_DATATYPE_STRUCT_S(            // PHY-data
-                                                                   SPINEL_DATATYPE_UINT8_S          // 802.15.4 channel
-                                                                       SPINEL_DATATYPE_UINT8_S      // 802.15.4 LQI
-                                                                           SPINEL_DATATYPE_UINT64_S // Timestamp (us).
-                                                                   ) SPINEL_DATATYPE_STRUCT_S(      // Vendor-data
-                                                                   SPINEL_DATATYPE_UINT_PACKED_S    // Receive error
-                                                                   ),
-                                               aFrame.mPsdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags,
-                                               &aFrame.mChannel, &aFrame.mInfo.mRxInfo.mLqi,
-                                               &aFrame.mInfo.mRxInfo.mTimestamp, &receiveError);
+    unpacked = spinel_datatype_unpack(aBuffer, aLength,
+                                      SPINEL_DATATYPE_DATA_WLEN_S                          // Frame
+                                          SPINEL_DATATYPE_INT8_S                           // RSSI
+                                              SPINEL_DATATYPE_INT8_S                       // Noise Floor
+                                                  SPINEL_DATATYPE_UINT16_S                 // Flags
+                                                      SPINEL_DATATYPE_STRUCT_S(            // PHY-data
+                                                          SPINEL_DATATYPE_UINT8_S          // 802.15.4 channel
+                                                              SPINEL_DATATYPE_UINT8_S      // 802.15.4 LQI
+                                                                  SPINEL_DATATYPE_UINT64_S // Timestamp (us).
+                                                          ) SPINEL_DATATYPE_STRUCT_S(      // Vendor-data
+                                                          SPINEL_DATATYPE_UINT_PACKED_S    // Receive error
+                                                          ),
+                                      &psdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags, &aFrame.mChannel,
+                                      &aFrame.mInfo.mRxInfo.mLqi, &aFrame.mInfo.mRxInfo.mTimestamp, &receiveError);
 
     VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
     aUnpacked = unpacked;
@@ -983,6 +1011,25 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::ParseRadioFrame(otRadioF
 
     if (receiveError == OT_ERROR_NONE)
     {
+        VerifyOrExit(size <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
+
+        if (&aFrame == &mRxRadioFrame)
+        {
+            // Loan the PSDU to the upper layer directly out of the spinel
+            // frame buffer instead of copying it. The loan is valid until
+            // the receive-done callback returns, after which the frame is
+            // discarded from the buffer and the loan is released by
+            // `RadioReceive()`.
+            aFrame.mPsdu = const_cast<uint8_t *>(psdu);
+        }
+        else
+        {
+            // The ack frame outlives the spinel frame buffer entry (it is
+            // consumed after the response handling completes), so it must
+            // be copied out.
+            memcpy(aFrame.mPsdu, psdu, size);
+        }
+
         aFrame.mLength = static_cast<uint8_t>(size);
 
         aFrame.mInfo.mRxInfo.mAckedWithFramePending = ((flags & SPINEL_MD_FLAG_ACKED_FP) != 0);
@@ -1046,6 +1093,11 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RadioReceive(void)
     }
 
 exit:
+    // Release the PSDU loaned from the spinel frame buffer by
+    // `ParseRadioFrame()`; the frame memory is no longer valid once the
+    // caller discards the spinel frame.
+    mRxRadioFrame.mPsdu = mRxPsdu;
+
     return;
 }
 
@@ -1555,6 +1607,126 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::Get(spinel_prop_key_t aK
     return error;
 }
 
+template <typename InterfaceType, typename ProcessContextType>
+otError RadioSpinel<InterfaceType, ProcessContextType>::GetBatch(BatchedGet *aProperties, uint8_t aNumProperties)
+{
+    otError error = OT_ERROR_NONE;
+
+    assert(mWaitingTid == 0);
+    assert(mBatchedGets == nullptr);
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    do
+    {
+        RecoverFromRcpFailure();
+#endif
+        mBatchedGets        = aProperties;
+        mBatchedGetCount    = aNumProperties;
+        mBatchedGetsPending = 0;
+
+        for (uint8_t i = 0; i < aNumProperties; i++)
+        {
+            BatchedGet &   entry = aProperties[i];
+            uint8_t        buffer[kMaxSpinelFrame];
+            spinel_ssize_t packed;
+            spinel_tid_t   tid = GetNextTid();
+
+            entry.mError = OT_ERROR_RESPONSE_TIMEOUT;
+            entry.mTid   = 0;
+
+            VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+            // Pack the header, command and key
+            packed = spinel_datatype_pack(buffer, sizeof(buffer), "Cii",
+                                          SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid, SPINEL_CMD_PROP_VALUE_GET,
+                                          entry.mKey);
+
+            VerifyOrExit(packed > 0 && static_cast<size_t>(packed) <= sizeof(buffer), error = OT_ERROR_NO_BUFS);
+
+            SuccessOrExit(error = mSpinelInterface.SendFrame(buffer, static_cast<uint16_t>(packed)));
+
+            entry.mTid = tid;
+            mBatchedGetsPending++;
+        }
+
+        error = WaitResponse();
+
+    exit:
+        for (uint8_t i = 0; i < aNumProperties; i++)
+        {
+            if (aProperties[i].mTid != 0)
+            {
+                FreeTid(aProperties[i].mTid);
+                aProperties[i].mTid = 0;
+            }
+
+            if ((error == OT_ERROR_NONE) && (aProperties[i].mError != OT_ERROR_NONE))
+            {
+                error = aProperties[i].mError;
+            }
+        }
+
+        mBatchedGets        = nullptr;
+        mBatchedGetCount    = 0;
+        mBatchedGetsPending = 0;
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    } while (mRcpFailed);
+#endif
+
+    return error;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+typename RadioSpinel<InterfaceType, ProcessContextType>::BatchedGet *RadioSpinel<
+    InterfaceType,
+    ProcessContextType>::FindBatchedGet(spinel_tid_t aTid)
+{
+    BatchedGet *entry = nullptr;
+
+    for (uint8_t i = 0; i < mBatchedGetCount; i++)
+    {
+        if (mBatchedGets[i].mTid == aTid)
+        {
+            entry = &mBatchedGets[i];
+            break;
+        }
+    }
+
+    return entry;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandleBatchedGetResponse(BatchedGet &      aEntry,
+                                                                              uint32_t          aCommand,
+                                                                              spinel_prop_key_t aKey,
+                                                                              const uint8_t *   aBuffer,
+                                                                              uint16_t          aLength)
+{
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, aEntry.mError = OT_ERROR_PARSE);
+        aEntry.mError = SpinelStatusToOtError(status);
+    }
+    else if ((aCommand == SPINEL_CMD_PROP_VALUE_IS) && (aKey == aEntry.mKey))
+    {
+        spinel_ssize_t unpacked =
+            spinel_datatype_unpack_in_place(aBuffer, aLength, aEntry.mFormat, aEntry.mArg1, aEntry.mArg2);
+
+        VerifyOrExit(unpacked > 0, aEntry.mError = OT_ERROR_PARSE);
+        aEntry.mError = OT_ERROR_NONE;
+    }
+    else
+    {
+        aEntry.mError = OT_ERROR_DROP;
+    }
+
+exit:
+    LogIfFail("Error processing batched get response", aEntry.mError);
+}
+
 // This is not a normal use case for VALUE_GET command and should be only used to get RCP timestamp with dummy payload
 template <typename InterfaceType, typename ProcessContextType>
 otError RadioSpinel<InterfaceType, ProcessContextType>::GetWithParam(spinel_prop_key_t aKey,
@@ -1677,7 +1849,7 @@ otError RadioSpinel<InterfaceType, ProcessContextType>::WaitResponse(void)
             HandleRcpTimeout();
             ExitNow(mError = OT_ERROR_NONE);
         }
-    } while (mWaitingTid || !mIsReady);
+    } while (mWaitingTid || (mBatchedGetsPending != 0) || !mIsReady);
 
     LogIfFail("Error waiting response", mError);
     // This indicates end of waiting response.
@@ -2254,6 +2426,15 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RecoverFromRcpFailure(void)
     mIsReady      = false;
     mIsTimeSynced = false;
 
+    mBatchedGets        = nullptr;
+    mBatchedGetCount    = 0;
+    mBatchedGetsPending = 0;
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+    mRestoreTids  = 0;
+    mRestoreError = OT_ERROR_NONE;
+#endif
+
     if (mResetRadioOnStartup)
     {
         SuccessOrDie(SendReset());
@@ -2297,9 +2478,185 @@ exit:
 }
 
 #if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+#if OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::SendRestoreCommand(uint32_t          aCommand,
+                                                                        spinel_prop_key_t aKey,
+                                                                        const char *      aFormat,
+                                                                        ...)
+{
+    va_list      args;
+    spinel_tid_t tid = GetNextTid();
+
+    if (tid == 0)
+    {
+        // All transaction ids are in flight, drain the pipeline to make room.
+        FlushRestoreCommands();
+        VerifyOrExit(!mRcpFailed);
+        tid = GetNextTid();
+        assert(tid != 0);
+    }
+
+    VerifyOrExit(!mRcpFailed, FreeTid(tid));
+
+    va_start(args, aFormat);
+    SuccessOrDie(SendCommand(aCommand, aKey, tid, aFormat, args));
+    va_end(args);
+
+    mRestoreKeys[tid] = aKey;
+    mRestoreTids |= (1 << tid);
+
+exit:
+    return;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::FlushRestoreCommands(void)
+{
+    while (mRestoreTids != 0)
+    {
+        SuccessOrDie(WaitResponse());
+        VerifyOrExit(!mRcpFailed);
+    }
+
+    SuccessOrDie(mRestoreError);
+
+exit:
+    return;
+}
+
+template <typename InterfaceType, typename ProcessContextType>
+void RadioSpinel<InterfaceType, ProcessContextType>::HandleRestoreResponse(spinel_prop_key_t aExpectedKey,
+                                                                           uint32_t          aCommand,
+                                                                           spinel_prop_key_t aKey,
+                                                                           const uint8_t *   aBuffer,
+                                                                           uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+
+        // Some old RCPs doesn't support max transmit power
+        if ((aExpectedKey == SPINEL_PROP_PHY_CHAN_MAX_POWER) && (error == OT_ERROR_NOT_FOUND))
+        {
+            error = OT_ERROR_NONE;
+        }
+    }
+    else if (((aCommand == SPINEL_CMD_PROP_VALUE_IS) || (aCommand == SPINEL_CMD_PROP_VALUE_INSERTED)) &&
+             (aKey == aExpectedKey))
+    {
+        error = OT_ERROR_NONE;
+    }
+    else
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    if ((mRestoreError == OT_ERROR_NONE) && (error != OT_ERROR_NONE))
+    {
+        mRestoreError = error;
+    }
+
+    LogIfFail("Error processing restore response", error);
+}
+#endif // OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+
 template <typename InterfaceType, typename ProcessContextType>
 void RadioSpinel<InterfaceType, ProcessContextType>::RestoreProperties(void)
 {
+#if OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
+    Settings::NetworkInfo networkInfo;
+
+    // The host copies of the radio properties form the warm state
+    // snapshot. Send every restore command without waiting for its
+    // response, then drain the pipeline once, so that recovery costs
+    // about one bus round trip per pipeline instead of one per property.
+    SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId);
+    SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress);
+    SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S,
+                       mExtendedAddress.m8);
+    SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel);
+
+    if (mMacKeySet)
+    {
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_RCP_MAC_KEY,
+                           SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_DATA_WLEN_S
+                               SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_DATA_WLEN_S,
+                           mKeyIdMode, mKeyId, mPrevKey.m8, sizeof(otMacKey), mCurrKey.m8, sizeof(otMacKey),
+                           mNextKey.m8, sizeof(otMacKey));
+    }
+
+    if (mInstance != nullptr)
+    {
+        SuccessOrDie(static_cast<Instance *>(mInstance)->template Get<Settings>().Read(networkInfo));
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_RCP_MAC_FRAME_COUNTER, SPINEL_DATATYPE_UINT32_S,
+                           networkInfo.GetMacFrameCounter());
+    }
+
+    for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
+    {
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES,
+                           SPINEL_DATATYPE_UINT16_S, mSrcMatchShortEntries[i]);
+    }
+
+    for (int i = 0; i < mSrcMatchExtEntryCount; ++i)
+    {
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES,
+                           SPINEL_DATATYPE_EUI64_S, mSrcMatchExtEntries[i].m8);
+    }
+
+    if (mCcaEnergyDetectThresholdSet)
+    {
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S,
+                           mCcaEnergyDetectThreshold);
+    }
+
+    if (mTransmitPowerSet)
+    {
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_TX_POWER, SPINEL_DATATYPE_INT8_S,
+                           mTransmitPower);
+    }
+
+    if (mCoexEnabledSet)
+    {
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_RADIO_COEX_ENABLE, SPINEL_DATATYPE_BOOL_S,
+                           mCoexEnabled);
+    }
+
+    if (mFemLnaGainSet)
+    {
+        SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_FEM_LNA_GAIN, SPINEL_DATATYPE_INT8_S,
+                           mFemLnaGain);
+    }
+
+    for (uint8_t channel = Radio::kChannelMin; channel <= Radio::kChannelMax; channel++)
+    {
+        int8_t power = mMaxPowerTable.GetTransmitPower(channel);
+
+        if (power != OT_RADIO_POWER_INVALID)
+        {
+            // Some old RCPs doesn't support max transmit power; `HandleRestoreResponse()`
+            // tolerates `OT_ERROR_NOT_FOUND` for this property.
+            SendRestoreCommand(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_PHY_CHAN_MAX_POWER,
+                               SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_INT8_S, channel, power);
+        }
+    }
+
+    FlushRestoreCommands();
+    VerifyOrExit(!mRcpFailed);
+
+    CalcRcpTimeOffset();
+
+exit:
+    return;
+#else // OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
     Settings::NetworkInfo networkInfo;
 
     SuccessOrDie(Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
@@ -2372,6 +2729,7 @@ void RadioSpinel<InterfaceType, ProcessContextType>::RestoreProperties(void)
     }
 
     CalcRcpTimeOffset();
+#endif // OPENTHREAD_SPINEL_CONFIG_RCP_WARM_RESTORE_ENABLE
 }
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
 
@@ -2163,6 +2163,22 @@ enum
      */
     SPINEL_PROP_MAC_MAX_RETRY_NUMBER_INDIRECT = SPINEL_PROP_MAC_EXT__BEGIN + 11,
 
+    /// MAC raw receive frame filter
+    /** Format: `bCbSbS` - Write only
+     *
+     *  `b` : Filter enabled (when false, the remaining fields are ignored and all frames are accepted)
+     *  `C` : Bitmask of accepted frame types (bit n accepts frame type n), zero accepts all types
+     *  `b` : Whether to accept only frames matching the given PAN ID
+     *  `S` : The PAN ID to match
+     *  `b` : Whether to accept only frames matching the given source short address
+     *  `S` : The source short address to match
+     *
+     * The filter is applied to frames received over the raw link-layer (promiscuous capture or raw stream)
+     * before they are passed to the host, so non-matching frames never occupy the host link.
+     *
+     */
+    SPINEL_PROP_MAC_RAW_RX_FILTER = SPINEL_PROP_MAC_EXT__BEGIN + 12,
+
     SPINEL_PROP_MAC_EXT__END = 0x1400,
 
     SPINEL_PROP_NET__BEGIN = 0x40,
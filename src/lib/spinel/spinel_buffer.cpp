@@ -32,6 +32,8 @@
 
 #include "spinel_buffer.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 
@@ -779,9 +781,128 @@ uint16_t Buffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
 {
     uint16_t bytesRead = 0;
 
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
+    while ((bytesRead < aReadLength) && !OutFrameHasEnded())
     {
-        *aDataBuffer++ = OutFrameReadByte();
+        uint16_t remaining = aReadLength - bytesRead;
+
+        switch (mReadState)
+        {
+        case kReadStateInSegment:
+        {
+            uint16_t runLength;
+
+            if (mReadDirection != kForward)
+            {
+                // Backward-direction frames store their content backwards in the buffer, so they are read byte
+                // by byte.
+                *aDataBuffer++ = OutFrameReadByte();
+                bytesRead++;
+                break;
+            }
+
+            // Copy the contiguous run up to the segment tail (or up to the end of the buffer if the segment
+            // wraps around).
+
+            runLength = static_cast<uint16_t>(((mReadSegmentTail > mReadPointer) ? mReadSegmentTail : mBufferEnd) -
+                                              mReadPointer);
+
+            if (runLength > remaining)
+            {
+                runLength = remaining;
+            }
+
+            memcpy(aDataBuffer, mReadPointer, runLength);
+            aDataBuffer += runLength;
+            bytesRead += runLength;
+            mReadPointer = GetUpdatedBufPtr(mReadPointer, runLength, mReadDirection);
+
+            // Check if at end of current segment.
+            if (mReadPointer == mReadSegmentTail)
+            {
+                otError error;
+
+#if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
+                // Prepare any message associated with this segment.
+                error = OutFramePrepareMessage();
+#else
+                error = OT_ERROR_NOT_FOUND;
+#endif
+
+                // If there is no message, move to next segment (if any).
+                if (error != OT_ERROR_NONE)
+                {
+                    IgnoreError(OutFramePrepareSegment());
+                }
+            }
+
+            break;
+        }
+
+        case kReadStateInMessage:
+#if OPENTHREAD_SPINEL_CONFIG_OPENTHREAD_MESSAGE_ENABLE
+        {
+            uint16_t stagedLength = static_cast<uint16_t>(mReadMessageTail - mReadPointer);
+
+            // Drain any content already staged in `mMessageBuffer`.
+
+            if (stagedLength > remaining)
+            {
+                stagedLength = remaining;
+            }
+
+            memcpy(aDataBuffer, mReadPointer, stagedLength);
+            aDataBuffer += stagedLength;
+            bytesRead += stagedLength;
+            mReadPointer += stagedLength;
+
+            // Check if at the end of content in message buffer.
+            if (mReadPointer == mReadMessageTail)
+            {
+                uint16_t msgLength = otMessageGetLength(mReadMessage);
+
+                remaining = aReadLength - bytesRead;
+
+                if ((remaining > 0) && (mReadMessageOffset < msgLength))
+                {
+                    // Read the remaining content directly from the message into the caller's buffer,
+                    // bypassing the staging buffer `mMessageBuffer` entirely.
+
+                    uint16_t readLength = msgLength - mReadMessageOffset;
+
+                    if (readLength > remaining)
+                    {
+                        readLength = remaining;
+                    }
+
+                    readLength = otMessageRead(mReadMessage, mReadMessageOffset, aDataBuffer, readLength);
+                    aDataBuffer += readLength;
+                    bytesRead += readLength;
+                    mReadMessageOffset += readLength;
+                }
+
+                if (mReadMessageOffset >= msgLength)
+                {
+                    // No more content in the message, move to next segment (if any).
+                    IgnoreError(OutFramePrepareSegment());
+                }
+                else if (OutFrameFillMessageBuffer() != OT_ERROR_NONE)
+                {
+                    // Restocking the staging buffer (so that byte-wise reads via `OutFrameReadByte()` stay
+                    // valid when the read stops in the middle of the message) failed, move to next segment.
+                    IgnoreError(OutFramePrepareSegment());
+                }
+            }
+
+            break;
+        }
+#else
+            break;
+#endif
+
+        case kReadStateNotActive:
+        case kReadStateDone:
+            break;
+        }
     }
 
     return bytesRead;
@@ -39,6 +39,7 @@
 #include <openthread/ncp.h>
 
 #include "spinel.h"
+#include "spinel_encoder.hpp"
 
 namespace ot {
 namespace Spinel {
@@ -496,6 +497,30 @@ public:
      */
     otError ReadDataWithLen(const uint8_t *&aData, uint16_t &aDataLen);
 
+    /**
+     * This method decodes and reads a sequence of values from the frame.
+     *
+     * The value types are resolved at compile time from the argument types, so the call compiles to the
+     * corresponding `Read<SomeType>()` calls directly with no runtime format-string interpretation. The consumed
+     * wire format is identical to the equivalent pack-format string. Supported argument types are the ones accepted
+     * by the `Read<SomeType>()` methods, with `UintPacked` selecting the spinel packed integer format.
+     *
+     * On success, the read position gets updated.
+     *
+     * @param[out] aFirst               Reference to the variable to output the first read value.
+     * @param[out] aRest                References to the variables to output the remaining read values (in order).
+     *
+     * @retval OT_ERROR_NONE            Successfully read the values.
+     * @retval OT_ERROR_PARSE           Failed to parse/decode the values.
+     *
+     */
+    template <typename FirstType, typename... RestTypes> otError Decode(FirstType &aFirst, RestTypes &... aRest)
+    {
+        otError error = Read(aFirst);
+
+        return (error != OT_ERROR_NONE) ? error : Decode(aRest...);
+    }
+
     /**
      * This method opens a struct in the frame.
      *
@@ -568,6 +593,24 @@ public:
     otError ResetToSaved(void);
 
 private:
+    // Terminates the `Decode()` recursion.
+    otError Decode(void) { return OT_ERROR_NONE; }
+
+    // Overloads mapping each supported argument type to its typed `Read<SomeType>()` method.
+    otError Read(bool &aBool) { return ReadBool(aBool); }
+    otError Read(uint8_t &aUint8) { return ReadUint8(aUint8); }
+    otError Read(int8_t &aInt8) { return ReadInt8(aInt8); }
+    otError Read(uint16_t &aUint16) { return ReadUint16(aUint16); }
+    otError Read(uint32_t &aUint32) { return ReadUint32(aUint32); }
+    otError Read(uint64_t &aUint64) { return ReadUint64(aUint64); }
+    otError Read(UintPacked &aUint) { return ReadUintPacked(aUint.mValue); }
+    otError Read(const char *&aUtf8) { return ReadUtf8(aUtf8); }
+    otError Read(spinel_ipv6addr_t &aIp6Addr) { return ReadIp6Address(aIp6Addr); }
+    otError Read(otIp6Address &aIp6Addr) { return ReadIp6Address(aIp6Addr); }
+    otError Read(spinel_eui64_t &aEui64) { return ReadEui64(aEui64); }
+    otError Read(otExtAddress &aEui64) { return ReadEui64(aEui64); }
+    otError Read(spinel_eui48_t &aEui48) { return ReadEui48(aEui48); }
+
     otError ReadItem(const uint8_t **aPtr, uint16_t aSize);
     void    ClearSavedPosition(void) { mSavedIndex = mLength; }
     bool    IsSavedPositionValid(void) const { return (mSavedIndex < mLength); }
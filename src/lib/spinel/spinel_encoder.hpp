@@ -45,6 +45,27 @@
 namespace ot {
 namespace Spinel {
 
+/**
+ * This structure wraps an unsigned integer value that is encoded/decoded using the spinel packed integer format
+ * (`SPINEL_DATATYPE_UINT_PACKED_S`) by the typed `Encoder::Encode()` and `Decoder::Decode()` methods.
+ *
+ */
+struct UintPacked
+{
+    /**
+     * This constructor initializes the wrapper with a given value.
+     *
+     * @param[in] aValue   The unsigned integer value.
+     *
+     */
+    explicit UintPacked(unsigned int aValue = 0)
+        : mValue(aValue)
+    {
+    }
+
+    unsigned int mValue; ///< The wrapped unsigned integer value.
+};
+
 /**
  * This class defines a spinel encoder.
  *
@@ -612,6 +633,37 @@ public:
      */
     otError WriteVPacked(const char *aPackFormat, va_list aArgs);
 
+    /**
+     * This method encodes and writes a sequence of values to the current input frame.
+     *
+     * Unlike `WritePacked()`, the value types are resolved at compile time from the argument types, so the call
+     * compiles to the corresponding `Write<SomeType>()` calls directly with no runtime format-string
+     * interpretation. The produced wire format is identical to the equivalent pack-format string. Supported
+     * argument types are the ones accepted by the `Write<SomeType>()` methods, with `UintPacked` selecting the
+     * spinel packed integer format.
+     *
+     * Before using this method `BeginFrame()` must be called to start and prepare a new input frame. Otherwise, this
+     * method does nothing and returns error status `OT_ERROR_INVALID_STATE`.
+     *
+     * If no buffer space is available, this method will discard and clear the current input frame and return the
+     * error status `OT_ERROR_NO_BUFS`.
+     *
+     * @param[in]  aFirst               The first value to encode and write.
+     * @param[in]  aRest                The remaining values to encode and write (in order).
+     *
+     * @retval OT_ERROR_NONE            Successfully added given values to the frame.
+     * @retval OT_ERROR_NO_BUFS         Insufficient buffer space available to add the values.
+     * @retval OT_ERROR_INVALID_STATE   `BeginFrame()` has not been called earlier to start the frame.
+     *
+     */
+    template <typename FirstType, typename... RestTypes>
+    otError Encode(const FirstType &aFirst, const RestTypes &... aRest)
+    {
+        otError error = Write(aFirst);
+
+        return (error != OT_ERROR_NONE) ? error : Encode(aRest...);
+    }
+
     /**
      * This method opens a struct in the current input frame.
      *
@@ -683,6 +735,27 @@ private:
         kMaxNestedStructs     = 4,  ///< Maximum number of nested structs.
     };
 
+    // Terminates the `Encode()` recursion.
+    otError Encode(void) { return OT_ERROR_NONE; }
+
+    // Overloads mapping each supported argument type to its typed `Write<SomeType>()` method.
+    otError Write(bool aBool) { return WriteBool(aBool); }
+    otError Write(uint8_t aUint8) { return WriteUint8(aUint8); }
+    otError Write(int8_t aInt8) { return WriteInt8(aInt8); }
+    otError Write(uint16_t aUint16) { return WriteUint16(aUint16); }
+    otError Write(int16_t aInt16) { return WriteInt16(aInt16); }
+    otError Write(uint32_t aUint32) { return WriteUint32(aUint32); }
+    otError Write(int32_t aInt32) { return WriteInt32(aInt32); }
+    otError Write(uint64_t aUint64) { return WriteUint64(aUint64); }
+    otError Write(int64_t aInt64) { return WriteInt64(aInt64); }
+    otError Write(const UintPacked &aUint) { return WriteUintPacked(aUint.mValue); }
+    otError Write(const char *aUtf8) { return WriteUtf8(aUtf8); }
+    otError Write(const spinel_ipv6addr_t &aIp6Addr) { return WriteIp6Address(aIp6Addr); }
+    otError Write(const otIp6Address &aIp6Addr) { return WriteIp6Address(aIp6Addr); }
+    otError Write(const spinel_eui64_t &aEui64) { return WriteEui64(aEui64); }
+    otError Write(const otExtAddress &aExtAddress) { return WriteEui64(aExtAddress); }
+    otError Write(const spinel_eui48_t &aEui48) { return WriteEui48(aEui48); }
+
     Spinel::Buffer &              mNcpBuffer;
     Spinel::Buffer::WritePosition mStructPosition[kMaxNestedStructs];
     uint8_t                       mNumOpenStructs;
@@ -220,6 +220,9 @@ NcpBase::NcpBase(Instance *aInstance)
     , mDiscoveryScanEnableFiltering(false)
     , mDiscoveryScanPanId(0xffff)
     , mUpdateChangedPropsTask(*aInstance, NcpBase::UpdateChangedProps)
+#if OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+    , mPropUpdateAggregationTimer(*aInstance, NcpBase::HandlePropUpdateAggregationTimer)
+#endif
     , mThreadChangedFlags(0)
     , mHostPowerState(SPINEL_HOST_POWER_STATE_ONLINE)
     , mHostPowerReplyFrameTag(Spinel::Buffer::kInvalidTag)
@@ -229,6 +232,11 @@ NcpBase::NcpBase(Instance *aInstance)
     , mAllowPokeDelegate(nullptr)
 #endif
     , mNextExpectedTid(0)
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+    , mPropListContinuationKey(SPINEL_PROP_LAST_STATUS)
+    , mPropListContinuationToken(0)
+    , mPropListChunkEntries(0)
+#endif
     , mResponseQueueHead(0)
     , mResponseQueueTail(0)
     , mAllowLocalNetworkDataChange(false)
@@ -678,10 +686,9 @@ void NcpBase::Log(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aLog
     VerifyOrExit(IsResponseQueueEmpty(), error = OT_ERROR_NO_BUFS);
 
     SuccessOrExit(error = mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_LOG));
-    SuccessOrExit(error = mEncoder.WriteUtf8(aLogString));
-    SuccessOrExit(error = mEncoder.WriteUint8(ConvertLogLevel(aLogLevel)));
-    SuccessOrExit(error = mEncoder.WriteUintPacked(ConvertLogRegion(aLogRegion)));
-    SuccessOrExit(error = mEncoder.WriteUint64(mLogTimestampBase + otPlatAlarmMilliGetNow()));
+    SuccessOrExit(error = mEncoder.Encode(aLogString, ConvertLogLevel(aLogLevel),
+                                          Spinel::UintPacked(ConvertLogRegion(aLogRegion)),
+                                          static_cast<uint64_t>(mLogTimestampBase + otPlatAlarmMilliGetNow())));
     SuccessOrExit(error = mEncoder.EndFrame());
 
 exit:
@@ -883,7 +890,21 @@ void NcpBase::UpdateChangedProps(void)
         }
         else if (mDidInitialUpdates)
         {
+#if OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+            // Hold back property updates for the aggregation window, so
+            // that a burst of changes is coalesced into a single
+            // multi-property `CMD_PROP_VALUES_ARE` frame when the
+            // window closes. `LAST_STATUS` updates are never delayed.
+
+            if (!mPropUpdateAggregationTimer.IsRunning())
+            {
+                mPropUpdateAggregationTimer.Start(OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME);
+            }
+
+            continue;
+#else
             SuccessOrExit(WritePropertyValueIsFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, propKey));
+#endif
         }
 
         mChangedPropsSet.RemoveEntry(index);
@@ -894,6 +915,106 @@ exit:
     mDidInitialUpdates = true;
 }
 
+#if OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+void NcpBase::HandlePropUpdateAggregationTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+    GetNcpInstance()->EmitAggregatedPropertyUpdates();
+}
+
+void NcpBase::EmitAggregatedPropertyUpdates(void)
+{
+    otError                       error      = OT_ERROR_NONE;
+    uint8_t                       numChanged = 0;
+    uint64_t                      encodedSet = 0;
+    uint8_t                       numEntries;
+    const ChangedPropsSet::Entry *entry;
+
+    entry = mChangedPropsSet.GetSupportedEntries(numEntries);
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (mChangedPropsSet.IsEntryChanged(index) && (entry[index].mPropKey != SPINEL_PROP_LAST_STATUS))
+        {
+            numChanged++;
+        }
+    }
+
+    VerifyOrExit(numChanged != 0);
+
+    if (numChanged == 1)
+    {
+        // A single changed property is emitted as a plain
+        // `CMD_PROP_VALUE_IS` frame, identical to the non-aggregated
+        // behavior.
+
+        for (uint8_t index = 0; index < numEntries; index++)
+        {
+            if (!mChangedPropsSet.IsEntryChanged(index) || (entry[index].mPropKey == SPINEL_PROP_LAST_STATUS))
+            {
+                continue;
+            }
+
+            SuccessOrExit(
+                error = WritePropertyValueIsFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, entry[index].mPropKey));
+            mChangedPropsSet.RemoveEntry(index);
+        }
+
+        ExitNow();
+    }
+
+    // Encode all changed properties into a single `CMD_PROP_VALUES_ARE`
+    // frame, each as a struct containing the property key followed by
+    // its value. Entries are removed from the changed set only after
+    // the frame is successfully ended, so that a failed (out of buffer
+    // space) frame leaves them pending for the retry.
+
+    SuccessOrExit(error = mEncoder.BeginFrame(SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0, SPINEL_CMD_PROP_VALUES_ARE));
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        PropertyHandler handler;
+
+        if (!mChangedPropsSet.IsEntryChanged(index) || (entry[index].mPropKey == SPINEL_PROP_LAST_STATUS))
+        {
+            continue;
+        }
+
+        handler = FindGetPropertyHandler(entry[index].mPropKey);
+
+        if (handler == nullptr)
+        {
+            mChangedPropsSet.RemoveEntry(index);
+            continue;
+        }
+
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUintPacked(entry[index].mPropKey));
+        SuccessOrExit(error = (this->*handler)());
+        SuccessOrExit(error = mEncoder.CloseStruct());
+
+        encodedSet |= (1ULL << index);
+    }
+
+    SuccessOrExit(error = mEncoder.EndFrame());
+
+    for (uint8_t index = 0; index < numEntries; index++)
+    {
+        if (encodedSet & (1ULL << index))
+        {
+            mChangedPropsSet.RemoveEntry(index);
+        }
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        // Likely out of buffer space; retry after another window.
+        mPropUpdateAggregationTimer.Start(OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME);
+    }
+}
+#endif // OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+
 // ----------------------------------------------------------------------------
 // MARK: Inbound Command Handler
 // ----------------------------------------------------------------------------
@@ -1138,6 +1259,47 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+
+uint16_t NcpBase::BeginPropertyListChunk(spinel_prop_key_t aPropKey)
+{
+    uint16_t token = 0;
+
+    if (mPropListContinuationKey == aPropKey)
+    {
+        token = mPropListContinuationToken;
+    }
+
+    // Any pending continuation is consumed/cleared here, so it only
+    // survives until the next encoding of a list property (i.e., an
+    // interleaved get of another property or an unsolicited table
+    // update restarts the iteration).
+
+    mPropListContinuationKey = SPINEL_PROP_LAST_STATUS;
+    mPropListChunkEntries    = 0;
+
+    return token;
+}
+
+bool NcpBase::ShouldSuspendPropertyListChunk(spinel_prop_key_t aPropKey, uint16_t aToken)
+{
+    bool shouldSuspend = (mPropListChunkEntries >= OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES);
+
+    if (shouldSuspend)
+    {
+        mPropListContinuationKey   = aPropKey;
+        mPropListContinuationToken = aToken;
+    }
+    else
+    {
+        mPropListChunkEntries++;
+    }
+
+    return shouldSuspend;
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+
 otError NcpBase::WritePropertyValueIsFrame(uint8_t aHeader, spinel_prop_key_t aPropKey, bool aIsGetResponse)
 {
     otError         error   = OT_ERROR_NONE;
@@ -57,6 +57,7 @@
 #include "changed_props_set.hpp"
 #include "common/instance.hpp"
 #include "common/tasklet.hpp"
+#include "common/timer.hpp"
 #include "lib/spinel/spinel.h"
 #include "lib/spinel/spinel_buffer.hpp"
 #include "lib/spinel/spinel_decoder.hpp"
@@ -232,6 +233,20 @@ protected:
     otError HandleCommandPropertySet(uint8_t aHeader, spinel_prop_key_t aKey);
     otError HandleCommandPropertyInsertRemove(uint8_t aHeader, spinel_prop_key_t aKey, unsigned int aCommand);
 
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+    // Chunked encoding of list-type property get responses. A handler
+    // calls `BeginPropertyListChunk()` to obtain the continuation token
+    // (iteration position) saved by a previous truncated response to
+    // the same property (zero when starting over), and checks
+    // `ShouldSuspendPropertyListChunk()` before encoding each entry.
+    // When the per-frame entry limit is reached, the latter saves
+    // @p aToken as the continuation token and returns TRUE, and the
+    // handler is expected to stop encoding.
+
+    uint16_t BeginPropertyListChunk(spinel_prop_key_t aPropKey);
+    bool     ShouldSuspendPropertyListChunk(spinel_prop_key_t aPropKey, uint16_t aToken);
+#endif
+
     otError WriteLastStatusFrame(uint8_t aHeader, spinel_status_t aLastStatus);
     otError WritePropertyValueIsFrame(uint8_t aHeader, spinel_prop_key_t aPropKey, bool aIsGetResponse = true);
     otError WritePropertyValueInsertedRemovedFrame(uint8_t           aHeader,
@@ -262,6 +277,11 @@ protected:
     static void UpdateChangedProps(Tasklet &aTasklet);
     void        UpdateChangedProps(void);
 
+#if OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+    static void HandlePropUpdateAggregationTimer(Timer &aTimer);
+    void        EmitAggregatedPropertyUpdates(void);
+#endif
+
     static void HandleFrameRemovedFromNcpBuffer(void *                   aContext,
                                                 Spinel::Buffer::FrameTag aFrameTag,
                                                 Spinel::Buffer::Priority aPriority,
@@ -585,6 +605,9 @@ protected:
     uint16_t        mDiscoveryScanPanId;
 
     Tasklet         mUpdateChangedPropsTask;
+#if OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+    TimerMilli      mPropUpdateAggregationTimer;
+#endif
     uint32_t        mThreadChangedFlags;
     ChangedPropsSet mChangedPropsSet;
 
@@ -601,6 +624,12 @@ protected:
 
     spinel_tid_t mNextExpectedTid;
 
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+    spinel_prop_key_t mPropListContinuationKey; // `SPINEL_PROP_LAST_STATUS` when no continuation is pending.
+    uint16_t          mPropListContinuationToken;
+    uint16_t          mPropListChunkEntries;
+#endif
+
     uint8_t       mResponseQueueHead;
     uint8_t       mResponseQueueTail;
     ResponseEntry mResponseQueue[kResponseQueueSize];
@@ -209,16 +209,25 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_CHILD_TABLE>(v
     otError     error = OT_ERROR_NONE;
     otChildInfo childInfo;
     uint16_t    maxChildren;
+    uint16_t    index = 0;
 
     maxChildren = otThreadGetMaxAllowedChildren(mInstance);
 
-    for (uint16_t index = 0; index < maxChildren; index++)
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+    index = BeginPropertyListChunk(SPINEL_PROP_THREAD_CHILD_TABLE);
+#endif
+
+    for (; index < maxChildren; index++)
     {
         if ((otThreadGetChildInfoByIndex(mInstance, index, &childInfo) != OT_ERROR_NONE) || childInfo.mIsStateRestoring)
         {
             continue;
         }
 
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+        VerifyOrExit(!ShouldSuspendPropertyListChunk(SPINEL_PROP_THREAD_CHILD_TABLE, index));
+#endif
+
         SuccessOrExit(error = mEncoder.OpenStruct());
         SuccessOrExit(error = EncodeChildInfo(childInfo));
         SuccessOrExit(error = mEncoder.CloseStruct());
@@ -233,16 +242,25 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ROUTER_TABLE>(
     otError      error = OT_ERROR_NONE;
     otRouterInfo routerInfo;
     uint8_t      maxRouterId;
+    uint8_t      routerId = 0;
 
     maxRouterId = otThreadGetMaxRouterId(mInstance);
 
-    for (uint8_t routerId = 0; routerId <= maxRouterId; routerId++)
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+    routerId = static_cast<uint8_t>(BeginPropertyListChunk(SPINEL_PROP_THREAD_ROUTER_TABLE));
+#endif
+
+    for (; routerId <= maxRouterId; routerId++)
     {
         if ((otThreadGetRouterInfo(mInstance, routerId, &routerInfo) != OT_ERROR_NONE) || !routerInfo.mAllocated)
         {
             continue;
         }
 
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+        VerifyOrExit(!ShouldSuspendPropertyListChunk(SPINEL_PROP_THREAD_ROUTER_TABLE, routerId));
+#endif
+
         SuccessOrExit(error = mEncoder.OpenStruct());
 
         SuccessOrExit(error = mEncoder.WriteEui64(routerInfo.mExtAddress));
@@ -856,10 +856,26 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NEIGHBOR_TABLE
     otNeighborInfoIterator iter  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
     otNeighborInfo         neighInfo;
 
+#if OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+    iter = static_cast<otNeighborInfoIterator>(BeginPropertyListChunk(SPINEL_PROP_THREAD_NEIGHBOR_TABLE));
+
+    for (otNeighborInfoIterator prevIter = iter; otThreadGetNextNeighborInfo(mInstance, &iter, &neighInfo) == OT_ERROR_NONE;
+         prevIter                        = iter)
+    {
+        // On suspension, save the iterator value from before this entry
+        // so that the entry is re-visited in the next chunk.
+
+        VerifyOrExit(!ShouldSuspendPropertyListChunk(SPINEL_PROP_THREAD_NEIGHBOR_TABLE,
+                                                     static_cast<uint16_t>(prevIter)));
+
+        SuccessOrExit(error = EncodeNeighborInfo(neighInfo));
+    }
+#else
     while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighInfo) == OT_ERROR_NONE)
     {
         SuccessOrExit(error = EncodeNeighborInfo(neighInfo));
     }
+#endif
 
 exit:
     return error;
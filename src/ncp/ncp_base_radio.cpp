@@ -253,6 +253,34 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_RAW_RX_FILTER>(void)
+{
+    otError           error = OT_ERROR_NONE;
+    bool              enabled;
+    otLinkRawRxFilter filter;
+
+    SuccessOrExit(error = mDecoder.ReadBool(enabled));
+
+    if (!enabled)
+    {
+        error = otLinkRawSetRxFilter(mInstance, nullptr);
+        ExitNow();
+    }
+
+    SuccessOrExit(error = mDecoder.ReadUint8(filter.mFrameTypeMask));
+    SuccessOrExit(error = mDecoder.ReadBool(filter.mFilterPanId));
+    SuccessOrExit(error = mDecoder.ReadUint16(filter.mPanId));
+    SuccessOrExit(error = mDecoder.ReadBool(filter.mFilterSrcShort));
+    SuccessOrExit(error = mDecoder.ReadUint16(filter.mSrcShortAddress));
+
+    error = otLinkRawSetRxFilter(mInstance, &filter);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_LINK_RAW_RX_FILTER_ENABLE
+
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES>(void)
 {
     otError error = OT_ERROR_NONE;
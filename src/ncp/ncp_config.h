@@ -69,6 +69,40 @@
 #define OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE 2048
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+ *
+ * The maximum number of table entries encoded into a single spinel frame when responding to a `VALUE_GET` of a
+ * list-type property (e.g., the child or neighbor table). Zero (the default) disables chunking, encoding the full
+ * table into one frame.
+ *
+ * When a response is truncated at this limit, a continuation token is saved and an immediately repeated `VALUE_GET`
+ * of the same property resumes from where the previous response stopped. The host fetches the full table by
+ * repeating the get until it receives a response with fewer than the maximum number of entries. This bounds the
+ * spinel TX buffer space a single response can require independent of the table size.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_NCP_PROP_GET_CHUNK_MAX_ENTRIES 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+ *
+ * The aggregation window (in milliseconds) over which unsolicited property change updates are coalesced. Zero (the
+ * default) disables aggregation, emitting a `CMD_PROP_VALUE_IS` frame per changed property as soon as the buffer
+ * allows.
+ *
+ * When non-zero, the first property change after an idle period starts the window and further changes within it are
+ * collected, so that when the window closes all changed properties are emitted together in a single multi-property
+ * `CMD_PROP_VALUES_ARE` frame. This cuts the number of frames (and host wakeups) during state churn, e.g., while
+ * attaching. `LAST_STATUS` updates are never delayed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME
+#define OPENTHREAD_CONFIG_NCP_PROP_UPDATE_AGGREGATION_TIME 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_HDLC_TX_CHUNK_SIZE
  *
@@ -79,6 +113,19 @@
 #define OPENTHREAD_CONFIG_NCP_HDLC_TX_CHUNK_SIZE 2048
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_HDLC_ENCODE_CHUNK_SIZE
+ *
+ * The number of spinel frame bytes read from the NCP TX frame buffer and HDLC-encoded in one step.
+ *
+ * Larger values amortize the per-byte frame parsing cost of the spinel buffer when encoding outgoing frames. Set
+ * to 1 to encode byte by byte.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_HDLC_ENCODE_CHUNK_SIZE
+#define OPENTHREAD_CONFIG_NCP_HDLC_ENCODE_CHUNK_SIZE 64
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_HDLC_RX_BUFFER_SIZE
  *
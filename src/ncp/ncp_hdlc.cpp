@@ -85,7 +85,7 @@ NcpHdlc::NcpHdlc(Instance *aInstance, otNcpHdlcSendCallback aSendCallback)
     , mFrameEncoder(mHdlcBuffer)
     , mFrameDecoder(mRxBuffer, &NcpHdlc::HandleFrame, this)
     , mState(kStartingFrame)
-    , mByte(0)
+    , mEncodeChunkLength(0)
     , mHdlcSendImmediate(false)
     , mHdlcSendTask(*aInstance, EncodeAndSend)
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
@@ -154,13 +154,13 @@ void NcpHdlc::EncodeAndSend(void)
 
             while (!txFrameBuffer.OutFrameHasEnded())
             {
-                mByte = txFrameBuffer.OutFrameReadByte();
+                mEncodeChunkLength = txFrameBuffer.OutFrameRead(kEncodeChunkSize, mEncodeChunk);
 
                 OT_FALL_THROUGH;
 
             case kEncodingFrame:
 
-                SuccessOrExit(mFrameEncoder.Encode(mByte));
+                SuccessOrExit(mFrameEncoder.Encode(mEncodeChunk, mEncodeChunkLength));
             }
 
             // track the change of mHostPowerStateInProgress by the
@@ -357,6 +357,19 @@ uint8_t NcpHdlc::BufferEncrypterReader::OutFrameReadByte(void)
     return mDataBuffer[mDataBufferReadIndex++];
 }
 
+uint16_t NcpHdlc::BufferEncrypterReader::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
+{
+    uint16_t bytesRead = 0;
+
+    while ((bytesRead < aReadLength) && (mDataBufferReadIndex < mOutputDataLength))
+    {
+        *aDataBuffer++ = mDataBuffer[mDataBufferReadIndex++];
+        bytesRead++;
+    }
+
+    return bytesRead;
+}
+
 otError NcpHdlc::BufferEncrypterReader::OutFrameRemove(void)
 {
     return mTxFrameBuffer.OutFrameRemove();
@@ -76,8 +76,12 @@ private:
         kHdlcTxBufferSize = OPENTHREAD_CONFIG_NCP_HDLC_TX_CHUNK_SIZE,   // HDLC tx buffer size.
         kRxBufferSize     = OPENTHREAD_CONFIG_NCP_HDLC_RX_BUFFER_SIZE + // Rx buffer size (should be large enough to fit
                         OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE, // one whole (decoded) received frame).
+        kEncodeChunkSize = OPENTHREAD_CONFIG_NCP_HDLC_ENCODE_CHUNK_SIZE, // Max spinel bytes bulk-encoded per step.
     };
 
+    static_assert(kHdlcTxBufferSize >= 2 * kEncodeChunkSize + 6,
+                  "NCP HDLC tx buffer should fit a fully-escaped encode chunk");
+
     enum HdlcTxState
     {
         kStartingFrame,   // Starting a new frame.
@@ -98,11 +102,12 @@ private:
          * Takes a reference to Spinel::Buffer in order to read spinel frames.
          */
         explicit BufferEncrypterReader(Spinel::Buffer &aTxFrameBuffer);
-        bool    IsEmpty(void) const;
-        otError OutFrameBegin(void);
-        bool    OutFrameHasEnded(void);
-        uint8_t OutFrameReadByte(void);
-        otError OutFrameRemove(void);
+        bool     IsEmpty(void) const;
+        otError  OutFrameBegin(void);
+        bool     OutFrameHasEnded(void);
+        uint8_t  OutFrameReadByte(void);
+        uint16_t OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer);
+        otError  OutFrameRemove(void);
 
     private:
         void Reset(void);
@@ -132,7 +137,8 @@ private:
     Hdlc::Decoder                        mFrameDecoder;
     Hdlc::FrameBuffer<kHdlcTxBufferSize> mHdlcBuffer;
     HdlcTxState                          mState;
-    uint8_t                              mByte;
+    uint8_t                              mEncodeChunk[kEncodeChunkSize]; // Spinel frame bytes pending encode.
+    uint16_t                             mEncodeChunkLength;             // Number of valid bytes in `mEncodeChunk`.
     Hdlc::FrameBuffer<kRxBufferSize>     mRxBuffer;
     bool                                 mHdlcSendImmediate;
     Tasklet                              mHdlcSendTask;
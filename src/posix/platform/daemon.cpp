@@ -69,6 +69,104 @@ void GetFilename(Filename &aFilename, const char *aPattern)
 
 } // namespace
 
+void Daemon::CloseSession(Session &aSession)
+{
+    close(aSession.mSocket);
+    aSession.mSocket       = -1;
+    aSession.mOutputStart  = 0;
+    aSession.mOutputLength = 0;
+
+    if (mActiveSession == &aSession)
+    {
+        mActiveSession = nullptr;
+    }
+}
+
+void Daemon::WriteToSession(Session &aSession, const uint8_t *aData, size_t aLength)
+{
+    ssize_t rval;
+
+    // Flush any already buffered output first to preserve ordering,
+    // then try writing directly and buffer whatever the (non-blocking)
+    // socket does not take.
+
+    FlushSession(aSession);
+    VerifyOrExit(aSession.IsConnected());
+
+    if (aSession.mOutputLength == 0)
+    {
+#if defined(__linux__)
+        // Don't die on SIGPIPE
+        rval = send(aSession.mSocket, aData, aLength, MSG_NOSIGNAL);
+#else
+        rval = write(aSession.mSocket, aData, aLength);
+#endif
+
+        if (rval < 0)
+        {
+            VerifyOrExit((errno == EAGAIN) || (errno == EWOULDBLOCK),
+                         otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
+                         CloseSession(aSession));
+            rval = 0;
+        }
+
+        aData += rval;
+        aLength -= static_cast<size_t>(rval);
+    }
+
+    VerifyOrExit(aLength > 0);
+
+    VerifyOrExit(aLength <= kOutputBufferSize - aSession.mOutputLength,
+                 otLogWarnPlat("Session output buffer overflow, closing session");
+                 CloseSession(aSession));
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aSession.mOutputBuffer[(aSession.mOutputStart + aSession.mOutputLength + i) % kOutputBufferSize] = aData[i];
+    }
+
+    aSession.mOutputLength += aLength;
+
+exit:
+    return;
+}
+
+void Daemon::FlushSession(Session &aSession)
+{
+    while (aSession.mOutputLength > 0)
+    {
+        size_t  length = OT_MIN(aSession.mOutputLength, kOutputBufferSize - aSession.mOutputStart);
+        ssize_t rval;
+
+#if defined(__linux__)
+        rval = send(aSession.mSocket, &aSession.mOutputBuffer[aSession.mOutputStart], length, MSG_NOSIGNAL);
+#else
+        rval = write(aSession.mSocket, &aSession.mOutputBuffer[aSession.mOutputStart], length);
+#endif
+
+        if (rval < 0)
+        {
+            VerifyOrExit((errno == EAGAIN) || (errno == EWOULDBLOCK),
+                         otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
+                         CloseSession(aSession));
+            ExitNow();
+        }
+
+        aSession.mOutputStart = (aSession.mOutputStart + static_cast<size_t>(rval)) % kOutputBufferSize;
+        aSession.mOutputLength -= static_cast<size_t>(rval);
+
+        if (aSession.mOutputLength == 0)
+        {
+            aSession.mOutputStart = 0;
+        }
+
+        VerifyOrExit(static_cast<size_t>(rval) == length);
+    }
+
+exit:
+    return;
+}
+
 int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
 {
     char buf[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH + 1];
@@ -80,20 +178,23 @@ int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
 
     VerifyOrExit(rval >= 0, otLogWarnPlat("Failed to format CLI output: %s", strerror(errno)));
 
-    VerifyOrExit(mSessionSocket != -1);
+    // Output produced while processing a session's input line goes to
+    // that session only. Asynchronous output (e.g., from an earlier
+    // command finishing later) is sent to all connected sessions.
 
-#if defined(__linux__)
-    // Don't die on SIGPIPE
-    rval = send(mSessionSocket, buf, static_cast<size_t>(rval), MSG_NOSIGNAL);
-#else
-    rval = static_cast<int>(write(mSessionSocket, buf, static_cast<size_t>(rval)));
-#endif
-
-    if (rval < 0)
+    if (mActiveSession != nullptr)
     {
-        otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        WriteToSession(*mActiveSession, reinterpret_cast<const uint8_t *>(buf), static_cast<size_t>(rval));
+    }
+    else
+    {
+        for (Session &session : mSessions)
+        {
+            if (session.IsConnected())
+            {
+                WriteToSession(session, reinterpret_cast<const uint8_t *>(buf), static_cast<size_t>(rval));
+            }
+        }
     }
 
 exit:
@@ -102,8 +203,9 @@ exit:
 
 void Daemon::InitializeSessionSocket(void)
 {
-    int newSessionSocket;
-    int rval;
+    Session *session = nullptr;
+    int      newSessionSocket;
+    int      rval;
 
     VerifyOrExit((newSessionSocket = accept(mListenSocket, nullptr, nullptr)) != -1, rval = -1);
 
@@ -113,6 +215,15 @@ void Daemon::InitializeSessionSocket(void)
 
     VerifyOrExit((rval = fcntl(newSessionSocket, F_SETFD, rval)) != -1);
 
+    // Session sockets are non-blocking so that a slow reader can never
+    // stall the daemon (output is buffered per session instead).
+
+    VerifyOrExit((rval = fcntl(newSessionSocket, F_GETFL, 0)) != -1);
+
+    rval |= O_NONBLOCK;
+
+    VerifyOrExit((rval = fcntl(newSessionSocket, F_SETFL, rval)) != -1);
+
 #ifndef __linux__
     // some platforms (macOS, Solaris) don't have MSG_NOSIGNAL
     // SOME of those (macOS, but NOT Solaris) support SO_NOSIGPIPE
@@ -126,11 +237,32 @@ void Daemon::InitializeSessionSocket(void)
 #endif
 #endif // __linux__
 
-    if (mSessionSocket != -1)
+    // Use a free session slot if available, otherwise displace the
+    // oldest session (matching the previous single-session behavior
+    // where a new connection replaced the existing one).
+
+    for (Session &cur : mSessions)
+    {
+        if (!cur.IsConnected())
+        {
+            session = &cur;
+            break;
+        }
+
+        if ((session == nullptr) || (cur.mAcceptOrder < session->mAcceptOrder))
+        {
+            session = &cur;
+        }
+    }
+
+    if (session->IsConnected())
     {
-        close(mSessionSocket);
+        otLogWarnPlat("Maximum number of daemon sessions reached, closing the oldest session");
+        CloseSession(*session);
     }
-    mSessionSocket = newSessionSocket;
+
+    session->mSocket      = newSessionSocket;
+    session->mAcceptOrder = mAcceptCounter++;
 
 exit:
     if (rval == -1)
@@ -195,10 +327,7 @@ void Daemon::SetUp(void)
         DieNowWithMessage("bind", OT_EXIT_ERROR_ERRNO);
     }
 
-    //
-    // only accept 1 connection.
-    //
-    ret = listen(mListenSocket, 1);
+    ret = listen(mListenSocket, kMaxSessions);
     if (ret == -1)
     {
         DieNowWithMessage("listen", OT_EXIT_ERROR_ERRNO);
@@ -221,10 +350,12 @@ void Daemon::TearDown(void)
 {
     Mainloop::Manager::Get().Remove(*this);
 
-    if (mSessionSocket != -1)
+    for (Session &session : mSessions)
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        if (session.IsConnected())
+        {
+            CloseSession(session);
+        }
     }
 
     if (mListenSocket != -1)
@@ -263,14 +394,24 @@ void Daemon::Update(otSysMainloopContext &aContext)
         }
     }
 
-    if (mSessionSocket != -1)
+    for (Session &session : mSessions)
     {
-        FD_SET(mSessionSocket, &aContext.mReadFdSet);
-        FD_SET(mSessionSocket, &aContext.mErrorFdSet);
+        if (!session.IsConnected())
+        {
+            continue;
+        }
+
+        FD_SET(session.mSocket, &aContext.mReadFdSet);
+        FD_SET(session.mSocket, &aContext.mErrorFdSet);
 
-        if (aContext.mMaxFd < mSessionSocket)
+        if (session.mOutputLength > 0)
         {
-            aContext.mMaxFd = mSessionSocket;
+            FD_SET(session.mSocket, &aContext.mWriteFdSet);
+        }
+
+        if (aContext.mMaxFd < session.mSocket)
+        {
+            aContext.mMaxFd = session.mSocket;
         }
     }
 
@@ -292,34 +433,53 @@ void Daemon::Process(const otSysMainloopContext &aContext)
         InitializeSessionSocket();
     }
 
-    VerifyOrExit(mSessionSocket != -1);
-
-    if (FD_ISSET(mSessionSocket, &aContext.mErrorFdSet))
+    for (Session &session : mSessions)
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
-    }
-    else if (FD_ISSET(mSessionSocket, &aContext.mReadFdSet))
-    {
-        uint8_t buffer[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
+        if (!session.IsConnected())
+        {
+            continue;
+        }
 
-        // leave 1 byte for the null terminator
-        rval = read(mSessionSocket, buffer, sizeof(buffer) - 1);
+        if (FD_ISSET(session.mSocket, &aContext.mErrorFdSet))
+        {
+            CloseSession(session);
+            continue;
+        }
 
-        if (rval > 0)
+        if (FD_ISSET(session.mSocket, &aContext.mWriteFdSet))
         {
-            buffer[rval] = '\0';
-            otLogInfoPlat("> %s", reinterpret_cast<const char *>(buffer));
-            otCliInputLine(reinterpret_cast<char *>(buffer));
+            FlushSession(session);
+
+            if (!session.IsConnected())
+            {
+                continue;
+            }
         }
-        else
+
+        if (FD_ISSET(session.mSocket, &aContext.mReadFdSet))
         {
-            if (rval < 0)
+            uint8_t buffer[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
+
+            // leave 1 byte for the null terminator
+            rval = read(session.mSocket, buffer, sizeof(buffer) - 1);
+
+            if (rval > 0)
+            {
+                buffer[rval] = '\0';
+                otLogInfoPlat("> %s", reinterpret_cast<const char *>(buffer));
+
+                mActiveSession = &session;
+                otCliInputLine(reinterpret_cast<char *>(buffer));
+                mActiveSession = nullptr;
+            }
+            else
             {
-                otLogWarnPlat("Daemon read: %s", strerror(errno));
+                if (rval < 0)
+                {
+                    otLogWarnPlat("Daemon read: %s", strerror(errno));
+                }
+                CloseSession(session);
             }
-            close(mSessionSocket);
-            mSessionSocket = -1;
         }
     }
 
@@ -30,6 +30,9 @@
 
 #include "openthread-posix-config.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "core/common/non_copyable.hpp"
 #include "posix/platform/mainloop.hpp"
 
@@ -47,12 +50,37 @@ public:
     void Process(const otSysMainloopContext &aContext) override;
 
 private:
+    static constexpr uint8_t kMaxSessions      = OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS;
+    static constexpr size_t  kOutputBufferSize = OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE;
+
+    // Represents a single accepted control session. Output which
+    // cannot be written to the (non-blocking) session socket
+    // immediately is kept in a per-session ring buffer and flushed
+    // from the mainloop when the socket becomes writable, so a slow
+    // reader never blocks the daemon or the other sessions.
+
+    struct Session
+    {
+        bool IsConnected(void) const { return mSocket != -1; }
+
+        int      mSocket       = -1;
+        uint64_t mAcceptOrder  = 0; // Monotonic accept counter value (used to find the oldest session).
+        size_t   mOutputStart  = 0; // Ring buffer read position.
+        size_t   mOutputLength = 0; // Number of buffered output bytes pending write.
+        uint8_t  mOutputBuffer[kOutputBufferSize];
+    };
+
     int  OutputFormatV(const char *aFormat, va_list aArguments);
     void InitializeSessionSocket(void);
+    void CloseSession(Session &aSession);
+    void WriteToSession(Session &aSession, const uint8_t *aData, size_t aLength);
+    void FlushSession(Session &aSession);
 
-    int mListenSocket  = -1;
-    int mDaemonLock    = -1;
-    int mSessionSocket = -1;
+    int      mListenSocket = -1;
+    int      mDaemonLock   = -1;
+    uint64_t mAcceptCounter = 0;
+    Session *mActiveSession = nullptr; // Session whose input line is currently being processed (if any).
+    Session  mSessions[kMaxSessions];
 };
 
 } // namespace Posix
@@ -133,6 +133,7 @@ HdlcInterface::HdlcInterface(SpinelInterface::ReceiveFrameCallback aCallback,
     , mBaudRate(0)
     , mHdlcDecoder(aFrameBuffer, HandleHdlcFrame, this)
     , mRadioUrl(nullptr)
+    , mDecodeErrorCount(0)
 {
 }
 
@@ -189,13 +190,16 @@ void HdlcInterface::Read(void)
     uint8_t buffer[kMaxFrameSize];
     ssize_t rval;
 
-    rval = read(mSockFd, buffer, sizeof(buffer));
+    // Drain all bytes queued on the (non-blocking) descriptor so that
+    // a burst of frames is decoded and handed to the upper layer in a
+    // single wakeup, rather than one read per mainloop iteration.
 
-    if (rval > 0)
+    while ((rval = read(mSockFd, buffer, sizeof(buffer))) > 0)
     {
         Decode(buffer, static_cast<uint16_t>(rval));
     }
-    else if ((rval < 0) && (errno != EAGAIN) && (errno != EINTR))
+
+    if ((rval < 0) && (errno != EAGAIN) && (errno != EINTR))
     {
         DieNow(OT_EXIT_ERROR_ERRNO);
     }
@@ -660,6 +664,7 @@ void HdlcInterface::HandleHdlcFrame(otError aError)
     else
     {
         mReceiveFrameBuffer.DiscardFrame();
+        mDecodeErrorCount++;
         otLogWarnPlat("Error decoding hdlc frame: %s", otThreadErrorToString(aError));
     }
 }
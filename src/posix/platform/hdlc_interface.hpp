@@ -157,6 +157,16 @@ public:
      */
     uint32_t GetBusSpeed(void) const { return mBaudRate; }
 
+    /**
+     * This method returns the number of HDLC frames that failed to decode (e.g. FCS/CRC errors).
+     *
+     * A growing count indicates the configured `uart-baudrate` exceeds what the wiring sustains cleanly.
+     *
+     * @returns   Number of frames discarded due to decode errors.
+     *
+     */
+    uint64_t GetDecodeErrorCount(void) const { return mDecodeErrorCount; }
+
     /**
      * This method is called when RCP failure detected and resets internal states of the interface.
      *
@@ -257,6 +267,7 @@ private:
     uint32_t        mBaudRate;
     Hdlc::Decoder   mHdlcDecoder;
     const Url::Url *mRadioUrl;
+    uint64_t        mDecodeErrorCount;
 
     // Non-copyable, intentionally not implemented.
     HdlcInterface(const HdlcInterface &);
@@ -174,6 +174,52 @@ const char *otSysGetThreadNetifName(void);
  */
 unsigned int otSysGetThreadNetifIndex(void);
 
+/**
+ * This function pointer type defines a task callback executed on the thread driving the OpenThread mainloop.
+ *
+ * @param[in] aContext  The task context.
+ *
+ */
+typedef void (*otSysTaskCallback)(void *aContext);
+
+/**
+ * This function posts a task to be executed on the thread driving the OpenThread mainloop.
+ *
+ * OpenThread APIs are not thread-safe. This function may be called from any application thread to run code on the
+ * mainloop thread (between mainloop iterations), where calling OpenThread APIs is safe, without serializing every
+ * call behind an application mutex.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE`.
+ *
+ * @param[in] aCallback  The function to invoke on the mainloop thread (MUST NOT be NULL).
+ * @param[in] aContext   An arbitrary context passed to @p aCallback.
+ *
+ * @retval OT_ERROR_NONE          Successfully posted the task.
+ * @retval OT_ERROR_NO_BUFS       The task queue is full.
+ * @retval OT_ERROR_INVALID_ARGS  @p aCallback is NULL.
+ *
+ */
+otError otSysTaskQueuePost(otSysTaskCallback aCallback, void *aContext);
+
+/**
+ * This function posts a task and blocks the calling thread until the task has been executed on the thread driving
+ * the OpenThread mainloop.
+ *
+ * When called from the mainloop thread itself the task is executed in place, so the function is safe to use from
+ * task callbacks and OpenThread callbacks.
+ *
+ * Requires `OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE`.
+ *
+ * @param[in] aCallback  The function to invoke on the mainloop thread (MUST NOT be NULL).
+ * @param[in] aContext   An arbitrary context passed to @p aCallback.
+ *
+ * @retval OT_ERROR_NONE          The task was executed.
+ * @retval OT_ERROR_NO_BUFS       The task queue is full.
+ * @retval OT_ERROR_INVALID_ARGS  @p aCallback is NULL.
+ *
+ */
+otError otSysTaskQueuePostAndWait(otSysTaskCallback aCallback, void *aContext);
+
 #ifdef __cplusplus
 } // end of extern "C"
 #endif
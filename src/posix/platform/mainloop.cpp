@@ -30,8 +30,25 @@
 
 #include <assert.h>
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+
+#include "posix/platform/platform-posix.h"
+#endif
+
 #include "core/common/code_utils.hpp"
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#ifndef __linux__
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE requires Linux epoll support"
+#endif
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE cannot be combined with OPENTHREAD_POSIX_VIRTUAL_TIME"
+#endif
+#endif
+
 namespace ot {
 namespace Posix {
 namespace Mainloop {
@@ -74,6 +91,152 @@ void Manager::Process(const otSysMainloopContext &aContext)
     }
 }
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+void Manager::UpdateRegistrations(const otSysMainloopContext &aContext)
+{
+    int maxFd = (aContext.mMaxFd > mRegisteredMaxFd) ? aContext.mMaxFd : mRegisteredMaxFd;
+
+    if (mEpollFd < 0)
+    {
+        mEpollFd = epoll_create1(0);
+        VerifyOrDie(mEpollFd >= 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    for (int fd = 0; fd <= maxFd; fd++)
+    {
+        struct epoll_event event;
+        uint32_t           interest   = 0;
+        uint32_t           registered = 0;
+
+        // The error interest is folded into `EPOLLIN` so that an error-only file descriptor stays registered
+        // (epoll reports `EPOLLERR` regardless of the requested events).
+        if (FD_ISSET(fd, &aContext.mReadFdSet) || FD_ISSET(fd, &aContext.mErrorFdSet))
+        {
+            interest |= EPOLLIN;
+        }
+
+        if (FD_ISSET(fd, &aContext.mWriteFdSet))
+        {
+            interest |= EPOLLOUT;
+        }
+
+        if (FD_ISSET(fd, &mRegisteredReadFdSet))
+        {
+            registered |= EPOLLIN;
+        }
+
+        if (FD_ISSET(fd, &mRegisteredWriteFdSet))
+        {
+            registered |= EPOLLOUT;
+        }
+
+        if (interest == registered)
+        {
+            continue;
+        }
+
+        memset(&event, 0, sizeof(event));
+        event.events  = interest;
+        event.data.fd = fd;
+
+        if (interest == 0)
+        {
+            // Failures are ignored since closing a file descriptor removes it from the epoll set automatically.
+            epoll_ctl(mEpollFd, EPOLL_CTL_DEL, fd, &event);
+        }
+        else if (epoll_ctl(mEpollFd, (registered == 0) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &event) != 0)
+        {
+            switch (errno)
+            {
+            case ENOENT:
+                // The file descriptor was closed (and re-opened) since it was registered.
+                VerifyOrDie(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fd, &event) == 0, OT_EXIT_ERROR_ERRNO);
+                break;
+            case EEXIST:
+                VerifyOrDie(epoll_ctl(mEpollFd, EPOLL_CTL_MOD, fd, &event) == 0, OT_EXIT_ERROR_ERRNO);
+                break;
+            default:
+                DieNow(OT_EXIT_ERROR_ERRNO);
+            }
+        }
+
+        if (interest & EPOLLIN)
+        {
+            FD_SET(fd, &mRegisteredReadFdSet);
+        }
+        else
+        {
+            FD_CLR(fd, &mRegisteredReadFdSet);
+        }
+
+        if (interest & EPOLLOUT)
+        {
+            FD_SET(fd, &mRegisteredWriteFdSet);
+        }
+        else
+        {
+            FD_CLR(fd, &mRegisteredWriteFdSet);
+        }
+    }
+
+    mRegisteredMaxFd = aContext.mMaxFd;
+}
+
+int Manager::Poll(otSysMainloopContext &aContext)
+{
+    enum
+    {
+        kMaxEpollEvents  = 64,
+        kMaxEpollTimeout = 0x7fffffff,
+    };
+
+    struct epoll_event events[kMaxEpollEvents];
+    fd_set             errorFdSet = aContext.mErrorFdSet;
+    int                timeout;
+    int                rval;
+
+    UpdateRegistrations(aContext);
+
+    if (aContext.mTimeout.tv_sec >= kMaxEpollTimeout / 1000)
+    {
+        timeout = kMaxEpollTimeout;
+    }
+    else
+    {
+        // Round the timeout up to a millisecond boundary to avoid a busy wakeup before the timeout expires.
+        timeout = static_cast<int>(aContext.mTimeout.tv_sec * 1000 + (aContext.mTimeout.tv_usec + 999) / 1000);
+    }
+
+    FD_ZERO(&aContext.mReadFdSet);
+    FD_ZERO(&aContext.mWriteFdSet);
+    FD_ZERO(&aContext.mErrorFdSet);
+
+    rval = epoll_wait(mEpollFd, events, kMaxEpollEvents, timeout);
+
+    for (int i = 0; i < rval; i++)
+    {
+        int fd = events[i].data.fd;
+
+        if (events[i].events & (EPOLLIN | EPOLLHUP))
+        {
+            FD_SET(fd, &aContext.mReadFdSet);
+        }
+
+        if (events[i].events & EPOLLOUT)
+        {
+            FD_SET(fd, &aContext.mWriteFdSet);
+        }
+
+        if ((events[i].events & (EPOLLERR | EPOLLHUP)) && FD_ISSET(fd, &errorFdSet))
+        {
+            FD_SET(fd, &aContext.mErrorFdSet);
+        }
+    }
+
+    return rval;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
 Manager &Manager::Get(void)
 {
     static Manager sInstance;
@@ -34,6 +34,8 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -108,6 +110,22 @@ public:
      */
     void Remove(Source &aSource);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    /**
+     * This method polls the mainloop context with epoll.
+     *
+     * The epoll registrations persist across mainloop iterations: the file descriptor sets in @p aContext are
+     * compared against the cached registrations and only the changed file descriptors are re-registered. On
+     * return, the file descriptor sets in @p aContext hold the ready file descriptors, same as `select()`.
+     *
+     * @param[inout]    aContext    A reference to the mainloop context.
+     *
+     * @returns The number of ready file descriptors, or -1 on failure (`errno` is set).
+     *
+     */
+    int Poll(otSysMainloopContext &aContext);
+#endif
+
     /**
      * This function returns the Mainloop singleton.
      *
@@ -117,6 +135,21 @@ public:
     static Manager &Get(void);
 
 private:
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    Manager(void)
+    {
+        FD_ZERO(&mRegisteredReadFdSet);
+        FD_ZERO(&mRegisteredWriteFdSet);
+    }
+
+    void UpdateRegistrations(const otSysMainloopContext &aContext);
+
+    int    mEpollFd         = -1;
+    int    mRegisteredMaxFd = -1;
+    fd_set mRegisteredReadFdSet;
+    fd_set mRegisteredWriteFdSet;
+#endif
+
     Source *mSources = nullptr;
 };
 
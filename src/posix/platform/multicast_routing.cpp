@@ -83,9 +83,11 @@ void MulticastRoutingManager::HandleBackboneMulticastListenerEvent(otBackboneRou
     switch (aEvent)
     {
     case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED:
+        AddMulticastListenerCache(aAddress);
         Add(aAddress);
         break;
     case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED:
+        RemoveMulticastListenerCache(aAddress);
         Remove(aAddress);
         break;
     }
@@ -96,6 +98,7 @@ void MulticastRoutingManager::Enable(void)
     VerifyOrExit(!IsEnabled());
 
     InitMulticastRouterSock();
+    SeedMulticastListenerCache();
 
     otLogResultPlat(OT_ERROR_NONE, "MulticastRoutingManager: %s", __FUNCTION__);
 exit:
@@ -135,19 +138,91 @@ exit:
 
 bool MulticastRoutingManager::HasMulticastListener(const Ip6::Address &aAddress) const
 {
-    bool                                      found = false;
-    otBackboneRouterMulticastListenerIterator iter  = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
-    otBackboneRouterMulticastListenerInfo     listenerInfo;
+    bool found = false;
 
-    while (otBackboneRouterMulticastListenerGetNext(gInstance, &iter, &listenerInfo) == OT_ERROR_NONE)
+    if (!mListenerCacheOverflowed)
     {
-        VerifyOrExit(static_cast<const Ip6::Address &>(listenerInfo.mAddress) != aAddress, found = true);
+        // The common path consults the local listener cache which is
+        // kept in sync from the listener events, so kernel upcalls do
+        // not iterate the core listener table through the public API.
+        for (const Ip6::Address &listener : mMulticastListenerCacheTable)
+        {
+            VerifyOrExit(listener != aAddress, found = true);
+        }
+    }
+    else
+    {
+        otBackboneRouterMulticastListenerIterator iter = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+        otBackboneRouterMulticastListenerInfo     listenerInfo;
+
+        while (otBackboneRouterMulticastListenerGetNext(gInstance, &iter, &listenerInfo) == OT_ERROR_NONE)
+        {
+            VerifyOrExit(static_cast<const Ip6::Address &>(listenerInfo.mAddress) != aAddress, found = true);
+        }
     }
 
 exit:
     return found;
 }
 
+void MulticastRoutingManager::AddMulticastListenerCache(const Ip6::Address &aAddress)
+{
+    Ip6::Address *empty = nullptr;
+
+    for (Ip6::Address &listener : mMulticastListenerCacheTable)
+    {
+        VerifyOrExit(listener != aAddress);
+
+        if ((empty == nullptr) && listener.IsUnspecified())
+        {
+            empty = &listener;
+        }
+    }
+
+    if (empty != nullptr)
+    {
+        *empty = aAddress;
+    }
+    else
+    {
+        // Fall back to iterating the core listener table until the
+        // cache is reseeded (on the next enable).
+        mListenerCacheOverflowed = true;
+    }
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::RemoveMulticastListenerCache(const Ip6::Address &aAddress)
+{
+    for (Ip6::Address &listener : mMulticastListenerCacheTable)
+    {
+        if (listener == aAddress)
+        {
+            listener.Clear();
+        }
+    }
+}
+
+void MulticastRoutingManager::SeedMulticastListenerCache(void)
+{
+    otBackboneRouterMulticastListenerIterator iter = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+    otBackboneRouterMulticastListenerInfo     listenerInfo;
+
+    for (Ip6::Address &listener : mMulticastListenerCacheTable)
+    {
+        listener.Clear();
+    }
+
+    mListenerCacheOverflowed = false;
+
+    while (otBackboneRouterMulticastListenerGetNext(gInstance, &iter, &listenerInfo) == OT_ERROR_NONE)
+    {
+        AddMulticastListenerCache(static_cast<const Ip6::Address &>(listenerInfo.mAddress));
+    }
+}
+
 void MulticastRoutingManager::Update(otSysMainloopContext &aContext)
 {
     VerifyOrExit(IsEnabled());
@@ -225,25 +300,40 @@ exit:
 
 void MulticastRoutingManager::ProcessMulticastRouterMessages(void)
 {
-    otError         error = OT_ERROR_NONE;
-    char            buf[sizeof(struct mrt6msg)];
-    int             nr;
-    struct mrt6msg *mrt6msg;
-    Ip6::Address    src, dst;
+    otError error = OT_ERROR_NONE;
+    char    buf[sizeof(struct mrt6msg)];
 
-    nr = read(mMulticastRouterSock, buf, sizeof(buf));
+    // Drain all pending kernel upcalls in one pass so that a burst of
+    // new flows is programmed as one batch, instead of one upcall per
+    // mainloop iteration (the cache expiring also runs once per batch
+    // in `Process()` rather than once per flow).
 
-    VerifyOrExit(nr >= static_cast<int>(sizeof(struct mrt6msg)), error = OT_ERROR_FAILED);
+    for (uint8_t num = 0; num < kMaxUpcallsPerBatch; num++)
+    {
+        int             nr;
+        struct mrt6msg *mrt6msg;
+        Ip6::Address    src, dst;
 
-    mrt6msg = reinterpret_cast<struct mrt6msg *>(buf);
+        nr = recv(mMulticastRouterSock, buf, sizeof(buf), MSG_DONTWAIT);
+
+        if (nr < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OT_ERROR_FAILED);
+            break;
+        }
 
-    VerifyOrExit(mrt6msg->im6_mbz == 0);
-    VerifyOrExit(mrt6msg->im6_msgtype == MRT6MSG_NOCACHE);
+        VerifyOrExit(nr >= static_cast<int>(sizeof(struct mrt6msg)), error = OT_ERROR_FAILED);
 
-    src.SetBytes(mrt6msg->im6_src.s6_addr);
-    dst.SetBytes(mrt6msg->im6_dst.s6_addr);
+        mrt6msg = reinterpret_cast<struct mrt6msg *>(buf);
 
-    error = AddMulticastForwardingCache(src, dst, static_cast<MifIndex>(mrt6msg->im6_mif));
+        VerifyOrExit(mrt6msg->im6_mbz == 0);
+        VerifyOrExit(mrt6msg->im6_msgtype == MRT6MSG_NOCACHE);
+
+        src.SetBytes(mrt6msg->im6_src.s6_addr);
+        dst.SetBytes(mrt6msg->im6_dst.s6_addr);
+
+        error = AddMulticastForwardingCache(src, dst, static_cast<MifIndex>(mrt6msg->im6_mif));
+    }
 
 exit:
     otLogResultPlat(error, "MulticastRoutingManager: %s", __FUNCTION__);
@@ -259,7 +349,9 @@ otError MulticastRoutingManager::AddMulticastForwardingCache(const Ip6::Address
 
     VerifyOrExit(aIif == kMifIndexThread || aIif == kMifIndexBackbone, error = OT_ERROR_INVALID_ARGS);
 
-    ExpireMulticastForwardingCache();
+    // The cache expiring runs on its own interval from `Process()`;
+    // running it here would walk the whole table (with one ioctl per
+    // expiring candidate) for every new flow in a burst.
 
     if (aIif == kMifIndexBackbone)
     {
@@ -504,6 +596,24 @@ void MulticastRoutingManager::MulticastForwardingCache::SetValidPktCnt(unsigned
     mLastUseTime = otPlatTimeGet();
 }
 
+uint16_t MulticastRoutingManager::MulticastForwardingCacheHash(const Ip6::Address &aSrcAddr,
+                                                               const Ip6::Address &aGroupAddr)
+{
+    uint32_t hash = 17;
+
+    for (uint32_t word : aSrcAddr.mFields.m32)
+    {
+        hash = hash * 31 + word;
+    }
+
+    for (uint32_t word : aGroupAddr.mFields.m32)
+    {
+        hash = hash * 31 + word;
+    }
+
+    return static_cast<uint16_t>(hash % kMulitcastForwardingCacheTableSize);
+}
+
 void MulticastRoutingManager::SaveMulticastForwardingCache(const Ip6::Address &              aSrcAddr,
                                                            const Ip6::Address &              aGroupAddr,
                                                            MulticastRoutingManager::MifIndex aIif,
@@ -511,9 +621,20 @@ void MulticastRoutingManager::SaveMulticastForwardingCache(const Ip6::Address &
 {
     MulticastForwardingCache *invalid = nullptr;
     MulticastForwardingCache *oldest  = nullptr;
+    uint16_t                  start   = MulticastForwardingCacheHash(aSrcAddr, aGroupAddr);
 
-    for (MulticastForwardingCache &mfc : mMulticastForwardingCacheTable)
+    // An entry for (S,G) lives within a fixed probe window starting at
+    // the hash of (S,G), so lookup and insert touch at most
+    // `kMulticastForwardingCacheHashWindow` entries instead of walking
+    // the whole table per flow. When the window is full the oldest
+    // entry in the window is evicted, even if the rest of the table
+    // has room.
+
+    for (uint16_t i = 0; i < kMulticastForwardingCacheHashWindow; i++)
     {
+        MulticastForwardingCache &mfc =
+            mMulticastForwardingCacheTable[(start + i) % kMulitcastForwardingCacheTableSize];
+
         if (mfc.IsValid())
         {
             if (mfc.mSrcAddr == aSrcAddr && mfc.mGroupAddr == aGroupAddr)
@@ -55,6 +55,7 @@ public:
 
         : mLastExpireTime(0)
         , mMulticastRouterSock(-1)
+        , mListenerCacheOverflowed(false)
     {
     }
 
@@ -71,6 +72,10 @@ private:
         kMulticastForwardingCacheExpiringInterval = 60,  //< Expire interval of Multicast Forwarding Cache (in seconds)
         kMulitcastForwardingCacheTableSize =
             OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE, //< The max size of MFC table.
+        kMulticastForwardingCacheHashWindow = 16, //< Entries probed from the (S,G) hash on lookup/insert.
+        kMulticastListenerCacheTableSize =
+            OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS, //< The max size of the local listener cache.
+        kMaxUpcallsPerBatch = 32,                      //< Max kernel upcalls drained per mainloop pass.
     };
 
     enum MifIndex : uint8_t
@@ -109,6 +114,9 @@ private:
     void    Add(const Ip6::Address &aAddress);
     void    Remove(const Ip6::Address &aAddress);
     bool    HasMulticastListener(const Ip6::Address &aAddress) const;
+    void    AddMulticastListenerCache(const Ip6::Address &aAddress);
+    void    RemoveMulticastListenerCache(const Ip6::Address &aAddress);
+    void    SeedMulticastListenerCache(void);
     bool    IsEnabled(void) const { return mMulticastRouterSock >= 0; }
     void    InitMulticastRouterSock(void);
     void    FinalizeMulticastRouterSock(void);
@@ -121,6 +129,7 @@ private:
     void    UnblockInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr);
     void    RemoveInboundMulticastForwardingCache(const Ip6::Address &aGroupAddr);
     void    ExpireMulticastForwardingCache(void);
+    static uint16_t MulticastForwardingCacheHash(const Ip6::Address &aSrcAddr, const Ip6::Address &aGroupAddr);
     bool    UpdateMulticastRouteInfo(MulticastForwardingCache &aMfc) const;
     void    RemoveMulticastForwardingCache(MulticastForwardingCache &aMfc) const;
     static const char *MifIndexToString(MifIndex aMif);
@@ -132,8 +141,10 @@ private:
                                                             const Ip6::Address &                   aAddress);
 
     MulticastForwardingCache mMulticastForwardingCacheTable[kMulitcastForwardingCacheTableSize];
+    Ip6::Address             mMulticastListenerCacheTable[kMulticastListenerCacheTableSize];
     uint64_t                 mLastExpireTime;
     int                      mMulticastRouterSock;
+    bool                     mListenerCacheOverflowed;
 };
 
 } // namespace Posix
@@ -85,8 +85,15 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+#include <atomic>
+#include <poll.h>
+#include <pthread.h>
+#endif
+
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
 #include <netinet/in.h>
 #if defined(__APPLE__) || defined(__FreeBSD__)
@@ -147,6 +154,7 @@ extern int
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/logging.hpp"
+#include "common/message.hpp"
 #include "net/ip6_address.hpp"
 
 unsigned int gNetifIndex = 0;
@@ -273,6 +281,183 @@ static bool sIsSyncingState = false;
 
 #define OPENTHREAD_POSIX_LOG_TUN_PACKETS 0
 
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+
+static constexpr uint16_t kIoRingSize = OPENTHREAD_POSIX_CONFIG_NETIF_IO_RING_SIZE;
+
+struct IoPacket
+{
+    uint16_t mLength;
+    uint8_t  mData[kMaxIp6Size + 4];
+};
+
+// A lock-free single-producer single-consumer packet ring. One slot is
+// kept unused to distinguish a full ring from an empty one.
+class IoRing
+{
+public:
+    bool Push(const void *aData, uint16_t aLength)
+    {
+        uint32_t tail    = mTail.load(std::memory_order_relaxed);
+        uint32_t next    = (tail + 1) % kIoRingSize;
+        bool     canPush = (next != mHead.load(std::memory_order_acquire));
+
+        if (canPush)
+        {
+            assert(aLength <= sizeof(mPackets[tail].mData));
+            mPackets[tail].mLength = aLength;
+            memcpy(mPackets[tail].mData, aData, aLength);
+            mTail.store(next, std::memory_order_release);
+        }
+
+        return canPush;
+    }
+
+    const IoPacket *Peek(void) const
+    {
+        uint32_t head = mHead.load(std::memory_order_relaxed);
+
+        return (head == mTail.load(std::memory_order_acquire)) ? nullptr : &mPackets[head];
+    }
+
+    void Pop(void)
+    {
+        mHead.store((mHead.load(std::memory_order_relaxed) + 1) % kIoRingSize, std::memory_order_release);
+    }
+
+private:
+    IoPacket              mPackets[kIoRingSize];
+    std::atomic<uint32_t> mHead{0};
+    std::atomic<uint32_t> mTail{0};
+};
+
+static IoRing            sRxRing;                      ///< Packets from the TUN device towards the stack.
+static IoRing            sTxRing;                      ///< Packets from the stack towards the TUN device.
+static int               sStackWakePipe[2] = {-1, -1}; ///< Wakes the stack mainloop when `sRxRing` gains packets.
+static int               sIoWakePipe[2]    = {-1, -1}; ///< Wakes the I/O thread when `sTxRing` gains packets.
+static pthread_t         sIoThread;
+static std::atomic<bool> sIoThreadRunning{false};
+
+static void drainWakePipe(int aFd)
+{
+    uint8_t byte;
+
+    while (read(aFd, &byte, sizeof(byte)) == sizeof(byte))
+    {
+    }
+}
+
+static void signalWakePipe(int aFd)
+{
+    uint8_t byte = 0;
+
+    // A failed write with a full pipe buffer still leaves a pending
+    // wake-up byte in the pipe, so it can be safely ignored.
+    if ((write(aFd, &byte, sizeof(byte)) < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+    {
+        perror("write");
+    }
+}
+
+static void *ioThreadMain(void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    while (sIoThreadRunning.load(std::memory_order_acquire))
+    {
+        struct pollfd fds[2];
+
+        fds[0].fd      = sTunFd;
+        fds[0].events  = POLLIN;
+        fds[0].revents = 0;
+        fds[1].fd      = sIoWakePipe[0];
+        fds[1].events  = POLLIN;
+        fds[1].revents = 0;
+
+        if (poll(fds, 2, -1) < 0)
+        {
+            VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+            continue;
+        }
+
+        VerifyOrDie((fds[0].revents & (POLLERR | POLLNVAL)) == 0, OT_EXIT_FAILURE);
+
+        if ((fds[1].revents & POLLIN) != 0)
+        {
+            drainWakePipe(sIoWakePipe[0]);
+        }
+
+        for (const IoPacket *packet = sTxRing.Peek(); packet != nullptr; packet = sTxRing.Peek())
+        {
+            if (write(sTunFd, packet->mData, packet->mLength) != packet->mLength)
+            {
+                perror("write");
+            }
+
+            sTxRing.Pop();
+        }
+
+        if ((fds[0].revents & POLLIN) != 0)
+        {
+            char    packet[kMaxIp6Size];
+            ssize_t rval = read(sTunFd, packet, sizeof(packet));
+
+            VerifyOrDie((rval > 0) || (errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR),
+                        OT_EXIT_ERROR_ERRNO);
+
+            if (rval > 0)
+            {
+                if (sRxRing.Push(packet, static_cast<uint16_t>(rval)))
+                {
+                    signalWakePipe(sStackWakePipe[1]);
+                }
+                else
+                {
+                    otLogWarnPlat("[netif] Dropping packet from host, I/O ring is full");
+                }
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+static void startIoThread(void)
+{
+    VerifyOrDie((pipe(sStackWakePipe) == 0) && (pipe(sIoWakePipe) == 0), OT_EXIT_ERROR_ERRNO);
+
+    for (int i = 0; i < 2; i++)
+    {
+        VerifyOrDie(fcntl(sStackWakePipe[i], F_SETFL, O_NONBLOCK) == 0, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(fcntl(sIoWakePipe[i], F_SETFL, O_NONBLOCK) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    sIoThreadRunning.store(true, std::memory_order_release);
+    VerifyOrDie(pthread_create(&sIoThread, nullptr, ioThreadMain, nullptr) == 0, OT_EXIT_FAILURE);
+}
+
+static void stopIoThread(void)
+{
+    VerifyOrExit(sIoThreadRunning.load(std::memory_order_acquire));
+
+    sIoThreadRunning.store(false, std::memory_order_release);
+    signalWakePipe(sIoWakePipe[1]);
+    VerifyOrDie(pthread_join(sIoThread, nullptr) == 0, OT_EXIT_FAILURE);
+
+    for (int i = 0; i < 2; i++)
+    {
+        close(sStackWakePipe[i]);
+        close(sIoWakePipe[i]);
+        sStackWakePipe[i] = -1;
+        sIoWakePipe[i]    = -1;
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+
 #if !defined(__linux__)
 static bool UnicastAddressIsSubscribed(otInstance *aInstance, const otNetifAddress *netAddr)
 {
@@ -782,7 +967,12 @@ static void processReceive(otMessage *aMessage, void *aContext)
     length += 4;
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+    VerifyOrExit(sTxRing.Push(packet, length), error = OT_ERROR_NO_BUFS);
+    signalWakePipe(sIoWakePipe[1]);
+#else
     VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+#endif
 
 exit:
     otMessageFree(aMessage);
@@ -793,19 +983,15 @@ exit:
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+static void processTransmitPacket(otInstance *aInstance, const char *aPacket, size_t aLength)
 {
     otMessage *message = nullptr;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    otError    error   = OT_ERROR_NONE;
+    size_t     offset  = 0;
 
     assert(gInstance == aInstance);
 
-    rval = read(sTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
-
     {
         otMessageSettings settings;
 
@@ -817,19 +1003,144 @@ static void processTransmit(otInstance *aInstance)
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
-    if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
+    if ((aLength >= 4) && (aPacket[0] == 0) && (aPacket[1] == 0))
     {
-        rval -= 4;
+        aLength -= 4;
         offset = 4;
     }
 #endif
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
-    otLogInfoPlat("[netif] Packet to NCP (%hu bytes)", static_cast<uint16_t>(rval));
-    otDumpInfo(OT_LOG_REGION_PLATFORM, "", &packet[offset], static_cast<size_t>(rval));
+    otLogInfoPlat("[netif] Packet to NCP (%hu bytes)", static_cast<uint16_t>(aLength));
+    otDumpInfo(OT_LOG_REGION_PLATFORM, "", &aPacket[offset], aLength);
+#endif
+
+    SuccessOrExit(error = otMessageAppend(message, &aPacket[offset], static_cast<uint16_t>(aLength)));
+
+#if OPENTHREAD_POSIX_CONFIG_NETIF_CHECKSUM_OFFLOAD_ENABLE
+    // The host kernel has already computed or validated the
+    // transport-layer checksum for packets it sends over the tunnel
+    // interface.
+    otMessageSetChecksumVerified(message, true);
+#endif
+
+    error   = otIp6Send(aInstance, message);
+    message = nullptr;
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
+
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
+    }
+}
+#endif // OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+
+#if !OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+static void dropTunPacket(void)
+{
+    // Drain and drop the pending tun packet so that the descriptor does
+    // not remain readable and spin the mainloop while no message buffer
+    // is available.
+
+    char    packet[kMaxIp6Size + 4];
+    ssize_t rval = read(sTunFd, packet, sizeof(packet));
+
+    OT_UNUSED_VARIABLE(rval);
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    // Read the tun payload with `readv()` directly into the message
+    // buffer chain (using the writable chunk iterator), avoiding the
+    // full-datagram copy through a stack buffer.
+
+    // Worst-case chunk count: every buffer in the chain holds at least
+    // `OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE - sizeof(otMessageBuffer)` payload bytes.
+    static constexpr int kMaxIovs = kMaxIp6Size / (OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE - sizeof(otMessageBuffer)) + 2;
+
+    otError                    error   = OT_ERROR_NONE;
+    otMessage *                message = nullptr;
+    ot::Message *              msg;
+    struct iovec               iovs[kMaxIovs];
+    int                        iovCount  = 0;
+    uint16_t                   remaining = kMaxIp6Size;
+    ssize_t                    rval;
+    ot::Message::WritableChunk chunk;
+
+    assert(gInstance == aInstance);
+
+    {
+        otMessageSettings settings;
+
+        settings.mLinkSecurityEnabled = (otThreadGetDeviceRole(aInstance) != OT_DEVICE_ROLE_DISABLED);
+        settings.mPriority            = OT_MESSAGE_PRIORITY_LOW;
+        message                       = otIp6NewMessage(aInstance, &settings);
+        VerifyOrExit(message != nullptr, dropTunPacket(); error = OT_ERROR_NO_BUFS);
+    }
+
+    msg = static_cast<ot::Message *>(message);
+
+    VerifyOrExit((error = msg->SetLength(kMaxIp6Size)) == OT_ERROR_NONE, dropTunPacket());
+
+    msg->GetFirstChunk(0, remaining, chunk);
+
+    while (chunk.GetLength() > 0)
+    {
+        assert(iovCount < kMaxIovs);
+
+        iovs[iovCount].iov_base = chunk.GetData();
+        iovs[iovCount].iov_len  = chunk.GetLength();
+        iovCount++;
+
+        msg->GetNextChunk(remaining, chunk);
+    }
+
+    rval = readv(sTunFd, iovs, iovCount);
+
+    if (rval <= 0)
+    {
+        otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(OT_ERROR_FAILED));
+        otMessageFree(message);
+        message = nullptr;
+        ExitNow();
+    }
+
+    IgnoreError(msg->SetLength(static_cast<uint16_t>(rval)));
+
+#if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
+    // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
+    {
+        uint8_t header[4];
+
+        if ((msg->GetLength() >= sizeof(header)) && (msg->Read(0, header, sizeof(header)) == OT_ERROR_NONE) &&
+            (header[0] == 0) && (header[1] == 0))
+        {
+            msg->RemoveHeader(sizeof(header));
+        }
+    }
+#endif
+
+#if OPENTHREAD_POSIX_LOG_TUN_PACKETS
+    {
+        uint8_t packet[kMaxIp6Size];
+
+        otLogInfoPlat("[netif] Packet to NCP (%hu bytes)", msg->GetLength());
+        IgnoreError(msg->Read(0, packet, msg->GetLength()));
+        otDumpInfo(OT_LOG_REGION_PLATFORM, "", packet, msg->GetLength());
+    }
 #endif
 
-    SuccessOrExit(error = otMessageAppend(message, &packet[offset], static_cast<uint16_t>(rval)));
+#if OPENTHREAD_POSIX_CONFIG_NETIF_CHECKSUM_OFFLOAD_ENABLE
+    // The host kernel has already computed or validated the
+    // transport-layer checksum for packets it sends over the tunnel
+    // interface.
+    otMessageSetChecksumVerified(message, true);
+#endif
 
     error   = otIp6Send(aInstance, message);
     message = nullptr;
@@ -845,6 +1156,7 @@ exit:
         otLogWarnPlat("[netif] Failed to transmit, error:%s", otThreadErrorToString(error));
     }
 }
+#endif
 
 static void logAddrEvent(bool isAdd, bool isUnicast, struct sockaddr_in6 &addr6, otError error)
 {
@@ -1632,6 +1944,10 @@ void platformNetifInit(const char *aInterfaceName)
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     mldListenerInit();
 #endif
+
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+    startIoThread();
+#endif
 }
 
 void platformNetifSetUp(void)
@@ -1653,6 +1969,10 @@ void platformNetifTearDown(void)
 
 void platformNetifDeinit(void)
 {
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+    stopIoThread();
+#endif
+
     if (sTunFd != -1)
     {
         close(sTunFd);
@@ -1696,8 +2016,19 @@ void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *a
     assert(sNetlinkFd >= 0);
     assert(sIpFd >= 0);
 
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+    // The dedicated I/O thread polls the TUN device; the stack mainloop
+    // only watches the wake-up pipe signaled when packets are queued.
+    FD_SET(sStackWakePipe[0], aReadFdSet);
+
+    if (sStackWakePipe[0] > *aMaxFd)
+    {
+        *aMaxFd = sStackWakePipe[0];
+    }
+#else
     FD_SET(sTunFd, aReadFdSet);
     FD_SET(sTunFd, aErrorFdSet);
+#endif
     FD_SET(sNetlinkFd, aReadFdSet);
     FD_SET(sNetlinkFd, aErrorFdSet);
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
@@ -1705,10 +2036,12 @@ void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *a
     FD_SET(sMLDMonitorFd, aErrorFdSet);
 #endif
 
+#if !OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
     if (sTunFd > *aMaxFd)
     {
         *aMaxFd = sTunFd;
     }
+#endif
 
     if (sNetlinkFd > *aMaxFd)
     {
@@ -1730,11 +2063,13 @@ void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, c
     OT_UNUSED_VARIABLE(aWriteFdSet);
     VerifyOrExit(gNetifIndex > 0);
 
+#if !OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
     if (FD_ISSET(sTunFd, aErrorFdSet))
     {
         close(sTunFd);
         DieNow(OT_EXIT_FAILURE);
     }
+#endif
 
     if (FD_ISSET(sNetlinkFd, aErrorFdSet))
     {
@@ -1750,10 +2085,23 @@ void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, c
     }
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+    if (FD_ISSET(sStackWakePipe[0], aReadFdSet))
+    {
+        drainWakePipe(sStackWakePipe[0]);
+    }
+
+    for (const IoPacket *packet = sRxRing.Peek(); packet != nullptr; packet = sRxRing.Peek())
+    {
+        processTransmitPacket(gInstance, reinterpret_cast<const char *>(packet->mData), packet->mLength);
+        sRxRing.Pop();
+    }
+#else
     if (FD_ISSET(sTunFd, aReadFdSet))
     {
         processTransmit(gInstance);
     }
+#endif
 
     if (FD_ISSET(sNetlinkFd, aReadFdSet))
     {
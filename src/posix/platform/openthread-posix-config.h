@@ -76,6 +76,57 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+ *
+ * Define as 1 to batch the TREL UDP6 socket I/O (linux only). Outgoing TREL packets are queued and flushed with a
+ * single `sendmmsg()` call per mainloop iteration, and pending received packets are drained with a single
+ * `recvmmsg()` call, so heavy TREL traffic (e.g., between Border Routers) costs one syscall per burst instead of
+ * one per packet.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+#define OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_TREL_BATCH_SIZE
+ *
+ * The maximum number of TREL packets sent or received in a single batched socket call. This also sets the size of
+ * the tx packet queue/pool.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_TREL_BATCH_SIZE
+#define OPENTHREAD_CONFIG_POSIX_TREL_BATCH_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE
+ *
+ * Define as 1 to batch outgoing datagrams on the platform UDP sockets (linux only). Datagrams passed to
+ * `otPlatUdpSend()` are queued and flushed with one `sendmmsg()` call per socket per mainloop iteration, so a burst
+ * of host-side traffic (e.g., DNS-SD or SRP responses on a Border Router) costs one syscall instead of one per
+ * datagram.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE
+#define OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE
+ *
+ * The maximum number of outgoing datagrams queued on the platform UDP sockets before the queue is flushed.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE
+#define OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_DAEMON_SOCKET_BASENAME
  *
@@ -90,6 +141,33 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS
+ *
+ * Maximum number of concurrent control sessions accepted by the POSIX app daemon.
+ *
+ * This allows multiple clients (e.g., a controller and a metrics scraper) to issue CLI commands over the daemon
+ * socket at the same time, each receiving the output of its own commands.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS
+#define OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS 4
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE
+ *
+ * Size (in bytes) of the per-session output ring buffer used by the POSIX app daemon.
+ *
+ * Output that cannot be written to a session socket immediately (slow reader) is buffered here and flushed from the
+ * mainloop when the socket becomes writable, so one blocked client never stalls the daemon or the other sessions. A
+ * session whose buffered output exceeds this size is disconnected.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE
+#define OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_OUTPUT_BUFFER_SIZE 8192
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
  *
@@ -144,6 +222,108 @@
 #define OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE (OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS * 10)
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_CHECKSUM_OFFLOAD_ENABLE
+ *
+ * Define as 1 to mark the transport-layer checksum of packets read from the host network interface as already
+ * verified, skipping checksum verification when such a packet is received by the OpenThread stack. The host kernel
+ * computes or validates the checksum of packets it sends over the TUN/TAP interface.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_CHECKSUM_OFFLOAD_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_CHECKSUM_OFFLOAD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+ *
+ * Define as 1 to exchange IPv6 packets with the TUN device on a dedicated I/O thread instead of the thread running
+ * the OpenThread stack. Packets cross between the two threads through lock-free single-producer single-consumer
+ * rings, so bursts of host traffic no longer delay 802.15.4 timing on multicore hosts.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_IO_RING_SIZE
+ *
+ * The number of packet slots in each direction of the TUN I/O rings (one slot per ring is kept unused to
+ * distinguish a full ring from an empty one). Packets arriving while a ring is full are dropped.
+ *
+ * Applicable only when `OPENTHREAD_POSIX_CONFIG_NETIF_THREADED_IO_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_IO_RING_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_IO_RING_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE
+ *
+ * Define as 1 to run the radio bring-up (including the blocking RCP reset and handshake) on a worker thread while
+ * the remaining platform modules (TREL, backbone, infra-if, netif, UDP) initialize on the calling thread. The
+ * worker is joined before `platformInit()` returns, so `otInstanceInitSingle()` still observes a fully initialized
+ * platform. This shortens daemon restart time when the RCP reset dominates bring-up.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_INIT_PROFILING_ENABLE
+ *
+ * Define as 1 to log the wall-clock duration of each platform bring-up phase (radio, TREL, netif, ...) at info
+ * level, to identify which phase dominates daemon restart time.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_INIT_PROFILING_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_INIT_PROFILING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+ *
+ * Define as 1 to enable the cross-thread task queue (`otSysTaskQueuePost()` and `otSysTaskQueuePostAndWait()`).
+ * Other application threads enqueue callbacks into a lock-free ring and the callbacks run on the thread driving
+ * the OpenThread mainloop, where calling OpenThread APIs is safe. This removes the need to serialize every API
+ * call behind a mutex shared with the packet processing path.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_SIZE
+ *
+ * The number of task slots in the cross-thread task queue. Must be a power of two. Tasks posted while the queue
+ * is full are rejected with `OT_ERROR_NO_BUFS`.
+ *
+ * Applicable only when `OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE` is enabled.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_SIZE
+#define OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_SIZE 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to poll the mainloop file descriptors with epoll instead of select (Linux only). The epoll
+ * registrations persist across mainloop iterations and are only updated when the event interest of a file
+ * descriptor changes, so an iteration costs a single `epoll_wait()` call in the common case.
+ *
+ * @note This backend assumes a file descriptor number is not closed and reused with an identical event interest
+ *       within a single mainloop iteration. It cannot be combined with `OPENTHREAD_POSIX_VIRTUAL_TIME`.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE
  *
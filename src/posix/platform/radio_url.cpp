@@ -61,7 +61,10 @@ const char *otSysGetRadioUrlHelpString(void)
     "    spi-align-allowance[=n]       Specify the maximum number of 0xFF bytes to clip from start of\n"       \
     "                                  MISO frame. Max value is 16.\n"                                         \
     "    spi-small-packet=[n]          Specify the smallest packet we can receive in a single transaction.\n"  \
-    "                                  (larger packets will require two transactions). Default value is 32.\n"
+    "    spi-adaptive-size             Adaptively size transactions from the typical slave frame length.\n"    \
+    "                                  (larger packets will require two transactions). Default value is 32.\n" \
+    "    spi-speed-autotune[=hertz]    Probe from the given speed (default `spi-speed`) and halve the\n"       \
+    "                                  clock on persistent garbage frames until the link is clean.\n"
 
 #else
 
@@ -88,6 +88,11 @@ SpiInterface::SpiInterface(SpinelInterface::ReceiveFrameCallback aCallback,
     , mSpiTxPayloadSize(0)
     , mDidPrintRateLimitLog(false)
     , mSpiSlaveDataLen(0)
+    , mSpiAdaptiveSizeEnabled(false)
+    , mSpiRxExpectedSize(0)
+    , mSpiAutotuneEnabled(false)
+    , mAutotuneWindowFrames(0)
+    , mAutotuneWindowGarbage(0)
 {
 }
 
@@ -166,6 +171,21 @@ otError SpiInterface::Init(const Url::Url &aRadioUrl)
     {
         spiSmallPacketSize = static_cast<uint8_t>(atoi(value));
     }
+    if (aRadioUrl.GetValue("spi-adaptive-size") != nullptr)
+    {
+        mSpiAdaptiveSizeEnabled = true;
+    }
+    if ((value = aRadioUrl.GetValue("spi-speed-autotune")) != nullptr)
+    {
+        mSpiAutotuneEnabled = true;
+
+        if (*value != '\0')
+        {
+            // Probe from the given maximum rate; the clock is stepped
+            // down from there until the link is clean.
+            spiSpeed = static_cast<uint32_t>(atoi(value));
+        }
+    }
 
     VerifyOrDie(spiAlignAllowance <= kSpiAlignAllowanceMax, OT_EXIT_FAILURE);
 
@@ -173,6 +193,7 @@ otError SpiInterface::Init(const Url::Url &aRadioUrl)
     mSpiCsDelayUs       = spiCsDelay;
     mSpiSmallPacketSize = spiSmallPacketSize;
     mSpiAlignAllowance  = spiAlignAllowance;
+    mSpiRxExpectedSize  = spiSmallPacketSize;
 
     if (spiGpioIntDevice != nullptr)
     {
@@ -464,9 +485,18 @@ otError SpiInterface::PushPullSpi(void)
     {
         // Set up a minimum transfer size to allow small frames the slave wants to send us to be handled in a
         // single transaction.
-        if (spiTransferBytes < mSpiSmallPacketSize)
+        uint16_t minTransferSize = mSpiSmallPacketSize;
+
+        if (mSpiAdaptiveSizeEnabled && (mSpiRxExpectedSize > minTransferSize))
+        {
+            // Speculatively size the transaction for the frame length the slave typically sends, so that most
+            // frames are completed in a single transaction instead of a header exchange followed by a re-read.
+            minTransferSize = mSpiRxExpectedSize;
+        }
+
+        if (spiTransferBytes < minTransferSize)
         {
-            spiTransferBytes = mSpiSmallPacketSize;
+            spiTransferBytes = minTransferSize;
         }
     }
 
@@ -534,6 +564,7 @@ otError SpiInterface::PushPullSpi(void)
             {
                 // Header is full of garbage
                 mSpiGarbageFrameCount++;
+                RecordAutotuneFrame(true);
 
                 otLogWarnPlat("Garbage in header : %02X %02X %02X %02X %02X", spiRxFrame[0], spiRxFrame[1],
                               spiRxFrame[2], spiRxFrame[3], spiRxFrame[4]);
@@ -551,6 +582,7 @@ otError SpiInterface::PushPullSpi(void)
         if (!rxFrame.IsValid() || (slaveAcceptLen > kMaxFrameSize) || (mSpiSlaveDataLen > kMaxFrameSize))
         {
             mSpiGarbageFrameCount++;
+            RecordAutotuneFrame(true);
             mSpiTxRefusedCount++;
             mSpiSlaveDataLen = 0;
 
@@ -563,6 +595,7 @@ otError SpiInterface::PushPullSpi(void)
         }
 
         mSpiValidFrameCount++;
+        RecordAutotuneFrame(false);
 
         if (rxFrame.IsResetFlagSet())
         {
@@ -575,6 +608,8 @@ otError SpiInterface::PushPullSpi(void)
         // Handle received packet, if any.
         if ((mSpiSlaveDataLen != 0) && (mSpiSlaveDataLen <= txFrame.GetHeaderAcceptLen()))
         {
+            UpdateAdaptiveTransferSize(mSpiSlaveDataLen);
+
             mSpiRxFrameByteCount += mSpiSlaveDataLen;
             mSpiSlaveDataLen = 0;
             mSpiRxFrameCount++;
@@ -635,6 +670,78 @@ exit:
     return error;
 }
 
+void SpiInterface::UpdateAdaptiveTransferSize(uint16_t aRxDataLen)
+{
+    // Learns the frame length the slave typically sends. The expected
+    // size grows immediately when a larger frame arrives (which needed
+    // a second transaction), and decays slowly toward the sizes of
+    // subsequent smaller frames so bursts of large frames do not pin
+    // the transfer size at the maximum forever.
+
+    VerifyOrExit(mSpiAdaptiveSizeEnabled);
+
+    if (aRxDataLen > mSpiRxExpectedSize)
+    {
+        mSpiRxExpectedSize = aRxDataLen;
+    }
+    else
+    {
+        mSpiRxExpectedSize -= (mSpiRxExpectedSize - aRxDataLen) >> kAdaptiveDecayShift;
+    }
+
+    if (mSpiRxExpectedSize < mSpiSmallPacketSize)
+    {
+        mSpiRxExpectedSize = mSpiSmallPacketSize;
+    }
+    else if (mSpiRxExpectedSize > kMaxFrameSize)
+    {
+        mSpiRxExpectedSize = kMaxFrameSize;
+    }
+
+exit:
+    return;
+}
+
+void SpiInterface::RecordAutotuneFrame(bool aIsGarbage)
+{
+    // Steps the SPI clock down when a window of transactions shows
+    // persistent garbage (corrupted) frames, so a unit probed at a
+    // rate its wiring cannot sustain settles at its highest clean
+    // rate. The host is the bus master, so lowering the clock needs
+    // no cooperation from the RCP.
+
+    VerifyOrExit(mSpiAutotuneEnabled);
+
+    mAutotuneWindowFrames++;
+
+    if (aIsGarbage)
+    {
+        mAutotuneWindowGarbage++;
+    }
+
+    VerifyOrExit(mAutotuneWindowFrames >= kAutotuneWindowFrames);
+
+    if ((mAutotuneWindowGarbage > kAutotuneGarbageMax) && (mSpiSpeedHz > kAutotuneMinSpeedHz))
+    {
+        uint32_t newSpeed = mSpiSpeedHz / 2;
+
+        if (newSpeed < kAutotuneMinSpeedHz)
+        {
+            newSpeed = kAutotuneMinSpeedHz;
+        }
+
+        otLogNotePlat("Autotune: %" PRIu16 " garbage frames in last %" PRIu16 " transactions, lowering SPI speed %" PRIu32 " -> %" PRIu32, mAutotuneWindowGarbage, mAutotuneWindowFrames, mSpiSpeedHz, newSpeed);
+
+        mSpiSpeedHz = newSpeed;
+    }
+
+    mAutotuneWindowFrames  = 0;
+    mAutotuneWindowGarbage = 0;
+
+exit:
+    return;
+}
+
 bool SpiInterface::CheckInterrupt(void)
 {
     return (mIntGpioValueFd >= 0) ? (GetGpioValue(mIntGpioValueFd) == kGpioIntAssertState) : true;
@@ -173,6 +173,8 @@ private:
     uint8_t *GetRealRxFrameStart(uint8_t *aSpiRxFrameBuffer, uint8_t aAlignAllowance, uint16_t &aSkipLength);
     otError  DoSpiTransfer(uint8_t *aSpiRxFrameBuffer, uint32_t aTransferLength);
     otError  PushPullSpi(void);
+    void     UpdateAdaptiveTransferSize(uint16_t aRxDataLen);
+    void     RecordAutotuneFrame(bool aIsGarbage);
 
     bool CheckInterrupt(void);
     void LogStats(void);
@@ -189,6 +191,10 @@ private:
         kSpiTxRefuseExitCount = 100,
         kImmediateRetryCount  = 5,
         kFastRetryCount       = 15,
+        kAdaptiveDecayShift   = 3,
+        kAutotuneWindowFrames = 32,
+        kAutotuneGarbageMax   = 2,
+        kAutotuneMinSpeedHz   = 500000,
         kDebugBytesPerLine    = 16,
         kGpioIntAssertState   = 0,
         kGpioResetAssertState = 0,
@@ -245,6 +251,13 @@ private:
     bool     mDidPrintRateLimitLog;
     uint16_t mSpiSlaveDataLen;
 
+    bool     mSpiAdaptiveSizeEnabled;
+    uint16_t mSpiRxExpectedSize;
+
+    bool     mSpiAutotuneEnabled;
+    uint16_t mAutotuneWindowFrames;
+    uint16_t mAutotuneWindowGarbage;
+
     // Non-copyable, intentionally not implemented.
     SpiInterface(const SpiInterface &);
     SpiInterface &operator=(const SpiInterface &);
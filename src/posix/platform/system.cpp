@@ -36,10 +36,15 @@
 #include "platform-posix.h"
 
 #include <assert.h>
+#include <inttypes.h>
+#if OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE
+#include <pthread.h>
+#endif
 
 #include <openthread-core-config.h>
 #include <openthread/border_router.h>
 #include <openthread/heap.h>
+#include <openthread/logging.h>
 #include <openthread/tasklet.h>
 #include <openthread/platform/alarm-milli.h>
 #include <openthread/platform/infra_if.h>
@@ -48,10 +53,12 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/logging.hpp"
 #include "posix/platform/daemon.hpp"
 #include "posix/platform/infra_if.hpp"
 #include "posix/platform/mainloop.hpp"
 #include "posix/platform/radio_url.hpp"
+#include "posix/platform/task_queue.hpp"
 #include "posix/platform/udp.hpp"
 
 otInstance *gInstance = nullptr;
@@ -118,36 +125,105 @@ static const char *getTrelRadioUrl(otPlatformConfig *aPlatformConfig)
 }
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_INIT_PROFILING_ENABLE
+static uint64_t initPhaseStart(void) { return otPlatTimeGet(); }
+
+static void logInitPhase(const char *aPhaseName, uint64_t aStartTime)
+{
+    otLogInfoPlat("Init phase %s: %" PRIu64 " us", aPhaseName, otPlatTimeGet() - aStartTime);
+}
+#else
+static uint64_t initPhaseStart(void) { return 0; }
+
+static void logInitPhase(const char *aPhaseName, uint64_t aStartTime)
+{
+    OT_UNUSED_VARIABLE(aPhaseName);
+    OT_UNUSED_VARIABLE(aStartTime);
+}
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE
+static void *runRadioInit(void *aRadioUrl)
+{
+    platformRadioInit(static_cast<const char *>(aRadioUrl));
+    return nullptr;
+}
+#endif
+
 void platformInit(otPlatformConfig *aPlatformConfig)
 {
+#if OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE
+    pthread_t radioThread;
+#endif
+    uint64_t radioStartTime;
+    uint64_t phaseStartTime;
+
     platformAlarmInit(aPlatformConfig->mSpeedUpFactor, aPlatformConfig->mRealTimeSignal);
+
+    radioStartTime = initPhaseStart();
+
+#if OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE
+    // The radio bring-up (including the blocking RCP reset and handshake) only
+    // touches the spinel interface, so it is overlapped with the modules below
+    // and joined before this function returns.
+    VerifyOrDie(pthread_create(&radioThread, nullptr, runRadioInit,
+                               const_cast<char *>(get802154RadioUrl(aPlatformConfig))) == 0,
+                OT_EXIT_FAILURE);
+#else
     platformRadioInit(get802154RadioUrl(aPlatformConfig));
+    logInitPhase("radio", radioStartTime);
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    phaseStartTime = initPhaseStart();
     platformTrelInit(getTrelRadioUrl(aPlatformConfig));
+    logInitPhase("trel", phaseStartTime);
 #endif
     platformRandomInit();
 
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    phaseStartTime = initPhaseStart();
     platformBackboneInit(aPlatformConfig->mBackboneInterfaceName);
+    logInitPhase("backbone", phaseStartTime);
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
+    phaseStartTime = initPhaseStart();
     ot::Posix::InfraNetif::Get().Init(aPlatformConfig->mBackboneInterfaceName);
+    logInitPhase("infra-if", phaseStartTime);
 #endif
 
     gNetifName[0] = '\0';
 
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
+    phaseStartTime = initPhaseStart();
     platformNetifInit(aPlatformConfig->mInterfaceName);
+    logInitPhase("netif", phaseStartTime);
 #endif
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
+    phaseStartTime = initPhaseStart();
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
     ot::Posix::Udp::Get().Init(otSysGetThreadNetifName());
 #else
     ot::Posix::Udp::Get().Init(aPlatformConfig->mInterfaceName);
 #endif
+    logInitPhase("udp", phaseStartTime);
 #endif
+
+#if OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+    ot::Posix::TaskQueue::Get().Init();
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_PARALLEL_INIT_ENABLE
+    // Completion barrier: every module must be initialized before
+    // `otInstanceInitSingle()` runs.
+    VerifyOrDie(pthread_join(radioThread, nullptr) == 0, OT_EXIT_FAILURE);
+    logInitPhase("radio (overlapped)", radioStartTime);
+#endif
+
+    OT_UNUSED_VARIABLE(radioStartTime);
+    OT_UNUSED_VARIABLE(phaseStartTime);
 }
 
 void platformSetUp(void)
@@ -172,6 +248,10 @@ void platformSetUp(void)
     ot::Posix::Daemon::Get().SetUp();
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+    ot::Posix::TaskQueue::Get().SetUp();
+#endif
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE || OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SuccessOrDie(otSetStateChangedCallback(gInstance, processStateChange, gInstance));
 #endif
@@ -193,6 +273,10 @@ otInstance *otSysInit(otPlatformConfig *aPlatformConfig)
 
 void platformTearDown(void)
 {
+#if OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+    ot::Posix::TaskQueue::Get().TearDown();
+#endif
+
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE
     ot::Posix::Daemon::Get().TearDown();
 #endif
@@ -220,6 +304,9 @@ void platformDeinit(void)
     virtualTimeDeinit();
 #endif
     platformRadioDeinit();
+#if OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+    ot::Posix::TaskQueue::Get().Deinit();
+#endif
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     ot::Posix::Udp::Get().Deinit();
 #endif
@@ -344,8 +431,12 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
     else
 #endif
     {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+        rval = ot::Posix::Mainloop::Manager::Get().Poll(*aMainloop);
+#else
         rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                       &aMainloop->mTimeout);
+#endif
     }
 
     return rval;
@@ -367,6 +458,9 @@ void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMa
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
     platformNetifProcess(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet);
 #endif
+#if OPENTHREAD_CONFIG_LOG_DEFERRED_ENABLE
+    otLoggingFlushDeferred();
+#endif
 }
 
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
@@ -0,0 +1,279 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the cross-thread task queue.
+ */
+
+#include "posix/platform/task_queue.hpp"
+
+#if OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "platform-posix.h"
+#include "core/common/code_utils.hpp"
+
+namespace ot {
+namespace Posix {
+
+void TaskQueue::Init(void)
+{
+    for (uint32_t i = 0; i < kSize; i++)
+    {
+        mCells[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+
+    VerifyOrDie(pipe(mWakePipe) == 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(fcntl(mWakePipe[0], F_SETFL, O_NONBLOCK) == 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(fcntl(mWakePipe[1], F_SETFL, O_NONBLOCK) == 0, OT_EXIT_ERROR_ERRNO);
+
+    mMainloopThread = pthread_self();
+}
+
+void TaskQueue::SetUp(void)
+{
+    Mainloop::Manager::Get().Add(*this);
+}
+
+void TaskQueue::TearDown(void)
+{
+    Mainloop::Manager::Get().Remove(*this);
+}
+
+void TaskQueue::Deinit(void)
+{
+    if (mWakePipe[0] != -1)
+    {
+        close(mWakePipe[0]);
+        close(mWakePipe[1]);
+        mWakePipe[0] = -1;
+        mWakePipe[1] = -1;
+    }
+}
+
+void TaskQueue::Update(otSysMainloopContext &aContext)
+{
+    FD_SET(mWakePipe[0], &aContext.mReadFdSet);
+
+    if (mWakePipe[0] > aContext.mMaxFd)
+    {
+        aContext.mMaxFd = mWakePipe[0];
+    }
+}
+
+void TaskQueue::Process(const otSysMainloopContext &aContext)
+{
+    Task task;
+
+    if (FD_ISSET(mWakePipe[0], &aContext.mReadFdSet))
+    {
+        uint8_t buffer[16];
+
+        while (read(mWakePipe[0], buffer, sizeof(buffer)) > 0)
+        {
+        }
+    }
+
+    // Drain the queue regardless of the wake pipe state, in case a task
+    // was enqueued after the poll returned but before the drain above.
+    while (Dequeue(task))
+    {
+        RunTask(task);
+    }
+}
+
+otError TaskQueue::Post(otSysTaskCallback aCallback, void *aContext)
+{
+    otError error = OT_ERROR_NONE;
+    Task    task;
+
+    VerifyOrExit(aCallback != nullptr, error = OT_ERROR_INVALID_ARGS);
+
+    task.mCallback   = aCallback;
+    task.mContext    = aContext;
+    task.mCompletion = nullptr;
+
+    SuccessOrExit(error = Enqueue(task));
+    Wake();
+
+exit:
+    return error;
+}
+
+otError TaskQueue::PostAndWait(otSysTaskCallback aCallback, void *aContext)
+{
+    otError    error = OT_ERROR_NONE;
+    Task       task;
+    Completion completion;
+
+    VerifyOrExit(aCallback != nullptr, error = OT_ERROR_INVALID_ARGS);
+
+    if (pthread_equal(pthread_self(), mMainloopThread))
+    {
+        // Already on the mainloop thread; execute in place to avoid
+        // dead-locking on our own queue.
+        aCallback(aContext);
+        ExitNow();
+    }
+
+    pthread_mutex_init(&completion.mMutex, nullptr);
+    pthread_cond_init(&completion.mCond, nullptr);
+    completion.mDone = false;
+
+    task.mCallback   = aCallback;
+    task.mContext    = aContext;
+    task.mCompletion = &completion;
+
+    error = Enqueue(task);
+
+    if (error == OT_ERROR_NONE)
+    {
+        Wake();
+
+        pthread_mutex_lock(&completion.mMutex);
+
+        while (!completion.mDone)
+        {
+            pthread_cond_wait(&completion.mCond, &completion.mMutex);
+        }
+
+        pthread_mutex_unlock(&completion.mMutex);
+    }
+
+    pthread_mutex_destroy(&completion.mMutex);
+    pthread_cond_destroy(&completion.mCond);
+
+exit:
+    return error;
+}
+
+otError TaskQueue::Enqueue(const Task &aTask)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t pos   = mEnqueuePos.load(std::memory_order_relaxed);
+    Cell *   cell;
+
+    while (true)
+    {
+        int32_t dif;
+
+        cell = &mCells[pos & (kSize - 1)];
+        dif  = static_cast<int32_t>(cell->mSequence.load(std::memory_order_acquire) - pos);
+
+        if (dif == 0)
+        {
+            // The cell is free; try to claim it. On failure `pos` is
+            // updated to the current enqueue position and we retry.
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (dif < 0)
+        {
+            // The cell still holds a task the consumer has not drained
+            // yet, i.e. the queue is full.
+            ExitNow(error = OT_ERROR_NO_BUFS);
+        }
+        else
+        {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->mTask = aTask;
+    cell->mSequence.store(pos + 1, std::memory_order_release);
+
+exit:
+    return error;
+}
+
+bool TaskQueue::Dequeue(Task &aTask)
+{
+    bool  hasTask = false;
+    Cell &cell    = mCells[mDequeuePos & (kSize - 1)];
+
+    if (static_cast<int32_t>(cell.mSequence.load(std::memory_order_acquire) - (mDequeuePos + 1)) == 0)
+    {
+        aTask = cell.mTask;
+        cell.mSequence.store(mDequeuePos + kSize, std::memory_order_release);
+        mDequeuePos++;
+        hasTask = true;
+    }
+
+    return hasTask;
+}
+
+void TaskQueue::Wake(void)
+{
+    uint8_t byte = 0;
+
+    // A full pipe already guarantees a pending wake-up.
+    while ((write(mWakePipe[1], &byte, sizeof(byte)) == -1) && (errno == EINTR))
+    {
+    }
+}
+
+void TaskQueue::RunTask(const Task &aTask)
+{
+    aTask.mCallback(aTask.mContext);
+
+    if (aTask.mCompletion != nullptr)
+    {
+        pthread_mutex_lock(&aTask.mCompletion->mMutex);
+        aTask.mCompletion->mDone = true;
+        pthread_cond_signal(&aTask.mCompletion->mCond);
+        pthread_mutex_unlock(&aTask.mCompletion->mMutex);
+    }
+}
+
+TaskQueue &TaskQueue::Get(void)
+{
+    static TaskQueue sInstance;
+
+    return sInstance;
+}
+
+} // namespace Posix
+} // namespace ot
+
+otError otSysTaskQueuePost(otSysTaskCallback aCallback, void *aContext)
+{
+    return ot::Posix::TaskQueue::Get().Post(aCallback, aContext);
+}
+
+otError otSysTaskQueuePostAndWait(otSysTaskCallback aCallback, void *aContext)
+{
+    return ot::Posix::TaskQueue::Get().PostAndWait(aCallback, aContext);
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
@@ -0,0 +1,147 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the cross-thread task queue.
+ */
+
+#ifndef OT_POSIX_PLATFORM_TASK_QUEUE_HPP_
+#define OT_POSIX_PLATFORM_TASK_QUEUE_HPP_
+
+#include "openthread-posix-config.h"
+
+#if OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+
+#include <atomic>
+#include <pthread.h>
+#include <stdint.h>
+
+#include <openthread/openthread-system.h>
+
+#include "core/common/non_copyable.hpp"
+#include "posix/platform/mainloop.hpp"
+
+namespace ot {
+namespace Posix {
+
+/**
+ * This class implements a lock-free task queue that lets other application threads run code on the thread driving
+ * the OpenThread mainloop.
+ *
+ * OpenThread APIs are not thread-safe; without this queue a multi-threaded application has to serialize every API
+ * call behind one mutex shared with the packet processing path. Producers enqueue a callback (and optionally block
+ * until it has run); the callbacks are executed from the mainloop thread between mainloop iterations, where calling
+ * OpenThread APIs is safe.
+ *
+ */
+class TaskQueue : public Mainloop::Source, private NonCopyable
+{
+public:
+    static TaskQueue &Get(void);
+
+    void Init(void);
+    void SetUp(void);
+    void TearDown(void);
+    void Deinit(void);
+    void Update(otSysMainloopContext &aContext) override;
+    void Process(const otSysMainloopContext &aContext) override;
+
+    /**
+     * This method posts a task to be executed on the mainloop thread. It is safe to call from any thread.
+     *
+     * @param[in] aCallback  The function to invoke on the mainloop thread.
+     * @param[in] aContext   An arbitrary context passed to @p aCallback.
+     *
+     * @retval OT_ERROR_NONE          Successfully posted the task.
+     * @retval OT_ERROR_NO_BUFS       The task queue is full.
+     * @retval OT_ERROR_INVALID_ARGS  @p aCallback is `nullptr`.
+     *
+     */
+    otError Post(otSysTaskCallback aCallback, void *aContext);
+
+    /**
+     * This method posts a task and blocks the calling thread until the task has been executed on the mainloop
+     * thread. When called from the mainloop thread itself, the task is executed in place.
+     *
+     * @param[in] aCallback  The function to invoke on the mainloop thread.
+     * @param[in] aContext   An arbitrary context passed to @p aCallback.
+     *
+     * @retval OT_ERROR_NONE          The task was executed.
+     * @retval OT_ERROR_NO_BUFS       The task queue is full.
+     * @retval OT_ERROR_INVALID_ARGS  @p aCallback is `nullptr`.
+     *
+     */
+    otError PostAndWait(otSysTaskCallback aCallback, void *aContext);
+
+private:
+    static constexpr uint32_t kSize = OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_SIZE;
+
+    static_assert((kSize != 0) && ((kSize & (kSize - 1)) == 0),
+                  "OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_SIZE must be a power of two");
+
+    struct Completion
+    {
+        pthread_mutex_t mMutex;
+        pthread_cond_t  mCond;
+        bool            mDone;
+    };
+
+    struct Task
+    {
+        otSysTaskCallback mCallback;
+        void *            mContext;
+        Completion *      mCompletion; // Signaled after execution, or `nullptr` for fire-and-forget tasks.
+    };
+
+    // A cell of the bounded lock-free queue (Vyukov's array-based
+    // algorithm). `mSequence` encodes whether the cell is free for the
+    // producers or holds a task for the consumer.
+    struct Cell
+    {
+        std::atomic<uint32_t> mSequence;
+        Task                  mTask;
+    };
+
+    otError     Enqueue(const Task &aTask);
+    bool        Dequeue(Task &aTask);
+    void        Wake(void);
+    static void RunTask(const Task &aTask);
+
+    Cell                  mCells[kSize];
+    std::atomic<uint32_t> mEnqueuePos{0};
+    uint32_t              mDequeuePos   = 0; // Accessed only by the mainloop thread.
+    int                   mWakePipe[2]  = {-1, -1};
+    pthread_t             mMainloopThread;
+};
+
+} // namespace Posix
+} // namespace ot
+
+#endif // OPENTHREAD_POSIX_CONFIG_TASK_QUEUE_ENABLE
+#endif // OT_POSIX_PLATFORM_TASK_QUEUE_HPP_
@@ -39,6 +39,10 @@
 #error "netlink socket use is only supported on linux platform"
 #endif
 
+#if OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE && !defined(__linux__)
+#error "batched socket I/O (sendmmsg/recvmmsg) is only supported on linux platform"
+#endif
+
 #include <arpa/inet.h>
 #include <assert.h>
 #include <fcntl.h>
@@ -62,7 +66,12 @@
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
 #define TREL_MAX_PACKET_SIZE 1400
+
+#if OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+#define TREL_PACKET_POOL_SIZE OPENTHREAD_CONFIG_POSIX_TREL_BATCH_SIZE
+#else
 #define TREL_PACKET_POOL_SIZE 5
+#endif
 
 #define USEC_PER_MSEC 1000u
 #define TREL_SOCKET_BIND_MAX_WAIT_TIME_MSEC 4000u
@@ -78,8 +87,12 @@ typedef struct TxPacket
     otIp6Address     mDestAddress;
 } TxPacket;
 
-static uint8_t      sRxPacketBuffer[TREL_MAX_PACKET_SIZE];
-static uint16_t     sRxPacketLength;
+#if OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+static uint8_t sRxPacketBuffers[TREL_PACKET_POOL_SIZE][TREL_MAX_PACKET_SIZE];
+#else
+static uint8_t  sRxPacketBuffer[TREL_MAX_PACKET_SIZE];
+static uint16_t sRxPacketLength;
+#endif
 static TxPacket     sTxPacketPool[TREL_PACKET_POOL_SIZE];
 static TxPacket *   sFreeTxPacketHead;  // A singly linked list of free/available `TxPacket` from pool.
 static TxPacket *   sTxPacketQueueTail; // A circular linked list for queued tx packets.
@@ -337,6 +350,7 @@ static void PrepareSocket(void)
     }
 }
 
+#if !OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
 static otError SendPacket(const uint8_t *aBuffer, uint16_t aLength, const otIp6Address *aDestAddress)
 {
     otError             error = OT_ERROR_NONE;
@@ -375,6 +389,65 @@ exit:
 
     return error;
 }
+#endif // !OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+
+#if OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+
+static void ReceivePacket(int aSocket, otInstance *aInstance)
+{
+    struct mmsghdr      msgs[TREL_PACKET_POOL_SIZE];
+    struct iovec        iovecs[TREL_PACKET_POOL_SIZE];
+    struct sockaddr_in6 sockAddrs[TREL_PACKET_POOL_SIZE];
+    int                 num;
+
+    memset(msgs, 0, sizeof(msgs));
+    memset(sockAddrs, 0, sizeof(sockAddrs));
+
+    for (uint16_t index = 0; index < OT_ARRAY_LENGTH(msgs); index++)
+    {
+        iovecs[index].iov_base          = sRxPacketBuffers[index];
+        iovecs[index].iov_len           = TREL_MAX_PACKET_SIZE;
+        msgs[index].msg_hdr.msg_iov     = &iovecs[index];
+        msgs[index].msg_hdr.msg_iovlen  = 1;
+        msgs[index].msg_hdr.msg_name    = &sockAddrs[index];
+        msgs[index].msg_hdr.msg_namelen = sizeof(sockAddrs[index]);
+    }
+
+    // Drain all pending datagrams on the socket with a single
+    // `recvmmsg()` call (up to the batch size).
+
+    num = recvmmsg(aSocket, msgs, OT_ARRAY_LENGTH(msgs), MSG_DONTWAIT, NULL);
+
+    if (num < 0)
+    {
+        VerifyOrExit((errno != EAGAIN) && (errno != EWOULDBLOCK));
+        DieNow(OT_EXIT_ERROR_ERRNO);
+    }
+
+    for (int index = 0; index < num; index++)
+    {
+        uint16_t length = (uint16_t)msgs[index].msg_len;
+
+        if (length > TREL_MAX_PACKET_SIZE)
+        {
+            length = TREL_MAX_PACKET_SIZE;
+        }
+
+        otLogDebgPlat("[trel] ReceivePacket() - received from %s port:%d, pkt:%s",
+                      Ip6AddrToString(&sockAddrs[index].sin6_addr), ntohs(sockAddrs[index].sin6_port),
+                      BufferToString(sRxPacketBuffers[index], length));
+
+        if (sEnabled)
+        {
+            otPlatTrelUdp6HandleReceived(aInstance, sRxPacketBuffers[index], length);
+        }
+    }
+
+exit:
+    return;
+}
+
+#else // OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
 
 static void ReceivePacket(int aSocket, otInstance *aInstance)
 {
@@ -405,6 +478,8 @@ static void ReceivePacket(int aSocket, otInstance *aInstance)
     }
 }
 
+#endif // OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+
 static void InitPacketQueue(void)
 {
     sTxPacketQueueTail = NULL;
@@ -421,6 +496,97 @@ static void InitPacketQueue(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+
+static void SendQueuedPackets(void)
+{
+    VerifyOrExit(sSocket >= 0);
+
+    while (sTxPacketQueueTail != NULL)
+    {
+        struct mmsghdr      msgs[TREL_PACKET_POOL_SIZE];
+        struct iovec        iovecs[TREL_PACKET_POOL_SIZE];
+        struct sockaddr_in6 sockAddrs[TREL_PACKET_POOL_SIZE];
+        TxPacket *          packet = sTxPacketQueueTail->mNext; // tail->mNext is the head of the list.
+        uint16_t            num    = 0;
+        int                 sent;
+
+        memset(msgs, 0, sizeof(msgs));
+
+        // Walk the queue from its head and prepare one message header
+        // per queued packet, then send them all with a single
+        // `sendmmsg()` call.
+
+        do
+        {
+            memset(&sockAddrs[num], 0, sizeof(sockAddrs[num]));
+            sockAddrs[num].sin6_family = AF_INET6;
+            sockAddrs[num].sin6_port   = htons(sUdpPort);
+            memcpy(&sockAddrs[num].sin6_addr, &packet->mDestAddress, sizeof(otIp6Address));
+
+            iovecs[num].iov_base = packet->mBuffer;
+            iovecs[num].iov_len  = packet->mLength;
+
+            msgs[num].msg_hdr.msg_iov     = &iovecs[num];
+            msgs[num].msg_hdr.msg_iovlen  = 1;
+            msgs[num].msg_hdr.msg_name    = &sockAddrs[num];
+            msgs[num].msg_hdr.msg_namelen = sizeof(sockAddrs[num]);
+
+            num++;
+            packet = packet->mNext;
+        } while ((packet != sTxPacketQueueTail->mNext) && (num < OT_ARRAY_LENGTH(msgs)));
+
+        sent = sendmmsg(sSocket, msgs, num, 0);
+
+        if (sent < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                otLogDebgPlat("[trel] SendQueuedPackets() - sendmmsg() would block");
+                ExitNow();
+            }
+
+            // On a hard error (e.g., network is down) drop the head
+            // packet (matching the non-batched behavior) and keep
+            // going with the rest of the queue.
+
+            otLogDebgPlat("[trel] SendQueuedPackets() - sendmmsg() failed errno %d", errno);
+            sent = 1;
+        }
+
+        // Remove the sent packets from the head of the packet queue
+        // (circular linked list) and add them back to the free packet
+        // singly linked list.
+
+        for (int index = 0; index < sent; index++)
+        {
+            TxPacket *head = sTxPacketQueueTail->mNext;
+
+            if (head == sTxPacketQueueTail)
+            {
+                sTxPacketQueueTail = NULL;
+            }
+            else
+            {
+                sTxPacketQueueTail->mNext = head->mNext;
+            }
+
+            head->mNext       = sFreeTxPacketHead;
+            sFreeTxPacketHead = head;
+
+            if (sTxPacketQueueTail == NULL)
+            {
+                break;
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+#else // OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+
 static void SendQueuedPackets(void)
 {
     while (sTxPacketQueueTail != NULL)
@@ -452,6 +618,8 @@ static void SendQueuedPackets(void)
     }
 }
 
+#endif // OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+
 static otError EnqueuePacket(const uint8_t *aBuffer, uint16_t aLength, const otIp6Address *aDestAddress)
 {
     otError   error = OT_ERROR_NONE;
@@ -601,6 +769,27 @@ otError otPlatTrelUdp6SendTo(otInstance *        aInstance,
     otLogDebgPlat("[trel] otPlatTrelUdp6SendTo(%s) %s", Ip6AddrToString(aDestAddress),
                   BufferToString(aBuffer, aLength));
 
+#if OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
+    // We always enqueue the packet. `SendQueuedPackets()` flushes the
+    // queue with a single `sendmmsg()` call when the socket is
+    // reported writable by the mainloop, so packets produced in a
+    // burst (within one mainloop iteration) share one syscall.
+
+    error = EnqueuePacket(aBuffer, aLength, aDestAddress);
+
+    if (error == OT_ERROR_NO_BUFS)
+    {
+        // The queue is full - try to flush it and enqueue again.
+
+        SendQueuedPackets();
+        error = EnqueuePacket(aBuffer, aLength, aDestAddress);
+    }
+
+    if (error != OT_ERROR_NONE)
+    {
+        error = OT_ERROR_ABORT;
+    }
+#else
     // We try to send the packet immediately. If it fails (e.g.,
     // network is down) `SendPacket()` returns `OT_ERROR_ABORT`. If
     // the send operation would block (e.g., socket is not yet ready
@@ -619,6 +808,7 @@ otError otPlatTrelUdp6SendTo(otInstance *        aInstance,
             error = OT_ERROR_ABORT;
         }
     }
+#endif // OPENTHREAD_CONFIG_POSIX_TREL_BATCH_IO_ENABLE
 
 exit:
     return error;
@@ -42,10 +42,12 @@
 #include <arpa/inet.h>
 #include <assert.h>
 #include <net/if.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/select.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 #include <openthread/udp.h>
@@ -55,6 +57,10 @@
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
 
+#if OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE && !defined(__linux__)
+#error "batched UDP send (sendmmsg) is only supported on linux platform"
+#endif
+
 #include "posix/platform/ip6_utils.hpp"
 #include "posix/platform/mainloop.hpp"
 #include "posix/platform/udp.hpp"
@@ -65,6 +71,20 @@ namespace {
 
 constexpr size_t kMaxUdpSize = 1280;
 
+#ifdef __APPLE__
+// use fixed value for CMSG_SPACE is not a constant expression on macOS
+constexpr size_t kCmsgBufferSize = 128;
+#else
+constexpr size_t kCmsgBufferSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
+#endif
+
+// Control data template with the `IPV6_HOPLIMIT` and `IPV6_PKTINFO` cmsg headers (and the pktinfo interface index
+// for the Thread netif) precomputed, so per-datagram assembly only writes the values that differ. Rebuilt whenever
+// `gNetifIndex` changes.
+uint8_t      sCmsgTemplate[kCmsgBufferSize];
+bool         sCmsgTemplateValid      = false;
+unsigned int sCmsgTemplateNetifIndex = 0;
+
 void *FdToHandle(int aFd)
 {
     return reinterpret_cast<void *>(aFd);
@@ -85,82 +105,122 @@ bool IsMulticast(const otIp6Address &aAddress)
     return aAddress.mFields.m8[0] == 0xff;
 }
 
-otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMessageInfo &aMessageInfo)
+void UpdateCmsgTemplate(void)
 {
-#ifdef __APPLE__
-    // use fixed value for CMSG_SPACE is not a constant expression on macOS
-    constexpr size_t kBufferSize = 128;
-#else
-    constexpr size_t kBufferSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
-#endif
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kBufferSize];
-    size_t              controlLength = 0;
-    struct iovec        iov;
-    struct msghdr       msg;
-    struct cmsghdr *    cmsg;
-    ssize_t             rval;
-    otError             error = OT_ERROR_NONE;
+    struct msghdr      msg;
+    struct cmsghdr *   cmsg;
+    struct in6_pktinfo pktinfo;
+
+    memset(sCmsgTemplate, 0, sizeof(sCmsgTemplate));
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_control    = sCmsgTemplate;
+    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(sizeof(sCmsgTemplate));
+
+    cmsg             = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = IPPROTO_IPV6;
+    cmsg->cmsg_type  = IPV6_HOPLIMIT;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+
+    cmsg             = CMSG_NXTHDR(&msg, cmsg);
+    cmsg->cmsg_level = IPPROTO_IPV6;
+    cmsg->cmsg_type  = IPV6_PKTINFO;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(pktinfo));
+
+    memset(&pktinfo, 0, sizeof(pktinfo));
+    pktinfo.ipi6_ifindex = gNetifIndex;
+    memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+    sCmsgTemplateNetifIndex = gNetifIndex;
+    sCmsgTemplateValid      = true;
+}
 
-    memset(&peerAddr, 0, sizeof(peerAddr));
-    peerAddr.sin6_port   = htons(aMessageInfo.mPeerPort);
-    peerAddr.sin6_family = AF_INET6;
-    memcpy(&peerAddr.sin6_addr, &aMessageInfo.mPeerAddr, sizeof(peerAddr.sin6_addr));
+void PreparePeerAddr(const otMessageInfo &aMessageInfo, struct sockaddr_in6 &aPeerAddr)
+{
+    memset(&aPeerAddr, 0, sizeof(aPeerAddr));
+    aPeerAddr.sin6_port   = htons(aMessageInfo.mPeerPort);
+    aPeerAddr.sin6_family = AF_INET6;
+    memcpy(&aPeerAddr.sin6_addr, &aMessageInfo.mPeerAddr, sizeof(aPeerAddr.sin6_addr));
 
-    if (IsLinkLocal(peerAddr.sin6_addr) && !aMessageInfo.mIsHostInterface)
+    if (IsLinkLocal(aPeerAddr.sin6_addr) && !aMessageInfo.mIsHostInterface)
     {
         // sin6_scope_id only works for link local destinations
-        peerAddr.sin6_scope_id = gNetifIndex;
+        aPeerAddr.sin6_scope_id = gNetifIndex;
     }
+}
 
-    memset(control, 0, sizeof(control));
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(sizeof(control));
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+size_t PrepareControlData(const otMessageInfo &aMessageInfo, uint8_t (&aControl)[kCmsgBufferSize])
+{
+    struct msghdr   msg;
+    struct cmsghdr *cmsg;
+    size_t          controlLength = 0;
+    int hopLimit = (aMessageInfo.mHopLimit ? aMessageInfo.mHopLimit : OPENTHREAD_CONFIG_IP6_HOP_LIMIT_DEFAULT);
 
+    if (!sCmsgTemplateValid || (sCmsgTemplateNetifIndex != gNetifIndex))
     {
-        int hopLimit = (aMessageInfo.mHopLimit ? aMessageInfo.mHopLimit : OPENTHREAD_CONFIG_IP6_HOP_LIMIT_DEFAULT);
+        UpdateCmsgTemplate();
+    }
 
-        cmsg             = CMSG_FIRSTHDR(&msg);
-        cmsg->cmsg_level = IPPROTO_IPV6;
-        cmsg->cmsg_type  = IPV6_HOPLIMIT;
-        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+    memcpy(aControl, sCmsgTemplate, sizeof(aControl));
 
-        memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_control    = aControl;
+    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(sizeof(aControl));
 
-        controlLength += CMSG_SPACE(sizeof(int));
-    }
+    cmsg = CMSG_FIRSTHDR(&msg); // `IPV6_HOPLIMIT`, header prefilled.
+    memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
+
+    controlLength += CMSG_SPACE(sizeof(int));
 
     if (!IsMulticast(aMessageInfo.mSockAddr) &&
         memcmp(&aMessageInfo.mSockAddr, &in6addr_any, sizeof(aMessageInfo.mSockAddr)))
     {
-        struct in6_pktinfo pktinfo;
+        // `IPV6_PKTINFO`, header and Thread netif index prefilled.
+        cmsg = CMSG_NXTHDR(&msg, cmsg);
 
-        cmsg             = CMSG_NXTHDR(&msg, cmsg);
-        cmsg->cmsg_level = IPPROTO_IPV6;
-        cmsg->cmsg_type  = IPV6_PKTINFO;
-        cmsg->cmsg_len   = CMSG_LEN(sizeof(pktinfo));
+        memcpy(CMSG_DATA(cmsg) + offsetof(struct in6_pktinfo, ipi6_addr), &aMessageInfo.mSockAddr,
+               sizeof(struct in6_addr));
 
-        pktinfo.ipi6_ifindex = aMessageInfo.mIsHostInterface ? 0 : gNetifIndex;
+        if (aMessageInfo.mIsHostInterface)
+        {
+            unsigned int ifindex = 0;
 
-        memcpy(&pktinfo.ipi6_addr, &aMessageInfo.mSockAddr, sizeof(pktinfo.ipi6_addr));
-        memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+            memcpy(CMSG_DATA(cmsg) + offsetof(struct in6_pktinfo, ipi6_ifindex), &ifindex, sizeof(ifindex));
+        }
 
-        controlLength += CMSG_SPACE(sizeof(pktinfo));
+        controlLength += CMSG_SPACE(sizeof(struct in6_pktinfo));
     }
 
+    return controlLength;
+}
+
+otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMessageInfo &aMessageInfo)
+{
+    struct sockaddr_in6 peerAddr;
+    uint8_t             control[kCmsgBufferSize];
+    size_t              controlLength;
+    struct iovec        iov;
+    struct msghdr       msg;
+    ssize_t             rval;
+    otError             error = OT_ERROR_NONE;
+
+    PreparePeerAddr(aMessageInfo, peerAddr);
+    controlLength = PrepareControlData(aMessageInfo, control);
+
+    iov.iov_base = aPayload;
+    iov.iov_len  = aLength;
+
+    msg.msg_name    = &peerAddr;
+    msg.msg_namelen = sizeof(peerAddr);
+    msg.msg_control = control;
+    msg.msg_iov     = &iov;
+    msg.msg_iovlen  = 1;
+    msg.msg_flags   = 0;
+
 #ifdef __APPLE__
     msg.msg_controllen = static_cast<socklen_t>(controlLength);
 #else
-    msg.msg_controllen           = controlLength;
+    msg.msg_controllen = controlLength;
 #endif
 
     rval = sendmsg(aFd, &msg, 0);
@@ -230,6 +290,68 @@ exit:
     return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
 }
 
+#if OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE
+
+struct PendingTxPacket
+{
+    int                 mFd;
+    uint16_t            mLength;
+    size_t              mControlLength;
+    struct sockaddr_in6 mPeerAddr;
+    uint8_t             mControl[kCmsgBufferSize];
+    uint8_t             mPayload[kMaxUdpSize];
+};
+
+PendingTxPacket sPendingTxQueue[OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE];
+uint16_t        sPendingTxCount = 0;
+
+void FlushPendingTxQueue(void)
+{
+    uint16_t index = 0;
+
+    while (index < sPendingTxCount)
+    {
+        struct mmsghdr msgs[OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE];
+        struct iovec   iovecs[OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE];
+        int            fd  = sPendingTxQueue[index].mFd;
+        unsigned int   num = 0;
+
+        memset(msgs, 0, sizeof(msgs));
+
+        // Gather the run of queued datagrams sharing the same socket
+        // and send them with a single `sendmmsg()` call, preserving
+        // the order in which they were queued.
+
+        while ((index + num < sPendingTxCount) && (sPendingTxQueue[index + num].mFd == fd))
+        {
+            PendingTxPacket &packet = sPendingTxQueue[index + num];
+
+            iovecs[num].iov_base = packet.mPayload;
+            iovecs[num].iov_len  = packet.mLength;
+
+            msgs[num].msg_hdr.msg_name       = &packet.mPeerAddr;
+            msgs[num].msg_hdr.msg_namelen    = sizeof(packet.mPeerAddr);
+            msgs[num].msg_hdr.msg_iov        = &iovecs[num];
+            msgs[num].msg_hdr.msg_iovlen     = 1;
+            msgs[num].msg_hdr.msg_control    = packet.mControl;
+            msgs[num].msg_hdr.msg_controllen = packet.mControlLength;
+
+            num++;
+        }
+
+        if (sendmmsg(fd, msgs, num, 0) < 0)
+        {
+            otLogWarnPlat("Failed to send queued UDP datagrams: %s", strerror(errno));
+        }
+
+        index += num;
+    }
+
+    sPendingTxCount = 0;
+}
+
+#endif // OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE
+
 } // namespace
 
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
@@ -438,6 +560,33 @@ otError otPlatUdpSend(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMess
     len = otMessageGetLength(aMessage);
     VerifyOrExit(len == otMessageRead(aMessage, 0, payload, len), error = OT_ERROR_INVALID_ARGS);
 
+#if OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE
+    if (!aMessageInfo->mMulticastLoop)
+    {
+        PendingTxPacket *packet;
+
+        if (sPendingTxCount == OT_ARRAY_LENGTH(sPendingTxQueue))
+        {
+            FlushPendingTxQueue();
+        }
+
+        packet = &sPendingTxQueue[sPendingTxCount++];
+
+        packet->mFd     = fd;
+        packet->mLength = len;
+        memcpy(packet->mPayload, payload, len);
+        PreparePeerAddr(*aMessageInfo, packet->mPeerAddr);
+        packet->mControlLength = PrepareControlData(*aMessageInfo, packet->mControl);
+
+        ExitNow();
+    }
+
+    // Multicast loop-back transmits toggle `IPV6_MULTICAST_LOOP` around
+    // the send, so they bypass the queue; flush it first to preserve
+    // ordering.
+    FlushPendingTxQueue();
+#endif
+
     if (aMessageInfo->mMulticastLoop)
     {
         int value = 1;
@@ -548,6 +697,12 @@ namespace Posix {
 
 void Udp::Update(otSysMainloopContext &aContext)
 {
+#if OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SEND_ENABLE
+    // Flush any datagrams queued during this mainloop iteration before
+    // waiting, so batching never delays a datagram across iterations.
+    FlushPendingTxQueue();
+#endif
+
     VerifyOrExit(gNetifIndex != 0);
 
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
@@ -29,6 +29,9 @@
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
@@ -137,10 +140,77 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0);
 }
 
+/**
+ * Verifies in-place encryption/decryption of a payload stored in a message (spanning multiple message buffers).
+ */
+void TestInPlaceAesCcmProcessing(void)
+{
+    enum : uint16_t
+    {
+        kPayloadLength = ot::kBufferSize * 2 + 51, // Span at least three message buffers.
+        kOffset        = 30,
+        kTagLength     = 8,
+    };
+
+    uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    uint8_t nonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    ot::Instance *     instance = static_cast<ot::Instance *>(testInitInstance());
+    ot::Crypto::AesCcm aesCcm;
+    ot::Message *      message;
+    uint8_t            plainText[kPayloadLength];
+    uint8_t            cipherText[kPayloadLength];
+    uint8_t            readBuffer[kPayloadLength];
+    uint8_t            tag[kTagLength];
+
+    VerifyOrQuit(instance != nullptr);
+
+    ot::Random::NonCrypto::FillBuffer(plainText, sizeof(plainText));
+
+    // Encrypt the same payload as a flat buffer to establish the expected cipher-text.
+
+    memcpy(cipherText, plainText, sizeof(plainText));
+    aesCcm.SetKey(key, sizeof(key));
+    aesCcm.Init(0, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+    aesCcm.Payload(cipherText, cipherText, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+    aesCcm.Finalize(tag);
+
+    // Encrypt the payload in place within the message and compare.
+
+    message = instance->Get<ot::MessagePool>().New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetLength(kOffset + kPayloadLength), "Message::SetLength() failed");
+    message->WriteBytes(kOffset, plainText, kPayloadLength);
+
+    aesCcm.Init(0, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+    aesCcm.Payload(*message, kOffset, kPayloadLength, ot::Crypto::AesCcm::kEncrypt);
+    VerifyOrQuit(aesCcm.GetTagLength() == kTagLength);
+
+    SuccessOrQuit(message->Read(kOffset, readBuffer, kPayloadLength), "Message::Read() failed");
+    VerifyOrQuit(memcmp(readBuffer, cipherText, kPayloadLength) == 0);
+
+    // Decrypt in place and verify the original payload is recovered.
+
+    aesCcm.Init(0, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+    aesCcm.Payload(*message, kOffset, kPayloadLength, ot::Crypto::AesCcm::kDecrypt);
+
+    SuccessOrQuit(message->Read(kOffset, readBuffer, kPayloadLength), "Message::Read() failed");
+    VerifyOrQuit(memcmp(readBuffer, plainText, kPayloadLength) == 0);
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestInPlaceAesCcmProcessing();
     printf("All tests passed\n");
     return 0;
 }
@@ -154,6 +154,37 @@ void TestAllocateRandomly(size_t aSizeLimit, unsigned int aSeed)
                  "TestAllocateRandomly heap not clean after freeing all!");
 }
 
+/**
+ * Verifies the allocation-size histogram.
+ *
+ */
+void TestAllocationHistogram(void)
+{
+    ot::Utils::Heap heap;
+    uint32_t        total = 0;
+    void *          p[4];
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(p); i++)
+    {
+        p[i] = heap.CAlloc(1, 1 << (2 * i)); // 1, 4, 16, 64 bytes.
+        VerifyOrQuit(p[i] != nullptr, "TestAllocationHistogram allocation failed!");
+    }
+
+    for (uint16_t bin = 0; bin < ot::Utils::Heap::kNumHistogramBins; bin++)
+    {
+        total += heap.GetAllocationHistogram()[bin];
+    }
+
+    VerifyOrQuit(total == OT_ARRAY_LENGTH(p), "TestAllocationHistogram unexpected total count!");
+
+    for (void *ptr : p)
+    {
+        heap.Free(ptr);
+    }
+
+    VerifyOrQuit(heap.IsClean(), "TestAllocationHistogram heap not clean after freeing all!");
+}
+
 /**
  * Verifies allocating and free multiple variables.
  */
@@ -171,6 +202,7 @@ void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+    TestAllocationHistogram();
 }
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
@@ -357,6 +357,31 @@ void TestIp6Prefix(void)
     }
 }
 
+void TestIp6AddressPrefixMatch(void)
+{
+    const uint8_t kAddressBytes[OT_IP6_ADDRESS_SIZE] = {0xfd, 0x00, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc,
+                                                        0xde, 0xf0, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc};
+
+    ot::Ip6::Address address1, address2;
+
+    memcpy(address1.mFields.m8, kAddressBytes, sizeof(address1));
+
+    address2 = address1;
+    VerifyOrQuit(address1.PrefixMatch(address2) == ot::Ip6::Address::kSize * CHAR_BIT);
+
+    for (uint8_t bitNumber = 0; bitNumber < ot::Ip6::Address::kSize * CHAR_BIT; bitNumber++)
+    {
+        // Flip the `bitNumber` bit and verify the match length is
+        // exactly the number of bits before the flipped bit.
+
+        address2 = address1;
+        address2.mFields.m8[bitNumber / CHAR_BIT] ^= static_cast<uint8_t>(0x80 >> (bitNumber % CHAR_BIT));
+
+        VerifyOrQuit(address1.PrefixMatch(address2) == bitNumber);
+        VerifyOrQuit(address2.PrefixMatch(address1) == bitNumber);
+    }
+}
+
 void TestIp4Ip6Translation(void)
 {
     struct TestCase
@@ -468,6 +493,7 @@ int main(void)
     TestIp4AddressFromString();
     TestIp6AddressFromString();
     TestIp6Prefix();
+    TestIp6AddressPrefixMatch();
     TestIp4Ip6Translation();
     TestIp6Header();
     printf("All tests passed\n");
@@ -128,6 +128,26 @@ void TestNetworkDataIterator(void)
             PrintExternalRouteConfig(config);
             VerifyOrQuit(CompareExternalRouteConfig(config, route));
         }
+
+        // Iterate over the same Network Data using `GetNextEntry()`. All
+        // entries are external routes and should be yielded in order.
+
+        iter = OT_NETWORK_DATA_ITERATOR_INIT;
+
+        for (const auto &route : routes)
+        {
+            otNetworkDataEntry entry;
+
+            SuccessOrQuit(netData.GetNextEntry(iter, entry));
+            VerifyOrQuit(entry.mType == OT_NETWORK_DATA_ENTRY_EXTERNAL_ROUTE);
+            VerifyOrQuit(CompareExternalRouteConfig(entry.mData.mExternalRoute, route));
+        }
+
+        {
+            otNetworkDataEntry entry;
+
+            VerifyOrQuit(netData.GetNextEntry(iter, entry) == kErrorNotFound);
+        }
     }
 
     {
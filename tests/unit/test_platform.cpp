@@ -234,6 +234,11 @@ OT_TOOL_WEAK otError otPlatRadioEnergyScan(otInstance *, uint8_t, uint16_t)
     return OT_ERROR_NOT_IMPLEMENTED;
 }
 
+OT_TOOL_WEAK otError otPlatRadioEnergyScanBatch(otInstance *, uint32_t, uint32_t, uint16_t, int8_t)
+{
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 OT_TOOL_WEAK otError otPlatRadioSetTransmitPower(otInstance *, int8_t)
 {
     return OT_ERROR_NOT_IMPLEMENTED;
@@ -244,6 +249,11 @@ OT_TOOL_WEAK int8_t otPlatRadioGetReceiveSensitivity(otInstance *)
     return -100;
 }
 
+OT_TOOL_WEAK otError otPlatRadioGetCoexMetrics(otInstance *, otRadioCoexMetrics *)
+{
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 OT_TOOL_WEAK otError otPlatEntropyGet(uint8_t *aOutput, uint16_t aOutputLength)
 {
     otError error = OT_ERROR_NONE;
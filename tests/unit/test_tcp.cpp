@@ -0,0 +1,431 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// This test exercises the TCP engine over the IPv6 loopback path of a single instance (segments sent to one
+// of the instance's own addresses are delivered back through `Ip6::HandleDatagram()`), so a client endpoint,
+// a listener, and the accepted server endpoint all live on the same instance. A virtual millisecond clock
+// (the same idiom as `test_timer.cpp`) replaces the platform alarm so that retransmission and TIME-WAIT
+// timeouts can be driven deterministically. The covered scenarios are: the connect/accept handshake, a bulk
+// multi-buffer transfer reassembled loss-free into a small receive buffer, a retransmission after a dropped
+// (checksum-corrupted) segment, and the full close handshake through TIME-WAIT.
+
+#include "test_platform.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/ip6.h>
+#include <openthread/tasklet.h>
+#include <openthread/tcp.h>
+
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_TCP_ENABLE
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "net/ip6.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kListenPort        = 51717;
+static constexpr size_t   kReceiveBufferSize = 2048;
+static constexpr size_t   kNumBulkBuffers    = 4;
+static constexpr size_t   kBulkBufferSize    = 3000;
+static constexpr size_t   kDropPayloadSize   = 100;
+
+// Virtual millisecond clock (see `test_timer.cpp`). The strong definitions below override the weak
+// wall-clock implementations in `test_platform.cpp`.
+
+static uint32_t sNow;
+static uint32_t sPlatT0;
+static uint32_t sPlatDt;
+static bool     sTimerOn;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sTimerOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sTimerOn = true;
+    sPlatT0  = aT0;
+    sPlatDt  = aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+void otPlatAlarmMicroStop(otInstance *) { sTimerOn = false; }
+
+void otPlatAlarmMicroStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sTimerOn = true;
+    sPlatT0  = aT0;
+    sPlatDt  = aDt;
+}
+
+uint32_t otPlatAlarmMicroGetNow(void) { return sNow; }
+#endif
+
+} // extern "C"
+
+static otTcpEndpoint sClientEndpoint;
+static otTcpEndpoint sServerEndpoint;
+static otTcpListener sListener;
+
+static uint8_t sClientReceiveBuffer[kReceiveBufferSize];
+static uint8_t sServerReceiveBuffer[kReceiveBufferSize];
+
+static bool sClientEstablished;
+static bool sServerEstablished;
+static bool sAcceptDone;
+
+static uint8_t sServerRxData[kNumBulkBuffers * kBulkBufferSize + kDropPayloadSize];
+static size_t  sServerRxLength;
+static bool    sServerSawEndOfStream;
+
+static uint8_t sClientRxData[kReceiveBufferSize];
+static size_t  sClientRxLength;
+
+static uint32_t sClientSendDoneCount;
+static size_t   sClientBytesAcked;
+
+static otTcpDisconnectedReason sClientDisconnectReasons[4];
+static size_t                  sClientDisconnectCount;
+static otTcpDisconnectedReason sServerDisconnectReasons[4];
+static size_t                  sServerDisconnectCount;
+
+static void DrainTasklets(otInstance *aInstance)
+{
+    while (otTaskletsArePending(aInstance))
+    {
+        otTaskletsProcess(aInstance);
+    }
+}
+
+// Advances the virtual clock by `aDuration` milliseconds, firing the platform alarm (and draining the
+// tasklet queue) whenever a scheduled expiry falls within the window.
+static void AdvanceTime(otInstance *aInstance, uint32_t aDuration)
+{
+    uint32_t end = sNow + aDuration;
+
+    DrainTasklets(aInstance);
+
+    while (sTimerOn && (static_cast<int32_t>(sPlatT0 + sPlatDt - end) <= 0))
+    {
+        sNow     = sPlatT0 + sPlatDt;
+        sTimerOn = false;
+        otPlatAlarmMilliFired(aInstance);
+        DrainTasklets(aInstance);
+    }
+
+    sNow = end;
+}
+
+static void HandleEstablished(otTcpEndpoint *aEndpoint)
+{
+    if (aEndpoint == &sClientEndpoint)
+    {
+        sClientEstablished = true;
+    }
+    else if (aEndpoint == &sServerEndpoint)
+    {
+        sServerEstablished = true;
+    }
+}
+
+static void HandleSendDone(otTcpEndpoint *aEndpoint, otLinkedBuffer *aData)
+{
+    OT_UNUSED_VARIABLE(aData);
+
+    if (aEndpoint == &sClientEndpoint)
+    {
+        sClientSendDoneCount++;
+    }
+}
+
+static void HandleBytesAcked(otTcpEndpoint *aEndpoint, size_t aNumBytes)
+{
+    if (aEndpoint == &sClientEndpoint)
+    {
+        sClientBytesAcked += aNumBytes;
+    }
+}
+
+// Copies everything available in the endpoint's receive buffer into the per-endpoint accumulator and
+// commits it, so that the freed window is advertised back to the sender and a bulk transfer can cascade
+// through the tasklet queue.
+static void HandleReceiveAvailable(otTcpEndpoint *aEndpoint, size_t aBytesAvailable, bool aEndOfStream, size_t aBytesRemaining)
+{
+    const otLinkedBuffer *buffer;
+    uint8_t *             dest;
+    size_t *              length;
+    size_t                capacity;
+    size_t                total = 0;
+
+    OT_UNUSED_VARIABLE(aBytesAvailable);
+    OT_UNUSED_VARIABLE(aBytesRemaining);
+
+    if (aEndpoint == &sServerEndpoint)
+    {
+        dest     = sServerRxData;
+        length   = &sServerRxLength;
+        capacity = sizeof(sServerRxData);
+
+        if (aEndOfStream)
+        {
+            sServerSawEndOfStream = true;
+        }
+    }
+    else
+    {
+        dest     = sClientRxData;
+        length   = &sClientRxLength;
+        capacity = sizeof(sClientRxData);
+    }
+
+    SuccessOrQuit(otTcpReceiveByReference(aEndpoint, &buffer), "otTcpReceiveByReference() failed");
+
+    for (; buffer != nullptr; buffer = buffer->mNext)
+    {
+        VerifyOrQuit(*length + buffer->mLength <= capacity, "received more data than was sent");
+        memcpy(dest + *length, buffer->mData, buffer->mLength);
+        *length += buffer->mLength;
+        total += buffer->mLength;
+    }
+
+    if (total > 0)
+    {
+        SuccessOrQuit(otTcpCommitReceive(aEndpoint, total, 0), "otTcpCommitReceive() failed");
+    }
+}
+
+static void HandleDisconnected(otTcpEndpoint *aEndpoint, otTcpDisconnectedReason aReason)
+{
+    if (aEndpoint == &sClientEndpoint)
+    {
+        VerifyOrQuit(sClientDisconnectCount < OT_ARRAY_LENGTH(sClientDisconnectReasons), "too many disconnects");
+        sClientDisconnectReasons[sClientDisconnectCount++] = aReason;
+    }
+    else if (aEndpoint == &sServerEndpoint)
+    {
+        VerifyOrQuit(sServerDisconnectCount < OT_ARRAY_LENGTH(sServerDisconnectReasons), "too many disconnects");
+        sServerDisconnectReasons[sServerDisconnectCount++] = aReason;
+    }
+}
+
+static otTcpIncomingConnectionAction HandleAcceptReady(otTcpListener * aListener,
+                                                       const otSockAddr *aPeer,
+                                                       otTcpEndpoint **  aAcceptInto)
+{
+    OT_UNUSED_VARIABLE(aListener);
+    OT_UNUSED_VARIABLE(aPeer);
+
+    *aAcceptInto = &sServerEndpoint;
+
+    return OT_TCP_INCOMING_CONNECTION_ACTION_ACCEPT;
+}
+
+static void HandleAcceptDone(otTcpListener *aListener, otTcpEndpoint *aEndpoint, const otSockAddr *aPeer)
+{
+    OT_UNUSED_VARIABLE(aListener);
+    OT_UNUSED_VARIABLE(aPeer);
+
+    VerifyOrQuit(aEndpoint == &sServerEndpoint, "accepted into an unexpected endpoint");
+    sAcceptDone = true;
+}
+
+static void InitializeEndpoint(otInstance *aInstance, otTcpEndpoint &aEndpoint, uint8_t *aReceiveBuffer)
+{
+    otTcpEndpointInitializeArgs args;
+
+    memset(&args, 0x00, sizeof(args));
+    args.mEstablishedCallback      = HandleEstablished;
+    args.mSendDoneCallback         = HandleSendDone;
+    args.mBytesAckedCallback       = HandleBytesAcked;
+    args.mReceiveAvailableCallback = HandleReceiveAvailable;
+    args.mDisconnectedCallback     = HandleDisconnected;
+    args.mReceiveBuffer            = aReceiveBuffer;
+    args.mReceiveBufferSize        = kReceiveBufferSize;
+
+    SuccessOrQuit(otTcpEndpointInitialize(aInstance, &aEndpoint, &args), "otTcpEndpointInitialize() failed");
+}
+
+void TestTcpLoopback(void)
+{
+    Instance *      instance = static_cast<Instance *>(testInitInstance());
+    const otNetifAddress *  netifAddress;
+    otSockAddr              listenAddr;
+    otTcpListenerInitializeArgs listenerArgs;
+    static uint8_t          bulkData[kNumBulkBuffers * kBulkBufferSize];
+    static otLinkedBuffer   bulkBuffers[kNumBulkBuffers];
+    static uint8_t          dropData[kDropPayloadSize];
+    static otLinkedBuffer   dropBuffer;
+
+    VerifyOrQuit(instance != nullptr, "testInitInstance() failed");
+
+    sNow = 10000;
+
+    SuccessOrQuit(otIp6SetEnabled(instance, true), "otIp6SetEnabled() failed");
+
+    netifAddress = otIp6GetUnicastAddresses(instance);
+    VerifyOrQuit(netifAddress != nullptr, "no unicast address for loopback");
+
+    memset(&listenAddr, 0x00, sizeof(listenAddr));
+    listenAddr.mAddress = netifAddress->mAddress;
+    listenAddr.mPort    = kListenPort;
+
+    InitializeEndpoint(instance, sClientEndpoint, sClientReceiveBuffer);
+    InitializeEndpoint(instance, sServerEndpoint, sServerReceiveBuffer);
+
+    memset(&listenerArgs, 0x00, sizeof(listenerArgs));
+    listenerArgs.mAcceptReadyCallback = HandleAcceptReady;
+    listenerArgs.mAcceptDoneCallback  = HandleAcceptDone;
+
+    SuccessOrQuit(otTcpListenerInitialize(instance, &sListener, &listenerArgs), "otTcpListenerInitialize() failed");
+    SuccessOrQuit(otTcpListen(&sListener, &listenAddr), "otTcpListen() failed");
+
+    // Connect/accept: the SYN / SYN-ACK / ACK exchange completes entirely through the tasklet queue.
+
+    SuccessOrQuit(otTcpConnect(&sClientEndpoint, &listenAddr, OT_TCP_CONNECT_NO_FAST_OPEN),
+                  "otTcpConnect() failed");
+    AdvanceTime(instance, 10);
+
+    VerifyOrQuit(sClientEstablished, "client did not reach the established state");
+    VerifyOrQuit(sServerEstablished, "accepted endpoint did not reach the established state");
+    VerifyOrQuit(sAcceptDone, "accept-done callback did not fire");
+
+    // Bulk transfer: several linked buffers, each larger than both the maximum segment size and the
+    // server's receive buffer, must be reassembled in order and loss free by the committing receive
+    // callback above.
+
+    for (size_t i = 0; i < sizeof(bulkData); i++)
+    {
+        bulkData[i] = static_cast<uint8_t>((i * 13 + (i >> 8) * 7) & 0xff);
+    }
+
+    for (size_t i = 0; i < kNumBulkBuffers; i++)
+    {
+        bulkBuffers[i].mNext   = nullptr;
+        bulkBuffers[i].mData   = &bulkData[i * kBulkBufferSize];
+        bulkBuffers[i].mLength = kBulkBufferSize;
+
+        SuccessOrQuit(otTcpSendByReference(&sClientEndpoint, &bulkBuffers[i], 0), "otTcpSendByReference() failed");
+    }
+
+    AdvanceTime(instance, 10 * 1000);
+
+    VerifyOrQuit(sServerRxLength == sizeof(bulkData), "bulk transfer did not deliver all bytes");
+    VerifyOrQuit(memcmp(sServerRxData, bulkData, sizeof(bulkData)) == 0, "bulk transfer corrupted the data");
+    VerifyOrQuit(sClientSendDoneCount == kNumBulkBuffers, "not all send buffers were returned");
+    VerifyOrQuit(sClientBytesAcked == sizeof(bulkData), "unexpected acked byte count");
+
+    // Retransmission: corrupt the queued data segment before the send-queue tasklet delivers it (the
+    // checksum was already computed when it was enqueued), so the receiver drops it and the segment must
+    // be recovered by the retransmission timer.
+
+    for (size_t i = 0; i < sizeof(dropData); i++)
+    {
+        dropData[i] = static_cast<uint8_t>(0xa5 ^ i);
+    }
+
+    dropBuffer.mNext   = nullptr;
+    dropBuffer.mData   = dropData;
+    dropBuffer.mLength = sizeof(dropData);
+
+    SuccessOrQuit(otTcpSendByReference(&sClientEndpoint, &dropBuffer, 0), "otTcpSendByReference() failed");
+
+    {
+        Message *message = instance->Get<Ip6::Ip6>().GetSendQueue().GetHead();
+        uint8_t  byte;
+
+        VerifyOrQuit(message != nullptr, "no queued segment to corrupt");
+        SuccessOrQuit(message->Read(message->GetLength() - 1, byte), "Message::Read() failed");
+        byte ^= 0xff;
+        message->Write(message->GetLength() - 1, byte);
+    }
+
+    DrainTasklets(instance);
+
+    VerifyOrQuit(sServerRxLength == sizeof(bulkData), "corrupted segment was not dropped");
+    VerifyOrQuit(sClientSendDoneCount == kNumBulkBuffers, "send-done fired for an unacked buffer");
+
+    AdvanceTime(instance, 5 * 1000);
+
+    VerifyOrQuit(sServerRxLength == sizeof(bulkData) + sizeof(dropData), "dropped segment was not retransmitted");
+    VerifyOrQuit(memcmp(sServerRxData + sizeof(bulkData), dropData, sizeof(dropData)) == 0,
+                 "retransmitted data was corrupted");
+    VerifyOrQuit(sClientSendDoneCount == kNumBulkBuffers + 1, "retransmitted buffer was not returned");
+    VerifyOrQuit(sClientBytesAcked == sizeof(bulkData) + sizeof(dropData), "unexpected acked byte count");
+
+    // Close handshake: client FIN, then server FIN. The client ends up in TIME-WAIT (signaled as a
+    // disconnect with the TIME_WAIT reason) and fully closes once the 2*MSL timeout expires; the server
+    // closes normally once its FIN is acknowledged.
+
+    SuccessOrQuit(otTcpSendEndOfStream(&sClientEndpoint), "otTcpSendEndOfStream() failed");
+    AdvanceTime(instance, 10);
+
+    VerifyOrQuit(sServerSawEndOfStream, "server did not see the end of stream");
+
+    SuccessOrQuit(otTcpSendEndOfStream(&sServerEndpoint), "otTcpSendEndOfStream() failed");
+    AdvanceTime(instance, 10);
+
+    VerifyOrQuit(sServerDisconnectCount == 1, "server did not disconnect");
+    VerifyOrQuit(sServerDisconnectReasons[0] == OT_TCP_DISCONNECTED_REASON_NORMAL, "unexpected server disconnect reason");
+    VerifyOrQuit(sClientDisconnectCount == 1, "client did not enter TIME-WAIT");
+    VerifyOrQuit(sClientDisconnectReasons[0] == OT_TCP_DISCONNECTED_REASON_TIME_WAIT,
+                 "unexpected client disconnect reason");
+
+    AdvanceTime(instance, 61 * 1000);
+
+    VerifyOrQuit(sClientDisconnectCount == 2, "client did not leave TIME-WAIT");
+    VerifyOrQuit(sClientDisconnectReasons[1] == OT_TCP_DISCONNECTED_REASON_NORMAL,
+                 "unexpected client disconnect reason");
+
+    SuccessOrQuit(otTcpListenerDeinitialize(&sListener), "otTcpListenerDeinitialize() failed");
+    SuccessOrQuit(otTcpEndpointDeinitialize(&sClientEndpoint), "otTcpEndpointDeinitialize() failed");
+    SuccessOrQuit(otTcpEndpointDeinitialize(&sServerEndpoint), "otTcpEndpointDeinitialize() failed");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_TCP_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_TCP_ENABLE
+    ot::TestTcpLoopback();
+    printf("All tests passed\n");
+#else
+    printf("TCP feature is not enabled\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,353 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// This benchmark drives bulk UDP (and, when enabled, CoAP) transfers through the IPv6 datapath of a single
+// instance using loopback delivery (datagrams sent to one of the instance's own addresses traverse
+// `Udp::SendDatagram()` -> `Ip6::SendDatagram()` -> `Ip6::HandleDatagram()` -> `Udp::HandlePayload()`), and
+// reports packets per second, per-packet CPU time, and message-pool pressure as JSON lines on stdout so the
+// numbers can be trended in CI. The unit test platform is single-instance and has no radio frame loop, so the
+// MAC/radio segment of the path is not covered here.
+
+#include "test_platform.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/tasklet.h>
+#include <openthread/udp.h>
+#if OPENTHREAD_CONFIG_COAP_API_ENABLE
+#include <openthread/coap.h>
+#endif
+
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+#include "common/instance.hpp"
+#include "net/udp6.hpp"
+#endif
+
+namespace ot {
+
+static constexpr uint16_t kReceiverPort = 12345;
+static constexpr uint32_t kBurstSize    = 4; // Packets sent before draining the tasklet queue.
+
+struct BenchmarkStats
+{
+    uint32_t mRxPackets;
+    uint32_t mRxBytes;
+};
+
+static BenchmarkStats sStats;
+
+static uint64_t GetWallTimeUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000 + static_cast<uint64_t>(ts.tv_nsec) / 1000;
+}
+
+static uint64_t GetCpuTimeUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000 + static_cast<uint64_t>(ts.tv_nsec) / 1000;
+}
+
+static void DrainTasklets(otInstance *aInstance)
+{
+    while (otTaskletsArePending(aInstance))
+    {
+        otTaskletsProcess(aInstance);
+    }
+}
+
+static uint16_t SampleFreeBuffers(otInstance *aInstance)
+{
+    otBufferInfo bufferInfo;
+
+    otMessageGetBufferInfo(aInstance, &bufferInfo);
+
+    return bufferInfo.mFreeBuffers;
+}
+
+static void ReportResult(const char *aName,
+                         uint16_t    aPayloadSize,
+                         uint32_t    aNumPackets,
+                         uint64_t    aWallUs,
+                         uint64_t    aCpuUs,
+                         uint16_t    aMinFreeBuffers,
+                         uint16_t    aTotalBuffers)
+{
+    double pps = (aWallUs != 0) ? (static_cast<double>(aNumPackets) * 1000000.0 / static_cast<double>(aWallUs)) : 0.0;
+
+    printf("{\"benchmark\":\"%s\",\"payload_bytes\":%u,\"packets\":%u,\"wall_us\":%llu,\"cpu_us\":%llu,"
+           "\"pps\":%.0f,\"cpu_us_per_packet\":%.2f,\"min_free_buffers\":%u,\"total_buffers\":%u}\n",
+           aName, static_cast<unsigned int>(aPayloadSize), static_cast<unsigned int>(aNumPackets),
+           static_cast<unsigned long long>(aWallUs), static_cast<unsigned long long>(aCpuUs), pps,
+           static_cast<double>(aCpuUs) / static_cast<double>(aNumPackets), static_cast<unsigned int>(aMinFreeBuffers),
+           static_cast<unsigned int>(aTotalBuffers));
+}
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sStats.mRxPackets++;
+    sStats.mRxBytes += otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
+}
+
+static void RunUdpBenchmark(otInstance *        aInstance,
+                            const otIp6Address &aAddress,
+                            uint16_t            aPayloadSize,
+                            uint32_t            aNumPackets)
+{
+    otUdpSocket    receiver;
+    otUdpSocket    sender;
+    otSockAddr     sockAddr;
+    uint8_t        payload[1024];
+    otBufferInfo   bufferInfo;
+    uint16_t       minFreeBuffers;
+    uint64_t       wallStart;
+    uint64_t       cpuStart;
+    uint64_t       wallUs;
+    uint64_t       cpuUs;
+
+    VerifyOrQuit(aPayloadSize <= sizeof(payload), "payload size too large");
+
+    memset(&sStats, 0, sizeof(sStats));
+    memset(&receiver, 0, sizeof(receiver));
+    memset(&sender, 0, sizeof(sender));
+    memset(&sockAddr, 0, sizeof(sockAddr));
+    memset(payload, 0xab, sizeof(payload));
+
+    otMessageGetBufferInfo(aInstance, &bufferInfo);
+    minFreeBuffers = bufferInfo.mFreeBuffers;
+
+    SuccessOrQuit(otUdpOpen(aInstance, &receiver, HandleUdpReceive, nullptr), "otUdpOpen() failed");
+    sockAddr.mPort = kReceiverPort;
+    SuccessOrQuit(otUdpBind(aInstance, &receiver, &sockAddr, OT_NETIF_THREAD), "otUdpBind() failed");
+
+    SuccessOrQuit(otUdpOpen(aInstance, &sender, nullptr, nullptr), "otUdpOpen() failed");
+
+    wallStart = GetWallTimeUs();
+    cpuStart  = GetCpuTimeUs();
+
+    for (uint32_t sent = 0; sent < aNumPackets;)
+    {
+        for (uint32_t burst = 0; (burst < kBurstSize) && (sent < aNumPackets); burst++, sent++)
+        {
+            otMessage *   message = otUdpNewMessage(aInstance, nullptr);
+            otMessageInfo messageInfo;
+
+            VerifyOrQuit(message != nullptr, "otUdpNewMessage() failed");
+            SuccessOrQuit(otMessageAppend(message, payload, aPayloadSize), "otMessageAppend() failed");
+
+            memset(&messageInfo, 0, sizeof(messageInfo));
+            messageInfo.mPeerAddr = aAddress;
+            messageInfo.mPeerPort = kReceiverPort;
+
+            SuccessOrQuit(otUdpSend(aInstance, &sender, message, &messageInfo), "otUdpSend() failed");
+        }
+
+        {
+            uint16_t freeBuffers = SampleFreeBuffers(aInstance);
+
+            if (freeBuffers < minFreeBuffers)
+            {
+                minFreeBuffers = freeBuffers;
+            }
+        }
+
+        DrainTasklets(aInstance);
+    }
+
+    wallUs = GetWallTimeUs() - wallStart;
+    cpuUs  = GetCpuTimeUs() - cpuStart;
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    // The receive backlog limiter may drop part of each burst on the
+    // non-priority receiver port, so instead of zero loss require every
+    // missing packet to be covered by the socket drop accounting.
+    {
+        uint32_t drops = static_cast<Instance *>(aInstance)->Get<Ip6::Udp>().GetSocketRxDropCount(
+            *static_cast<Ip6::Udp::SocketHandle *>(&receiver));
+
+        VerifyOrQuit(sStats.mRxPackets + drops == aNumPackets, "unaccounted packet loss in loopback transfer");
+        VerifyOrQuit(sStats.mRxBytes == sStats.mRxPackets * aPayloadSize, "payload bytes mismatch");
+    }
+#else
+    VerifyOrQuit(sStats.mRxPackets == aNumPackets, "lost packets in loopback transfer");
+    VerifyOrQuit(sStats.mRxBytes == aNumPackets * aPayloadSize, "payload bytes mismatch");
+#endif
+
+    SuccessOrQuit(otUdpClose(aInstance, &sender), "otUdpClose() failed");
+    SuccessOrQuit(otUdpClose(aInstance, &receiver), "otUdpClose() failed");
+
+    ReportResult("udp-loopback", aPayloadSize, aNumPackets, wallUs, cpuUs, minFreeBuffers, bufferInfo.mTotalBuffers);
+}
+
+#if OPENTHREAD_CONFIG_COAP_API_ENABLE
+
+static void HandleCoapRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sStats.mRxPackets++;
+    sStats.mRxBytes += otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
+}
+
+static void RunCoapBenchmark(otInstance *        aInstance,
+                             const otIp6Address &aAddress,
+                             uint16_t            aPayloadSize,
+                             uint32_t            aNumPackets)
+{
+    otCoapResource resource;
+    uint8_t        payload[1024];
+    otBufferInfo   bufferInfo;
+    uint16_t       minFreeBuffers;
+    uint64_t       wallStart;
+    uint64_t       cpuStart;
+    uint64_t       wallUs;
+    uint64_t       cpuUs;
+
+    VerifyOrQuit(aPayloadSize <= sizeof(payload), "payload size too large");
+
+    memset(&sStats, 0, sizeof(sStats));
+    memset(&resource, 0, sizeof(resource));
+    memset(payload, 0xcd, sizeof(payload));
+
+    otMessageGetBufferInfo(aInstance, &bufferInfo);
+    minFreeBuffers = bufferInfo.mFreeBuffers;
+
+    SuccessOrQuit(otCoapStart(aInstance, OT_DEFAULT_COAP_PORT), "otCoapStart() failed");
+
+    resource.mUriPath = "benchmark";
+    resource.mHandler = HandleCoapRequest;
+    otCoapAddResource(aInstance, &resource);
+
+    wallStart = GetWallTimeUs();
+    cpuStart  = GetCpuTimeUs();
+
+    for (uint32_t sent = 0; sent < aNumPackets;)
+    {
+        for (uint32_t burst = 0; (burst < kBurstSize) && (sent < aNumPackets); burst++, sent++)
+        {
+            otMessage *   message = otCoapNewMessage(aInstance, nullptr);
+            otMessageInfo messageInfo;
+
+            VerifyOrQuit(message != nullptr, "otCoapNewMessage() failed");
+
+            otCoapMessageInit(message, OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_PUT);
+            SuccessOrQuit(otCoapMessageAppendUriPathOptions(message, "benchmark"),
+                          "otCoapMessageAppendUriPathOptions() failed");
+            SuccessOrQuit(otCoapMessageSetPayloadMarker(message), "otCoapMessageSetPayloadMarker() failed");
+            SuccessOrQuit(otMessageAppend(message, payload, aPayloadSize), "otMessageAppend() failed");
+
+            memset(&messageInfo, 0, sizeof(messageInfo));
+            messageInfo.mPeerAddr = aAddress;
+            messageInfo.mPeerPort = OT_DEFAULT_COAP_PORT;
+
+            SuccessOrQuit(otCoapSendRequest(aInstance, message, &messageInfo, nullptr, nullptr),
+                          "otCoapSendRequest() failed");
+        }
+
+        {
+            uint16_t freeBuffers = SampleFreeBuffers(aInstance);
+
+            if (freeBuffers < minFreeBuffers)
+            {
+                minFreeBuffers = freeBuffers;
+            }
+        }
+
+        DrainTasklets(aInstance);
+    }
+
+    wallUs = GetWallTimeUs() - wallStart;
+    cpuUs  = GetCpuTimeUs() - cpuStart;
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    // The CoAP agent owns its UDP socket, so its drop accounting is not
+    // reachable here; with the backlog limiter enabled only require that
+    // part of the burst was delivered.
+    VerifyOrQuit(sStats.mRxPackets > 0, "no packets delivered in loopback transfer");
+#else
+    VerifyOrQuit(sStats.mRxPackets == aNumPackets, "lost packets in loopback transfer");
+#endif
+
+    otCoapRemoveResource(aInstance, &resource);
+    SuccessOrQuit(otCoapStop(aInstance), "otCoapStop() failed");
+
+    ReportResult("coap-loopback", aPayloadSize, aNumPackets, wallUs, cpuUs, minFreeBuffers, bufferInfo.mTotalBuffers);
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_API_ENABLE
+
+void TestThroughputBenchmark(void)
+{
+    otInstance *        instance = testInitInstance();
+    const otNetifAddress *address;
+
+    VerifyOrQuit(instance != nullptr, "failed to initialize instance");
+
+    SuccessOrQuit(otIp6SetEnabled(instance, true), "otIp6SetEnabled() failed");
+
+    address = otIp6GetUnicastAddresses(instance);
+    VerifyOrQuit(address != nullptr, "no unicast address on netif");
+
+    static const uint16_t kPayloadSizes[] = {16, 64, 256};
+
+    for (uint16_t payloadSize : kPayloadSizes)
+    {
+        RunUdpBenchmark(instance, address->mAddress, payloadSize, 2000);
+    }
+
+#if OPENTHREAD_CONFIG_COAP_API_ENABLE
+    RunCoapBenchmark(instance, address->mAddress, 64, 2000);
+#endif
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestThroughputBenchmark();
+    printf("All tests passed\n");
+    return 0;
+}
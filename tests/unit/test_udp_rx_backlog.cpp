@@ -0,0 +1,169 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/tasklet.h>
+#include <openthread/udp.h>
+
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+
+#include "common/instance.hpp"
+#include "net/udp6.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kReceiverPort = 12345;
+static constexpr uint16_t kPayloadSize  = 256;
+static constexpr uint32_t kBurstSize    = 4; // Packets sent before draining the tasklet queue.
+
+static uint32_t sRxPackets;
+static uint32_t sRxBytes;
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sRxPackets++;
+    sRxBytes += otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
+}
+
+static void DrainTasklets(otInstance *aInstance)
+{
+    while (otTaskletsArePending(aInstance))
+    {
+        otTaskletsProcess(aInstance);
+    }
+}
+
+void TestUdpRxBacklogAccounting(void)
+{
+    // Sends enough loopback datagrams to a non-priority socket within a
+    // single rate window to exceed the per-socket byte budget, then
+    // verifies that every datagram not delivered is covered by the
+    // socket drop accounting.
+
+    static constexpr uint32_t kNumPackets =
+        2 * (OPENTHREAD_CONFIG_UDP_RX_BACKLOG_BYTES_PER_WINDOW / kPayloadSize);
+
+    Instance *            instance = static_cast<Instance *>(testInitInstance());
+    const otNetifAddress *address;
+    otUdpSocket           receiver;
+    otUdpSocket           sender;
+    otSockAddr            sockAddr;
+    uint8_t               payload[kPayloadSize];
+    uint32_t              drops;
+
+    VerifyOrQuit(instance != nullptr, "failed to initialize instance");
+
+    SuccessOrQuit(otIp6SetEnabled(instance, true), "otIp6SetEnabled() failed");
+
+    address = otIp6GetUnicastAddresses(instance);
+    VerifyOrQuit(address != nullptr, "no unicast address on netif");
+
+    sRxPackets = 0;
+    sRxBytes   = 0;
+    memset(&receiver, 0, sizeof(receiver));
+    memset(&sender, 0, sizeof(sender));
+    memset(&sockAddr, 0, sizeof(sockAddr));
+    memset(payload, 0xab, sizeof(payload));
+
+    SuccessOrQuit(otUdpOpen(instance, &receiver, HandleUdpReceive, nullptr), "otUdpOpen() failed");
+    sockAddr.mPort = kReceiverPort;
+    SuccessOrQuit(otUdpBind(instance, &receiver, &sockAddr, OT_NETIF_THREAD), "otUdpBind() failed");
+
+    SuccessOrQuit(otUdpOpen(instance, &sender, nullptr, nullptr), "otUdpOpen() failed");
+
+    for (uint32_t sent = 0; sent < kNumPackets;)
+    {
+        for (uint32_t burst = 0; (burst < kBurstSize) && (sent < kNumPackets); burst++, sent++)
+        {
+            otMessage *   message = otUdpNewMessage(instance, nullptr);
+            otMessageInfo messageInfo;
+
+            VerifyOrQuit(message != nullptr, "otUdpNewMessage() failed");
+            SuccessOrQuit(otMessageAppend(message, payload, sizeof(payload)), "otMessageAppend() failed");
+
+            memset(&messageInfo, 0, sizeof(messageInfo));
+            messageInfo.mPeerAddr = address->mAddress;
+            messageInfo.mPeerPort = kReceiverPort;
+
+            SuccessOrQuit(otUdpSend(instance, &sender, message, &messageInfo), "otUdpSend() failed");
+        }
+
+        DrainTasklets(instance);
+    }
+
+    drops = instance->Get<Ip6::Udp>().GetSocketRxDropCount(*static_cast<Ip6::Udp::SocketHandle *>(&receiver));
+
+    // The transfer exceeds the per-window byte budget twice over, so
+    // the limiter must have dropped, and the delivered bytes must not
+    // exceed the budget.
+    VerifyOrQuit(drops > 0, "no drops despite exceeding the window budget");
+    VerifyOrQuit(sRxPackets + drops == kNumPackets, "drop accounting does not cover lost packets");
+    VerifyOrQuit(sRxBytes == sRxPackets * kPayloadSize, "payload bytes mismatch");
+    VerifyOrQuit(sRxBytes <= OPENTHREAD_CONFIG_UDP_RX_BACKLOG_BYTES_PER_WINDOW, "window byte budget exceeded");
+
+    // The burst size keeps the message pool well above the reserve, so
+    // no reserve-protection drops are expected.
+    VerifyOrQuit(instance->Get<Ip6::Udp>().GetRxReserveDropCount() == 0, "unexpected reserve drops");
+
+    // Closing the socket releases its accounting entry.
+    SuccessOrQuit(otUdpClose(instance, &receiver), "otUdpClose() failed");
+    VerifyOrQuit(instance->Get<Ip6::Udp>().GetSocketRxDropCount(
+                     *static_cast<Ip6::Udp::SocketHandle *>(&receiver)) == 0,
+                 "accounting entry not released on close");
+
+    SuccessOrQuit(otUdpClose(instance, &sender), "otUdpClose() failed");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_UDP_RX_BACKLOG_LIMIT_ENABLE
+    ot::TestUdpRxBacklogAccounting();
+    printf("All tests passed\n");
+#else
+    printf("UDP receive backlog limit feature is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -98,6 +98,11 @@
 #define MBEDTLS_X509_CRT_PARSE_C
 #endif
 
+#if OPENTHREAD_CONFIG_CRYPTO_ECC_MAX_OPS
+#define MBEDTLS_ECDH_LEGACY_CONTEXT
+#define MBEDTLS_ECP_RESTARTABLE
+#endif
+
 #if OPENTHREAD_CONFIG_ECDSA_ENABLE
 #define MBEDTLS_BASE64_C
 #define MBEDTLS_ECDH_C
@@ -128,6 +133,8 @@
 #define MBEDTLS_SSL_MAX_CONTENT_LEN      768 /**< Maxium fragment length in bytes */
 #endif
 
+#define MBEDTLS_SSL_DTLS_MAX_BUFFERING   OPENTHREAD_CONFIG_DTLS_MAX_BUFFERING /**< Max RAM for handshake message buffering */
+
 #define MBEDTLS_SSL_CIPHERSUITES         MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8
 
 // Spans multiple lines to avoid being processed by unifdef